@@ -0,0 +1,110 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Header Name:
+
+	memmap.h
+
+Abstract:
+
+	This header defines the interval index of the physical memory map,
+	which tells whether any physical address is RAM or MMIO.
+
+Author:
+
+	agent (@agent) 15-Oct-2026 - Initial version
+
+Environment:
+
+	Kernel mode only.
+
+--*/
+
+#pragma once
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// The number of intervals an index built from a given number of physical
+// memory ranges can need: every RAM range can be followed by a hole, plus
+// the hole before the first one.
+//
+#define SHV_MEMMAP_CAPACITY(ranges)     (2 * (ranges) + 1)
+
+// ===========================================================================
+//
+// STRUCTURES
+//
+// ===========================================================================
+
+//
+// What a range of the physical address space holds.  Anything that isn't
+// RAM is assumed to be MMIO.
+//
+typedef enum _SHV_MEMORY_CLASS {
+	ShvMemoryMmio,
+	ShvMemoryRam,
+} SHV_MEMORY_CLASS, *PSHV_MEMORY_CLASS;
+
+//
+// A range of physical memory [Base, End) of a single class.
+//
+typedef struct _SHV_MEMMAP_RANGE {
+	ULONG64 Base;
+	ULONG64 End;
+	SHV_MEMORY_CLASS Class;
+} SHV_MEMMAP_RANGE, *PSHV_MEMMAP_RANGE;
+
+//
+// The index: a sorted list of non-overlapping ranges covering the whole
+// physical address space, where adjacent ranges never have the same class.
+//
+typedef struct _SHV_MEMMAP {
+	ULONG Count;
+	ULONG64 TopOfRam;
+	SHV_MEMMAP_RANGE Ranges[ANYSIZE_ARRAY];
+} SHV_MEMMAP, *PSHV_MEMMAP;
+
+// ===========================================================================
+//
+// PUBLIC PROTOTYPES
+//
+// ===========================================================================
+
+VOID
+ShvMemMapCompile(
+	_In_reads_(Count) const PHYSICAL_MEMORY_RANGE *Ranges,
+	_In_ ULONG Count,
+	_Out_ PSHV_MEMMAP Map
+);
+
+NTSTATUS
+ShvMemMapInitialize(
+	_In_ PDRIVER_OBJECT DriverObject
+);
+
+VOID
+ShvMemMapCleanup(
+	VOID
+);
+
+NTSTATUS
+ShvMemMapRefresh(
+	VOID
+);
+
+SHV_MEMORY_CLASS
+ShvMemMapLookup(
+	_In_ ULONG64 Address,
+	_Out_ PULONG64 End
+);
+
+ULONG64
+ShvMemMapGetTopOfRam(
+	VOID
+);
@@ -0,0 +1,163 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Header Name:
+
+	mtrr.h
+
+Abstract:
+
+	This header defines the MSRs and structures for Intel x64 MTRR support.
+
+Author:
+
+	agent (@agent) 15-Oct-2026 - Initial version
+
+Environment:
+
+	Kernel mode only.
+
+--*/
+
+#pragma once
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// MTRR MSRs.
+//
+#define MSR_IA32_MTRRCAP                0xfe
+#define MSR_IA32_MTRR_DEF_TYPE          0x2ff
+#define MSR_IA32_MTRR_PHYSBASE0         0x200
+#define MSR_IA32_MTRR_PHYSMASK0         0x201
+#define MSR_IA32_MTRR_FIX64K_00000      0x250
+#define MSR_IA32_MTRR_FIX16K_80000      0x258
+#define MSR_IA32_MTRR_FIX16K_A0000      0x259
+#define MSR_IA32_MTRR_FIX4K_C0000       0x268
+
+//
+// Bits in the IA32_MTRRCAP MSR.
+//
+#define MTRR_CAP_VCNT_MASK              0xff
+#define MTRR_CAP_FIXED                  (1ULL << 8)
+
+//
+// Bits in the IA32_MTRR_DEF_TYPE MSR.
+//
+#define MTRR_DEF_TYPE_MASK              0xff
+#define MTRR_DEF_FIXED_ENABLE           (1ULL << 10)
+#define MTRR_DEF_ENABLE                 (1ULL << 11)
+
+//
+// Bits in the IA32_MTRR_PHYSBASEn and IA32_MTRR_PHYSMASKn MSRs.
+//
+#define MTRR_PHYSBASE_TYPE_MASK         0xff
+#define MTRR_PHYSMASK_VALID             (1ULL << 11)
+
+//
+// The fixed-range MTRRs cover the first 1 MiB of physical memory with 8
+// 64 KiB ranges, 16 16 KiB ranges and 64 4 KiB ranges.
+//
+#define MTRR_FIXED_RANGE_COUNT          88
+#define MTRR_FIXED_RANGE_END            0x100000ULL
+
+//
+// The number of variable-range MTRRs we are prepared to handle.  Current
+// processors implement at most a few dozen.
+//
+#define SHV_MTRR_MAX_VARIABLE           64
+
+//
+// The largest number of uniformly typed intervals the compiled map can
+// hold.  Every variable range can add at most two boundaries and every
+// fixed range at most one.
+//
+#define SHV_MTRR_MAX_RANGES             (2 * SHV_MTRR_MAX_VARIABLE + MTRR_FIXED_RANGE_COUNT + 2)
+
+// ===========================================================================
+//
+// STRUCTURES
+//
+// ===========================================================================
+
+//
+// A raw variable-range MTRR pair.
+//
+typedef struct _SHV_MTRR_VARIABLE {
+	ULONG64 PhysBase;
+	ULONG64 PhysMask;
+} SHV_MTRR_VARIABLE, *PSHV_MTRR_VARIABLE;
+
+//
+// The raw MTRR configuration of the processor.  Keeping this separate from
+// the compiled map lets the compiler run against synthetic MTRR sets.
+//
+typedef struct _SHV_MTRR_STATE {
+	ULONG64 DefType;
+	ULONG PhysicalAddressBits;
+	BOOLEAN FixedSupported;
+	ULONG VariableCount;
+	UCHAR Fixed[MTRR_FIXED_RANGE_COUNT];
+	SHV_MTRR_VARIABLE Variable[SHV_MTRR_MAX_VARIABLE];
+} SHV_MTRR_STATE, *PSHV_MTRR_STATE;
+
+//
+// A range of physical memory [Base, End) with a single memory type.
+// PageSize is the largest page (4 KiB, 2 MiB or 1 GiB) that can be mapped
+// somewhere inside of the range without mixing memory types.
+//
+typedef struct _SHV_MTRR_RANGE {
+	ULONG64 Base;
+	ULONG64 End;
+	ULONG64 PageSize;
+	UCHAR Type;
+} SHV_MTRR_RANGE, *PSHV_MTRR_RANGE;
+
+//
+// The compiled memory type map: a sorted list of non-overlapping ranges
+// covering the whole physical address space.
+//
+typedef struct _SHV_MTRR_MAP {
+	ULONG Count;
+	SHV_MTRR_RANGE Ranges[SHV_MTRR_MAX_RANGES];
+} SHV_MTRR_MAP, *PSHV_MTRR_MAP;
+
+// ===========================================================================
+//
+// PUBLIC PROTOTYPES
+//
+// ===========================================================================
+
+VOID
+ShvMtrrCapture(
+	_Out_ PSHV_MTRR_STATE State
+);
+
+NTSTATUS
+ShvMtrrCompile(
+	_In_ const SHV_MTRR_STATE *State,
+	_Out_ PSHV_MTRR_MAP Map
+);
+
+NTSTATUS
+ShvMtrrInitialize(
+	VOID
+);
+
+UCHAR
+ShvMtrrLookup(
+	_In_ ULONG64 Address,
+	_Out_ PULONG64 End
+);
+
+BOOLEAN
+ShvMtrrGetMemoryType(
+	_In_ ULONG64 Base,
+	_In_ ULONG64 Size,
+	_Out_ PUCHAR Type
+);
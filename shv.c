@@ -32,15 +32,49 @@ Environment:
 
 PSHV_GLOBAL_DATA ShvGlobalData;
 
+// ===========================================================================
+//
+// LOCAL DATA
+//
+// ===========================================================================
+
+//
+// The device user mode consumers send their requests to, as
+// \\.\SimpleVisor.
+//
+static UNICODE_STRING ShvDeviceName = RTL_CONSTANT_STRING(L"\\Device\\SimpleVisor");
+static UNICODE_STRING ShvLinkName = RTL_CONSTANT_STRING(L"\\DosDevices\\SimpleVisor");
+static PDEVICE_OBJECT ShvDeviceObject = NULL;
+
 // ===========================================================================
 //
 // LOCAL PROTOTYPES
 //
 // ===========================================================================
 
+static NTSTATUS
+ShvCreateDevice(
+	_In_ PDRIVER_OBJECT DriverObject
+);
+
+static VOID
+ShvDeleteDevice(
+	VOID
+);
+
 DRIVER_INITIALIZE ShvInitialize;
 DRIVER_UNLOAD ShvUnload;
 
+_Dispatch_type_(IRP_MJ_CREATE)
+_Dispatch_type_(IRP_MJ_CLOSE)
+DRIVER_DISPATCH ShvDispatchCreateClose;
+
+_Dispatch_type_(IRP_MJ_CLEANUP)
+DRIVER_DISPATCH ShvDispatchCleanup;
+
+_Dispatch_type_(IRP_MJ_DEVICE_CONTROL)
+DRIVER_DISPATCH ShvDispatchDeviceControl;
+
 // ===========================================================================
 //
 // PUBLIC FUNCTIONS
@@ -54,6 +88,24 @@ ShvUnload(
 {
 	UNREFERENCED_PARAMETER(DriverObject);
 
+	//
+	// Stop taking requests first.  Whatever is still mapped is unmapped by
+	// the cleanup of the module that mapped it.
+	//
+	ShvDeleteDevice();
+
+	//
+	// Drop the hooks and watchpoints and give merged and sampled pages their
+	// own frames and access back first, since that takes the VPs to handle
+	// the faults that may come in the meantime.
+	//
+	ShvVmxNumaCleanup();
+	ShvVmxCoverCleanup();
+	ShvVmxTraceCleanup();
+	ShvVmxHookCleanup();
+	ShvVmxWatchCleanup();
+	ShvVmxMergeCleanup();
+
 	//
 	// Attempt to exit VMX root mode on all logical processors. This will
 	// broadcast a DPC interrupt which will execute the callback routine in
@@ -66,8 +118,12 @@ ShvUnload(
 	KeGenericCallDpc(ShvVpCallbackDpc, NULL);
 
 	//
-	// Free the EPT tables.
+	// Free the guest mapping windows, the dirty bitmap, the memory map
+	// index and the EPT tables.
 	//
+	ShvVmxGuestCleanup();
+	ShvVmxPmlCleanup();
+	ShvMemMapCleanup();
 	ShvVmxEptCleanup();
 
 	//
@@ -136,12 +192,153 @@ ShvInitialize(
 		return STATUS_HV_INSUFFICIENT_BUFFER;
 	}
 
+	//
+	// Index the physical memory map, which the EPT tables are built from.
+	//
+	ret = ShvMemMapInitialize(DriverObject);
+	if (ret != STATUS_SUCCESS)
+	{
+		MmFreeContiguousMemory(ShvGlobalData);
+		return ret;
+	}
+
 	//
 	// Allocate and initialize EPT tables.
 	//
 	ret = ShvVmxEptInitialize();
 	if (ret != STATUS_SUCCESS)
 	{
+		ShvMemMapCleanup();
+		MmFreeContiguousMemory(ShvGlobalData);
+		return ret;
+	}
+
+	//
+	// Set up page modification logging, if it was asked for. This has to
+	// happen before the EPT pointer is loaded on any LP.
+	//
+	ret = ShvVmxPmlInitialize();
+	if (ret != STATUS_SUCCESS)
+	{
+		ShvMemMapCleanup();
+		ShvVmxEptCleanup();
+		MmFreeContiguousMemory(ShvGlobalData);
+		return ret;
+	}
+
+	//
+	// Reserve the windows that root mode maps guest memory through. This
+	// has to happen at passive level, before any LP enters root mode.
+	//
+	ret = ShvVmxGuestInitialize();
+	if (ret != STATUS_SUCCESS)
+	{
+		ShvVmxPmlCleanup();
+		ShvMemMapCleanup();
+		ShvVmxEptCleanup();
+		MmFreeContiguousMemory(ShvGlobalData);
+		return ret;
+	}
+
+	//
+	// Set up page merging, which needs root mode to be able to shoot down
+	// the TLBs of other LPs. This also has to happen before any LP enters
+	// root mode.
+	//
+	ret = ShvVmxMergeInitialize();
+	if (ret != STATUS_SUCCESS)
+	{
+		ShvVmxGuestCleanup();
+		ShvVmxPmlCleanup();
+		ShvMemMapCleanup();
+		ShvVmxEptCleanup();
+		MmFreeContiguousMemory(ShvGlobalData);
+		return ret;
+	}
+
+	//
+	// Set up watchpoints, whose view has to be cloned before anything in
+	// the default view gets protected.
+	//
+	ret = ShvVmxWatchInitialize();
+	if (ret != STATUS_SUCCESS)
+	{
+		ShvVmxMergeCleanup();
+		ShvVmxGuestCleanup();
+		ShvVmxPmlCleanup();
+		ShvMemMapCleanup();
+		ShvVmxEptCleanup();
+		MmFreeContiguousMemory(ShvGlobalData);
+		return ret;
+	}
+
+	//
+	// Set up hooks, whose views have to be cloned before anything in the
+	// default view gets protected too.
+	//
+	ret = ShvVmxHookInitialize();
+	if (ret != STATUS_SUCCESS)
+	{
+		ShvVmxWatchCleanup();
+		ShvVmxMergeCleanup();
+		ShvVmxGuestCleanup();
+		ShvVmxPmlCleanup();
+		ShvMemMapCleanup();
+		ShvVmxEptCleanup();
+		MmFreeContiguousMemory(ShvGlobalData);
+		return ret;
+	}
+
+	//
+	// Set up the rings of the system call tracer.
+	//
+	ret = ShvVmxTraceInitialize();
+	if (ret != STATUS_SUCCESS)
+	{
+		ShvVmxHookCleanup();
+		ShvVmxWatchCleanup();
+		ShvVmxMergeCleanup();
+		ShvVmxGuestCleanup();
+		ShvVmxPmlCleanup();
+		ShvMemMapCleanup();
+		ShvVmxEptCleanup();
+		MmFreeContiguousMemory(ShvGlobalData);
+		return ret;
+	}
+
+	//
+	// Set up the code coverage collector.
+	//
+	ret = ShvVmxCoverInitialize();
+	if (ret != STATUS_SUCCESS)
+	{
+		ShvVmxTraceCleanup();
+		ShvVmxHookCleanup();
+		ShvVmxWatchCleanup();
+		ShvVmxMergeCleanup();
+		ShvVmxGuestCleanup();
+		ShvVmxPmlCleanup();
+		ShvMemMapCleanup();
+		ShvVmxEptCleanup();
+		MmFreeContiguousMemory(ShvGlobalData);
+		return ret;
+	}
+
+	//
+	// Set up the NUMA sampler.
+	//
+	ret = ShvVmxNumaInitialize();
+	if (ret != STATUS_SUCCESS)
+	{
+		ShvVmxCoverCleanup();
+		ShvVmxTraceCleanup();
+		ShvVmxHookCleanup();
+		ShvVmxWatchCleanup();
+		ShvVmxMergeCleanup();
+		ShvVmxGuestCleanup();
+		ShvVmxPmlCleanup();
+		ShvMemMapCleanup();
+		ShvVmxEptCleanup();
 		MmFreeContiguousMemory(ShvGlobalData);
 		return ret;
 	}
@@ -162,11 +359,40 @@ ShvInitialize(
 	//
 	if (HviIsAnyHypervisorPresent() == FALSE)
 	{
+		ShvVmxNumaCleanup();
+		ShvVmxCoverCleanup();
+		ShvVmxTraceCleanup();
+		ShvVmxHookCleanup();
+		ShvVmxWatchCleanup();
+		ShvVmxMergeCleanup();
+		ShvVmxGuestCleanup();
+		ShvVmxPmlCleanup();
+		ShvMemMapCleanup();
 		ShvVmxEptCleanup();
 		MmFreeContiguousMemory(ShvGlobalData);
 		return STATUS_HV_NOT_PRESENT;
 	}
 
+	//
+	// Start scanning for pages to merge. Without the scanner nothing gets
+	// merged, but the SHV works all the same.
+	//
+	ret = ShvVmxMergeStart();
+	if (ret != STATUS_SUCCESS)
+	{
+		SHV_DEBUG_PRINT("Page merging could not be started: %x\n", ret);
+	}
+
+	//
+	// Take requests from user mode consumers. Without the device the tracer
+	// can't be driven, but the SHV works all the same.
+	//
+	ret = ShvCreateDevice(DriverObject);
+	if (ret != STATUS_SUCCESS)
+	{
+		SHV_DEBUG_PRINT("The SHV device could not be created: %x\n", ret);
+	}
+
 	//
 	// Make the driver (and SHV itself) unloadable, and indicate success.
 	//
@@ -174,3 +400,192 @@ ShvInitialize(
 	SHV_PRINT("The SHV has been installed.\n");
 	return STATUS_SUCCESS;
 }
+
+NTSTATUS
+ShvDispatchCreateClose(
+	_In_ PDEVICE_OBJECT DeviceObject,
+	_Inout_ PIRP Irp
+)
+{
+	UNREFERENCED_PARAMETER(DeviceObject);
+
+	Irp->IoStatus.Status = STATUS_SUCCESS;
+	Irp->IoStatus.Information = 0;
+	IoCompleteRequest(Irp, IO_NO_INCREMENT);
+
+	return STATUS_SUCCESS;
+}
+
+NTSTATUS
+ShvDispatchCleanup(
+	_In_ PDEVICE_OBJECT DeviceObject,
+	_Inout_ PIRP Irp
+)
+{
+	UNREFERENCED_PARAMETER(DeviceObject);
+
+	//
+	// The last handle to the file object was closed, which also happens
+	// when the process that had it exits.  Undo whatever was mapped through
+	// it while the process is still around.
+	//
+	ShvVmxTraceUnmapRings(IoGetCurrentIrpStackLocation(Irp)->FileObject);
+
+	Irp->IoStatus.Status = STATUS_SUCCESS;
+	Irp->IoStatus.Information = 0;
+	IoCompleteRequest(Irp, IO_NO_INCREMENT);
+
+	return STATUS_SUCCESS;
+}
+
+NTSTATUS
+ShvDispatchDeviceControl(
+	_In_ PDEVICE_OBJECT DeviceObject,
+	_Inout_ PIRP Irp
+)
+{
+	PIO_STACK_LOCATION stack;
+	ULONG_PTR information;
+	ULONG inputLength;
+	NTSTATUS ret;
+
+	UNREFERENCED_PARAMETER(DeviceObject);
+
+	stack = IoGetCurrentIrpStackLocation(Irp);
+	inputLength = stack->Parameters.DeviceIoControl.InputBufferLength;
+	information = 0;
+
+	//
+	// Requests are buffered, and this is the top of the stack, so they run
+	// in the context of the process that sent them, which is where the
+	// rings get mapped.  Starting, stopping and changing the filter wait
+	// on a mutex, which is fine at passive level.
+	//
+	switch (stack->Parameters.DeviceIoControl.IoControlCode)
+	{
+	case IOCTL_SHV_TRACE_MAP_RINGS:
+		if (stack->Parameters.DeviceIoControl.OutputBufferLength < sizeof(SHV_TRACE_MAPPING))
+		{
+			ret = STATUS_BUFFER_TOO_SMALL;
+			break;
+		}
+
+		ret = ShvVmxTraceMapRings(stack->FileObject, (PSHV_TRACE_MAPPING)Irp->AssociatedIrp.SystemBuffer);
+		if (ret == STATUS_SUCCESS)
+		{
+			information = sizeof(SHV_TRACE_MAPPING);
+		}
+
+		break;
+	case IOCTL_SHV_TRACE_UNMAP_RINGS:
+		ShvVmxTraceUnmapRings(stack->FileObject);
+		ret = STATUS_SUCCESS;
+		break;
+	case IOCTL_SHV_TRACE_START:
+		if (inputLength < sizeof(ULONG))
+		{
+			ret = STATUS_BUFFER_TOO_SMALL;
+			break;
+		}
+
+		ret = ShvVmxTraceStart(*(PULONG)Irp->AssociatedIrp.SystemBuffer);
+		break;
+	case IOCTL_SHV_TRACE_STOP:
+		ret = ShvVmxTraceStop();
+		break;
+	case IOCTL_SHV_TRACE_SET_FILTER:
+		if ((inputLength % sizeof(ULONG64)) != 0 ||
+			(inputLength > SHV_TRACE_MAX_FILTERS * sizeof(ULONG64)))
+		{
+			ret = STATUS_INVALID_PARAMETER;
+			break;
+		}
+
+		ret = ShvVmxTraceSetFilter((const ULONG64 *)Irp->AssociatedIrp.SystemBuffer,
+			inputLength / sizeof(ULONG64));
+		break;
+	case IOCTL_SHV_TRACE_QUERY:
+		if (stack->Parameters.DeviceIoControl.OutputBufferLength < sizeof(SHV_TRACE_STATISTICS))
+		{
+			ret = STATUS_BUFFER_TOO_SMALL;
+			break;
+		}
+
+		ShvVmxTraceQuery((PSHV_TRACE_STATISTICS)Irp->AssociatedIrp.SystemBuffer);
+		information = sizeof(SHV_TRACE_STATISTICS);
+		ret = STATUS_SUCCESS;
+		break;
+	default:
+		ret = STATUS_INVALID_DEVICE_REQUEST;
+		break;
+	}
+
+	Irp->IoStatus.Status = ret;
+	Irp->IoStatus.Information = information;
+	IoCompleteRequest(Irp, IO_NO_INCREMENT);
+
+	return ret;
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+static NTSTATUS
+ShvCreateDevice(
+	_In_ PDRIVER_OBJECT DriverObject
+)
+{
+	NTSTATUS ret;
+
+	DriverObject->MajorFunction[IRP_MJ_CREATE] = ShvDispatchCreateClose;
+	DriverObject->MajorFunction[IRP_MJ_CLOSE] = ShvDispatchCreateClose;
+	DriverObject->MajorFunction[IRP_MJ_CLEANUP] = ShvDispatchCleanup;
+	DriverObject->MajorFunction[IRP_MJ_DEVICE_CONTROL] = ShvDispatchDeviceControl;
+
+	//
+	// The default security of a device lets only administrators and the
+	// system write to it, which every request needs.
+	//
+	ret = IoCreateDevice(DriverObject,
+		0,
+		&ShvDeviceName,
+		FILE_DEVICE_UNKNOWN,
+		FILE_DEVICE_SECURE_OPEN,
+		FALSE,
+		&ShvDeviceObject);
+	if (ret != STATUS_SUCCESS)
+	{
+		ShvDeviceObject = NULL;
+		return ret;
+	}
+
+	ret = IoCreateSymbolicLink(&ShvLinkName, &ShvDeviceName);
+	if (ret != STATUS_SUCCESS)
+	{
+		IoDeleteDevice(ShvDeviceObject);
+		ShvDeviceObject = NULL;
+		return ret;
+	}
+
+	ShvDeviceObject->Flags &= ~DO_DEVICE_INITIALIZING;
+
+	return STATUS_SUCCESS;
+}
+
+static VOID
+ShvDeleteDevice(
+	VOID
+)
+{
+	if (ShvDeviceObject == NULL)
+	{
+		return;
+	}
+
+	IoDeleteSymbolicLink(&ShvLinkName);
+	IoDeleteDevice(ShvDeviceObject);
+	ShvDeviceObject = NULL;
+}
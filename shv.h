@@ -31,6 +31,18 @@ Environment:
 #include "ntint.h"
 #include "vmx.h"
 #include "vmxept.h"
+#include "vmxeptimage.h"
+#include "mtrr.h"
+#include "memmap.h"
+#include "vmxpml.h"
+#include "vmxguest.h"
+#include "vmxmerge.h"
+#include "vmxwatch.h"
+#include "vmxemul.h"
+#include "vmxhook.h"
+#include "vmxtrace.h"
+#include "vmxcover.h"
+#include "vmxnuma.h"
 
 typedef struct _VMX_GDTENTRY64
 {
@@ -83,13 +95,25 @@ typedef struct _SHV_VP_DATA
 	ULONGLONG VmxOnPhysicalAddress;
 	ULONGLONG VmcsPhysicalAddress;
 	ULONGLONG MsrBitmapPhysicalAddress;
+	ULONGLONG PmlPhysicalAddress;
+	ULONGLONG VePhysicalAddress;
+	ULONG64 EptGeneration;
+	ULONG ApicId;
+	volatile LONG NmiRequested;
+	volatile LONG GuestNmis;
+	PVOID GuestWindow;
+	volatile ULONG64 *GuestWindowPte;
+	BOOLEAN HookStep;
 
 	DECLSPEC_ALIGN(PAGE_SIZE) UCHAR ShvStackLimit[KERNEL_STACK_SIZE];
 	VMX_VMCS VmxOn;
 	VMX_VMCS Vmcs;
+	ULONG64 PmlBuffer[VMX_PML_ENTRY_COUNT];
+	VMX_VE_INFORMATION VeInformation;
+	SHV_GUEST_TLB GuestTlb;
 } SHV_VP_DATA, *PSHV_VP_DATA;
 
-C_ASSERT(sizeof(SHV_VP_DATA) == (KERNEL_STACK_SIZE + 3 * PAGE_SIZE));
+C_ASSERT(sizeof(SHV_VP_DATA) == (KERNEL_STACK_SIZE + 6 * PAGE_SIZE));
 
 typedef struct _SHV_GLOBAL_DATA
 {
@@ -147,6 +171,34 @@ ShvUtilAllocateContiguousMemory(
 	_In_ SIZE_T NumberOfBytes
 );
 
+PVOID
+ShvUtilAllocateContiguousNodeMemory(
+	_In_ SIZE_T NumberOfBytes,
+	_In_ ULONG Node
+);
+
+VOID
+ShvUtilSortByKey(
+	_Inout_updates_bytes_(Count * Size) PVOID Elements,
+	_In_ ULONG Count,
+	_In_ ULONG Size
+);
+
+PVOID
+ShvUtilFindByKey(
+	_In_reads_bytes_(Count * Size) const VOID *Elements,
+	_In_ ULONG Count,
+	_In_ ULONG Size,
+	_In_ ULONG64 Key
+);
+
+VOID
+ShvUtilSetMonitorTrap(
+	_In_ BOOLEAN Enable
+);
+
+KIPI_BROADCAST_WORKER ShvUtilIpiBarrier;
+
 PSHV_GLOBAL_DATA
 ShvVpAllocateGlobalData(
 	VOID
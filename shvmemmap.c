@@ -0,0 +1,435 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvmemmap.c
+
+Abstract:
+
+	This module implements the interval index of the physical memory map.
+	It is built once at load from the physical memory ranges, rebuilt
+	whenever memory is hot-added, and answers whether a physical address is
+	RAM or MMIO with a binary search, which is safe in root mode.
+
+Author:
+
+	agent (@agent) 15-Oct-2026 - Initial version
+
+Environment:
+
+	Kernel mode only.
+
+--*/
+
+#include "shv.h"
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+#define SHV_MEMMAP_TAG                  'PAMS'
+
+// ===========================================================================
+//
+// LOCAL DATA
+//
+// ===========================================================================
+
+//
+// The current index.  Root mode reads it without a lock, so a new index is
+// only ever published whole, and the old one is only freed once no LP can
+// be in the middle of a lookup anymore.
+//
+static PSHV_MEMMAP volatile ShvMemMap = NULL;
+static FAST_MUTEX ShvMemMapLock = { 0 };
+static PVOID ShvMemMapNotification = NULL;
+
+//
+// The device interface class of memory devices, whose arrival is how we
+// learn that memory was hot-added.
+//
+static const GUID ShvMemMapDeviceMemory =
+	{ 0x3fd0f03d, 0x92e0, 0x45fb, { 0xb7, 0x5c, 0x5e, 0xd8, 0xff, 0xb0, 0x10, 0x21 } };
+
+// ===========================================================================
+//
+// LOCAL PROTOTYPES
+//
+// ===========================================================================
+
+static NTSTATUS
+ShvMemMapBuild(
+	_Out_ PSHV_MEMMAP *Map
+);
+
+static SHV_MEMORY_CLASS
+ShvMemMapFind(
+	_In_ const SHV_MEMMAP *Map,
+	_In_ ULONG64 Address,
+	_Out_ PULONG64 End
+);
+
+DRIVER_NOTIFICATION_CALLBACK_ROUTINE ShvMemMapNotify;
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+VOID
+ShvMemMapCompile(
+	_In_reads_(Count) const PHYSICAL_MEMORY_RANGE *Ranges,
+	_In_ ULONG Count,
+	_Out_ PSHV_MEMMAP Map
+)
+{
+	SHV_MEMMAP_RANGE range;
+	ULONG ram, total, i, j;
+
+	//
+	// Sort the RAM ranges by base into the start of the map.  There are
+	// only ever a handful of them, so an insertion sort is plenty.
+	//
+	ram = 0;
+
+	for (i = 0; i < Count; i++)
+	{
+		if (Ranges[i].NumberOfBytes.QuadPart == 0)
+		{
+			continue;
+		}
+
+		range.Base = Ranges[i].BaseAddress.QuadPart;
+		range.End = range.Base + Ranges[i].NumberOfBytes.QuadPart;
+		range.Class = ShvMemoryRam;
+
+		for (j = ram; (j > 0) && (Map->Ranges[j - 1].Base > range.Base); j--)
+		{
+			Map->Ranges[j] = Map->Ranges[j - 1];
+		}
+
+		Map->Ranges[j] = range;
+		ram++;
+	}
+
+	//
+	// Coalesce RAM ranges that touch or overlap.
+	//
+	for (i = 0, j = 0; i < ram; i++)
+	{
+		if ((j > 0) && (Map->Ranges[i].Base <= Map->Ranges[j - 1].End))
+		{
+			Map->Ranges[j - 1].End = max(Map->Ranges[j - 1].End, Map->Ranges[i].End);
+			continue;
+		}
+
+		Map->Ranges[j++] = Map->Ranges[i];
+	}
+
+	ram = j;
+
+	//
+	// Every gap between RAM ranges is now exactly one hole, plus the ones
+	// below the first range and above the last.  Spread the RAM ranges out
+	// from the end, filling in the holes, so it can all be done in place.
+	//
+	total = SHV_MEMMAP_CAPACITY(ram);
+
+	if ((ram != 0) && (Map->Ranges[0].Base == 0))
+	{
+		total--;
+	}
+
+	if ((ram != 0) && (Map->Ranges[ram - 1].End == MAXULONG64))
+	{
+		total--;
+	}
+
+	Map->Count = total;
+	Map->TopOfRam = (ram != 0) ? Map->Ranges[ram - 1].End : 0;
+
+	j = total;
+	range.End = MAXULONG64;
+
+	for (i = ram; i > 0; i--)
+	{
+		SHV_MEMMAP_RANGE current = Map->Ranges[i - 1];
+
+		if (current.End < range.End)
+		{
+			Map->Ranges[--j].Base = current.End;
+			Map->Ranges[j].End = range.End;
+			Map->Ranges[j].Class = ShvMemoryMmio;
+		}
+
+		Map->Ranges[--j] = current;
+		range.End = current.Base;
+	}
+
+	if (range.End != 0)
+	{
+		Map->Ranges[--j].Base = 0;
+		Map->Ranges[j].End = range.End;
+		Map->Ranges[j].Class = ShvMemoryMmio;
+	}
+
+	NT_ASSERT(j == 0);
+}
+
+NTSTATUS
+ShvMemMapInitialize(
+	_In_ PDRIVER_OBJECT DriverObject
+)
+{
+	PSHV_MEMMAP map;
+	NTSTATUS ret;
+
+	ExInitializeFastMutex(&ShvMemMapLock);
+
+	ret = ShvMemMapBuild(&map);
+	if (ret != STATUS_SUCCESS)
+	{
+		return ret;
+	}
+
+	ShvMemMap = map;
+
+	//
+	// Find out about memory being hot-added.  Without that, the index
+	// still works, it just never learns about the new RAM, which is then
+	// mapped on demand as if it were MMIO.
+	//
+	ret = IoRegisterPlugPlayNotification(EventCategoryDeviceInterfaceChange,
+		0,
+		(PVOID)&ShvMemMapDeviceMemory,
+		DriverObject,
+		ShvMemMapNotify,
+		NULL,
+		&ShvMemMapNotification);
+	if (ret != STATUS_SUCCESS)
+	{
+		SHV_DEBUG_PRINT("Memory hot-add notification failed: %x\n", ret);
+		ShvMemMapNotification = NULL;
+	}
+
+	return STATUS_SUCCESS;
+}
+
+VOID
+ShvMemMapCleanup(
+	VOID
+)
+{
+	//
+	// This waits for a refresh in progress to finish.
+	//
+	if (ShvMemMapNotification != NULL)
+	{
+		IoUnregisterPlugPlayNotificationEx(ShvMemMapNotification);
+		ShvMemMapNotification = NULL;
+	}
+
+	if (ShvMemMap != NULL)
+	{
+		ExFreePoolWithTag(ShvMemMap, SHV_MEMMAP_TAG);
+		ShvMemMap = NULL;
+	}
+}
+
+NTSTATUS
+ShvMemMapRefresh(
+	VOID
+)
+{
+	SHV_MEMORY_CLASS oldClass;
+	PSHV_MEMMAP map, old;
+	ULONG64 address, end;
+	NTSTATUS ret;
+
+	ExAcquireFastMutex(&ShvMemMapLock);
+
+	ret = ShvMemMapBuild(&map);
+	if (ret != STATUS_SUCCESS)
+	{
+		ExReleaseFastMutex(&ShvMemMapLock);
+		return ret;
+	}
+
+	old = (PSHV_MEMMAP)InterlockedExchangePointer((PVOID volatile *)&ShvMemMap, map);
+	NT_ASSERT(old != NULL);
+
+	//
+	// Map the RAM that wasn't RAM before in bulk, rather than leaving it to
+	// fault in a region at a time.  Mapping skips whatever was already
+	// mapped on demand in the meantime.
+	//
+	for (ULONG i = 0; i < map->Count; i++)
+	{
+		if (map->Ranges[i].Class != ShvMemoryRam)
+		{
+			continue;
+		}
+
+		for (address = map->Ranges[i].Base; address < map->Ranges[i].End; address = end)
+		{
+			oldClass = ShvMemMapFind(old, address, &end);
+			end = min(end, map->Ranges[i].End);
+
+			if (oldClass == ShvMemoryRam)
+			{
+				continue;
+			}
+
+			SHV_DEBUG_PRINT("Hot-added RAM %llx-%llx\n", address, end);
+
+			ret = ShvVmxEptMapIdentityRange(address, end);
+			if (ret != STATUS_SUCCESS)
+			{
+				SHV_DEBUG_PRINT("Hot-added RAM could not be mapped: %x\n", ret);
+			}
+		}
+	}
+
+	//
+	// Root mode runs with interrupts off, so once every LP took the IPI,
+	// none of them can still be looking at the old index.
+	//
+	KeIpiGenericCall(ShvUtilIpiBarrier, 0);
+	ExFreePoolWithTag(old, SHV_MEMMAP_TAG);
+
+	ExReleaseFastMutex(&ShvMemMapLock);
+
+	return STATUS_SUCCESS;
+}
+
+SHV_MEMORY_CLASS
+ShvMemMapLookup(
+	_In_ ULONG64 Address,
+	_Out_ PULONG64 End
+)
+{
+	PSHV_MEMMAP map;
+
+	//
+	// Without an index, claim nothing is RAM.
+	//
+	map = ShvMemMap;
+	if (map == NULL)
+	{
+		*End = MAXULONG64;
+		return ShvMemoryMmio;
+	}
+
+	return ShvMemMapFind(map, Address, End);
+}
+
+ULONG64
+ShvMemMapGetTopOfRam(
+	VOID
+)
+{
+	PSHV_MEMMAP map;
+
+	map = ShvMemMap;
+
+	return (map != NULL) ? map->TopOfRam : 0;
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+static NTSTATUS
+ShvMemMapBuild(
+	_Out_ PSHV_MEMMAP *Map
+)
+{
+	PPHYSICAL_MEMORY_RANGE ranges;
+	PSHV_MEMMAP map;
+	ULONG count;
+
+	ranges = MmGetPhysicalMemoryRanges();
+	if (ranges == NULL)
+	{
+		return STATUS_HV_NO_RESOURCES;
+	}
+
+	for (count = 0; ranges[count].BaseAddress.QuadPart != 0 || ranges[count].NumberOfBytes.QuadPart != 0; count++);
+
+	map = (PSHV_MEMMAP)ExAllocatePoolWithTag(NonPagedPoolNx,
+		FIELD_OFFSET(SHV_MEMMAP, Ranges) + SHV_MEMMAP_CAPACITY(count) * sizeof(SHV_MEMMAP_RANGE),
+		SHV_MEMMAP_TAG);
+	if (map == NULL)
+	{
+		ExFreePool(ranges);
+		return STATUS_HV_NO_RESOURCES;
+	}
+
+	ShvMemMapCompile(ranges, count, map);
+
+	ExFreePool(ranges);
+
+	*Map = map;
+
+	return STATUS_SUCCESS;
+}
+
+static SHV_MEMORY_CLASS
+ShvMemMapFind(
+	_In_ const SHV_MEMMAP *Map,
+	_In_ ULONG64 Address,
+	_Out_ PULONG64 End
+)
+{
+	ULONG low, high;
+
+	//
+	// Binary search for the range that contains the address.  The ranges
+	// cover everything, so there always is one.
+	//
+	low = 0;
+	high = Map->Count - 1;
+
+	while (low < high)
+	{
+		ULONG mid = (low + high + 1) / 2;
+
+		if (Map->Ranges[mid].Base <= Address)
+		{
+			low = mid;
+		}
+		else
+		{
+			high = mid - 1;
+		}
+	}
+
+	*End = Map->Ranges[low].End;
+	return Map->Ranges[low].Class;
+}
+
+NTSTATUS
+ShvMemMapNotify(
+	_In_ PVOID NotificationStructure,
+	_Inout_opt_ PVOID Context
+)
+{
+	UNREFERENCED_PARAMETER(NotificationStructure);
+	UNREFERENCED_PARAMETER(Context);
+
+	//
+	// Whether a memory device arrived or left, rebuilding the index picks
+	// up whatever changed.  RAM that went away stays mapped, which is
+	// harmless, since the guest no longer uses it.
+	//
+	ShvMemMapRefresh();
+
+	return STATUS_SUCCESS;
+}
@@ -0,0 +1,497 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvmtrr.c
+
+Abstract:
+
+	This module compiles the processor's MTRRs into a sorted map of memory
+	type ranges for use by the EPT builder.
+
+Author:
+
+	agent (@agent) 15-Oct-2026 - Initial version
+
+Environment:
+
+	Kernel mode only.
+
+--*/
+
+#include "shv.h"
+
+// ===========================================================================
+//
+// LOCAL DATA
+//
+// ===========================================================================
+
+static SHV_MTRR_MAP ShvMtrrMap = { 0 };
+
+// ===========================================================================
+//
+// LOCAL PROTOTYPES
+//
+// ===========================================================================
+
+static UCHAR
+ShvMtrrGetFixedType(
+	_In_ const SHV_MTRR_STATE *State,
+	_In_ ULONG64 Address
+);
+
+static UCHAR
+ShvMtrrGetTypeAt(
+	_In_ const SHV_MTRR_STATE *State,
+	_In_ ULONG64 Address
+);
+
+static ULONG
+ShvMtrrAddBoundary(
+	_Inout_ PULONG64 Bounds,
+	_In_ ULONG Count,
+	_In_ ULONG64 Address
+);
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+VOID
+ShvMtrrCapture(
+	_Out_ PSHV_MTRR_STATE State
+)
+{
+	INT cpu_info[4];
+	ULONG64 cap, msr;
+
+	__stosb((PUCHAR)State, 0, sizeof(*State));
+
+	//
+	// The MTRR masks are only meaningful up to the processor's physical
+	// address width.  Assume 36 bits if the processor doesn't report it.
+	//
+	State->PhysicalAddressBits = 36;
+
+	__cpuid(cpu_info, 0x80000000);
+	if ((ULONG)cpu_info[0] >= 0x80000008)
+	{
+		__cpuid(cpu_info, 0x80000008);
+		State->PhysicalAddressBits = cpu_info[0] & 0xff;
+	}
+
+	cap = __readmsr(MSR_IA32_MTRRCAP);
+
+	State->DefType = __readmsr(MSR_IA32_MTRR_DEF_TYPE);
+	State->FixedSupported = (cap & MTRR_CAP_FIXED) ? TRUE : FALSE;
+	State->VariableCount = (ULONG)min(cap & MTRR_CAP_VCNT_MASK, SHV_MTRR_MAX_VARIABLE);
+
+	//
+	// Each fixed-range MTRR packs the types of eight consecutive ranges, one
+	// per byte.
+	//
+	if (State->FixedSupported)
+	{
+		for (ULONG i = 0; i < MTRR_FIXED_RANGE_COUNT / 8; i++)
+		{
+			ULONG index;
+
+			if (i == 0)
+			{
+				index = MSR_IA32_MTRR_FIX64K_00000;
+			}
+			else if (i < 3)
+			{
+				index = MSR_IA32_MTRR_FIX16K_80000 + i - 1;
+			}
+			else
+			{
+				index = MSR_IA32_MTRR_FIX4K_C0000 + i - 3;
+			}
+
+			msr = __readmsr(index);
+
+			for (ULONG b = 0; b < 8; b++)
+			{
+				State->Fixed[i * 8 + b] = (UCHAR)(msr >> (b * 8));
+			}
+		}
+	}
+
+	for (ULONG i = 0; i < State->VariableCount; i++)
+	{
+		State->Variable[i].PhysBase = __readmsr(MSR_IA32_MTRR_PHYSBASE0 + i * 2);
+		State->Variable[i].PhysMask = __readmsr(MSR_IA32_MTRR_PHYSMASK0 + i * 2);
+	}
+}
+
+NTSTATUS
+ShvMtrrCompile(
+	_In_ const SHV_MTRR_STATE *State,
+	_Out_ PSHV_MTRR_MAP Map
+)
+{
+	ULONG64 bounds[SHV_MTRR_MAX_RANGES + 1];
+	ULONG64 limit, physMask;
+	ULONG count;
+
+	//
+	// This function only depends on the state passed to it, so that it can
+	// be exercised against synthetic MTRR sets.
+	//
+	if (State->PhysicalAddressBits < 32 || State->PhysicalAddressBits > 52 ||
+		State->VariableCount > SHV_MTRR_MAX_VARIABLE)
+	{
+		return STATUS_INVALID_PARAMETER;
+	}
+
+	limit = 1ULL << State->PhysicalAddressBits;
+	physMask = limit - 1;
+
+	//
+	// Collect every address at which the memory type may change.  The map
+	// always covers [0, limit).
+	//
+	count = 0;
+	count = ShvMtrrAddBoundary(bounds, count, 0);
+	count = ShvMtrrAddBoundary(bounds, count, limit);
+
+	if (State->DefType & MTRR_DEF_ENABLE)
+	{
+		if (State->FixedSupported && (State->DefType & MTRR_DEF_FIXED_ENABLE))
+		{
+			for (ULONG64 address = 0; address < MTRR_FIXED_RANGE_END;)
+			{
+				count = ShvMtrrAddBoundary(bounds, count, address);
+
+				if (address < 0x80000)
+				{
+					address += 0x10000;
+				}
+				else if (address < 0xc0000)
+				{
+					address += 0x4000;
+				}
+				else
+				{
+					address += 0x1000;
+				}
+			}
+
+			count = ShvMtrrAddBoundary(bounds, count, MTRR_FIXED_RANGE_END);
+		}
+
+		for (ULONG i = 0; i < State->VariableCount; i++)
+		{
+			ULONG64 base, mask, end;
+
+			if ((State->Variable[i].PhysMask & MTRR_PHYSMASK_VALID) == 0)
+			{
+				continue;
+			}
+
+			//
+			// Variable ranges are expected to use contiguous masks, which
+			// makes them a naturally aligned power-of-two sized range.
+			//
+			base = State->Variable[i].PhysBase & physMask & ~(PAGE_SIZE - 1);
+			mask = State->Variable[i].PhysMask & physMask & ~(PAGE_SIZE - 1);
+			end = base + ((~mask & physMask) + 1);
+
+			count = ShvMtrrAddBoundary(bounds, count, base);
+			count = ShvMtrrAddBoundary(bounds, count, min(end, limit));
+		}
+	}
+
+	//
+	// Type each interval between two boundaries, merging it into the
+	// previous range if they have the same type.
+	//
+	Map->Count = 0;
+
+	for (ULONG i = 0; i + 1 < count; i++)
+	{
+		UCHAR type;
+
+		type = ShvMtrrGetTypeAt(State, bounds[i]);
+
+		if (Map->Count != 0 && Map->Ranges[Map->Count - 1].Type == type)
+		{
+			Map->Ranges[Map->Count - 1].End = bounds[i + 1];
+			continue;
+		}
+
+		Map->Ranges[Map->Count].Base = bounds[i];
+		Map->Ranges[Map->Count].End = bounds[i + 1];
+		Map->Ranges[Map->Count].Type = type;
+		Map->Count++;
+	}
+
+	//
+	// Report the largest page that fits inside of each range.
+	//
+	for (ULONG i = 0; i < Map->Count; i++)
+	{
+		PSHV_MTRR_RANGE range = &Map->Ranges[i];
+
+		range->PageSize = PAGE_SIZE;
+
+		for (ULONG64 size = VMX_EPT_PAGE_SIZE_1GB; size > PAGE_SIZE; size >>= 9)
+		{
+			ULONG64 first;
+
+			first = (range->Base + size - 1) & ~(size - 1);
+			if (first + size <= range->End)
+			{
+				range->PageSize = size;
+				break;
+			}
+		}
+	}
+
+	return STATUS_SUCCESS;
+}
+
+NTSTATUS
+ShvMtrrInitialize(
+	VOID
+)
+{
+	SHV_MTRR_STATE state;
+	NTSTATUS ret;
+
+	//
+	// The MTRRs are required to be identical on every processor, so it is
+	// enough to read them on the current one.
+	//
+	ShvMtrrCapture(&state);
+
+	ret = ShvMtrrCompile(&state, &ShvMtrrMap);
+	if (ret != STATUS_SUCCESS)
+	{
+		ShvMtrrMap.Count = 0;
+		return ret;
+	}
+
+	for (ULONG i = 0; i < ShvMtrrMap.Count; i++)
+	{
+		SHV_DEBUG_PRINT("MTRR: %016llx-%016llx type %u page %llx\n",
+			ShvMtrrMap.Ranges[i].Base,
+			ShvMtrrMap.Ranges[i].End,
+			ShvMtrrMap.Ranges[i].Type,
+			ShvMtrrMap.Ranges[i].PageSize
+		);
+	}
+
+	return STATUS_SUCCESS;
+}
+
+UCHAR
+ShvMtrrLookup(
+	_In_ ULONG64 Address,
+	_Out_ PULONG64 End
+)
+{
+	ULONG low, high;
+
+	//
+	// Without a map, fall back to what we used before MTRRs were honored.
+	//
+	if (ShvMtrrMap.Count == 0)
+	{
+		*End = MAXULONG64;
+		return WriteBack;
+	}
+
+	//
+	// Binary search for the range that contains the address.
+	//
+	low = 0;
+	high = ShvMtrrMap.Count - 1;
+
+	while (low < high)
+	{
+		ULONG mid = (low + high + 1) / 2;
+
+		if (ShvMtrrMap.Ranges[mid].Base <= Address)
+		{
+			low = mid;
+		}
+		else
+		{
+			high = mid - 1;
+		}
+	}
+
+	*End = ShvMtrrMap.Ranges[low].End;
+	return ShvMtrrMap.Ranges[low].Type;
+}
+
+BOOLEAN
+ShvMtrrGetMemoryType(
+	_In_ ULONG64 Base,
+	_In_ ULONG64 Size,
+	_Out_ PUCHAR Type
+)
+{
+	ULONG64 end;
+
+	*Type = ShvMtrrLookup(Base, &end);
+
+	//
+	// Tell the caller whether the whole region has that single type.
+	//
+	return (Base + Size <= end) ? TRUE : FALSE;
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+static UCHAR
+ShvMtrrGetFixedType(
+	_In_ const SHV_MTRR_STATE *State,
+	_In_ ULONG64 Address
+)
+{
+	ULONG index;
+
+	//
+	// 8 x 64 KiB ranges from 0, 16 x 16 KiB ranges from 512 KiB and
+	// 64 x 4 KiB ranges from 768 KiB.
+	//
+	if (Address < 0x80000)
+	{
+		index = (ULONG)(Address >> 16);
+	}
+	else if (Address < 0xc0000)
+	{
+		index = 8 + (ULONG)((Address - 0x80000) >> 14);
+	}
+	else
+	{
+		index = 24 + (ULONG)((Address - 0xc0000) >> 12);
+	}
+
+	return State->Fixed[index];
+}
+
+static UCHAR
+ShvMtrrGetTypeAt(
+	_In_ const SHV_MTRR_STATE *State,
+	_In_ ULONG64 Address
+)
+{
+	ULONG64 physMask;
+	UCHAR type;
+	BOOLEAN matched;
+
+	//
+	// When the MTRRs are disabled all of memory is uncacheable.
+	//
+	if ((State->DefType & MTRR_DEF_ENABLE) == 0)
+	{
+		return Uncacheable;
+	}
+
+	if (Address < MTRR_FIXED_RANGE_END &&
+		State->FixedSupported &&
+		(State->DefType & MTRR_DEF_FIXED_ENABLE))
+	{
+		return ShvMtrrGetFixedType(State, Address);
+	}
+
+	physMask = (1ULL << State->PhysicalAddressBits) - 1;
+	type = Uncacheable;
+	matched = FALSE;
+
+	for (ULONG i = 0; i < State->VariableCount; i++)
+	{
+		ULONG64 base, mask;
+		UCHAR rangeType;
+
+		if ((State->Variable[i].PhysMask & MTRR_PHYSMASK_VALID) == 0)
+		{
+			continue;
+		}
+
+		base = State->Variable[i].PhysBase & physMask & ~(PAGE_SIZE - 1);
+		mask = State->Variable[i].PhysMask & physMask & ~(PAGE_SIZE - 1);
+
+		if ((Address & mask) != (base & mask))
+		{
+			continue;
+		}
+
+		rangeType = (UCHAR)(State->Variable[i].PhysBase & MTRR_PHYSBASE_TYPE_MASK);
+
+		//
+		// Apply the precedence rules for overlapping variable ranges: UC
+		// wins over everything, and WT wins over WB.  Any other overlap is
+		// undefined, so treat it as UC to be safe.
+		//
+		if (matched == FALSE)
+		{
+			type = rangeType;
+			matched = TRUE;
+		}
+		else if (type == rangeType)
+		{
+			continue;
+		}
+		else if ((type == WriteThrough && rangeType == WriteBack) ||
+			(type == WriteBack && rangeType == WriteThrough))
+		{
+			type = WriteThrough;
+		}
+		else
+		{
+			type = Uncacheable;
+		}
+	}
+
+	if (matched == FALSE)
+	{
+		type = (UCHAR)(State->DefType & MTRR_DEF_TYPE_MASK);
+	}
+
+	return type;
+}
+
+static ULONG
+ShvMtrrAddBoundary(
+	_Inout_ PULONG64 Bounds,
+	_In_ ULONG Count,
+	_In_ ULONG64 Address
+)
+{
+	ULONG i;
+
+	//
+	// Insert the address into the sorted boundary list, ignoring duplicates.
+	//
+	for (i = 0; i < Count && Bounds[i] < Address; i++);
+
+	if (i < Count && Bounds[i] == Address)
+	{
+		return Count;
+	}
+
+	NT_ASSERT(Count < SHV_MTRR_MAX_RANGES + 1);
+
+	for (ULONG j = Count; j > i; j--)
+	{
+		Bounds[j] = Bounds[j - 1];
+	}
+
+	Bounds[i] = Address;
+
+	return Count + 1;
+}
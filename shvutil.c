@@ -24,6 +24,13 @@ Environment:
 
 #include "shv.h"
 
+static VOID
+ShvUtilSwap(
+	_Inout_updates_bytes_(Size) PVOID First,
+	_Inout_updates_bytes_(Size) PVOID Second,
+	_In_ ULONG Size
+);
+
 VOID
 ShvUtilConvertGdtEntry(
 	_In_ PVOID GdtBase,
@@ -100,6 +107,15 @@ PVOID
 ShvUtilAllocateContiguousMemory(
 	_In_ SIZE_T NumberOfBytes
 )
+{
+	return ShvUtilAllocateContiguousNodeMemory(NumberOfBytes, MM_ANY_NODE_OK);
+}
+
+PVOID
+ShvUtilAllocateContiguousNodeMemory(
+	_In_ SIZE_T NumberOfBytes,
+	_In_ ULONG Node
+)
 {
 	PHYSICAL_ADDRESS lowest, highest;
 	//
@@ -131,11 +147,19 @@ ShvUtilAllocateContiguousMemory(
 				highest,
 				lowest,
 				PAGE_READWRITE,
-				MM_ANY_NODE_OK
+				Node
 			);
 		}
 	}
 
+	//
+	// Windows 7 can't place the allocation on a given node, so only
+	// callers that don't care which node it comes from get one.
+	//
+	if (Node != MM_ANY_NODE_OK) {
+		return NULL;
+	}
+
 	//
 	// If we're here then we'll just fall back to using executable
 	// memory.
@@ -150,3 +174,168 @@ ShvUtilAllocateContiguousMemory(
 	);
 }
 
+
+VOID
+ShvUtilSortByKey(
+	_Inout_updates_bytes_(Count * Size) PVOID Elements,
+	_In_ ULONG Count,
+	_In_ ULONG Size
+)
+{
+	PUCHAR elements;
+	ULONG root, child, end;
+
+	NT_ASSERT(Size >= sizeof(ULONG64) && (Size % sizeof(ULONG64)) == 0);
+
+	//
+	// Heap sort the elements by the ULONG64 each of them starts with.
+	// There can be any number of them, and this needs no memory of its
+	// own.
+	//
+	elements = (PUCHAR)Elements;
+
+#define SHV_UTIL_KEY(i) (*(PULONG64)(elements + (SIZE_T)(i) * Size))
+
+	for (ULONG i = Count / 2; i-- > 0; )
+	{
+		for (root = i; (child = 2 * root + 1) < Count; root = child)
+		{
+			if (child + 1 < Count && SHV_UTIL_KEY(child + 1) > SHV_UTIL_KEY(child))
+			{
+				child++;
+			}
+
+			if (SHV_UTIL_KEY(root) >= SHV_UTIL_KEY(child))
+			{
+				break;
+			}
+
+			ShvUtilSwap(elements + (SIZE_T)root * Size, elements + (SIZE_T)child * Size, Size);
+		}
+	}
+
+	for (end = Count; end-- > 1; )
+	{
+		ShvUtilSwap(elements, elements + (SIZE_T)end * Size, Size);
+
+		for (root = 0; (child = 2 * root + 1) < end; root = child)
+		{
+			if (child + 1 < end && SHV_UTIL_KEY(child + 1) > SHV_UTIL_KEY(child))
+			{
+				child++;
+			}
+
+			if (SHV_UTIL_KEY(root) >= SHV_UTIL_KEY(child))
+			{
+				break;
+			}
+
+			ShvUtilSwap(elements + (SIZE_T)root * Size, elements + (SIZE_T)child * Size, Size);
+		}
+	}
+
+#undef SHV_UTIL_KEY
+}
+
+PVOID
+ShvUtilFindByKey(
+	_In_reads_bytes_(Count * Size) const VOID *Elements,
+	_In_ ULONG Count,
+	_In_ ULONG Size,
+	_In_ ULONG64 Key
+)
+{
+	const UCHAR *elements;
+	ULONG low, high, mid;
+
+	//
+	// Binary search elements sorted by ShvUtilSortByKey for the one that
+	// starts with the key.  Root mode uses this, so it must not touch
+	// anything but the elements.
+	//
+	elements = (const UCHAR *)Elements;
+	low = 0;
+	high = Count;
+
+	while (low < high)
+	{
+		mid = (low + high) / 2;
+
+		if (*(const ULONG64 *)(elements + (SIZE_T)mid * Size) < Key)
+		{
+			low = mid + 1;
+		}
+		else
+		{
+			high = mid;
+		}
+	}
+
+	if (low < Count && *(const ULONG64 *)(elements + (SIZE_T)low * Size) == Key)
+	{
+		return (PVOID)(elements + (SIZE_T)low * Size);
+	}
+
+	return NULL;
+}
+
+VOID
+ShvUtilSetMonitorTrap(
+	_In_ BOOLEAN Enable
+)
+{
+	SIZE_T control;
+
+	//
+	// Turn the monitor trap flag of the current VMCS on or off, so that
+	// the guest exits again after its next instruction.
+	//
+	__vmx_vmread(CPU_BASED_VM_EXEC_CONTROL, &control);
+
+	if (Enable)
+	{
+		control |= CPU_BASED_MONITOR_TRAP_FLAG;
+	}
+	else
+	{
+		control &= ~(SIZE_T)CPU_BASED_MONITOR_TRAP_FLAG;
+	}
+
+	__vmx_vmwrite(CPU_BASED_VM_EXEC_CONTROL, control);
+}
+
+ULONG_PTR
+ShvUtilIpiBarrier(
+	_In_ ULONG_PTR Argument
+)
+{
+	UNREFERENCED_PARAMETER(Argument);
+
+	//
+	// Does nothing.  Once an IPI running this returns, every LP has left
+	// whatever it was doing at a higher IRQL, including root mode, so
+	// nothing can still be using data that was unpublished before it.
+	//
+	return 0;
+}
+
+static VOID
+ShvUtilSwap(
+	_Inout_updates_bytes_(Size) PVOID First,
+	_Inout_updates_bytes_(Size) PVOID Second,
+	_In_ ULONG Size
+)
+{
+	PULONG64 first, second;
+	ULONG64 swap;
+
+	first = (PULONG64)First;
+	second = (PULONG64)Second;
+
+	for (ULONG i = 0; i < Size / sizeof(ULONG64); i++)
+	{
+		swap = first[i];
+		first[i] = second[i];
+		second[i] = swap;
+	}
+}
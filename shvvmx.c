@@ -67,6 +67,8 @@ ShvVmxEnterRootModeOnVp(
 	VpData->VmxOnPhysicalAddress = MmGetPhysicalAddress(&VpData->VmxOn).QuadPart;
 	VpData->VmcsPhysicalAddress = MmGetPhysicalAddress(&VpData->Vmcs).QuadPart;
 	VpData->MsrBitmapPhysicalAddress = MmGetPhysicalAddress(ShvGlobalData->MsrBitmap).QuadPart;
+	VpData->PmlPhysicalAddress = MmGetPhysicalAddress(VpData->PmlBuffer).QuadPart;
+	VpData->VePhysicalAddress = MmGetPhysicalAddress(&VpData->VeInformation).QuadPart;
 
 	//
 	// Update CR0 with the must-be-zero and must-be-one requirements
@@ -141,16 +143,25 @@ ShvVmxSetupVmcsForVp(
 	__vmx_vmwrite(VIRTUAL_PROCESSOR_ID, 1);
 
 	//
-	// Set the EPT pointer to point to the EPT tables.
+	// Set the EPT pointer to point to the EPT tables, the EPTP list the
+	// guest can switch views with, and where #VEs are reported, if those
+	// are on.
 	//
-	__vmx_vmwrite(EPT_POINTER, ShvVmxEptEptp.QuadPart);
+	ShvVmxEptSetupVmcs(VpData);
+
+	//
+	// Point the VMCS at the PML log, if page modification logging is on.
+	//
+	ShvVmxPmlSetupVmcs(VpData);
 
 	//
 	// Enable support for RDTSCP and XSAVES/XRESTORES in the guest. Windows 10
 	// makes use of both of these instructions if the CPU supports it. 
-	// Also enable support for VPID and EPT. By using ShvUtilAdjustMsr, these options 
-	// will be ignored if this processor does not actully support the instructions 
-	// to begin with.
+	// Also enable support for VPID and EPT, and PML if it was asked for, as
+	// well as VM functions if EPT views can be switched with them and #VE
+	// delivery if it was asked for. By using
+	// ShvUtilAdjustMsr, these options will be ignored if this processor does not
+	// actully support the instructions to begin with.
 	//
 	__vmx_vmwrite(
 		SECONDARY_VM_EXEC_CONTROL,
@@ -159,17 +170,25 @@ ShvVmxSetupVmcsForVp(
 			SECONDARY_EXEC_ENABLE_RDTSCP |
 			SECONDARY_EXEC_XSAVES |
 			SECONDARY_EXEC_ENABLE_VPID |
-			SECONDARY_EXEC_ENABLE_EPT
+			SECONDARY_EXEC_ENABLE_EPT |
+			(ShvVmxPmlEnabled ? SECONDARY_EXEC_ENABLE_PML : 0) |
+			(ShvVmxEptVmfuncEnabled ? SECONDARY_EXEC_ENABLE_VM_FUNCTIONS : 0) |
+			(ShvVmxEptVeEnabled ? SECONDARY_EXEC_ENABLE_VIRT_EXCEPTIONS : 0)
 		)
 	);
 
 	//
-	// Enable no pin-based options ourselves, but there may be some required by
-	// the processor. Use ShvUtilAdjustMsr to add those in.
+	// Enable no pin-based options ourselves, other than NMI exiting when root
+	// mode has to make other VPs flush, but there may be some required by
+	// the processor. Use ShvUtilAdjustMsr to add those in. Virtual NMIs go
+	// along with NMI exiting, so that the guest's own NMIs can be handed back
+	// to it without losing track of whether it is still handling one.
 	//
 	__vmx_vmwrite(
 		PIN_BASED_VM_EXEC_CONTROL,
-		ShvUtilAdjustMsr(VpData->MsrData[13], 0)
+		ShvUtilAdjustMsr(VpData->MsrData[13],
+			ShvVmxEptNmiExiting ?
+				(PIN_BASED_NMI_EXITING | PIN_BASED_VIRTUAL_NMIS) : 0)
 	);
 
 	//
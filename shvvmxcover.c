@@ -0,0 +1,661 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvvmxcover.c
+
+Abstract:
+
+	This module implements the code coverage collector.  Every 4 KiB page
+	of the regions being covered loses its execute access in the default
+	view at the start of an epoch.  The first execution of a page faults
+	once, is recorded in a bitmap, and gets its execute access back in the
+	same exit, so each page costs at most one exit per epoch, and starting
+	an epoch costs a single shootdown however many pages it re-arms.  Pages
+	that another subsystem protects or remaps are left to it, and are not
+	recorded.
+
+Author:
+
+	agent (@agent) 15-Oct-2026 - Initial version
+
+Environment:
+
+	Kernel mode only.
+
+--*/
+
+#include "shv.h"
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// Set to TRUE to support code coverage.  This costs a violation handler,
+// and nothing else until coverage starts.
+//
+#define SHV_COVER_ENABLE FALSE
+
+#define SHV_COVER_TAG 'VOCS'
+
+// ===========================================================================
+//
+// LOCAL TYPES
+//
+// ===========================================================================
+
+//
+// The regions being covered, sorted by GPA, the bit of the first page of
+// each, and the bitmap of the pages the collector armed, which are the
+// only ones whose violations it claims.  Root mode reads it without a
+// lock, so it is only freed once no LP can be looking at it.
+//
+typedef struct _SHV_COVER_TABLE
+{
+	ULONG Count;
+	ULONG64 PageCount;
+	ULONG64 Armed;
+	PULONG64 FirstPages;
+	volatile ULONG64 *Owned;
+	SHV_EPT_REGION Regions[ANYSIZE_ARRAY];
+} SHV_COVER_TABLE, *PSHV_COVER_TABLE;
+
+// ===========================================================================
+//
+// LOCAL DATA
+//
+// ===========================================================================
+
+static BOOLEAN ShvVmxCoverRequested = SHV_COVER_ENABLE;
+static BOOLEAN ShvVmxCoverEnabled = FALSE;
+
+//
+// Serializes starting, stopping, epochs and exports.
+//
+static FAST_MUTEX ShvVmxCoverLock = { 0 };
+
+static PSHV_COVER_TABLE volatile ShvVmxCoverTable = NULL;
+
+//
+// The bitmap of the current epoch, which root mode sets bits in, and the
+// one of the last completed epoch, which is what gets exported.
+//
+static PULONG64 volatile ShvVmxCoverBitmap = NULL;
+static PULONG64 ShvVmxCoverCompleted = NULL;
+
+static ULONG64 ShvVmxCoverEpoch = 0;
+static volatile LONG64 ShvVmxCoverFaults = 0;
+static volatile LONG64 ShvVmxCoverCoarse = 0;
+
+// ===========================================================================
+//
+// LOCAL PROTOTYPES
+//
+// ===========================================================================
+
+static ULONG64
+ShvVmxCoverFindChange(
+	const ULONG64 *bitmap,
+	ULONG64 page,
+	ULONG64 pageCount,
+	BOOLEAN executed
+);
+
+static VOID
+ShvVmxCoverEmit(
+	PUCHAR buffer,
+	ULONG length,
+	PULONG offset,
+	ULONG64 value
+);
+
+static VOID
+ShvVmxCoverFree(
+	VOID
+);
+
+SHV_EPT_VIOLATION_HANDLER ShvVmxCoverHandleViolation;
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+NTSTATUS
+ShvVmxCoverInitialize(
+	VOID
+)
+{
+	NTSTATUS ret;
+
+	if (ShvVmxCoverRequested == FALSE)
+	{
+		return STATUS_SUCCESS;
+	}
+
+	ExInitializeFastMutex(&ShvVmxCoverLock);
+
+	ret = ShvVmxEptRegisterViolationHandler(ShvVmxCoverHandleViolation);
+	if (ret != STATUS_SUCCESS)
+	{
+		return ret;
+	}
+
+	ShvVmxCoverEnabled = TRUE;
+
+	return STATUS_SUCCESS;
+}
+
+VOID
+ShvVmxCoverCleanup(
+	VOID
+)
+{
+	NTSTATUS ret;
+
+	if (ShvVmxCoverEnabled == FALSE)
+	{
+		return;
+	}
+
+	ret = ShvVmxCoverStop();
+	if (ret != STATUS_SUCCESS)
+	{
+		SHV_DEBUG_PRINT("Coverage did not stop: %x\n", ret);
+	}
+
+	//
+	// This waits for every LP to be done with the table.  Pages that are
+	// still without execute access are unclaimed from now on, so the EPT
+	// code gives them their access back as they are executed.
+	//
+	ShvVmxEptUnregisterViolationHandler(ShvVmxCoverHandleViolation);
+	ShvVmxCoverEnabled = FALSE;
+
+	ShvVmxCoverFree();
+}
+
+NTSTATUS
+ShvVmxCoverStart(
+	_In_reads_(Count) const SHV_EPT_REGION *Regions,
+	_In_ ULONG Count
+)
+{
+	PSHV_COVER_TABLE table;
+	PULONG64 bitmaps;
+	ULONG64 pageCount, words, restored;
+	NTSTATUS ret;
+
+	if (ShvVmxCoverEnabled == FALSE)
+	{
+		return STATUS_HV_NOT_PRESENT;
+	}
+
+	//
+	// The regions have to be whole pages, sorted by GPA, and not overlap.
+	//
+	if (Count == 0)
+	{
+		return STATUS_INVALID_PARAMETER;
+	}
+
+	pageCount = 0;
+
+	for (ULONG i = 0; i < Count; i++)
+	{
+		if ((Regions[i].Base & (PAGE_SIZE - 1)) != 0 ||
+			(Regions[i].Size & (PAGE_SIZE - 1)) != 0 ||
+			Regions[i].Size == 0 ||
+			(i != 0 && Regions[i].Base < Regions[i - 1].Base + Regions[i - 1].Size))
+		{
+			return STATUS_INVALID_PARAMETER;
+		}
+
+		pageCount += Regions[i].Size / PAGE_SIZE;
+	}
+
+	words = (pageCount + 63) / 64;
+
+	table = (PSHV_COVER_TABLE)ExAllocatePoolWithTag(NonPagedPoolNx,
+		FIELD_OFFSET(SHV_COVER_TABLE, Regions[Count]) + (Count + words) * sizeof(ULONG64),
+		SHV_COVER_TAG);
+	if (table == NULL)
+	{
+		return STATUS_HV_NO_RESOURCES;
+	}
+
+	bitmaps = (PULONG64)ExAllocatePoolWithTag(NonPagedPoolNx, 2 * words * sizeof(ULONG64), SHV_COVER_TAG);
+	if (bitmaps == NULL)
+	{
+		ExFreePoolWithTag(table, SHV_COVER_TAG);
+		return STATUS_HV_NO_RESOURCES;
+	}
+
+	__stosq(bitmaps, 0, 2 * words);
+
+	table->Count = Count;
+	table->PageCount = pageCount;
+	table->Armed = 0;
+	table->FirstPages = (PULONG64)&table->Regions[Count];
+	table->Owned = table->FirstPages + Count;
+
+	__stosq((PULONG64)table->Owned, 0, words);
+
+	pageCount = 0;
+
+	for (ULONG i = 0; i < Count; i++)
+	{
+		table->Regions[i] = Regions[i];
+		table->FirstPages[i] = pageCount;
+		pageCount += Regions[i].Size / PAGE_SIZE;
+	}
+
+	ExAcquireFastMutex(&ShvVmxCoverLock);
+
+	if (ShvVmxCoverTable != NULL)
+	{
+		ExReleaseFastMutex(&ShvVmxCoverLock);
+		ExFreePoolWithTag(bitmaps, SHV_COVER_TAG);
+		ExFreePoolWithTag(table, SHV_COVER_TAG);
+		return STATUS_DEVICE_BUSY;
+	}
+
+	//
+	// The first bitmap is the current one, the second one is only ever
+	// exported once an epoch completed into it.
+	//
+	ShvVmxCoverBitmap = bitmaps;
+	ShvVmxCoverCompleted = bitmaps + words;
+	ShvVmxCoverEpoch = 0;
+	InterlockedExchangePointer((PVOID volatile *)&ShvVmxCoverTable, table);
+
+	//
+	// Arm every page nobody else protected or remapped.  Whatever was
+	// armed before a failure gets its execute access back.
+	//
+	ret = ShvVmxEptProtectOwnedPages(table->Regions,
+		Count,
+		VMX_EPT_ACCESS_EXECUTE,
+		0,
+		table->Owned,
+		&table->Armed);
+	if (ret != STATUS_SUCCESS)
+	{
+		ShvVmxEptProtectOwnedPages(table->Regions, Count, 0, VMX_EPT_ACCESS_EXECUTE, table->Owned, &restored);
+		ShvVmxCoverFree();
+	}
+
+	ExReleaseFastMutex(&ShvVmxCoverLock);
+
+	return ret;
+}
+
+NTSTATUS
+ShvVmxCoverStop(
+	VOID
+)
+{
+	PSHV_COVER_TABLE table;
+	ULONG64 restored;
+	NTSTATUS ret;
+
+	if (ShvVmxCoverEnabled == FALSE)
+	{
+		return STATUS_HV_NOT_PRESENT;
+	}
+
+	ExAcquireFastMutex(&ShvVmxCoverLock);
+
+	table = ShvVmxCoverTable;
+	if (table == NULL)
+	{
+		ExReleaseFastMutex(&ShvVmxCoverLock);
+		return STATUS_SUCCESS;
+	}
+
+	//
+	// Give every page that is still armed its execute access back, which
+	// collapses the pages again.  Until that is done, faults are still
+	// recorded.
+	//
+	ret = ShvVmxEptProtectOwnedPages(table->Regions,
+		table->Count,
+		0,
+		VMX_EPT_ACCESS_EXECUTE,
+		table->Owned,
+		&restored);
+	if (ret == STATUS_SUCCESS)
+	{
+		ShvVmxCoverFree();
+	}
+
+	ExReleaseFastMutex(&ShvVmxCoverLock);
+
+	return ret;
+}
+
+NTSTATUS
+ShvVmxCoverStartEpoch(
+	VOID
+)
+{
+	PSHV_COVER_TABLE table;
+	PULONG64 bitmap;
+	NTSTATUS ret;
+
+	if (ShvVmxCoverEnabled == FALSE)
+	{
+		return STATUS_HV_NOT_PRESENT;
+	}
+
+	ExAcquireFastMutex(&ShvVmxCoverLock);
+
+	table = ShvVmxCoverTable;
+	if (table == NULL)
+	{
+		ExReleaseFastMutex(&ShvVmxCoverLock);
+		return STATUS_INVALID_DEVICE_STATE;
+	}
+
+	//
+	// Move root mode to a cleared bitmap, and wait for every LP to be done
+	// with the old one, which completes the epoch.
+	//
+	bitmap = ShvVmxCoverCompleted;
+	__stosq(bitmap, 0, (table->PageCount + 63) / 64);
+
+	ShvVmxCoverCompleted = InterlockedExchangePointer((PVOID volatile *)&ShvVmxCoverBitmap, bitmap);
+
+	KeIpiGenericCall(ShvUtilIpiBarrier, 0);
+
+	ShvVmxCoverEpoch++;
+
+	//
+	// Then take the execute access of every page away again, under a
+	// single shootdown.  A page executed in the meantime is recorded in the
+	// new epoch and armed again, so it just faults once more.  Pages that
+	// someone else protected or remapped since are given up, and ones they
+	// gave back are armed again.
+	//
+	ret = ShvVmxEptProtectOwnedPages(table->Regions,
+		table->Count,
+		VMX_EPT_ACCESS_EXECUTE,
+		0,
+		table->Owned,
+		&table->Armed);
+
+	ExReleaseFastMutex(&ShvVmxCoverLock);
+
+	return ret;
+}
+
+NTSTATUS
+ShvVmxCoverExport(
+	_Out_writes_bytes_to_(Length, *ReturnLength) PUCHAR Buffer,
+	_In_ ULONG Length,
+	_Out_ PULONG ReturnLength
+)
+{
+	PSHV_COVER_TABLE table;
+	ULONG64 page, next;
+	BOOLEAN executed;
+	ULONG offset;
+
+	*ReturnLength = 0;
+
+	if (ShvVmxCoverEnabled == FALSE)
+	{
+		return STATUS_HV_NOT_PRESENT;
+	}
+
+	ExAcquireFastMutex(&ShvVmxCoverLock);
+
+	table = ShvVmxCoverTable;
+	if (table == NULL || ShvVmxCoverEpoch == 0)
+	{
+		ExReleaseFastMutex(&ShvVmxCoverLock);
+		return STATUS_INVALID_DEVICE_STATE;
+	}
+
+	//
+	// The pages of the last completed epoch, in the order of the regions,
+	// as runs of pages that alternately were not and were executed,
+	// starting with ones that were not.  Each run length is an unsigned
+	// LEB128 number, and only the first one can be zero.  If the buffer is
+	// too small, ReturnLength still says how large it has to be.
+	//
+	offset = 0;
+	executed = FALSE;
+
+	for (page = 0; page < table->PageCount; page = next)
+	{
+		next = ShvVmxCoverFindChange(ShvVmxCoverCompleted, page, table->PageCount, executed);
+
+		ShvVmxCoverEmit(Buffer, Length, &offset, next - page);
+		executed = !executed;
+	}
+
+	ExReleaseFastMutex(&ShvVmxCoverLock);
+
+	*ReturnLength = offset;
+
+	return (offset <= Length) ? STATUS_SUCCESS : STATUS_BUFFER_TOO_SMALL;
+}
+
+VOID
+ShvVmxCoverQuery(
+	_Out_ PSHV_COVER_STATISTICS Statistics
+)
+{
+	PSHV_COVER_TABLE table;
+
+	__stosb((PUCHAR)Statistics, 0, sizeof(*Statistics));
+
+	if (ShvVmxCoverEnabled == FALSE)
+	{
+		return;
+	}
+
+	ExAcquireFastMutex(&ShvVmxCoverLock);
+
+	table = ShvVmxCoverTable;
+	if (table != NULL)
+	{
+		Statistics->Epoch = ShvVmxCoverEpoch;
+		Statistics->Pages = table->PageCount;
+		Statistics->Armed = table->Armed;
+
+		for (ULONG64 i = 0; i < (table->PageCount + 63) / 64; i++)
+		{
+			Statistics->Executed += __popcnt64(ShvVmxCoverBitmap[i]);
+		}
+	}
+
+	Statistics->Faults = (ULONG64)ShvVmxCoverFaults;
+	Statistics->Coarse = (ULONG64)ShvVmxCoverCoarse;
+
+	ExReleaseFastMutex(&ShvVmxCoverLock);
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+BOOLEAN
+ShvVmxCoverHandleViolation(
+	_In_ PSHV_VP_STATE VpState,
+	_In_ ULONG64 Gpa,
+	_In_ ULONG Access
+)
+{
+	PSHV_COVER_TABLE table;
+	ULONG64 page;
+	ULONG low, high, middle;
+
+	UNREFERENCED_PARAMETER(VpState);
+
+	table = ShvVmxCoverTable;
+	if (table == NULL || (Access & VMX_EPT_ACCESS_EXECUTE) == 0)
+	{
+		return FALSE;
+	}
+
+	//
+	// Find the region the page is in.
+	//
+	low = 0;
+	high = table->Count;
+
+	while (low < high)
+	{
+		middle = low + (high - low) / 2;
+
+		if (Gpa < table->Regions[middle].Base)
+		{
+			high = middle;
+		}
+		else if (Gpa >= table->Regions[middle].Base + table->Regions[middle].Size)
+		{
+			low = middle + 1;
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	if (low >= high)
+	{
+		return FALSE;
+	}
+
+	//
+	// Only pages the collector armed are its own.  Record the page, and
+	// let it be executed until the next epoch.  A VP that still has the old
+	// translation cached takes a violation of its own, which the EPT code
+	// deals with by itself.
+	//
+	page = table->FirstPages[middle] + ((Gpa - table->Regions[middle].Base) >> PAGE_SHIFT);
+
+	if ((table->Owned[page / 64] & (1ULL << (page % 64))) == 0)
+	{
+		return FALSE;
+	}
+
+	InterlockedBitTestAndSet64((volatile LONG64 *)&ShvVmxCoverBitmap[page / 64], page % 64);
+	InterlockedIncrement64(&ShvVmxCoverFaults);
+
+	if (ShvVmxEptGrantAccess(Gpa & ~(ULONG64)(PAGE_SIZE - 1), VMX_EPT_ACCESS_EXECUTE) > PAGE_SIZE)
+	{
+		InterlockedIncrement64(&ShvVmxCoverCoarse);
+	}
+
+	return TRUE;
+}
+
+static ULONG64
+ShvVmxCoverFindChange(
+	const ULONG64 *bitmap,
+	ULONG64 page,
+	ULONG64 pageCount,
+	BOOLEAN executed
+)
+{
+	ULONG64 bits, flip;
+	ULONG64 word;
+	ULONG index;
+
+	//
+	// Find the first page from the given one on that was executed, or
+	// wasn't, whichever is the opposite of what the given one was.
+	//
+	flip = executed ? MAXULONG64 : 0;
+	word = page / 64;
+	bits = (bitmap[word] ^ flip) & (MAXULONG64 << (page % 64));
+
+	while (bits == 0)
+	{
+		word++;
+		if (word * 64 >= pageCount)
+		{
+			return pageCount;
+		}
+
+		bits = bitmap[word] ^ flip;
+	}
+
+	_BitScanForward64(&index, bits);
+
+	return min(word * 64 + index, pageCount);
+}
+
+static VOID
+ShvVmxCoverEmit(
+	PUCHAR buffer,
+	ULONG length,
+	PULONG offset,
+	ULONG64 value
+)
+{
+	UCHAR byte;
+
+	//
+	// Seven bits at a time, lowest first, with the top bit set on all but
+	// the last byte.  Bytes past the end of the buffer are only counted.
+	//
+	do
+	{
+		byte = (UCHAR)(value & 0x7f);
+		value >>= 7;
+
+		if (value != 0)
+		{
+			byte |= 0x80;
+		}
+
+		if (*offset < length)
+		{
+			buffer[*offset] = byte;
+		}
+
+		(*offset)++;
+	} while (value != 0);
+}
+
+static VOID
+ShvVmxCoverFree(
+	VOID
+)
+{
+	PSHV_COVER_TABLE table;
+	PULONG64 bitmaps;
+
+	table = InterlockedExchangePointer((PVOID volatile *)&ShvVmxCoverTable, NULL);
+	if (table == NULL)
+	{
+		return;
+	}
+
+	//
+	// Wait for every LP to be done with the table and the bitmaps.  They
+	// were allocated together, so the lower of the two bitmaps is the
+	// allocation.
+	//
+	KeIpiGenericCall(ShvUtilIpiBarrier, 0);
+
+	bitmaps = min(ShvVmxCoverBitmap, ShvVmxCoverCompleted);
+
+	ShvVmxCoverBitmap = NULL;
+	ShvVmxCoverCompleted = NULL;
+
+	ExFreePoolWithTag(bitmaps, SHV_COVER_TAG);
+	ExFreePoolWithTag(table, SHV_COVER_TAG);
+}
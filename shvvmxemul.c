@@ -0,0 +1,1303 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvvmxemul.c
+
+Abstract:
+
+	This module implements the store emulator.  It decodes the common x64
+	instructions that write memory with a small opcode table, and carries
+	out the write that caused an EPT violation from root mode, so that a
+	write-protected page doesn't have to be opened up and the instruction
+	single stepped.
+
+Author:
+
+	agent (@agent) 15-Oct-2026 - Initial version
+
+Environment:
+
+	Kernel mode only.
+
+--*/
+
+#include "shv.h"
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// How an opcode is encoded: whether a ModRM byte follows, how big its
+// immediate is, how its operand size is picked, and whether it can have
+// a 66, F2 or F3 prefix at all.
+//
+#define SHV_EMUL_OPCODE_MODRM           0x01
+#define SHV_EMUL_OPCODE_BYTE            0x02
+#define SHV_EMUL_OPCODE_IMM8            0x04
+#define SHV_EMUL_OPCODE_IMMZ            0x08
+#define SHV_EMUL_OPCODE_MOFFS           0x10
+#define SHV_EMUL_OPCODE_VECTOR          0x20
+#define SHV_EMUL_OPCODE_STRING          0x40
+#define SHV_EMUL_OPCODE_NO_PREFIX       0x80
+
+//
+// Two-byte opcodes are looked up with the escape byte on top.
+//
+#define SHV_EMUL_ESCAPE                 0x0f00
+
+//
+// The mandatory prefix of an SSE or AVX instruction, in the encoding of
+// the pp field of a VEX prefix.
+//
+#define SHV_EMUL_PP_NONE                0
+#define SHV_EMUL_PP_66                  1
+#define SHV_EMUL_PP_F3                  2
+#define SHV_EMUL_PP_F2                  3
+
+//
+// Bits in the guest state that decide whether an instruction can be
+// emulated.  Emulating would skip the single step trap, and only 64-bit
+// code is decoded.
+//
+#define SHV_EMUL_RFLAGS_TF              0x100
+#define SHV_EMUL_RFLAGS_DF              0x400
+#define SHV_EMUL_RFLAGS_STATUS          0x8d5
+#define SHV_EMUL_CS_LONG_MODE           (1 << 13)
+
+//
+// Bits of the exit qualification of an EPT violation saying that the
+// guest linear address is valid, and that the access was to it, not to a
+// guest paging structure.
+//
+#define SHV_EMUL_LINEAR_VALID           (1 << 7)
+#define SHV_EMUL_LINEAR_ACCESS          (1 << 8)
+
+//
+// The enable bits of the four breakpoints in DR7, and the low bit of their
+// R/W fields, which is set for breakpoints on writes.
+//
+#define SHV_EMUL_DR7_ENABLE(n)          (3ULL << ((n) * 2))
+#define SHV_EMUL_DR7_WRITE(n)           (1ULL << (16 + (n) * 4))
+
+//
+// The #UD raised for a LOCK prefix an instruction doesn't allow.
+//
+#define SHV_EMUL_INJECT_UD              (INTR_INFO_VALID_MASK | INTR_TYPE_HARD_EXCEPTION | 6)
+
+#define SHV_EMUL_REGISTER_RAX           0
+#define SHV_EMUL_REGISTER_RCX           1
+#define SHV_EMUL_REGISTER_RSP           4
+#define SHV_EMUL_REGISTER_RSI           6
+#define SHV_EMUL_REGISTER_RDI           7
+
+// ===========================================================================
+//
+// LOCAL TYPES
+//
+// ===========================================================================
+
+//
+// An entry of the opcode table.
+//
+typedef struct _SHV_EMUL_OPCODE
+{
+	USHORT Opcode;
+	UCHAR Operation;
+	UCHAR Encoding;
+} SHV_EMUL_OPCODE, *PSHV_EMUL_OPCODE;
+
+// ===========================================================================
+//
+// LOCAL DATA
+//
+// ===========================================================================
+
+//
+// Every opcode that is emulated, sorted by opcode.  Everything else is
+// left to the caller.
+//
+static const SHV_EMUL_OPCODE ShvVmxEmulOpcodes[] =
+{
+	{ 0x0000, ShvEmulAdd, SHV_EMUL_OPCODE_MODRM | SHV_EMUL_OPCODE_BYTE },
+	{ 0x0001, ShvEmulAdd, SHV_EMUL_OPCODE_MODRM },
+	{ 0x0008, ShvEmulOr, SHV_EMUL_OPCODE_MODRM | SHV_EMUL_OPCODE_BYTE },
+	{ 0x0009, ShvEmulOr, SHV_EMUL_OPCODE_MODRM },
+	{ 0x0020, ShvEmulAnd, SHV_EMUL_OPCODE_MODRM | SHV_EMUL_OPCODE_BYTE },
+	{ 0x0021, ShvEmulAnd, SHV_EMUL_OPCODE_MODRM },
+	{ 0x0028, ShvEmulSub, SHV_EMUL_OPCODE_MODRM | SHV_EMUL_OPCODE_BYTE },
+	{ 0x0029, ShvEmulSub, SHV_EMUL_OPCODE_MODRM },
+	{ 0x0030, ShvEmulXor, SHV_EMUL_OPCODE_MODRM | SHV_EMUL_OPCODE_BYTE },
+	{ 0x0031, ShvEmulXor, SHV_EMUL_OPCODE_MODRM },
+	{ 0x0080, ShvEmulGroup1, SHV_EMUL_OPCODE_MODRM | SHV_EMUL_OPCODE_BYTE | SHV_EMUL_OPCODE_IMM8 },
+	{ 0x0081, ShvEmulGroup1, SHV_EMUL_OPCODE_MODRM | SHV_EMUL_OPCODE_IMMZ },
+	{ 0x0083, ShvEmulGroup1, SHV_EMUL_OPCODE_MODRM | SHV_EMUL_OPCODE_IMM8 },
+	{ 0x0086, ShvEmulXchg, SHV_EMUL_OPCODE_MODRM | SHV_EMUL_OPCODE_BYTE },
+	{ 0x0087, ShvEmulXchg, SHV_EMUL_OPCODE_MODRM },
+	{ 0x0088, ShvEmulMov, SHV_EMUL_OPCODE_MODRM | SHV_EMUL_OPCODE_BYTE },
+	{ 0x0089, ShvEmulMov, SHV_EMUL_OPCODE_MODRM },
+	{ 0x00a2, ShvEmulMov, SHV_EMUL_OPCODE_MOFFS | SHV_EMUL_OPCODE_BYTE },
+	{ 0x00a3, ShvEmulMov, SHV_EMUL_OPCODE_MOFFS },
+	{ 0x00a4, ShvEmulMovs, SHV_EMUL_OPCODE_STRING | SHV_EMUL_OPCODE_BYTE },
+	{ 0x00a5, ShvEmulMovs, SHV_EMUL_OPCODE_STRING },
+	{ 0x00aa, ShvEmulStos, SHV_EMUL_OPCODE_STRING | SHV_EMUL_OPCODE_BYTE },
+	{ 0x00ab, ShvEmulStos, SHV_EMUL_OPCODE_STRING },
+	{ 0x00c6, ShvEmulMovImmediate, SHV_EMUL_OPCODE_MODRM | SHV_EMUL_OPCODE_BYTE | SHV_EMUL_OPCODE_IMM8 },
+	{ 0x00c7, ShvEmulMovImmediate, SHV_EMUL_OPCODE_MODRM | SHV_EMUL_OPCODE_IMMZ },
+	{ 0x0f11, ShvEmulMov, SHV_EMUL_OPCODE_MODRM | SHV_EMUL_OPCODE_VECTOR },
+	{ 0x0f29, ShvEmulMov, SHV_EMUL_OPCODE_MODRM | SHV_EMUL_OPCODE_VECTOR },
+	{ 0x0f2b, ShvEmulMov, SHV_EMUL_OPCODE_MODRM | SHV_EMUL_OPCODE_VECTOR },
+	{ 0x0f7e, ShvEmulMov, SHV_EMUL_OPCODE_MODRM | SHV_EMUL_OPCODE_VECTOR },
+	{ 0x0f7f, ShvEmulMov, SHV_EMUL_OPCODE_MODRM | SHV_EMUL_OPCODE_VECTOR },
+	{ 0x0fb0, ShvEmulCmpxchg, SHV_EMUL_OPCODE_MODRM | SHV_EMUL_OPCODE_BYTE },
+	{ 0x0fb1, ShvEmulCmpxchg, SHV_EMUL_OPCODE_MODRM },
+	{ 0x0fc0, ShvEmulXadd, SHV_EMUL_OPCODE_MODRM | SHV_EMUL_OPCODE_BYTE },
+	{ 0x0fc1, ShvEmulXadd, SHV_EMUL_OPCODE_MODRM },
+	{ 0x0fc3, ShvEmulMov, SHV_EMUL_OPCODE_MODRM | SHV_EMUL_OPCODE_NO_PREFIX },
+	{ 0x0fd6, ShvEmulMov, SHV_EMUL_OPCODE_MODRM | SHV_EMUL_OPCODE_VECTOR },
+	{ 0x0fe7, ShvEmulMov, SHV_EMUL_OPCODE_MODRM | SHV_EMUL_OPCODE_VECTOR },
+};
+
+// ===========================================================================
+//
+// LOCAL PROTOTYPES
+//
+// ===========================================================================
+
+static const SHV_EMUL_OPCODE *
+ShvVmxEmulFindOpcode(
+	USHORT opcode
+);
+
+static UCHAR
+ShvVmxEmulVectorSize(
+	UCHAR opcode,
+	ULONG pp,
+	BOOLEAN l,
+	BOOLEAN w
+);
+
+static ULONG64
+ShvVmxEmulGetRegister(
+	PSHV_VP_STATE VpState,
+	const SHV_EMUL_INSTRUCTION *instruction,
+	ULONG index,
+	ULONG size
+);
+
+static VOID
+ShvVmxEmulSetRegister(
+	PSHV_VP_STATE VpState,
+	const SHV_EMUL_INSTRUCTION *instruction,
+	ULONG index,
+	ULONG size,
+	ULONG64 value
+);
+
+static ULONG64
+ShvVmxEmulCompareExchange(
+	PVOID destination,
+	ULONG size,
+	ULONG64 exchange,
+	ULONG64 comparand
+);
+
+static ULONG64
+ShvVmxEmulCompute(
+	ULONG operation,
+	ULONG size,
+	ULONG64 destination,
+	ULONG64 source,
+	PULONG64 flags
+);
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+NTSTATUS
+ShvVmxEmulDecode(
+	_In_reads_bytes_(Length) const UCHAR *Code,
+	_In_ ULONG Length,
+	_Out_ PSHV_EMUL_INSTRUCTION Instruction
+)
+{
+	const SHV_EMUL_OPCODE *entry;
+	BOOLEAN size16, vex, l, w;
+	UCHAR rex, modrm, sib;
+	ULONG i, pp, immediate;
+	USHORT opcode;
+
+	__stosb((PUCHAR)Instruction, 0, sizeof(*Instruction));
+	Instruction->Register = SHV_EMUL_NO_REGISTER;
+	Instruction->Base = SHV_EMUL_NO_REGISTER;
+	Instruction->Index = SHV_EMUL_NO_REGISTER;
+
+	Length = min(Length, SHV_EMUL_MAX_LENGTH);
+
+	//
+	// Legacy prefixes, in any order.  Only FS and GS overrides mean anything
+	// in 64-bit mode.  REP and REPNE double as the mandatory prefixes of SSE
+	// instructions, so which one it was is kept until the opcode tells.
+	//
+	size16 = FALSE;
+	pp = SHV_EMUL_PP_NONE;
+
+	for (i = 0; i < Length; i++)
+	{
+		switch (Code[i])
+		{
+		case 0xf0:
+			Instruction->Flags |= SHV_EMUL_FLAG_LOCK;
+			continue;
+		case 0xf2:
+			pp = SHV_EMUL_PP_F2;
+			continue;
+		case 0xf3:
+			pp = SHV_EMUL_PP_F3;
+			continue;
+		case 0x2e:
+		case 0x36:
+		case 0x3e:
+		case 0x26:
+			continue;
+		case 0x64:
+			Instruction->Segment = SHV_EMUL_SEGMENT_FS;
+			continue;
+		case 0x65:
+			Instruction->Segment = SHV_EMUL_SEGMENT_GS;
+			continue;
+		case 0x66:
+			size16 = TRUE;
+			continue;
+		case 0x67:
+			Instruction->Flags |= SHV_EMUL_FLAG_ADDRESS32;
+			continue;
+		}
+
+		break;
+	}
+
+	//
+	// A REX prefix only counts right before the opcode.
+	//
+	rex = 0;
+
+	if (i < Length && (Code[i] & 0xf0) == 0x40)
+	{
+		rex = Code[i++];
+		Instruction->Flags |= SHV_EMUL_FLAG_REX;
+	}
+
+	if (i >= Length)
+	{
+		return STATUS_NOT_SUPPORTED;
+	}
+
+	//
+	// A VEX prefix stands in for REX, the mandatory prefix and the escape
+	// byte, and is never combined with any of them.
+	//
+	vex = FALSE;
+	l = FALSE;
+
+	if (Code[i] == 0xc4 || Code[i] == 0xc5)
+	{
+		if (rex != 0 || size16 || pp != SHV_EMUL_PP_NONE || (Instruction->Flags & SHV_EMUL_FLAG_LOCK))
+		{
+			return STATUS_NOT_SUPPORTED;
+		}
+
+		vex = TRUE;
+
+		//
+		// None of the stores has a second source, so vvvv has to name none,
+		// which is all ones, or the instruction raises #UD.
+		//
+		if (Code[i] == 0xc5)
+		{
+			if (i + 2 >= Length || (Code[i + 1] & 0x78) != 0x78)
+			{
+				return STATUS_NOT_SUPPORTED;
+			}
+
+			rex = 0x40 | ((Code[i + 1] & 0x80) ? 0 : 0x04);
+			l = (Code[i + 1] & 0x04) != 0;
+			pp = Code[i + 1] & 0x03;
+			i += 2;
+		}
+		else
+		{
+			//
+			// Only the map of two-byte opcodes has stores we emulate.
+			//
+			if (i + 3 >= Length || (Code[i + 1] & 0x1f) != 1 || (Code[i + 2] & 0x78) != 0x78)
+			{
+				return STATUS_NOT_SUPPORTED;
+			}
+
+			rex = 0x40 |
+				((Code[i + 1] & 0x80) ? 0 : 0x04) |
+				((Code[i + 1] & 0x40) ? 0 : 0x02) |
+				((Code[i + 1] & 0x20) ? 0 : 0x01) |
+				((Code[i + 2] & 0x80) ? 0x08 : 0);
+			l = (Code[i + 2] & 0x04) != 0;
+			pp = Code[i + 2] & 0x03;
+			i += 3;
+		}
+
+		opcode = SHV_EMUL_ESCAPE | Code[i++];
+	}
+	else if (Code[i] == 0x0f)
+	{
+		if (i + 1 >= Length)
+		{
+			return STATUS_NOT_SUPPORTED;
+		}
+
+		opcode = SHV_EMUL_ESCAPE | Code[i + 1];
+		i += 2;
+	}
+	else
+	{
+		opcode = Code[i++];
+	}
+
+	entry = ShvVmxEmulFindOpcode(opcode);
+	if (entry == NULL || (vex && (entry->Encoding & SHV_EMUL_OPCODE_VECTOR) == 0))
+	{
+		return STATUS_NOT_SUPPORTED;
+	}
+
+	Instruction->Operation = entry->Operation;
+	w = (rex & 0x08) != 0;
+
+	//
+	// Work out the operand size.  The 66 prefix is a mandatory prefix to
+	// vector instructions, and an operand size override to everything
+	// else.
+	//
+	if (entry->Encoding & SHV_EMUL_OPCODE_VECTOR)
+	{
+		if (!vex && size16)
+		{
+			pp = (pp == SHV_EMUL_PP_NONE) ? SHV_EMUL_PP_66 : pp;
+		}
+
+		Instruction->Flags |= SHV_EMUL_FLAG_VECTOR;
+		Instruction->Size = ShvVmxEmulVectorSize((UCHAR)opcode, pp, l, w);
+
+		if (Instruction->Size == 0)
+		{
+			return STATUS_NOT_SUPPORTED;
+		}
+	}
+	else
+	{
+		if (entry->Encoding & SHV_EMUL_OPCODE_BYTE)
+		{
+			Instruction->Size = 1;
+		}
+		else if (w)
+		{
+			Instruction->Size = 8;
+		}
+		else if (size16)
+		{
+			Instruction->Size = 2;
+		}
+		else
+		{
+			Instruction->Size = 4;
+		}
+
+		if ((entry->Encoding & SHV_EMUL_OPCODE_STRING) && pp != SHV_EMUL_PP_NONE)
+		{
+			Instruction->Flags |= SHV_EMUL_FLAG_REP;
+		}
+
+		if ((entry->Encoding & SHV_EMUL_OPCODE_NO_PREFIX) && (size16 || pp != SHV_EMUL_PP_NONE))
+		{
+			return STATUS_NOT_SUPPORTED;
+		}
+	}
+
+	if (entry->Encoding & SHV_EMUL_OPCODE_MODRM)
+	{
+		if (i >= Length)
+		{
+			return STATUS_NOT_SUPPORTED;
+		}
+
+		modrm = Code[i++];
+
+		//
+		// A register operand in the r/m field isn't a store.
+		//
+		if ((modrm >> 6) == 3)
+		{
+			return STATUS_NOT_SUPPORTED;
+		}
+
+		Instruction->Register = ((modrm >> 3) & 7) | ((rex & 0x04) ? 8 : 0);
+
+		if (entry->Operation == ShvEmulGroup1)
+		{
+			switch ((modrm >> 3) & 7)
+			{
+			case 0:
+				Instruction->Operation = ShvEmulAdd;
+				break;
+			case 1:
+				Instruction->Operation = ShvEmulOr;
+				break;
+			case 4:
+				Instruction->Operation = ShvEmulAnd;
+				break;
+			case 5:
+				Instruction->Operation = ShvEmulSub;
+				break;
+			case 6:
+				Instruction->Operation = ShvEmulXor;
+				break;
+			default:
+				return STATUS_NOT_SUPPORTED;
+			}
+
+			Instruction->Register = SHV_EMUL_NO_REGISTER;
+		}
+		else if (entry->Operation == ShvEmulMovImmediate)
+		{
+			if (((modrm >> 3) & 7) != 0)
+			{
+				return STATUS_NOT_SUPPORTED;
+			}
+
+			Instruction->Register = SHV_EMUL_NO_REGISTER;
+		}
+
+		if ((modrm & 7) == 4)
+		{
+			if (i >= Length)
+			{
+				return STATUS_NOT_SUPPORTED;
+			}
+
+			sib = Code[i++];
+
+			Instruction->Scale = (UCHAR)(1 << (sib >> 6));
+			Instruction->Index = ((sib >> 3) & 7) | ((rex & 0x02) ? 8 : 0);
+
+			if (Instruction->Index == SHV_EMUL_REGISTER_RSP)
+			{
+				Instruction->Index = SHV_EMUL_NO_REGISTER;
+			}
+
+			if ((sib & 7) == 5 && (modrm >> 6) == 0)
+			{
+				Instruction->Base = SHV_EMUL_NO_REGISTER;
+				immediate = 4;
+			}
+			else
+			{
+				Instruction->Base = (sib & 7) | ((rex & 0x01) ? 8 : 0);
+				immediate = 0;
+			}
+		}
+		else if ((modrm & 7) == 5 && (modrm >> 6) == 0)
+		{
+			Instruction->Base = SHV_EMUL_RIP;
+			immediate = 4;
+		}
+		else
+		{
+			Instruction->Base = (modrm & 7) | ((rex & 0x01) ? 8 : 0);
+			immediate = 0;
+		}
+
+		//
+		// The displacement is 8 or 32 bits, sign extended.
+		//
+		if ((modrm >> 6) == 1)
+		{
+			immediate = 1;
+		}
+		else if ((modrm >> 6) == 2)
+		{
+			immediate = 4;
+		}
+
+		if (i + immediate > Length)
+		{
+			return STATUS_NOT_SUPPORTED;
+		}
+
+		if (immediate == 1)
+		{
+			Instruction->Displacement = (CHAR)Code[i];
+		}
+		else if (immediate == 4)
+		{
+			Instruction->Displacement = *(const LONG UNALIGNED *)&Code[i];
+		}
+
+		i += immediate;
+	}
+	else if (entry->Encoding & SHV_EMUL_OPCODE_MOFFS)
+	{
+		//
+		// The absolute address is as wide as addresses are.
+		//
+		immediate = (Instruction->Flags & SHV_EMUL_FLAG_ADDRESS32) ? 4 : 8;
+
+		if (i + immediate > Length)
+		{
+			return STATUS_NOT_SUPPORTED;
+		}
+
+		Instruction->Displacement = (immediate == 4) ?
+			*(const ULONG UNALIGNED *)&Code[i] :
+			*(const LONG64 UNALIGNED *)&Code[i];
+		Instruction->Register = SHV_EMUL_REGISTER_RAX;
+
+		i += immediate;
+	}
+	else
+	{
+		//
+		// String instructions store to RDI, and STOS stores the accumulator.
+		//
+		Instruction->Base = SHV_EMUL_REGISTER_RDI;
+		Instruction->Register = SHV_EMUL_REGISTER_RAX;
+	}
+
+	//
+	// Immediates are sign extended to the operand size.
+	//
+	if (entry->Encoding & SHV_EMUL_OPCODE_IMM8)
+	{
+		if (i + 1 > Length)
+		{
+			return STATUS_NOT_SUPPORTED;
+		}
+
+		Instruction->Immediate = (ULONG64)(LONG64)(CHAR)Code[i];
+		i += 1;
+	}
+	else if (entry->Encoding & SHV_EMUL_OPCODE_IMMZ)
+	{
+		immediate = (Instruction->Size == 2) ? 2 : 4;
+
+		if (i + immediate > Length)
+		{
+			return STATUS_NOT_SUPPORTED;
+		}
+
+		Instruction->Immediate = (immediate == 2) ?
+			(ULONG64)(LONG64)*(const SHORT UNALIGNED *)&Code[i] :
+			(ULONG64)(LONG64)*(const LONG UNALIGNED *)&Code[i];
+		i += immediate;
+	}
+
+	Instruction->Length = (UCHAR)i;
+
+	return STATUS_SUCCESS;
+}
+
+NTSTATUS
+ShvVmxEmulPrepareStore(
+	_In_ PSHV_VP_DATA VpData,
+	_In_ PSHV_VP_STATE VpState,
+	_In_ ULONG64 Gpa,
+	_Out_ PSHV_EMUL_STORE Store
+)
+{
+	PSHV_EMUL_INSTRUCTION instruction;
+	UCHAR code[SHV_EMUL_MAX_LENGTH];
+	ULONG64 linear, qualification, segment, value, count, source, element;
+	ULONG length, batch;
+	SIZE_T field;
+	NTSTATUS ret;
+
+	instruction = &Store->Instruction;
+
+	//
+	// Only 64-bit code is decoded, and single stepping guests get the trap
+	// the real instruction would have raised by not being emulated.
+	//
+	__vmx_vmread(GUEST_CS_AR_BYTES, &field);
+
+	if ((field & SHV_EMUL_CS_LONG_MODE) == 0 || (VpState->GuestEFlags & SHV_EMUL_RFLAGS_TF) != 0)
+	{
+		return STATUS_NOT_SUPPORTED;
+	}
+
+	//
+	// A write made while delivering an event, such as pushing an interrupt
+	// frame, isn't the instruction at RIP.
+	//
+	__vmx_vmread(IDT_VECTORING_INFO, &field);
+
+	if ((field & INTR_INFO_VALID_MASK) != 0)
+	{
+		return STATUS_NOT_SUPPORTED;
+	}
+
+	//
+	// Nor are the data breakpoints the write would hit checked here, so
+	// leave writes to the processor while the guest has any armed.
+	//
+	__vmx_vmread(GUEST_DR7, &field);
+
+	for (ULONG i = 0; i < 4; i++)
+	{
+		if ((field & SHV_EMUL_DR7_ENABLE(i)) != 0 && (field & SHV_EMUL_DR7_WRITE(i)) != 0)
+		{
+			return STATUS_NOT_SUPPORTED;
+		}
+	}
+
+	//
+	// The processor already translated the linear address of the write,
+	// with the guest's permissions, and set its dirty flag.  That only
+	// leaves the EPT, which is why we are here.
+	//
+	__vmx_vmread(EXIT_QUALIFICATION, (PSIZE_T)&qualification);
+
+	if ((qualification & (SHV_EMUL_LINEAR_VALID | SHV_EMUL_LINEAR_ACCESS)) !=
+		(SHV_EMUL_LINEAR_VALID | SHV_EMUL_LINEAR_ACCESS))
+	{
+		return STATUS_NOT_SUPPORTED;
+	}
+
+	__vmx_vmread(GUEST_LINEAR_ADDRESS, (PSIZE_T)&linear);
+
+	//
+	// Fetch the instruction, without running off the end of its page if the
+	// next one isn't mapped.
+	//
+	length = SHV_EMUL_MAX_LENGTH;
+
+	ret = ShvVmxGuestReadVirtual(VpData, VpState->GuestRip, code, length);
+	if (ret != STATUS_SUCCESS)
+	{
+		length = (ULONG)min(length, PAGE_SIZE - (VpState->GuestRip & (PAGE_SIZE - 1)));
+
+		ret = ShvVmxGuestReadVirtual(VpData, VpState->GuestRip, code, length);
+		if (ret != STATUS_SUCCESS)
+		{
+			return ret;
+		}
+	}
+
+	ret = ShvVmxEmulDecode(code, length, instruction);
+	if (ret != STATUS_SUCCESS)
+	{
+		return ret;
+	}
+
+	//
+	// Only read-modify-write instructions can be locked.  Any other store
+	// raises #UD instead, which doesn't move past the instruction.
+	//
+	if ((instruction->Flags & SHV_EMUL_FLAG_LOCK) != 0 &&
+		((instruction->Flags & SHV_EMUL_FLAG_VECTOR) != 0 ||
+		 instruction->Operation == ShvEmulMov ||
+		 instruction->Operation == ShvEmulMovImmediate ||
+		 instruction->Operation == ShvEmulMovs ||
+		 instruction->Operation == ShvEmulStos))
+	{
+		__vmx_vmwrite(VM_ENTRY_INTR_INFO, SHV_EMUL_INJECT_UD);
+		return STATUS_ILLEGAL_INSTRUCTION;
+	}
+
+	//
+	// The upper halves of the YMM registers aren't part of the context that
+	// was captured on exit.
+	//
+	if (instruction->Size > sizeof(M128A))
+	{
+		return STATUS_NOT_SUPPORTED;
+	}
+
+	segment = 0;
+
+	if (instruction->Segment == SHV_EMUL_SEGMENT_FS)
+	{
+		__vmx_vmread(GUEST_FS_BASE, (PSIZE_T)&segment);
+	}
+	else if (instruction->Segment == SHV_EMUL_SEGMENT_GS)
+	{
+		__vmx_vmread(GUEST_GS_BASE, (PSIZE_T)&segment);
+	}
+
+	Store->Count = 1;
+	Store->Source = 0;
+
+	if (instruction->Operation == ShvEmulMovs || instruction->Operation == ShvEmulStos)
+	{
+		if (instruction->Flags & SHV_EMUL_FLAG_ADDRESS32)
+		{
+			return STATUS_NOT_SUPPORTED;
+		}
+
+		//
+		// Carry out as many elements as fit on the page of the violation,
+		// and in the data buffer, at once.  Repeated string instructions can
+		// be interrupted after any element, so stopping early is fine.
+		//
+		element = instruction->Size;
+		count = 1;
+
+		if (instruction->Flags & SHV_EMUL_FLAG_REP)
+		{
+			count = ShvVmxEmulGetRegister(VpState, instruction, SHV_EMUL_REGISTER_RCX, 8);
+			if (count == 0)
+			{
+				return STATUS_NOT_SUPPORTED;
+			}
+		}
+
+		Store->Va = ShvVmxEmulGetRegister(VpState, instruction, SHV_EMUL_REGISTER_RDI, 8);
+
+		if ((Store->Va & (PAGE_SIZE - 1)) + element > PAGE_SIZE)
+		{
+			return STATUS_NOT_SUPPORTED;
+		}
+
+		if (VpState->GuestEFlags & SHV_EMUL_RFLAGS_DF)
+		{
+			batch = (ULONG)((Store->Va & (PAGE_SIZE - 1)) / element + 1);
+		}
+		else
+		{
+			batch = (ULONG)((PAGE_SIZE - (Store->Va & (PAGE_SIZE - 1))) / element);
+		}
+
+		batch = (ULONG)min(min(batch, count), SHV_EMUL_MAX_STORE / element);
+
+		if (instruction->Operation == ShvEmulMovs)
+		{
+			source = ShvVmxEmulGetRegister(VpState, instruction, SHV_EMUL_REGISTER_RSI, 8) + segment;
+
+			//
+			// Copying between overlapping ranges depends on the order of
+			// the elements, so only do those one at a time.
+			//
+			if (source < Store->Va + batch * element && Store->Va < source + batch * element)
+			{
+				batch = 1;
+			}
+
+			if (VpState->GuestEFlags & SHV_EMUL_RFLAGS_DF)
+			{
+				source -= (batch - 1) * element;
+			}
+
+			ret = ShvVmxGuestReadVirtual(VpData, source, Store->Data, batch * element);
+			if (ret != STATUS_SUCCESS)
+			{
+				return ret;
+			}
+
+			Store->Source = source;
+		}
+		else
+		{
+			value = ShvVmxEmulGetRegister(VpState, instruction, SHV_EMUL_REGISTER_RAX, (ULONG)element);
+
+			for (ULONG i = 0; i < batch; i++)
+			{
+				__movsb(&Store->Data[i * element], (PUCHAR)&value, element);
+			}
+		}
+
+		if (VpState->GuestEFlags & SHV_EMUL_RFLAGS_DF)
+		{
+			Store->Va -= (batch - 1) * element;
+		}
+
+		Store->Size = (ULONG)(batch * element);
+		Store->Count = batch;
+	}
+	else
+	{
+		//
+		// Work out the effective address.  RIP-relative addresses count
+		// from the end of the instruction.
+		//
+		Store->Va = instruction->Displacement;
+
+		if (instruction->Base == SHV_EMUL_RIP)
+		{
+			Store->Va += VpState->GuestRip + instruction->Length;
+		}
+		else if (instruction->Base != SHV_EMUL_NO_REGISTER)
+		{
+			Store->Va += ShvVmxEmulGetRegister(VpState, instruction, instruction->Base, 8);
+		}
+
+		if (instruction->Index != SHV_EMUL_NO_REGISTER)
+		{
+			Store->Va += ShvVmxEmulGetRegister(VpState, instruction, instruction->Index, 8) * instruction->Scale;
+		}
+
+		if (instruction->Flags & SHV_EMUL_FLAG_ADDRESS32)
+		{
+			Store->Va = (ULONG)Store->Va;
+		}
+
+		Store->Va += segment;
+		Store->Size = instruction->Size;
+
+		//
+		// Gather what gets written, or what it gets combined with.
+		//
+		if (instruction->Flags & SHV_EMUL_FLAG_VECTOR)
+		{
+			__movsb(Store->Data, (PUCHAR)&(&VpState->VpRegs->Xmm0)[instruction->Register], Store->Size);
+		}
+		else
+		{
+			if (instruction->Register != SHV_EMUL_NO_REGISTER)
+			{
+				value = ShvVmxEmulGetRegister(VpState, instruction, instruction->Register, Store->Size);
+			}
+			else
+			{
+				value = instruction->Immediate;
+			}
+
+			*(PULONG64)Store->Data = value;
+		}
+	}
+
+	//
+	// Whatever was decoded has to be the write that faulted, all of it on
+	// the same page and covering the faulting byte.  If it isn't, the code
+	// changed since it ran.
+	//
+	if (linear < Store->Va ||
+		linear - Store->Va >= Store->Size ||
+		(Store->Va & (PAGE_SIZE - 1)) + Store->Size > PAGE_SIZE)
+	{
+		return STATUS_NOT_SUPPORTED;
+	}
+
+	Store->Gpa = (Gpa & ~(ULONG64)(PAGE_SIZE - 1)) | (Store->Va & (PAGE_SIZE - 1));
+
+	return STATUS_SUCCESS;
+}
+
+NTSTATUS
+ShvVmxEmulCommitStore(
+	_In_ PSHV_VP_DATA VpData,
+	_In_ PSHV_VP_STATE VpState,
+	_Inout_ PSHV_EMUL_STORE Store
+)
+{
+	PSHV_EMUL_INSTRUCTION instruction;
+	ULONG64 hpa, old, result, source, flags, delta;
+	BOOLEAN advance;
+	PUCHAR mapped;
+	ULONG size;
+
+	instruction = &Store->Instruction;
+	size = Store->Size;
+
+	//
+	// Write to the host frame behind the page directly, past whatever the
+	// EPT withholds.  That can be reads too, as on pages watched for them,
+	// so only whether the default view maps the page at all matters.
+	//
+	if (ShvVmxEptGetAccess(Store->Gpa, &hpa) == 0)
+	{
+		return STATUS_ACCESS_VIOLATION;
+	}
+
+	mapped = (PUCHAR)ShvVmxGuestMap(VpData, hpa);
+	flags = VpState->GuestEFlags;
+	source = *(PULONG64)Store->Data;
+
+	switch (instruction->Operation)
+	{
+	case ShvEmulMov:
+	case ShvEmulMovImmediate:
+	case ShvEmulMovs:
+	case ShvEmulStos:
+		//
+		// Naturally sized writes are made in one go, like the processor
+		// would.
+		//
+		switch (size)
+		{
+		case 1:
+			*(volatile UCHAR *)mapped = Store->Data[0];
+			break;
+		case 2:
+			*(volatile USHORT UNALIGNED *)mapped = *(PUSHORT)Store->Data;
+			break;
+		case 4:
+			*(volatile ULONG UNALIGNED *)mapped = *(PULONG)Store->Data;
+			break;
+		case 8:
+			*(volatile ULONG64 UNALIGNED *)mapped = *(PULONG64)Store->Data;
+			break;
+		default:
+			__movsb(mapped, Store->Data, size);
+			break;
+		}
+
+		break;
+	case ShvEmulXchg:
+		//
+		// Exchanges are locked whether they say so or not, and other VPs may
+		// be stepping writes to the same page, so every read-modify-write
+		// is made atomic.
+		//
+		do
+		{
+			old = ShvVmxEmulCompareExchange(mapped, size, 0, 0);
+		} while (ShvVmxEmulCompareExchange(mapped, size, source, old) != old);
+
+		ShvVmxEmulSetRegister(VpState, instruction, instruction->Register, size, old);
+		break;
+	case ShvEmulCmpxchg:
+		result = ShvVmxEmulGetRegister(VpState, instruction, SHV_EMUL_REGISTER_RAX, size);
+		old = ShvVmxEmulCompareExchange(mapped, size, source, result);
+
+		ShvVmxEmulCompute(ShvEmulSub, size, result, old, &flags);
+
+		if (old != result)
+		{
+			ShvVmxEmulSetRegister(VpState, instruction, SHV_EMUL_REGISTER_RAX, size, old);
+		}
+
+		break;
+	case ShvEmulXadd:
+		do
+		{
+			old = ShvVmxEmulCompareExchange(mapped, size, 0, 0);
+			result = ShvVmxEmulCompute(ShvEmulAdd, size, old, source, &flags);
+		} while (ShvVmxEmulCompareExchange(mapped, size, result, old) != old);
+
+		ShvVmxEmulSetRegister(VpState, instruction, instruction->Register, size, old);
+		break;
+	default:
+		do
+		{
+			old = ShvVmxEmulCompareExchange(mapped, size, 0, 0);
+			result = ShvVmxEmulCompute(instruction->Operation, size, old, source, &flags);
+		} while (ShvVmxEmulCompareExchange(mapped, size, result, old) != old);
+
+		break;
+	}
+
+	ShvVmxGuestUnmap(VpData);
+
+	//
+	// The write never went through the EPT, so dirty logging didn't see it.
+	//
+	ShvVmxPmlLogWrite(Store->Gpa);
+
+	//
+	// String instructions move their pointers past every element, and only
+	// finish once the count runs out.
+	//
+	advance = TRUE;
+
+	if (instruction->Operation == ShvEmulMovs || instruction->Operation == ShvEmulStos)
+	{
+		delta = (ULONG64)Store->Count * instruction->Size;
+		if (flags & SHV_EMUL_RFLAGS_DF)
+		{
+			delta = 0 - delta;
+		}
+
+		ShvVmxEmulSetRegister(VpState,
+			instruction,
+			SHV_EMUL_REGISTER_RDI,
+			8,
+			ShvVmxEmulGetRegister(VpState, instruction, SHV_EMUL_REGISTER_RDI, 8) + delta);
+
+		if (instruction->Operation == ShvEmulMovs)
+		{
+			ShvVmxEmulSetRegister(VpState,
+				instruction,
+				SHV_EMUL_REGISTER_RSI,
+				8,
+				ShvVmxEmulGetRegister(VpState, instruction, SHV_EMUL_REGISTER_RSI, 8) + delta);
+		}
+
+		if (instruction->Flags & SHV_EMUL_FLAG_REP)
+		{
+			old = ShvVmxEmulGetRegister(VpState, instruction, SHV_EMUL_REGISTER_RCX, 8) - Store->Count;
+			ShvVmxEmulSetRegister(VpState, instruction, SHV_EMUL_REGISTER_RCX, 8, old);
+
+			advance = (old == 0);
+		}
+	}
+
+	if (flags != VpState->GuestEFlags)
+	{
+		VpState->GuestEFlags = flags;
+		__vmx_vmwrite(GUEST_RFLAGS, flags);
+	}
+
+	if (advance)
+	{
+		VpState->GuestRip += instruction->Length;
+		__vmx_vmwrite(GUEST_RIP, VpState->GuestRip);
+	}
+
+	return STATUS_SUCCESS;
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+static const SHV_EMUL_OPCODE *
+ShvVmxEmulFindOpcode(
+	USHORT opcode
+)
+{
+	ULONG low, high, mid;
+
+	low = 0;
+	high = RTL_NUMBER_OF(ShvVmxEmulOpcodes);
+
+	while (low < high)
+	{
+		mid = (low + high) / 2;
+
+		if (ShvVmxEmulOpcodes[mid].Opcode < opcode)
+		{
+			low = mid + 1;
+		}
+		else
+		{
+			high = mid;
+		}
+	}
+
+	if (low < RTL_NUMBER_OF(ShvVmxEmulOpcodes) && ShvVmxEmulOpcodes[low].Opcode == opcode)
+	{
+		return &ShvVmxEmulOpcodes[low];
+	}
+
+	return NULL;
+}
+
+static UCHAR
+ShvVmxEmulVectorSize(
+	UCHAR opcode,
+	ULONG pp,
+	BOOLEAN l,
+	BOOLEAN w
+)
+{
+	UCHAR full;
+
+	//
+	// The size of the stores among the vector moves, by mandatory prefix.
+	// The ones without a prefix that aren't listed are MMX, whose
+	// registers aren't part of the captured context.  MOVD and MOVQ only
+	// come in 128 bits.
+	//
+	full = l ? 32 : 16;
+
+	switch (opcode)
+	{
+	case 0x11:
+		if (pp == SHV_EMUL_PP_F3)
+		{
+			return 4;
+		}
+
+		return (pp == SHV_EMUL_PP_F2) ? 8 : full;
+	case 0x29:
+	case 0x2b:
+		return (pp == SHV_EMUL_PP_NONE || pp == SHV_EMUL_PP_66) ? full : 0;
+	case 0x7e:
+		return (pp == SHV_EMUL_PP_66 && !l) ? (w ? 8 : 4) : 0;
+	case 0x7f:
+		return (pp == SHV_EMUL_PP_66 || pp == SHV_EMUL_PP_F3) ? full : 0;
+	case 0xd6:
+		return (pp == SHV_EMUL_PP_66 && !l) ? 8 : 0;
+	case 0xe7:
+		return (pp == SHV_EMUL_PP_66) ? full : 0;
+	}
+
+	return 0;
+}
+
+static ULONG64
+ShvVmxEmulGetRegister(
+	PSHV_VP_STATE VpState,
+	const SHV_EMUL_INSTRUCTION *instruction,
+	ULONG index,
+	ULONG size
+)
+{
+	ULONG64 value;
+
+	//
+	// Without a REX prefix, byte registers 4 to 7 are AH, CH, DH and BH.
+	// The captured RSP is the host's, the guest's is in the VMCS.
+	//
+	if (size == 1 && (instruction->Flags & SHV_EMUL_FLAG_REX) == 0 && index >= 4 && index < 8)
+	{
+		return ((&VpState->VpRegs->Rax)[index - 4] >> 8) & 0xff;
+	}
+
+	value = (index == SHV_EMUL_REGISTER_RSP) ? VpState->GuestRsp : (&VpState->VpRegs->Rax)[index];
+
+	if (size < 8)
+	{
+		value &= (1ULL << (size * 8)) - 1;
+	}
+
+	return value;
+}
+
+static VOID
+ShvVmxEmulSetRegister(
+	PSHV_VP_STATE VpState,
+	const SHV_EMUL_INSTRUCTION *instruction,
+	ULONG index,
+	ULONG size,
+	ULONG64 value
+)
+{
+	ULONG64 current, mask;
+	ULONG shift;
+
+	shift = 0;
+
+	if (size == 1 && (instruction->Flags & SHV_EMUL_FLAG_REX) == 0 && index >= 4 && index < 8)
+	{
+		index -= 4;
+		shift = 8;
+	}
+
+	current = (index == SHV_EMUL_REGISTER_RSP) ? VpState->GuestRsp : (&VpState->VpRegs->Rax)[index];
+
+	//
+	// 32-bit results zero the upper half, narrower ones leave the rest of
+	// the register alone.
+	//
+	if (size == 4)
+	{
+		current = (ULONG)value;
+	}
+	else if (size == 8)
+	{
+		current = value;
+	}
+	else
+	{
+		mask = ((1ULL << (size * 8)) - 1) << shift;
+		current = (current & ~mask) | ((value << shift) & mask);
+	}
+
+	if (index == SHV_EMUL_REGISTER_RSP)
+	{
+		VpState->GuestRsp = current;
+		__vmx_vmwrite(GUEST_RSP, current);
+	}
+	else
+	{
+		(&VpState->VpRegs->Rax)[index] = current;
+	}
+}
+
+static ULONG64
+ShvVmxEmulCompareExchange(
+	PVOID destination,
+	ULONG size,
+	ULONG64 exchange,
+	ULONG64 comparand
+)
+{
+	switch (size)
+	{
+	case 1:
+		return (UCHAR)InterlockedCompareExchange8((volatile CHAR *)destination, (CHAR)exchange, (CHAR)comparand);
+	case 2:
+		return (USHORT)InterlockedCompareExchange16((volatile SHORT *)destination, (SHORT)exchange, (SHORT)comparand);
+	case 4:
+		return (ULONG)InterlockedCompareExchange((volatile LONG *)destination, (LONG)exchange, (LONG)comparand);
+	default:
+		return (ULONG64)InterlockedCompareExchange64((volatile LONG64 *)destination, (LONG64)exchange, (LONG64)comparand);
+	}
+}
+
+static ULONG64
+ShvVmxEmulCompute(
+	ULONG operation,
+	ULONG size,
+	ULONG64 destination,
+	ULONG64 source,
+	PULONG64 flags
+)
+{
+	ULONG64 mask, sign, result, status;
+	UCHAR parity;
+
+	mask = (size == 8) ? MAXULONG64 : ((1ULL << (size * 8)) - 1);
+	sign = 1ULL << (size * 8 - 1);
+
+	destination &= mask;
+	source &= mask;
+	status = 0;
+
+	switch (operation)
+	{
+	case ShvEmulAdd:
+		result = (destination + source) & mask;
+		status |= (result < destination) ? 0x001 : 0;
+		status |= ((destination ^ result) & (source ^ result) & sign) ? 0x800 : 0;
+		status |= (destination ^ source ^ result) & 0x010;
+		break;
+	case ShvEmulSub:
+		result = (destination - source) & mask;
+		status |= (destination < source) ? 0x001 : 0;
+		status |= ((destination ^ source) & (destination ^ result) & sign) ? 0x800 : 0;
+		status |= (destination ^ source ^ result) & 0x010;
+		break;
+	case ShvEmulOr:
+		result = destination | source;
+		break;
+	case ShvEmulAnd:
+		result = destination & source;
+		break;
+	default:
+		result = destination ^ source;
+		break;
+	}
+
+	//
+	// Zero, sign and parity of the low byte, which is set when it has an
+	// even number of bits set.
+	//
+	parity = (UCHAR)result;
+	parity ^= parity >> 4;
+
+	status |= (result == 0) ? 0x040 : 0;
+	status |= (result & sign) ? 0x080 : 0;
+	status |= ((0x6996 >> (parity & 0xf)) & 1) ? 0 : 0x004;
+
+	*flags = (*flags & ~(ULONG64)SHV_EMUL_RFLAGS_STATUS) | status;
+
+	return result;
+}
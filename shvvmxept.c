@@ -38,6 +38,11 @@ Environment:
 //
 #define SHV_PHYS_TO_PFN(pa) (pa >> PAGE_SHIFT)
 
+//
+// The number of bytes mapped by a whole table at a given level.
+//
+#define SHV_EPT_TABLE_SPAN(level) SHV_EPT_LEVEL_SIZE((level) + 1)
+
 //
 // Iterate through each entry in a level of a page table.
 //
@@ -49,10 +54,251 @@ Environment:
 	)
 
 //
-// Given a violation reasion, tell whether an EPT violation
-// was caused by an EPT entry not being present.
+// The number of pages the arena grows by when it runs out, and the number
+// of spare pages kept on top of the estimate for tables that are only
+// needed once the guest touches unmapped MMIO.
+//
+#define SHV_EPT_ARENA_CHUNK_PAGES (512)
+#define SHV_EPT_ARENA_HEADROOM (256)
+
+//
+// The largest number of chunks the arena can be made of.  Replicas of the
+// identity map need chunks of their own on every node.
+//
+#define SHV_EPT_ARENA_MAX_CHUNKS (64)
+
+//
+// The arena indexes every 2 MiB frame of physical and virtual address space
+// that its chunks touch, which is what makes finding the chunk of a table
+// constant time.  Chunks are never smaller than a frame, so at most two of
+// them share one, and each entry of an index packs the frame with both.
+// The indexes are only ever filled to three quarters.
+//
+#define SHV_EPT_ARENA_FRAME_SHIFT (21)
+#define SHV_EPT_ARENA_INDEX_BITS (12)
+#define SHV_EPT_ARENA_INDEX_SIZE (1UL << SHV_EPT_ARENA_INDEX_BITS)
+#define SHV_EPT_ARENA_INDEX_LIMIT (SHV_EPT_ARENA_INDEX_SIZE / 4 * 3)
+#define SHV_EPT_ARENA_INDEX_ENTRY(frame, first, second) \
+	(((ULONG64)(frame) << 14) | ((ULONG64)(first) << 7) | (ULONG64)(second))
+#define SHV_EPT_ARENA_INDEX_FRAME(entry) ((entry) >> 14)
+#define SHV_EPT_ARENA_INDEX_CHUNK(entry, n) ((ULONG)((entry) >> ((n) * 7)) & 0x7F)
+
+//
+// The number of tables that can wait at once to be reused after they were
+// collapsed into a large page, and the marker for a slot being updated.
+//
+#define SHV_EPT_RETIRED_TABLES (64)
+#define SHV_EPT_RETIRED_BUSY ((PVMX_EPT_ENTRY)1)
+
+//
+// The sequence of a slot of the on-demand region ring while it is filled.
+//
+#define SHV_EPT_REGION_BUSY (-1LL)
+
+//
+// The free list of the tables of chunks on a given node.
+//
+#define SHV_EPT_FREE_LIST(node) \
+	(&ShvVmxEptArena.FreeLists[((node) < SHV_EPT_MAX_NODES) ? (node) : SHV_EPT_MAX_NODES])
+
+//
+// The slices of the physical address space the identity map is split
+// into to build it on every LP at once.  Each slice is one PDPTE.
+//
+#define SHV_EPT_BUILD_SLICE_SIZE VMX_EPT_PAGE_SIZE_1GB
+
+//
+// Set to TRUE to only map the first MiB at initialization and populate the
+// rest of the identity map as the guest touches it.  This makes loading
+// much faster on machines with a lot of memory.
+//
+#define SHV_EPT_DEMAND_POPULATE FALSE
+
+//
+// Set to TRUE to enable the EPT accessed and dirty flags, when the
+// processor supports them, and periodically sweep them to estimate the
+// working set of the machine.  The period is in milliseconds.
+//
+#define SHV_EPT_TRACK_WORKING_SET FALSE
+#define SHV_EPT_WS_SCAN_PERIOD (1000)
+
+//
+// The end of what is mapped up front when populating on demand.  This is
+// covered by the fixed-range MTRRs, whose memory types change often enough
+// that faulting it in would take many violations.
+//
+#define SHV_EPT_DEMAND_SEED_END MTRR_FIXED_RANGE_END
+
+//
+// Set to TRUE to let chosen GPA ranges report EPT violations to a guest
+// #VE handler instead of exiting, when the processor supports it.  Every
+// other entry, including the not-present ones, then suppresses #VE.
+//
+#define SHV_EPT_VIRTUALIZATION_EXCEPTIONS FALSE
+
+//
+// Set to TRUE to save the identity map to an image file once it is built,
+// and to rebuild it from that image on the next load instead, as long as
+// neither the physical memory map nor the MTRRs changed in between.  Only
+// used when the identity map is built up front.
+//
+#define SHV_EPT_WARM_START FALSE
+#define SHV_EPT_IMAGE_PATH L"\\SystemRoot\\shvept.img"
+#define SHV_EPT_IMAGE_MAX_SIZE (16 * 1024 * 1024)
+
+//
+// Set to TRUE to give every NUMA node its own replica of the identity map,
+// built out of memory local to that node, so that page walks never have
+// to cross to another node.  Replicas rule out EPT views and the accessed
+// and dirty flags, which only ever cover a single hierarchy.
+//
+#define SHV_EPT_NUMA_REPLICATION FALSE
+#define SHV_EPT_MAX_NODES (64)
+
+//
+// Given a violation reason, get the read, write and execute accesses that
+// caused it, in the same bit positions as the EPT entry permissions.
+//
+#define SHV_EPT_VIOLATION_ACCESS(vr) ((ULONG)(vr) & VMX_EPT_ACCESS_RWX)
+
+//
+// Get the read, write and execute permissions of an EPT entry.
+//
+#define SHV_EPT_ENTRY_ACCESS(entry) ((ULONG)(entry)->QuadPart & VMX_EPT_ACCESS_RWX)
+
+//
+// The local APIC registers that root mode reads the APIC ID from and sends
+// an NMI to another LP with, in xAPIC and in x2APIC mode.  The NMI is sent
+// with the NMI delivery mode and the level asserted.
+//
+#define SHV_APIC_BASE_X2APIC_ENABLE (1ULL << 10)
+#define SHV_XAPIC_ID (0x20)
+#define SHV_XAPIC_ICR_LOW (0x300)
+#define SHV_XAPIC_ICR_HIGH (0x310)
+#define SHV_X2APIC_ID_MSR (0x802)
+#define SHV_X2APIC_ICR_MSR (0x830)
+#define SHV_APIC_ICR_NMI (0x4400)
+
+//
+// The VM-entry interruption information that injects an NMI (valid, type
+// NMI, vector 2) into the guest.
+//
+#define SHV_EPT_INJECT_NMI (0x80000202)
+
+// ===========================================================================
+//
+// LOCAL TYPES
+//
+// ===========================================================================
+
+//
+// How widely a change to an EPT entry has to be flushed.  Processors never
+// cache not-present entries, and one caching a stale, less permissive
+// entry only takes a spurious violation that the VP can fix by itself.
+// Everything else could let a processor keep using a mapping that is no
+// longer allowed, so every VP has to flush.
+//
+typedef enum _SHV_EPT_FLUSH
+{
+	ShvEptFlushNone,
+	ShvEptFlushLocal,
+	ShvEptFlushGlobal,
+} SHV_EPT_FLUSH, *PSHV_EPT_FLUSH;
+
+//
+// A walk cursor remembers the table it last used at each level of the
+// hierarchy, along with the first address that table maps.  Table[level]
+// is NULL if the cursor doesn't hold a table at that level yet.  Node is
+// where the tables it installs come from, which is wherever the root is.
+//
+typedef struct _SHV_EPT_CURSOR
+{
+	PVMX_EPT_ENTRY Table[VMX_EPT_PAGE_WALK_LENGTH + 1];
+	ULONG64 Base[VMX_EPT_PAGE_WALK_LENGTH + 1];
+	ULONG Node;
+} SHV_EPT_CURSOR, *PSHV_EPT_CURSOR;
+
+//
+// A physically contiguous chunk of pre-zeroed pages that EPT tables are
+// carved out of.  Used counts the pages handed out so far, and References
+// holds, for each page, the number of entries that point at it as a table.
+// Tables are only shared by more than one entry when EPT views share them.
+// Node is the NUMA node the chunk was allocated on, or MM_ANY_NODE_OK if
+// it could come from anywhere.
+//
+typedef struct _SHV_EPT_ARENA_CHUNK
+{
+	PUCHAR Base;
+	ULONG64 BasePfn;
+	ULONG Pages;
+	ULONG Node;
+	volatile LONG Used;
+	volatile LONG *References;
+} SHV_EPT_ARENA_CHUNK, *PSHV_EPT_ARENA_CHUNK;
+
+//
+// A range of physical memory [Start, End) that the identity map covers.
+//
+typedef struct _SHV_EPT_IDENTITY_RANGE
+{
+	ULONG64 Start;
+	ULONG64 End;
+} SHV_EPT_IDENTITY_RANGE, *PSHV_EPT_IDENTITY_RANGE;
+
+//
+// The state of a parallel identity map build, shared by every LP.
+//
+typedef struct _SHV_EPT_BUILD
+{
+	PSHV_EPT_IDENTITY_RANGE Ranges;
+	ULONG Count;
+	ULONG SliceCount;
+	volatile LONG NextSlice;
+	volatile LONG Status;
+} SHV_EPT_BUILD, *PSHV_EPT_BUILD;
+
+//
+// A slot of the ring of regions mapped on demand.  Sequence is one more
+// than the number of the fault that filled the slot, zero before any did,
+// and SHV_EPT_REGION_BUSY while a fault is filling it.
+//
+typedef struct _SHV_EPT_REGION_SLOT
+{
+	volatile LONG64 Sequence;
+	SHV_EPT_REGION Region;
+} SHV_EPT_REGION_SLOT, *PSHV_EPT_REGION_SLOT;
+
+//
+// A table that was unlinked from the hierarchy, and the EPT generation
+// every VP has to reach before it can be reused.
+//
+typedef struct _SHV_EPT_RETIRED_TABLE
+{
+	PVMX_EPT_ENTRY volatile Table;
+	ULONG64 Generation;
+} SHV_EPT_RETIRED_TABLE, *PSHV_EPT_RETIRED_TABLE;
+
+//
+// All EPT tables come from the arena, which makes PFN to VA translation
+// an index lookup and an offset, and lets the whole hierarchy be freed in
+// bulk.  Tables
+// that lost an installation race go on a free list to be reused, and so
+// do retired tables once no VP can reach them anymore.  There is a free
+// list for each node, so a table keeps coming from the node its chunk is
+// on, and a last one for chunks that weren't allocated on any node.
 //
-#define SHV_EPT_VIOLATION_ENTRY_MISS(vr) ((vr & (7 << 3)) == 0)
+typedef struct _SHV_EPT_ARENA
+{
+	SLIST_HEADER FreeLists[SHV_EPT_MAX_NODES + 1];
+	volatile ULONG ChunkCount;
+	volatile LONG Exhausted;
+	volatile LONG RetiredCount;
+	ULONG IndexCount;
+	SHV_EPT_ARENA_CHUNK Chunks[SHV_EPT_ARENA_MAX_CHUNKS];
+	SHV_EPT_RETIRED_TABLE Retired[SHV_EPT_RETIRED_TABLES];
+	volatile ULONG64 PhysicalIndex[SHV_EPT_ARENA_INDEX_SIZE];
+	volatile ULONG64 VirtualIndex[SHV_EPT_ARENA_INDEX_SIZE];
+} SHV_EPT_ARENA, *PSHV_EPT_ARENA;
 
 // ===========================================================================
 //
@@ -61,6 +307,9 @@ Environment:
 // ===========================================================================
 
 VMX_EPT_EPTP ShvVmxEptEptp = { 0 };
+BOOLEAN ShvVmxEptVmfuncEnabled = FALSE;
+BOOLEAN ShvVmxEptVeEnabled = FALSE;
+BOOLEAN ShvVmxEptNmiExiting = FALSE;
 
 // ===========================================================================
 //
@@ -69,7 +318,100 @@ VMX_EPT_EPTP ShvVmxEptEptp = { 0 };
 // ===========================================================================
 
 static PVMX_EPT_ENTRY ShvVmxEptPML4 = NULL;
-static KSPIN_LOCK ShvVmxEptPML4Lock = { 0 };
+static ULONG64 ShvVmxEptCapabilities = 0;
+static SHV_EPT_ARENA ShvVmxEptArena = { 0 };
+
+//
+// Serializes growing the arena.  Chunks are allocated outside of it, and
+// only claiming a slot and indexing the chunk happen under it.
+//
+static KSPIN_LOCK ShvVmxEptArenaLock = 0;
+
+//
+// Bumped whenever the shared EPT changes in a way that every VP has to
+// flush.  Each VP flushes when the generation it last flushed at is older.
+//
+static volatile LONG64 ShvVmxEptGeneration = 1;
+
+//
+// The newest generation that every VP is known to have flushed at, as
+// recorded by the last shootdown to complete.  This lets retired tables be
+// reclaimed even when some VP hasn't exited since, e.g. because it idles.
+//
+static volatile LONG64 ShvVmxEptFlushedGeneration = 0;
+
+//
+// Set while something needs every page mapped at 4 KiB, e.g. PML, which
+// only logs the first write to a page.  New leaves are then never large
+// and nothing is collapsed into a large page.
+//
+static BOOLEAN ShvVmxEptSmallPages = FALSE;
+static BOOLEAN ShvVmxEptDemandPopulate = SHV_EPT_DEMAND_POPULATE;
+
+//
+// The value of an entry that maps nothing.  Once #VE delivery is on, even
+// those have to suppress it, or touching unmapped MMIO would raise a #VE
+// instead of being mapped on demand.
+//
+static BOOLEAN ShvVmxEptVeRequested = SHV_EPT_VIRTUALIZATION_EXCEPTIONS;
+static ULONG64 ShvVmxEptEmpty = 0;
+
+static BOOLEAN ShvVmxEptWarmStart = SHV_EPT_WARM_START;
+
+//
+// The working set scanner, and the results of its last sweep.
+//
+static BOOLEAN ShvVmxEptTrackWorkingSet = SHV_EPT_TRACK_WORKING_SET;
+static BOOLEAN ShvVmxEptWorkingSetRunning = FALSE;
+static KTIMER ShvVmxEptWorkingSetTimer = { 0 };
+static KDPC ShvVmxEptWorkingSetTimerDpc = { 0 };
+static KSPIN_LOCK ShvVmxEptWorkingSetLock = { 0 };
+static SHV_EPT_WORKING_SET ShvVmxEptWorkingSet = { 0 };
+
+//
+// The EPT views, and the EPTP list that lets the guest switch between them
+// with VMFUNC.  View 0 is ShvVmxEptPML4, and the views share every table
+// none of them changed.  Views are only created and changed outside of
+// root mode, under the lock.
+//
+static PVMX_EPT_ENTRY ShvVmxEptViews[SHV_EPT_MAX_VIEWS] = { 0 };
+static volatile ULONG ShvVmxEptViewCount = 0;
+static PVMX_EPT_EPTP ShvVmxEptEptpList = NULL;
+static KSPIN_LOCK ShvVmxEptViewLock = 0;
+
+//
+// The replicas of the default view, and the one each node uses.  Nodes
+// without a replica use ShvVmxEptPML4.  Roots holds every copy of the
+// default view, ShvVmxEptPML4 first, since the identity map has to change
+// in all of them alike.
+//
+static BOOLEAN ShvVmxEptReplicate = SHV_EPT_NUMA_REPLICATION;
+static PVMX_EPT_ENTRY ShvVmxEptNodeRoots[SHV_EPT_MAX_NODES] = { 0 };
+static PVMX_EPT_ENTRY ShvVmxEptRoots[SHV_EPT_MAX_NODES + 1] = { 0 };
+static ULONG ShvVmxEptRootCount = 0;
+
+//
+// Whoever protected memory in the default view, and gets the violations
+// the protection causes.  Root mode reads the slots without a lock.
+//
+static PSHV_EPT_VIOLATION_HANDLER volatile ShvVmxEptHandlers[SHV_EPT_MAX_HANDLERS] = { 0 };
+
+//
+// How much was mapped on demand by the violation handler since load, and
+// the most recent regions it mapped.
+//
+static volatile LONG64 ShvVmxEptOnDemandFaults = 0;
+static volatile LONG64 ShvVmxEptOnDemandBytes = 0;
+static SHV_EPT_REGION_SLOT ShvVmxEptOnDemandRegions[SHV_EPT_INSPECT_REGIONS] = { 0 };
+
+//
+// What root mode uses to make the other VPs flush without leaving it: an
+// NMI, which forces a VM exit once NMI exiting is on.  The xAPIC registers
+// are only mapped when the APIC isn't in x2APIC mode.
+//
+static PVOID ShvVmxEptNmiCallbackHandle = NULL;
+static PUCHAR ShvVmxEptApic = NULL;
+static ULONG ShvVmxEptProcessorCount = 0;
 
 // ===========================================================================
 //
@@ -87,487 +429,5092 @@ ShvVmxEptGetPfnFromVirtual(
 	PVOID Va
 );
 
-static NTSTATUS
-_ShvVmxEptPopulateIdentityTable(
-	PVMX_EPT_ENTRY table,
-	ULONG level,
-	PHYSICAL_ADDRESS address
+static ULONG
+ShvVmxEptGetTableNode(
+	PVMX_EPT_ENTRY table
 );
 
-static NTSTATUS
-ShvVmxIdentityMapPage(
-	PHYSICAL_ADDRESS address
+static PSHV_EPT_ARENA_CHUNK
+ShvVmxEptFindChunkByPfn(
+	ULONG64 Pfn
 );
 
-static NTSTATUS
-ShvVmxEptBuildIdentityTables(
-	VOID
+static PSHV_EPT_ARENA_CHUNK
+ShvVmxEptFindChunkByVa(
+	PVOID Va
+);
+
+static ULONG64
+ShvVmxEptArenaIndexFind(
+	volatile ULONG64 *Index,
+	ULONG64 Frame
 );
 
 static VOID
-ShvVmxEptInvalidateEpt(
+ShvVmxEptArenaIndexInsert(
+	volatile ULONG64 *Index,
+	ULONG64 First,
+	ULONG64 Last,
+	ULONG Chunk
+);
+
+static ULONG
+ShvVmxEptArenaEstimate(
 	VOID
 );
 
-// ===========================================================================
-//
-// PUBLIC FUNCTIONS
-//
-// ===========================================================================
+static NTSTATUS
+ShvVmxEptArenaGrow(
+	ULONG pages,
+	ULONG node
+);
 
-BOOLEAN
-ShvVmxEptProbe(
+static VOID
+ShvVmxEptArenaFree(
 	VOID
-)
-{
-	INT64 control;
+);
 
-	//
-	// Verify that secondary processor-based VM-execution
-	// controls are used.
-	//
-	control = __readmsr(MSR_IA32_VMX_PROCBASED_CTLS);
+static PVMX_EPT_ENTRY
+ShvVmxEptAllocateTable(
+	ULONG node
+);
 
-	if (_bittest64(&control, 32 + 31) == 0)
-	{
-		return FALSE;
-	}
+static VOID
+ShvVmxEptFreeTable(
+	PVMX_EPT_ENTRY table
+);
 
-	//
-	// Verify that EPT can be enabled.
-	//
-	control = __readmsr(MSR_IA32_VMX_PROCBASED_CTLS2);
+static volatile LONG *
+ShvVmxEptGetReferences(
+	PVMX_EPT_ENTRY table
+);
 
-	if (_bittest64(&control, 32 + 1) == 0)
-	{
-		return FALSE;
-	}
+static BOOLEAN
+ShvVmxEptReferenceTable(
+	PVMX_EPT_ENTRY table
+);
 
-	return TRUE;
-}
+static VOID
+ShvVmxEptReleaseTable(
+	PVMX_EPT_ENTRY table
+);
 
-NTSTATUS
-ShvVmxEptInitialize(
-	VOID
-)
-{
-	NTSTATUS ret;
+static ULONG64
+ShvVmxEptMakeLeaf(
+	ULONG level,
+	ULONG64 address,
+	ULONG access,
+	UCHAR type
+);
 
-	//
-	// Allocate memory to hold the EPT PML4 table.
-	//
-	ShvVmxEptPML4 = (PVMX_EPT_ENTRY)ExAllocatePoolWithTag(NonPagedPoolNx, PAGE_SIZE, 'EPT ');
-	if (ShvVmxEptPML4 == NULL) {
-		return STATUS_HV_NO_RESOURCES;
-	}
+static ULONG
+ShvVmxEptLeafLevel(
+	ULONG64 address,
+	ULONG64 end
+);
 
-	//
-	// Zero the PML4 table.
-	//
-	__stosq((PUINT64)ShvVmxEptPML4, 0, PAGE_SIZE / sizeof(ULONG64));
+static VOID
+ShvVmxEptCursorInitialize(
+	PSHV_EPT_CURSOR cursor,
+	PVMX_EPT_ENTRY root
+);
 
-	//
-	// Initialize the lock.
-	//
-	KeInitializeSpinLock(&ShvVmxEptPML4Lock);
+static NTSTATUS
+ShvVmxEptCursorWalk(
+	PSHV_EPT_CURSOR cursor,
+	ULONG64 address,
+	PULONG level,
+	PVMX_EPT_ENTRY *entry
+);
 
-	//
-	// Build the EPT identity table by creating an entry for
-	// each physical address page on the system.
-	//
-	ret = ShvVmxEptBuildIdentityTables();
-	if (ret != STATUS_SUCCESS)
-	{
-		ShvVmxEptCleanup();
-		return ret;
-	}
+static NTSTATUS
+_ShvVmxEptMapRange(
+	PSHV_EPT_CURSOR cursor,
+	ULONG64 start,
+	ULONG64 end,
+	ULONG access,
+	UCHAR type,
+	PSHV_EPT_FLUSH flush
+);
 
-	//
-	// Initialize the EPTP by setting the PFN of the top-level
-	// EPT table as well as the number of page table levels - 1.
-	//
-	ShvVmxEptEptp.PFN = ShvVmxEptGetPfnFromVirtual(ShvVmxEptPML4);
-	ShvVmxEptEptp.PW = VMX_EPT_PAGE_WALK_LENGTH - 1;
-	ShvVmxEptEptp.MT = WriteBack;
+static NTSTATUS
+ShvVmxEptMapRootRange(
+	PVMX_EPT_ENTRY root,
+	ULONG64 start,
+	ULONG64 end,
+	ULONG access,
+	UCHAR type
+);
 
-	return STATUS_SUCCESS;
-}
+static NTSTATUS
+ShvVmxEptIdentityMapRange(
+	PVMX_EPT_ENTRY root,
+	ULONG64 start,
+	ULONG64 end,
+	BOOLEAN grow
+);
 
-VOID
-ShvVmxEptCleanup(
+static NTSTATUS
+ShvVmxEptIdentityMapRoots(
+	ULONG64 start,
+	ULONG64 end,
+	BOOLEAN grow
+);
+
+static ULONG64
+ShvVmxEptFaultAroundBase(
+	ULONG64 address,
+	PULONG64 end
+);
+
+static VOID
+_ShvVmxEptTryPromote(
+	PVMX_EPT_ENTRY root,
+	ULONG64 address,
+	ULONG level
+);
+
+static VOID
+ShvVmxEptTryPromote(
+	ULONG64 address
+);
+
+static VOID
+ShvVmxEptMergeRange(
+	PVMX_EPT_ENTRY root,
+	ULONG64 start,
+	ULONG64 end
+);
+
+static BOOLEAN
+ShvVmxEptDispatchViolation(
+	PSHV_VP_STATE VpState,
+	ULONG64 gpa,
+	ULONG access
+);
+
+static VOID
+ShvVmxEptRetireTable(
+	PVMX_EPT_ENTRY table
+);
+
+static VOID
+ShvVmxEptReclaimTables(
 	VOID
-)
-{
-	KeAcquireSpinLockAtDpcLevel(&ShvVmxEptPML4Lock);
+);
 
-	if (ShvVmxEptPML4 == NULL)
-	{
-		//
-		// Nothing to do here.
-		//
-		KeReleaseSpinLockFromDpcLevel(&ShvVmxEptPML4Lock);
-		return;
-	}
+static NTSTATUS
+ShvVmxEptCollectIdentityRanges(
+	PSHV_EPT_BUILD build
+);
+
+static VOID
+ShvVmxEptBuildSlices(
+	PSHV_EPT_BUILD build
+);
+
+KDEFERRED_ROUTINE ShvVmxEptBuildDpc;
+
+static NTSTATUS
+ShvVmxEptBuildIdentityTables(
+	VOID
+);
+
+static VOID
+ShvVmxEptInvalidateEpt(
+	VOID
+);
+
+static SHV_EPT_FLUSH
+ShvVmxEptClassifyChange(
+	VMX_EPT_ENTRY old,
+	VMX_EPT_ENTRY new,
+	ULONG level
+);
+
+static VOID
+ShvVmxEptCommitChange(
+	SHV_EPT_FLUSH flush
+);
+
+static VMX_EPT_ENTRY
+ShvVmxEptLookup(
+	PVMX_EPT_ENTRY root,
+	ULONG64 address,
+	PULONG level,
+	PVMX_EPT_ENTRY *location
+);
+
+static BOOLEAN
+ShvVmxEptVmfuncSupported(
+	VOID
+);
+
+static PVMX_EPT_ENTRY
+ShvVmxEptAllocateViewTable(
+	ULONG node
+);
+
+static PVMX_EPT_ENTRY
+ShvVmxEptCopyTable(
+	PVMX_EPT_ENTRY table,
+	ULONG level
+);
+
+static PVMX_EPT_ENTRY
+ShvVmxEptReplicateTable(
+	PVMX_EPT_ENTRY table,
+	ULONG level,
+	ULONG node
+);
+
+static VOID
+ShvVmxEptBuildReplicas(
+	VOID
+);
+
+static BOOLEAN
+ShvVmxEptIsDefaultRoot(
+	PVMX_EPT_ENTRY root
+);
+
+static VMX_EPT_EPTP
+ShvVmxEptGetDefaultEptp(
+	VOID
+);
+
+static BOOLEAN
+ShvVmxEptVeSupported(
+	VOID
+);
+
+static NTSTATUS
+ShvVmxEptUpdateRootRange(
+	PVMX_EPT_ENTRY root,
+	ULONG64 start,
+	ULONG64 end,
+	ULONG64 clear,
+	ULONG64 set,
+	PSHV_EPT_FLUSH flush
+);
+
+static ULONG64
+ShvVmxEptMakeChild(
+	VMX_EPT_ENTRY value,
+	ULONG level,
+	ULONG index
+);
+
+static NTSTATUS
+ShvVmxEptCheckPageProtection(
+	const SHV_EPT_REGION *regions,
+	ULONG count,
+	ULONG clear,
+	ULONG set
+);
+
+static VOID
+ShvVmxEptFillSplitTable(
+	PVMX_EPT_ENTRY table,
+	VMX_EPT_ENTRY value,
+	ULONG level
+);
+
+static NTSTATUS
+ShvVmxEptSplitTable(
+	PVMX_EPT_ENTRY table,
+	ULONG level,
+	ULONG64 base,
+	ULONG node,
+	PSHV_EPT_FLUSH flush
+);
+
+static VOID
+ShvVmxEptClearDirtyTable(
+	PVMX_EPT_ENTRY table,
+	ULONG level
+);
+
+static ULONG_PTR
+ShvVmxEptShootdownWorker(
+	ULONG_PTR Argument
+);
+
+static ULONG
+ShvVmxEptReadApicId(
+	VOID
+);
+
+static VOID
+ShvVmxEptSendNmi(
+	ULONG apicId
+);
+
+NMI_CALLBACK ShvVmxEptNmiCallback;
+
+SHV_EPT_TRANSLATE ShvVmxEptTranslatePfn;
+
+static ULONG64
+ShvVmxEptMemoryMapHash(
+	VOID
+);
+
+SHV_EPT_IMAGE_MAP ShvVmxEptImageMapRun;
+
+static NTSTATUS
+ShvVmxEptLoadImage(
+	ULONG64 hash
+);
+
+static NTSTATUS
+ShvVmxEptSaveImage(
+	ULONG64 hash
+);
+
+static NTSTATUS
+ShvVmxEptWarmBuild(
+	VOID
+);
+
+static ULONG
+ShvVmxEptWorkingSetBucket(
+	ULONG pages
+);
+
+static VOID
+ShvVmxEptScanPt(
+	PVMX_EPT_ENTRY pt,
+	PSHV_EPT_WORKING_SET workingSet
+);
+
+static VOID
+ShvVmxEptScanTable(
+	PVMX_EPT_ENTRY table,
+	ULONG level,
+	PSHV_EPT_WORKING_SET workingSet
+);
+
+KDEFERRED_ROUTINE ShvVmxEptWorkingSetDpc;
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+BOOLEAN
+ShvVmxEptProbe(
+	VOID
+)
+{
+	INT64 control;
+
+	//
+	// Verify that secondary processor-based VM-execution
+	// controls are used.
+	//
+	control = __readmsr(MSR_IA32_VMX_PROCBASED_CTLS);
+
+	if (_bittest64(&control, 32 + 31) == 0)
+	{
+		return FALSE;
+	}
+
+	//
+	// Verify that EPT can be enabled.
+	//
+	control = __readmsr(MSR_IA32_VMX_PROCBASED_CTLS2);
+
+	if (_bittest64(&control, 32 + 1) == 0)
+	{
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
+NTSTATUS
+ShvVmxEptInitialize(
+	VOID
+)
+{
+	NTSTATUS ret;
+
+	//
+	// Initialize the lock that serializes growing the arena, and the lists
+	// that let tables be reused.
+	//
+	KeInitializeSpinLock(&ShvVmxEptArenaLock);
+
+	for (ULONG i = 0; i <= SHV_EPT_MAX_NODES; i++)
+	{
+		InitializeSListHead(&ShvVmxEptArena.FreeLists[i]);
+	}
+
+	//
+	// Capture the EPT capabilities of the processor, which tell us whether
+	// 2 MiB and 1 GiB large pages can be used for the identity map.
+	//
+	ShvVmxEptCapabilities = __readmsr(MSR_IA32_VMX_EPT_VPID_CAP);
+
+	//
+	// Whether #VE delivery is on decides what an empty entry looks like, so
+	// it has to be settled before the first table is handed out.
+	//
+	if (ShvVmxEptVeRequested && ShvVmxEptVeSupported())
+	{
+		ShvVmxEptVeEnabled = TRUE;
+		ShvVmxEptEmpty = VMX_EPT_SUPPRESS_VE;
+	}
+
+	//
+	// Reserve the arena the tables are carved from, sized from the physical
+	// memory map.  It grows later if the estimate turns out to be short.
+	//
+	ret = ShvVmxEptArenaGrow(ShvVmxEptArenaEstimate(), MM_ANY_NODE_OK);
+	if (ret != STATUS_SUCCESS)
+	{
+		return ret;
+	}
+
+	//
+	// Allocate a zeroed page to hold the EPT PML4 table.
+	//
+	ShvVmxEptPML4 = ShvVmxEptAllocateTable(MM_ANY_NODE_OK);
+	if (ShvVmxEptPML4 == NULL) {
+		ShvVmxEptArenaFree();
+		return STATUS_HV_NO_RESOURCES;
+	}
+
+	//
+	// Compile the MTRRs so that each leaf gets the memory type the firmware
+	// configured for it.  If that fails, every leaf falls back to WB.
+	//
+	ret = ShvMtrrInitialize();
+	if (ret != STATUS_SUCCESS)
+	{
+		SHV_DEBUG_PRINT("MTRR compilation failed: %x\n", ret);
+	}
+
+	//
+	// Build the EPT identity table by creating an entry for
+	// each physical address page on the system, or just map the seed if
+	// the rest is populated on demand.
+	//
+	if (ShvVmxEptDemandPopulate)
+	{
+		ret = ShvVmxEptIdentityMapRange(ShvVmxEptPML4, 0, SHV_EPT_DEMAND_SEED_END, TRUE);
+	}
+	else if (ShvVmxEptWarmStart)
+	{
+		ret = ShvVmxEptWarmBuild();
+	}
+	else
+	{
+		ret = ShvVmxEptBuildIdentityTables();
+	}
+
+	if (ret != STATUS_SUCCESS)
+	{
+		ShvVmxEptCleanup();
+		return ret;
+	}
+
+	//
+	// Initialize the EPTP by setting the PFN of the top-level
+	// EPT table as well as the number of page table levels - 1.
+	//
+	ShvVmxEptEptp.PFN = ShvVmxEptGetPfnFromVirtual(ShvVmxEptPML4);
+	ShvVmxEptEptp.PW = VMX_EPT_PAGE_WALK_LENGTH - 1;
+	ShvVmxEptEptp.MT = WriteBack;
+
+	//
+	// If asked to, give each node a replica of the identity map to walk.
+	//
+	ShvVmxEptRoots[0] = ShvVmxEptPML4;
+	ShvVmxEptRootCount = 1;
+
+	if (ShvVmxEptReplicate)
+	{
+		ShvVmxEptBuildReplicas();
+	}
+
+	//
+	// The identity map is the default view.  If the processor can switch
+	// EPTPs with VMFUNC, allocate the EPTP list that the other views go in.
+	// Without it, or with replicas, there is only ever the default view.
+	//
+	KeInitializeSpinLock(&ShvVmxEptViewLock);
+	ShvVmxEptViews[SHV_EPT_DEFAULT_VIEW] = ShvVmxEptPML4;
+	ShvVmxEptViewCount = 1;
+
+	if (ShvVmxEptRootCount == 1 && ShvVmxEptVmfuncSupported())
+	{
+		ShvVmxEptEptpList = (PVMX_EPT_EPTP)ShvUtilAllocateContiguousMemory(PAGE_SIZE);
+		if (ShvVmxEptEptpList != NULL)
+		{
+			__stosq((PULONG64)ShvVmxEptEptpList, 0, PAGE_SIZE / sizeof(ULONG64));
+			ShvVmxEptEptpList[SHV_EPT_DEFAULT_VIEW] = ShvVmxEptEptp;
+			ShvVmxEptVmfuncEnabled = TRUE;
+		}
+	}
+
+	//
+	// If asked to, have the processor set the accessed and dirty flags and
+	// start sweeping them periodically.
+	//
+	if (ShvVmxEptTrackWorkingSet && ShvVmxEptEnableAccessDirty())
+	{
+		LARGE_INTEGER dueTime;
+
+		KeInitializeSpinLock(&ShvVmxEptWorkingSetLock);
+		KeInitializeDpc(&ShvVmxEptWorkingSetTimerDpc, ShvVmxEptWorkingSetDpc, NULL);
+		KeInitializeTimer(&ShvVmxEptWorkingSetTimer);
+
+		dueTime.QuadPart = -(LONGLONG)SHV_EPT_WS_SCAN_PERIOD * 10000;
+		KeSetTimerEx(&ShvVmxEptWorkingSetTimer, dueTime, SHV_EPT_WS_SCAN_PERIOD, &ShvVmxEptWorkingSetTimerDpc);
+
+		ShvVmxEptWorkingSetRunning = TRUE;
+	}
+
+	return STATUS_SUCCESS;
+}
+
+VOID
+ShvVmxEptCleanup(
+	VOID
+)
+{
+	if (ShvVmxEptPML4 == NULL)
+	{
+		//
+		// Nothing to do here.
+		//
+		return;
+	}
+
+	//
+	// Stop the working set scanner and wait for a sweep in progress to
+	// finish before the tables go away.
+	//
+	if (ShvVmxEptWorkingSetRunning)
+	{
+		KeCancelTimer(&ShvVmxEptWorkingSetTimer);
+		KeFlushQueuedDpcs();
+		ShvVmxEptWorkingSetRunning = FALSE;
+	}
+
+	if (ShvVmxEptEptpList != NULL)
+	{
+		MmFreeContiguousMemory(ShvVmxEptEptpList);
+		ShvVmxEptEptpList = NULL;
+	}
+
+	if (ShvVmxEptNmiCallbackHandle != NULL)
+	{
+		KeDeregisterNmiCallback(ShvVmxEptNmiCallbackHandle);
+		ShvVmxEptNmiCallbackHandle = NULL;
+	}
+
+	if (ShvVmxEptApic != NULL)
+	{
+		MmUnmapIoSpace(ShvVmxEptApic, PAGE_SIZE);
+		ShvVmxEptApic = NULL;
+	}
+
+	ShvVmxEptNmiExiting = FALSE;
+	ShvVmxEptVmfuncEnabled = FALSE;
+	ShvVmxEptVeEnabled = FALSE;
+	ShvVmxEptSmallPages = FALSE;
+	ShvVmxEptEmpty = 0;
+	ShvVmxEptViewCount = 0;
+	__stosq((PULONG64)ShvVmxEptViews, 0, SHV_EPT_MAX_VIEWS);
+	ShvVmxEptRootCount = 0;
+	__stosq((PULONG64)ShvVmxEptRoots, 0, SHV_EPT_MAX_NODES + 1);
+	__stosq((PULONG64)ShvVmxEptNodeRoots, 0, SHV_EPT_MAX_NODES);
+
+	//
+	// This only runs once every LP has left root mode, so nothing else can
+	// be touching the tables.  Every table was carved out of the arena, so
+	// freeing the arena frees the whole hierarchy at once.
+	//
+	ShvVmxEptArenaFree();
+	ShvVmxEptPML4 = NULL;
+}
+
+VOID
+ShvVmxEptHandleViolation(
+	_In_ PSHV_VP_STATE VpState
+)
+{
+	PHYSICAL_ADDRESS gpa;
+	PVMX_EPT_ENTRY root;
+	VMX_EPT_ENTRY entry;
+	VMX_EPT_EPTP eptp;
+	ULONG64 size;
+	ULONG level;
+	SIZE_T eq;
+
+	//
+	// Read guest physical address that caused the violation.
+	//
+	__vmx_vmread(GUEST_PHYSICAL_ADDRESS, (PSIZE_T)&gpa.QuadPart);
+
+	//
+	// Read the exit qualification
+	//
+	__vmx_vmread(EXIT_QUALIFICATION, &eq);
+
+	SHV_DEBUG_PRINT("[%u] GPA: %llx Exit Qualification %llx\n",
+		KeGetCurrentProcessorNumberEx(NULL),
+		gpa.QuadPart,
+		eq
+	);
+
+	//
+	// Find the view the VP was in.  VMFUNC switches the EPTP in the VMCS, so
+	// the current one always tells.
+	//
+	__vmx_vmread(EPT_POINTER, (PSIZE_T)&eptp.QuadPart);
+	root = (PVMX_EPT_ENTRY)ShvVmxEptGetVirtualFromPfn(eptp.PFN);
+
+	entry = ShvVmxEptLookup(root, gpa.QuadPart, &level, NULL);
+
+	//
+	// Check to see if the violation was caused because there was no EPT
+	// entry present.  This could happen, because we didn't identity map
+	// the hardware MMIO mappings.
+	//
+	if (entry.QuadPart == ShvVmxEptEmpty) {
+		ULONG64 base, end, ramEnd;
+		NTSTATUS ret;
+
+		//
+		// Map the whole aligned region around the GPA rather than just its
+		// page, since the guest is likely to touch the rest of it soon.
+		// Memory types still come from the MTRRs.
+		//
+		base = ShvVmxEptFaultAroundBase(gpa.QuadPart, &end);
+
+		//
+		// RAM is mapped in bulk instead, through to the end of the RAM
+		// range or of its 1 GiB region, whichever comes first.  This is
+		// what keeps RAM that was hot-added before we were told about it
+		// from faulting in 2 MiB at a time.
+		//
+		if (ShvMemMapLookup(gpa.QuadPart, &ramEnd) == ShvMemoryRam)
+		{
+			end = max(end, min((gpa.QuadPart | (VMX_EPT_PAGE_SIZE_1GB - 1)) + 1, ramEnd));
+		}
+
+		//
+		// A miss in the default view has to be mapped in every replica of
+		// it too, or VPs on other nodes would take the same violation.
+		//
+		if (ShvVmxEptIsDefaultRoot(root))
+		{
+			ret = ShvVmxEptIdentityMapRoots(base, end, FALSE);
+		}
+		else
+		{
+			ret = ShvVmxEptIdentityMapRange(root, base, end, FALSE);
+		}
+
+		if (ret != STATUS_SUCCESS)
+		{
+			//
+			// The arena can't grow in root mode.  Report the failure rather
+			// than bringing the machine down; the guest will fault on the
+			// same address again.
+			//
+			SHV_DEBUG_PRINT("[%u] GPA %llx could not be mapped: %x (arena exhausted %d times)\n",
+				KeGetCurrentProcessorNumberEx(NULL),
+				gpa.QuadPart,
+				ret,
+				ShvVmxEptArena.Exhausted
+			);
+			return;
+		}
+
+		//
+		// Keep track of what was mapped on demand.  Only the most recent
+		// regions are kept.  A slot is claimed before it is filled and its
+		// sequence is published last, so the inspector never reports half
+		// of one fault and half of another.  If another fault holds the
+		// slot, or already put a newer region in it, this one is only
+		// counted.
+		//
+		{
+			PSHV_EPT_REGION_SLOT slot;
+			LONG64 fault, sequence;
+
+			fault = InterlockedIncrement64(&ShvVmxEptOnDemandFaults) - 1;
+			InterlockedAdd64(&ShvVmxEptOnDemandBytes, end - base);
+
+			slot = &ShvVmxEptOnDemandRegions[fault % SHV_EPT_INSPECT_REGIONS];
+			sequence = slot->Sequence;
+
+			if ((sequence != SHV_EPT_REGION_BUSY) &&
+				(sequence <= fault) &&
+				(InterlockedCompareExchange64(&slot->Sequence, SHV_EPT_REGION_BUSY, sequence) == sequence))
+			{
+				slot->Region.Base = base;
+				slot->Region.Size = end - base;
+
+				InterlockedExchange64(&slot->Sequence, fault + 1);
+			}
+		}
+
+		//
+		// The entries went from not present to present, which processors
+		// never cache, so there is nothing to flush.  If that completed a
+		// PT of the default view that can be a single large page, collapse
+		// it.  Other views may have changed their PTs on purpose.
+		//
+		if (ShvVmxEptIsDefaultRoot(root))
+		{
+			ShvVmxEptTryPromote(gpa.QuadPart);
+		}
+
+		return;
+	}
+
+	//
+	// If the entry now allows the access, this processor was using a stale,
+	// less permissive copy of it.  Only this VP needs to flush.
+	//
+	if ((SHV_EPT_ENTRY_ACCESS(&entry) & SHV_EPT_VIOLATION_ACCESS(eq)) == SHV_EPT_VIOLATION_ACCESS(eq))
+	{
+		ShvVmxEptCommitChange(ShvEptFlushLocal);
+		return;
+	}
+
+	//
+	// Otherwise the VP is in a view that withholds the access.  Put it back
+	// in the default view, which has the whole identity map, and let the
+	// guest retry.  Its cached translations are tagged with the EPTP, so
+	// nothing has to be flushed.
+	//
+	if (!ShvVmxEptIsDefaultRoot(root))
+	{
+		ShvVmxEptSwitchView(SHV_EPT_DEFAULT_VIEW);
+		return;
+	}
+
+	//
+	// The default view itself withholds the access, which only happens
+	// when memory was protected on purpose.  Let whoever did it handle it.
+	//
+	if (ShvVmxEptDispatchViolation(VpState, gpa.QuadPart, SHV_EPT_VIOLATION_ACCESS(eq)))
+	{
+		return;
+	}
+
+	//
+	// Nobody claimed it, which means its handler went away and left the
+	// protection behind.  That is a bug in whoever protected the page, so
+	// stop right here on checked builds.
+	//
+	SHV_DEBUG_PRINT("Unclaimed EPT violation at %llx: %llx\n", gpa.QuadPart, eq);
+	NT_ASSERTMSG("Unclaimed EPT violation", FALSE);
+
+	//
+	// Otherwise put back what the identity map had, or the guest would
+	// fault on it forever, but only if the page still maps its own frame.
+	// One that maps another frame was remapped on purpose, and giving the
+	// guest access to that frame could let it write memory it doesn't own.
+	//
+	size = SHV_EPT_LEVEL_SIZE(level);
+
+	if ((SHV_PFN_TO_PHYS(entry.PFN) & ~(size - 1)) == (gpa.QuadPart & ~(size - 1)))
+	{
+		ShvVmxEptGrantAccess(gpa.QuadPart, VMX_EPT_ACCESS_RWX);
+	}
+}
+
+VOID
+ShvVmxEptSynchronize(
+	_In_ PSHV_VP_DATA VpData
+)
+{
+	LONG64 generation;
+
+	//
+	// Called on the way back into the guest.  If the shared EPT changed in
+	// a way that needs every VP to flush since this VP last did, flush now.
+	//
+	generation = ShvVmxEptGeneration;
+
+	if (VpData->EptGeneration != (ULONG64)generation)
+	{
+		ShvVmxEptInvalidateEpt();
+		VpData->EptGeneration = generation;
+	}
+}
+
+VOID
+ShvVmxEptShootdown(
+	VOID
+)
+{
+	//
+	// Make every VP flush before this returns, which is what a reduction in
+	// permissions needs to take effect everywhere.  Bumping the generation
+	// makes each VP flush on its next VM exit, and the IPI forces that exit
+	// right away on every LP, including this one.
+	//
+	LONG64 generation;
+	LONG64 flushed;
+
+	generation = InterlockedIncrement64(&ShvVmxEptGeneration);
+
+	KeIpiGenericCall(ShvVmxEptShootdownWorker, 0);
+
+	//
+	// Every VP has now flushed at this generation or a later one.  Record
+	// that, unless a concurrent shootdown already recorded a newer one, and
+	// use the chance to reclaim tables retired before it.
+	//
+	for (;;)
+	{
+		flushed = ShvVmxEptFlushedGeneration;
+		if (flushed >= generation ||
+			InterlockedCompareExchange64(&ShvVmxEptFlushedGeneration, generation, flushed) == flushed)
+		{
+			break;
+		}
+	}
+
+	ShvVmxEptReclaimTables();
+}
+
+BOOLEAN
+ShvVmxEptEnableAccessDirty(
+	VOID
+)
+{
+	//
+	// Have the processor set the accessed and dirty flags, if it can.  This
+	// has to happen before any VP is launched.
+	//
+	if ((ShvVmxEptCapabilities & VMX_EPT_CAP_ACCESSED_DIRTY) == 0)
+	{
+		return FALSE;
+	}
+
+	//
+	// With replicas, each node's VPs would only set the flags in their own
+	// replica, and sweeping ShvVmxEptPML4 would miss most of them.
+	//
+	if (ShvVmxEptRootCount > 1)
+	{
+		return FALSE;
+	}
+
+	ShvVmxEptEptp.ADE = 1;
+
+	return TRUE;
+}
+
+ULONG64
+ShvVmxEptGetPageSize(
+	_In_ ULONG64 Gpa
+)
+{
+	VMX_EPT_ENTRY entry;
+	ULONG level;
+
+	//
+	// Return the size of the page that maps the GPA, or 0 if it isn't
+	// mapped.
+	//
+	entry = ShvVmxEptLookup(ShvVmxEptPML4, Gpa, &level, NULL);
+	if (entry.QuadPart == ShvVmxEptEmpty)
+	{
+		return 0;
+	}
+
+	return SHV_EPT_LEVEL_SIZE(level);
+}
+
+ULONG
+ShvVmxEptGetAccess(
+	_In_ ULONG64 Gpa,
+	_Out_opt_ PULONG64 Hpa
+)
+{
+	VMX_EPT_ENTRY entry;
+	ULONG64 size;
+	ULONG level;
+
+	//
+	// Return the permissions the default view gives the GPA, and the host
+	// physical address it maps to, or 0 if it isn't mapped.
+	//
+	entry = ShvVmxEptLookup(ShvVmxEptPML4, Gpa, &level, NULL);
+	if (entry.QuadPart == ShvVmxEptEmpty)
+	{
+		return 0;
+	}
+
+	if (Hpa != NULL)
+	{
+		size = SHV_EPT_LEVEL_SIZE(level);
+		*Hpa = (SHV_PFN_TO_PHYS(entry.PFN) & ~(size - 1)) | (Gpa & (size - 1));
+	}
+
+	return SHV_EPT_ENTRY_ACCESS(&entry);
+}
+
+VOID
+ShvVmxEptClearDirtyPages(
+	_In_ ULONG64 Base,
+	_In_reads_(VMX_EPT_PAGE_SIZE_2MB / PAGE_SIZE / 64) const ULONG64 *Pages
+)
+{
+	PVMX_EPT_ENTRY root, location;
+	VMX_EPT_ENTRY entry;
+	KIRQL oldIrql;
+	ULONG level;
+	ULONG index;
+	ULONG64 bits;
+
+	NT_ASSERT((Base & (VMX_EPT_PAGE_SIZE_2MB - 1)) == 0);
+
+	//
+	// Clear the dirty flags of the pages of a 2 MiB region that are set in
+	// the bitmap, in every copy of the default view and every view, with a
+	// single walk down to the region's PT in each.  The processor sets the
+	// flags with an atomic update, so clear them the same way.  Processors
+	// may still have the pages cached as dirty until the next flush.
+	//
+	KeAcquireSpinLock(&ShvVmxEptViewLock, &oldIrql);
+
+	for (ULONG r = 0; r < ShvVmxEptRootCount + ShvVmxEptViewCount - 1; r++)
+	{
+		root = (r < ShvVmxEptRootCount) ? ShvVmxEptRoots[r] : ShvVmxEptViews[r - ShvVmxEptRootCount + 1];
+
+		entry = ShvVmxEptLookup(root, Base, &level, &location);
+		if (entry.QuadPart == ShvVmxEptEmpty)
+		{
+			continue;
+		}
+
+		if (level != 1)
+		{
+			if (entry.QuadPart & VMX_EPT_DIRTY)
+			{
+				InterlockedAnd64((volatile LONG64 *)&location->QuadPart, ~(LONG64)VMX_EPT_DIRTY);
+			}
+
+			continue;
+		}
+
+		for (ULONG j = 0; j < VMX_EPT_PAGE_SIZE_2MB / PAGE_SIZE / 64; j++)
+		{
+			bits = Pages[j];
+
+			while (_BitScanForward64(&index, bits))
+			{
+				bits &= bits - 1;
+
+				if (location[j * 64 + index].QuadPart & VMX_EPT_DIRTY)
+				{
+					InterlockedAnd64((volatile LONG64 *)&location[j * 64 + index].QuadPart, ~(LONG64)VMX_EPT_DIRTY);
+				}
+			}
+		}
+	}
+
+	KeReleaseSpinLock(&ShvVmxEptViewLock, oldIrql);
+}
+
+VOID
+ShvVmxEptClearAllDirty(
+	VOID
+)
+{
+	KIRQL oldIrql;
+
+	//
+	// Every copy of the default view and every view has its own flags, so
+	// clear them all.  Tables that views share are simply cleared twice.
+	//
+	KeAcquireSpinLock(&ShvVmxEptViewLock, &oldIrql);
+
+	for (ULONG r = 0; r < ShvVmxEptRootCount; r++)
+	{
+		ShvVmxEptClearDirtyTable(ShvVmxEptRoots[r], VMX_EPT_PAGE_WALK_LENGTH);
+	}
+
+	for (ULONG v = SHV_EPT_DEFAULT_VIEW + 1; v < ShvVmxEptViewCount; v++)
+	{
+		ShvVmxEptClearDirtyTable(ShvVmxEptViews[v], VMX_EPT_PAGE_WALK_LENGTH);
+	}
+
+	KeReleaseSpinLock(&ShvVmxEptViewLock, oldIrql);
+}
+
+NTSTATUS
+ShvVmxEptSplitLargePages(
+	VOID
+)
+{
+	SHV_EPT_FLUSH flush;
+	KIRQL oldIrql;
+	NTSTATUS ret;
+
+	if (ShvVmxEptPML4 == NULL)
+	{
+		return STATUS_HV_NOT_PRESENT;
+	}
+
+	//
+	// From now on leaves are only ever 4 KiB, and nothing collapses them.
+	// Then split every large page already there, in every copy of the
+	// default view and every view.  A split maps exactly the same way, so
+	// views sharing a table are fine with it being split in place.
+	//
+	ShvVmxEptSmallPages = TRUE;
+
+	flush = ShvEptFlushNone;
+	ret = STATUS_SUCCESS;
+
+	KeAcquireSpinLock(&ShvVmxEptViewLock, &oldIrql);
+
+	for (ULONG r = 0; r < ShvVmxEptRootCount && ret == STATUS_SUCCESS; r++)
+	{
+		ret = ShvVmxEptSplitTable(ShvVmxEptRoots[r],
+			VMX_EPT_PAGE_WALK_LENGTH,
+			0,
+			ShvVmxEptGetTableNode(ShvVmxEptRoots[r]),
+			&flush);
+	}
+
+	for (ULONG v = SHV_EPT_DEFAULT_VIEW + 1; v < ShvVmxEptViewCount && ret == STATUS_SUCCESS; v++)
+	{
+		ret = ShvVmxEptSplitTable(ShvVmxEptViews[v],
+			VMX_EPT_PAGE_WALK_LENGTH,
+			0,
+			ShvVmxEptGetTableNode(ShvVmxEptViews[v]),
+			&flush);
+	}
+
+	KeReleaseSpinLock(&ShvVmxEptViewLock, oldIrql);
+
+	if (flush == ShvEptFlushGlobal)
+	{
+		ShvVmxEptShootdown();
+	}
+
+	return ret;
+}
+
+VOID
+ShvVmxEptQueryWorkingSet(
+	_Out_ PSHV_EPT_WORKING_SET WorkingSet
+)
+{
+	KIRQL oldIrql;
+
+	//
+	// Return the results of the last sweep, which are all zero if working
+	// set tracking is off.
+	//
+	KeAcquireSpinLock(&ShvVmxEptWorkingSetLock, &oldIrql);
+
+	*WorkingSet = ShvVmxEptWorkingSet;
+
+	KeReleaseSpinLock(&ShvVmxEptWorkingSetLock, oldIrql);
+}
+
+NTSTATUS
+ShvVmxEptMapRange(
+	_In_ ULONG64 Gpa,
+	_In_ ULONG64 Length,
+	_In_ ULONG Access,
+	_In_ UCHAR Type
+)
+{
+	if (Length == 0)
+	{
+		return STATUS_SUCCESS;
+	}
+
+	NT_ASSERTMSG("PML4 is not allocated.", (ShvVmxEptPML4 != NULL));
+
+	for (ULONG i = 0; i < ShvVmxEptRootCount; i++)
+	{
+		NTSTATUS ret;
+
+		ret = ShvVmxEptMapRootRange(ShvVmxEptRoots[i], Gpa, Gpa + Length, Access, Type);
+		if (ret != STATUS_SUCCESS)
+		{
+			return ret;
+		}
+	}
+
+	return STATUS_SUCCESS;
+}
+
+NTSTATUS
+ShvVmxEptMapIdentityRange(
+	_In_ ULONG64 Start,
+	_In_ ULONG64 End
+)
+{
+	if (ShvVmxEptPML4 == NULL)
+	{
+		return STATUS_HV_NOT_PRESENT;
+	}
+
+	//
+	// This runs outside of root mode, so the arena can grow as needed.
+	//
+	return ShvVmxEptIdentityMapRoots(Start, End, TRUE);
+}
+
+VOID
+ShvVmxEptSetupVmcs(
+	_In_ PSHV_VP_DATA VpData
+)
+{
+	//
+	// Set the EPT pointer to point to the default view, or to its replica
+	// on the node of this LP.
+	//
+	__vmx_vmwrite(EPT_POINTER, ShvVmxEptGetDefaultEptp().QuadPart);
+
+	//
+	// Remember where to send the NMI that makes this VP flush.
+	//
+	if (ShvVmxEptNmiExiting)
+	{
+		VpData->ApicId = ShvVmxEptReadApicId();
+	}
+
+	//
+	// Point the VMCS at the VP's #VE information area.  It starts out
+	// busy, so nothing is delivered until the guest #VE handler is in place
+	// and clears it.
+	//
+	if (ShvVmxEptVeEnabled)
+	{
+		VpData->VeInformation.Busy = MAXULONG;
+
+		__vmx_vmwrite(VIRT_EXCEPTION_INFO, VpData->VePhysicalAddress);
+		__vmx_vmwrite(EPTP_INDEX, SHV_EPT_DEFAULT_VIEW);
+	}
+
+	if (!ShvVmxEptVmfuncEnabled)
+	{
+		return;
+	}
+
+	//
+	// The EPTP of the default view can still change after initialization,
+	// when the accessed and dirty flags get enabled, so refresh its entry
+	// of the EPTP list.  Then let the guest switch views with VMFUNC.
+	//
+	ShvVmxEptEptpList[SHV_EPT_DEFAULT_VIEW] = ShvVmxEptEptp;
+
+	__vmx_vmwrite(VM_FUNCTION_CONTROL, VMX_VMFUNC_EPTP_SWITCHING);
+	__vmx_vmwrite(EPTP_LIST_ADDR, MmGetPhysicalAddress(ShvVmxEptEptpList).QuadPart);
+}
+
+NTSTATUS
+ShvVmxEptProtectRange(
+	_In_ ULONG64 Gpa,
+	_In_ ULONG64 Length,
+	_In_ ULONG Access
+)
+{
+	SHV_EPT_PROTECTION range;
+
+	range.Gpa = Gpa;
+	range.Length = Length;
+	range.Access = Access;
+
+	return ShvVmxEptProtectRanges(&range, 1);
+}
+
+NTSTATUS
+ShvVmxEptProtectRanges(
+	_In_reads_(Count) const SHV_EPT_PROTECTION *Ranges,
+	_In_ ULONG Count
+)
+{
+	SHV_EPT_FLUSH flush;
+	KIRQL oldIrql;
+	NTSTATUS ret;
+	ULONG access;
+
+	if (ShvVmxEptPML4 == NULL)
+	{
+		return STATUS_HV_NOT_PRESENT;
+	}
+
+	//
+	// Writable pages have to be readable, and execute-only pages need the
+	// processor to support them.
+	//
+	for (ULONG i = 0; i < Count; i++)
+	{
+		access = Ranges[i].Access;
+
+		if ((access & ~VMX_EPT_ACCESS_RWX) != 0 ||
+			((access & VMX_EPT_ACCESS_WRITE) && !(access & VMX_EPT_ACCESS_READ)))
+		{
+			return STATUS_INVALID_PARAMETER;
+		}
+
+		if (access == VMX_EPT_ACCESS_EXECUTE &&
+			(ShvVmxEptCapabilities & VMX_EPT_CAP_EXECUTE_ONLY) == 0)
+		{
+			return STATUS_NOT_SUPPORTED;
+		}
+	}
+
+	//
+	// Change every copy of the default view, only splitting large pages as
+	// far as each range needs.  Views that were cloned from the default
+	// view keep the tables they shared with it, and with them the
+	// permissions they had.
+	//
+	flush = ShvEptFlushNone;
+	ret = STATUS_SUCCESS;
+
+	KeAcquireSpinLock(&ShvVmxEptViewLock, &oldIrql);
+
+	for (ULONG i = 0; i < Count && ret == STATUS_SUCCESS; i++)
+	{
+		if (Ranges[i].Length == 0)
+		{
+			continue;
+		}
+
+		for (ULONG r = 0; r < ShvVmxEptRootCount && ret == STATUS_SUCCESS; r++)
+		{
+			ret = ShvVmxEptUpdateRootRange(ShvVmxEptRoots[r],
+				Ranges[i].Gpa,
+				Ranges[i].Gpa + Ranges[i].Length,
+				VMX_EPT_ACCESS_RWX,
+				Ranges[i].Access,
+				&flush);
+		}
+	}
+
+	//
+	// Collapse whatever the batch left uniform again, such as the tables an
+	// earlier protection split that this one undid.
+	//
+	for (ULONG i = 0; i < Count; i++)
+	{
+		if (Ranges[i].Length == 0)
+		{
+			continue;
+		}
+
+		for (ULONG r = 0; r < ShvVmxEptRootCount; r++)
+		{
+			ShvVmxEptMergeRange(ShvVmxEptRoots[r], Ranges[i].Gpa, Ranges[i].Gpa + Ranges[i].Length);
+		}
+	}
+
+	KeReleaseSpinLock(&ShvVmxEptViewLock, oldIrql);
+
+	//
+	// A single shootdown covers the whole batch.  Whatever was changed
+	// before a failure still has to take effect.
+	//
+	if (flush == ShvEptFlushGlobal)
+	{
+		ShvVmxEptShootdown();
+	}
+
+	return ret;
+}
+
+NTSTATUS
+ShvVmxEptProtectPages(
+	_In_reads_(Count) const SHV_EPT_REGION *Regions,
+	_In_ ULONG Count,
+	_In_ ULONG Clear,
+	_In_ ULONG Set
+)
+{
+	SHV_EPT_FLUSH flush;
+	KIRQL oldIrql;
+	NTSTATUS ret;
+	ULONG64 address;
+
+	if (ShvVmxEptPML4 == NULL)
+	{
+		return STATUS_HV_NOT_PRESENT;
+	}
+
+	ret = ShvVmxEptCheckPageProtection(Regions, Count, Clear, Set);
+	if (ret != STATUS_SUCCESS)
+	{
+		return ret;
+	}
+
+	//
+	// Unlike ShvVmxEptProtectRanges, only the bits asked for change, and
+	// every page gets a 4 KiB leaf of its own in every copy of the default
+	// view, which stays split, so root mode can later give single pages
+	// their access back with ShvVmxEptGrantAccess.  Only a batch that
+	// withholds nothing collapses what it left uniform.
+	//
+	flush = ShvEptFlushNone;
+	ret = STATUS_SUCCESS;
+
+	KeAcquireSpinLock(&ShvVmxEptViewLock, &oldIrql);
+
+	for (ULONG i = 0; i < Count && ret == STATUS_SUCCESS; i++)
+	{
+		for (ULONG r = 0; r < ShvVmxEptRootCount && ret == STATUS_SUCCESS; r++)
+		{
+			for (address = Regions[i].Base;
+				address < Regions[i].Base + Regions[i].Size && ret == STATUS_SUCCESS;
+				address += PAGE_SIZE)
+			{
+				ret = ShvVmxEptUpdateRootRange(ShvVmxEptRoots[r],
+					address,
+					address + PAGE_SIZE,
+					Clear,
+					Set,
+					&flush);
+			}
+		}
+	}
+
+	if (Clear == 0)
+	{
+		for (ULONG i = 0; i < Count; i++)
+		{
+			for (ULONG r = 0; r < ShvVmxEptRootCount; r++)
+			{
+				ShvVmxEptMergeRange(ShvVmxEptRoots[r], Regions[i].Base, Regions[i].Base + Regions[i].Size);
+			}
+		}
+	}
+
+	KeReleaseSpinLock(&ShvVmxEptViewLock, oldIrql);
+
+	//
+	// However many pages changed, one shootdown covers them all.
+	//
+	if (flush == ShvEptFlushGlobal)
+	{
+		ShvVmxEptShootdown();
+	}
+
+	return ret;
+}
+
+NTSTATUS
+ShvVmxEptProtectOwnedPages(
+	_In_reads_(Count) const SHV_EPT_REGION *Regions,
+	_In_ ULONG Count,
+	_In_ ULONG Clear,
+	_In_ ULONG Set,
+	_Inout_ volatile ULONG64 *Pages,
+	_Out_ PULONG64 Protected
+)
+{
+	VMX_EPT_ENTRY entry;
+	SHV_EPT_FLUSH flush;
+	KIRQL oldIrql;
+	NTSTATUS ret;
+	ULONG64 address, index, size;
+	ULONG level, access, owned, r;
+
+	*Protected = 0;
+
+	if (ShvVmxEptPML4 == NULL)
+	{
+		return STATUS_HV_NOT_PRESENT;
+	}
+
+	ret = ShvVmxEptCheckPageProtection(Regions, Count, Clear, Set);
+	if (ret != STATUS_SUCCESS)
+	{
+		return ret;
+	}
+
+	//
+	// Like ShvVmxEptProtectPages, but only for the pages the caller owns,
+	// whose bit in the order of the regions is set, and the ones nobody
+	// owns yet, which have full access to their own frame.  A page the
+	// caller owns still maps its own frame, with full access or with just
+	// the access the caller changes taken away.  Anything else belongs to
+	// someone else now, so the caller loses it.  Checking and protecting
+	// both happen under the view lock, so no other protection can come in
+	// between, and a page's bit is set before it is protected, so root
+	// mode can tell which violations are the caller's as soon as they can
+	// happen.
+	//
+	flush = ShvEptFlushNone;
+	owned = VMX_EPT_ACCESS_RWX & ~(Clear | Set);
+	index = 0;
+
+	KeAcquireSpinLock(&ShvVmxEptViewLock, &oldIrql);
+
+	for (ULONG i = 0; i < Count && ret == STATUS_SUCCESS; i++)
+	{
+		for (address = Regions[i].Base;
+			address < Regions[i].Base + Regions[i].Size && ret == STATUS_SUCCESS;
+			address += PAGE_SIZE, index++)
+		{
+			for (r = 0; r < ShvVmxEptRootCount; r++)
+			{
+				entry = ShvVmxEptLookup(ShvVmxEptRoots[r], address, &level, NULL);
+				size = SHV_EPT_LEVEL_SIZE(level);
+				access = SHV_EPT_ENTRY_ACCESS(&entry);
+
+				if (entry.QuadPart == ShvVmxEptEmpty ||
+					(SHV_PFN_TO_PHYS(entry.PFN) & ~(size - 1)) != (address & ~(size - 1)) ||
+					(access != VMX_EPT_ACCESS_RWX &&
+					 (access != owned || (Pages[index / 64] & (1ULL << (index % 64))) == 0)))
+				{
+					break;
+				}
+			}
+
+			if (r != ShvVmxEptRootCount)
+			{
+				InterlockedBitTestAndReset64((volatile LONG64 *)&Pages[index / 64], index % 64);
+				continue;
+			}
+
+			InterlockedBitTestAndSet64((volatile LONG64 *)&Pages[index / 64], index % 64);
+
+			for (r = 0; r < ShvVmxEptRootCount && ret == STATUS_SUCCESS; r++)
+			{
+				ret = ShvVmxEptUpdateRootRange(ShvVmxEptRoots[r],
+					address,
+					address + PAGE_SIZE,
+					Clear,
+					Set,
+					&flush);
+			}
+
+			(*Protected)++;
+		}
+	}
+
+	if (Clear == 0)
+	{
+		for (ULONG i = 0; i < Count; i++)
+		{
+			for (r = 0; r < ShvVmxEptRootCount; r++)
+			{
+				ShvVmxEptMergeRange(ShvVmxEptRoots[r], Regions[i].Base, Regions[i].Base + Regions[i].Size);
+			}
+		}
+	}
+
+	KeReleaseSpinLock(&ShvVmxEptViewLock, oldIrql);
+
+	if (flush == ShvEptFlushGlobal)
+	{
+		ShvVmxEptShootdown();
+	}
+
+	return ret;
+}
+
+NTSTATUS
+ShvVmxEptRegisterViolationHandler(
+	_In_ PSHV_EPT_VIOLATION_HANDLER Handler
+)
+{
+	for (ULONG i = 0; i < SHV_EPT_MAX_HANDLERS; i++)
+	{
+		if (InterlockedCompareExchangePointer((PVOID volatile *)&ShvVmxEptHandlers[i],
+			(PVOID)Handler,
+			NULL) == NULL)
+		{
+			return STATUS_SUCCESS;
+		}
+	}
+
+	return STATUS_HV_NO_RESOURCES;
+}
+
+VOID
+ShvVmxEptUnregisterViolationHandler(
+	_In_ PSHV_EPT_VIOLATION_HANDLER Handler
+)
+{
+	for (ULONG i = 0; i < SHV_EPT_MAX_HANDLERS; i++)
+	{
+		if (InterlockedCompareExchangePointer((PVOID volatile *)&ShvVmxEptHandlers[i],
+			NULL,
+			(PVOID)Handler) == (PVOID)Handler)
+		{
+			break;
+		}
+	}
+
+	//
+	// Root mode runs with interrupts off, so once every LP took the IPI,
+	// none of them can still be calling the handler.
+	//
+	KeIpiGenericCall(ShvVmxEptShootdownWorker, 0);
+}
+
+NTSTATUS
+ShvVmxEptRemapPages(
+	_In_reads_(Count) const SHV_EPT_REMAP *Pages,
+	_In_ ULONG Count
+)
+{
+	SHV_EPT_FLUSH flush;
+	KIRQL oldIrql;
+	NTSTATUS ret;
+
+	if (ShvVmxEptPML4 == NULL)
+	{
+		return STATUS_HV_NOT_PRESENT;
+	}
+
+	for (ULONG i = 0; i < Count; i++)
+	{
+		if ((Pages[i].Gpa & (PAGE_SIZE - 1)) != 0 ||
+			(Pages[i].Hpa & ~SHV_EPT_PFN_MASK) != 0 ||
+			(Pages[i].Access & ~VMX_EPT_ACCESS_RWX) != 0 ||
+			((Pages[i].Access & VMX_EPT_ACCESS_WRITE) && !(Pages[i].Access & VMX_EPT_ACCESS_READ)))
+		{
+			return STATUS_INVALID_PARAMETER;
+		}
+	}
+
+	//
+	// Point the 4 KiB leaf of each page at its new frame in every copy of
+	// the default view, splitting whatever large page covers it.  The
+	// memory type stays what the MTRRs say about the GPA.
+	//
+	flush = ShvEptFlushNone;
+	ret = STATUS_SUCCESS;
+
+	KeAcquireSpinLock(&ShvVmxEptViewLock, &oldIrql);
+
+	for (ULONG i = 0; i < Count && ret == STATUS_SUCCESS; i++)
+	{
+		for (ULONG r = 0; r < ShvVmxEptRootCount && ret == STATUS_SUCCESS; r++)
+		{
+			ret = ShvVmxEptUpdateRootRange(ShvVmxEptRoots[r],
+				Pages[i].Gpa,
+				Pages[i].Gpa + PAGE_SIZE,
+				SHV_EPT_PFN_MASK | VMX_EPT_ACCESS_RWX,
+				Pages[i].Hpa | Pages[i].Access,
+				&flush);
+		}
+	}
+
+	//
+	// Pages that went back to their own frame may complete a large page
+	// again.
+	//
+	for (ULONG i = 0; i < Count; i++)
+	{
+		for (ULONG r = 0; r < ShvVmxEptRootCount; r++)
+		{
+			ShvVmxEptMergeRange(ShvVmxEptRoots[r], Pages[i].Gpa, Pages[i].Gpa + PAGE_SIZE);
+		}
+	}
+
+	KeReleaseSpinLock(&ShvVmxEptViewLock, oldIrql);
+
+	if (flush == ShvEptFlushGlobal)
+	{
+		ShvVmxEptShootdown();
+	}
+
+	return ret;
+}
+
+NTSTATUS
+ShvVmxEptSplitPages(
+	_In_ ULONG View,
+	_In_reads_(Count) const SHV_EPT_SPLIT *Pages,
+	_In_ ULONG Count
+)
+{
+	SHV_EPT_FLUSH flush;
+	KIRQL oldIrql;
+	NTSTATUS ret;
+	BOOLEAN split;
+
+	if (ShvVmxEptPML4 == NULL)
+	{
+		return STATUS_HV_NOT_PRESENT;
+	}
+
+	if ((ShvVmxEptCapabilities & VMX_EPT_CAP_EXECUTE_ONLY) == 0)
+	{
+		return STATUS_NOT_SUPPORTED;
+	}
+
+	if (View == SHV_EPT_DEFAULT_VIEW)
+	{
+		return STATUS_INVALID_PARAMETER;
+	}
+
+	for (ULONG i = 0; i < Count; i++)
+	{
+		if ((Pages[i].Gpa & (PAGE_SIZE - 1)) != 0 ||
+			(Pages[i].ExecuteHpa & ~SHV_EPT_PFN_MASK) != 0)
+		{
+			return STATUS_INVALID_PARAMETER;
+		}
+	}
+
+	flush = ShvEptFlushNone;
+	ret = STATUS_SUCCESS;
+
+	KeAcquireSpinLock(&ShvVmxEptViewLock, &oldIrql);
+
+	if (View >= ShvVmxEptViewCount)
+	{
+		KeReleaseSpinLock(&ShvVmxEptViewLock, oldIrql);
+		return STATUS_INVALID_PARAMETER;
+	}
+
+	//
+	// A split page executes its other frame in every copy of the default
+	// view, and can only be read and written through its own frame in the
+	// view.  A page whose other frame is its own is joined again, with
+	// full access in both.
+	//
+	for (ULONG i = 0; i < Count && ret == STATUS_SUCCESS; i++)
+	{
+		split = (Pages[i].ExecuteHpa != Pages[i].Gpa);
+
+		for (ULONG r = 0; r < ShvVmxEptRootCount && ret == STATUS_SUCCESS; r++)
+		{
+			ret = ShvVmxEptUpdateRootRange(ShvVmxEptRoots[r],
+				Pages[i].Gpa,
+				Pages[i].Gpa + PAGE_SIZE,
+				SHV_EPT_PFN_MASK | VMX_EPT_ACCESS_RWX,
+				split ? (Pages[i].ExecuteHpa | VMX_EPT_ACCESS_EXECUTE) : (Pages[i].Gpa | VMX_EPT_ACCESS_RWX),
+				&flush);
+		}
+
+		if (ret == STATUS_SUCCESS)
+		{
+			ret = ShvVmxEptUpdateRootRange(ShvVmxEptViews[View],
+				Pages[i].Gpa,
+				Pages[i].Gpa + PAGE_SIZE,
+				VMX_EPT_ACCESS_RWX,
+				split ? (VMX_EPT_ACCESS_READ | VMX_EPT_ACCESS_WRITE) : VMX_EPT_ACCESS_RWX,
+				&flush);
+		}
+	}
+
+	for (ULONG i = 0; i < Count; i++)
+	{
+		if (Pages[i].ExecuteHpa != Pages[i].Gpa)
+		{
+			continue;
+		}
+
+		for (ULONG r = 0; r < ShvVmxEptRootCount; r++)
+		{
+			ShvVmxEptMergeRange(ShvVmxEptRoots[r], Pages[i].Gpa, Pages[i].Gpa + PAGE_SIZE);
+		}
+	}
+
+	KeReleaseSpinLock(&ShvVmxEptViewLock, oldIrql);
+
+	//
+	// Both sides of every page in the batch change under one shootdown.
+	//
+	if (flush == ShvEptFlushGlobal)
+	{
+		ShvVmxEptShootdown();
+	}
+
+	return ret;
+}
+
+BOOLEAN
+ShvVmxEptReplaceLeaf(
+	_In_ ULONG64 Gpa,
+	_In_ ULONG64 Hpa,
+	_In_ ULONG Access
+)
+{
+	PVMX_EPT_ENTRY location;
+	VMX_EPT_ENTRY entry;
+	ULONG level;
+
+	//
+	// This is the root mode counterpart of ShvVmxEptRemapPages, for a page
+	// that already has a 4 KiB leaf of its own in every copy of the default
+	// view.  Nothing is split, and the caller flushes.  Outside of root
+	// mode, only the holder of the view lock changes present entries, and
+	// it only does so for pages the caller doesn't own, so a failed
+	// exchange means the page isn't the caller's anymore.
+	//
+	for (ULONG i = 0; i < ShvVmxEptRootCount; i++)
+	{
+		entry = ShvVmxEptLookup(ShvVmxEptRoots[i], Gpa, &level, &location);
+		if (entry.QuadPart == ShvVmxEptEmpty || level != 1)
+		{
+			return FALSE;
+		}
+
+		if ((ULONG64)InterlockedCompareExchange64((volatile LONG64 *)&location->QuadPart,
+			(entry.QuadPart & ~(SHV_EPT_PFN_MASK | VMX_EPT_ACCESS_RWX)) | Hpa | Access,
+			entry.QuadPart) != entry.QuadPart)
+		{
+			return FALSE;
+		}
+	}
+
+	return TRUE;
+}
+
+ULONG64
+ShvVmxEptGrantAccess(
+	_In_ ULONG64 Gpa,
+	_In_ ULONG Access
+)
+{
+	PVMX_EPT_ENTRY location;
+	VMX_EPT_ENTRY entry;
+	ULONG64 size;
+	ULONG level;
+
+	//
+	// Add the access to the leaf that maps the GPA in every copy of the
+	// default view.  If it changed in the meantime, leave it alone, the
+	// guest will just fault again.  Adding permissions only ever needs a
+	// local flush, so this is safe in root mode.  Returns how much memory
+	// the largest of the leaves maps, which is more than the page if
+	// nothing split it.
+	//
+	size = 0;
+
+	for (ULONG i = 0; i < ShvVmxEptRootCount; i++)
+	{
+		entry = ShvVmxEptLookup(ShvVmxEptRoots[i], Gpa, &level, &location);
+		if (entry.QuadPart == ShvVmxEptEmpty)
+		{
+			continue;
+		}
+
+		InterlockedCompareExchange64((volatile LONG64 *)&location->QuadPart,
+			entry.QuadPart | Access,
+			entry.QuadPart);
+
+		size = max(size, SHV_EPT_LEVEL_SIZE(level));
+	}
+
+	ShvVmxEptCommitChange(ShvEptFlushLocal);
+
+	return size;
+}
+
+NTSTATUS
+ShvVmxEptEnableRootShootdown(
+	VOID
+)
+{
+	PHYSICAL_ADDRESS apicBase;
+
+	//
+	// This has to happen before any VP is launched, since NMI exiting is
+	// set up along with the rest of the VMCS.
+	//
+	if (ShvVmxEptNmiExiting)
+	{
+		return STATUS_SUCCESS;
+	}
+
+	//
+	// Every NMI that exits is handed back to the guest, and without virtual
+	// NMIs there is no way to tell when the guest is done with one.
+	//
+	if ((__readmsr(MSR_IA32_VMX_TRUE_PINBASED_CTLS) >> 32 &
+		PIN_BASED_VIRTUAL_NMIS) == 0)
+	{
+		return STATUS_NOT_SUPPORTED;
+	}
+
+	apicBase.QuadPart = __readmsr(IA32_APIC_BASE_MSR);
+
+	if ((apicBase.QuadPart & SHV_APIC_BASE_X2APIC_ENABLE) == 0)
+	{
+		apicBase.QuadPart &= IA32_APIC_BASE_ADDRESS_MASK;
+
+		ShvVmxEptApic = (PUCHAR)MmMapIoSpace(apicBase, PAGE_SIZE, MmNonCached);
+		if (ShvVmxEptApic == NULL)
+		{
+			return STATUS_HV_INSUFFICIENT_MEMORY;
+		}
+	}
+
+	//
+	// An NMI can also arrive while its target is in root mode, or before it
+	// was launched, in which case Windows gets it instead of us.
+	//
+	ShvVmxEptNmiCallbackHandle = KeRegisterNmiCallback(ShvVmxEptNmiCallback, NULL);
+	if (ShvVmxEptNmiCallbackHandle == NULL)
+	{
+		if (ShvVmxEptApic != NULL)
+		{
+			MmUnmapIoSpace(ShvVmxEptApic, PAGE_SIZE);
+			ShvVmxEptApic = NULL;
+		}
+
+		return STATUS_HV_INSUFFICIENT_MEMORY;
+	}
+
+	ShvVmxEptProcessorCount = KeQueryActiveProcessorCountEx(ALL_PROCESSOR_GROUPS);
+	ShvVmxEptNmiExiting = TRUE;
+
+	return STATUS_SUCCESS;
+}
+
+LONG64
+ShvVmxEptRequestShootdown(
+	_In_ PSHV_VP_DATA VpData
+)
+{
+	PSHV_VP_DATA vpData;
+	LONG64 generation;
+
+	//
+	// Flush this VP right away, and have every other one flush on its next
+	// VM exit.  Root mode never waits for the other VPs, which may be in
+	// root mode themselves with interrupts off, so the caller checks back
+	// with ShvVmxEptShootdownComplete on a later exit instead.
+	//
+	generation = InterlockedIncrement64(&ShvVmxEptGeneration);
+
+	ShvVmxEptInvalidateEpt();
+	VpData->EptGeneration = generation;
+
+	if (!ShvVmxEptNmiExiting)
+	{
+		return generation;
+	}
+
+	//
+	// Root mode can't use an IPI, since interrupts are off and the guest
+	// the IPI would have to run in is paused.  Force the exit with an NMI
+	// instead, which every VP takes even with interrupts off.
+	//
+	for (ULONG i = 0; i < ShvVmxEptProcessorCount; i++)
+	{
+		vpData = &ShvGlobalData->VpData[i];
+
+		if (vpData == VpData || vpData->VmxEnabled == 0)
+		{
+			continue;
+		}
+
+		InterlockedExchange(&vpData->NmiRequested, 1);
+		ShvVmxEptSendNmi(vpData->ApicId);
+	}
+
+	return generation;
+}
+
+BOOLEAN
+ShvVmxEptShootdownComplete(
+	_In_ LONG64 Generation
+)
+{
+	PSHV_VP_DATA vpData;
+	ULONG count;
+
+	//
+	// Every VP flushes on its way back into the guest, so once each one
+	// still running the guest has caught up with the generation, none of
+	// them can use what was cached before it.
+	//
+	count = KeQueryActiveProcessorCountEx(ALL_PROCESSOR_GROUPS);
+
+	for (ULONG i = 0; i < count; i++)
+	{
+		vpData = &ShvGlobalData->VpData[i];
+
+		if (vpData->VmxEnabled == 0)
+		{
+			continue;
+		}
+
+		if ((LONG64)*(volatile ULONG64 *)&vpData->EptGeneration < Generation)
+		{
+			return FALSE;
+		}
+	}
+
+	return TRUE;
+}
+
+VOID
+ShvVmxEptHandleNmi(
+	VOID
+)
+{
+	PSHV_VP_DATA vpData;
+
+	//
+	// An NMI we sent only has to cause the exit, and the VP flushes on its
+	// way back into the guest.  But it can't be told apart from one of the
+	// guest's that arrived along with it and was taken as the same NMI, so
+	// every one is queued for the guest.  Our callback claims the ones we
+	// sent, and Windows still asks every other callback about the rest.
+	//
+	vpData = &ShvGlobalData->VpData[KeGetCurrentProcessorNumberEx(NULL)];
+
+	InterlockedIncrement(&vpData->GuestNmis);
+}
+
+VOID
+ShvVmxEptDeliverNmi(
+	_In_ PSHV_VP_DATA VpData
+)
+{
+	SIZE_T controls;
+	SIZE_T interruptibility;
+	SIZE_T entryInfo;
+	LONG pending;
+
+	pending = VpData->GuestNmis;
+	if (pending == 0)
+	{
+		return;
+	}
+
+	//
+	// The guest can only take an NMI when it isn't still handling the last
+	// one, isn't in an STI or MOV SS shadow, and nothing else is about to be
+	// injected in this entry.  Otherwise ask to exit as soon as it can.
+	//
+	__vmx_vmread(GUEST_INTERRUPTIBILITY_INFO, &interruptibility);
+	__vmx_vmread(VM_ENTRY_INTR_INFO, &entryInfo);
+
+	if (((entryInfo & INTR_INFO_VALID_MASK) == 0) &&
+		((interruptibility & (GUEST_INTR_STATE_STI |
+							  GUEST_INTR_STATE_MOV_SS |
+							  GUEST_INTR_STATE_NMI)) == 0))
+	{
+		__vmx_vmwrite(VM_ENTRY_INTR_INFO, SHV_EPT_INJECT_NMI);
+		pending = InterlockedDecrement(&VpData->GuestNmis);
+	}
+
+	//
+	// Delivering the NMI blocks the next one until the guest's IRET, which
+	// is when the window opens again for whatever is still queued.
+	//
+	__vmx_vmread(CPU_BASED_VM_EXEC_CONTROL, &controls);
+
+	if (pending != 0)
+	{
+		controls |= CPU_BASED_VIRTUAL_NMI_PENDING;
+	}
+	else
+	{
+		controls &= ~(SIZE_T)CPU_BASED_VIRTUAL_NMI_PENDING;
+	}
+
+	__vmx_vmwrite(CPU_BASED_VM_EXEC_CONTROL, controls);
+}
+
+NTSTATUS
+ShvVmxEptCreateView(
+	_Out_ PULONG View
+)
+{
+	//
+	// The default view is never changed, so it is always the plain identity
+	// map a new view starts out as.
+	//
+	return ShvVmxEptCloneView(SHV_EPT_DEFAULT_VIEW, View);
+}
+
+NTSTATUS
+ShvVmxEptCloneView(
+	_In_ ULONG Source,
+	_Out_ PULONG View
+)
+{
+	PVMX_EPT_ENTRY root;
+	VMX_EPT_EPTP eptp;
+	KIRQL oldIrql;
+	ULONG view;
+
+	*View = SHV_EPT_DEFAULT_VIEW;
+
+	if (!ShvVmxEptVmfuncEnabled)
+	{
+		return STATUS_NOT_SUPPORTED;
+	}
+
+	KeAcquireSpinLock(&ShvVmxEptViewLock, &oldIrql);
+
+	if (Source >= ShvVmxEptViewCount)
+	{
+		KeReleaseSpinLock(&ShvVmxEptViewLock, oldIrql);
+		return STATUS_INVALID_PARAMETER;
+	}
+
+	if (ShvVmxEptViewCount == SHV_EPT_MAX_VIEWS)
+	{
+		KeReleaseSpinLock(&ShvVmxEptViewLock, oldIrql);
+		return STATUS_HV_NO_RESOURCES;
+	}
+
+	//
+	// A new view only needs its own PML4.  Everything below it is shared
+	// with the source until one of them changes it.
+	//
+	root = ShvVmxEptCopyTable(ShvVmxEptViews[Source], VMX_EPT_PAGE_WALK_LENGTH);
+	if (root == NULL)
+	{
+		KeReleaseSpinLock(&ShvVmxEptViewLock, oldIrql);
+		return STATUS_HV_NO_RESOURCES;
+	}
+
+	eptp = ShvVmxEptEptp;
+	eptp.PFN = ShvVmxEptGetPfnFromVirtual(root);
+
+	//
+	// Fill in the EPTP list entry before the view is published, so that
+	// the guest can never switch to a view that isn't there yet.
+	//
+	view = ShvVmxEptViewCount;
+
+	ShvVmxEptViews[view] = root;
+	ShvVmxEptEptpList[view] = eptp;
+
+	InterlockedExchange((volatile LONG *)&ShvVmxEptViewCount, view + 1);
+
+	KeReleaseSpinLock(&ShvVmxEptViewLock, oldIrql);
+
+	*View = view;
+
+	return STATUS_SUCCESS;
+}
+
+VOID
+ShvVmxEptSwitchView(
+	_In_ ULONG View
+)
+{
+	//
+	// Switch the VP to a view from root mode, the way VMFUNC does from the
+	// guest.  Cached translations are tagged with the EPTP, so nothing has
+	// to be flushed.  The default view goes through the replica of the
+	// VP's node.
+	//
+	NT_ASSERT(View < ShvVmxEptViewCount);
+
+	if (View == SHV_EPT_DEFAULT_VIEW)
+	{
+		__vmx_vmwrite(EPT_POINTER, ShvVmxEptGetDefaultEptp().QuadPart);
+	}
+	else
+	{
+		__vmx_vmwrite(EPT_POINTER, ShvVmxEptEptpList[View].QuadPart);
+	}
+
+	if (ShvVmxEptVeEnabled)
+	{
+		__vmx_vmwrite(EPTP_INDEX, View);
+	}
+}
+
+NTSTATUS
+ShvVmxEptProtectViewRange(
+	_In_ ULONG View,
+	_In_ ULONG64 Gpa,
+	_In_ ULONG64 Length,
+	_In_ ULONG Access
+)
+{
+	SHV_EPT_FLUSH flush;
+	KIRQL oldIrql;
+	NTSTATUS ret;
+
+	//
+	// The default view is what VPs fall back to when a view withholds an
+	// access, so it always keeps the whole identity map.
+	//
+	if (View == SHV_EPT_DEFAULT_VIEW || (Access & ~VMX_EPT_ACCESS_RWX) != 0)
+	{
+		return STATUS_INVALID_PARAMETER;
+	}
+
+	if (Length == 0)
+	{
+		return STATUS_SUCCESS;
+	}
+
+	KeAcquireSpinLock(&ShvVmxEptViewLock, &oldIrql);
+
+	if (View >= ShvVmxEptViewCount)
+	{
+		KeReleaseSpinLock(&ShvVmxEptViewLock, oldIrql);
+		return STATUS_INVALID_PARAMETER;
+	}
+
+	flush = ShvEptFlushNone;
+
+	ret = ShvVmxEptUpdateRootRange(ShvVmxEptViews[View],
+		Gpa,
+		Gpa + Length,
+		VMX_EPT_ACCESS_RWX,
+		Access,
+		&flush);
+
+	KeReleaseSpinLock(&ShvVmxEptViewLock, oldIrql);
+
+	//
+	// Whatever was changed before a failure still has to take effect.  A
+	// VP with a stale copy of an entry that gained permissions takes a
+	// spurious violation and flushes by itself, but nothing else can be
+	// left cached anywhere.
+	//
+	if (flush == ShvEptFlushGlobal)
+	{
+		ShvVmxEptShootdown();
+	}
+
+	return ret;
+}
+
+NTSTATUS
+ShvVmxEptReportViewRange(
+	_In_ ULONG View,
+	_In_ ULONG64 Gpa,
+	_In_ ULONG64 Length,
+	_In_ BOOLEAN Report
+)
+{
+	SHV_EPT_FLUSH flush;
+	KIRQL oldIrql;
+	NTSTATUS ret;
+
+	if (!ShvVmxEptVeEnabled)
+	{
+		return STATUS_NOT_SUPPORTED;
+	}
+
+	if (Length == 0)
+	{
+		return STATUS_SUCCESS;
+	}
+
+	KeAcquireSpinLock(&ShvVmxEptViewLock, &oldIrql);
+
+	if (View >= ShvVmxEptViewCount)
+	{
+		KeReleaseSpinLock(&ShvVmxEptViewLock, oldIrql);
+		return STATUS_INVALID_PARAMETER;
+	}
+
+	//
+	// Clearing the suppress #VE flag of the leaves that map the range sends
+	// the violations they cause to the guest #VE handler.  Permissions are
+	// left alone, so this is fine on the default view as well.
+	//
+	flush = ShvEptFlushNone;
+
+	ret = ShvVmxEptUpdateRootRange(ShvVmxEptViews[View],
+		Gpa,
+		Gpa + Length,
+		Report ? VMX_EPT_SUPPRESS_VE : 0,
+		Report ? 0 : VMX_EPT_SUPPRESS_VE,
+		&flush);
+
+	KeReleaseSpinLock(&ShvVmxEptViewLock, oldIrql);
+
+	//
+	// Processors may have cached the leaves with the old flag.
+	//
+	if (flush == ShvEptFlushGlobal)
+	{
+		ShvVmxEptShootdown();
+	}
+
+	return ret;
+}
+
+VOID
+ShvVmxEptInspect(
+	_Out_ PSHV_EPT_INSPECTION Inspection
+)
+{
+	ULONG64 faults;
+
+	//
+	// Summarize the default view.  This only reads the tables and takes no
+	// locks, so it is cheap enough to do periodically.
+	//
+	ShvVmxEptInspectHierarchy(ShvVmxEptPML4,
+		ShvVmxEptTranslatePfn,
+		NULL,
+		ShvVmxEptCapabilities,
+		ShvVmxEptEmpty,
+		Inspection);
+
+	for (ULONG i = 0; i < ShvVmxEptArena.ChunkCount; i++)
+	{
+		Inspection->ArenaBytes += (ULONG64)ShvVmxEptArena.Chunks[i].Pages * PAGE_SIZE;
+	}
+
+	faults = ShvVmxEptOnDemandFaults;
+
+	Inspection->OnDemandFaults = faults;
+	Inspection->OnDemandBytes = ShvVmxEptOnDemandBytes;
+	Inspection->OnDemandListed = 0;
+
+	//
+	// Faults keep filling the ring while it is copied.  A slot is only
+	// listed if its sequence was the same before and after the copy, and
+	// said that the slot was filled.
+	//
+	for (ULONG i = 0; i < SHV_EPT_INSPECT_REGIONS; i++)
+	{
+		PSHV_EPT_REGION_SLOT slot;
+		SHV_EPT_REGION region;
+		LONG64 sequence;
+
+		slot = &ShvVmxEptOnDemandRegions[i];
+		sequence = slot->Sequence;
+
+		if ((sequence == 0) || (sequence == SHV_EPT_REGION_BUSY))
+		{
+			continue;
+		}
+
+		KeMemoryBarrier();
+		region = slot->Region;
+		KeMemoryBarrier();
+
+		if (slot->Sequence != sequence)
+		{
+			continue;
+		}
+
+		Inspection->OnDemandRegions[Inspection->OnDemandListed++] = region;
+	}
+}
+
+BOOLEAN
+ShvVmxEptTranslateGpa(
+	_In_ ULONG64 Gpa,
+	_In_ BOOLEAN Write,
+	_Out_ PULONG64 Hpa
+)
+{
+	VMX_EPT_EPTP eptp;
+	VMX_EPT_ENTRY entry;
+	ULONG64 size;
+	ULONG level;
+
+	//
+	// Translate through whichever view the VP is in, the same way the
+	// processor would for the guest.  This only reads the tables, so it is
+	// safe in root mode.
+	//
+	__vmx_vmread(EPT_POINTER, (PSIZE_T)&eptp.QuadPart);
+
+	entry = ShvVmxEptLookup((PVMX_EPT_ENTRY)ShvVmxEptGetVirtualFromPfn(eptp.PFN), Gpa, &level, NULL);
+
+	if ((entry.QuadPart == ShvVmxEptEmpty) ||
+		(entry.R == 0) ||
+		(Write && (entry.W == 0)))
+	{
+		return FALSE;
+	}
+
+	size = SHV_EPT_LEVEL_SIZE(level);
+	*Hpa = (SHV_PFN_TO_PHYS(entry.PFN) & ~(size - 1)) | (Gpa & (size - 1));
+
+	return TRUE;
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+static PVOID
+ShvVmxEptGetVirtualFromPfn(
+	SIZE_T Pfn
+)
+{
+	PSHV_EPT_ARENA_CHUNK chunk;
+
+	//
+	// EPT tables only ever live in the arena, so the translation is an
+	// offset from the base of the chunk that holds the PFN.
+	//
+	chunk = ShvVmxEptFindChunkByPfn(Pfn);
+	if (chunk == NULL)
+	{
+		NT_ASSERTMSG("PFN is not in the EPT arena", FALSE);
+		return NULL;
+	}
+
+	return chunk->Base + (Pfn - chunk->BasePfn) * PAGE_SIZE;
+}
+
+static SIZE_T
+ShvVmxEptGetPfnFromVirtual(
+	PVOID Va
+)
+{
+	PSHV_EPT_ARENA_CHUNK chunk;
+
+	chunk = ShvVmxEptFindChunkByVa(Va);
+	if (chunk == NULL)
+	{
+		NT_ASSERTMSG("Address is not in the EPT arena", FALSE);
+		return 0;
+	}
+
+	return chunk->BasePfn + ((PUCHAR)Va - chunk->Base) / PAGE_SIZE;
+}
+
+static ULONG
+ShvVmxEptGetTableNode(
+	PVMX_EPT_ENTRY table
+)
+{
+	PSHV_EPT_ARENA_CHUNK chunk;
+
+	chunk = ShvVmxEptFindChunkByVa(table);
+	if (chunk == NULL)
+	{
+		NT_ASSERTMSG("Table is not in the EPT arena", FALSE);
+		return MM_ANY_NODE_OK;
+	}
+
+	return chunk->Node;
+}
+
+static PSHV_EPT_ARENA_CHUNK
+ShvVmxEptFindChunkByPfn(
+	ULONG64 Pfn
+)
+{
+	PSHV_EPT_ARENA_CHUNK chunk;
+	ULONG64 entry;
+
+	//
+	// The frame the PFN is in names the one or two chunks that can hold it.
+	//
+	entry = ShvVmxEptArenaIndexFind(ShvVmxEptArena.PhysicalIndex,
+		Pfn >> (SHV_EPT_ARENA_FRAME_SHIFT - PAGE_SHIFT));
+
+	for (ULONG i = 0; i < 2; i++)
+	{
+		if (SHV_EPT_ARENA_INDEX_CHUNK(entry, i) == 0)
+		{
+			continue;
+		}
+
+		chunk = &ShvVmxEptArena.Chunks[SHV_EPT_ARENA_INDEX_CHUNK(entry, i) - 1];
+
+		if (Pfn - chunk->BasePfn < chunk->Pages)
+		{
+			return chunk;
+		}
+	}
+
+	return NULL;
+}
+
+static PSHV_EPT_ARENA_CHUNK
+ShvVmxEptFindChunkByVa(
+	PVOID Va
+)
+{
+	PSHV_EPT_ARENA_CHUNK chunk;
+	ULONG64 entry;
+
+	entry = ShvVmxEptArenaIndexFind(ShvVmxEptArena.VirtualIndex,
+		(ULONG_PTR)Va >> SHV_EPT_ARENA_FRAME_SHIFT);
+
+	for (ULONG i = 0; i < 2; i++)
+	{
+		if (SHV_EPT_ARENA_INDEX_CHUNK(entry, i) == 0)
+		{
+			continue;
+		}
+
+		chunk = &ShvVmxEptArena.Chunks[SHV_EPT_ARENA_INDEX_CHUNK(entry, i) - 1];
+
+		if ((ULONG_PTR)((PUCHAR)Va - chunk->Base) < (ULONG_PTR)chunk->Pages * PAGE_SIZE)
+		{
+			return chunk;
+		}
+	}
+
+	return NULL;
+}
+
+static ULONG64
+ShvVmxEptArenaIndexFind(
+	volatile ULONG64 *Index,
+	ULONG64 Frame
+)
+{
+	ULONG64 entry;
+	ULONG slot;
+
+	//
+	// Open addressing with linear probing.  Entries are never removed, so
+	// the first empty slot ends the search.  This only reads the index and
+	// is safe in root mode, even while another LP is growing the arena.
+	//
+	slot = (ULONG)((Frame * 0x9E3779B97F4A7C15ULL) >> (64 - SHV_EPT_ARENA_INDEX_BITS));
+
+	for (ULONG i = 0; i < SHV_EPT_ARENA_INDEX_SIZE; i++)
+	{
+		entry = Index[slot];
+
+		if (entry == 0)
+		{
+			break;
+		}
+
+		if (SHV_EPT_ARENA_INDEX_FRAME(entry) == Frame)
+		{
+			return entry;
+		}
+
+		slot = (slot + 1) & (SHV_EPT_ARENA_INDEX_SIZE - 1);
+	}
+
+	return 0;
+}
+
+static VOID
+ShvVmxEptArenaIndexInsert(
+	volatile ULONG64 *Index,
+	ULONG64 First,
+	ULONG64 Last,
+	ULONG Chunk
+)
+{
+	ULONG64 entry;
+	ULONG slot;
+
+	//
+	// Called with the arena lock held, so there is only ever one writer.
+	// Each entry is written with a single store, so readers see either the
+	// old one or the new one, and they only look for the chunk once it was
+	// published anyway.  The caller made sure there is room.
+	//
+	for (ULONG64 frame = First; frame <= Last; frame++)
+	{
+		slot = (ULONG)((frame * 0x9E3779B97F4A7C15ULL) >> (64 - SHV_EPT_ARENA_INDEX_BITS));
+
+		for (;;)
+		{
+			entry = Index[slot];
+
+			if (entry == 0)
+			{
+				InterlockedExchange64((volatile LONG64 *)&Index[slot],
+					(LONG64)SHV_EPT_ARENA_INDEX_ENTRY(frame, Chunk + 1, 0));
+				ShvVmxEptArena.IndexCount++;
+				break;
+			}
+
+			if (SHV_EPT_ARENA_INDEX_FRAME(entry) == frame)
+			{
+				NT_ASSERT(SHV_EPT_ARENA_INDEX_CHUNK(entry, 0) == 0);
+				InterlockedExchange64((volatile LONG64 *)&Index[slot],
+					(LONG64)(entry | (Chunk + 1)));
+				break;
+			}
+
+			slot = (slot + 1) & (SHV_EPT_ARENA_INDEX_SIZE - 1);
+		}
+	}
+}
+
+static ULONG
+ShvVmxEptArenaEstimate(
+	VOID
+)
+{
+	ULONG64 pages, address, end, size;
+
+	//
+	// Every range needs, at worst, a partial table at each end of it at
+	// every level, plus a full table for every region at a level that
+	// can't be mapped with a large page.  The first 4 GiB are counted as a
+	// single range for the MMIO holes.
+	//
+	pages = 1 + 2 * (VMX_EPT_PAGE_WALK_LENGTH - 1) + SHV_EPT_ARENA_HEADROOM;
+
+	if ((ShvVmxEptCapabilities & VMX_EPT_CAP_PDE_2MB) == 0)
+	{
+		pages += ((ULONG64)MAXULONG32 + 1) / VMX_EPT_PAGE_SIZE_2MB;
+	}
+
+	if ((ShvVmxEptCapabilities & VMX_EPT_CAP_PDPTE_1GB) == 0)
+	{
+		pages += ((ULONG64)MAXULONG32 + 1) / VMX_EPT_PAGE_SIZE_1GB;
+	}
+
+	for (address = 0; address < ShvMemMapGetTopOfRam(); address = end)
+	{
+		if (ShvMemMapLookup(address, &end) != ShvMemoryRam)
+		{
+			continue;
+		}
+
+		size = end - address;
+
+		pages += 2 * (VMX_EPT_PAGE_WALK_LENGTH - 1);
+		pages += size / SHV_EPT_TABLE_SPAN(3);
+
+		if ((ShvVmxEptCapabilities & VMX_EPT_CAP_PDE_2MB) == 0)
+		{
+			pages += size / SHV_EPT_TABLE_SPAN(1);
+		}
+
+		if ((ShvVmxEptCapabilities & VMX_EPT_CAP_PDPTE_1GB) == 0)
+		{
+			pages += size / SHV_EPT_TABLE_SPAN(2);
+		}
+	}
+
+	return (ULONG)min(pages, MAXULONG);
+}
+
+static NTSTATUS
+ShvVmxEptArenaGrow(
+	ULONG pages,
+	ULONG node
+)
+{
+	PSHV_EPT_ARENA_CHUNK chunk;
+	volatile LONG *references;
+	ULONG64 basePfn, frames;
+	KIRQL oldIrql;
+	PUCHAR base;
+	ULONG index;
+
+	if (ShvVmxEptArena.ChunkCount == SHV_EPT_ARENA_MAX_CHUNKS)
+	{
+		return STATUS_HV_INSUFFICIENT_MEMORY;
+	}
+
+	pages = max(pages, SHV_EPT_ARENA_CHUNK_PAGES);
+
+	//
+	// Ask for a physically contiguous chunk, settling for smaller ones if
+	// physical memory is too fragmented for the size we want.
+	//
+	for (;;)
+	{
+		base = (PUCHAR)ShvUtilAllocateContiguousNodeMemory((SIZE_T)pages * PAGE_SIZE, node);
+		if (base != NULL)
+		{
+			break;
+		}
+
+		if (pages == SHV_EPT_ARENA_CHUNK_PAGES)
+		{
+			return STATUS_HV_INSUFFICIENT_MEMORY;
+		}
+
+		pages = max(pages / 2, SHV_EPT_ARENA_CHUNK_PAGES);
+	}
+
+	references = (volatile LONG *)ExAllocatePoolWithTag(NonPagedPoolNx,
+		(SIZE_T)pages * sizeof(LONG),
+		'EPT ');
+	if (references == NULL)
+	{
+		MmFreeContiguousMemory(base);
+		return STATUS_HV_INSUFFICIENT_MEMORY;
+	}
+
+	//
+	// Fill the whole chunk with empty entries up front so that handing out
+	// a table never has to.
+	//
+	__stosq((PULONG64)base, ShvVmxEptEmpty, (SIZE_T)pages * PAGE_SIZE / sizeof(ULONG64));
+	__stosd((PULONG)references, 0, pages);
+
+	basePfn = SHV_PHYS_TO_PFN(MmGetPhysicalAddress(base).QuadPart);
+
+	//
+	// Hot-added memory can grow the arena while a view or replica is being
+	// built on another LP, so claiming the slot and indexing the chunk
+	// happen under the lock.  The chunk touches at most two more frames
+	// than it has whole ones, in each address space.
+	//
+	frames = 2 * ((ULONG64)pages * PAGE_SIZE / (1ULL << SHV_EPT_ARENA_FRAME_SHIFT) + 2);
+
+	KeAcquireSpinLock(&ShvVmxEptArenaLock, &oldIrql);
+
+	index = ShvVmxEptArena.ChunkCount;
+
+	if ((index == SHV_EPT_ARENA_MAX_CHUNKS) ||
+		(ShvVmxEptArena.IndexCount + frames > SHV_EPT_ARENA_INDEX_LIMIT))
+	{
+		KeReleaseSpinLock(&ShvVmxEptArenaLock, oldIrql);
+		ExFreePoolWithTag((PVOID)references, 'EPT ');
+		MmFreeContiguousMemory(base);
+		return STATUS_HV_INSUFFICIENT_MEMORY;
+	}
+
+	chunk = &ShvVmxEptArena.Chunks[index];
+	chunk->Base = base;
+	chunk->BasePfn = basePfn;
+	chunk->Pages = pages;
+	chunk->Node = node;
+	chunk->Used = 0;
+	chunk->References = references;
+
+	ShvVmxEptArenaIndexInsert(ShvVmxEptArena.PhysicalIndex,
+		basePfn >> (SHV_EPT_ARENA_FRAME_SHIFT - PAGE_SHIFT),
+		(basePfn + pages - 1) >> (SHV_EPT_ARENA_FRAME_SHIFT - PAGE_SHIFT),
+		index);
+
+	ShvVmxEptArenaIndexInsert(ShvVmxEptArena.VirtualIndex,
+		(ULONG_PTR)base >> SHV_EPT_ARENA_FRAME_SHIFT,
+		((ULONG_PTR)base + (SIZE_T)pages * PAGE_SIZE - 1) >> SHV_EPT_ARENA_FRAME_SHIFT,
+		index);
+
+	//
+	// Only publish the chunk once it is fully initialized and indexed.
+	//
+	InterlockedExchange((volatile LONG *)&ShvVmxEptArena.ChunkCount, index + 1);
+
+	KeReleaseSpinLock(&ShvVmxEptArenaLock, oldIrql);
+
+	return STATUS_SUCCESS;
+}
+
+static VOID
+ShvVmxEptArenaFree(
+	VOID
+)
+{
+	//
+	// Every table lives in one of the chunks, so tearing down the whole
+	// hierarchy is just a free per chunk.
+	//
+	for (ULONG i = 0; i < ShvVmxEptArena.ChunkCount; i++)
+	{
+		MmFreeContiguousMemory(ShvVmxEptArena.Chunks[i].Base);
+		ExFreePoolWithTag((PVOID)ShvVmxEptArena.Chunks[i].References, 'EPT ');
+	}
+
+	__stosb((PUCHAR)&ShvVmxEptArena, 0, sizeof(ShvVmxEptArena));
+}
+
+static PVMX_EPT_ENTRY
+ShvVmxEptAllocateTable(
+	ULONG node
+)
+{
+	PSHV_EPT_ARENA_CHUNK chunk;
+	PVMX_EPT_ENTRY table;
+	PSLIST_ENTRY free;
+	LONG index;
+
+	//
+	// Reuse a table that lost an installation race or was retired first,
+	// from the free list of the node.  Only its first bytes were used as
+	// the list link, so make them an empty entry again.  Callers that
+	// don't care where the table is take one from any node.
+	//
+	free = InterlockedPopEntrySList(SHV_EPT_FREE_LIST(node));
+	if (free == NULL)
+	{
+		ShvVmxEptReclaimTables();
+		free = InterlockedPopEntrySList(SHV_EPT_FREE_LIST(node));
+	}
+
+	for (ULONG i = 0; free == NULL && node == MM_ANY_NODE_OK && i < SHV_EPT_MAX_NODES; i++)
+	{
+		free = InterlockedPopEntrySList(&ShvVmxEptArena.FreeLists[i]);
+	}
+
+	if (free != NULL)
+	{
+		table = (PVMX_EPT_ENTRY)free;
+		table[0].QuadPart = ShvVmxEptEmpty;
+
+		//
+		// The table starts out referenced by the one entry it is about to
+		// be installed in.
+		//
+		*ShvVmxEptGetReferences(table) = 1;
+
+		return table;
+	}
+
+	//
+	// Carve the next pre-zeroed page out of the first chunk of the node
+	// that still has one.  This never allocates memory, so it is safe in
+	// root mode.
+	//
+	for (ULONG i = 0; i < ShvVmxEptArena.ChunkCount; i++)
+	{
+		chunk = &ShvVmxEptArena.Chunks[i];
+
+		if (chunk->Node != node || (ULONG)chunk->Used >= chunk->Pages)
+		{
+			continue;
+		}
+
+		index = InterlockedIncrement(&chunk->Used) - 1;
+		if ((ULONG)index < chunk->Pages)
+		{
+			chunk->References[index] = 1;
+			return (PVMX_EPT_ENTRY)(chunk->Base + (SIZE_T)index * PAGE_SIZE);
+		}
+	}
+
+	//
+	// The arena is exhausted.  Record it so it can be reported instead of
+	// failing silently.
+	//
+	InterlockedIncrement(&ShvVmxEptArena.Exhausted);
+
+	return NULL;
+}
+
+static VOID
+ShvVmxEptFreeTable(
+	PVMX_EPT_ENTRY table
+)
+{
+	//
+	// The table is either one that was never made visible to the processor
+	// or a retired one that was zeroed again, so it can go straight back on
+	// the free list of its node.
+	//
+	InterlockedPushEntrySList(SHV_EPT_FREE_LIST(ShvVmxEptGetTableNode(table)), (PSLIST_ENTRY)table);
+}
+
+static volatile LONG *
+ShvVmxEptGetReferences(
+	PVMX_EPT_ENTRY table
+)
+{
+	PSHV_EPT_ARENA_CHUNK chunk;
+
+	chunk = ShvVmxEptFindChunkByVa(table);
+	if (chunk == NULL)
+	{
+		NT_ASSERTMSG("Table is not in the EPT arena", FALSE);
+		return NULL;
+	}
+
+	return &chunk->References[((PUCHAR)table - chunk->Base) / PAGE_SIZE];
+}
+
+static BOOLEAN
+ShvVmxEptReferenceTable(
+	PVMX_EPT_ENTRY table
+)
+{
+	volatile LONG *references;
+	LONG count;
+
+	//
+	// Add a reference for a new entry pointing at the table, unless the
+	// last one is already gone.  That only happens when the table was just
+	// unlinked and is on its way to being retired, so the entry that
+	// pointed at it holds something else by now.
+	//
+	references = ShvVmxEptGetReferences(table);
+
+	for (;;)
+	{
+		count = *references;
+		if (count == 0)
+		{
+			return FALSE;
+		}
+
+		if (InterlockedCompareExchange(references, count + 1, count) == count)
+		{
+			return TRUE;
+		}
+	}
+}
+
+static VOID
+ShvVmxEptReleaseTable(
+	PVMX_EPT_ENTRY table
+)
+{
+	//
+	// Drop the reference of an entry that no longer points at the table.
+	// Once none do, retire it.  Only tables without tables below them ever
+	// lose their last reference, so there is nothing to release under it.
+	//
+	if (InterlockedDecrement(ShvVmxEptGetReferences(table)) == 0)
+	{
+		ShvVmxEptRetireTable(table);
+	}
+}
+
+static ULONG64
+ShvVmxEptMakeLeaf(
+	ULONG level,
+	ULONG64 address,
+	ULONG access,
+	UCHAR type
+)
+{
+	NT_ASSERT(level <= 3 && level >= 1);
+
+	//
+	// PTEs map a 4 KiB page, and PDEs and PDPTEs with the P bit set map
+	// a 2 MiB or 1 GiB page directly.
+	//
+	if (level == 1)
+	{
+		VMX_EPT_PTE pte = { 0 };
+
+		pte.R = (access & VMX_EPT_ACCESS_READ) ? 1 : 0;
+		pte.W = (access & VMX_EPT_ACCESS_WRITE) ? 1 : 0;
+		pte.X = (access & VMX_EPT_ACCESS_EXECUTE) ? 1 : 0;
+		pte.MT = type;
+		pte.SVE = ShvVmxEptVeEnabled;
+		pte.PFN = SHV_PHYS_TO_PFN(address);
+
+		return pte.QuadPart;
+	}
+	else if (level == 2)
+	{
+		VMX_EPT_PDE pde = { 0 };
+
+		pde.R = (access & VMX_EPT_ACCESS_READ) ? 1 : 0;
+		pde.W = (access & VMX_EPT_ACCESS_WRITE) ? 1 : 0;
+		pde.X = (access & VMX_EPT_ACCESS_EXECUTE) ? 1 : 0;
+		pde.MT = type;
+		pde.SVE = ShvVmxEptVeEnabled;
+		pde.P = 1;
+		pde.PFN = address >> 21;
+
+		return pde.QuadPart;
+	}
+	else
+	{
+		VMX_EPT_PDPTE pdpte = { 0 };
+
+		pdpte.R = (access & VMX_EPT_ACCESS_READ) ? 1 : 0;
+		pdpte.W = (access & VMX_EPT_ACCESS_WRITE) ? 1 : 0;
+		pdpte.X = (access & VMX_EPT_ACCESS_EXECUTE) ? 1 : 0;
+		pdpte.MT = type;
+		pdpte.SVE = ShvVmxEptVeEnabled;
+		pdpte.P = 1;
+		pdpte.PFN = address >> 30;
+
+		return pdpte.QuadPart;
+	}
+}
+
+static ULONG
+ShvVmxEptLeafLevel(
+	ULONG64 address,
+	ULONG64 end
+)
+{
+	if (ShvVmxEptSmallPages)
+	{
+		return 1;
+	}
+
+	//
+	// Use a 1 GiB page if the processor supports them and the rest of the
+	// range covers a whole naturally aligned 1 GiB region.
+	//
+	if ((ShvVmxEptCapabilities & VMX_EPT_CAP_PDPTE_1GB) &&
+		(address & (VMX_EPT_PAGE_SIZE_1GB - 1)) == 0 &&
+		(end - address) >= VMX_EPT_PAGE_SIZE_1GB)
+	{
+		return 3;
+	}
+
+	//
+	// Otherwise fall back to a 2 MiB page under the same conditions.
+	//
+	if ((ShvVmxEptCapabilities & VMX_EPT_CAP_PDE_2MB) &&
+		(address & (VMX_EPT_PAGE_SIZE_2MB - 1)) == 0 &&
+		(end - address) >= VMX_EPT_PAGE_SIZE_2MB)
+	{
+		return 2;
+	}
+
+	return 1;
+}
+
+static VOID
+ShvVmxEptCursorInitialize(
+	PSHV_EPT_CURSOR cursor,
+	PVMX_EPT_ENTRY root
+)
+{
+	//
+	// Only the root table is known up front.  Lower tables are filled in
+	// as the cursor walks down the hierarchy.
+	//
+	for (ULONG l = 0; l <= VMX_EPT_PAGE_WALK_LENGTH; l++)
+	{
+		cursor->Table[l] = NULL;
+		cursor->Base[l] = 0;
+	}
+
+	cursor->Table[VMX_EPT_PAGE_WALK_LENGTH] = root;
+	cursor->Node = ShvVmxEptGetTableNode(root);
+}
+
+static NTSTATUS
+ShvVmxEptCursorWalk(
+	PSHV_EPT_CURSOR cursor,
+	ULONG64 address,
+	PULONG level,
+	PVMX_EPT_ENTRY *entry
+)
+{
+	PVMX_EPT_ENTRY e, next;
+	VMX_EPT_ENTRY value, table;
+	ULONG l;
+
+	//
+	// Start from the lowest table the cursor already holds that covers the
+	// address, so that consecutive calls within the same PT, PD or PDPT
+	// don't walk down from the PML4 again.
+	//
+	for (l = *level; l < VMX_EPT_PAGE_WALK_LENGTH; l++)
+	{
+		if (cursor->Table[l] != NULL &&
+			cursor->Base[l] == (address & ~(SHV_EPT_TABLE_SPAN(l) - 1)))
+		{
+			break;
+		}
+	}
+
+	for (;;)
+	{
+		e = &cursor->Table[l][SHV_EPT_INDEX(address, l)];
+
+		//
+		// Other VPs can install entries at any time, so only ever look at a
+		// single snapshot of the entry.
+		//
+		value.QuadPart = *(volatile ULONG64 *)&e->QuadPart;
+
+		//
+		// Stop at the PTE, at an existing large page that already maps the
+		// address, or at an empty entry at the level the caller asked for.
+		//
+		if (l == 1 ||
+			SHV_EPT_ENTRY_IS_LARGE(&value, l) ||
+			(l == *level && value.QuadPart == ShvVmxEptEmpty))
+		{
+			break;
+		}
+
+		if (value.QuadPart == ShvVmxEptEmpty)
+		{
+			next = ShvVmxEptAllocateTable(cursor->Node);
+			if (next == NULL)
+			{
+				return STATUS_HV_NO_RESOURCES;
+			}
+
+			table.QuadPart = 0;
+			table.R = 1;
+			table.W = 1;
+			table.X = 1;
+			table.PFN = ShvVmxEptGetPfnFromVirtual(next);
+
+			value.QuadPart = InterlockedCompareExchange64(
+				(volatile LONG64 *)&e->QuadPart,
+				table.QuadPart,
+				ShvVmxEptEmpty
+			);
+
+			if (value.QuadPart != ShvVmxEptEmpty)
+			{
+				//
+				// Another VP installed an entry first.  Give our table back
+				// and look at the entry again, which is either the winner's
+				// table or a large page.
+				//
+				ShvVmxEptFreeTable(next);
+				continue;
+			}
+		}
+		else
+		{
+			//
+			// Part of a region the caller wanted to map with a large page
+			// is already mapped with smaller pages, so map it one level
+			// further down instead.
+			//
+			if (l == *level)
+			{
+				(*level)--;
+			}
+
+			next = (PVMX_EPT_ENTRY)ShvVmxEptGetVirtualFromPfn(value.PFN);
+		}
+
+		l--;
+		cursor->Table[l] = next;
+		cursor->Base[l] = address & ~(SHV_EPT_TABLE_SPAN(l) - 1);
+	}
+
+	*level = l;
+	*entry = e;
+
+	return STATUS_SUCCESS;
+}
+
+static NTSTATUS
+_ShvVmxEptMapRange(
+	PSHV_EPT_CURSOR cursor,
+	ULONG64 start,
+	ULONG64 end,
+	ULONG access,
+	UCHAR type,
+	PSHV_EPT_FLUSH flush
+)
+{
+	PVMX_EPT_ENTRY table, entry;
+	VMX_EPT_ENTRY old, leaf;
+	ULONG64 address, size;
+	ULONG level, index;
+	NTSTATUS ret;
+
+	address = start & ~(PAGE_SIZE - 1);
+
+	while (address < end)
+	{
+		//
+		// Find the table that holds the entry for this address at the
+		// largest level the range allows.
+		//
+		level = ShvVmxEptLeafLevel(address, end);
+
+		ret = ShvVmxEptCursorWalk(cursor, address, &level, &entry);
+		if (ret != STATUS_SUCCESS)
+		{
+			return ret;
+		}
+
+		size = SHV_EPT_LEVEL_SIZE(level);
+
+		//
+		// Existing mappings are left alone.  Skip over the whole region
+		// the entry maps.
+		//
+		if (*(volatile ULONG64 *)&entry->QuadPart != ShvVmxEptEmpty)
+		{
+			address = (address & ~(size - 1)) + size;
+			continue;
+		}
+
+		//
+		// Fill consecutive entries of the table while the range stays
+		// inside of it and keeps the same page size.
+		//
+		table = cursor->Table[level];
+		index = SHV_EPT_INDEX(address, level);
+
+		do
+		{
+			//
+			// If another VP got to the entry first, leave its mapping alone
+			// and let the next walk skip over it.
+			//
+			leaf.QuadPart = ShvVmxEptMakeLeaf(level, address, access, type);
+
+			old.QuadPart = InterlockedCompareExchange64(
+				(volatile LONG64 *)&table[index].QuadPart,
+				leaf.QuadPart,
+				ShvVmxEptEmpty
+			);
+
+			if (old.QuadPart != ShvVmxEptEmpty)
+			{
+				break;
+			}
+
+			*flush = max(*flush, ShvVmxEptClassifyChange(old, leaf, level));
+
+			address += size;
+			index++;
+		} while (index < PAGE_SIZE / sizeof(VMX_EPT_ENTRY) &&
+			address < end &&
+			ShvVmxEptLeafLevel(address, end) == level);
+	}
+
+	return STATUS_SUCCESS;
+}
+
+static NTSTATUS
+ShvVmxEptMapRootRange(
+	PVMX_EPT_ENTRY root,
+	ULONG64 start,
+	ULONG64 end,
+	ULONG access,
+	UCHAR type
+)
+{
+	SHV_EPT_CURSOR cursor;
+	SHV_EPT_FLUSH flush;
+	NTSTATUS ret;
+
+	//
+	// Walk the range with a cursor, which reuses the PDPT, PD and PT it is
+	// in until the range leaves them.  Entries are installed with a compare
+	// and swap, so no lock is needed and VPs mapping different regions at
+	// the same time never wait on each other.
+	//
+	ShvVmxEptCursorInitialize(&cursor, root);
+
+	flush = ShvEptFlushNone;
+
+	ret = _ShvVmxEptMapRange(&cursor, start, end, access, type, &flush);
+
+	//
+	// Only empty entries are ever filled in, so this never needs to flush
+	// anything today, but it keeps every change going through the same
+	// classification.
+	//
+	ShvVmxEptCommitChange(flush);
+
+	return ret;
+}
+
+static NTSTATUS
+ShvVmxEptIdentityMapRange(
+	PVMX_EPT_ENTRY root,
+	ULONG64 start,
+	ULONG64 end,
+	BOOLEAN grow
+)
+{
+	ULONG64 address, typeEnd;
+	NTSTATUS ret;
+	UCHAR type;
+
+	//
+	// Split the range wherever the MTRRs change the memory type, so that
+	// each call maps a uniformly typed range.  Large pages are only ever
+	// used for regions that are entirely contained in one such range, so a
+	// region is never split between RAM and MMIO or between memory types.
+	//
+	address = start & ~(PAGE_SIZE - 1);
+
+	while (address < end)
+	{
+		type = ShvMtrrLookup(address, &typeEnd);
+		typeEnd = min(typeEnd, end);
+
+		ret = ShvVmxEptMapRootRange(root, address, typeEnd, VMX_EPT_ACCESS_RWX, type);
+		if (ret == STATUS_HV_NO_RESOURCES && grow)
+		{
+			//
+			// We're not in root mode yet, so the arena can still grow.
+			// Mapping skips whatever is already mapped, so just retry.
+			//
+			ret = ShvVmxEptArenaGrow(SHV_EPT_ARENA_CHUNK_PAGES, ShvVmxEptGetTableNode(root));
+			if (ret != STATUS_SUCCESS) {
+				return ret;
+			}
+
+			continue;
+		}
+		else if (ret != STATUS_SUCCESS) {
+			return ret;
+		}
+
+		address = typeEnd;
+	}
+
+	return STATUS_SUCCESS;
+}
+
+static NTSTATUS
+ShvVmxEptIdentityMapRoots(
+	ULONG64 start,
+	ULONG64 end,
+	BOOLEAN grow
+)
+{
+	NTSTATUS ret;
+
+	//
+	// Map the range in every copy of the default view.  The identity map
+	// only ever fills in empty entries with the same leaves, so the copies
+	// never disagree on a translation, even while VPs on different nodes
+	// map the same range at once.
+	//
+	for (ULONG i = 0; i < ShvVmxEptRootCount; i++)
+	{
+		ret = ShvVmxEptIdentityMapRange(ShvVmxEptRoots[i], start, end, grow);
+		if (ret != STATUS_SUCCESS)
+		{
+			return ret;
+		}
+	}
+
+	return STATUS_SUCCESS;
+}
+
+static ULONG64
+ShvVmxEptFaultAroundBase(
+	ULONG64 address,
+	PULONG64 end
+)
+{
+	ULONG64 base;
+	UCHAR type;
+
+	//
+	// Map the whole 1 GiB region around the address if it can be a single
+	// large page, so the rest of it never faults.
+	//
+	base = address & ~(VMX_EPT_PAGE_SIZE_1GB - 1);
+
+	if ((ShvVmxEptCapabilities & VMX_EPT_CAP_PDPTE_1GB) &&
+		ShvMtrrGetMemoryType(base, VMX_EPT_PAGE_SIZE_1GB, &type))
+	{
+		*end = base + VMX_EPT_PAGE_SIZE_1GB;
+		return base;
+	}
+
+	//
+	// Otherwise map the 2 MiB region around it, which fills its whole PT
+	// when the memory types keep it from being a large page.
+	//
+	base = address & ~(VMX_EPT_PAGE_SIZE_2MB - 1);
+	*end = base + VMX_EPT_PAGE_SIZE_2MB;
+
+	return base;
+}
+
+static VOID
+_ShvVmxEptTryPromote(
+	PVMX_EPT_ENTRY root,
+	ULONG64 address,
+	ULONG level
+)
+{
+	PVMX_EPT_ENTRY table, child;
+	VMX_EPT_ENTRY entry, large;
+	ULONG64 base;
+
+	NT_ASSERT(level == 2 || level == 3);
+
+	if (ShvVmxEptSmallPages ||
+		(level == 2 && (ShvVmxEptCapabilities & VMX_EPT_CAP_PDE_2MB) == 0) ||
+		(level == 3 && (ShvVmxEptCapabilities & VMX_EPT_CAP_PDPTE_1GB) == 0))
+	{
+		return;
+	}
+
+	//
+	// Find the entry at the level that maps the address.  There is nothing
+	// to promote if it is empty or already a large page.
+	//
+	table = root;
+
+	for (ULONG l = VMX_EPT_PAGE_WALK_LENGTH; l > level; l--)
+	{
+		entry.QuadPart = *(volatile ULONG64 *)&table[SHV_EPT_INDEX(address, l)].QuadPart;
+
+		if (entry.QuadPart == ShvVmxEptEmpty || SHV_EPT_ENTRY_IS_LARGE(&entry, l))
+		{
+			return;
+		}
+
+		table = (PVMX_EPT_ENTRY)ShvVmxEptGetVirtualFromPfn(entry.PFN);
+	}
+
+	table = &table[SHV_EPT_INDEX(address, level)];
+
+	entry.QuadPart = *(volatile ULONG64 *)&table->QuadPart;
+	if (entry.QuadPart == ShvVmxEptEmpty || SHV_EPT_ENTRY_IS_LARGE(&entry, level))
+	{
+		return;
+	}
+
+	//
+	// The table below it can only be collapsed if every entry is a present
+	// leaf that maps the matching part of the region with the same bits as
+	// the first one, which is what a split of the large page would give.
+	// The accessed and dirty flags don't matter.
+	//
+	child = (PVMX_EPT_ENTRY)ShvVmxEptGetVirtualFromPfn(entry.PFN);
+	base = address & ~(SHV_EPT_LEVEL_SIZE(level) - 1);
+
+	if (SHV_EPT_ENTRY_ACCESS(&child[0]) == 0 ||
+		(child[0].QuadPart & SHV_EPT_PFN_MASK) != base)
+	{
+		return;
+	}
+
+	large.QuadPart = (child[0].QuadPart & ~(ULONG64)(VMX_EPT_ACCESSED | VMX_EPT_DIRTY)) | SHV_EPT_LARGE_PAGE;
+
+	for (ULONG i = 0; i < PAGE_SIZE / sizeof(VMX_EPT_ENTRY); i++)
+	{
+		if ((child[i].QuadPart & ~(ULONG64)(VMX_EPT_ACCESSED | VMX_EPT_DIRTY)) !=
+			ShvVmxEptMakeChild(large, level, i))
+		{
+			return;
+		}
+	}
+
+	//
+	// Replace the entry with a large page.  If anything changed it in the
+	// meantime, leave it alone.
+	//
+
+	if ((ULONG64)InterlockedCompareExchange64(
+		(volatile LONG64 *)&table->QuadPart,
+		large.QuadPart,
+		entry.QuadPart) != entry.QuadPart)
+	{
+		return;
+	}
+
+	//
+	// Processors may still hold the entry pointing at the table, so every
+	// VP has to flush before the table can be reused.  Other views may
+	// still use it, in which case it stays where it is.
+	//
+	ShvVmxEptCommitChange(ShvVmxEptClassifyChange(entry, large, level));
+
+	ShvVmxEptReleaseTable(child);
+}
+
+static VOID
+ShvVmxEptTryPromote(
+	ULONG64 address
+)
+{
+	//
+	// Views are changed under the view lock, which relies on nothing else
+	// changing entries that are present.  Promoting is only an
+	// optimization, so skip it rather than wait when a view is being
+	// changed.  Root mode can't wait for the lock anyway, since its holder
+	// may be the guest this LP was running.
+	//
+	if (!KeTryToAcquireSpinLockAtDpcLevel(&ShvVmxEptViewLock))
+	{
+		return;
+	}
+
+	//
+	// Every copy of the default view has its own PT for the region, so
+	// collapse them all.  A new 2 MiB page may in turn complete a PD.
+	//
+	for (ULONG i = 0; i < ShvVmxEptRootCount; i++)
+	{
+		_ShvVmxEptTryPromote(ShvVmxEptRoots[i], address, 2);
+		_ShvVmxEptTryPromote(ShvVmxEptRoots[i], address, 3);
+	}
+
+	KeReleaseSpinLockFromDpcLevel(&ShvVmxEptViewLock);
+}
+
+static VOID
+ShvVmxEptMergeRange(
+	PVMX_EPT_ENTRY root,
+	ULONG64 start,
+	ULONG64 end
+)
+{
+	ULONG64 address;
+
+	//
+	// Collapse PTs into 2 MiB pages first, since those are what a PD needs
+	// to collapse into a 1 GiB page.  Collapsing is always a global change,
+	// which is only ever recorded, so this is fine outside of root mode.
+	//
+	for (address = start & ~(VMX_EPT_PAGE_SIZE_2MB - 1); address < end; address += VMX_EPT_PAGE_SIZE_2MB)
+	{
+		_ShvVmxEptTryPromote(root, address, 2);
+	}
+
+	for (address = start & ~(VMX_EPT_PAGE_SIZE_1GB - 1); address < end; address += VMX_EPT_PAGE_SIZE_1GB)
+	{
+		_ShvVmxEptTryPromote(root, address, 3);
+	}
+}
+
+static BOOLEAN
+ShvVmxEptDispatchViolation(
+	PSHV_VP_STATE VpState,
+	ULONG64 gpa,
+	ULONG access
+)
+{
+	PSHV_EPT_VIOLATION_HANDLER handler;
+
+	for (ULONG i = 0; i < SHV_EPT_MAX_HANDLERS; i++)
+	{
+		handler = ShvVmxEptHandlers[i];
+
+		if (handler != NULL && handler(VpState, gpa, access))
+		{
+			return TRUE;
+		}
+	}
+
+	return FALSE;
+}
+
+static VOID
+ShvVmxEptRetireTable(
+	PVMX_EPT_ENTRY table
+)
+{
+	PSHV_EPT_RETIRED_TABLE slot;
+
+	//
+	// Park the table until every VP has flushed past the current
+	// generation.  The table itself is left untouched, since processors
+	// that haven't flushed yet could still walk through it.  If there is
+	// no free slot the table is simply never reused.
+	//
+	for (ULONG i = 0; i < SHV_EPT_RETIRED_TABLES; i++)
+	{
+		slot = &ShvVmxEptArena.Retired[i];
+
+		if (InterlockedCompareExchangePointer(
+			(PVOID volatile *)&slot->Table,
+			SHV_EPT_RETIRED_BUSY,
+			NULL) != NULL)
+		{
+			continue;
+		}
+
+		slot->Generation = ShvVmxEptGeneration;
+		InterlockedExchangePointer((PVOID volatile *)&slot->Table, table);
+		InterlockedIncrement(&ShvVmxEptArena.RetiredCount);
+		return;
+	}
+}
+
+static VOID
+ShvVmxEptReclaimTables(
+	VOID
+)
+{
+	PSHV_EPT_RETIRED_TABLE slot;
+	PVMX_EPT_ENTRY table;
+	ULONG64 generation;
+	ULONG count;
+
+	if (ShvVmxEptArena.RetiredCount == 0 || ShvGlobalData == NULL)
+	{
+		return;
+	}
+
+	//
+	// A retired table can be reused once every VP has flushed at a
+	// generation newer than the one it was retired at, since a flush at
+	// that same generation may have happened before the table was unlinked.
+	// Flushing also means the VP has finished any walk that started before.
+	//
+	// VPs that aren't running the guest don't hold anything, and VPs that
+	// are but haven't exited in a while are covered by the last completed
+	// shootdown, so an idle VP doesn't keep tables parked forever.
+	//
+	generation = MAXULONG64;
+	count = KeQueryActiveProcessorCountEx(ALL_PROCESSOR_GROUPS);
+
+	for (ULONG i = 0; i < count; i++)
+	{
+		if (ShvGlobalData->VpData[i].VmxEnabled == 0)
+		{
+			continue;
+		}
+
+		generation = min(generation, ShvGlobalData->VpData[i].EptGeneration);
+	}
+
+	generation = max(generation, (ULONG64)ShvVmxEptFlushedGeneration);
+
+	for (ULONG i = 0; i < SHV_EPT_RETIRED_TABLES; i++)
+	{
+		slot = &ShvVmxEptArena.Retired[i];
+		table = slot->Table;
+
+		if (table == NULL ||
+			table == SHV_EPT_RETIRED_BUSY ||
+			slot->Generation >= generation)
+		{
+			continue;
+		}
+
+		if (InterlockedCompareExchangePointer(
+			(PVOID volatile *)&slot->Table,
+			SHV_EPT_RETIRED_BUSY,
+			table) != table)
+		{
+			continue;
+		}
+
+		//
+		// Nothing can reach the table anymore.  Empty it and make it
+		// available again.
+		//
+		__stosq((PULONG64)table, ShvVmxEptEmpty, PAGE_SIZE / sizeof(ULONG64));
+		ShvVmxEptFreeTable(table);
+
+		InterlockedDecrement(&ShvVmxEptArena.RetiredCount);
+		InterlockedExchangePointer((PVOID volatile *)&slot->Table, NULL);
+	}
+}
+
+static NTSTATUS
+ShvVmxEptCollectIdentityRanges(
+	PSHV_EPT_BUILD build
+)
+{
+	ULONG64 address, end, limit;
+	SHV_MEMORY_CLASS class;
+	ULONG count;
+
+	//
+	// Every RAM range gets an identity mapping, using large pages wherever
+	// the range allows.  We don't enumerate the hardware mapped MMIO, so
+	// the holes between RAM ranges in the first 4 GiB are mapped too, to be
+	// sure we cover them all.  Keeping RAM and holes apart keeps large
+	// pages from spanning both RAM and MMIO.
+	//
+	limit = max(ShvMemMapGetTopOfRam(), (ULONG64)MAXULONG32 + 1);
+
+	for (count = 0, address = 0; address < limit; address = end)
+	{
+		ShvMemMapLookup(address, &end);
+		count++;
+	}
+
+	build->Ranges = (PSHV_EPT_IDENTITY_RANGE)ExAllocatePoolWithTag(NonPagedPoolNx,
+		count * sizeof(SHV_EPT_IDENTITY_RANGE),
+		'EPT ');
+	if (build->Ranges == NULL)
+	{
+		return STATUS_HV_NO_RESOURCES;
+	}
+
+	build->Count = 0;
+
+	for (address = 0; address < limit; address = end)
+	{
+		class = ShvMemMapLookup(address, &end);
+
+		if (class == ShvMemoryRam)
+		{
+			build->Ranges[build->Count].Start = address;
+			build->Ranges[build->Count].End = end;
+			build->Count++;
+		}
+		else if (address < (ULONG64)MAXULONG32 + 1)
+		{
+			build->Ranges[build->Count].Start = address;
+			build->Ranges[build->Count].End = min(end, (ULONG64)MAXULONG32 + 1);
+			build->Count++;
+		}
+	}
+
+	build->SliceCount = (ULONG)((limit + SHV_EPT_BUILD_SLICE_SIZE - 1) / SHV_EPT_BUILD_SLICE_SIZE);
+	build->NextSlice = 0;
+	build->Status = STATUS_SUCCESS;
+
+	return STATUS_SUCCESS;
+}
+
+static VOID
+ShvVmxEptBuildSlices(
+	PSHV_EPT_BUILD build
+)
+{
+	ULONG64 sliceStart, sliceEnd, start, end;
+	NTSTATUS ret;
+	LONG slice;
+
+	//
+	// Keep claiming slices until there are none left or someone failed.
+	// Each slice is mapped exactly as the serial build would map it, since
+	// large pages never cross a slice boundary and the ranges never
+	// overlap.  Entries are installed with a compare and swap, so slices
+	// that share a PML4E or PDPTE can safely be built at the same time.
+	//
+	while (build->Status == STATUS_SUCCESS)
+	{
+		slice = InterlockedIncrement(&build->NextSlice) - 1;
+		if ((ULONG)slice >= build->SliceCount)
+		{
+			break;
+		}
+
+		sliceStart = (ULONG64)slice * SHV_EPT_BUILD_SLICE_SIZE;
+		sliceEnd = sliceStart + SHV_EPT_BUILD_SLICE_SIZE;
+
+		for (ULONG i = 0; i < build->Count; i++)
+		{
+			start = max(build->Ranges[i].Start, sliceStart);
+			end = min(build->Ranges[i].End, sliceEnd);
+
+			if (start >= end)
+			{
+				continue;
+			}
+
+			//
+			// The arena can't grow from a DPC.  If it runs out, record it
+			// and let the loading thread finish the build.
+			//
+			ret = ShvVmxEptIdentityMapRange(ShvVmxEptPML4, start, end, FALSE);
+			if (ret != STATUS_SUCCESS)
+			{
+				InterlockedCompareExchange(&build->Status, ret, STATUS_SUCCESS);
+				return;
+			}
+		}
+	}
+}
+
+VOID
+ShvVmxEptBuildDpc(
+	_In_ PRKDPC Dpc,
+	_In_opt_ PVOID Context,
+	_In_opt_ PVOID SystemArgument1,
+	_In_opt_ PVOID SystemArgument2
+)
+{
+	UNREFERENCED_PARAMETER(Dpc);
+	UNREFERENCED_PARAMETER(SystemArgument2);
+	NT_VERIFY(ARGUMENT_PRESENT(Context));
+	NT_VERIFY(ARGUMENT_PRESENT(SystemArgument1));
+
+	ShvVmxEptBuildSlices((PSHV_EPT_BUILD)Context);
+
+	//
+	// Mark the DPC as being complete
+	//
+	KeSignalCallDpcDone(SystemArgument1);
+}
+
+static NTSTATUS
+ShvVmxEptBuildIdentityTables(
+	VOID
+)
+{
+	SHV_EPT_BUILD build;
+	NTSTATUS ret;
+
+	ret = ShvVmxEptCollectIdentityRanges(&build);
+	if (ret != STATUS_SUCCESS)
+	{
+		return ret;
+	}
+
+	//
+	// Build the slices on every LP at once.  KeGenericCallDpc only returns
+	// once every LP is done.
+	//
+	KeGenericCallDpc(ShvVmxEptBuildDpc, &build);
+
+	//
+	// If the arena ran out, grow it and finish serially.  Mapping skips
+	// whatever the LPs already mapped, so the result is the same.
+	//
+	ret = build.Status;
+
+	if (ret == STATUS_HV_NO_RESOURCES)
+	{
+		for (ULONG i = 0; i < build.Count; i++)
+		{
+			ret = ShvVmxEptIdentityMapRange(ShvVmxEptPML4, build.Ranges[i].Start, build.Ranges[i].End, TRUE);
+			if (ret != STATUS_SUCCESS) {
+				break;
+			}
+		}
+	}
+
+	ExFreePoolWithTag(build.Ranges, 'EPT ');
+
+	return ret;
+}
+
+static ULONG
+ShvVmxEptWorkingSetBucket(
+	ULONG pages
+)
+{
+	ULONG index;
+
+	//
+	// Bucket 0 holds regions with no pages, and bucket n those with
+	// between 2^(n-1) and 2^n - 1 pages.
+	//
+	if (pages == 0)
+	{
+		return 0;
+	}
+
+	_BitScanReverse(&index, pages);
+
+	return min(index + 1, SHV_EPT_WS_BUCKETS - 1);
+}
+
+static VOID
+ShvVmxEptScanPt(
+	PVMX_EPT_ENTRY pt,
+	PSHV_EPT_WORKING_SET workingSet
+)
+{
+	__m128i entries, accessed, dirty, any, one, mask;
+	ULONG64 lanes[2];
+	ULONG accessedPages, dirtyPages;
+
+	//
+	// Count the A and D bits of the whole PT two entries at a time, and
+	// remember whether any were set at all so that a PT nobody touched
+	// doesn't have to be written to.
+	//
+	accessed = _mm_setzero_si128();
+	dirty = _mm_setzero_si128();
+	any = _mm_setzero_si128();
+	one = _mm_set1_epi64x(1);
+	mask = _mm_set1_epi64x(VMX_EPT_ACCESSED | VMX_EPT_DIRTY);
+
+	for (ULONG i = 0; i < PAGE_SIZE / sizeof(VMX_EPT_ENTRY); i += 2)
+	{
+		entries = _mm_load_si128((const __m128i *)&pt[i]);
+
+		accessed = _mm_add_epi64(accessed, _mm_and_si128(_mm_srli_epi64(entries, 8), one));
+		dirty = _mm_add_epi64(dirty, _mm_and_si128(_mm_srli_epi64(entries, 9), one));
+		any = _mm_or_si128(any, _mm_and_si128(entries, mask));
+	}
+
+	_mm_storeu_si128((__m128i *)lanes, accessed);
+	accessedPages = (ULONG)(lanes[0] + lanes[1]);
+
+	_mm_storeu_si128((__m128i *)lanes, dirty);
+	dirtyPages = (ULONG)(lanes[0] + lanes[1]);
+
+	workingSet->AccessedBytes += (ULONG64)accessedPages * PAGE_SIZE;
+	workingSet->DirtyBytes += (ULONG64)dirtyPages * PAGE_SIZE;
+	workingSet->Accessed[ShvVmxEptWorkingSetBucket(accessedPages)]++;
+	workingSet->Dirty[ShvVmxEptWorkingSetBucket(dirtyPages)]++;
+
+	if (_mm_movemask_epi8(_mm_cmpeq_epi8(any, _mm_setzero_si128())) == 0xffff)
+	{
+		return;
+	}
+
+	//
+	// The processor sets the flags with atomic updates, so clear them the
+	// same way to avoid losing other changes to the entry.
+	//
+	for (ULONG i = 0; i < PAGE_SIZE / sizeof(VMX_EPT_ENTRY); i++)
+	{
+		if (pt[i].QuadPart & (VMX_EPT_ACCESSED | VMX_EPT_DIRTY))
+		{
+			InterlockedAnd64((volatile LONG64 *)&pt[i].QuadPart, ~(LONG64)(VMX_EPT_ACCESSED | VMX_EPT_DIRTY));
+		}
+	}
+}
+
+static VOID
+ShvVmxEptScanTable(
+	PVMX_EPT_ENTRY table,
+	ULONG level,
+	PSHV_EPT_WORKING_SET workingSet
+)
+{
+	VMX_EPT_ENTRY entry;
+	ULONG64 regions;
+
+	NT_ASSERT(level >= 2);
+
+	for (ULONG i = 0; i < PAGE_SIZE / sizeof(VMX_EPT_ENTRY); i++)
+	{
+		entry.QuadPart = *(volatile ULONG64 *)&table[i].QuadPart;
+
+		//
+		// The processor sets the A flag at every level it walks through,
+		// so nothing under an entry without it was touched since the last
+		// scan and the whole subtree can be skipped.
+		//
+		if ((entry.QuadPart & VMX_EPT_ACCESSED) == 0)
+		{
+			continue;
+		}
+
+		if (SHV_EPT_ENTRY_IS_LARGE(&entry, level))
+		{
+			//
+			// A large page only tells us the whole of it was touched.
+			//
+			regions = SHV_EPT_LEVEL_SIZE(level) / VMX_EPT_PAGE_SIZE_2MB;
+
+			workingSet->AccessedBytes += SHV_EPT_LEVEL_SIZE(level);
+			workingSet->Accessed[ShvVmxEptWorkingSetBucket(512)] += regions;
+
+			if (entry.QuadPart & VMX_EPT_DIRTY)
+			{
+				workingSet->DirtyBytes += SHV_EPT_LEVEL_SIZE(level);
+				workingSet->Dirty[ShvVmxEptWorkingSetBucket(512)] += regions;
+			}
+			else
+			{
+				workingSet->Dirty[0] += regions;
+			}
+
+			InterlockedAnd64((volatile LONG64 *)&table[i].QuadPart, ~(LONG64)(VMX_EPT_ACCESSED | VMX_EPT_DIRTY));
+			continue;
+		}
+
+		InterlockedAnd64((volatile LONG64 *)&table[i].QuadPart, ~(LONG64)VMX_EPT_ACCESSED);
+
+		if (level == 2)
+		{
+			ShvVmxEptScanPt((PVMX_EPT_ENTRY)ShvVmxEptGetVirtualFromPfn(entry.PFN), workingSet);
+		}
+		else
+		{
+			ShvVmxEptScanTable((PVMX_EPT_ENTRY)ShvVmxEptGetVirtualFromPfn(entry.PFN), level - 1, workingSet);
+		}
+	}
+}
+
+VOID
+ShvVmxEptWorkingSetDpc(
+	_In_ PRKDPC Dpc,
+	_In_opt_ PVOID Context,
+	_In_opt_ PVOID SystemArgument1,
+	_In_opt_ PVOID SystemArgument2
+)
+{
+	SHV_EPT_WORKING_SET workingSet = { 0 };
+
+	UNREFERENCED_PARAMETER(Dpc);
+	UNREFERENCED_PARAMETER(Context);
+	UNREFERENCED_PARAMETER(SystemArgument1);
+	UNREFERENCED_PARAMETER(SystemArgument2);
+
+	//
+	// Sweep the tables, collecting and clearing the A and D flags.
+	//
+	ShvVmxEptScanTable(ShvVmxEptPML4, VMX_EPT_PAGE_WALK_LENGTH, &workingSet);
+
+	//
+	// Processors don't set the flags again for translations they have
+	// cached, so flush every VP once for the whole sweep.
+	//
+	ShvVmxEptShootdown();
+
+	KeAcquireSpinLockAtDpcLevel(&ShvVmxEptWorkingSetLock);
+
+	workingSet.Scans = ShvVmxEptWorkingSet.Scans + 1;
+	ShvVmxEptWorkingSet = workingSet;
+
+	KeReleaseSpinLockFromDpcLevel(&ShvVmxEptWorkingSetLock);
+}
+
+static VOID
+ShvVmxEptInvalidateEpt(
+	VOID
+)
+{
+	//
+	// Build the INVEPT descriptor.
+	//
+	struct {
+		VMX_EPT_EPTP Eptp;
+		ULONG64		 reserved0;
+	} invdesc = { 0 };
+
+	//
+	// With replicas, each LP only ever uses the one of its own node.
+	//
+	invdesc.Eptp = ShvVmxEptGetDefaultEptp();
+
+	//
+	// Invalidate the EPT.  Once there is more than one view, cached
+	// translations can belong to any of them, so invalidate them all.
+	//
+	if (ShvVmxEptViewCount <= 1)
+	{
+		__vmx_invept(1, &invdesc);
+	}
+	else if (ShvVmxEptCapabilities & VMX_EPT_CAP_INVEPT_ALL_CONTEXT)
+	{
+		__vmx_invept(2, &invdesc);
+	}
+	else
+	{
+		for (ULONG i = 0; i < ShvVmxEptViewCount; i++)
+		{
+			invdesc.Eptp = ShvVmxEptEptpList[i];
+			__vmx_invept(1, &invdesc);
+		}
+	}
+}
+
+static SHV_EPT_FLUSH
+ShvVmxEptClassifyChange(
+	VMX_EPT_ENTRY old,
+	VMX_EPT_ENTRY new,
+	ULONG level
+)
+{
+	//
+	// Not-present entries are never cached.
+	//
+	if (SHV_EPT_ENTRY_ACCESS(&old) == 0)
+	{
+		return ShvEptFlushNone;
+	}
+
+	//
+	// Adding permissions to an entry that still maps the same page the same
+	// way can only make a processor with the old copy take a spurious
+	// violation, which that VP handles with a local flush.
+	//
+	if ((old.QuadPart & ~(ULONG64)VMX_EPT_ACCESS_RWX) == (new.QuadPart & ~(ULONG64)VMX_EPT_ACCESS_RWX) &&
+		(SHV_EPT_ENTRY_ACCESS(&old) & ~SHV_EPT_ENTRY_ACCESS(&new)) == 0 &&
+		SHV_EPT_ENTRY_IS_LARGE(&old, level) == SHV_EPT_ENTRY_IS_LARGE(&new, level))
+	{
+		return ShvEptFlushLocal;
+	}
+
+	return ShvEptFlushGlobal;
+}
+
+static VOID
+ShvVmxEptCommitChange(
+	SHV_EPT_FLUSH flush
+)
+{
+	//
+	// This is only called in root mode, right after the change was made.
+	// Global changes are picked up by every VP, this one included, the next
+	// time it synchronizes.  Callers that need the other VPs to have flushed
+	// before they continue use ShvVmxEptShootdown instead.
+	//
+	switch (flush)
+	{
+	case ShvEptFlushNone:
+		break;
+	case ShvEptFlushLocal:
+		ShvVmxEptInvalidateEpt();
+		break;
+	case ShvEptFlushGlobal:
+		InterlockedIncrement64(&ShvVmxEptGeneration);
+		break;
+	}
+}
+
+static VMX_EPT_ENTRY
+ShvVmxEptLookup(
+	PVMX_EPT_ENTRY root,
+	ULONG64 address,
+	PULONG level,
+	PVMX_EPT_ENTRY *location
+)
+{
+	PVMX_EPT_ENTRY table;
+	VMX_EPT_ENTRY entry;
+	ULONG l;
+
+	//
+	// Walk down to the entry that maps the address without changing
+	// anything, and return a snapshot of it, as well as where it lives if
+	// the caller wants to change it.  The entry is empty if the address
+	// isn't mapped.
+	//
+	table = root;
+
+	for (l = VMX_EPT_PAGE_WALK_LENGTH; ; l--)
+	{
+		entry.QuadPart = *(volatile ULONG64 *)&table[SHV_EPT_INDEX(address, l)].QuadPart;
+
+		if (l == 1 || entry.QuadPart == ShvVmxEptEmpty || SHV_EPT_ENTRY_IS_LARGE(&entry, l))
+		{
+			break;
+		}
+
+		table = (PVMX_EPT_ENTRY)ShvVmxEptGetVirtualFromPfn(entry.PFN);
+	}
+
+	*level = l;
+
+	if (location != NULL)
+	{
+		*location = &table[SHV_EPT_INDEX(address, l)];
+	}
+
+	return entry;
+}
+
+static NTSTATUS
+ShvVmxEptCheckPageProtection(
+	const SHV_EPT_REGION *regions,
+	ULONG count,
+	ULONG clear,
+	ULONG set
+)
+{
+	//
+	// Writable pages have to stay readable, and pages that can lose read
+	// access but keep execute access need the processor to support
+	// execute-only pages.
+	//
+	if ((clear & ~VMX_EPT_ACCESS_RWX) != 0 ||
+		(set & ~VMX_EPT_ACCESS_RWX) != 0 ||
+		((set & VMX_EPT_ACCESS_WRITE) && !(set & VMX_EPT_ACCESS_READ)) ||
+		((clear & VMX_EPT_ACCESS_READ) && !(set & VMX_EPT_ACCESS_READ) && !(clear & VMX_EPT_ACCESS_WRITE)))
+	{
+		return STATUS_INVALID_PARAMETER;
+	}
+
+	if ((clear & VMX_EPT_ACCESS_READ) && !(set & VMX_EPT_ACCESS_READ) &&
+		!(clear & VMX_EPT_ACCESS_EXECUTE) &&
+		(ShvVmxEptCapabilities & VMX_EPT_CAP_EXECUTE_ONLY) == 0)
+	{
+		return STATUS_NOT_SUPPORTED;
+	}
+
+	for (ULONG i = 0; i < count; i++)
+	{
+		if ((regions[i].Base & (PAGE_SIZE - 1)) != 0 ||
+			(regions[i].Size & (PAGE_SIZE - 1)) != 0)
+		{
+			return STATUS_INVALID_PARAMETER;
+		}
+	}
+
+	return STATUS_SUCCESS;
+}
+
+static ULONG64
+ShvVmxEptMakeChild(
+	VMX_EPT_ENTRY value,
+	ULONG level,
+	ULONG index
+)
+{
+	ULONG64 child;
+
+	NT_ASSERT(level == 2 || level == 3);
+
+	//
+	// The entry of a table below a large page that maps the given part of
+	// it.  Apart from the address, it keeps every bit of the large page,
+	// including the permissions, the memory type, ignore PAT, suppress #VE
+	// and the accessed and dirty flags, so the split maps exactly the same
+	// way.  Only a 4 KiB page has no large page bit.
+	//
+	child = value.QuadPart & ~SHV_EPT_PFN_MASK;
+
+	if (level == 2)
+	{
+		child &= ~SHV_EPT_LARGE_PAGE;
+	}
+
+	return child |
+		((value.QuadPart & SHV_EPT_PFN_MASK & ~(SHV_EPT_LEVEL_SIZE(level) - 1)) +
+			index * SHV_EPT_LEVEL_SIZE(level - 1));
+}
+
+static VOID
+ShvVmxEptFillSplitTable(
+	PVMX_EPT_ENTRY table,
+	VMX_EPT_ENTRY value,
+	ULONG level
+)
+{
+	//
+	// Fill in a table with the smaller pages that map the large page the
+	// same way.
+	//
+	for (ULONG i = 0; i < PAGE_SIZE / sizeof(VMX_EPT_ENTRY); i++)
+	{
+		table[i].QuadPart = ShvVmxEptMakeChild(value, level, i);
+	}
+}
+
+static NTSTATUS
+ShvVmxEptSplitTable(
+	PVMX_EPT_ENTRY table,
+	ULONG level,
+	ULONG64 base,
+	ULONG node,
+	PSHV_EPT_FLUSH flush
+)
+{
+	PVMX_EPT_ENTRY next;
+	VMX_EPT_ENTRY value, update;
+	ULONG64 address;
+	NTSTATUS ret;
+
+	NT_ASSERT(level >= 2);
+
+	//
+	// The caller holds the view lock, so no other split or merge runs, but
+	// root mode still changes entries that are present, e.g. to grant
+	// access back, replace a leaf or arm a watch or hook.  Each large page
+	// is only swapped for its table if it is still what was read, and
+	// otherwise looked at again.
+	//
+	for (ULONG i = 0; i < PAGE_SIZE / sizeof(VMX_EPT_ENTRY); i++)
+	{
+		address = base + i * SHV_EPT_LEVEL_SIZE(level);
+
+		for (;;)
+		{
+			value.QuadPart = *(volatile ULONG64 *)&table[i].QuadPart;
+
+			if (value.QuadPart == ShvVmxEptEmpty)
+			{
+				break;
+			}
+
+			if (!SHV_EPT_ENTRY_IS_LARGE(&value, level))
+			{
+				if (level > 2)
+				{
+					ret = ShvVmxEptSplitTable((PVMX_EPT_ENTRY)ShvVmxEptGetVirtualFromPfn(value.PFN),
+						level - 1,
+						address,
+						node,
+						flush);
+					if (ret != STATUS_SUCCESS)
+					{
+						return ret;
+					}
+				}
+
+				break;
+			}
+
+			next = ShvVmxEptAllocateViewTable(node);
+			if (next == NULL)
+			{
+				return STATUS_HV_NO_RESOURCES;
+			}
+
+			ShvVmxEptFillSplitTable(next, value, level);
+
+			update.QuadPart = 0;
+			update.R = 1;
+			update.W = 1;
+			update.X = 1;
+			update.PFN = ShvVmxEptGetPfnFromVirtual(next);
+
+			if (InterlockedCompareExchange64((volatile LONG64 *)&table[i].QuadPart,
+				update.QuadPart,
+				value.QuadPart) != value.QuadPart)
+			{
+				//
+				// Root mode changed the large page since it was read, so
+				// the table was filled from a stale copy of it.  Give the
+				// table back and split whatever is there now.
+				//
+				__stosq((PULONG64)next, ShvVmxEptEmpty, PAGE_SIZE / sizeof(ULONG64));
+				ShvVmxEptFreeTable(next);
+				continue;
+			}
+
+			*flush = max(*flush, ShvVmxEptClassifyChange(value, update, level));
+
+			//
+			// A 1 GiB page becomes 2 MiB pages, which are split in turn.
+			//
+			if (level > 2)
+			{
+				ret = ShvVmxEptSplitTable(next, level - 1, address, node, flush);
+				if (ret != STATUS_SUCCESS)
+				{
+					return ret;
+				}
+			}
+
+			break;
+		}
+	}
+
+	return STATUS_SUCCESS;
+}
+
+static VOID
+ShvVmxEptClearDirtyTable(
+	PVMX_EPT_ENTRY table,
+	ULONG level
+)
+{
+	VMX_EPT_ENTRY entry;
+
+	SHV_FOR_EACH_ENTRY(table, e, PVMX_EPT_ENTRY)
+	{
+		entry.QuadPart = *(volatile ULONG64 *)&e->QuadPart;
+
+		if (entry.QuadPart == ShvVmxEptEmpty)
+		{
+			continue;
+		}
+
+		if (level == 1 || SHV_EPT_ENTRY_IS_LARGE(&entry, level))
+		{
+			if (entry.QuadPart & VMX_EPT_DIRTY)
+			{
+				InterlockedAnd64((volatile LONG64 *)&e->QuadPart, ~(LONG64)VMX_EPT_DIRTY);
+			}
+
+			continue;
+		}
+
+		ShvVmxEptClearDirtyTable((PVMX_EPT_ENTRY)ShvVmxEptGetVirtualFromPfn(entry.PFN), level - 1);
+	}
+}
+
+static ULONG_PTR
+ShvVmxEptShootdownWorker(
+	ULONG_PTR Argument
+)
+{
+	int cpuInfo[4];
+
+	UNREFERENCED_PARAMETER(Argument);
+
+	//
+	// CPUID always causes a VM exit, and every VM exit synchronizes the VP
+	// with the current EPT generation before going back to the guest.
+	//
+	__cpuid(cpuInfo, 0);
+
+	return 0;
+}
+
+static ULONG
+ShvVmxEptReadApicId(
+	VOID
+)
+{
+	if (ShvVmxEptApic == NULL)
+	{
+		return (ULONG)__readmsr(SHV_X2APIC_ID_MSR);
+	}
+
+	return *(volatile ULONG *)(ShvVmxEptApic + SHV_XAPIC_ID) >> 24;
+}
+
+static VOID
+ShvVmxEptSendNmi(
+	ULONG apicId
+)
+{
+	//
+	// Root mode owns the APIC of its LP while it runs, so the ICR can't be
+	// in use by the guest.
+	//
+	if (ShvVmxEptApic == NULL)
+	{
+		__writemsr(SHV_X2APIC_ICR_MSR, ((ULONG64)apicId << 32) | SHV_APIC_ICR_NMI);
+		return;
+	}
+
+	*(volatile ULONG *)(ShvVmxEptApic + SHV_XAPIC_ICR_HIGH) = apicId << 24;
+	*(volatile ULONG *)(ShvVmxEptApic + SHV_XAPIC_ICR_LOW) = SHV_APIC_ICR_NMI;
+}
+
+BOOLEAN
+ShvVmxEptNmiCallback(
+	_In_opt_ PVOID Context,
+	_In_ BOOLEAN Handled
+)
+{
+	PSHV_VP_DATA vpData;
+
+	UNREFERENCED_PARAMETER(Context);
+	UNREFERENCED_PARAMETER(Handled);
+
+	//
+	// The NMI reached Windows, because its target was in root mode or not
+	// virtualized yet.  Either way the VP flushes before it next runs the
+	// guest, so all there is to do is to claim the NMI.
+	//
+	vpData = &ShvGlobalData->VpData[KeGetCurrentProcessorNumberEx(NULL)];
+
+	return (InterlockedExchange(&vpData->NmiRequested, 0) != 0);
+}
+
+static BOOLEAN
+ShvVmxEptVmfuncSupported(
+	VOID
+)
+{
+	INT64 control;
+
+	//
+	// Verify that VM functions can be enabled, and then that EPTP switching
+	// is one of them.  The VM function MSR only exists if the first check
+	// passes.
+	//
+	control = __readmsr(MSR_IA32_VMX_PROCBASED_CTLS2);
+
+	if (_bittest64(&control, 32 + 13) == 0)
+	{
+		return FALSE;
+	}
+
+	return (__readmsr(MSR_IA32_VMX_VMFUNC) & VMX_VMFUNC_EPTP_SWITCHING) != 0;
+}
+
+static BOOLEAN
+ShvVmxEptVeSupported(
+	VOID
+)
+{
+	INT64 control;
+
+	//
+	// Verify that EPT violations can be delivered as #VE.
+	//
+	control = __readmsr(MSR_IA32_VMX_PROCBASED_CTLS2);
+
+	return _bittest64(&control, 32 + 18) != 0;
+}
+
+static PVMX_EPT_ENTRY
+ShvVmxEptAllocateViewTable(
+	ULONG node
+)
+{
+	PVMX_EPT_ENTRY table;
+
+	//
+	// Views are only ever changed outside of root mode, so unlike the
+	// violation handler they can grow the arena when it runs out.  Before
+	// that, force a shootdown if tables are parked, as it frees them.
+	//
+	table = ShvVmxEptAllocateTable(node);
+	if (table == NULL && ShvVmxEptArena.RetiredCount != 0)
+	{
+		ShvVmxEptShootdown();
+		table = ShvVmxEptAllocateTable(node);
+	}
+
+	if (table == NULL && ShvVmxEptArenaGrow(SHV_EPT_ARENA_CHUNK_PAGES, node) == STATUS_SUCCESS)
+	{
+		table = ShvVmxEptAllocateTable(node);
+	}
+
+	return table;
+}
+
+static PVMX_EPT_ENTRY
+ShvVmxEptCopyTable(
+	PVMX_EPT_ENTRY table,
+	ULONG level
+)
+{
+	PVMX_EPT_ENTRY copy;
+	VMX_EPT_ENTRY entry;
+
+	copy = ShvVmxEptAllocateViewTable(MM_ANY_NODE_OK);
+	if (copy == NULL)
+	{
+		return NULL;
+	}
+
+	for (ULONG i = 0; i < PAGE_SIZE / sizeof(VMX_EPT_ENTRY); i++)
+	{
+		//
+		// The copy points at the same tables as the original, so each of
+		// them gains a reference.  If one was just unlinked from the
+		// original, copy whatever replaced it instead.
+		//
+		for (;;)
+		{
+			entry.QuadPart = *(volatile ULONG64 *)&table[i].QuadPart;
+
+			if (level == 1 ||
+				entry.QuadPart == ShvVmxEptEmpty ||
+				SHV_EPT_ENTRY_IS_LARGE(&entry, level) ||
+				ShvVmxEptReferenceTable((PVMX_EPT_ENTRY)ShvVmxEptGetVirtualFromPfn(entry.PFN)))
+			{
+				break;
+			}
+		}
+
+		copy[i].QuadPart = entry.QuadPart;
+	}
+
+	return copy;
+}
+
+static PVMX_EPT_ENTRY
+ShvVmxEptReplicateTable(
+	PVMX_EPT_ENTRY table,
+	ULONG level,
+	ULONG node
+)
+{
+	PVMX_EPT_ENTRY copy, next;
+	VMX_EPT_ENTRY entry;
+
+	copy = ShvVmxEptAllocateTable(node);
+	if (copy == NULL && ShvVmxEptArenaGrow(SHV_EPT_ARENA_CHUNK_PAGES, node) == STATUS_SUCCESS)
+	{
+		copy = ShvVmxEptAllocateTable(node);
+	}
+
+	if (copy == NULL)
+	{
+		return NULL;
+	}
+
+	//
+	// Unlike a view, a replica shares nothing with the original, or walks
+	// would still end up on other nodes.  Leaves are copied as they are.
+	//
+	for (ULONG i = 0; i < PAGE_SIZE / sizeof(VMX_EPT_ENTRY); i++)
+	{
+		entry.QuadPart = table[i].QuadPart;
+
+		if (level > 1 &&
+			entry.QuadPart != ShvVmxEptEmpty &&
+			!SHV_EPT_ENTRY_IS_LARGE(&entry, level))
+		{
+			next = ShvVmxEptReplicateTable((PVMX_EPT_ENTRY)ShvVmxEptGetVirtualFromPfn(entry.PFN), level - 1, node);
+			if (next == NULL)
+			{
+				return NULL;
+			}
+
+			entry.PFN = ShvVmxEptGetPfnFromVirtual(next);
+		}
+
+		copy[i].QuadPart = entry.QuadPart;
+	}
+
+	return copy;
+}
+
+static VOID
+ShvVmxEptBuildReplicas(
+	VOID
+)
+{
+	PVMX_EPT_ENTRY root;
+	NTSTATUS ret;
+	ULONG nodes;
+
+	nodes = min((ULONG)KeQueryHighestNodeNumber() + 1, SHV_EPT_MAX_NODES);
+	if (nodes == 1)
+	{
+		return;
+	}
+
+	//
+	// Copy the identity map into memory of each node.  Nodes that have no
+	// memory of their own, or not enough of it, keep using ShvVmxEptPML4.
+	// Whatever a failed copy got to allocate stays in the arena until
+	// unload.
+	//
+	for (ULONG node = 0; node < nodes; node++)
+	{
+		ret = ShvVmxEptArenaGrow(ShvVmxEptArenaEstimate(), node);
+		if (ret != STATUS_SUCCESS)
+		{
+			SHV_DEBUG_PRINT("No EPT replica for node %u: %x\n", node, ret);
+			continue;
+		}
+
+		root = ShvVmxEptReplicateTable(ShvVmxEptPML4, VMX_EPT_PAGE_WALK_LENGTH, node);
+		if (root == NULL)
+		{
+			SHV_DEBUG_PRINT("No EPT replica for node %u: arena exhausted\n", node);
+			continue;
+		}
+
+		ShvVmxEptNodeRoots[node] = root;
+		ShvVmxEptRoots[ShvVmxEptRootCount++] = root;
+	}
+}
+
+static BOOLEAN
+ShvVmxEptIsDefaultRoot(
+	PVMX_EPT_ENTRY root
+)
+{
+	for (ULONG i = 0; i < ShvVmxEptRootCount; i++)
+	{
+		if (ShvVmxEptRoots[i] == root)
+		{
+			return TRUE;
+		}
+	}
+
+	return FALSE;
+}
+
+static VMX_EPT_EPTP
+ShvVmxEptGetDefaultEptp(
+	VOID
+)
+{
+	VMX_EPT_EPTP eptp;
+	ULONG node;
+
+	//
+	// The EPTP of the default view, pointed at the replica of the node
+	// this LP is on, if it has one.
+	//
+	eptp = ShvVmxEptEptp;
+	node = KeGetCurrentNodeNumber();
+
+	if (node < SHV_EPT_MAX_NODES && ShvVmxEptNodeRoots[node] != NULL)
+	{
+		eptp.PFN = ShvVmxEptGetPfnFromVirtual(ShvVmxEptNodeRoots[node]);
+	}
+
+	return eptp;
+}
 
-	//
-	// Iterate through each of the PML4 entries and free each
-	// of the lower tables.
-	//
-	SHV_FOR_EACH_ENTRY(ShvVmxEptPML4, pml4e, PVMX_EPT_ENTRY)
-	{
-		PVMX_EPT_PDPTE pdpt;
+static NTSTATUS
+ShvVmxEptUpdateRootRange(
+	PVMX_EPT_ENTRY root,
+	ULONG64 start,
+	ULONG64 end,
+	ULONG64 clear,
+	ULONG64 set,
+	PSHV_EPT_FLUSH flush
+)
+{
+	PVMX_EPT_ENTRY table, e, next;
+	VMX_EPT_ENTRY value, update;
+	ULONG64 address, base, size, typeEnd;
+	ULONG l;
+	UCHAR type;
 
-		if (pml4e->QuadPart == 0)
-		{
-			//
-			// Entry is not set
-			//
-			continue;
-		}
+	address = start & ~(PAGE_SIZE - 1);
 
+	while (address < end)
+	{
 		//
-		// Get the virtual address for the PDP table from the PFN
-		// in the PML4 entry.
+		// Walk down to the entry that maps the address at the largest level
+		// the range allows, making every table on the way private to the
+		// view.  The caller holds the view lock, and root mode only ever
+		// fills in empty entries, so nothing else changes an entry that is
+		// already present.
 		//
-		pdpt = (PVMX_EPT_PDPTE)ShvVmxEptGetVirtualFromPfn(pml4e->PFN);
+		table = root;
+		l = VMX_EPT_PAGE_WALK_LENGTH;
+		type = 0;
 
-		//
-		// Iterate through each of the PDPT entries and free each
-		// of the lower tables.
-		//
-		SHV_FOR_EACH_ENTRY(pdpt, pdpte, PVMX_EPT_PDPTE)
+		for (;;)
 		{
-			PVMX_EPT_PDE pdt;
+			e = &table[SHV_EPT_INDEX(address, l)];
+			value.QuadPart = *(volatile ULONG64 *)&e->QuadPart;
+			size = SHV_EPT_LEVEL_SIZE(l);
+			base = address & ~(size - 1);
+
+			if (l == 1)
+			{
+				type = ShvMtrrLookup(base, &typeEnd);
+				break;
+			}
 
-			if (pdpte->QuadPart == 0 || pdpte->P == 1)
+			if (value.QuadPart == ShvVmxEptEmpty || SHV_EPT_ENTRY_IS_LARGE(&value, l))
 			{
 				//
-				// Entry is either not set or isn't a pointer
-				// to a lower directory table.
+				// Change a large page in place if the range covers all of
+				// it, and fill in an empty entry with one if the range
+				// covers the region and it has a single memory type.
 				//
-				continue;
-			}
+				if (l <= ShvVmxEptLeafLevel(address, end) &&
+					(value.QuadPart != ShvVmxEptEmpty || ShvMtrrGetMemoryType(base, size, &type)))
+				{
+					break;
+				}
 
-			//
-			// Get the virtual address for the PD table from the PFN
-			// in the PDPT entry.
-			//
-			pdt = (PVMX_EPT_PDE)ShvVmxEptGetVirtualFromPfn(pdpte->Dir.PFN);
+				//
+				// Otherwise go one level down, splitting the large page into
+				// a table of smaller pages that map it the same way.
+				//
+				next = ShvVmxEptAllocateViewTable(ShvVmxEptGetTableNode(root));
+				if (next == NULL)
+				{
+					return STATUS_HV_NO_RESOURCES;
+				}
 
-			//
-			// Iterate through each of the PD entries and free each
-			// of the lower tables.
-			//
-			SHV_FOR_EACH_ENTRY(pdt, pde, PVMX_EPT_PDE)
-			{
-				PVMX_EPT_PTE pt;
+				if (value.QuadPart != ShvVmxEptEmpty)
+				{
+					ShvVmxEptFillSplitTable(next, value, l);
+				}
 
-				if (pde->QuadPart == 0 || pde->P == 1)
+				update.QuadPart = 0;
+				update.R = 1;
+				update.W = 1;
+				update.X = 1;
+				update.PFN = ShvVmxEptGetPfnFromVirtual(next);
+
+				if ((ULONG64)InterlockedCompareExchange64(
+					(volatile LONG64 *)&e->QuadPart,
+					update.QuadPart,
+					value.QuadPart) != value.QuadPart)
 				{
 					//
-					// Entry is either not set or isn't a pointer
-					// to a lower directory table.
+					// A VP filled in the empty entry first.  Look at it
+					// again.
 					//
+					__stosq((PULONG64)next, ShvVmxEptEmpty, PAGE_SIZE / sizeof(ULONG64));
+					ShvVmxEptFreeTable(next);
 					continue;
 				}
 
+				*flush = max(*flush, ShvVmxEptClassifyChange(value, update, l));
+			}
+			else
+			{
 				//
-				// Get the virtual address for the page table from the PFN
-				// in the PD entry.
-				//
-				pt = (PVMX_EPT_PTE)ShvVmxEptGetVirtualFromPfn(pde->Dir.PFN);
-
-				//
-				// Free the page table.
+				// A table that other views share is copied before anything
+				// under it changes.  The copy maps exactly the same way, and
+				// the original stays alive for the views still using it,
+				// so processors holding either one are fine and nothing
+				// needs to be flushed.
 				//
-				ExFreePoolWithTag(pt, 'EPT ');
-			}
-
-			//
-			// Free the PD table.
-			//
-			ExFreePoolWithTag(pdt, 'EPT ');
-		}
-
-		//
-		// Free the PDP table.
-		//
-		ExFreePoolWithTag(pdpt, 'EPT ');
-	}
-
-	//
-	// Free the PML4 Table
-	//
-	ExFreePoolWithTag(ShvVmxEptPML4, 'EPT ');
-	ShvVmxEptPML4 = NULL;
+				next = (PVMX_EPT_ENTRY)ShvVmxEptGetVirtualFromPfn(value.PFN);
 
-	KeReleaseSpinLockFromDpcLevel(&ShvVmxEptPML4Lock);
-}
+				if (*ShvVmxEptGetReferences(next) > 1)
+				{
+					PVMX_EPT_ENTRY copy;
 
-VOID
-ShvVmxEptHandleViolation(
-	_In_ PSHV_VP_STATE VpState
-)
-{
-	PHYSICAL_ADDRESS gpa;
-	SIZE_T eq;
-	UNREFERENCED_PARAMETER(VpState);
+					copy = ShvVmxEptCopyTable(next, l - 1);
+					if (copy == NULL)
+					{
+						return STATUS_HV_NO_RESOURCES;
+					}
 
-	//
-	// Read guest physical address that caused the violation.
-	//
-	__vmx_vmread(GUEST_PHYSICAL_ADDRESS, (PSIZE_T)&gpa.QuadPart);
+					update.QuadPart = value.QuadPart;
+					update.PFN = ShvVmxEptGetPfnFromVirtual(copy);
 
-	//
-	// Read the exit qualification
-	//
-	__vmx_vmread(EXIT_QUALIFICATION, &eq);
+					InterlockedExchange64((volatile LONG64 *)&e->QuadPart, update.QuadPart);
 
-	SHV_DEBUG_PRINT("[%u] GPA: %llx Exit Qualification %llx\n",
-		KeGetCurrentProcessorNumberEx(NULL),
-		gpa.QuadPart,
-		eq
-	);
+					ShvVmxEptReleaseTable(next);
+					next = copy;
+				}
+			}
 
-	//
-	// Check to see if the violation was caused because there was no EPT
-	// entry present.  This could happen, because we didn't identity map
-	// the hardware MMIO mappings.
-	//
-	if (SHV_EPT_VIOLATION_ENTRY_MISS(eq)) {
-		NTSTATUS ret;
+			table = next;
+			l--;
+		}
 
 		//
-		// Add an EPT entry for the GPA.
+		// Change the bits of the entry the caller asked for and nothing
+		// else about it.  An empty entry becomes the identity mapping it
+		// would have been filled in with.  Root mode can fill it in while
+		// we look at it, in which case it either maps the region the same
+		// way with a leaf or holds a new table, and then the walk is done
+		// again.
 		//
-		ret = ShvVmxIdentityMapPage(gpa);
-		NT_VERIFYMSG("GPA EPT Allocation Failed", ret == STATUS_SUCCESS);
+		for (;;)
+		{
+			value.QuadPart = *(volatile ULONG64 *)&e->QuadPart;
 
-		//
-		// Since we modified the EPT table, we need to invalidate the EPT.
-		//
-		ShvVmxEptInvalidateEpt();
+			if (value.QuadPart == ShvVmxEptEmpty)
+			{
+				update.QuadPart = (ShvVmxEptMakeLeaf(l, base, VMX_EPT_ACCESS_RWX, type) & ~clear) | set;
+			}
+			else if (l == 1 || SHV_EPT_ENTRY_IS_LARGE(&value, l))
+			{
+				update.QuadPart = (value.QuadPart & ~clear) | set;
+			}
+			else
+			{
+				break;
+			}
 
-		return;
+			if ((ULONG64)InterlockedCompareExchange64(
+				(volatile LONG64 *)&e->QuadPart,
+				update.QuadPart,
+				value.QuadPart) == value.QuadPart)
+			{
+				*flush = max(*flush, ShvVmxEptClassifyChange(value, update, l));
+				address = base + size;
+				break;
+			}
+		}
 	}
 
-	SHV_DEBUG_PRINT("Bad exit qualification: %llx\n", eq);
-	NT_ASSERTMSG("Unknown EPT Violation Reason", FALSE);
+	return STATUS_SUCCESS;
 }
 
-// ===========================================================================
-//
-// LOCAL FUNCTIONS
-//
-// ===========================================================================
-
-static PVOID
-ShvVmxEptGetVirtualFromPfn(
-	SIZE_T Pfn
+PVOID
+ShvVmxEptTranslatePfn(
+	_In_opt_ PVOID Context,
+	_In_ ULONG64 Pfn
 )
 {
-	PHYSICAL_ADDRESS pa;
-
-	//
-	// First convert the PFN to a physical address.
-	//
-	pa.QuadPart = SHV_PFN_TO_PHYS(Pfn);
+	UNREFERENCED_PARAMETER(Context);
 
-	//
-	// Convert the physical address to a virtual address.
-	//
-	return MmGetVirtualForPhysical(pa);
+	return ShvVmxEptGetVirtualFromPfn((SIZE_T)Pfn);
 }
 
-static SIZE_T
-ShvVmxEptGetPfnFromVirtual(
-	PVOID Va
+static ULONG64
+ShvVmxEptMemoryMapHash(
+	VOID
 )
 {
-	PHYSICAL_ADDRESS pa;
+	SHV_MTRR_STATE mtrrs;
+	ULONG64 value, address, end;
 
 	//
-	// First convert the virtual address to a physical address.
+	// The identity map is derived from the RAM ranges and the memory types
+	// the MTRRs give them, so an image built from the same two is the same
+	// identity map.  The index is sorted and coalesced, so the same RAM
+	// always hashes the same, however Windows happens to report it.
 	//
-	pa = MmGetPhysicalAddress(Va);
+	value = SHV_EPT_IMAGE_HASH_SEED;
+
+	for (address = 0; address < ShvMemMapGetTopOfRam(); address = end)
+	{
+		if (ShvMemMapLookup(address, &end) == ShvMemoryRam)
+		{
+			value = ShvVmxEptImageHash(&address, sizeof(address), value);
+			value = ShvVmxEptImageHash(&end, sizeof(end), value);
+		}
+	}
 
 	//
-	// Convert the physical address to a PFN.
+	// The capture zeroes the whole state first, so padding and unused
+	// variable ranges hash the same every time.
 	//
-	return SHV_PHYS_TO_PFN(pa.QuadPart);
+	ShvMtrrCapture(&mtrrs);
+
+	return ShvVmxEptImageHash(&mtrrs, sizeof(mtrrs), value);
 }
 
-static NTSTATUS
-_ShvVmxEptPopulateIdentityTable(
-	PVMX_EPT_ENTRY table,
-	ULONG level,
-	PHYSICAL_ADDRESS address
+NTSTATUS
+ShvVmxEptImageMapRun(
+	_In_opt_ PVOID Context,
+	_In_ const SHV_EPT_IMAGE_RUN *Run
 )
 {
-	PVMX_EPT_ENTRY next;
-	VMX_EPT_ADDRESS gpa, ta;
-
-	// Initialize the guest physical address and the table address.
-	gpa.QuadPart = address.QuadPart;
-	ta.Entry = table;
+	PSHV_EPT_CURSOR cursor;
+	PVMX_EPT_ENTRY entry;
+	ULONG64 address, size, leaf;
+	ULONG level;
+	NTSTATUS ret;
 
-	NT_ASSERT(level <= 4 && level >= 1);
+	NT_VERIFY(ARGUMENT_PRESENT(Context));
 
-	switch (level) {
-	case 4: // PML4E
-		ta.GPA = gpa.PML4E;
-		break;
-	case 3: // PDPTE
-		ta.GPA = gpa.PDPTE;
-		break;
-	case 2: // PDE
-		ta.GPA = gpa.PDE;
-		break;
-	case 1: // PTE
-		ta.GPA = gpa.PTE;
-		break;
-	}
+	cursor = (PSHV_EPT_CURSOR)Context;
+	size = SHV_EPT_LEVEL_SIZE(Run->Level);
 
-	//
-	// If we're at the bottom level, we just need to populate
-	// the PTE with the PFN of the HPA.
-	//
-	if (level == 1)
+	for (ULONG i = 0; i < Run->Count; i++)
 	{
-		PVMX_EPT_PTE pte;
-
-		pte = (PVMX_EPT_PTE)ta.Entry;
+		address = Run->Gpa + i * size;
+		leaf = Run->First + i * size;
 
 		//
-		// Populate the PTE if it's not already set.
+		// Runs come in address order, so the cursor only ever walks down
+		// from the PML4 when a run leaves the tables the last one was in.
 		//
-		if (pte->QuadPart == 0)
+		for (;;)
 		{
-			pte->R = 1;
-			pte->W = 1;
-			pte->X = 1;
-			pte->MT = WriteBack;
-			pte->PFN = SHV_PHYS_TO_PFN(address.QuadPart);
-		}
+			level = Run->Level;
 
-		return STATUS_SUCCESS;
-	}
+			ret = ShvVmxEptCursorWalk(cursor, address, &level, &entry);
+			if (ret != STATUS_HV_NO_RESOURCES)
+			{
+				break;
+			}
 
-	// Let's check if we need to initialize the entry
-	if (ta.Entry->QuadPart == 0) {
-		//
-		// Allocate memory to hold the table.
-		//
-		next = (PVMX_EPT_ENTRY)ExAllocatePoolWithTag(NonPagedPoolNx, PAGE_SIZE, 'EPT ');
-		if (next == NULL) {
-			return STATUS_HV_NO_RESOURCES;
+			ret = ShvVmxEptArenaGrow(SHV_EPT_ARENA_CHUNK_PAGES, MM_ANY_NODE_OK);
+			if (ret != STATUS_SUCCESS)
+			{
+				return ret;
+			}
+		}
+
+		if (ret != STATUS_SUCCESS)
+		{
+			return ret;
 		}
 
 		//
-		// Zero the table.
+		// The runs were validated to be disjoint, so the entry can only be
+		// taken already if the image doesn't describe a hierarchy at all.
 		//
-		__stosq((PUINT64)next, 0, PAGE_SIZE / sizeof(ULONG64));
-
-		ta.Entry->R = 1;
-		ta.Entry->W = 1;
-		ta.Entry->X = 1;
-		ta.Entry->PFN = ShvVmxEptGetPfnFromVirtual(next);
-	}
-	else
-	{
-		next = (PVMX_EPT_ENTRY)ShvVmxEptGetVirtualFromPfn(ta.Entry->PFN);
+		if ((level != Run->Level) ||
+			(InterlockedCompareExchange64((volatile LONG64 *)&entry->QuadPart,
+				leaf,
+				ShvVmxEptEmpty) != (LONG64)ShvVmxEptEmpty))
+		{
+			return STATUS_INVALID_IMAGE_FORMAT;
+		}
 	}
 
-	return _ShvVmxEptPopulateIdentityTable(next, level - 1, address);
+	return STATUS_SUCCESS;
 }
 
 static NTSTATUS
-ShvVmxIdentityMapPage(
-	PHYSICAL_ADDRESS address
+ShvVmxEptLoadImage(
+	ULONG64 hash
 )
 {
+	FILE_STANDARD_INFORMATION information;
+	OBJECT_ATTRIBUTES attributes;
+	IO_STATUS_BLOCK ioStatus;
+	UNICODE_STRING path;
+	SHV_EPT_CURSOR cursor;
+	HANDLE file;
+	PVOID image;
+	ULONG size;
 	NTSTATUS ret;
 
-	KeAcquireSpinLockAtDpcLevel(&ShvVmxEptPML4Lock);
+	RtlInitUnicodeString(&path, SHV_EPT_IMAGE_PATH);
+	InitializeObjectAttributes(&attributes, &path, OBJ_KERNEL_HANDLE | OBJ_CASE_INSENSITIVE, NULL, NULL);
 
-	NT_ASSERTMSG("PML4 is not allocated.", (ShvVmxEptPML4 != NULL));
+	ret = ZwCreateFile(&file,
+		GENERIC_READ | SYNCHRONIZE,
+		&attributes,
+		&ioStatus,
+		NULL,
+		FILE_ATTRIBUTE_NORMAL,
+		FILE_SHARE_READ,
+		FILE_OPEN,
+		FILE_NON_DIRECTORY_FILE | FILE_SYNCHRONOUS_IO_NONALERT,
+		NULL,
+		0);
+	if (ret != STATUS_SUCCESS)
+	{
+		return ret;
+	}
+
+	ret = ZwQueryInformationFile(file, &ioStatus, &information, sizeof(information), FileStandardInformation);
+	if (ret != STATUS_SUCCESS)
+	{
+		ZwClose(file);
+		return ret;
+	}
+
+	if (information.EndOfFile.QuadPart > SHV_EPT_IMAGE_MAX_SIZE)
+	{
+		ZwClose(file);
+		return STATUS_INVALID_IMAGE_FORMAT;
+	}
+
+	size = (ULONG)information.EndOfFile.QuadPart;
+
+	image = ExAllocatePoolWithTag(NonPagedPoolNx, max(size, 1), 'EPT ');
+	if (image == NULL)
+	{
+		ZwClose(file);
+		return STATUS_HV_NO_RESOURCES;
+	}
 
-	ret = _ShvVmxEptPopulateIdentityTable(ShvVmxEptPML4, VMX_EPT_PAGE_WALK_LENGTH, address);
+	//
+	// Read the whole image in one go, so that rebuilding from it is a
+	// single sequential pass over memory.
+	//
+	ret = ZwReadFile(file, NULL, NULL, NULL, &ioStatus, image, size, NULL, NULL);
+	ZwClose(file);
+
+	if ((ret == STATUS_SUCCESS) && (ioStatus.Information != size))
+	{
+		ret = STATUS_INVALID_IMAGE_FORMAT;
+	}
+
+	if (ret == STATUS_SUCCESS)
+	{
+		ShvVmxEptCursorInitialize(&cursor, ShvVmxEptPML4);
+
+		ret = ShvVmxEptImageRead(image,
+			size,
+			hash,
+			ShvVmxEptCapabilities & (VMX_EPT_CAP_PDE_2MB | VMX_EPT_CAP_PDPTE_1GB),
+			ShvVmxEptEmpty,
+			ShvVmxEptImageMapRun,
+			&cursor);
+	}
 
-	KeReleaseSpinLockFromDpcLevel(&ShvVmxEptPML4Lock);
+	ExFreePoolWithTag(image, 'EPT ');
 
 	return ret;
 }
 
 static NTSTATUS
-ShvVmxEptBuildIdentityTables(
-	VOID
+ShvVmxEptSaveImage(
+	ULONG64 hash
 )
 {
-	PPHYSICAL_MEMORY_RANGE ranges;
+	OBJECT_ATTRIBUTES attributes;
+	IO_STATUS_BLOCK ioStatus;
+	UNICODE_STRING path;
+	ULONG64 capabilities;
+	HANDLE file;
+	PVOID image;
+	SIZE_T size;
 	NTSTATUS ret;
 
-	//
-	// Get physical memory ranges
-	//
-	ranges = MmGetPhysicalMemoryRanges();
+	capabilities = ShvVmxEptCapabilities & (VMX_EPT_CAP_PDE_2MB | VMX_EPT_CAP_PDPTE_1GB);
 
 	//
-	// Iterate through each physical memory range and create an identity mapping
-	// for each 4 KiB page in each range.
+	// Size the image first.  Nothing else touches the hierarchy before the
+	// LPs enter root mode, so the second walk finds the same runs.
 	//
-	for (SIZE_T i = 0; ranges[i].BaseAddress.QuadPart != 0 || ranges[i].NumberOfBytes.QuadPart != 0; i++)
+	ret = ShvVmxEptImageWrite(ShvVmxEptPML4,
+		ShvVmxEptTranslatePfn,
+		NULL,
+		hash,
+		capabilities,
+		ShvVmxEptEmpty,
+		NULL,
+		0,
+		&size);
+	if (ret != STATUS_BUFFER_TOO_SMALL)
+	{
+		return ret;
+	}
+
+	if (size > SHV_EPT_IMAGE_MAX_SIZE)
 	{
-		PHYSICAL_ADDRESS start, end;
+		return STATUS_BUFFER_OVERFLOW;
+	}
 
-		start.QuadPart = ranges[i].BaseAddress.QuadPart;
-		end.QuadPart = start.QuadPart + ranges[i].NumberOfBytes.QuadPart - 1;
+	image = ExAllocatePoolWithTag(NonPagedPoolNx, size, 'EPT ');
+	if (image == NULL)
+	{
+		return STATUS_HV_NO_RESOURCES;
+	}
 
-		//
-		// Populate the EPT table with a PTE for each page in the range.
-		//
-		for (PHYSICAL_ADDRESS address = start; address.QuadPart < end.QuadPart; address.QuadPart += PAGE_SIZE)
-		{
-			ret = ShvVmxIdentityMapPage(address);
-			if (ret != STATUS_SUCCESS) {
-				return ret;
-			}
-		}
+	ret = ShvVmxEptImageWrite(ShvVmxEptPML4,
+		ShvVmxEptTranslatePfn,
+		NULL,
+		hash,
+		capabilities,
+		ShvVmxEptEmpty,
+		image,
+		size,
+		&size);
+	if (ret != STATUS_SUCCESS)
+	{
+		ExFreePoolWithTag(image, 'EPT ');
+		return ret;
 	}
 
-	//
-	// We don't enumerate the hardware mapped MMIO, so we need to identity map
-	// the first 4 GiB to be sure we cover them all.
-	//
-	for (PHYSICAL_ADDRESS address = { 0 }; address.QuadPart < MAXULONG32; address.QuadPart += PAGE_SIZE)
+	RtlInitUnicodeString(&path, SHV_EPT_IMAGE_PATH);
+	InitializeObjectAttributes(&attributes, &path, OBJ_KERNEL_HANDLE | OBJ_CASE_INSENSITIVE, NULL, NULL);
+
+	ret = ZwCreateFile(&file,
+		GENERIC_WRITE | SYNCHRONIZE,
+		&attributes,
+		&ioStatus,
+		NULL,
+		FILE_ATTRIBUTE_NORMAL,
+		0,
+		FILE_OVERWRITE_IF,
+		FILE_NON_DIRECTORY_FILE | FILE_SYNCHRONOUS_IO_NONALERT,
+		NULL,
+		0);
+	if (ret == STATUS_SUCCESS)
 	{
-		ret = ShvVmxIdentityMapPage(address);
-		if (ret != STATUS_SUCCESS) {
-			return ret;
-		}
+		ret = ZwWriteFile(file, NULL, NULL, NULL, &ioStatus, image, (ULONG)size, NULL, NULL);
+		ZwClose(file);
 	}
 
-	return STATUS_SUCCESS;
+	ExFreePoolWithTag(image, 'EPT ');
+
+	return ret;
 }
 
-static VOID
-ShvVmxEptInvalidateEpt(
+static NTSTATUS
+ShvVmxEptWarmBuild(
 	VOID
 )
 {
+	LARGE_INTEGER start, end, frequency;
+	ULONG64 hash;
+	NTSTATUS ret;
+
+	start = KeQueryPerformanceCounter(&frequency);
+
+	hash = ShvVmxEptMemoryMapHash();
+
+	ret = ShvVmxEptLoadImage(hash);
+	if (ret == STATUS_SUCCESS)
+	{
+		end = KeQueryPerformanceCounter(NULL);
+		SHV_DEBUG_PRINT("EPT identity map loaded from image in %llu us\n",
+			(end.QuadPart - start.QuadPart) * 1000000 / frequency.QuadPart);
+		return STATUS_SUCCESS;
+	}
+
+	SHV_DEBUG_PRINT("EPT image not used: %x\n", ret);
+
 	//
-	// Build the INVEPT descriptor.
+	// There was no usable image.  A failed load may have left part of it
+	// mapped, which can't be trusted, so throw away every table and start
+	// over from an empty PML4.  Nothing else uses the tables yet.
 	//
-	struct {
-		VMX_EPT_EPTP Eptp;
-		ULONG64		 reserved0;
-	} invdesc = { 0 };
+	ShvVmxEptArenaFree();
+	ShvVmxEptPML4 = NULL;
+
+	ret = ShvVmxEptArenaGrow(ShvVmxEptArenaEstimate(), MM_ANY_NODE_OK);
+	if (ret != STATUS_SUCCESS)
+	{
+		return ret;
+	}
 
-	invdesc.Eptp = ShvVmxEptEptp;
+	ShvVmxEptPML4 = ShvVmxEptAllocateTable(MM_ANY_NODE_OK);
+	if (ShvVmxEptPML4 == NULL)
+	{
+		return STATUS_HV_NO_RESOURCES;
+	}
 
 	//
-	// Invalidate the EPT
+	// Build the identity map the usual way, and save it for the next load.
 	//
-	__vmx_invept(1, &invdesc);
-}
+	start = KeQueryPerformanceCounter(NULL);
+
+	ret = ShvVmxEptBuildIdentityTables();
+	if (ret != STATUS_SUCCESS)
+	{
+		return ret;
+	}
+
+	end = KeQueryPerformanceCounter(NULL);
+	SHV_DEBUG_PRINT("EPT identity map built in %llu us\n",
+		(end.QuadPart - start.QuadPart) * 1000000 / frequency.QuadPart);
+
+	ret = ShvVmxEptSaveImage(hash);
+	if (ret != STATUS_SUCCESS)
+	{
+		SHV_DEBUG_PRINT("EPT image not saved: %x\n", ret);
+	}
 
+	return STATUS_SUCCESS;
+}
@@ -0,0 +1,411 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvvmxeptimage.c
+
+Abstract:
+
+	This module implements the reader and writer of serialized EPT images.
+	The writer encodes the leaves of a hierarchy as runs of consecutive
+	leaves, and the reader validates an image completely before handing its
+	runs back in order.  Like the inspector, it only touches the memory it
+	is given, so it works the same against tables built in memory elsewhere.
+
+Author:
+
+	agent (@agent) 15-Oct-2026 - Initial version
+
+Environment:
+
+	Kernel mode, or user mode against tables built in memory.
+
+--*/
+
+#include "shv.h"
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// The guest-physical address space covered by a 4-level hierarchy.
+//
+#define SHV_EPT_IMAGE_GPA_LIMIT (1ULL << 48)
+
+//
+// The 64-bit FNV-1a prime.
+//
+#define SHV_EPT_IMAGE_HASH_PRIME 0x100000001b3ULL
+
+// ===========================================================================
+//
+// LOCAL TYPES
+//
+// ===========================================================================
+
+//
+// The state of the writer.  The run being built is only emitted once a
+// leaf that doesn't extend it comes along, or the walk ends.
+//
+typedef struct _SHV_EPT_IMAGE_WRITER
+{
+	PSHV_EPT_TRANSLATE Translate;
+	PVOID Context;
+	ULONG64 Empty;
+	PSHV_EPT_IMAGE_RUN Runs;
+	ULONG64 Capacity;
+	ULONG64 Count;
+	ULONG64 Tables;
+	ULONG64 Checksum;
+	SHV_EPT_IMAGE_RUN Run;
+} SHV_EPT_IMAGE_WRITER, *PSHV_EPT_IMAGE_WRITER;
+
+// ===========================================================================
+//
+// LOCAL PROTOTYPES
+//
+// ===========================================================================
+
+static VOID
+ShvVmxEptImageEmit(
+	PSHV_EPT_IMAGE_WRITER writer
+);
+
+static VOID
+ShvVmxEptImageWriteTable(
+	PSHV_EPT_IMAGE_WRITER writer,
+	PVMX_EPT_ENTRY table,
+	ULONG level,
+	ULONG64 base
+);
+
+static BOOLEAN
+ShvVmxEptImageRunValid(
+	const SHV_EPT_IMAGE_RUN *run,
+	ULONG64 capabilities,
+	ULONG64 empty,
+	ULONG64 previous
+);
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+ULONG64
+ShvVmxEptImageHash(
+	_In_reads_bytes_(Size) const VOID *Data,
+	_In_ SIZE_T Size,
+	_In_ ULONG64 Hash
+)
+{
+	const UCHAR *bytes = (const UCHAR *)Data;
+
+	for (SIZE_T i = 0; i < Size; i++)
+	{
+		Hash ^= bytes[i];
+		Hash *= SHV_EPT_IMAGE_HASH_PRIME;
+	}
+
+	return Hash;
+}
+
+NTSTATUS
+ShvVmxEptImageWrite(
+	_In_ PVMX_EPT_ENTRY Root,
+	_In_ PSHV_EPT_TRANSLATE Translate,
+	_In_opt_ PVOID Context,
+	_In_ ULONG64 MemoryMapHash,
+	_In_ ULONG64 Capabilities,
+	_In_ ULONG64 Empty,
+	_Out_writes_bytes_opt_(Size) PVOID Image,
+	_In_ SIZE_T Size,
+	_Out_ PSIZE_T Required
+)
+{
+	SHV_EPT_IMAGE_WRITER writer;
+	PSHV_EPT_IMAGE_HEADER header;
+
+	__stosb((PUCHAR)&writer, 0, sizeof(writer));
+
+	writer.Translate = Translate;
+	writer.Context = Context;
+	writer.Empty = Empty;
+	writer.Checksum = SHV_EPT_IMAGE_HASH_SEED;
+
+	//
+	// Without room for the header, nothing is stored and the walk only
+	// counts the runs, so the caller can size the buffer from the first
+	// call.
+	//
+	header = NULL;
+	if ((Image != NULL) && (Size >= sizeof(*header)))
+	{
+		header = (PSHV_EPT_IMAGE_HEADER)Image;
+		writer.Runs = (PSHV_EPT_IMAGE_RUN)(header + 1);
+		writer.Capacity = (Size - sizeof(*header)) / sizeof(SHV_EPT_IMAGE_RUN);
+	}
+
+	ShvVmxEptImageWriteTable(&writer, Root, VMX_EPT_PAGE_WALK_LENGTH, 0);
+	ShvVmxEptImageEmit(&writer);
+
+	*Required = sizeof(*header) + (SIZE_T)writer.Count * sizeof(SHV_EPT_IMAGE_RUN);
+	if ((header == NULL) || (writer.Count > writer.Capacity) || (writer.Count > MAXULONG))
+	{
+		return STATUS_BUFFER_TOO_SMALL;
+	}
+
+	header->Magic = SHV_EPT_IMAGE_MAGIC;
+	header->Version = SHV_EPT_IMAGE_VERSION;
+	header->HeaderSize = sizeof(*header);
+	header->RunSize = sizeof(SHV_EPT_IMAGE_RUN);
+	header->RunCount = (ULONG)writer.Count;
+	header->MemoryMapHash = MemoryMapHash;
+	header->Capabilities = Capabilities;
+	header->Empty = Empty;
+	header->Tables = writer.Tables;
+	header->Checksum = writer.Checksum;
+	return STATUS_SUCCESS;
+}
+
+NTSTATUS
+ShvVmxEptImageRead(
+	_In_reads_bytes_(Size) const VOID *Image,
+	_In_ SIZE_T Size,
+	_In_ ULONG64 MemoryMapHash,
+	_In_ ULONG64 Capabilities,
+	_In_ ULONG64 Empty,
+	_In_ PSHV_EPT_IMAGE_MAP Map,
+	_In_opt_ PVOID Context
+)
+{
+	const SHV_EPT_IMAGE_HEADER *header;
+	const SHV_EPT_IMAGE_RUN *runs;
+	ULONG64 previous;
+	NTSTATUS status;
+
+	//
+	// Check the framing first, so that nothing past the end of the image
+	// is ever read.
+	//
+	header = (const SHV_EPT_IMAGE_HEADER *)Image;
+	if ((Size < sizeof(*header)) ||
+		(header->Magic != SHV_EPT_IMAGE_MAGIC) ||
+		(header->Version != SHV_EPT_IMAGE_VERSION) ||
+		(header->HeaderSize != sizeof(*header)) ||
+		(header->RunSize != sizeof(SHV_EPT_IMAGE_RUN)) ||
+		(header->RunCount > (Size - sizeof(*header)) / sizeof(SHV_EPT_IMAGE_RUN)))
+	{
+		return STATUS_INVALID_IMAGE_FORMAT;
+	}
+
+	runs = (const SHV_EPT_IMAGE_RUN *)(header + 1);
+	if (ShvVmxEptImageHash(runs,
+						   header->RunCount * sizeof(SHV_EPT_IMAGE_RUN),
+						   SHV_EPT_IMAGE_HASH_SEED) != header->Checksum)
+	{
+		return STATUS_INVALID_IMAGE_FORMAT;
+	}
+
+	//
+	// An intact image that was written for another memory map, another
+	// processor or with #VE configured differently is simply stale.
+	//
+	if ((header->MemoryMapHash != MemoryMapHash) ||
+		(header->Capabilities != Capabilities) ||
+		(header->Empty != Empty))
+	{
+		return STATUS_REVISION_MISMATCH;
+	}
+
+	//
+	// Validate every run before mapping any of them, so a bad image never
+	// leaves a partial hierarchy behind.
+	//
+	previous = 0;
+	for (ULONG i = 0; i < header->RunCount; i++)
+	{
+		if (!ShvVmxEptImageRunValid(&runs[i], Capabilities, Empty, previous))
+		{
+			return STATUS_INVALID_IMAGE_FORMAT;
+		}
+
+		previous = runs[i].Gpa + runs[i].Count * SHV_EPT_LEVEL_SIZE(runs[i].Level);
+	}
+
+	for (ULONG i = 0; i < header->RunCount; i++)
+	{
+		status = Map(Context, &runs[i]);
+		if (!NT_SUCCESS(status))
+		{
+			return status;
+		}
+	}
+
+	return STATUS_SUCCESS;
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+static VOID
+ShvVmxEptImageEmit(
+	PSHV_EPT_IMAGE_WRITER writer
+)
+{
+	if (writer->Run.Count == 0)
+	{
+		return;
+	}
+
+	if (writer->Count < writer->Capacity)
+	{
+		writer->Runs[writer->Count] = writer->Run;
+		writer->Checksum = ShvVmxEptImageHash(&writer->Run,
+											  sizeof(writer->Run),
+											  writer->Checksum);
+	}
+
+	writer->Count++;
+	writer->Run.Count = 0;
+}
+
+static VOID
+ShvVmxEptImageWriteTable(
+	PSHV_EPT_IMAGE_WRITER writer,
+	PVMX_EPT_ENTRY table,
+	ULONG level,
+	ULONG64 base
+)
+{
+	PSHV_EPT_IMAGE_RUN run;
+	PVMX_EPT_ENTRY next;
+	VMX_EPT_ENTRY entry;
+	ULONG64 address, size, flags, leaf;
+
+	writer->Tables++;
+
+	run = &writer->Run;
+	size = SHV_EPT_LEVEL_SIZE(level);
+	flags = ~(SHV_EPT_PFN_MASK | VMX_EPT_ACCESSED | VMX_EPT_DIRTY);
+
+	for (ULONG i = 0; i < PAGE_SIZE / sizeof(VMX_EPT_ENTRY); i++)
+	{
+		entry.QuadPart = *(volatile ULONG64 *)&table[i].QuadPart;
+		address = base + i * size;
+
+		if (entry.QuadPart == writer->Empty)
+		{
+			continue;
+		}
+
+		if (level == 1 || SHV_EPT_ENTRY_IS_LARGE(&entry, level))
+		{
+			leaf = entry.QuadPart & ~(VMX_EPT_ACCESSED | VMX_EPT_DIRTY);
+
+			//
+			// Extend the current run when this leaf is the next one along in
+			// both address spaces, at the same level and with the same flags.
+			//
+			if ((run->Count != 0) &&
+				(run->Count < MAXULONG) &&
+				(run->Level == level) &&
+				((leaf & flags) == (run->First & flags)) &&
+				(address == run->Gpa + run->Count * size) &&
+				((leaf & SHV_EPT_PFN_MASK) ==
+				 (run->First & SHV_EPT_PFN_MASK) + run->Count * size))
+			{
+				run->Count++;
+				continue;
+			}
+
+			ShvVmxEptImageEmit(writer);
+			run->Gpa = address;
+			run->First = leaf;
+			run->Count = 1;
+			run->Level = level;
+			continue;
+		}
+
+		next = (PVMX_EPT_ENTRY)writer->Translate(writer->Context, entry.PFN);
+		if (next == NULL)
+		{
+			continue;
+		}
+
+		ShvVmxEptImageWriteTable(writer, next, level - 1, address);
+	}
+}
+
+static BOOLEAN
+ShvVmxEptImageRunValid(
+	const SHV_EPT_IMAGE_RUN *run,
+	ULONG64 capabilities,
+	ULONG64 empty,
+	ULONG64 previous
+)
+{
+	ULONG64 size, address;
+
+	//
+	// Only the levels that can hold a leaf, and only the large pages that
+	// this processor supports.
+	//
+	if ((run->Level < 1) || (run->Level > 3) ||
+		((run->Level == 2) && ((capabilities & VMX_EPT_CAP_PDE_2MB) == 0)) ||
+		((run->Level == 3) && ((capabilities & VMX_EPT_CAP_PDPTE_1GB) == 0)))
+	{
+		return FALSE;
+	}
+
+	size = SHV_EPT_LEVEL_SIZE(run->Level);
+	address = run->First & SHV_EPT_PFN_MASK;
+
+	//
+	// The leaf has to be one the writer could have produced: present, of
+	// the right kind for its level and naturally aligned on both sides.
+	//
+	if ((run->Count == 0) ||
+		(run->First == empty) ||
+		((run->First & VMX_EPT_ACCESS_RWX) == 0) ||
+		((run->First & (VMX_EPT_ACCESSED | VMX_EPT_DIRTY)) != 0) ||
+		((run->Level > 1) && !SHV_EPT_ENTRY_IS_LARGE(&run->First, run->Level)) ||
+		((run->Gpa & (size - 1)) != 0) ||
+		((address & (size - 1)) != 0))
+	{
+		return FALSE;
+	}
+
+	//
+	// The image only ever holds the identity map, so every run has to map
+	// its GPAs to the same host physical addresses.  Anything else would
+	// hand the guest memory it doesn't own.
+	//
+	if (address != run->Gpa)
+	{
+		return FALSE;
+	}
+
+	//
+	// The runs have to be sorted and disjoint, and stay inside of both
+	// address spaces.
+	//
+	if ((run->Gpa < previous) ||
+		(run->Gpa >= SHV_EPT_IMAGE_GPA_LIMIT) ||
+		(run->Count > (SHV_EPT_IMAGE_GPA_LIMIT - run->Gpa) / size) ||
+		(run->Count > (SHV_EPT_PFN_MASK + PAGE_SIZE - address) / size))
+	{
+		return FALSE;
+	}
+
+	return TRUE;
+}
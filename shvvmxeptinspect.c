@@ -0,0 +1,238 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvvmxeptinspect.c
+
+Abstract:
+
+	This module implements the EPT inspector, which summarizes the size and
+	shape of an EPT hierarchy.  It only reads the tables it is given and
+	doesn't depend on the rest of the EPT module, so it runs against the
+	live hierarchy as well as against tables built in memory elsewhere.
+
+Author:
+
+	agent (@agent) 15-Oct-2026 - Initial version
+
+Environment:
+
+	Kernel mode, or user mode against tables built in memory.
+
+--*/
+
+#include "shv.h"
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+// ===========================================================================
+//
+// LOCAL TYPES
+//
+// ===========================================================================
+
+//
+// What every level of the walk needs to know.
+//
+typedef struct _SHV_EPT_INSPECT_WALK
+{
+	PSHV_EPT_TRANSLATE Translate;
+	PVOID Context;
+	ULONG64 Capabilities;
+	ULONG64 Empty;
+	PSHV_EPT_INSPECTION Inspection;
+} SHV_EPT_INSPECT_WALK, *PSHV_EPT_INSPECT_WALK;
+
+// ===========================================================================
+//
+// LOCAL PROTOTYPES
+//
+// ===========================================================================
+
+static BOOLEAN
+ShvVmxEptInspectCollapsible(
+	PSHV_EPT_INSPECT_WALK walk,
+	PVMX_EPT_ENTRY table,
+	ULONG level
+);
+
+static VOID
+ShvVmxEptInspectTable(
+	PSHV_EPT_INSPECT_WALK walk,
+	PVMX_EPT_ENTRY table,
+	ULONG level,
+	ULONG64 base
+);
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+VOID
+ShvVmxEptInspectHierarchy(
+	_In_ PVMX_EPT_ENTRY Root,
+	_In_ PSHV_EPT_TRANSLATE Translate,
+	_In_opt_ PVOID Context,
+	_In_ ULONG64 Capabilities,
+	_In_ ULONG64 Empty,
+	_Out_ PSHV_EPT_INSPECTION Inspection
+)
+{
+	SHV_EPT_INSPECT_WALK walk;
+
+	__stosb((PUCHAR)Inspection, 0, sizeof(*Inspection));
+
+	walk.Translate = Translate;
+	walk.Context = Context;
+	walk.Capabilities = Capabilities;
+	walk.Empty = Empty;
+	walk.Inspection = Inspection;
+
+	//
+	// Entries are only ever read once, as a snapshot, so the hierarchy can
+	// keep changing underneath the walk.  The result is then a mix of the
+	// before and after, which is all a statistic needs.
+	//
+	ShvVmxEptInspectTable(&walk, Root, VMX_EPT_PAGE_WALK_LENGTH, 0);
+
+	for (ULONG l = 1; l <= VMX_EPT_PAGE_WALK_LENGTH; l++)
+	{
+		Inspection->TableBytes += Inspection->Tables[l] * PAGE_SIZE;
+	}
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+static BOOLEAN
+ShvVmxEptInspectCollapsible(
+	PSHV_EPT_INSPECT_WALK walk,
+	PVMX_EPT_ENTRY table,
+	ULONG level
+)
+{
+	VMX_EPT_ENTRY first, entry;
+	ULONG64 size, flags;
+
+	//
+	// The large page that would replace the table has to be supported.
+	//
+	if ((level == 1 && (walk->Capabilities & VMX_EPT_CAP_PDE_2MB) == 0) ||
+		(level == 2 && (walk->Capabilities & VMX_EPT_CAP_PDPTE_1GB) == 0) ||
+		level > 2)
+	{
+		return FALSE;
+	}
+
+	//
+	// Every entry has to be a present leaf, mapping the matching part of a
+	// naturally aligned region with the same permissions, memory type and
+	// everything else.  The accessed and dirty flags don't matter.
+	//
+	size = SHV_EPT_LEVEL_SIZE(level);
+	flags = ~(SHV_EPT_PFN_MASK | VMX_EPT_ACCESSED | VMX_EPT_DIRTY);
+
+	first.QuadPart = *(volatile ULONG64 *)&table[0].QuadPart;
+
+	if ((first.QuadPart & VMX_EPT_ACCESS_RWX) == 0 ||
+		(first.QuadPart & SHV_EPT_PFN_MASK & (SHV_EPT_LEVEL_SIZE(level + 1) - 1)) != 0)
+	{
+		return FALSE;
+	}
+
+	for (ULONG i = 0; i < PAGE_SIZE / sizeof(VMX_EPT_ENTRY); i++)
+	{
+		entry.QuadPart = *(volatile ULONG64 *)&table[i].QuadPart;
+
+		if ((level > 1 && !SHV_EPT_ENTRY_IS_LARGE(&entry, level)) ||
+			(entry.QuadPart & flags) != (first.QuadPart & flags) ||
+			(entry.QuadPart & SHV_EPT_PFN_MASK) != (first.QuadPart & SHV_EPT_PFN_MASK) + i * size)
+		{
+			return FALSE;
+		}
+	}
+
+	return TRUE;
+}
+
+static VOID
+ShvVmxEptInspectTable(
+	PSHV_EPT_INSPECT_WALK walk,
+	PVMX_EPT_ENTRY table,
+	ULONG level,
+	ULONG64 base
+)
+{
+	PSHV_EPT_INSPECTION inspection;
+	PVMX_EPT_ENTRY next;
+	VMX_EPT_ENTRY entry;
+	VMX_EPT_PTE leaf;
+	ULONG64 address, size;
+	PSHV_EPT_REGION region;
+
+	inspection = walk->Inspection;
+	inspection->Tables[level]++;
+
+	size = SHV_EPT_LEVEL_SIZE(level);
+
+	for (ULONG i = 0; i < PAGE_SIZE / sizeof(VMX_EPT_ENTRY); i++)
+	{
+		entry.QuadPart = *(volatile ULONG64 *)&table[i].QuadPart;
+		address = base + i * size;
+
+		if (entry.QuadPart == walk->Empty)
+		{
+			continue;
+		}
+
+		if (level == 1 || SHV_EPT_ENTRY_IS_LARGE(&entry, level))
+		{
+			//
+			// Leaves of every size keep the memory type where a PTE does.
+			//
+			leaf.QuadPart = entry.QuadPart;
+
+			inspection->Leaves[level]++;
+			inspection->MappedBytes += size;
+			inspection->BytesByType[leaf.MT] += size;
+			inspection->BytesByAccess[entry.QuadPart & VMX_EPT_ACCESS_RWX] += size;
+			continue;
+		}
+
+		next = (PVMX_EPT_ENTRY)walk->Translate(walk->Context, entry.PFN);
+		if (next == NULL)
+		{
+			continue;
+		}
+
+		//
+		// A table whose entries could all be a single large page one level
+		// up is memory and TLB reach that the identity map is missing out
+		// on.
+		//
+		if (ShvVmxEptInspectCollapsible(walk, next, level - 1))
+		{
+			inspection->Collapsible[level - 1]++;
+
+			if (inspection->CollapsibleListed < SHV_EPT_INSPECT_REGIONS)
+			{
+				region = &inspection->CollapsibleRegions[inspection->CollapsibleListed++];
+				region->Base = address;
+				region->Size = size;
+			}
+		}
+
+		ShvVmxEptInspectTable(walk, next, level - 1, address);
+	}
+}
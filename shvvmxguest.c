@@ -0,0 +1,584 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvvmxguest.c
+
+Abstract:
+
+	This module implements guest address translation for root mode.  It
+	walks the guest page tables from GUEST_CR3 and then the EPT to find the
+	host physical page behind a guest virtual address, caches the result in
+	a small per-VP software TLB, and copies guest memory through a per-VP
+	mapping window.
+
+Author:
+
+	agent (@agent) 15-Oct-2026 - Initial version
+
+Environment:
+
+	Kernel mode only.
+
+--*/
+
+#include "shv.h"
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// Bits in the guest control registers that decide how its addresses are
+// translated.
+//
+#define SHV_GUEST_CR0_PG                (1ULL << 31)
+#define SHV_GUEST_CR4_LA57              (1ULL << 12)
+
+//
+// Bits in an x64 paging structure entry, guest or host.
+//
+#define SHV_PAGING_PRESENT              (1ULL << 0)
+#define SHV_PAGING_WRITE                (1ULL << 1)
+#define SHV_PAGING_LARGE                (1ULL << 7)
+#define SHV_PAGING_ADDRESS_MASK         (0x000ffffffffff000ULL)
+
+//
+// The index of a virtual address in the paging structure at a given level
+// (1 = PT, 2 = PD, 3 = PDPT, 4 = PML4, 5 = PML5), and the size of the page
+// an entry at that level maps.
+//
+#define SHV_PAGING_INDEX(va, level) (((va) >> (PAGE_SHIFT + 9 * ((level) - 1))) & 0x1ff)
+#define SHV_PAGING_LEVEL_SIZE(level) (1ULL << (PAGE_SHIFT + 9 * ((level) - 1)))
+
+//
+// The host PTE that maps a page into the window of a VP: present,
+// writable, accessed, dirty and not executable.
+//
+#define SHV_GUEST_WINDOW_PTE            (0x63ULL | (1ULL << 63))
+
+#define SHV_GUEST_TAG                   'TSGS'
+
+// ===========================================================================
+//
+// LOCAL DATA
+//
+// ===========================================================================
+
+static BOOLEAN ShvVmxGuestEnabled = FALSE;
+
+// ===========================================================================
+//
+// LOCAL PROTOTYPES
+//
+// ===========================================================================
+
+static volatile ULONG64 *
+ShvVmxGuestFindHostPte(
+	_In_ PVOID Va
+);
+
+static BOOLEAN
+ShvVmxGuestReadEntry(
+	_In_ PSHV_VP_DATA VpData,
+	_In_ ULONG64 Gpa,
+	_Out_ PULONG64 Hpa,
+	_Out_ PULONG64 Value
+);
+
+static NTSTATUS
+ShvVmxGuestWalk(
+	_In_ PSHV_VP_DATA VpData,
+	_In_ ULONG64 Cr3,
+	_In_ ULONG64 Va,
+	_Out_ PSHV_GUEST_TLB_ENTRY Entry
+);
+
+static NTSTATUS
+ShvVmxGuestCopy(
+	_In_ PSHV_VP_DATA VpData,
+	_In_ ULONG64 Va,
+	_In_ PUCHAR Buffer,
+	_In_ SIZE_T Size,
+	_In_ BOOLEAN Write
+);
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+NTSTATUS
+ShvVmxGuestInitialize(
+	VOID
+)
+{
+	PSHV_VP_DATA vpData;
+	ULONG cpuCount;
+
+	//
+	// Root mode runs on the page tables of the system process, where
+	// nothing maps guest memory in general.  Reserve a page of system
+	// address space for each VP, and find the PTE behind it now, so that
+	// root mode can point the window at any page by writing that PTE.
+	//
+	cpuCount = KeQueryActiveProcessorCountEx(ALL_PROCESSOR_GROUPS);
+
+	for (ULONG i = 0; i < cpuCount; i++)
+	{
+		vpData = &ShvGlobalData->VpData[i];
+
+		vpData->GuestWindow = MmAllocateMappingAddress(PAGE_SIZE, SHV_GUEST_TAG);
+		if (vpData->GuestWindow == NULL)
+		{
+			ShvVmxGuestCleanup();
+			return STATUS_HV_NO_RESOURCES;
+		}
+
+		vpData->GuestWindowPte = ShvVmxGuestFindHostPte(vpData->GuestWindow);
+		if (vpData->GuestWindowPte == NULL)
+		{
+			//
+			// The reserved range isn't backed by a page table we can reach,
+			// so guest memory can't be accessed from root mode.  Say so,
+			// since everything that reads guest memory from root mode stops
+			// working: emulated stores fail, and hooks step every access.
+			//
+			SHV_DEBUG_PRINT("No PTE maps the guest window %p of VP %u, guest memory access is disabled\n",
+				vpData->GuestWindow,
+				i);
+			ShvVmxGuestCleanup();
+			return STATUS_SUCCESS;
+		}
+	}
+
+	ShvVmxGuestEnabled = TRUE;
+
+	return STATUS_SUCCESS;
+}
+
+VOID
+ShvVmxGuestCleanup(
+	VOID
+)
+{
+	PSHV_VP_DATA vpData;
+	ULONG cpuCount;
+
+	if (ShvGlobalData == NULL)
+	{
+		return;
+	}
+
+	//
+	// This only runs once every LP has left root mode, and every window is
+	// unmapped after each use, so the reservations can go right away.
+	//
+	cpuCount = KeQueryActiveProcessorCountEx(ALL_PROCESSOR_GROUPS);
+
+	for (ULONG i = 0; i < cpuCount; i++)
+	{
+		vpData = &ShvGlobalData->VpData[i];
+
+		if (vpData->GuestWindow != NULL)
+		{
+			MmFreeMappingAddress(vpData->GuestWindow, SHV_GUEST_TAG);
+			vpData->GuestWindow = NULL;
+			vpData->GuestWindowPte = NULL;
+		}
+	}
+
+	ShvVmxGuestEnabled = FALSE;
+}
+
+VOID
+ShvVmxGuestFlushTlb(
+	_In_ PSHV_VP_DATA VpData
+)
+{
+	for (ULONG i = 0; i < SHV_GUEST_TLB_ENTRIES; i++)
+	{
+		VpData->GuestTlb.Entries[i].Flags = 0;
+	}
+}
+
+NTSTATUS
+ShvVmxGuestTranslate(
+	_In_ PSHV_VP_DATA VpData,
+	_In_ ULONG64 Va,
+	_In_ BOOLEAN Write,
+	_Out_ PULONG64 Hpa
+)
+{
+	PSHV_GUEST_TLB_ENTRY entry;
+	PSHV_GUEST_TLB tlb;
+	ULONG64 cr3, page, value;
+	NTSTATUS ret;
+	ULONG l;
+
+	if (ShvVmxGuestEnabled == FALSE)
+	{
+		return STATUS_NOT_SUPPORTED;
+	}
+
+	__vmx_vmread(GUEST_CR3, (PSIZE_T)&cr3);
+
+	//
+	// We don't intercept CR3 loads or INVLPG, so the TLB notices a new
+	// address space here instead, and drops everything when it does.  It
+	// does the same when the EPT changed enough to make every VP flush.
+	//
+	tlb = &VpData->GuestTlb;
+
+	if ((tlb->Cr3 != cr3) || (tlb->Generation != VpData->EptGeneration))
+	{
+		ShvVmxGuestFlushTlb(VpData);
+		tlb->Cr3 = cr3;
+		tlb->Generation = VpData->EptGeneration;
+	}
+
+	page = Va & ~(PAGE_SIZE - 1);
+	entry = &tlb->Entries[(page >> PAGE_SHIFT) % SHV_GUEST_TLB_ENTRIES];
+
+	//
+	// The guest can change a mapping at any level without changing CR3 or
+	// telling us, so a hit still checks that every guest entry the walk
+	// went through is unchanged, from the top down.  As long as the ones
+	// above are, each table is still where it was, and the EPT hasn't
+	// changed either, so that takes none of the EPT lookups a walk does.
+	// A write to a page that was cached as read-only walks again, in case
+	// it was made writable since.
+	//
+	if (((entry->Flags & SHV_GUEST_TLB_VALID) != 0) &&
+		(entry->Cr3 == cr3) &&
+		(entry->Page == page) &&
+		(!Write || ((entry->Flags & SHV_GUEST_TLB_WRITABLE) != 0)))
+	{
+		for (l = 0; l < entry->Levels; l++)
+		{
+			value = *(volatile ULONG64 *)ShvVmxGuestMap(VpData, entry->EntryHpa[l]);
+			ShvVmxGuestUnmap(VpData);
+
+			if (value != entry->EntryValue[l])
+			{
+				break;
+			}
+		}
+
+		if (l == entry->Levels)
+		{
+			*Hpa = entry->Hpa | (Va & (PAGE_SIZE - 1));
+			return STATUS_SUCCESS;
+		}
+	}
+
+	entry->Flags = 0;
+
+	ret = ShvVmxGuestWalk(VpData, cr3, page, entry);
+	if (ret != STATUS_SUCCESS)
+	{
+		return ret;
+	}
+
+	if (Write && ((entry->Flags & SHV_GUEST_TLB_WRITABLE) == 0))
+	{
+		return STATUS_ACCESS_VIOLATION;
+	}
+
+	*Hpa = entry->Hpa | (Va & (PAGE_SIZE - 1));
+
+	return STATUS_SUCCESS;
+}
+
+NTSTATUS
+ShvVmxGuestReadVirtual(
+	_In_ PSHV_VP_DATA VpData,
+	_In_ ULONG64 Va,
+	_Out_writes_bytes_(Size) PVOID Buffer,
+	_In_ SIZE_T Size
+)
+{
+	return ShvVmxGuestCopy(VpData, Va, (PUCHAR)Buffer, Size, FALSE);
+}
+
+NTSTATUS
+ShvVmxGuestWriteVirtual(
+	_In_ PSHV_VP_DATA VpData,
+	_In_ ULONG64 Va,
+	_In_reads_bytes_(Size) const VOID *Buffer,
+	_In_ SIZE_T Size
+)
+{
+	return ShvVmxGuestCopy(VpData, Va, (PUCHAR)Buffer, Size, TRUE);
+}
+
+PVOID
+ShvVmxGuestMap(
+	_In_ PSHV_VP_DATA VpData,
+	_In_ ULONG64 Hpa
+)
+{
+	//
+	// Only this VP ever uses its window, so flushing the page locally is
+	// all it takes to drop whatever the window mapped before.
+	//
+	*VpData->GuestWindowPte = (Hpa & SHV_PAGING_ADDRESS_MASK) | SHV_GUEST_WINDOW_PTE;
+	__invlpg(VpData->GuestWindow);
+
+	return (PUCHAR)VpData->GuestWindow + (Hpa & (PAGE_SIZE - 1));
+}
+
+VOID
+ShvVmxGuestUnmap(
+	_In_ PSHV_VP_DATA VpData
+)
+{
+	*VpData->GuestWindowPte = 0;
+	__invlpg(VpData->GuestWindow);
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+static volatile ULONG64 *
+ShvVmxGuestFindHostPte(
+	_In_ PVOID Va
+)
+{
+	PHYSICAL_ADDRESS table;
+	PULONG64 entries;
+	ULONG64 entry;
+	ULONG levels;
+
+	//
+	// Walk the page tables we are running on, which are the ones root mode
+	// uses too, down to the PTE.  A large page or a missing table means
+	// there is no PTE to point somewhere else.
+	//
+	levels = ((__readcr4() & SHV_GUEST_CR4_LA57) != 0) ? 5 : 4;
+	table.QuadPart = __readcr3() & SHV_PAGING_ADDRESS_MASK;
+
+	for (ULONG l = levels; ; l--)
+	{
+		entries = (PULONG64)MmGetVirtualForPhysical(table);
+		if (entries == NULL)
+		{
+			return NULL;
+		}
+
+		if (l == 1)
+		{
+			return &entries[SHV_PAGING_INDEX((ULONG64)Va, l)];
+		}
+
+		entry = entries[SHV_PAGING_INDEX((ULONG64)Va, l)];
+
+		if (((entry & SHV_PAGING_PRESENT) == 0) ||
+			((entry & SHV_PAGING_LARGE) != 0))
+		{
+			return NULL;
+		}
+
+		table.QuadPart = entry & SHV_PAGING_ADDRESS_MASK;
+	}
+}
+
+static BOOLEAN
+ShvVmxGuestReadEntry(
+	_In_ PSHV_VP_DATA VpData,
+	_In_ ULONG64 Gpa,
+	_Out_ PULONG64 Hpa,
+	_Out_ PULONG64 Value
+)
+{
+	//
+	// Guest paging structures live in guest physical memory, so they go
+	// through the EPT like everything else.
+	//
+	if (ShvVmxEptTranslateGpa(Gpa, FALSE, Hpa) == FALSE)
+	{
+		return FALSE;
+	}
+
+	*Value = *(volatile ULONG64 *)ShvVmxGuestMap(VpData, *Hpa);
+	ShvVmxGuestUnmap(VpData);
+
+	return TRUE;
+}
+
+static NTSTATUS
+ShvVmxGuestWalk(
+	_In_ PSHV_VP_DATA VpData,
+	_In_ ULONG64 Cr3,
+	_In_ ULONG64 Va,
+	_Out_ PSHV_GUEST_TLB_ENTRY Entry
+)
+{
+	ULONG64 cr0, cr4, controls, table, value, hpa, gpa, size;
+	BOOLEAN writable;
+	ULONG levels;
+	LONG64 top;
+
+	__vmx_vmread(GUEST_CR0, (PSIZE_T)&cr0);
+	__vmx_vmread(GUEST_CR4, (PSIZE_T)&cr4);
+	__vmx_vmread(VM_ENTRY_CONTROLS, (PSIZE_T)&controls);
+
+	Entry->Cr3 = Cr3;
+	Entry->Page = Va;
+	Entry->Levels = 0;
+
+	writable = TRUE;
+
+	if ((cr0 & SHV_GUEST_CR0_PG) == 0)
+	{
+		//
+		// Without paging, virtual addresses are physical.
+		//
+		gpa = Va;
+	}
+	else if ((controls & VM_ENTRY_IA32E_MODE) == 0)
+	{
+		//
+		// The guest is x64 Windows, which never leaves IA-32e mode once it
+		// is running, so 32-bit and PAE paging aren't handled.
+		//
+		return STATUS_NOT_SUPPORTED;
+	}
+	else
+	{
+		levels = ((cr4 & SHV_GUEST_CR4_LA57) != 0) ? 5 : 4;
+
+		//
+		// The address has to be canonical for the paging mode.
+		//
+		top = (LONG64)Va >> (PAGE_SHIFT + 9 * levels - 1);
+		if ((top != 0) && (top != -1))
+		{
+			return STATUS_ACCESS_VIOLATION;
+		}
+
+		table = Cr3 & SHV_PAGING_ADDRESS_MASK;
+		gpa = 0;
+
+		for (ULONG l = levels; ; l--)
+		{
+			if (ShvVmxGuestReadEntry(VpData, table + SHV_PAGING_INDEX(Va, l) * sizeof(ULONG64), &hpa, &value) == FALSE ||
+				(value & SHV_PAGING_PRESENT) == 0)
+			{
+				return STATUS_ACCESS_VIOLATION;
+			}
+
+			Entry->EntryHpa[Entry->Levels] = hpa;
+			Entry->EntryValue[Entry->Levels] = value;
+			Entry->Levels++;
+
+			//
+			// A page is only writable if every level allows it.  CR0.WP is
+			// ignored, so supervisor writes obey read-only pages too.
+			//
+			writable = writable && ((value & SHV_PAGING_WRITE) != 0);
+
+			if ((l == 1) || ((l <= 3) && ((value & SHV_PAGING_LARGE) != 0)))
+			{
+				size = SHV_PAGING_LEVEL_SIZE(l);
+				gpa = ((value & SHV_PAGING_ADDRESS_MASK) & ~(size - 1)) | (Va & (size - 1));
+				break;
+			}
+
+			table = value & SHV_PAGING_ADDRESS_MASK;
+		}
+	}
+
+	//
+	// Then through the EPT, which can take away write access by itself.
+	//
+	if (ShvVmxEptTranslateGpa(gpa, TRUE, &hpa) == FALSE)
+	{
+		writable = FALSE;
+
+		if (ShvVmxEptTranslateGpa(gpa, FALSE, &hpa) == FALSE)
+		{
+			return STATUS_ACCESS_VIOLATION;
+		}
+	}
+
+	Entry->Hpa = hpa & ~(PAGE_SIZE - 1);
+	Entry->Flags = SHV_GUEST_TLB_VALID | (writable ? SHV_GUEST_TLB_WRITABLE : 0);
+
+	return STATUS_SUCCESS;
+}
+
+static NTSTATUS
+ShvVmxGuestCopy(
+	_In_ PSHV_VP_DATA VpData,
+	_In_ ULONG64 Va,
+	_In_ PUCHAR Buffer,
+	_In_ SIZE_T Size,
+	_In_ BOOLEAN Write
+)
+{
+	ULONG64 hpa[2];
+	SIZE_T first;
+	PUCHAR mapped;
+	NTSTATUS ret;
+
+	if ((Size == 0) || (Size > SHV_GUEST_ACCESS_MAX))
+	{
+		return STATUS_INVALID_PARAMETER;
+	}
+
+	//
+	// A bounded access spans at most two pages.  Translate both before
+	// copying anything, so a failure never leaves a partial copy behind.
+	//
+	first = min(Size, PAGE_SIZE - (Va & (PAGE_SIZE - 1)));
+
+	ret = ShvVmxGuestTranslate(VpData, Va, Write, &hpa[0]);
+	if (ret != STATUS_SUCCESS)
+	{
+		return ret;
+	}
+
+	if (first < Size)
+	{
+		ret = ShvVmxGuestTranslate(VpData, Va + first, Write, &hpa[1]);
+		if (ret != STATUS_SUCCESS)
+		{
+			return ret;
+		}
+	}
+
+	//
+	// The guest accessed and dirty flags aren't updated, so this is for
+	// inspecting guest memory and patching it, not emulating the guest.
+	//
+	for (ULONG i = 0; Size != 0; i++)
+	{
+		mapped = (PUCHAR)ShvVmxGuestMap(VpData, hpa[i]);
+
+		if (Write)
+		{
+			__movsb(mapped, Buffer, first);
+		}
+		else
+		{
+			__movsb(Buffer, mapped, first);
+		}
+
+		ShvVmxGuestUnmap(VpData);
+
+		Buffer += first;
+		Size -= first;
+		first = Size;
+	}
+
+	return STATUS_SUCCESS;
+}
@@ -0,0 +1,1067 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvvmxhook.c
+
+Abstract:
+
+	This module implements invisible inline hooks.  Every hooked page is
+	split: the default view executes a shadow copy of it that holds the
+	patches, and can't read or write it, while a view of the originals can
+	read and write it, but not execute it.  A VP only leaves the default
+	view to single step an instruction that reads or writes a hooked page,
+	and comes right back after it, so calling a hooked function never
+	exits.
+
+Author:
+
+	agent (@agent) 15-Oct-2026 - Initial version
+
+Environment:
+
+	Kernel mode only.
+
+--*/
+
+#include "shv.h"
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// Set to TRUE to support hooks.  This costs two views, and nothing else
+// until something is hooked.
+//
+#define SHV_HOOK_ENABLE FALSE
+
+#define SHV_HOOK_TAG 'KOHS'
+
+// ===========================================================================
+//
+// LOCAL TYPES
+//
+// ===========================================================================
+
+//
+// What a hook jumps to.  It counts the call and jumps on to the detour,
+// all in the guest:
+//
+//     lock inc qword ptr [Hits]
+//     jmp qword ptr [Detour]
+//
+typedef struct _SHV_HOOK_STUB
+{
+	UCHAR Code[24];
+	volatile LONG64 Hits;
+} SHV_HOOK_STUB, *PSHV_HOOK_STUB;
+
+//
+// An installed hook.  Gpa is where its patch goes.  Raw patches have no
+// stub.
+//
+typedef struct _SHV_HOOK
+{
+	struct _SHV_HOOK *Next;
+	ULONG Id;
+	PUCHAR Target;
+	ULONG64 Gpa;
+	PSHV_HOOK_STUB Stub;
+	ULONG Length;
+	UCHAR Patch[SHV_HOOK_PATCH_LENGTH];
+} SHV_HOOK, *PSHV_HOOK;
+
+//
+// A hooked page, and the shadow copy of it that is executed instead.
+//
+typedef struct _SHV_HOOK_PAGE
+{
+	ULONG64 Gpa;
+	PUCHAR Shadow;
+} SHV_HOOK_PAGE, *PSHV_HOOK_PAGE;
+
+//
+// Every hooked page, sorted by GPA.  Root mode reads it without a lock, so
+// a new table is only ever published whole, and the old one is only freed
+// once no LP can be looking at it.
+//
+typedef struct _SHV_HOOK_TABLE
+{
+	ULONG PageCount;
+	SHV_HOOK_PAGE Pages[ANYSIZE_ARRAY];
+} SHV_HOOK_TABLE, *PSHV_HOOK_TABLE;
+
+// ===========================================================================
+//
+// LOCAL DATA
+//
+// ===========================================================================
+
+static BOOLEAN ShvVmxHookRequested = SHV_HOOK_ENABLE;
+static BOOLEAN ShvVmxHookEnabled = FALSE;
+
+//
+// Serializes changes to the hooks.
+//
+static FAST_MUTEX ShvVmxHookLock = { 0 };
+
+static PSHV_HOOK ShvVmxHookList = NULL;
+static ULONG ShvVmxHookNextId = 1;
+static PSHV_HOOK_TABLE volatile ShvVmxHookTable = NULL;
+
+//
+// The view reads and writes of hooked pages are let through in, and the
+// one instructions on hooked pages that read them are stepped in.  Both
+// were cloned from the default view before anything was hooked, and only
+// the first one is changed since.
+//
+static ULONG ShvVmxHookDataView = SHV_EPT_DEFAULT_VIEW;
+static ULONG ShvVmxHookStepView = SHV_EPT_DEFAULT_VIEW;
+
+static SHV_HOOK_STATISTICS ShvVmxHookStatistics = { 0 };
+
+// ===========================================================================
+//
+// LOCAL PROTOTYPES
+//
+// ===========================================================================
+
+static VOID
+ShvVmxHookFree(
+	PSHV_HOOK hook
+);
+
+static NTSTATUS
+ShvVmxHookUpdate(
+	const ULONG64 *affected,
+	ULONG affectedCount
+);
+
+static NTSTATUS
+ShvVmxHookBuildShadow(
+	ULONG64 gpa,
+	PUCHAR *shadow
+);
+
+static BOOLEAN
+ShvVmxHookIsAffected(
+	const ULONG64 *affected,
+	ULONG affectedCount,
+	ULONG64 gpa
+);
+
+SHV_EPT_VIOLATION_HANDLER ShvVmxHookHandleViolation;
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+NTSTATUS
+ShvVmxHookInitialize(
+	VOID
+)
+{
+	NTSTATUS ret;
+	INT64 control;
+
+	if (ShvVmxHookRequested == FALSE)
+	{
+		return STATUS_SUCCESS;
+	}
+
+	ExInitializeFastMutex(&ShvVmxHookLock);
+
+	//
+	// Instructions that read their own page are stepped with the monitor
+	// trap flag.  Without it, or the views, there are no hooks, but the
+	// SHV works all the same.
+	//
+	control = __readmsr(MSR_IA32_VMX_PROCBASED_CTLS);
+
+	if (_bittest64(&control, 32 + 27) == 0)
+	{
+		SHV_DEBUG_PRINT("Hooks are not supported: no monitor trap flag\n");
+		return STATUS_SUCCESS;
+	}
+
+	ret = ShvVmxEptCreateView(&ShvVmxHookDataView);
+	if (ret == STATUS_SUCCESS)
+	{
+		ret = ShvVmxEptCreateView(&ShvVmxHookStepView);
+	}
+
+	if (ret != STATUS_SUCCESS)
+	{
+		SHV_DEBUG_PRINT("Hooks are not supported: %x\n", ret);
+		return STATUS_SUCCESS;
+	}
+
+	ret = ShvVmxEptRegisterViolationHandler(ShvVmxHookHandleViolation);
+	if (ret != STATUS_SUCCESS)
+	{
+		return ret;
+	}
+
+	ShvVmxHookEnabled = TRUE;
+
+	return STATUS_SUCCESS;
+}
+
+VOID
+ShvVmxHookCleanup(
+	VOID
+)
+{
+	PSHV_HOOK hook, removed;
+
+	if (ShvVmxHookEnabled == FALSE)
+	{
+		return;
+	}
+
+	//
+	// Drop every hook, which joins the pages again.  Pages without hooks
+	// are joined whether they were affected or not.
+	//
+	ExAcquireFastMutex(&ShvVmxHookLock);
+
+	removed = ShvVmxHookList;
+	ShvVmxHookList = NULL;
+
+	ShvVmxHookUpdate(NULL, 0);
+
+	ExReleaseFastMutex(&ShvVmxHookLock);
+
+	//
+	// This waits for every LP to be done with the table.  A VP that is still
+	// stepping an instruction finishes it without it.
+	//
+	ShvVmxEptUnregisterViolationHandler(ShvVmxHookHandleViolation);
+	ShvVmxHookEnabled = FALSE;
+
+	while ((hook = removed) != NULL)
+	{
+		removed = hook->Next;
+		ShvVmxHookFree(hook);
+	}
+
+	ShvVmxHookNextId = 1;
+	ShvVmxHookStatistics.Hooks = 0;
+}
+
+NTSTATUS
+ShvVmxHookInstall(
+	_In_reads_(Count) const SHV_HOOK_REQUEST *Hooks,
+	_In_ ULONG Count,
+	_Out_writes_(Count) PULONG Ids
+)
+{
+	PHYSICAL_ADDRESS pa;
+	PSHV_HOOK hook, added, other;
+	PULONG64 affected;
+	PUCHAR code;
+	ULONG i;
+	NTSTATUS ret;
+
+	if (ShvVmxHookEnabled == FALSE)
+	{
+		return STATUS_HV_NOT_PRESENT;
+	}
+
+	if (Count == 0)
+	{
+		return STATUS_SUCCESS;
+	}
+
+	for (i = 0; i < Count; i++)
+	{
+		Ids[i] = 0;
+
+		if (Hooks[i].Target == NULL ||
+			(Hooks[i].Detour == NULL) == (Hooks[i].Patch == NULL) ||
+			(Hooks[i].Patch != NULL && (Hooks[i].PatchLength == 0 || Hooks[i].PatchLength > SHV_HOOK_PATCH_LENGTH)) ||
+			BYTE_OFFSET(Hooks[i].Target) + ((Hooks[i].Patch != NULL) ? Hooks[i].PatchLength : SHV_HOOK_PATCH_LENGTH) > PAGE_SIZE)
+		{
+			return STATUS_INVALID_PARAMETER;
+		}
+	}
+
+	affected = (PULONG64)ExAllocatePoolWithTag(NonPagedPoolNx, Count * sizeof(ULONG64), SHV_HOOK_TAG);
+	if (affected == NULL)
+	{
+		return STATUS_HV_NO_RESOURCES;
+	}
+
+	//
+	// The targets are translated once, here.  The caller has to keep them
+	// resident and mapped to the same pages for as long as they are hooked.
+	//
+	added = NULL;
+	ret = STATUS_SUCCESS;
+
+	for (i = 0; i < Count; i++)
+	{
+		pa = MmGetPhysicalAddress(Hooks[i].Target);
+		if (pa.QuadPart == 0)
+		{
+			ret = STATUS_INVALID_PARAMETER;
+			break;
+		}
+
+		hook = (PSHV_HOOK)ExAllocatePoolWithTag(NonPagedPoolNx, sizeof(SHV_HOOK), SHV_HOOK_TAG);
+		if (hook == NULL)
+		{
+			ret = STATUS_HV_NO_RESOURCES;
+			break;
+		}
+
+		hook->Target = (PUCHAR)Hooks[i].Target;
+		hook->Gpa = pa.QuadPart;
+		hook->Stub = NULL;
+		hook->Next = added;
+		added = hook;
+
+		affected[i] = pa.QuadPart & ~(ULONG64)(PAGE_SIZE - 1);
+
+		if (Hooks[i].Patch != NULL)
+		{
+			hook->Length = Hooks[i].PatchLength;
+			__movsb(hook->Patch, Hooks[i].Patch, hook->Length);
+			continue;
+		}
+
+		//
+		// The stub is guest code, so it has to be executable.
+		//
+		hook->Stub = (PSHV_HOOK_STUB)ExAllocatePoolWithTag(NonPagedPoolExecute, sizeof(SHV_HOOK_STUB), SHV_HOOK_TAG);
+		if (hook->Stub == NULL)
+		{
+			ret = STATUS_HV_NO_RESOURCES;
+			break;
+		}
+
+		code = hook->Stub->Code;
+		__stosb(code, 0xcc, sizeof(hook->Stub->Code));
+
+		code[0] = 0xf0;
+		code[1] = 0x48;
+		code[2] = 0xff;
+		code[3] = 0x05;
+		*(ULONG UNALIGNED *)&code[4] = FIELD_OFFSET(SHV_HOOK_STUB, Hits) - 8;
+		code[8] = 0xff;
+		code[9] = 0x25;
+		*(ULONG UNALIGNED *)&code[10] = 0;
+		*(ULONG64 UNALIGNED *)&code[14] = (ULONG64)Hooks[i].Detour;
+
+		hook->Stub->Hits = 0;
+
+		//
+		// The patch jumps to the stub:
+		//
+		//     jmp qword ptr [rip]
+		//     dq Stub
+		//
+		hook->Length = SHV_HOOK_PATCH_LENGTH;
+		hook->Patch[0] = 0xff;
+		hook->Patch[1] = 0x25;
+		*(ULONG UNALIGNED *)&hook->Patch[2] = 0;
+		*(ULONG64 UNALIGNED *)&hook->Patch[6] = (ULONG64)hook->Stub;
+	}
+
+	if (ret != STATUS_SUCCESS)
+	{
+		while ((hook = added) != NULL)
+		{
+			added = hook->Next;
+			ShvVmxHookFree(hook);
+		}
+
+		ExFreePoolWithTag(affected, SHV_HOOK_TAG);
+		return ret;
+	}
+
+	ExAcquireFastMutex(&ShvVmxHookLock);
+
+	//
+	// No two patches can overlap, whether they are new or not.
+	//
+	for (hook = added; hook != NULL && ret == STATUS_SUCCESS; hook = hook->Next)
+	{
+		for (other = hook->Next; other != NULL; other = other->Next)
+		{
+			if (hook->Gpa < other->Gpa + other->Length && other->Gpa < hook->Gpa + hook->Length)
+			{
+				ret = STATUS_CONFLICTING_ADDRESSES;
+			}
+		}
+
+		for (other = ShvVmxHookList; other != NULL; other = other->Next)
+		{
+			if (hook->Gpa < other->Gpa + other->Length && other->Gpa < hook->Gpa + hook->Length)
+			{
+				ret = STATUS_CONFLICTING_ADDRESSES;
+			}
+		}
+	}
+
+	if (ret == STATUS_SUCCESS)
+	{
+		//
+		// The list was built backwards, so number the hooks in the order
+		// they were asked for.
+		//
+		i = Count;
+		for (hook = added; hook != NULL; hook = hook->Next)
+		{
+			hook->Id = ShvVmxHookNextId + --i;
+		}
+
+		for (hook = added; hook->Next != NULL; hook = hook->Next);
+		hook->Next = ShvVmxHookList;
+		ShvVmxHookList = added;
+
+		ret = ShvVmxHookUpdate(affected, Count);
+		if (ret != STATUS_SUCCESS)
+		{
+			//
+			// Put everything back the way it was without the new hooks.
+			//
+			ShvVmxHookList = hook->Next;
+			hook->Next = NULL;
+
+			ShvVmxHookUpdate(affected, Count);
+		}
+		else
+		{
+			//
+			// The new hooks are at the head of the list now, ahead of the
+			// ones that were there.
+			//
+			for (hook = added, i = Count; i != 0; hook = hook->Next)
+			{
+				Ids[--i] = hook->Id;
+			}
+
+			ShvVmxHookNextId += Count;
+			ShvVmxHookStatistics.Hooks += Count;
+			added = NULL;
+		}
+	}
+
+	ExReleaseFastMutex(&ShvVmxHookLock);
+
+	while ((hook = added) != NULL)
+	{
+		added = hook->Next;
+		ShvVmxHookFree(hook);
+	}
+
+	ExFreePoolWithTag(affected, SHV_HOOK_TAG);
+
+	return ret;
+}
+
+NTSTATUS
+ShvVmxHookRemove(
+	_In_reads_(Count) const ULONG *Ids,
+	_In_ ULONG Count
+)
+{
+	PSHV_HOOK hook, removed, *link;
+	PULONG64 affected;
+	ULONG i;
+	NTSTATUS ret;
+
+	if (ShvVmxHookEnabled == FALSE)
+	{
+		return STATUS_HV_NOT_PRESENT;
+	}
+
+	if (Count == 0)
+	{
+		return STATUS_SUCCESS;
+	}
+
+	affected = (PULONG64)ExAllocatePoolWithTag(NonPagedPoolNx, Count * sizeof(ULONG64), SHV_HOOK_TAG);
+	if (affected == NULL)
+	{
+		return STATUS_HV_NO_RESOURCES;
+	}
+
+	ExAcquireFastMutex(&ShvVmxHookLock);
+
+	//
+	// Either every hook goes, or none of them does.
+	//
+	for (i = 0; i < Count; i++)
+	{
+		for (hook = ShvVmxHookList; hook != NULL && hook->Id != Ids[i]; hook = hook->Next);
+
+		if (hook == NULL)
+		{
+			ExReleaseFastMutex(&ShvVmxHookLock);
+			ExFreePoolWithTag(affected, SHV_HOOK_TAG);
+			return STATUS_NOT_FOUND;
+		}
+	}
+
+	removed = NULL;
+
+	for (i = 0; i < Count; i++)
+	{
+		for (link = &ShvVmxHookList; *link != NULL && (*link)->Id != Ids[i]; link = &(*link)->Next);
+
+		//
+		// The same ID may be in the batch twice.
+		//
+		hook = *link;
+		if (hook == NULL)
+		{
+			affected[i] = affected[0];
+			continue;
+		}
+
+		*link = hook->Next;
+		hook->Next = removed;
+		removed = hook;
+
+		affected[i] = hook->Gpa & ~(ULONG64)(PAGE_SIZE - 1);
+		ShvVmxHookStatistics.Hooks--;
+	}
+
+	//
+	// Joining a page or rebuilding its shadow never needs tables, so this
+	// only fails if something else changed the pages underneath us.
+	//
+	ret = ShvVmxHookUpdate(affected, Count);
+
+	ExReleaseFastMutex(&ShvVmxHookLock);
+
+	ExFreePoolWithTag(affected, SHV_HOOK_TAG);
+
+	//
+	// Nothing jumps to the stubs anymore.  A thread that was preempted
+	// inside a stub is in the detour the caller still owns one instruction
+	// later, and the caller has to wait for those anyway.
+	//
+	while ((hook = removed) != NULL)
+	{
+		removed = hook->Next;
+		ShvVmxHookFree(hook);
+	}
+
+	return ret;
+}
+
+NTSTATUS
+ShvVmxHookGetHits(
+	_In_ ULONG Id,
+	_Out_ PULONG64 Hits
+)
+{
+	PSHV_HOOK hook;
+
+	*Hits = 0;
+
+	if (ShvVmxHookEnabled == FALSE)
+	{
+		return STATUS_HV_NOT_PRESENT;
+	}
+
+	ExAcquireFastMutex(&ShvVmxHookLock);
+
+	for (hook = ShvVmxHookList; hook != NULL && hook->Id != Id; hook = hook->Next);
+
+	if (hook == NULL)
+	{
+		ExReleaseFastMutex(&ShvVmxHookLock);
+		return STATUS_NOT_FOUND;
+	}
+
+	if (hook->Stub == NULL)
+	{
+		ExReleaseFastMutex(&ShvVmxHookLock);
+		return STATUS_NOT_SUPPORTED;
+	}
+
+	*Hits = (ULONG64)hook->Stub->Hits;
+
+	ExReleaseFastMutex(&ShvVmxHookLock);
+
+	return STATUS_SUCCESS;
+}
+
+VOID
+ShvVmxHookQuery(
+	_Out_ PSHV_HOOK_STATISTICS Statistics
+)
+{
+	*Statistics = ShvVmxHookStatistics;
+}
+
+BOOLEAN
+ShvVmxHookHandleStep(
+	_In_ PSHV_VP_STATE VpState
+)
+{
+	PSHV_VP_DATA vpData;
+
+	UNREFERENCED_PARAMETER(VpState);
+
+	//
+	// The monitor trap flag is shared with watchpoints, so only claim the
+	// step if it was ours.  Like the step of a watched access, this doesn't
+	// touch anything cleanup frees.
+	//
+	vpData = &ShvGlobalData->VpData[KeGetCurrentProcessorNumberEx(NULL)];
+
+	if (vpData->HookStep == FALSE)
+	{
+		return FALSE;
+	}
+
+	vpData->HookStep = FALSE;
+
+	ShvVmxEptSwitchView(SHV_EPT_DEFAULT_VIEW);
+	ShvUtilSetMonitorTrap(FALSE);
+
+	return TRUE;
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+static VOID
+ShvVmxHookFree(
+	PSHV_HOOK hook
+)
+{
+	if (hook->Stub != NULL)
+	{
+		ExFreePoolWithTag(hook->Stub, SHV_HOOK_TAG);
+	}
+
+	ExFreePoolWithTag(hook, SHV_HOOK_TAG);
+}
+
+static NTSTATUS
+ShvVmxHookUpdate(
+	const ULONG64 *affected,
+	ULONG affectedCount
+)
+{
+	PSHV_EPT_SPLIT splits;
+	PSHV_HOOK_TABLE table, old;
+	PSHV_HOOK_PAGE page, oldPage;
+	PUCHAR *retired;
+	PULONG64 pages;
+	PSHV_HOOK hook;
+	ULONG64 hpa, end;
+	ULONG count, oldCount, reused, created, retiredCount, i, j;
+	NTSTATUS ret;
+
+	old = ShvVmxHookTable;
+	oldCount = (old != NULL) ? old->PageCount : 0;
+
+	//
+	// Every page with a hook on it, once.
+	//
+	count = 0;
+	for (hook = ShvVmxHookList; hook != NULL; hook = hook->Next)
+	{
+		count++;
+	}
+
+	pages = NULL;
+	table = NULL;
+
+	if (count != 0)
+	{
+		pages = (PULONG64)ExAllocatePoolWithTag(NonPagedPoolNx, count * sizeof(ULONG64), SHV_HOOK_TAG);
+		if (pages == NULL)
+		{
+			return STATUS_HV_NO_RESOURCES;
+		}
+
+		i = 0;
+		for (hook = ShvVmxHookList; hook != NULL; hook = hook->Next)
+		{
+			pages[i++] = hook->Gpa & ~(ULONG64)(PAGE_SIZE - 1);
+		}
+
+		ShvUtilSortByKey(pages, count, sizeof(ULONG64));
+
+		for (i = 1, j = 1; i < count; i++)
+		{
+			if (pages[i] != pages[j - 1])
+			{
+				pages[j++] = pages[i];
+			}
+		}
+
+		count = j;
+
+		table = (PSHV_HOOK_TABLE)ExAllocatePoolWithTag(NonPagedPoolNx,
+			FIELD_OFFSET(SHV_HOOK_TABLE, Pages) + count * sizeof(SHV_HOOK_PAGE),
+			SHV_HOOK_TAG);
+		if (table == NULL)
+		{
+			ExFreePoolWithTag(pages, SHV_HOOK_TAG);
+			return STATUS_HV_NO_RESOURCES;
+		}
+
+		table->PageCount = 0;
+	}
+
+	splits = NULL;
+	retired = NULL;
+
+	if (count + oldCount != 0)
+	{
+		splits = (PSHV_EPT_SPLIT)ExAllocatePoolWithTag(NonPagedPoolNx,
+			(count + oldCount) * sizeof(SHV_EPT_SPLIT),
+			SHV_HOOK_TAG);
+		retired = (PUCHAR *)ExAllocatePoolWithTag(NonPagedPoolNx,
+			(oldCount + 1) * sizeof(PUCHAR),
+			SHV_HOOK_TAG);
+	}
+
+	if ((count + oldCount != 0) && (splits == NULL || retired == NULL))
+	{
+		ret = STATUS_HV_NO_RESOURCES;
+		goto Failure;
+	}
+
+	//
+	// Work out what changes, walking both tables in order.  Pages whose
+	// hooks didn't change keep their shadow.  The rest get a new one, so
+	// that a shadow is never patched while a VP may be executing it.
+	// Changes that need no tables go first, and new pages, which may need
+	// a large page split, last, so that a failure can only leave new pages
+	// behind, never a retired shadow that is still mapped.
+	//
+	reused = 0;
+	created = count + oldCount;
+	retiredCount = 0;
+	ret = STATUS_SUCCESS;
+	i = 0;
+	j = 0;
+
+	while (i < count || j < oldCount)
+	{
+		oldPage = (j < oldCount) ? &old->Pages[j] : NULL;
+
+		if (i < count && (oldPage == NULL || pages[i] < oldPage->Gpa))
+		{
+			//
+			// A page that wasn't hooked before has to be RAM that maps to
+			// itself with full access, or it belongs to someone else.
+			//
+			if (ShvMemMapLookup(pages[i], &end) != ShvMemoryRam ||
+				ShvVmxEptGetAccess(pages[i], &hpa) != VMX_EPT_ACCESS_RWX ||
+				hpa != pages[i])
+			{
+				ret = STATUS_CONFLICTING_ADDRESSES;
+				goto Failure;
+			}
+
+			page = &table->Pages[table->PageCount];
+			page->Gpa = pages[i];
+
+			ret = ShvVmxHookBuildShadow(page->Gpa, &page->Shadow);
+			if (ret != STATUS_SUCCESS)
+			{
+				goto Failure;
+			}
+
+			table->PageCount++;
+
+			created--;
+			splits[created].Gpa = page->Gpa;
+			splits[created].ExecuteHpa = MmGetPhysicalAddress(page->Shadow).QuadPart;
+			i++;
+		}
+		else if (i >= count || oldPage->Gpa < pages[i])
+		{
+			splits[reused].Gpa = oldPage->Gpa;
+			splits[reused].ExecuteHpa = oldPage->Gpa;
+			reused++;
+
+			retired[retiredCount++] = oldPage->Shadow;
+			j++;
+		}
+		else
+		{
+			page = &table->Pages[table->PageCount];
+			page->Gpa = pages[i];
+
+			if (ShvVmxHookIsAffected(affected, affectedCount, page->Gpa))
+			{
+				ret = ShvVmxHookBuildShadow(page->Gpa, &page->Shadow);
+				if (ret != STATUS_SUCCESS)
+				{
+					goto Failure;
+				}
+
+				splits[reused].Gpa = page->Gpa;
+				splits[reused].ExecuteHpa = MmGetPhysicalAddress(page->Shadow).QuadPart;
+				reused++;
+
+				retired[retiredCount++] = oldPage->Shadow;
+			}
+			else
+			{
+				page->Shadow = oldPage->Shadow;
+			}
+
+			table->PageCount++;
+			i++;
+			j++;
+		}
+	}
+
+	//
+	// Move the new pages up behind the rest.
+	//
+	for (i = created; i < count + oldCount; i++)
+	{
+		splits[reused++] = splits[i];
+	}
+
+	if (pages != NULL)
+	{
+		ExFreePoolWithTag(pages, SHV_HOOK_TAG);
+	}
+
+	if (table != NULL && table->PageCount == 0)
+	{
+		ExFreePoolWithTag(table, SHV_HOOK_TAG);
+		table = NULL;
+	}
+
+	//
+	// Publish the new table before splitting anything, so that every
+	// violation on a newly hooked page finds it.  A page that is no longer
+	// hooked may fault once more before it is joined, which the EPT code
+	// handles by lifting the protection itself.
+	//
+	InterlockedExchangePointer((PVOID volatile *)&ShvVmxHookTable, table);
+
+	if (reused != 0)
+	{
+		ret = ShvVmxEptSplitPages(ShvVmxHookDataView, splits, reused);
+	}
+
+	//
+	// Root mode runs with interrupts off, so once every LP took the IPI,
+	// none of them can still be looking at the old table.  The shootdown
+	// already made sure no VP still executes a retired shadow.
+	//
+	if (old != NULL)
+	{
+		KeIpiGenericCall(ShvUtilIpiBarrier, 0);
+		ExFreePoolWithTag(old, SHV_HOOK_TAG);
+	}
+
+	for (i = 0; i < retiredCount; i++)
+	{
+		ExFreePoolWithTag(retired[i], SHV_HOOK_TAG);
+	}
+
+	if (splits != NULL)
+	{
+		ExFreePoolWithTag(splits, SHV_HOOK_TAG);
+		ExFreePoolWithTag(retired, SHV_HOOK_TAG);
+	}
+
+	ShvVmxHookStatistics.Pages = (table != NULL) ? table->PageCount : 0;
+
+	return ret;
+
+Failure:
+	//
+	// Free the shadows that were built for the new table, and leave the
+	// old one as it was.
+	//
+	for (i = 0; table != NULL && i < table->PageCount; i++)
+	{
+		oldPage = (old != NULL) ?
+			(PSHV_HOOK_PAGE)ShvUtilFindByKey(old->Pages, old->PageCount, sizeof(SHV_HOOK_PAGE), table->Pages[i].Gpa) :
+			NULL;
+
+		if (oldPage == NULL || oldPage->Shadow != table->Pages[i].Shadow)
+		{
+			ExFreePoolWithTag(table->Pages[i].Shadow, SHV_HOOK_TAG);
+		}
+	}
+
+	if (splits != NULL)
+	{
+		ExFreePoolWithTag(splits, SHV_HOOK_TAG);
+	}
+
+	if (retired != NULL)
+	{
+		ExFreePoolWithTag(retired, SHV_HOOK_TAG);
+	}
+
+	if (table != NULL)
+	{
+		ExFreePoolWithTag(table, SHV_HOOK_TAG);
+	}
+
+	if (pages != NULL)
+	{
+		ExFreePoolWithTag(pages, SHV_HOOK_TAG);
+	}
+
+	return ret;
+}
+
+static NTSTATUS
+ShvVmxHookBuildShadow(
+	ULONG64 gpa,
+	PUCHAR *shadow
+)
+{
+	PSHV_HOOK hook;
+	PUCHAR page;
+
+	*shadow = NULL;
+
+	//
+	// Page sized allocations are page aligned.
+	//
+	page = (PUCHAR)ExAllocatePoolWithTag(NonPagedPoolNx, PAGE_SIZE, SHV_HOOK_TAG);
+	if (page == NULL)
+	{
+		return STATUS_HV_NO_RESOURCES;
+	}
+
+	//
+	// Copy the original through the address of any hook on the page.  If
+	// the page is already split, the read faults into the view of the
+	// originals like any other.
+	//
+	for (hook = ShvVmxHookList; hook != NULL; hook = hook->Next)
+	{
+		if ((hook->Gpa & ~(ULONG64)(PAGE_SIZE - 1)) == gpa)
+		{
+			break;
+		}
+	}
+
+	NT_ASSERT(hook != NULL);
+
+	__movsb(page, (PUCHAR)PAGE_ALIGN(hook->Target), PAGE_SIZE);
+
+	//
+	// Then apply the patch of every hook on the page.
+	//
+	for (hook = ShvVmxHookList; hook != NULL; hook = hook->Next)
+	{
+		if ((hook->Gpa & ~(ULONG64)(PAGE_SIZE - 1)) == gpa)
+		{
+			__movsb(page + BYTE_OFFSET(hook->Gpa), hook->Patch, hook->Length);
+		}
+	}
+
+	*shadow = page;
+
+	return STATUS_SUCCESS;
+}
+
+static BOOLEAN
+ShvVmxHookIsAffected(
+	const ULONG64 *affected,
+	ULONG affectedCount,
+	ULONG64 gpa
+)
+{
+	for (ULONG i = 0; i < affectedCount; i++)
+	{
+		if (affected[i] == gpa)
+		{
+			return TRUE;
+		}
+	}
+
+	return FALSE;
+}
+
+BOOLEAN
+ShvVmxHookHandleViolation(
+	_In_ PSHV_VP_STATE VpState,
+	_In_ ULONG64 Gpa,
+	_In_ ULONG Access
+)
+{
+	PSHV_HOOK_TABLE table;
+	PSHV_VP_DATA vpData;
+	ULONG64 hpa;
+
+	//
+	// The default view can execute every hooked page, and withholds only
+	// reads and writes of it.  Anything else was protected by someone else.
+	//
+	if ((Access & VMX_EPT_ACCESS_EXECUTE) != 0 ||
+		(Access & (VMX_EPT_ACCESS_READ | VMX_EPT_ACCESS_WRITE)) == 0)
+	{
+		return FALSE;
+	}
+
+	table = ShvVmxHookTable;
+	if (table == NULL)
+	{
+		return FALSE;
+	}
+
+	if (ShvUtilFindByKey(table->Pages,
+		table->PageCount,
+		sizeof(SHV_HOOK_PAGE),
+		Gpa & ~(ULONG64)(PAGE_SIZE - 1)) == NULL)
+	{
+		return FALSE;
+	}
+
+	//
+	// Step the read or write in the view of the originals, and come back
+	// to the default view right after it.  Nothing but the hooked pages is
+	// kept up to date in that view, so the VP can't stay in it for longer.
+	//
+	// An instruction that is itself on a hooked page can't run in that
+	// view.  Root mode can't read a hooked page through the default view
+	// either, which is how to tell, so step those in the view that
+	// withholds nothing instead.
+	//
+	vpData = &ShvGlobalData->VpData[KeGetCurrentProcessorNumberEx(NULL)];
+
+	if (ShvVmxGuestTranslate(vpData, VpState->GuestRip, FALSE, &hpa) == STATUS_SUCCESS &&
+		ShvVmxGuestTranslate(vpData, VpState->GuestRip + SHV_EMUL_MAX_LENGTH - 1, FALSE, &hpa) == STATUS_SUCCESS)
+	{
+		InterlockedIncrement64((volatile LONG64 *)&ShvVmxHookStatistics.DataSwitches);
+
+		ShvVmxEptSwitchView(ShvVmxHookDataView);
+	}
+	else
+	{
+		InterlockedIncrement64((volatile LONG64 *)&ShvVmxHookStatistics.Steps);
+
+		ShvVmxEptSwitchView(ShvVmxHookStepView);
+	}
+
+	vpData->HookStep = TRUE;
+	ShvUtilSetMonitorTrap(TRUE);
+
+	return TRUE;
+}
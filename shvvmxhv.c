@@ -56,6 +56,84 @@ ShvVmxRead(
 	return FieldData;
 }
 
+VOID
+ShvVmxHandleVmfunc(
+	VOID
+)
+{
+	//
+	// A VMFUNC the processor can't carry out exits instead of faulting, so
+	// raise the #UD it would have.  Faults don't move past the instruction.
+	//
+	__vmx_vmwrite(VM_ENTRY_INTR_INFO,
+		INTR_INFO_VALID_MASK | INTR_TYPE_HARD_EXCEPTION | 6);
+}
+
+VOID
+ShvVmxRestoreNmiBlocking(
+	VOID
+)
+{
+	//
+	// An IRET that faulted or filled the PML log may already have unblocked
+	// NMIs before the exit.  It will run again, so block them again until it
+	// does, unless the exit happened while delivering another event.
+	//
+	if (((ShvVmxRead(EXIT_QUALIFICATION) & INTR_INFO_UNBLOCK_NMI) != 0) &&
+		((ShvVmxRead(IDT_VECTORING_INFO) & INTR_INFO_VALID_MASK) == 0))
+	{
+		__vmx_vmwrite(GUEST_INTERRUPTIBILITY_INFO,
+			ShvVmxRead(GUEST_INTERRUPTIBILITY_INFO) | GUEST_INTR_STATE_NMI);
+	}
+}
+
+VOID
+ShvVmxReinjectEvent(
+	VOID
+)
+{
+	ULONG_PTR vectoringInfo;
+
+	//
+	// An exit that happened while an interrupt or exception was being
+	// delivered, such as a violation on the stack or the IDT, or a full PML
+	// log, lost that event.  The guest only retries the delivery if the
+	// event is injected again, unless handling the exit already injected
+	// something that takes its place.  The undefined and reserved bits
+	// have to be clear to enter.
+	//
+	vectoringInfo = ShvVmxRead(IDT_VECTORING_INFO);
+	if (((vectoringInfo & INTR_INFO_VALID_MASK) == 0) ||
+		((ShvVmxRead(VM_ENTRY_INTR_INFO) & INTR_INFO_VALID_MASK) != 0))
+	{
+		return;
+	}
+
+	__vmx_vmwrite(VM_ENTRY_INTR_INFO,
+		vectoringInfo & (INTR_INFO_VALID_MASK | INTR_INFO_DELIVER_CODE_MASK |
+			INTR_INFO_INTR_TYPE_MASK | INTR_INFO_VECTOR_MASK));
+
+	if ((vectoringInfo & INTR_INFO_DELIVER_CODE_MASK) != 0)
+	{
+		__vmx_vmwrite(VM_ENTRY_EXCEPTION_ERROR_CODE, ShvVmxRead(IDT_VECTORING_ERROR_CODE));
+	}
+
+	//
+	// Software interrupts and exceptions push the address of the next
+	// instruction, so they need the length of the one that raised them.
+	//
+	switch (vectoringInfo & INTR_INFO_INTR_TYPE_MASK)
+	{
+	case INTR_TYPE_SOFT_INTR:
+	case INTR_TYPE_PRIV_SW_EXCEPTION:
+	case INTR_TYPE_SOFT_EXCEPTION:
+		__vmx_vmwrite(VM_ENTRY_INSTRUCTION_LEN, ShvVmxRead(VM_EXIT_INSTRUCTION_LEN));
+		break;
+	default:
+		break;
+	}
+}
+
 VOID
 ShvVmxHandleInvd(
 	VOID
@@ -162,6 +240,20 @@ ShvVmxHandleExit(
 	//
 	switch (VpState->ExitReason)
 	{
+	case EXIT_REASON_EXCEPTION_NMI:
+		//
+		// Only NMIs exit, and only when root mode asked for them to make
+		// other VPs flush.  Each one is queued for the guest, and nothing
+		// was executed, so return without moving past the instruction.
+		//
+		ShvVmxEptHandleNmi();
+		return;
+	case EXIT_REASON_PENDING_VIRT_NMI:
+		//
+		// The guest can take a queued NMI now, which is delivered on the
+		// way back in.
+		//
+		return;
 	case EXIT_REASON_CPUID:
 		ShvVmxHandleCpuid(VpState);
 		break;
@@ -172,9 +264,50 @@ ShvVmxHandleExit(
 		ShvVmxHandleXsetbv(VpState);
 		break;
 	case EXIT_REASON_EPT_VIOLATION:
+		//
+		// The access that faulted never happened.  Once the violation is
+		// handled, return without moving past the instruction and let the
+		// guest retry it.
+		//
+		ShvVmxRestoreNmiBlocking();
 		ShvVmxEptHandleViolation(VpState);
-		break;
+		return;
+	case EXIT_REASON_MONITOR_TRAP_FLAG:
+		//
+		// An access to a hooked or watched page was just stepped.  The
+		// instruction already moved the instruction pointer itself.
+		//
+		if (ShvVmxHookHandleStep(VpState) == FALSE)
+		{
+			ShvVmxWatchHandleStep(VpState);
+		}
+		return;
+	case EXIT_REASON_PML_FULL:
+		//
+		// The log is drained on every exit.  The write that filled it never
+		// happened, so return without moving past the instruction and let
+		// the guest retry it.
+		//
+		ShvVmxRestoreNmiBlocking();
+		return;
 	case EXIT_REASON_VMCALL:
+		//
+		// The tracer moves past its own VMCALL, which stands in for a
+		// longer instruction.  Any other one fails like the rest.
+		//
+		if (ShvVmxTraceHandleVmcall(VpState) != FALSE)
+		{
+			return;
+		}
+		ShvVmxHandleVmx(VpState);
+		break;
+	case EXIT_REASON_VMFUNC:
+		//
+		// VMFUNC only exits when asked for a function or a view that
+		// doesn't exist, which raises #UD in place of the instruction.
+		//
+		ShvVmxHandleVmfunc();
+		return;
 	case EXIT_REASON_VMCLEAR:
 	case EXIT_REASON_VMLAUNCH:
 	case EXIT_REASON_VMPTRLD:
@@ -310,6 +443,18 @@ ShvVmxEntryHandler(
 		//
 		Context->Rsp += sizeof(Context->Rcx);
 
+		//
+		// Move the pages logged by PML into the dirty bitmap, and flush this
+		// VP's cached EPT translations if the shared EPT changed since it
+		// last did.  Then hand the guest back any event the exit cut short,
+		// and any NMI it is waiting for, once whatever this exit injected
+		// has been decided.
+		//
+		ShvVmxPmlDrain(vpData);
+		ShvVmxEptSynchronize(vpData);
+		ShvVmxReinjectEvent();
+		ShvVmxEptDeliverNmi(vpData);
+
 		//
 		// Return into a VMXRESUME intrinsic, which we broke out as its own
 		// function, in order to allow this to work. No assembly code will be
@@ -0,0 +1,1903 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvvmxmerge.c
+
+Abstract:
+
+	This module implements identical page merging.  A background scanner
+	fingerprints guest pages, confirms duplicates byte for byte, and points
+	them all at a single read-only host frame in the default EPT view.  A
+	write to a merged page faults, and root mode gives the page a frame of
+	its own again.  The host frames the merged pages leave unused are
+	reported, and can be lent to a caller.
+
+Author:
+
+	agent (@agent) 15-Oct-2026 - Initial version
+
+Environment:
+
+	Kernel mode only.
+
+--*/
+
+#include "shv.h"
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// Set to TRUE to merge identical pages in the guest physical ranges that
+// are registered with ShvVmxMergeAddRange.  Nothing is merged otherwise.
+//
+#define SHV_MERGE_ENABLE FALSE
+
+#define SHV_MERGE_TAG 'GRMS'
+
+//
+// How often, in milliseconds, the scanner tops up the frames that lent
+// pages are copied into, and how often it scans.  Each scan looks at up to
+// SHV_MERGE_SCAN_PAGES pages, picking up where the last one stopped.
+//
+#define SHV_MERGE_TICK (10)
+#define SHV_MERGE_SCAN_PERIOD (1000)
+#define SHV_MERGE_SCAN_PAGES (4096)
+
+//
+// The number of pages the page table can track, which includes the frames
+// the merging itself uses.  It is kept at most half full, so that probes
+// stay short.
+//
+#define SHV_MERGE_TABLE_BITS (16)
+#define SHV_MERGE_TABLE_SIZE (1UL << SHV_MERGE_TABLE_BITS)
+#define SHV_MERGE_MAX_PAGES (SHV_MERGE_TABLE_SIZE / 2)
+
+//
+// The number of fingerprint buckets shared frames are found by, and of
+// slots remembering a page that no other page matched yet.
+//
+#define SHV_MERGE_BUCKETS (4096)
+#define SHV_MERGE_CANDIDATES (4096)
+
+//
+// The number of pages merged at once.  Each batch costs two shootdowns,
+// whatever its size.
+//
+#define SHV_MERGE_BATCH (64)
+
+//
+// The number of frames kept at hand, while pages are lent, to copy a lent
+// page into when the guest writes to it.
+//
+#define SHV_MERGE_RESERVE_FRAMES (64)
+
+//
+// Marks a slot of the page table as used.  Keys are page aligned GPAs, so
+// the low bit is free.
+//
+#define SHV_MERGE_KEY_USED (1)
+
+//
+// The constants the fingerprint mixes pages with.
+//
+#define SHV_MERGE_SEED (0x9E3779B97F4A7C15ULL)
+#define SHV_MERGE_MULTIPLIER (0x85EBCA6BULL)
+#define SHV_MERGE_FOLD_PRIME (0x100000001B3ULL)
+
+//
+// Add to one of the statistics.  Root mode updates them too.
+//
+#define SHV_MERGE_COUNT(field, delta) \
+	InterlockedAdd64((volatile LONG64 *)&ShvVmxMergeStatistics.field, (delta))
+
+// ===========================================================================
+//
+// LOCAL TYPES
+//
+// ===========================================================================
+
+//
+// What a tracked guest page is doing.  Only the scanner, under the lock,
+// moves a page out of Idle, or out of Busy when it was the one to set it.
+// Root mode moves pages from Merging back to Idle, and from Shared through
+// Busy to Unsharing when the guest writes to them.  An Unsharing page is
+// already mapped read-only at its new frame, and goes on to Idle or Private
+// on a later write, once no VP can still read the shared frame.  Owned
+// pages are the frames merging itself uses, which must never be merged.
+//
+typedef enum _SHV_MERGE_STATE
+{
+	ShvMergeIdle,
+	ShvMergeMerging,
+	ShvMergeBusy,
+	ShvMergeShared,
+	ShvMergeUnsharing,
+	ShvMergePrivate,
+	ShvMergeOwned,
+} SHV_MERGE_STATE, *PSHV_MERGE_STATE;
+
+//
+// A host frame out of nonpaged pool, either backing merged pages or held
+// in reserve.  References counts the guest pages it backs, and Next links
+// the frames of a fingerprint bucket.
+//
+typedef struct _SHV_MERGE_FRAME
+{
+	SLIST_ENTRY ReserveEntry;
+	struct _SHV_MERGE_FRAME *Next;
+	PVOID Va;
+	ULONG64 Hpa;
+	ULONG64 Fingerprint;
+	volatile LONG References;
+} SHV_MERGE_FRAME, *PSHV_MERGE_FRAME;
+
+//
+// A tracked guest page.  Frame is the shared frame backing it while it is
+// Shared, and Private the reserve frame backing it while it is Private.
+// While it is Unsharing it has both, and Generation is the shootdown it
+// waits for.  Lent pages had their own host frame lent out, so a write has to be
+// copied into a reserve frame instead.  Root mode finds pages without a
+// lock, so a slot is only ever published by setting its key, and is never
+// reused for another page.
+//
+typedef struct _SHV_MERGE_PAGE
+{
+	volatile ULONG64 Key;
+	volatile LONG State;
+	BOOLEAN Lent;
+	PSHV_MERGE_FRAME Frame;
+	PSHV_MERGE_FRAME Private;
+	LONG64 Generation;
+} SHV_MERGE_PAGE, *PSHV_MERGE_PAGE;
+
+//
+// The last page seen with a fingerprint that no shared frame has.
+//
+typedef struct _SHV_MERGE_CANDIDATE
+{
+	ULONG64 Fingerprint;
+	ULONG64 Gpa;
+} SHV_MERGE_CANDIDATE, *PSHV_MERGE_CANDIDATE;
+
+//
+// A page the scanner wants to back by a shared frame.
+//
+typedef struct _SHV_MERGE_BATCH_ENTRY
+{
+	ULONG64 Gpa;
+	PSHV_MERGE_FRAME Frame;
+	PSHV_MERGE_PAGE Page;
+} SHV_MERGE_BATCH_ENTRY, *PSHV_MERGE_BATCH_ENTRY;
+
+// ===========================================================================
+//
+// LOCAL DATA
+//
+// ===========================================================================
+
+static BOOLEAN ShvVmxMergeRequested = SHV_MERGE_ENABLE;
+static BOOLEAN ShvVmxMergeEnabled = FALSE;
+
+//
+// Serializes everything but root mode: the scanner, lending and the
+// ranges.  Root mode only ever looks at the page table and the reserve.
+//
+static FAST_MUTEX ShvVmxMergeLock = { 0 };
+
+//
+// The page table, the shared frames by fingerprint, and the pages that
+// might get a match.
+//
+static PSHV_MERGE_PAGE ShvVmxMergePages = NULL;
+static ULONG ShvVmxMergePageCount = 0;
+static PSHV_MERGE_FRAME *ShvVmxMergeBuckets = NULL;
+static PSHV_MERGE_CANDIDATE ShvVmxMergeCandidates = NULL;
+static PSHV_MERGE_FRAME ShvVmxMergeZeroFrame = NULL;
+static SLIST_HEADER ShvVmxMergeReserve = { 0 };
+
+//
+// The page the scanner reads guest pages into, and the page whose GPA is
+// pointed at a host frame to write to it.
+//
+static PUCHAR ShvVmxMergeBuffer = NULL;
+static PUCHAR ShvVmxMergeScratch = NULL;
+static ULONG64 ShvVmxMergeScratchGpa = 0;
+
+//
+// The ranges to merge, and where the scanner is in them.
+//
+static SHV_EPT_REGION ShvVmxMergeRanges[SHV_MERGE_MAX_RANGES] = { 0 };
+static ULONG ShvVmxMergeRangeCount = 0;
+static ULONG ShvVmxMergeCursorRange = 0;
+static ULONG64 ShvVmxMergeCursor = 0;
+
+//
+// The batch being merged.  Only the holder of the lock uses it.
+//
+static SHV_MERGE_BATCH_ENTRY ShvVmxMergeBatch[SHV_MERGE_BATCH] = { 0 };
+static SHV_EPT_PROTECTION ShvVmxMergeProtections[SHV_MERGE_BATCH] = { 0 };
+static SHV_EPT_REMAP ShvVmxMergeRemaps[SHV_MERGE_BATCH] = { 0 };
+
+static KEVENT ShvVmxMergeStop = { 0 };
+static PKTHREAD ShvVmxMergeThreadObject = NULL;
+static SHV_MERGE_STATISTICS ShvVmxMergeStatistics = { 0 };
+
+// ===========================================================================
+//
+// LOCAL PROTOTYPES
+//
+// ===========================================================================
+
+static PSHV_MERGE_PAGE
+ShvVmxMergeFindPage(
+	ULONG64 gpa,
+	BOOLEAN insert
+);
+
+static BOOLEAN
+ShvVmxMergeNextPage(
+	PULONG64 gpa
+);
+
+static BOOLEAN
+ShvVmxMergeReadPage(
+	ULONG64 gpa
+);
+
+static ULONG64
+ShvVmxMergeFingerprint(
+	const VOID *page,
+	PBOOLEAN zero
+);
+
+static PSHV_MERGE_FRAME
+ShvVmxMergeAllocateFrame(
+	VOID
+);
+
+static VOID
+ShvVmxMergeFreeFrame(
+	PSHV_MERGE_FRAME frame
+);
+
+static PSHV_MERGE_FRAME
+ShvVmxMergeFindFrame(
+	ULONG64 fingerprint
+);
+
+static PSHV_MERGE_FRAME
+ShvVmxMergeCreateFrame(
+	ULONG64 fingerprint
+);
+
+static VOID
+ShvVmxMergeFreeUnusedFrames(
+	VOID
+);
+
+static VOID
+ShvVmxMergeFillReserve(
+	VOID
+);
+
+static NTSTATUS
+ShvVmxMergeWriteFrame(
+	ULONG64 hpa,
+	const VOID *source
+);
+
+static VOID
+ShvVmxMergeScan(
+	VOID
+);
+
+static VOID
+ShvVmxMergeCommitBatch(
+	ULONG count
+);
+
+static VOID
+ShvVmxMergeUnshareBatch(
+	ULONG count
+);
+
+static NTSTATUS
+ShvVmxMergeRestorePage(
+	PSHV_MERGE_PAGE page
+);
+
+static LONG
+ShvVmxMergeFinishUnshare(
+	PSHV_MERGE_PAGE page
+);
+
+SHV_EPT_VIOLATION_HANDLER ShvVmxMergeHandleViolation;
+KSTART_ROUTINE ShvVmxMergeThread;
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+NTSTATUS
+ShvVmxMergeInitialize(
+	VOID
+)
+{
+	PSHV_MERGE_PAGE page;
+	NTSTATUS ret;
+
+	if (ShvVmxMergeRequested == FALSE)
+	{
+		return STATUS_SUCCESS;
+	}
+
+	ExInitializeFastMutex(&ShvVmxMergeLock);
+	InitializeSListHead(&ShvVmxMergeReserve);
+	KeInitializeEvent(&ShvVmxMergeStop, NotificationEvent, FALSE);
+
+	//
+	// A write to a merged page changes what its GPA maps to, which every
+	// VP has to see before the write goes through.  That takes a shootdown
+	// from root mode, which has to be set up before any VP is launched.
+	//
+	ret = ShvVmxEptEnableRootShootdown();
+	if (ret != STATUS_SUCCESS)
+	{
+		SHV_DEBUG_PRINT("Page merging is not supported: %x\n", ret);
+		return STATUS_SUCCESS;
+	}
+
+	ShvVmxMergePages = (PSHV_MERGE_PAGE)ExAllocatePoolWithTag(NonPagedPoolNx,
+		SHV_MERGE_TABLE_SIZE * sizeof(SHV_MERGE_PAGE),
+		SHV_MERGE_TAG);
+	ShvVmxMergeBuckets = (PSHV_MERGE_FRAME *)ExAllocatePoolWithTag(NonPagedPoolNx,
+		SHV_MERGE_BUCKETS * sizeof(PSHV_MERGE_FRAME),
+		SHV_MERGE_TAG);
+	ShvVmxMergeCandidates = (PSHV_MERGE_CANDIDATE)ExAllocatePoolWithTag(NonPagedPoolNx,
+		SHV_MERGE_CANDIDATES * sizeof(SHV_MERGE_CANDIDATE),
+		SHV_MERGE_TAG);
+	ShvVmxMergeBuffer = (PUCHAR)ExAllocatePoolWithTag(NonPagedPoolNx, PAGE_SIZE, SHV_MERGE_TAG);
+	ShvVmxMergeScratch = (PUCHAR)ExAllocatePoolWithTag(NonPagedPoolNx, PAGE_SIZE, SHV_MERGE_TAG);
+
+	if (ShvVmxMergePages == NULL ||
+		ShvVmxMergeBuckets == NULL ||
+		ShvVmxMergeCandidates == NULL ||
+		ShvVmxMergeBuffer == NULL ||
+		ShvVmxMergeScratch == NULL)
+	{
+		ShvVmxMergeCleanup();
+		return STATUS_HV_NO_RESOURCES;
+	}
+
+	__stosb((PUCHAR)ShvVmxMergePages, 0, SHV_MERGE_TABLE_SIZE * sizeof(SHV_MERGE_PAGE));
+	__stosb((PUCHAR)ShvVmxMergeBuckets, 0, SHV_MERGE_BUCKETS * sizeof(PSHV_MERGE_FRAME));
+	__stosb((PUCHAR)ShvVmxMergeCandidates, 0, SHV_MERGE_CANDIDATES * sizeof(SHV_MERGE_CANDIDATE));
+
+	//
+	// The scratch page gets pointed at other frames, so it can't be merged.
+	//
+	ShvVmxMergeScratchGpa = MmGetPhysicalAddress(ShvVmxMergeScratch).QuadPart;
+
+	page = ShvVmxMergeFindPage(ShvVmxMergeScratchGpa, TRUE);
+	NT_ASSERT(page != NULL);
+	page->State = ShvMergeOwned;
+
+	//
+	// Zero pages are by far the most common duplicates, so their frame is
+	// there from the start, and never freed.
+	//
+	ShvVmxMergeZeroFrame = ShvVmxMergeAllocateFrame();
+	if (ShvVmxMergeZeroFrame == NULL)
+	{
+		ShvVmxMergeCleanup();
+		return STATUS_HV_NO_RESOURCES;
+	}
+
+	__stosb((PUCHAR)ShvVmxMergeZeroFrame->Va, 0, PAGE_SIZE);
+	ShvVmxMergeStatistics.SharedFrames = 1;
+
+	ret = ShvVmxEptRegisterViolationHandler(ShvVmxMergeHandleViolation);
+	if (ret != STATUS_SUCCESS)
+	{
+		ShvVmxMergeCleanup();
+		return ret;
+	}
+
+	ShvVmxMergeEnabled = TRUE;
+
+	return STATUS_SUCCESS;
+}
+
+NTSTATUS
+ShvVmxMergeStart(
+	VOID
+)
+{
+	HANDLE thread;
+	NTSTATUS ret;
+
+	//
+	// Scan from a thread of our own, since reading pages and changing the
+	// EPT both need to run below DISPATCH_LEVEL.
+	//
+	if (ShvVmxMergeEnabled == FALSE)
+	{
+		return STATUS_SUCCESS;
+	}
+
+	ret = PsCreateSystemThread(&thread, THREAD_ALL_ACCESS, NULL, NULL, NULL, ShvVmxMergeThread, NULL);
+	if (ret != STATUS_SUCCESS)
+	{
+		return ret;
+	}
+
+	ret = ObReferenceObjectByHandle(thread,
+		SYNCHRONIZE,
+		*PsThreadType,
+		KernelMode,
+		(PVOID *)&ShvVmxMergeThreadObject,
+		NULL);
+
+	ZwClose(thread);
+
+	if (ret != STATUS_SUCCESS)
+	{
+		//
+		// The thread runs anyway, and a handle to a thread that exists can't
+		// fail to resolve, but without the object it could never be waited
+		// for.  Stop it right away.
+		//
+		KeSetEvent(&ShvVmxMergeStop, 0, FALSE);
+		ShvVmxMergeThreadObject = NULL;
+	}
+
+	return ret;
+}
+
+VOID
+ShvVmxMergeCleanup(
+	VOID
+)
+{
+	PSHV_MERGE_FRAME frame;
+	PSLIST_ENTRY entry;
+	PSHV_MERGE_PAGE page;
+	ULONG count;
+
+	//
+	// Stop the scanner, waiting for a scan in progress to finish.
+	//
+	if (ShvVmxMergeThreadObject != NULL)
+	{
+		KeSetEvent(&ShvVmxMergeStop, 0, FALSE);
+		KeWaitForSingleObject(ShvVmxMergeThreadObject, Executive, KernelMode, FALSE, NULL);
+		ObDereferenceObject(ShvVmxMergeThreadObject);
+		ShvVmxMergeThreadObject = NULL;
+	}
+
+	if (ShvVmxMergeEnabled)
+	{
+		//
+		// Give every merged page its own frame back while the VPs still
+		// run, since only they can take the write faults that may come in
+		// the meantime.  The frames of shared pages that were never lent
+		// still hold what they did when the pages were merged, so those
+		// are simply pointed back at them, a batch at a time.
+		//
+		ExAcquireFastMutex(&ShvVmxMergeLock);
+
+		count = 0;
+
+		for (ULONG i = 0; i < SHV_MERGE_TABLE_SIZE; i++)
+		{
+			page = &ShvVmxMergePages[i];
+
+			if (page->Key == 0)
+			{
+				continue;
+			}
+
+			if (page->State == ShvMergeShared &&
+				page->Lent == FALSE &&
+				InterlockedCompareExchange(&page->State, ShvMergeBusy, ShvMergeShared) == ShvMergeShared)
+			{
+				ShvVmxMergeBatch[count].Gpa = page->Key & ~(ULONG64)SHV_MERGE_KEY_USED;
+				ShvVmxMergeBatch[count].Page = page;
+
+				if (++count == SHV_MERGE_BATCH)
+				{
+					ShvVmxMergeUnshareBatch(count);
+					count = 0;
+				}
+
+				continue;
+			}
+
+			if (page->State == ShvMergeShared ||
+				page->State == ShvMergeUnsharing ||
+				page->State == ShvMergePrivate)
+			{
+				ShvVmxMergeRestorePage(page);
+			}
+		}
+
+		ShvVmxMergeUnshareBatch(count);
+
+		ExReleaseFastMutex(&ShvVmxMergeLock);
+
+		ShvVmxEptUnregisterViolationHandler(ShvVmxMergeHandleViolation);
+		ShvVmxMergeEnabled = FALSE;
+	}
+
+	//
+	// Free every frame no guest page maps anymore.  A frame that somehow
+	// still backs a page has to stay where it is.
+	//
+	if (ShvVmxMergeBuckets != NULL)
+	{
+		ShvVmxMergeFreeUnusedFrames();
+
+		for (ULONG i = 0; i < SHV_MERGE_BUCKETS; i++)
+		{
+			if (ShvVmxMergeBuckets[i] != NULL)
+			{
+				SHV_DEBUG_PRINT("Shared frames still in use, leaking them\n");
+			}
+		}
+
+		ExFreePoolWithTag(ShvVmxMergeBuckets, SHV_MERGE_TAG);
+		ShvVmxMergeBuckets = NULL;
+	}
+
+	if (ShvVmxMergeZeroFrame != NULL)
+	{
+		if (ShvVmxMergeZeroFrame->References == 0)
+		{
+			ShvVmxMergeFreeFrame(ShvVmxMergeZeroFrame);
+		}
+
+		ShvVmxMergeZeroFrame = NULL;
+	}
+
+	while ((entry = InterlockedPopEntrySList(&ShvVmxMergeReserve)) != NULL)
+	{
+		frame = CONTAINING_RECORD(entry, SHV_MERGE_FRAME, ReserveEntry);
+		ShvVmxMergeFreeFrame(frame);
+	}
+
+	if (ShvVmxMergePages != NULL)
+	{
+		ExFreePoolWithTag(ShvVmxMergePages, SHV_MERGE_TAG);
+		ShvVmxMergePages = NULL;
+	}
+
+	if (ShvVmxMergeCandidates != NULL)
+	{
+		ExFreePoolWithTag(ShvVmxMergeCandidates, SHV_MERGE_TAG);
+		ShvVmxMergeCandidates = NULL;
+	}
+
+	if (ShvVmxMergeBuffer != NULL)
+	{
+		ExFreePoolWithTag(ShvVmxMergeBuffer, SHV_MERGE_TAG);
+		ShvVmxMergeBuffer = NULL;
+	}
+
+	if (ShvVmxMergeScratch != NULL)
+	{
+		ExFreePoolWithTag(ShvVmxMergeScratch, SHV_MERGE_TAG);
+		ShvVmxMergeScratch = NULL;
+	}
+
+	ShvVmxMergePageCount = 0;
+	ShvVmxMergeRangeCount = 0;
+	ShvVmxMergeCursorRange = 0;
+	ShvVmxMergeCursor = 0;
+}
+
+NTSTATUS
+ShvVmxMergeAddRange(
+	_In_ ULONG64 Gpa,
+	_In_ ULONG64 Length
+)
+{
+	NTSTATUS ret;
+
+	//
+	// Only what was registered is merged.  Devices write to memory without
+	// going through the EPT, so a page a device may DMA into must never be
+	// merged, and only the caller knows which pages those are.
+	//
+	if (ShvVmxMergeEnabled == FALSE)
+	{
+		return STATUS_HV_NOT_PRESENT;
+	}
+
+	if ((Gpa & (PAGE_SIZE - 1)) != 0 || (Length & (PAGE_SIZE - 1)) != 0 || Length == 0)
+	{
+		return STATUS_INVALID_PARAMETER;
+	}
+
+	ExAcquireFastMutex(&ShvVmxMergeLock);
+
+	if (ShvVmxMergeRangeCount == SHV_MERGE_MAX_RANGES)
+	{
+		ret = STATUS_HV_NO_RESOURCES;
+	}
+	else
+	{
+		if (ShvVmxMergeRangeCount == 0)
+		{
+			ShvVmxMergeCursorRange = 0;
+			ShvVmxMergeCursor = Gpa;
+		}
+
+		ShvVmxMergeRanges[ShvVmxMergeRangeCount].Base = Gpa;
+		ShvVmxMergeRanges[ShvVmxMergeRangeCount].Size = Length;
+		ShvVmxMergeRangeCount++;
+		ret = STATUS_SUCCESS;
+	}
+
+	ExReleaseFastMutex(&ShvVmxMergeLock);
+
+	return ret;
+}
+
+VOID
+ShvVmxMergeQuery(
+	_Out_ PSHV_MERGE_STATISTICS Statistics
+)
+{
+	*Statistics = ShvVmxMergeStatistics;
+}
+
+NTSTATUS
+ShvVmxMergeQueryReclaimed(
+	_Out_writes_to_(Count, *Returned) PULONG64 Frames,
+	_In_ ULONG Count,
+	_Out_ PULONG Returned
+)
+{
+	PSHV_MERGE_PAGE page;
+	ULONG returned;
+
+	//
+	// List the host frames that merging left unused and that can be lent,
+	// which are those behind shared pages that aren't lent already.
+	//
+	*Returned = 0;
+
+	if (ShvVmxMergeEnabled == FALSE)
+	{
+		return STATUS_HV_NOT_PRESENT;
+	}
+
+	returned = 0;
+
+	ExAcquireFastMutex(&ShvVmxMergeLock);
+
+	for (ULONG i = 0; i < SHV_MERGE_TABLE_SIZE && returned < Count; i++)
+	{
+		page = &ShvVmxMergePages[i];
+
+		if (page->Key != 0 && page->State == ShvMergeShared && page->Lent == FALSE)
+		{
+			Frames[returned++] = page->Key & ~(ULONG64)SHV_MERGE_KEY_USED;
+		}
+	}
+
+	ExReleaseFastMutex(&ShvVmxMergeLock);
+
+	*Returned = returned;
+
+	return STATUS_SUCCESS;
+}
+
+NTSTATUS
+ShvVmxMergeAcquireFrame(
+	_Out_ PULONG64 Hpa
+)
+{
+	PSHV_MERGE_PAGE page;
+	NTSTATUS ret;
+
+	//
+	// Lend the caller the host frame behind a shared page.  The guest can't
+	// reach it anymore, since its GPA maps to the shared frame, so the
+	// caller has to map it somewhere of its own with ShvVmxEptRemapPages,
+	// or use it from root mode.  If the guest writes to the page before
+	// the frame is back, the page is copied into a reserve frame instead.
+	//
+	if (ShvVmxMergeEnabled == FALSE)
+	{
+		return STATUS_HV_NOT_PRESENT;
+	}
+
+	ret = STATUS_NO_MORE_ENTRIES;
+
+	ExAcquireFastMutex(&ShvVmxMergeLock);
+
+	for (ULONG i = 0; i < SHV_MERGE_TABLE_SIZE; i++)
+	{
+		page = &ShvVmxMergePages[i];
+
+		if (page->Key == 0 || page->Lent ||
+			InterlockedCompareExchange(&page->State, ShvMergeBusy, ShvMergeShared) != ShvMergeShared)
+		{
+			continue;
+		}
+
+		page->Lent = TRUE;
+		InterlockedExchange(&page->State, ShvMergeShared);
+
+		SHV_MERGE_COUNT(LentPages, 1);
+
+		*Hpa = page->Key & ~(ULONG64)SHV_MERGE_KEY_USED;
+		ret = STATUS_SUCCESS;
+		break;
+	}
+
+	//
+	// Have the reserve ready before the guest writes to the page.
+	//
+	if (ret == STATUS_SUCCESS)
+	{
+		ShvVmxMergeFillReserve();
+	}
+
+	ExReleaseFastMutex(&ShvVmxMergeLock);
+
+	return ret;
+}
+
+NTSTATUS
+ShvVmxMergeReleaseFrame(
+	_In_ ULONG64 Hpa
+)
+{
+	PSHV_MERGE_PAGE page;
+	NTSTATUS ret;
+
+	if (ShvVmxMergeEnabled == FALSE)
+	{
+		return STATUS_HV_NOT_PRESENT;
+	}
+
+	ExAcquireFastMutex(&ShvVmxMergeLock);
+
+	//
+	// The page goes back to its own frame with whatever it holds now.  It
+	// can be merged again on a later scan.
+	//
+	page = ShvVmxMergeFindPage(Hpa & ~(ULONG64)(PAGE_SIZE - 1), FALSE);
+
+	if (page == NULL || page->Lent == FALSE)
+	{
+		ret = STATUS_INVALID_PARAMETER;
+	}
+	else
+	{
+		ret = ShvVmxMergeRestorePage(page);
+	}
+
+	ExReleaseFastMutex(&ShvVmxMergeLock);
+
+	return ret;
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+static PSHV_MERGE_PAGE
+ShvVmxMergeFindPage(
+	ULONG64 gpa,
+	BOOLEAN insert
+)
+{
+	PSHV_MERGE_PAGE page;
+	ULONG64 key, current;
+	ULONG index;
+
+	//
+	// Open addressing with linear probing.  Root mode looks pages up
+	// without a lock, which works because only the holder of the lock
+	// inserts, slots are never freed, and a slot's key is only set once
+	// everything else in it is.
+	//
+	key = gpa | SHV_MERGE_KEY_USED;
+	index = (ULONG)(((gpa >> PAGE_SHIFT) * SHV_MERGE_SEED) >> (64 - SHV_MERGE_TABLE_BITS));
+
+	for (ULONG i = 0; i < SHV_MERGE_TABLE_SIZE; i++)
+	{
+		page = &ShvVmxMergePages[(index + i) & (SHV_MERGE_TABLE_SIZE - 1)];
+		current = page->Key;
+
+		if (current == key)
+		{
+			return page;
+		}
+
+		if (current != 0)
+		{
+			continue;
+		}
+
+		if (insert == FALSE || ShvVmxMergePageCount >= SHV_MERGE_MAX_PAGES)
+		{
+			return NULL;
+		}
+
+		page->State = ShvMergeIdle;
+		page->Lent = FALSE;
+		page->Frame = NULL;
+		page->Private = NULL;
+
+		InterlockedExchange64((volatile LONG64 *)&page->Key, key);
+		ShvVmxMergePageCount++;
+
+		return page;
+	}
+
+	return NULL;
+}
+
+static BOOLEAN
+ShvVmxMergeNextPage(
+	PULONG64 gpa
+)
+{
+	PSHV_EPT_REGION range;
+	ULONG64 end;
+
+	//
+	// Walk the registered ranges round robin, skipping whatever in them
+	// isn't RAM.  Give up after going all the way around once.
+	//
+	for (ULONG wrapped = 0; wrapped <= ShvVmxMergeRangeCount; )
+	{
+		range = &ShvVmxMergeRanges[ShvVmxMergeCursorRange];
+
+		if (ShvVmxMergeCursor < range->Base || ShvVmxMergeCursor >= range->Base + range->Size)
+		{
+			ShvVmxMergeCursorRange = (ShvVmxMergeCursorRange + 1) % ShvVmxMergeRangeCount;
+			ShvVmxMergeCursor = ShvVmxMergeRanges[ShvVmxMergeCursorRange].Base;
+			wrapped++;
+			continue;
+		}
+
+		if (ShvMemMapLookup(ShvVmxMergeCursor, &end) != ShvMemoryRam)
+		{
+			ShvVmxMergeCursor = end;
+			continue;
+		}
+
+		*gpa = ShvVmxMergeCursor;
+		ShvVmxMergeCursor += PAGE_SIZE;
+
+		return TRUE;
+	}
+
+	return FALSE;
+}
+
+static BOOLEAN
+ShvVmxMergeReadPage(
+	ULONG64 gpa
+)
+{
+	MM_COPY_ADDRESS address;
+	SIZE_T copied;
+
+	//
+	// This reads the page through the EPT like any other guest access, so
+	// a merged page reads back the shared frame.
+	//
+	address.PhysicalAddress.QuadPart = gpa;
+
+	if (MmCopyMemory(ShvVmxMergeBuffer, address, PAGE_SIZE, MM_COPY_MEMORY_PHYSICAL, &copied) != STATUS_SUCCESS)
+	{
+		return FALSE;
+	}
+
+	return (copied == PAGE_SIZE);
+}
+
+static ULONG64
+ShvVmxMergeFingerprint(
+	const VOID *page,
+	PBOOLEAN zero
+)
+{
+	const __m128i *data;
+	__m128i lanes[4], any, multiplier, value;
+	ULONG64 words[2], hash;
+
+	//
+	// Hash the page in four independent lanes of two words each, so that
+	// the multiplies of one lane overlap with those of the others.  Every
+	// step multiplies the low half of a word and adds the high half back
+	// in, so every bit of the page reaches the hash.  OR everything
+	// together on the way to spot zero pages without a second pass.  The
+	// fingerprint only picks candidates, which are compared byte for byte
+	// before they are merged.
+	//
+	data = (const __m128i *)page;
+	multiplier = _mm_set1_epi64x(SHV_MERGE_MULTIPLIER);
+	any = _mm_setzero_si128();
+
+	for (ULONG l = 0; l < 4; l++)
+	{
+		lanes[l] = _mm_set1_epi64x(SHV_MERGE_SEED + l);
+	}
+
+	for (ULONG i = 0; i < PAGE_SIZE / sizeof(__m128i); i += 4)
+	{
+		for (ULONG l = 0; l < 4; l++)
+		{
+			value = _mm_load_si128(&data[i + l]);
+			any = _mm_or_si128(any, value);
+
+			value = _mm_xor_si128(lanes[l], value);
+			lanes[l] = _mm_add_epi64(_mm_mul_epu32(value, multiplier), _mm_srli_epi64(value, 32));
+		}
+	}
+
+	*zero = (_mm_movemask_epi8(_mm_cmpeq_epi8(any, _mm_setzero_si128())) == 0xffff);
+
+	hash = SHV_MERGE_SEED;
+
+	for (ULONG l = 0; l < 4; l++)
+	{
+		_mm_storeu_si128((__m128i *)words, lanes[l]);
+
+		hash = (hash ^ words[0]) * SHV_MERGE_FOLD_PRIME;
+		hash = (hash ^ words[1]) * SHV_MERGE_FOLD_PRIME;
+	}
+
+	return hash;
+}
+
+static PSHV_MERGE_FRAME
+ShvVmxMergeAllocateFrame(
+	VOID
+)
+{
+	PSHV_MERGE_FRAME frame;
+	PSHV_MERGE_PAGE page;
+	ULONG64 hpa;
+
+	frame = (PSHV_MERGE_FRAME)ExAllocatePoolWithTag(NonPagedPoolNx, sizeof(SHV_MERGE_FRAME), SHV_MERGE_TAG);
+	if (frame == NULL)
+	{
+		return NULL;
+	}
+
+	//
+	// Whole pages of pool are page aligned.
+	//
+	frame->Va = ExAllocatePoolWithTag(NonPagedPoolNx, PAGE_SIZE, SHV_MERGE_TAG);
+	if (frame->Va == NULL)
+	{
+		ExFreePoolWithTag(frame, SHV_MERGE_TAG);
+		return NULL;
+	}
+
+	frame->Hpa = MmGetPhysicalAddress(frame->Va).QuadPart;
+	frame->Next = NULL;
+	frame->Fingerprint = 0;
+	frame->References = 0;
+
+	//
+	// Root mode writes to the frame through its VA, which only reaches the
+	// page the guest sees there if the GPA still maps to itself.  Claim the
+	// page before anything is written to it, so it is never merged.
+	//
+	page = ShvVmxMergeFindPage(frame->Hpa, TRUE);
+
+	if (page == NULL ||
+		ShvVmxEptGetAccess(frame->Hpa, &hpa) != VMX_EPT_ACCESS_RWX ||
+		hpa != frame->Hpa ||
+		InterlockedCompareExchange(&page->State, ShvMergeOwned, ShvMergeIdle) != ShvMergeIdle)
+	{
+		ExFreePoolWithTag(frame->Va, SHV_MERGE_TAG);
+		ExFreePoolWithTag(frame, SHV_MERGE_TAG);
+		return NULL;
+	}
+
+	return frame;
+}
+
+static VOID
+ShvVmxMergeFreeFrame(
+	PSHV_MERGE_FRAME frame
+)
+{
+	PSHV_MERGE_PAGE page;
+
+	page = ShvVmxMergeFindPage(frame->Hpa, FALSE);
+	if (page != NULL)
+	{
+		InterlockedExchange(&page->State, ShvMergeIdle);
+	}
+
+	ExFreePoolWithTag(frame->Va, SHV_MERGE_TAG);
+	ExFreePoolWithTag(frame, SHV_MERGE_TAG);
+}
+
+static PSHV_MERGE_FRAME
+ShvVmxMergeFindFrame(
+	ULONG64 fingerprint
+)
+{
+	PSHV_MERGE_FRAME frame;
+
+	for (frame = ShvVmxMergeBuckets[fingerprint & (SHV_MERGE_BUCKETS - 1)]; frame != NULL; frame = frame->Next)
+	{
+		if (frame->Fingerprint == fingerprint)
+		{
+			return frame;
+		}
+	}
+
+	return NULL;
+}
+
+static PSHV_MERGE_FRAME
+ShvVmxMergeCreateFrame(
+	ULONG64 fingerprint
+)
+{
+	PSHV_MERGE_FRAME frame, *bucket;
+
+	//
+	// The frame starts out as a copy of the page in the scan buffer.
+	//
+	frame = ShvVmxMergeAllocateFrame();
+	if (frame == NULL)
+	{
+		return NULL;
+	}
+
+	__movsq((PULONG64)frame->Va, (PULONG64)ShvVmxMergeBuffer, PAGE_SIZE / sizeof(ULONG64));
+	frame->Fingerprint = fingerprint;
+
+	bucket = &ShvVmxMergeBuckets[fingerprint & (SHV_MERGE_BUCKETS - 1)];
+	frame->Next = *bucket;
+	*bucket = frame;
+
+	SHV_MERGE_COUNT(SharedFrames, 1);
+
+	return frame;
+}
+
+static VOID
+ShvVmxMergeFreeUnusedFrames(
+	VOID
+)
+{
+	PSHV_MERGE_FRAME frame, *link;
+
+	//
+	// Only the scanner takes references, so a frame nothing references
+	// now won't be referenced again.  Root mode drops the last reference
+	// only after the page it backed maps somewhere else on every VP.
+	//
+	for (ULONG i = 0; i < SHV_MERGE_BUCKETS; i++)
+	{
+		link = &ShvVmxMergeBuckets[i];
+
+		while ((frame = *link) != NULL)
+		{
+			if (frame->References != 0)
+			{
+				link = &frame->Next;
+				continue;
+			}
+
+			*link = frame->Next;
+			ShvVmxMergeFreeFrame(frame);
+
+			SHV_MERGE_COUNT(SharedFrames, -1);
+		}
+	}
+}
+
+static VOID
+ShvVmxMergeFillReserve(
+	VOID
+)
+{
+	PSHV_MERGE_FRAME frame;
+
+	//
+	// Frames are only copied into when a lent page is written to.
+	//
+	if (ShvVmxMergeStatistics.LentPages == 0)
+	{
+		return;
+	}
+
+	while (QueryDepthSList(&ShvVmxMergeReserve) < SHV_MERGE_RESERVE_FRAMES)
+	{
+		frame = ShvVmxMergeAllocateFrame();
+		if (frame == NULL)
+		{
+			break;
+		}
+
+		InterlockedPushEntrySList(&ShvVmxMergeReserve, &frame->ReserveEntry);
+	}
+}
+
+static NTSTATUS
+ShvVmxMergeWriteFrame(
+	ULONG64 hpa,
+	const VOID *source
+)
+{
+	SHV_EPT_REMAP remap;
+	NTSTATUS ret;
+
+	//
+	// Outside of root mode, a host frame can only be written through a GPA
+	// that maps to it.  Point the scratch page at it for as long as it
+	// takes to copy the page.
+	//
+	remap.Gpa = ShvVmxMergeScratchGpa;
+	remap.Hpa = hpa;
+	remap.Access = VMX_EPT_ACCESS_READ | VMX_EPT_ACCESS_WRITE;
+
+	ret = ShvVmxEptRemapPages(&remap, 1);
+	if (ret != STATUS_SUCCESS)
+	{
+		return ret;
+	}
+
+	__movsq((PULONG64)ShvVmxMergeScratch, (const ULONG64 *)source, PAGE_SIZE / sizeof(ULONG64));
+
+	remap.Hpa = ShvVmxMergeScratchGpa;
+	remap.Access = VMX_EPT_ACCESS_RWX;
+
+	return ShvVmxEptRemapPages(&remap, 1);
+}
+
+static VOID
+ShvVmxMergeScan(
+	VOID
+)
+{
+	PSHV_MERGE_CANDIDATE candidate;
+	PSHV_MERGE_FRAME frame;
+	PSHV_MERGE_PAGE page;
+	ULONG64 gpa, hpa, fingerprint, start;
+	BOOLEAN zero;
+	ULONG count;
+
+	count = 0;
+	start = MAXULONG64;
+
+	for (ULONG i = 0; i < SHV_MERGE_SCAN_PAGES && ShvVmxMergeNextPage(&gpa); i++)
+	{
+		//
+		// Ranges smaller than a scan would otherwise be gone through again
+		// and again.  Stop where the scan started, and start the next one
+		// there.
+		//
+		if (gpa == start)
+		{
+			ShvVmxMergeCursor = gpa;
+			break;
+		}
+
+		if (start == MAXULONG64)
+		{
+			start = gpa;
+		}
+
+		//
+		// Only look at pages that map to themselves with full access.  That
+		// leaves out merged pages, the frames used for merging, and
+		// anything someone else protected or remapped.
+		//
+		page = ShvVmxMergeFindPage(gpa, FALSE);
+		if (page != NULL && page->State != ShvMergeIdle)
+		{
+			continue;
+		}
+
+		if (ShvVmxEptGetAccess(gpa, &hpa) != VMX_EPT_ACCESS_RWX || hpa != gpa)
+		{
+			continue;
+		}
+
+		if (ShvVmxMergeReadPage(gpa) == FALSE)
+		{
+			continue;
+		}
+
+		SHV_MERGE_COUNT(PagesScanned, 1);
+
+		fingerprint = ShvVmxMergeFingerprint(ShvVmxMergeBuffer, &zero);
+
+		if (zero)
+		{
+			frame = ShvVmxMergeZeroFrame;
+		}
+		else
+		{
+			frame = ShvVmxMergeFindFrame(fingerprint);
+		}
+
+		if (frame == NULL)
+		{
+			//
+			// Nothing shares the contents yet.  Remember the page, and when
+			// another one turns up with the same fingerprint, give both of
+			// them a shared frame of their own.
+			//
+			candidate = &ShvVmxMergeCandidates[fingerprint & (SHV_MERGE_CANDIDATES - 1)];
+
+			if (candidate->Fingerprint != fingerprint || candidate->Gpa == gpa)
+			{
+				candidate->Fingerprint = fingerprint;
+				candidate->Gpa = gpa;
+				continue;
+			}
+
+			frame = ShvVmxMergeCreateFrame(fingerprint);
+			if (frame == NULL)
+			{
+				continue;
+			}
+
+			ShvVmxMergeBatch[count].Gpa = candidate->Gpa;
+			ShvVmxMergeBatch[count].Frame = frame;
+			count++;
+
+			candidate->Fingerprint = 0;
+			candidate->Gpa = 0;
+		}
+
+		ShvVmxMergeBatch[count].Gpa = gpa;
+		ShvVmxMergeBatch[count].Frame = frame;
+		count++;
+
+		if (count >= SHV_MERGE_BATCH - 1)
+		{
+			ShvVmxMergeCommitBatch(count);
+			count = 0;
+		}
+	}
+
+	if (count != 0)
+	{
+		ShvVmxMergeCommitBatch(count);
+	}
+
+	//
+	// Frames whose pages were all written to since, or that never got to
+	// back more than the one page they were made from, aren't saving
+	// anything.
+	//
+	ShvVmxMergeFreeUnusedFrames();
+
+	SHV_MERGE_COUNT(Scans, 1);
+}
+
+static VOID
+ShvVmxMergeCommitBatch(
+	ULONG count
+)
+{
+	PSHV_MERGE_BATCH_ENTRY entry;
+	ULONG64 hpa;
+	ULONG protect, remap, matches;
+	NTSTATUS ret;
+
+	//
+	// Write-protect every page of the batch first, so that their contents
+	// can't change while they are compared.  A write in the meantime takes
+	// the page out of the batch.
+	//
+	protect = 0;
+
+	for (ULONG i = 0; i < count; i++)
+	{
+		entry = &ShvVmxMergeBatch[i];
+		entry->Page = NULL;
+
+		if (ShvVmxEptGetAccess(entry->Gpa, &hpa) != VMX_EPT_ACCESS_RWX || hpa != entry->Gpa)
+		{
+			continue;
+		}
+
+		entry->Page = ShvVmxMergeFindPage(entry->Gpa, TRUE);
+
+		if (entry->Page == NULL ||
+			InterlockedCompareExchange(&entry->Page->State, ShvMergeMerging, ShvMergeIdle) != ShvMergeIdle)
+		{
+			entry->Page = NULL;
+			continue;
+		}
+
+		ShvVmxMergeProtections[protect].Gpa = entry->Gpa;
+		ShvVmxMergeProtections[protect].Length = PAGE_SIZE;
+		ShvVmxMergeProtections[protect].Access = VMX_EPT_ACCESS_READ | VMX_EPT_ACCESS_EXECUTE;
+		protect++;
+	}
+
+	if (protect == 0)
+	{
+		return;
+	}
+
+	ret = ShvVmxEptProtectRanges(ShvVmxMergeProtections, protect);
+
+	//
+	// Now that nothing can change them, compare the pages with their frames
+	// byte for byte.  The ones that match are claimed, and the others are
+	// given their write access back, unless a write already did.
+	//
+	protect = 0;
+	remap = 0;
+
+	for (ULONG i = 0; i < count; i++)
+	{
+		entry = &ShvVmxMergeBatch[i];
+
+		if (entry->Page == NULL)
+		{
+			continue;
+		}
+
+		if (ret == STATUS_SUCCESS && ShvVmxMergeReadPage(entry->Gpa))
+		{
+			if (RtlCompareMemory(ShvVmxMergeBuffer, entry->Frame->Va, PAGE_SIZE) == PAGE_SIZE)
+			{
+				if (InterlockedCompareExchange(&entry->Page->State, ShvMergeBusy, ShvMergeMerging) == ShvMergeMerging)
+				{
+					continue;
+				}
+			}
+			else
+			{
+				SHV_MERGE_COUNT(Mismatches, 1);
+			}
+		}
+
+		if (InterlockedCompareExchange(&entry->Page->State, ShvMergeIdle, ShvMergeMerging) == ShvMergeMerging)
+		{
+			ShvVmxMergeProtections[protect].Gpa = entry->Gpa;
+			ShvVmxMergeProtections[protect].Length = PAGE_SIZE;
+			ShvVmxMergeProtections[protect].Access = VMX_EPT_ACCESS_RWX;
+			protect++;
+		}
+
+		entry->Page = NULL;
+	}
+
+	//
+	// A frame made during this scan has nothing referencing it yet.  If
+	// only one of the pages it was made for still matches, sharing it
+	// saves nothing, so that page keeps its own frame, and the new one is
+	// freed at the end of the scan.
+	//
+	for (ULONG i = 0; i < count; i++)
+	{
+		entry = &ShvVmxMergeBatch[i];
+
+		if (entry->Page == NULL ||
+			entry->Frame == ShvVmxMergeZeroFrame ||
+			entry->Frame->References != 0)
+		{
+			continue;
+		}
+
+		matches = 0;
+
+		for (ULONG j = 0; j < count; j++)
+		{
+			if (ShvVmxMergeBatch[j].Page != NULL && ShvVmxMergeBatch[j].Frame == entry->Frame)
+			{
+				matches++;
+			}
+		}
+
+		if (matches > 1)
+		{
+			continue;
+		}
+
+		InterlockedExchange(&entry->Page->State, ShvMergeIdle);
+
+		ShvVmxMergeProtections[protect].Gpa = entry->Gpa;
+		ShvVmxMergeProtections[protect].Length = PAGE_SIZE;
+		ShvVmxMergeProtections[protect].Access = VMX_EPT_ACCESS_RWX;
+		protect++;
+
+		entry->Page = NULL;
+	}
+
+	if (protect != 0)
+	{
+		ShvVmxEptProtectRanges(ShvVmxMergeProtections, protect);
+	}
+
+	for (ULONG i = 0; i < count; i++)
+	{
+		entry = &ShvVmxMergeBatch[i];
+
+		if (entry->Page != NULL)
+		{
+			ShvVmxMergeRemaps[remap].Gpa = entry->Gpa;
+			ShvVmxMergeRemaps[remap].Hpa = entry->Frame->Hpa;
+			ShvVmxMergeRemaps[remap].Access = VMX_EPT_ACCESS_READ | VMX_EPT_ACCESS_EXECUTE;
+			remap++;
+		}
+	}
+
+	if (remap == 0)
+	{
+		return;
+	}
+
+	//
+	// Point the pages that matched at their frames.  Each already has a
+	// 4 KiB leaf of its own from being protected, so this can't run out of
+	// tables.  Should it fail anyway, put them all back.
+	//
+	ret = ShvVmxEptRemapPages(ShvVmxMergeRemaps, remap);
+
+	if (ret != STATUS_SUCCESS)
+	{
+		for (ULONG i = 0; i < remap; i++)
+		{
+			ShvVmxMergeRemaps[i].Hpa = ShvVmxMergeRemaps[i].Gpa;
+			ShvVmxMergeRemaps[i].Access = VMX_EPT_ACCESS_RWX;
+		}
+
+		ShvVmxEptRemapPages(ShvVmxMergeRemaps, remap);
+	}
+
+	for (ULONG i = 0; i < count; i++)
+	{
+		entry = &ShvVmxMergeBatch[i];
+
+		if (entry->Page == NULL)
+		{
+			continue;
+		}
+
+		if (ret == STATUS_SUCCESS)
+		{
+			entry->Page->Frame = entry->Frame;
+			InterlockedIncrement(&entry->Frame->References);
+
+			SHV_MERGE_COUNT(Merges, 1);
+			SHV_MERGE_COUNT(SharedPages, 1);
+
+			if (entry->Frame == ShvVmxMergeZeroFrame)
+			{
+				SHV_MERGE_COUNT(ZeroPages, 1);
+			}
+
+			InterlockedExchange(&entry->Page->State, ShvMergeShared);
+		}
+		else
+		{
+			InterlockedExchange(&entry->Page->State, ShvMergeIdle);
+		}
+	}
+}
+
+static VOID
+ShvVmxMergeUnshareBatch(
+	ULONG count
+)
+{
+	PSHV_MERGE_BATCH_ENTRY entry;
+	PSHV_MERGE_FRAME frame;
+
+	//
+	// Point shared pages that were never lent back at their own frames,
+	// which still hold what the pages did when they were merged.  The
+	// caller already made them busy.
+	//
+	if (count == 0)
+	{
+		return;
+	}
+
+	for (ULONG i = 0; i < count; i++)
+	{
+		ShvVmxMergeRemaps[i].Gpa = ShvVmxMergeBatch[i].Gpa;
+		ShvVmxMergeRemaps[i].Hpa = ShvVmxMergeBatch[i].Gpa;
+		ShvVmxMergeRemaps[i].Access = VMX_EPT_ACCESS_RWX;
+	}
+
+	if (ShvVmxEptRemapPages(ShvVmxMergeRemaps, count) != STATUS_SUCCESS)
+	{
+		SHV_DEBUG_PRINT("Merged pages could not be unshared\n");
+
+		for (ULONG i = 0; i < count; i++)
+		{
+			InterlockedExchange(&ShvVmxMergeBatch[i].Page->State, ShvMergeShared);
+		}
+
+		return;
+	}
+
+	for (ULONG i = 0; i < count; i++)
+	{
+		entry = &ShvVmxMergeBatch[i];
+		frame = entry->Page->Frame;
+
+		entry->Page->Frame = NULL;
+		InterlockedDecrement(&frame->References);
+
+		SHV_MERGE_COUNT(SharedPages, -1);
+
+		if (frame == ShvVmxMergeZeroFrame)
+		{
+			SHV_MERGE_COUNT(ZeroPages, -1);
+		}
+
+		InterlockedExchange(&entry->Page->State, ShvMergeIdle);
+	}
+}
+
+static NTSTATUS
+ShvVmxMergeRestorePage(
+	PSHV_MERGE_PAGE page
+)
+{
+	PSHV_MERGE_FRAME frame;
+	SHV_EPT_REMAP remap;
+	NTSTATUS ret;
+	ULONG64 gpa;
+	LONG state;
+
+	//
+	// Take the page from root mode first.  A write being copied right now
+	// finishes before that.
+	//
+	for (;;)
+	{
+		state = page->State;
+
+		if (state == ShvMergeBusy)
+		{
+			YieldProcessor();
+			continue;
+		}
+
+		if (state != ShvMergeShared &&
+			state != ShvMergeUnsharing &&
+			state != ShvMergePrivate)
+		{
+			return STATUS_SUCCESS;
+		}
+
+		if (InterlockedCompareExchange(&page->State, ShvMergeBusy, state) == state)
+		{
+			break;
+		}
+	}
+
+	gpa = page->Key & ~(ULONG64)SHV_MERGE_KEY_USED;
+
+	//
+	// A write already started giving the page a frame of its own.  Wait for
+	// the shootdown it was waiting for here instead, after which the page
+	// is Private, or Idle and mapped read-only at its own frame.
+	//
+	if (state == ShvMergeUnsharing)
+	{
+		ShvVmxEptShootdown();
+
+		state = ShvVmxMergeFinishUnshare(page);
+		if (state == ShvMergeIdle)
+		{
+			remap.Gpa = gpa;
+			remap.Hpa = gpa;
+			remap.Access = VMX_EPT_ACCESS_RWX;
+
+			ret = ShvVmxEptRemapPages(&remap, 1);
+
+			InterlockedExchange(&page->State, ShvMergeIdle);
+			return ret;
+		}
+	}
+	frame = (state == ShvMergePrivate) ? page->Private : page->Frame;
+
+	remap.Gpa = gpa;
+	remap.Hpa = frame->Hpa;
+	remap.Access = VMX_EPT_ACCESS_READ | VMX_EPT_ACCESS_EXECUTE;
+
+	//
+	// A private copy is written to freely, so stop that before copying it.
+	// Shared frames are never written to.
+	//
+	ret = STATUS_SUCCESS;
+
+	if (state == ShvMergePrivate)
+	{
+		ret = ShvVmxEptRemapPages(&remap, 1);
+	}
+
+	//
+	// A frame that was lent holds whatever the caller left in it.
+	//
+	if (ret == STATUS_SUCCESS && page->Lent)
+	{
+		ret = ShvVmxMergeWriteFrame(gpa, frame->Va);
+	}
+
+	if (ret == STATUS_SUCCESS)
+	{
+		remap.Hpa = gpa;
+		remap.Access = VMX_EPT_ACCESS_RWX;
+
+		ret = ShvVmxEptRemapPages(&remap, 1);
+	}
+
+	if (ret != STATUS_SUCCESS)
+	{
+		if (state == ShvMergePrivate)
+		{
+			remap.Hpa = frame->Hpa;
+			remap.Access = VMX_EPT_ACCESS_RWX;
+
+			ShvVmxEptRemapPages(&remap, 1);
+		}
+
+		InterlockedExchange(&page->State, state);
+		return ret;
+	}
+
+	if (state == ShvMergePrivate)
+	{
+		page->Private = NULL;
+		InterlockedPushEntrySList(&ShvVmxMergeReserve, &frame->ReserveEntry);
+
+		SHV_MERGE_COUNT(PrivatePages, -1);
+	}
+	else
+	{
+		page->Frame = NULL;
+		InterlockedDecrement(&frame->References);
+
+		SHV_MERGE_COUNT(SharedPages, -1);
+
+		if (frame == ShvVmxMergeZeroFrame)
+		{
+			SHV_MERGE_COUNT(ZeroPages, -1);
+		}
+	}
+
+	if (page->Lent)
+	{
+		page->Lent = FALSE;
+		SHV_MERGE_COUNT(LentPages, -1);
+	}
+
+	InterlockedExchange(&page->State, ShvMergeIdle);
+
+	return STATUS_SUCCESS;
+}
+
+static LONG
+ShvVmxMergeFinishUnshare(
+	PSHV_MERGE_PAGE page
+)
+{
+	PSHV_MERGE_FRAME frame;
+
+	//
+	// The page is busy, and no VP can read it from the shared frame
+	// anymore.  Let go of that frame, and return the state the page moves
+	// to, which the caller sets once the page is mapped the way it wants.
+	//
+	frame = page->Frame;
+
+	page->Frame = NULL;
+	InterlockedDecrement(&frame->References);
+
+	SHV_MERGE_COUNT(CopyOnWrites, 1);
+	SHV_MERGE_COUNT(SharedPages, -1);
+
+	if (frame == ShvVmxMergeZeroFrame)
+	{
+		SHV_MERGE_COUNT(ZeroPages, -1);
+	}
+
+	if (page->Private == NULL)
+	{
+		return ShvMergeIdle;
+	}
+
+	SHV_MERGE_COUNT(PrivatePages, 1);
+
+	return ShvMergePrivate;
+}
+
+BOOLEAN
+ShvVmxMergeHandleViolation(
+	_In_ PSHV_VP_STATE VpState,
+	_In_ ULONG64 Gpa,
+	_In_ ULONG Access
+)
+{
+	PSHV_MERGE_FRAME frame, private;
+	PSHV_MERGE_PAGE page;
+	PSLIST_ENTRY entry;
+	ULONG64 target;
+
+	UNREFERENCED_PARAMETER(VpState);
+
+	//
+	// Merged pages can be read and executed, so only writes fault.
+	//
+	if ((Access & VMX_EPT_ACCESS_WRITE) == 0)
+	{
+		return FALSE;
+	}
+
+	Gpa &= ~(ULONG64)(PAGE_SIZE - 1);
+
+	page = ShvVmxMergeFindPage(Gpa, FALSE);
+	if (page == NULL)
+	{
+		return FALSE;
+	}
+
+	switch (page->State)
+	{
+	case ShvMergeMerging:
+		//
+		// The page is write-protected while the scanner compares it.  Take
+		// it out of the batch rather than stall the guest.  Adding the
+		// write access back only needs this VP to flush, which it does when
+		// it faults on its stale copy.
+		//
+		if (InterlockedCompareExchange(&page->State, ShvMergeIdle, ShvMergeMerging) == ShvMergeMerging)
+		{
+			ShvVmxEptReplaceLeaf(Gpa, Gpa, VMX_EPT_ACCESS_RWX);
+		}
+
+		return TRUE;
+	case ShvMergeBusy:
+		//
+		// The page is being changed by someone else.  Let the guest retry.
+		//
+		return TRUE;
+	case ShvMergeUnsharing:
+		//
+		// The page already has its new frame, read-only.  Once every VP
+		// has flushed the shared one, nothing can miss the write, so make
+		// it writable.  That only adds access, which the fault already
+		// flushed from this VP.  Until then, let the guest retry.
+		//
+		if (InterlockedCompareExchange(&page->State, ShvMergeBusy, ShvMergeUnsharing) != ShvMergeUnsharing)
+		{
+			return TRUE;
+		}
+
+		target = (page->Private != NULL) ? page->Private->Hpa : Gpa;
+
+		if (ShvVmxEptShootdownComplete(page->Generation) == FALSE ||
+			ShvVmxEptReplaceLeaf(Gpa, target, VMX_EPT_ACCESS_RWX) == FALSE)
+		{
+			InterlockedExchange(&page->State, ShvMergeUnsharing);
+			return TRUE;
+		}
+
+		InterlockedExchange(&page->State, ShvVmxMergeFinishUnshare(page));
+		return TRUE;
+	case ShvMergeShared:
+		break;
+	default:
+		return FALSE;
+	}
+
+	if (InterlockedCompareExchange(&page->State, ShvMergeBusy, ShvMergeShared) != ShvMergeShared)
+	{
+		return TRUE;
+	}
+
+	//
+	// The page's own frame still holds what it did when it was merged,
+	// which is what the shared frame holds, so the page can just go back
+	// to it.  If the frame was lent, copy the page into a reserve frame
+	// instead.  With none at hand, the guest retries until the scanner
+	// tops up the reserve.
+	//
+	frame = page->Frame;
+	private = NULL;
+	target = Gpa;
+
+	if (page->Lent)
+	{
+		entry = InterlockedPopEntrySList(&ShvVmxMergeReserve);
+		if (entry == NULL)
+		{
+			SHV_MERGE_COUNT(Starved, 1);
+			InterlockedExchange(&page->State, ShvMergeShared);
+			return TRUE;
+		}
+
+		private = CONTAINING_RECORD(entry, SHV_MERGE_FRAME, ReserveEntry);
+		__movsq((PULONG64)private->Va, (PULONG64)frame->Va, PAGE_SIZE / sizeof(ULONG64));
+		target = private->Hpa;
+	}
+
+	//
+	// The leaf was made for the page when it was merged, and nothing else
+	// changes it while the page is busy.  Other VPs may still read the
+	// page from the shared frame, which would miss a write, so it stays
+	// read-only until they have all flushed.  Root mode doesn't wait for
+	// that, the write that comes back once they have finishes the job.
+	//
+	if (ShvVmxEptReplaceLeaf(Gpa, target, VMX_EPT_ACCESS_READ | VMX_EPT_ACCESS_EXECUTE) == FALSE)
+	{
+		if (private != NULL)
+		{
+			InterlockedPushEntrySList(&ShvVmxMergeReserve, &private->ReserveEntry);
+		}
+
+		InterlockedExchange(&page->State, ShvMergeShared);
+		return TRUE;
+	}
+
+	page->Private = private;
+	page->Generation = ShvVmxEptRequestShootdown(&ShvGlobalData->VpData[KeGetCurrentProcessorNumberEx(NULL)]);
+
+	InterlockedExchange(&page->State, ShvMergeUnsharing);
+
+	return TRUE;
+}
+
+VOID
+ShvVmxMergeThread(
+	_In_ PVOID StartContext
+)
+{
+	LARGE_INTEGER timeout;
+	ULONG elapsed;
+
+	UNREFERENCED_PARAMETER(StartContext);
+
+	timeout.QuadPart = -10000LL * SHV_MERGE_TICK;
+	elapsed = 0;
+
+	while (KeWaitForSingleObject(&ShvVmxMergeStop, Executive, KernelMode, FALSE, &timeout) == STATUS_TIMEOUT)
+	{
+		ExAcquireFastMutex(&ShvVmxMergeLock);
+
+		ShvVmxMergeFillReserve();
+
+		elapsed += SHV_MERGE_TICK;
+
+		if (elapsed >= SHV_MERGE_SCAN_PERIOD && ShvVmxMergeRangeCount != 0)
+		{
+			ShvVmxMergeScan();
+			elapsed = 0;
+		}
+
+		ExReleaseFastMutex(&ShvVmxMergeLock);
+	}
+
+	PsTerminateSystemThread(STATUS_SUCCESS);
+}
@@ -0,0 +1,952 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvvmxnuma.c
+
+Abstract:
+
+	This module implements the NUMA sampler.  Every round, it takes all
+	access to a sample of RAM pages away in the default view.  The first
+	touch of a sampled page exits once, records the node of the VP that
+	touched it, and gives the page its access back in the same exit.  When
+	the round ends, the touches are added up per page, against the node the
+	page belongs to.  Half of every sample is drawn from the pages already
+	seen touched remotely, so their counters keep growing, and the other
+	half at random from the RAM ranges the EPT identity map is built from.
+
+Author:
+
+	agent (@agent) 15-Oct-2026 - Initial version
+
+Environment:
+
+	Kernel mode only.
+
+--*/
+
+#include "shv.h"
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// Set to TRUE to support the NUMA sampler.  This costs a violation handler
+// and the page table, and nothing else until sampling starts.
+//
+#define SHV_NUMA_ENABLE FALSE
+
+#define SHV_NUMA_TAG 'MUNS'
+
+//
+// The number of pages the page table can track.  It is kept at most half
+// full, so that probes stay short.
+//
+#define SHV_NUMA_TABLE_BITS (14)
+#define SHV_NUMA_TABLE_SIZE (1UL << SHV_NUMA_TABLE_BITS)
+#define SHV_NUMA_MAX_PAGES (SHV_NUMA_TABLE_SIZE / 2)
+
+//
+// The shortest round, in milliseconds, and how many times a page has to
+// have been touched remotely before it is reported.
+//
+#define SHV_NUMA_MIN_PERIOD (10)
+#define SHV_NUMA_MIN_REMOTE (2)
+
+//
+// Marks a slot of the page table as used, and a sampled page that nobody
+// touched yet.
+//
+#define SHV_NUMA_KEY_USED (1)
+#define SHV_NUMA_UNTOUCHED (-1)
+
+#define SHV_NUMA_SEED (0x9E3779B97F4A7C15ULL)
+
+// ===========================================================================
+//
+// LOCAL TYPES
+//
+// ===========================================================================
+
+//
+// A page of the current round, and the node that touched it first.
+//
+typedef struct _SHV_NUMA_SAMPLE
+{
+	ULONG64 Gpa;
+	volatile LONG Node;
+} SHV_NUMA_SAMPLE, *PSHV_NUMA_SAMPLE;
+
+//
+// The pages of a round, sorted by GPA, and the bitmap of the ones that were
+// armed, which are the only ones whose violations it claims.  Root mode
+// reads it without a lock, so a round is only reused once no LP can be
+// looking at it.
+//
+typedef struct _SHV_NUMA_ROUND
+{
+	ULONG Count;
+	volatile ULONG64 *Armed;
+	SHV_NUMA_SAMPLE Samples[ANYSIZE_ARRAY];
+} SHV_NUMA_ROUND, *PSHV_NUMA_ROUND;
+
+//
+// A tracked page, and how many rounds each node touched it first in.  Only
+// the sampler thread and reports, under the lock, look at it.
+//
+typedef struct _SHV_NUMA_PAGE
+{
+	ULONG64 Key;
+	ULONG Node;
+	ULONG Local;
+	ULONG Remote;
+	ULONG Touches[SHV_NUMA_MAX_NODES];
+} SHV_NUMA_PAGE, *PSHV_NUMA_PAGE;
+
+// ===========================================================================
+//
+// LOCAL DATA
+//
+// ===========================================================================
+
+static BOOLEAN ShvVmxNumaRequested = SHV_NUMA_ENABLE;
+static BOOLEAN ShvVmxNumaEnabled = FALSE;
+
+//
+// Serializes rounds, the node map, the page table and reports.
+//
+static FAST_MUTEX ShvVmxNumaLock = { 0 };
+
+static KEVENT ShvVmxNumaStopEvent = { 0 };
+static PKTHREAD ShvVmxNumaThreadObject = NULL;
+
+//
+// The node map, sorted by address.
+//
+static SHV_NUMA_RANGE ShvVmxNumaRanges[SHV_NUMA_MAX_RANGES] = { 0 };
+static ULONG ShvVmxNumaRangeCount = 0;
+
+//
+// The round root mode claims violations for, or NULL between rounds, the
+// buffer it is built in, and the regions it is armed and disarmed with.
+//
+static PSHV_NUMA_ROUND volatile ShvVmxNumaRound = NULL;
+static PSHV_NUMA_ROUND ShvVmxNumaRoundBuffer = NULL;
+static PSHV_EPT_REGION ShvVmxNumaRegions = NULL;
+static ULONG ShvVmxNumaPagesPerRound = 0;
+static ULONG ShvVmxNumaPeriod = 0;
+static ULONG ShvVmxNumaRandomSeed = 0;
+
+static PSHV_NUMA_PAGE ShvVmxNumaPages = NULL;
+static ULONG ShvVmxNumaPageCount = 0;
+static ULONG ShvVmxNumaCursor = 0;
+
+static SHV_NUMA_STATISTICS ShvVmxNumaStatistics = { 0 };
+
+// ===========================================================================
+//
+// LOCAL PROTOTYPES
+//
+// ===========================================================================
+
+static BOOLEAN
+ShvVmxNumaEndRound(
+	VOID
+);
+
+static VOID
+ShvVmxNumaBeginRound(
+	VOID
+);
+
+static BOOLEAN
+ShvVmxNumaPickPage(
+	ULONG64 ramPages,
+	PULONG64 gpa
+);
+
+static ULONG
+ShvVmxNumaGetHomeNode(
+	ULONG64 gpa
+);
+
+static PSHV_NUMA_PAGE
+ShvVmxNumaFindPage(
+	ULONG64 gpa,
+	BOOLEAN insert
+);
+
+SHV_EPT_VIOLATION_HANDLER ShvVmxNumaHandleViolation;
+KSTART_ROUTINE ShvVmxNumaThread;
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+NTSTATUS
+ShvVmxNumaInitialize(
+	VOID
+)
+{
+	NTSTATUS ret;
+
+	if (ShvVmxNumaRequested == FALSE)
+	{
+		return STATUS_SUCCESS;
+	}
+
+	ExInitializeFastMutex(&ShvVmxNumaLock);
+	KeInitializeEvent(&ShvVmxNumaStopEvent, NotificationEvent, FALSE);
+
+	ShvVmxNumaPages = (PSHV_NUMA_PAGE)ExAllocatePoolWithTag(NonPagedPoolNx,
+		SHV_NUMA_TABLE_SIZE * sizeof(SHV_NUMA_PAGE),
+		SHV_NUMA_TAG);
+	if (ShvVmxNumaPages == NULL)
+	{
+		return STATUS_HV_NO_RESOURCES;
+	}
+
+	__stosb((PUCHAR)ShvVmxNumaPages, 0, SHV_NUMA_TABLE_SIZE * sizeof(SHV_NUMA_PAGE));
+
+	ret = ShvVmxEptRegisterViolationHandler(ShvVmxNumaHandleViolation);
+	if (ret != STATUS_SUCCESS)
+	{
+		ExFreePoolWithTag(ShvVmxNumaPages, SHV_NUMA_TAG);
+		ShvVmxNumaPages = NULL;
+		return ret;
+	}
+
+	ShvVmxNumaEnabled = TRUE;
+
+	return STATUS_SUCCESS;
+}
+
+VOID
+ShvVmxNumaCleanup(
+	VOID
+)
+{
+	if (ShvVmxNumaEnabled == FALSE)
+	{
+		return;
+	}
+
+	//
+	// Stopping ends the last round, which gives every page its access
+	// back.
+	//
+	ShvVmxNumaStop();
+
+	ShvVmxEptUnregisterViolationHandler(ShvVmxNumaHandleViolation);
+	ShvVmxNumaEnabled = FALSE;
+
+	ExFreePoolWithTag(ShvVmxNumaPages, SHV_NUMA_TAG);
+	ShvVmxNumaPages = NULL;
+	ShvVmxNumaPageCount = 0;
+}
+
+NTSTATUS
+ShvVmxNumaSetNodeRanges(
+	_In_reads_(Count) const SHV_NUMA_RANGE *Ranges,
+	_In_ ULONG Count
+)
+{
+	if (ShvVmxNumaEnabled == FALSE)
+	{
+		return STATUS_HV_NOT_PRESENT;
+	}
+
+	//
+	// Windows doesn't tell drivers which node physical memory belongs to,
+	// so the caller has to, such as from the memory affinity entries of the
+	// SRAT.  The ranges have to be sorted and not overlap.
+	//
+	if (Count > SHV_NUMA_MAX_RANGES)
+	{
+		return STATUS_INVALID_PARAMETER;
+	}
+
+	for (ULONG i = 0; i < Count; i++)
+	{
+		if (Ranges[i].End <= Ranges[i].Base ||
+			(i != 0 && Ranges[i].Base < Ranges[i - 1].End))
+		{
+			return STATUS_INVALID_PARAMETER;
+		}
+	}
+
+	ExAcquireFastMutex(&ShvVmxNumaLock);
+
+	for (ULONG i = 0; i < Count; i++)
+	{
+		ShvVmxNumaRanges[i] = Ranges[i];
+	}
+
+	ShvVmxNumaRangeCount = Count;
+
+	ExReleaseFastMutex(&ShvVmxNumaLock);
+
+	return STATUS_SUCCESS;
+}
+
+NTSTATUS
+ShvVmxNumaStart(
+	_In_ ULONG PagesPerRound,
+	_In_ ULONG Period
+)
+{
+	HANDLE thread;
+	NTSTATUS ret;
+
+	if (ShvVmxNumaEnabled == FALSE)
+	{
+		return STATUS_HV_NOT_PRESENT;
+	}
+
+	//
+	// Every sampled page exits at most once per round, so the rate of
+	// rounds and their size bound what sampling costs.
+	//
+	if (PagesPerRound == 0 ||
+		PagesPerRound > SHV_NUMA_MAX_ROUND_PAGES ||
+		Period < SHV_NUMA_MIN_PERIOD ||
+		(ULONG64)PagesPerRound * 1000 / Period > SHV_NUMA_MAX_EXIT_RATE)
+	{
+		return STATUS_INVALID_PARAMETER;
+	}
+
+	if (ShvVmxNumaThreadObject != NULL)
+	{
+		return STATUS_DEVICE_BUSY;
+	}
+
+	ShvVmxNumaRoundBuffer = (PSHV_NUMA_ROUND)ExAllocatePoolWithTag(NonPagedPoolNx,
+		FIELD_OFFSET(SHV_NUMA_ROUND, Samples[PagesPerRound]) + (PagesPerRound + 63) / 64 * sizeof(ULONG64),
+		SHV_NUMA_TAG);
+	ShvVmxNumaRegions = (PSHV_EPT_REGION)ExAllocatePoolWithTag(NonPagedPoolNx,
+		PagesPerRound * sizeof(SHV_EPT_REGION),
+		SHV_NUMA_TAG);
+
+	if (ShvVmxNumaRoundBuffer == NULL || ShvVmxNumaRegions == NULL)
+	{
+		ret = STATUS_HV_NO_RESOURCES;
+		goto Failure;
+	}
+
+	ShvVmxNumaRoundBuffer->Count = 0;
+	ShvVmxNumaRoundBuffer->Armed = (volatile ULONG64 *)&ShvVmxNumaRoundBuffer->Samples[PagesPerRound];
+	ShvVmxNumaPagesPerRound = PagesPerRound;
+	ShvVmxNumaPeriod = Period;
+	ShvVmxNumaRandomSeed = (ULONG)__rdtsc();
+
+	//
+	// Sample from a thread of our own, since changing the EPT needs to run
+	// below DISPATCH_LEVEL.
+	//
+	KeClearEvent(&ShvVmxNumaStopEvent);
+
+	ret = PsCreateSystemThread(&thread, THREAD_ALL_ACCESS, NULL, NULL, NULL, ShvVmxNumaThread, NULL);
+	if (ret != STATUS_SUCCESS)
+	{
+		goto Failure;
+	}
+
+	ret = ObReferenceObjectByHandle(thread,
+		SYNCHRONIZE,
+		*PsThreadType,
+		KernelMode,
+		(PVOID *)&ShvVmxNumaThreadObject,
+		NULL);
+
+	ZwClose(thread);
+
+	if (ret != STATUS_SUCCESS)
+	{
+		//
+		// A handle to a thread that exists can't fail to resolve, but
+		// without the object the thread could never be waited for, and
+		// the buffers never freed.  Stop it, and keep them.
+		//
+		KeSetEvent(&ShvVmxNumaStopEvent, 0, FALSE);
+		ShvVmxNumaThreadObject = NULL;
+		return ret;
+	}
+
+	return STATUS_SUCCESS;
+
+Failure:
+	if (ShvVmxNumaRegions != NULL)
+	{
+		ExFreePoolWithTag(ShvVmxNumaRegions, SHV_NUMA_TAG);
+		ShvVmxNumaRegions = NULL;
+	}
+
+	if (ShvVmxNumaRoundBuffer != NULL)
+	{
+		ExFreePoolWithTag(ShvVmxNumaRoundBuffer, SHV_NUMA_TAG);
+		ShvVmxNumaRoundBuffer = NULL;
+	}
+
+	return ret;
+}
+
+VOID
+ShvVmxNumaStop(
+	VOID
+)
+{
+	if (ShvVmxNumaThreadObject == NULL)
+	{
+		return;
+	}
+
+	//
+	// The thread ends the round in progress on its way out.
+	//
+	KeSetEvent(&ShvVmxNumaStopEvent, 0, FALSE);
+	KeWaitForSingleObject(ShvVmxNumaThreadObject, Executive, KernelMode, FALSE, NULL);
+	ObDereferenceObject(ShvVmxNumaThreadObject);
+	ShvVmxNumaThreadObject = NULL;
+
+	ExFreePoolWithTag(ShvVmxNumaRegions, SHV_NUMA_TAG);
+	ExFreePoolWithTag(ShvVmxNumaRoundBuffer, SHV_NUMA_TAG);
+	ShvVmxNumaRegions = NULL;
+	ShvVmxNumaRoundBuffer = NULL;
+}
+
+NTSTATUS
+ShvVmxNumaReport(
+	_Out_writes_to_(Count, *Returned) PSHV_NUMA_CANDIDATE Candidates,
+	_In_ ULONG Count,
+	_Out_ PULONG Returned
+)
+{
+	PSHV_NUMA_PAGE page;
+	ULONG returned, target;
+
+	//
+	// List the tracked pages that were touched remotely more often than
+	// locally, and often enough to go by.
+	//
+	*Returned = 0;
+
+	if (ShvVmxNumaEnabled == FALSE)
+	{
+		return STATUS_HV_NOT_PRESENT;
+	}
+
+	returned = 0;
+
+	ExAcquireFastMutex(&ShvVmxNumaLock);
+
+	for (ULONG i = 0; i < SHV_NUMA_TABLE_SIZE && returned < Count; i++)
+	{
+		page = &ShvVmxNumaPages[i];
+
+		if (page->Key == 0 ||
+			page->Remote < SHV_NUMA_MIN_REMOTE ||
+			page->Remote <= page->Local)
+		{
+			continue;
+		}
+
+		target = 0;
+
+		for (ULONG node = 1; node < SHV_NUMA_MAX_NODES; node++)
+		{
+			if (page->Touches[node] > page->Touches[target])
+			{
+				target = node;
+			}
+		}
+
+		Candidates[returned].Gpa = page->Key & ~(ULONG64)SHV_NUMA_KEY_USED;
+		Candidates[returned].Node = page->Node;
+		Candidates[returned].Target = target;
+		Candidates[returned].Local = page->Local;
+		Candidates[returned].Remote = page->Remote;
+		returned++;
+	}
+
+	ExReleaseFastMutex(&ShvVmxNumaLock);
+
+	*Returned = returned;
+
+	return STATUS_SUCCESS;
+}
+
+VOID
+ShvVmxNumaQuery(
+	_Out_ PSHV_NUMA_STATISTICS Statistics
+)
+{
+	__stosb((PUCHAR)Statistics, 0, sizeof(*Statistics));
+
+	if (ShvVmxNumaEnabled == FALSE)
+	{
+		return;
+	}
+
+	ExAcquireFastMutex(&ShvVmxNumaLock);
+
+	*Statistics = ShvVmxNumaStatistics;
+	Statistics->Pages = ShvVmxNumaPageCount;
+
+	ExReleaseFastMutex(&ShvVmxNumaLock);
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+BOOLEAN
+ShvVmxNumaHandleViolation(
+	_In_ PSHV_VP_STATE VpState,
+	_In_ ULONG64 Gpa,
+	_In_ ULONG Access
+)
+{
+	PSHV_NUMA_ROUND round;
+	PSHV_NUMA_SAMPLE sample;
+	ULONG64 index;
+
+	UNREFERENCED_PARAMETER(VpState);
+	UNREFERENCED_PARAMETER(Access);
+
+	round = ShvVmxNumaRound;
+	if (round == NULL)
+	{
+		return FALSE;
+	}
+
+	Gpa &= ~(ULONG64)(PAGE_SIZE - 1);
+
+	sample = (PSHV_NUMA_SAMPLE)ShvUtilFindByKey(round->Samples, round->Count, sizeof(SHV_NUMA_SAMPLE), Gpa);
+	if (sample == NULL)
+	{
+		return FALSE;
+	}
+
+	//
+	// Only pages the round armed are its own.
+	//
+	index = sample - round->Samples;
+
+	if ((round->Armed[index / 64] & (1ULL << (index % 64))) == 0)
+	{
+		return FALSE;
+	}
+
+	//
+	// Only the first touch counts.  The page had full access when it was
+	// sampled, so that is what it gets back.  A VP that still has the old
+	// translation cached takes a violation of its own, which the EPT code
+	// deals with by itself.  One that touched the page before the first
+	// toucher gave its access back still finds it without any, but a page
+	// that has some access again was given back, and whoever protected it
+	// since owns it.
+	//
+	if (InterlockedCompareExchange(&sample->Node,
+		(LONG)KeGetCurrentNodeNumber(),
+		SHV_NUMA_UNTOUCHED) != SHV_NUMA_UNTOUCHED &&
+		ShvVmxEptGetAccess(Gpa, NULL) != 0)
+	{
+		return FALSE;
+	}
+
+	ShvVmxEptGrantAccess(Gpa, VMX_EPT_ACCESS_RWX);
+	return TRUE;
+}
+
+VOID
+ShvVmxNumaThread(
+	_In_ PVOID StartContext
+)
+{
+	LARGE_INTEGER timeout;
+	BOOLEAN ended;
+
+	UNREFERENCED_PARAMETER(StartContext);
+
+	timeout.QuadPart = -10000LL * ShvVmxNumaPeriod;
+
+	ExAcquireFastMutex(&ShvVmxNumaLock);
+	ShvVmxNumaBeginRound();
+	ExReleaseFastMutex(&ShvVmxNumaLock);
+
+	while (KeWaitForSingleObject(&ShvVmxNumaStopEvent, Executive, KernelMode, FALSE, &timeout) == STATUS_TIMEOUT)
+	{
+		//
+		// A round that couldn't be ended stays armed, and is tried again
+		// next time, instead of arming a new one over it.
+		//
+		ExAcquireFastMutex(&ShvVmxNumaLock);
+
+		if (ShvVmxNumaEndRound() != FALSE)
+		{
+			ShvVmxNumaBeginRound();
+		}
+
+		ExReleaseFastMutex(&ShvVmxNumaLock);
+	}
+
+	//
+	// The round buffer is freed once the thread is gone, so the last round
+	// has to end before that, however long it takes.
+	//
+	for (;;)
+	{
+		ExAcquireFastMutex(&ShvVmxNumaLock);
+		ended = ShvVmxNumaEndRound();
+		ExReleaseFastMutex(&ShvVmxNumaLock);
+
+		if (ended != FALSE)
+		{
+			break;
+		}
+
+		KeDelayExecutionThread(KernelMode, FALSE, &timeout);
+	}
+
+	PsTerminateSystemThread(STATUS_SUCCESS);
+}
+
+static BOOLEAN
+ShvVmxNumaEndRound(
+	VOID
+)
+{
+	PSHV_NUMA_ROUND round;
+	PSHV_NUMA_PAGE page;
+	ULONG64 restored;
+	ULONG node, home;
+	NTSTATUS ret;
+
+	round = ShvVmxNumaRound;
+	if (round == NULL)
+	{
+		return TRUE;
+	}
+
+	//
+	// Give the armed pages that nobody touched their access back, which
+	// also collapses the pages again, then wait for every LP to be done
+	// with the round.  Pages that someone else protected since they were
+	// touched are theirs, and are left alone.
+	//
+	for (ULONG i = 0; i < round->Count; i++)
+	{
+		ShvVmxNumaRegions[i].Base = round->Samples[i].Gpa;
+		ShvVmxNumaRegions[i].Size = PAGE_SIZE;
+	}
+
+	ret = ShvVmxEptProtectOwnedPages(ShvVmxNumaRegions,
+		round->Count,
+		0,
+		VMX_EPT_ACCESS_RWX,
+		round->Armed,
+		&restored);
+	if (ret != STATUS_SUCCESS)
+	{
+		//
+		// Keep claiming the round, which gives pages their access back as
+		// they are touched.
+		//
+		SHV_DEBUG_PRINT("NUMA round did not end: %x\n", ret);
+		return FALSE;
+	}
+
+	InterlockedExchangePointer((PVOID volatile *)&ShvVmxNumaRound, NULL);
+	KeIpiGenericCall(ShvUtilIpiBarrier, 0);
+
+	ShvVmxNumaStatistics.Rounds++;
+
+	//
+	// Add up the touches.
+	//
+	for (ULONG i = 0; i < round->Count; i++)
+	{
+		if (round->Samples[i].Node == SHV_NUMA_UNTOUCHED)
+		{
+			continue;
+		}
+
+		ShvVmxNumaStatistics.Touched++;
+
+		node = (ULONG)round->Samples[i].Node;
+		home = ShvVmxNumaGetHomeNode(round->Samples[i].Gpa);
+
+		if (home == MAXULONG)
+		{
+			ShvVmxNumaStatistics.Unknown++;
+			continue;
+		}
+
+		page = ShvVmxNumaFindPage(round->Samples[i].Gpa, TRUE);
+		if (page == NULL)
+		{
+			ShvVmxNumaStatistics.Overflow++;
+			continue;
+		}
+
+		page->Node = home;
+
+		if (node == home)
+		{
+			page->Local++;
+			ShvVmxNumaStatistics.Local++;
+		}
+		else
+		{
+			page->Remote++;
+			ShvVmxNumaStatistics.Remote++;
+		}
+
+		if (node < SHV_NUMA_MAX_NODES)
+		{
+			page->Touches[node]++;
+		}
+	}
+
+	round->Count = 0;
+
+	return TRUE;
+}
+
+static VOID
+ShvVmxNumaBeginRound(
+	VOID
+)
+{
+	PSHV_NUMA_ROUND round;
+	PSHV_NUMA_PAGE page;
+	ULONG64 ramPages, address, end, gpa, armed;
+	ULONG count, resample, attempts;
+	NTSTATUS ret;
+
+	round = ShvVmxNumaRoundBuffer;
+
+	//
+	// Half of the sample goes to pages that were already touched remotely,
+	// picking up where the last round left off.
+	//
+	count = 0;
+	resample = ShvVmxNumaPagesPerRound / 2;
+
+	for (ULONG i = 0; i < SHV_NUMA_TABLE_SIZE && count < resample && ShvVmxNumaPageCount != 0; i++)
+	{
+		page = &ShvVmxNumaPages[ShvVmxNumaCursor];
+		ShvVmxNumaCursor = (ShvVmxNumaCursor + 1) & (SHV_NUMA_TABLE_SIZE - 1);
+
+		if (page->Key != 0 && page->Remote != 0)
+		{
+			round->Samples[count++].Gpa = page->Key & ~(ULONG64)SHV_NUMA_KEY_USED;
+		}
+	}
+
+	//
+	// The rest is drawn at random from RAM, the same ranges the identity
+	// map is built from.
+	//
+	ramPages = 0;
+
+	for (address = 0; address < ShvMemMapGetTopOfRam(); address = end)
+	{
+		if (ShvMemMapLookup(address, &end) == ShvMemoryRam)
+		{
+			ramPages += (end - address) / PAGE_SIZE;
+		}
+	}
+
+	for (attempts = 0; count < ShvVmxNumaPagesPerRound && attempts < 2 * ShvVmxNumaPagesPerRound; attempts++)
+	{
+		if (ShvVmxNumaPickPage(ramPages, &gpa))
+		{
+			round->Samples[count++].Gpa = gpa;
+		}
+	}
+
+	//
+	// Sort the sample for root mode, and drop the pages that were picked
+	// twice.
+	//
+	ShvUtilSortByKey(round->Samples, count, sizeof(SHV_NUMA_SAMPLE));
+
+	round->Count = 0;
+
+	for (ULONG i = 0; i < count; i++)
+	{
+		gpa = round->Samples[i].Gpa;
+
+		if (round->Count != 0 && round->Samples[round->Count - 1].Gpa == gpa)
+		{
+			continue;
+		}
+
+		round->Samples[round->Count].Gpa = gpa;
+		round->Samples[round->Count].Node = SHV_NUMA_UNTOUCHED;
+		ShvVmxNumaRegions[round->Count].Base = gpa;
+		ShvVmxNumaRegions[round->Count].Size = PAGE_SIZE;
+		round->Count++;
+	}
+
+	if (round->Count == 0)
+	{
+		return;
+	}
+
+	//
+	// Publish the round before arming it, so that root mode claims every
+	// violation it causes, then arm the whole sample under one shootdown.
+	// Only pages something else doesn't protect or remap are armed, since
+	// their access couldn't be given back as it was, and each one's bit is
+	// set before it is.  Whatever was armed before a failure is disarmed
+	// with the round.
+	//
+	__stosq((PULONG64)round->Armed, 0, (round->Count + 63) / 64);
+
+	InterlockedExchangePointer((PVOID volatile *)&ShvVmxNumaRound, round);
+
+	ret = ShvVmxEptProtectOwnedPages(ShvVmxNumaRegions,
+		round->Count,
+		VMX_EPT_ACCESS_RWX,
+		0,
+		round->Armed,
+		&armed);
+	ShvVmxNumaStatistics.Armed += armed;
+
+	if (ret != STATUS_SUCCESS)
+	{
+		SHV_DEBUG_PRINT("NUMA round could not be armed: %x\n", ret);
+		return;
+	}
+
+	ShvVmxNumaStatistics.Skipped += round->Count - armed;
+}
+
+static BOOLEAN
+ShvVmxNumaPickPage(
+	ULONG64 ramPages,
+	PULONG64 gpa
+)
+{
+	ULONG64 index, address, end, pages;
+
+	if (ramPages == 0)
+	{
+		return FALSE;
+	}
+
+	//
+	// RtlRandomEx only gives 31 bits at a time.
+	//
+	index = ((ULONG64)RtlRandomEx(&ShvVmxNumaRandomSeed) << 31) | RtlRandomEx(&ShvVmxNumaRandomSeed);
+	index %= ramPages;
+
+	for (address = 0; address < ShvMemMapGetTopOfRam(); address = end)
+	{
+		if (ShvMemMapLookup(address, &end) != ShvMemoryRam)
+		{
+			continue;
+		}
+
+		pages = (end - address) / PAGE_SIZE;
+
+		if (index < pages)
+		{
+			*gpa = address + index * PAGE_SIZE;
+			return TRUE;
+		}
+
+		index -= pages;
+	}
+
+	//
+	// RAM was removed since it was counted.
+	//
+	return FALSE;
+}
+
+static ULONG
+ShvVmxNumaGetHomeNode(
+	ULONG64 gpa
+)
+{
+	ULONG low, high, middle;
+
+	low = 0;
+	high = ShvVmxNumaRangeCount;
+
+	while (low < high)
+	{
+		middle = low + (high - low) / 2;
+
+		if (gpa < ShvVmxNumaRanges[middle].Base)
+		{
+			high = middle;
+		}
+		else if (gpa >= ShvVmxNumaRanges[middle].End)
+		{
+			low = middle + 1;
+		}
+		else
+		{
+			return ShvVmxNumaRanges[middle].Node;
+		}
+	}
+
+	return MAXULONG;
+}
+
+static PSHV_NUMA_PAGE
+ShvVmxNumaFindPage(
+	ULONG64 gpa,
+	BOOLEAN insert
+)
+{
+	PSHV_NUMA_PAGE page;
+	ULONG64 key;
+	ULONG index;
+
+	//
+	// Open addressing with linear probing.  Slots are never freed.
+	//
+	key = gpa | SHV_NUMA_KEY_USED;
+	index = (ULONG)(((gpa >> PAGE_SHIFT) * SHV_NUMA_SEED) >> (64 - SHV_NUMA_TABLE_BITS));
+
+	for (ULONG i = 0; i < SHV_NUMA_TABLE_SIZE; i++)
+	{
+		page = &ShvVmxNumaPages[(index + i) & (SHV_NUMA_TABLE_SIZE - 1)];
+
+		if (page->Key == key)
+		{
+			return page;
+		}
+
+		if (page->Key != 0)
+		{
+			continue;
+		}
+
+		if (insert == FALSE || ShvVmxNumaPageCount >= SHV_NUMA_MAX_PAGES)
+		{
+			return NULL;
+		}
+
+		page->Key = key;
+		ShvVmxNumaPageCount++;
+
+		return page;
+	}
+
+	return NULL;
+}
@@ -0,0 +1,431 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvvmxpml.c
+
+Abstract:
+
+	This module implements Page Modification Logging, which records the
+	pages the guest writes to so that physical memory can be captured
+	incrementally.
+
+Author:
+
+	agent (@agent) 15-Oct-2026 - Initial version
+
+Environment:
+
+	Kernel mode only.
+
+--*/
+
+#include "shv.h"
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// Set to TRUE to log the pages the guest writes to, when the processor
+// supports PML and EPT accessed and dirty flags.
+//
+#define SHV_PML_ENABLE FALSE
+
+// ===========================================================================
+//
+// PUBLIC DATA
+//
+// ===========================================================================
+
+BOOLEAN ShvVmxPmlEnabled = FALSE;
+
+// ===========================================================================
+//
+// LOCAL DATA
+//
+// ===========================================================================
+
+//
+// The dirty bitmap.  Each shard covers 2 MiB of physical memory, and each
+// bit of the summary tells whether a shard has any bit set, so collecting
+// only looks at the shards that were written to.
+//
+static PSHV_PML_SHARD ShvVmxPmlShards = NULL;
+static volatile LONG64 *ShvVmxPmlSummary = NULL;
+static ULONG64 ShvVmxPmlShardCount = 0;
+static BOOLEAN ShvVmxPmlRequested = SHV_PML_ENABLE;
+
+// ===========================================================================
+//
+// LOCAL PROTOTYPES
+//
+// ===========================================================================
+
+static VOID
+ShvVmxPmlMarkDirty(
+	_In_ ULONG64 Gpa
+);
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+NTSTATUS
+ShvVmxPmlInitialize(
+	VOID
+)
+{
+	ULONG64 control;
+	SIZE_T size;
+
+	if (ShvVmxPmlRequested == FALSE)
+	{
+		return STATUS_SUCCESS;
+	}
+
+	//
+	// PML is a secondary control, and only logs writes that set an EPT
+	// dirty flag.  Without either, leave it off.
+	//
+	control = __readmsr(MSR_IA32_VMX_PROCBASED_CTLS2);
+
+	if ((control & ((ULONG64)SECONDARY_EXEC_ENABLE_PML << 32)) == 0 ||
+		ShvVmxEptEnableAccessDirty() == FALSE)
+	{
+		SHV_DEBUG_PRINT("PML is not supported\n");
+		return STATUS_SUCCESS;
+	}
+
+	//
+	// Cover every page of RAM.  Writes to MMIO are logged too, but aren't
+	// part of a physical memory capture, so they are dropped.
+	//
+	ShvVmxPmlShardCount = (ShvMemMapGetTopOfRam() + SHV_PML_SHARD_SIZE - 1) / SHV_PML_SHARD_SIZE;
+	if (ShvVmxPmlShardCount == 0)
+	{
+		return STATUS_HV_NO_RESOURCES;
+	}
+
+	size = (SIZE_T)ShvVmxPmlShardCount * sizeof(SHV_PML_SHARD);
+	ShvVmxPmlShards = (PSHV_PML_SHARD)ExAllocatePoolWithTag(NonPagedPoolNx, size, 'LMPS');
+	if (ShvVmxPmlShards == NULL)
+	{
+		return STATUS_HV_NO_RESOURCES;
+	}
+
+	__stosb((PUCHAR)ShvVmxPmlShards, 0, size);
+
+	size = (SIZE_T)((ShvVmxPmlShardCount + 63) / 64) * sizeof(LONG64);
+	ShvVmxPmlSummary = (volatile LONG64 *)ExAllocatePoolWithTag(NonPagedPoolNx, size, 'LMPS');
+	if (ShvVmxPmlSummary == NULL)
+	{
+		ShvVmxPmlCleanup();
+		return STATUS_HV_NO_RESOURCES;
+	}
+
+	__stosb((PUCHAR)ShvVmxPmlSummary, 0, size);
+
+	ShvVmxPmlEnabled = TRUE;
+
+	return STATUS_SUCCESS;
+}
+
+VOID
+ShvVmxPmlCleanup(
+	VOID
+)
+{
+	//
+	// This only runs once every LP has left root mode, so nothing can be
+	// draining into the bitmap anymore.
+	//
+	ShvVmxPmlEnabled = FALSE;
+
+	if (ShvVmxPmlSummary != NULL)
+	{
+		ExFreePoolWithTag((PVOID)ShvVmxPmlSummary, 'LMPS');
+		ShvVmxPmlSummary = NULL;
+	}
+
+	if (ShvVmxPmlShards != NULL)
+	{
+		ExFreePoolWithTag(ShvVmxPmlShards, 'LMPS');
+		ShvVmxPmlShards = NULL;
+	}
+
+	ShvVmxPmlShardCount = 0;
+}
+
+VOID
+ShvVmxPmlSetupVmcs(
+	_In_ PSHV_VP_DATA VpData
+)
+{
+	if (ShvVmxPmlEnabled == FALSE)
+	{
+		return;
+	}
+
+	//
+	// Point the VMCS at this VP's log, and start logging from the top.
+	//
+	__vmx_vmwrite(PML_ADDRESS, VpData->PmlPhysicalAddress);
+	__vmx_vmwrite(GUEST_PML_INDEX, VMX_PML_INDEX_START);
+}
+
+VOID
+ShvVmxPmlDrain(
+	_In_ PSHV_VP_DATA VpData
+)
+{
+	SIZE_T index;
+
+	if (ShvVmxPmlEnabled == FALSE)
+	{
+		return;
+	}
+
+	//
+	// The processor logs from the last entry down, and leaves the index at
+	// the next free entry.  Once the log is full, the index wraps around
+	// past zero, so anything outside of the log means every entry is used.
+	//
+	__vmx_vmread(GUEST_PML_INDEX, &index);
+
+	index = (index & 0xffff) + 1;
+	if (index > VMX_PML_ENTRY_COUNT)
+	{
+		index = 0;
+	}
+
+	if (index == VMX_PML_ENTRY_COUNT)
+	{
+		return;
+	}
+
+	for (SIZE_T i = index; i < VMX_PML_ENTRY_COUNT; i++)
+	{
+		ShvVmxPmlMarkDirty(VpData->PmlBuffer[i]);
+	}
+
+	__vmx_vmwrite(GUEST_PML_INDEX, VMX_PML_INDEX_START);
+}
+
+VOID
+ShvVmxPmlLogWrite(
+	_In_ ULONG64 Gpa
+)
+{
+	//
+	// For writes root mode makes on behalf of the guest, which the processor
+	// never sees, and so never logs.
+	//
+	if (ShvVmxPmlEnabled == FALSE)
+	{
+		return;
+	}
+
+	ShvVmxPmlMarkDirty(Gpa);
+}
+
+ULONG64
+ShvVmxPmlGetPageCount(
+	VOID
+)
+{
+	//
+	// The number of bits the bitmap passed to ShvVmxPmlCollect needs.
+	//
+	return ShvVmxPmlShardCount * SHV_PML_SHARD_SIZE / PAGE_SIZE;
+}
+
+NTSTATUS
+ShvVmxPmlStartEpoch(
+	VOID
+)
+{
+	NTSTATUS status;
+
+	if (ShvVmxPmlEnabled == FALSE)
+	{
+		return STATUS_NOT_SUPPORTED;
+	}
+
+	//
+	// The processor only logs the write that sets the dirty flag of a
+	// page, so a large page would only be logged once no matter how much
+	// of it is written.  Map everything at 4 KiB for as long as PML is on.
+	// This only does anything the first time around.
+	//
+	status = ShvVmxEptSplitLargePages();
+	if (status != STATUS_SUCCESS)
+	{
+		return status;
+	}
+
+	//
+	// Empty the bitmap first.  Anything drained into it from here on was
+	// written after this, which at worst makes a page dirty that the base
+	// capture the caller takes after this already has.
+	//
+	for (ULONG64 i = 0; i < (ShvVmxPmlShardCount + 63) / 64; i++)
+	{
+		InterlockedExchange64(&ShvVmxPmlSummary[i], 0);
+	}
+
+	for (ULONG64 i = 0; i < ShvVmxPmlShardCount; i++)
+	{
+		for (ULONG j = 0; j < SHV_PML_SHARD_WORDS; j++)
+		{
+			InterlockedExchange64(&ShvVmxPmlShards[i].Bits[j], 0);
+		}
+	}
+
+	//
+	// Then clear every dirty flag so that the next write to any page is
+	// logged, and have every VP flush its cached translations.  Doing it
+	// the other way around would lose writes logged in between.
+	//
+	ShvVmxEptClearAllDirty();
+	ShvVmxEptShootdown();
+
+	return STATUS_SUCCESS;
+}
+
+NTSTATUS
+ShvVmxPmlCollect(
+	_Inout_ PRTL_BITMAP DirtyPages
+)
+{
+	ULONG64 summary, shard, page;
+	ULONG64 bits[SHV_PML_SHARD_WORDS];
+	BOOLEAN dirty;
+	ULONG index;
+
+	if (ShvVmxPmlEnabled == FALSE)
+	{
+		return STATUS_NOT_SUPPORTED;
+	}
+
+	if (DirtyPages->SizeOfBitMap < ShvVmxPmlGetPageCount())
+	{
+		return STATUS_BUFFER_TOO_SMALL;
+	}
+
+	//
+	// Have every VP drain its log, so that the bitmap has every write made
+	// up to now.
+	//
+	ShvVmxEptShootdown();
+
+	//
+	// Move the bits of every shard that was written to into the caller's
+	// bitmap, and clear the dirty flags of those pages so that they are
+	// logged again on their next write.  The caller may be collecting into
+	// the same bitmap from elsewhere, so only ever set bits atomically.
+	// The flags of a whole shard are cleared with a single walk.
+	//
+	for (ULONG64 i = 0; i < (ShvVmxPmlShardCount + 63) / 64; i++)
+	{
+		summary = (ULONG64)InterlockedExchange64(&ShvVmxPmlSummary[i], 0);
+
+		while (_BitScanForward64(&index, summary))
+		{
+			summary &= summary - 1;
+			shard = i * 64 + index;
+			dirty = FALSE;
+
+			for (ULONG j = 0; j < SHV_PML_SHARD_WORDS; j++)
+			{
+				bits[j] = (ULONG64)InterlockedExchange64(&ShvVmxPmlShards[shard].Bits[j], 0);
+				if (bits[j] == 0)
+				{
+					continue;
+				}
+
+				page = shard * (SHV_PML_SHARD_SIZE / PAGE_SIZE) + j * 64;
+
+				InterlockedOr((volatile LONG *)&DirtyPages->Buffer[page / 32], (LONG)bits[j]);
+				InterlockedOr((volatile LONG *)&DirtyPages->Buffer[page / 32 + 1], (LONG)(bits[j] >> 32));
+
+				dirty = TRUE;
+			}
+
+			if (dirty)
+			{
+				ShvVmxEptClearDirtyPages(shard * SHV_PML_SHARD_SIZE, bits);
+			}
+		}
+	}
+
+	//
+	// Flush again so that no VP keeps using a cached translation that
+	// still has the dirty flag set.  A write that slips in before this is
+	// already in whatever the caller copies once this returns.
+	//
+	ShvVmxEptShootdown();
+
+	return STATUS_SUCCESS;
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+static VOID
+ShvVmxPmlMarkDirty(
+	_In_ ULONG64 Gpa
+)
+{
+	ULONG64 size, page, end, shard;
+
+	//
+	// Pages are split to 4 KiB once an epoch starts, but a large page can
+	// still be logged before that, or if splitting it failed.  It is only
+	// logged once no matter how much of it is written, so treat all of it
+	// as dirty, a whole shard at a time.
+	//
+	size = max(ShvVmxEptGetPageSize(Gpa), PAGE_SIZE);
+
+	if (size >= SHV_PML_SHARD_SIZE)
+	{
+		shard = (Gpa & ~(size - 1)) / SHV_PML_SHARD_SIZE;
+		end = min(shard + size / SHV_PML_SHARD_SIZE, ShvVmxPmlShardCount);
+
+		for (; shard < end; shard++)
+		{
+			for (ULONG j = 0; j < SHV_PML_SHARD_WORDS; j++)
+			{
+				InterlockedExchange64(&ShvVmxPmlShards[shard].Bits[j], -1);
+			}
+
+			InterlockedBitTestAndSet64(&ShvVmxPmlSummary[shard / 64], shard % 64);
+		}
+
+		return;
+	}
+
+	page = Gpa / PAGE_SIZE;
+	end = min(page + 1, ShvVmxPmlGetPageCount());
+
+	for (; page < end; page++)
+	{
+		shard = page / (SHV_PML_SHARD_SIZE / PAGE_SIZE);
+
+		InterlockedBitTestAndSet64(
+			&ShvVmxPmlShards[shard].Bits[(page % (SHV_PML_SHARD_SIZE / PAGE_SIZE)) / 64],
+			page % 64
+		);
+
+		InterlockedBitTestAndSet64(&ShvVmxPmlSummary[shard / 64], shard % 64);
+	}
+}
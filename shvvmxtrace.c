@@ -0,0 +1,713 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvvmxtrace.c
+
+Abstract:
+
+	This module implements the system call tracer.  The SWAPGS that the
+	system call handler starts with is replaced by a VMCALL of the same
+	length in an execute only shadow of its page, so every system call
+	exits once, right where it enters the kernel, while reads of the page
+	and of LSTAR still see the originals.  Root mode carries out the
+	SWAPGS, and records the call into the ring of the VP if it passes the
+	filter and is sampled.
+
+Author:
+
+	agent (@agent) 15-Oct-2026 - Initial version
+
+Environment:
+
+	Kernel mode only.
+
+--*/
+
+#include "shv.h"
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// Set to TRUE to support tracing.  This costs a ring per LP, and nothing
+// else until tracing starts.  It also needs hooks.
+//
+#define SHV_TRACE_ENABLE FALSE
+
+#define SHV_TRACE_TAG 'CRTS'
+
+//
+// CR3 without the PCID.
+//
+#define SHV_TRACE_CR3_MASK              (~(ULONG64)0xfff)
+
+// ===========================================================================
+//
+// LOCAL TYPES
+//
+// ===========================================================================
+
+//
+// What only root mode on one VP touches, on a line of its own.  Head is
+// the copy of the head of the ring that is trusted, since the consumer
+// can write the ring.
+//
+typedef struct _SHV_TRACE_VP
+{
+	ULONG64 Calls;
+	ULONG64 Filtered;
+	ULONG64 Recorded;
+	ULONG64 Dropped;
+	ULONG Head;
+	ULONG Countdown;
+	UCHAR Reserved[24];
+} SHV_TRACE_VP, *PSHV_TRACE_VP;
+
+C_ASSERT(sizeof(SHV_TRACE_VP) == 64);
+
+//
+// The address spaces to trace.  Cr3s are without the PCID.
+//
+typedef struct _SHV_TRACE_FILTER
+{
+	ULONG Count;
+	ULONG64 Cr3s[SHV_TRACE_MAX_FILTERS];
+} SHV_TRACE_FILTER, *PSHV_TRACE_FILTER;
+
+// ===========================================================================
+//
+// LOCAL DATA
+//
+// ===========================================================================
+
+static BOOLEAN ShvVmxTraceRequested = SHV_TRACE_ENABLE;
+static BOOLEAN ShvVmxTraceEnabled = FALSE;
+
+//
+// Serializes starting and stopping, the filter and the mapping.
+//
+static FAST_MUTEX ShvVmxTraceLock = { 0 };
+
+//
+// The rings, each starting on a page of its own, and the state of the VPs
+// that fill them.
+//
+static PUCHAR ShvVmxTraceRings = NULL;
+static ULONG ShvVmxTraceRingCount = 0;
+static ULONG ShvVmxTraceRingStride = 0;
+static PSHV_TRACE_VP ShvVmxTraceVps = NULL;
+
+//
+// The VMCALL that stands in for the SWAPGS, or zero when not tracing, and
+// the hook that patched it in.
+//
+static volatile ULONG64 ShvVmxTraceAddress = 0;
+static ULONG ShvVmxTraceHookId = 0;
+static volatile ULONG ShvVmxTraceSampleRate = 1;
+
+//
+// The filter root mode reads without a lock, or NULL to trace every
+// address space.  A new one is filled in the other of the two, and the
+// old one is only filled again once no LP can be looking at it.
+//
+static SHV_TRACE_FILTER ShvVmxTraceFilters[2] = { 0 };
+static PSHV_TRACE_FILTER volatile ShvVmxTraceFilter = NULL;
+
+//
+// The user mode mapping of the rings, the process it is in, and the handle
+// it was made through.
+//
+static PMDL ShvVmxTraceMdl = NULL;
+static PVOID ShvVmxTraceUserBase = NULL;
+static PEPROCESS ShvVmxTraceProcess = NULL;
+static PFILE_OBJECT ShvVmxTraceOwner = NULL;
+static BOOLEAN ShvVmxTraceNotifying = FALSE;
+
+// ===========================================================================
+//
+// LOCAL PROTOTYPES
+//
+// ===========================================================================
+
+static NTSTATUS
+ShvVmxTraceStopLocked(
+	VOID
+);
+
+static VOID
+ShvVmxTraceUnmapLocked(
+	VOID
+);
+
+static CREATE_PROCESS_NOTIFY_ROUTINE ShvVmxTraceProcessNotify;
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+NTSTATUS
+ShvVmxTraceInitialize(
+	VOID
+)
+{
+	SIZE_T size;
+
+	if (ShvVmxTraceRequested == FALSE)
+	{
+		return STATUS_SUCCESS;
+	}
+
+	ExInitializeFastMutex(&ShvVmxTraceLock);
+
+	//
+	// The rings are mapped to user mode whole, so they are one allocation,
+	// and none of them shares a page with anything else.
+	//
+	ShvVmxTraceRingCount = KeQueryActiveProcessorCountEx(ALL_PROCESSOR_GROUPS);
+	ShvVmxTraceRingStride = (ULONG)ROUND_TO_PAGES(sizeof(SHV_TRACE_RING));
+
+	size = (SIZE_T)ShvVmxTraceRingCount * ShvVmxTraceRingStride;
+
+	ShvVmxTraceRings = (PUCHAR)ExAllocatePoolWithTag(NonPagedPoolNx, size, SHV_TRACE_TAG);
+	if (ShvVmxTraceRings == NULL)
+	{
+		return STATUS_HV_NO_RESOURCES;
+	}
+
+	ShvVmxTraceVps = (PSHV_TRACE_VP)ExAllocatePoolWithTag(NonPagedPoolNx, ShvVmxTraceRingCount * sizeof(SHV_TRACE_VP), SHV_TRACE_TAG);
+	if (ShvVmxTraceVps == NULL)
+	{
+		ExFreePoolWithTag(ShvVmxTraceRings, SHV_TRACE_TAG);
+		ShvVmxTraceRings = NULL;
+		return STATUS_HV_NO_RESOURCES;
+	}
+
+	__stosb(ShvVmxTraceRings, 0, size);
+	__stosb((PUCHAR)ShvVmxTraceVps, 0, ShvVmxTraceRingCount * sizeof(SHV_TRACE_VP));
+
+	//
+	// The mapping has to go before the process it is in does.  A handle
+	// that was passed on to another process doesn't close with it, so
+	// watch for the exit itself too.
+	//
+	if (PsSetCreateProcessNotifyRoutine(ShvVmxTraceProcessNotify, FALSE) == STATUS_SUCCESS)
+	{
+		ShvVmxTraceNotifying = TRUE;
+	}
+	else
+	{
+		SHV_DEBUG_PRINT("Trace rings won't be unmapped on process exit\n");
+	}
+
+	ShvVmxTraceEnabled = TRUE;
+
+	return STATUS_SUCCESS;
+}
+
+VOID
+ShvVmxTraceCleanup(
+	VOID
+)
+{
+	NTSTATUS ret;
+
+	if (ShvVmxTraceEnabled == FALSE)
+	{
+		return;
+	}
+
+	ExAcquireFastMutex(&ShvVmxTraceLock);
+
+	ret = ShvVmxTraceStopLocked();
+	ShvVmxTraceUnmapLocked();
+
+	ExReleaseFastMutex(&ShvVmxTraceLock);
+
+	if (ShvVmxTraceNotifying)
+	{
+		PsSetCreateProcessNotifyRoutine(ShvVmxTraceProcessNotify, TRUE);
+		ShvVmxTraceNotifying = FALSE;
+	}
+
+	//
+	// If the VMCALL is still patched in, root mode still needs the rings,
+	// so leave them to the hooks being dropped later.
+	//
+	if (ret != STATUS_SUCCESS)
+	{
+		SHV_DEBUG_PRINT("Tracing did not stop: %x\n", ret);
+		return;
+	}
+
+	ShvVmxTraceEnabled = FALSE;
+
+	ExFreePoolWithTag(ShvVmxTraceVps, SHV_TRACE_TAG);
+	ExFreePoolWithTag(ShvVmxTraceRings, SHV_TRACE_TAG);
+	ShvVmxTraceVps = NULL;
+	ShvVmxTraceRings = NULL;
+	ShvVmxTraceFilter = NULL;
+}
+
+NTSTATUS
+ShvVmxTraceStart(
+	_In_ ULONG SampleRate
+)
+{
+	static const UCHAR swapgs[3] = { 0x0f, 0x01, 0xf8 };
+	static const UCHAR vmcall[3] = { 0x0f, 0x01, 0xc1 };
+	SHV_HOOK_REQUEST request;
+	PUCHAR entry;
+	ULONG id;
+	NTSTATUS ret;
+
+	if (ShvVmxTraceEnabled == FALSE)
+	{
+		return STATUS_HV_NOT_PRESENT;
+	}
+
+	//
+	// One in every SampleRate calls that pass the filter is recorded.
+	//
+	ShvVmxTraceSampleRate = (SampleRate != 0) ? SampleRate : 1;
+
+	ExAcquireFastMutex(&ShvVmxTraceLock);
+
+	if (ShvVmxTraceAddress != 0)
+	{
+		ExReleaseFastMutex(&ShvVmxTraceLock);
+		return STATUS_SUCCESS;
+	}
+
+	//
+	// LSTAR is the same on every LP.  With KVA shadowing it points to the
+	// shadow handler, which is mapped in user address spaces too, but
+	// starts with a SWAPGS all the same.
+	//
+	entry = (PUCHAR)__readmsr(IA32_LSTAR_MSR);
+
+	if (RtlCompareMemory(entry, swapgs, sizeof(swapgs)) != sizeof(swapgs))
+	{
+		ExReleaseFastMutex(&ShvVmxTraceLock);
+		return STATUS_NOT_SUPPORTED;
+	}
+
+	request.Target = entry;
+	request.Detour = NULL;
+	request.Patch = vmcall;
+	request.PatchLength = sizeof(vmcall);
+
+	//
+	// The VMCALL can exit as soon as it is patched in, so root mode has to
+	// know it first.
+	//
+	ShvVmxTraceAddress = (ULONG64)entry;
+
+	ret = ShvVmxHookInstall(&request, 1, &id);
+	if (ret != STATUS_SUCCESS)
+	{
+		ShvVmxTraceAddress = 0;
+	}
+	else
+	{
+		ShvVmxTraceHookId = id;
+	}
+
+	ExReleaseFastMutex(&ShvVmxTraceLock);
+
+	return ret;
+}
+
+NTSTATUS
+ShvVmxTraceStop(
+	VOID
+)
+{
+	NTSTATUS ret;
+
+	if (ShvVmxTraceEnabled == FALSE)
+	{
+		return STATUS_HV_NOT_PRESENT;
+	}
+
+	ExAcquireFastMutex(&ShvVmxTraceLock);
+
+	ret = ShvVmxTraceStopLocked();
+
+	ExReleaseFastMutex(&ShvVmxTraceLock);
+
+	return ret;
+}
+
+NTSTATUS
+ShvVmxTraceSetFilter(
+	_In_reads_(Count) const ULONG64 *Cr3s,
+	_In_ ULONG Count
+)
+{
+	PSHV_TRACE_FILTER filter;
+	ULONG i;
+
+	if (ShvVmxTraceEnabled == FALSE)
+	{
+		return STATUS_HV_NOT_PRESENT;
+	}
+
+	if (Count > SHV_TRACE_MAX_FILTERS)
+	{
+		return STATUS_INVALID_PARAMETER;
+	}
+
+	ExAcquireFastMutex(&ShvVmxTraceLock);
+
+	//
+	// Without KVA shadowing, Cr3s are the directory table bases of the
+	// processes to trace.  With it, system calls come from the user
+	// directory table bases instead.
+	//
+	filter = NULL;
+
+	if (Count != 0)
+	{
+		filter = (ShvVmxTraceFilter == &ShvVmxTraceFilters[0]) ? &ShvVmxTraceFilters[1] : &ShvVmxTraceFilters[0];
+
+		for (i = 0; i < Count; i++)
+		{
+			filter->Cr3s[i] = Cr3s[i] & SHV_TRACE_CR3_MASK;
+		}
+
+		filter->Count = Count;
+	}
+
+	InterlockedExchangePointer((PVOID volatile *)&ShvVmxTraceFilter, filter);
+
+	//
+	// Wait for every LP to be done with the old filter, which the next
+	// change fills again.
+	//
+	KeIpiGenericCall(ShvUtilIpiBarrier, 0);
+
+	ExReleaseFastMutex(&ShvVmxTraceLock);
+
+	return STATUS_SUCCESS;
+}
+
+NTSTATUS
+ShvVmxTraceMapRings(
+	_In_ PFILE_OBJECT Owner,
+	_Out_ PSHV_TRACE_MAPPING Mapping
+)
+{
+	PMDL mdl;
+	PVOID base;
+
+	Mapping->Base = NULL;
+	Mapping->RingCount = 0;
+	Mapping->RingStride = 0;
+
+	if (ShvVmxTraceEnabled == FALSE)
+	{
+		return STATUS_HV_NOT_PRESENT;
+	}
+
+	ExAcquireFastMutex(&ShvVmxTraceLock);
+
+	if (ShvVmxTraceMdl != NULL)
+	{
+		ExReleaseFastMutex(&ShvVmxTraceLock);
+		return STATUS_DEVICE_BUSY;
+	}
+
+	mdl = IoAllocateMdl(ShvVmxTraceRings, ShvVmxTraceRingCount * ShvVmxTraceRingStride, FALSE, FALSE, NULL);
+	if (mdl == NULL)
+	{
+		ExReleaseFastMutex(&ShvVmxTraceLock);
+		return STATUS_HV_NO_RESOURCES;
+	}
+
+	MmBuildMdlForNonPagedPool(mdl);
+
+	//
+	// Map the rings into the current process.  The consumer writes Tail,
+	// so it can write the rings, but nothing root mode trusts is in them.
+	//
+	__try
+	{
+		base = MmMapLockedPagesSpecifyCache(mdl, UserMode, MmCached, NULL, FALSE, NormalPagePriority | MdlMappingNoExecute);
+	}
+	__except (EXCEPTION_EXECUTE_HANDLER)
+	{
+		base = NULL;
+	}
+
+	if (base == NULL)
+	{
+		IoFreeMdl(mdl);
+		ExReleaseFastMutex(&ShvVmxTraceLock);
+		return STATUS_HV_NO_RESOURCES;
+	}
+
+	ShvVmxTraceProcess = PsGetCurrentProcess();
+	ObReferenceObject(ShvVmxTraceProcess);
+
+	ShvVmxTraceMdl = mdl;
+	ShvVmxTraceUserBase = base;
+	ShvVmxTraceOwner = Owner;
+
+	Mapping->Base = base;
+	Mapping->RingCount = ShvVmxTraceRingCount;
+	Mapping->RingStride = ShvVmxTraceRingStride;
+
+	ExReleaseFastMutex(&ShvVmxTraceLock);
+
+	return STATUS_SUCCESS;
+}
+
+VOID
+ShvVmxTraceUnmapRings(
+	_In_ PFILE_OBJECT Owner
+)
+{
+	if (ShvVmxTraceEnabled == FALSE)
+	{
+		return;
+	}
+
+	//
+	// Only the handle the rings were mapped through can unmap them, which
+	// it also does when it is closed.
+	//
+	ExAcquireFastMutex(&ShvVmxTraceLock);
+
+	if (ShvVmxTraceOwner == Owner)
+	{
+		ShvVmxTraceUnmapLocked();
+	}
+
+	ExReleaseFastMutex(&ShvVmxTraceLock);
+}
+
+VOID
+ShvVmxTraceQuery(
+	_Out_ PSHV_TRACE_STATISTICS Statistics
+)
+{
+	ULONG i;
+
+	__stosb((PUCHAR)Statistics, 0, sizeof(*Statistics));
+
+	if (ShvVmxTraceEnabled == FALSE)
+	{
+		return;
+	}
+
+	//
+	// The counters of a VP only ever grow, so a torn sum is only ever a
+	// little behind.
+	//
+	for (i = 0; i < ShvVmxTraceRingCount; i++)
+	{
+		Statistics->Calls += ShvVmxTraceVps[i].Calls;
+		Statistics->Filtered += ShvVmxTraceVps[i].Filtered;
+		Statistics->Recorded += ShvVmxTraceVps[i].Recorded;
+		Statistics->Dropped += ShvVmxTraceVps[i].Dropped;
+	}
+}
+
+BOOLEAN
+ShvVmxTraceHandleVmcall(
+	_In_ PSHV_VP_STATE VpState
+)
+{
+	PSHV_TRACE_FILTER filter;
+	PSHV_TRACE_RECORD record;
+	PSHV_TRACE_RING ring;
+	PSHV_TRACE_VP vp;
+	SIZE_T cs, gsBase, cr3;
+	ULONG vpIndex, i;
+
+	//
+	// Only claim the VMCALL that stands in for the SWAPGS.  Any other one
+	// fails like before.
+	//
+	if (ShvVmxTraceAddress == 0 || VpState->GuestRip != ShvVmxTraceAddress)
+	{
+		return FALSE;
+	}
+
+	__vmx_vmread(GUEST_CS_SELECTOR, &cs);
+	if ((cs & RPL_MASK) != DPL_SYSTEM)
+	{
+		return FALSE;
+	}
+
+	//
+	// Carry out the SWAPGS and move past it.  The kernel GS base is not
+	// switched on exits, so the MSR still holds the one of the guest.
+	//
+	__vmx_vmread(GUEST_GS_BASE, &gsBase);
+	__vmx_vmwrite(GUEST_GS_BASE, __readmsr(IA32_KERNEL_GS_BASE_MSR));
+	__writemsr(IA32_KERNEL_GS_BASE_MSR, gsBase);
+
+	VpState->GuestRip += 3;
+	__vmx_vmwrite(GUEST_RIP, VpState->GuestRip);
+
+	vpIndex = KeGetCurrentProcessorNumberEx(NULL);
+	vp = &ShvVmxTraceVps[vpIndex];
+	vp->Calls++;
+
+	//
+	// Everything from here on only decides whether to record the call, so
+	// calls that are filtered out or not sampled return right away.
+	//
+	__vmx_vmread(GUEST_CR3, &cr3);
+	cr3 &= SHV_TRACE_CR3_MASK;
+
+	filter = ShvVmxTraceFilter;
+	if (filter != NULL)
+	{
+		for (i = 0; i < filter->Count && filter->Cr3s[i] != cr3; i++);
+
+		if (i == filter->Count)
+		{
+			vp->Filtered++;
+			return TRUE;
+		}
+	}
+
+	if (vp->Countdown > 1)
+	{
+		vp->Countdown--;
+		return TRUE;
+	}
+
+	vp->Countdown = ShvVmxTraceSampleRate;
+
+	//
+	// Tail comes from the consumer, so it is only used to tell whether the
+	// ring is full.  Whatever it says, the record goes inside the ring.
+	//
+	ring = (PSHV_TRACE_RING)(ShvVmxTraceRings + (SIZE_T)vpIndex * ShvVmxTraceRingStride);
+
+	if (vp->Head - (ULONG)ring->Tail >= SHV_TRACE_RING_SIZE)
+	{
+		vp->Dropped++;
+		return TRUE;
+	}
+
+	record = &ring->Records[vp->Head & (SHV_TRACE_RING_SIZE - 1)];
+
+	record->Tsc = __rdtsc();
+	record->Cr3 = cr3;
+	record->ReturnRip = VpState->VpRegs->Rcx;
+	record->Arguments[0] = VpState->VpRegs->R10;
+	record->Arguments[1] = VpState->VpRegs->Rdx;
+	record->Arguments[2] = VpState->VpRegs->R8;
+	record->Arguments[3] = VpState->VpRegs->R9;
+	record->Number = (ULONG)VpState->VpRegs->Rax;
+	record->Vp = (USHORT)vpIndex;
+	record->Reserved = 0;
+
+	//
+	// Publish the record only once it is complete.
+	//
+	vp->Head++;
+	InterlockedExchange(&ring->Head, (LONG)vp->Head);
+	vp->Recorded++;
+
+	return TRUE;
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+static NTSTATUS
+ShvVmxTraceStopLocked(
+	VOID
+)
+{
+	NTSTATUS ret;
+
+	if (ShvVmxTraceAddress == 0)
+	{
+		return STATUS_SUCCESS;
+	}
+
+	//
+	// Removing the hook waits for every LP, so once it is gone, no VP is
+	// left to exit on the VMCALL.
+	//
+	ret = ShvVmxHookRemove(&ShvVmxTraceHookId, 1);
+	if (ret != STATUS_SUCCESS)
+	{
+		return ret;
+	}
+
+	ShvVmxTraceAddress = 0;
+	ShvVmxTraceHookId = 0;
+
+	return STATUS_SUCCESS;
+}
+
+static VOID
+ShvVmxTraceUnmapLocked(
+	VOID
+)
+{
+	KAPC_STATE apcState;
+
+	if (ShvVmxTraceMdl == NULL)
+	{
+		return;
+	}
+
+	KeStackAttachProcess(ShvVmxTraceProcess, &apcState);
+	MmUnmapLockedPages(ShvVmxTraceUserBase, ShvVmxTraceMdl);
+	KeUnstackDetachProcess(&apcState);
+
+	ObDereferenceObject(ShvVmxTraceProcess);
+	IoFreeMdl(ShvVmxTraceMdl);
+
+	ShvVmxTraceProcess = NULL;
+	ShvVmxTraceUserBase = NULL;
+	ShvVmxTraceMdl = NULL;
+	ShvVmxTraceOwner = NULL;
+}
+
+static VOID
+ShvVmxTraceProcessNotify(
+	_In_ HANDLE ParentId,
+	_In_ HANDLE ProcessId,
+	_In_ BOOLEAN Create
+)
+{
+	UNREFERENCED_PARAMETER(ParentId);
+
+	//
+	// A process is told about before its address space is torn down, which
+	// would fail with the rings still locked into it.
+	//
+	if (Create)
+	{
+		return;
+	}
+
+	ExAcquireFastMutex(&ShvVmxTraceLock);
+
+	if (ShvVmxTraceProcess != NULL && PsGetProcessId(ShvVmxTraceProcess) == ProcessId)
+	{
+		ShvVmxTraceUnmapLocked();
+	}
+
+	ExReleaseFastMutex(&ShvVmxTraceLock);
+}
@@ -0,0 +1,998 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvvmxwatch.c
+
+Abstract:
+
+	This module implements EPT watchpoints.  The pages that hold watched
+	bytes are read- or write-protected in the default view, and the
+	violations they cause are filtered against a sorted table of the
+	watched intervals of each page.  Either way, writes are emulated from
+	root mode when the store emulator can decode them, and anything else
+	is single stepped in a view that withholds nothing.  Hits are logged
+	to a ring of the VP that made them.
+
+Author:
+
+	agent (@agent) 15-Oct-2026 - Initial version
+
+Environment:
+
+	Kernel mode only.
+
+--*/
+
+#include "shv.h"
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// Set to TRUE to support watchpoints.  This costs a view, and nothing else
+// until something is watched.
+//
+#define SHV_WATCH_ENABLE FALSE
+
+//
+// Set to FALSE to single step every write too, instead of carrying out
+// the ones the store emulator understands in the exit that caught them.
+//
+#define SHV_WATCH_EMULATE TRUE
+
+#define SHV_WATCH_TAG 'TAWS'
+
+//
+// EPT violations tell where an access faulted, but not how wide it was.
+// Unless the write was decoded, assume it covered this many bytes, which
+// catches every general purpose access, aligned or not, at the cost of
+// reporting a few that stopped just short of a watch.
+//
+#define SHV_WATCH_ACCESS_WIDTH (8)
+
+// ===========================================================================
+//
+// LOCAL TYPES
+//
+// ===========================================================================
+
+//
+// A watch, as the guest physical ranges it covers.  A watch on virtual
+// memory has a range for every run of physically contiguous pages.
+//
+typedef struct _SHV_WATCH
+{
+	struct _SHV_WATCH *Next;
+	ULONG Id;
+	ULONG Access;
+	ULONG RangeCount;
+	SHV_EPT_REGION Ranges[ANYSIZE_ARRAY];
+} SHV_WATCH, *PSHV_WATCH;
+
+//
+// The part [Start, End) of a watch that falls within a single page.
+//
+typedef struct _SHV_WATCH_INTERVAL
+{
+	ULONG64 Start;
+	ULONG64 End;
+	ULONG Access;
+	ULONG Id;
+} SHV_WATCH_INTERVAL, *PSHV_WATCH_INTERVAL;
+
+//
+// A watched page, whose intervals are Count entries of the table starting
+// at First.  Access is what any of them watch for, and so what the page
+// is protected against.
+//
+typedef struct _SHV_WATCH_PAGE
+{
+	ULONG64 Gpa;
+	ULONG First;
+	ULONG Count;
+	ULONG Access;
+} SHV_WATCH_PAGE, *PSHV_WATCH_PAGE;
+
+//
+// Every watched page, sorted by GPA, and their intervals, sorted by start.
+// Root mode reads it without a lock, so a new table is only ever published
+// whole, and the old one is only freed once no LP can be looking at it.
+//
+typedef struct _SHV_WATCH_TABLE
+{
+	ULONG PageCount;
+	ULONG IntervalCount;
+	PSHV_WATCH_PAGE Pages;
+	PSHV_WATCH_INTERVAL Intervals;
+} SHV_WATCH_TABLE, *PSHV_WATCH_TABLE;
+
+//
+// The hits of a VP.  Only the VP itself adds to the ring, from root mode,
+// and only the holder of the lock takes from it, so each index has a
+// single writer and no further locking is needed.
+//
+typedef struct _SHV_WATCH_RING
+{
+	volatile LONG Head;
+	volatile LONG Tail;
+	SHV_WATCH_HIT Hits[SHV_WATCH_RING_SIZE];
+} SHV_WATCH_RING, *PSHV_WATCH_RING;
+
+// ===========================================================================
+//
+// LOCAL DATA
+//
+// ===========================================================================
+
+static BOOLEAN ShvVmxWatchRequested = SHV_WATCH_ENABLE;
+static BOOLEAN ShvVmxWatchEnabled = FALSE;
+static BOOLEAN ShvVmxWatchEmulate = SHV_WATCH_EMULATE;
+
+//
+// Serializes changes to the watches and reading the rings.
+//
+static FAST_MUTEX ShvVmxWatchLock = { 0 };
+
+static PSHV_WATCH ShvVmxWatchList = NULL;
+static ULONG ShvVmxWatchNextId = 1;
+static PSHV_WATCH_TABLE volatile ShvVmxWatchTable = NULL;
+
+//
+// The view accesses are stepped in.  It was cloned from the default view
+// before anything was protected, so it withholds nothing.
+//
+static ULONG ShvVmxWatchView = SHV_EPT_DEFAULT_VIEW;
+
+static PSHV_WATCH_RING ShvVmxWatchRings = NULL;
+static ULONG ShvVmxWatchRingCount = 0;
+
+static SHV_WATCH_STATISTICS ShvVmxWatchStatistics = { 0 };
+
+// ===========================================================================
+//
+// LOCAL PROTOTYPES
+//
+// ===========================================================================
+
+static NTSTATUS
+ShvVmxWatchInsert(
+	PSHV_WATCH watch,
+	PULONG id
+);
+
+static NTSTATUS
+ShvVmxWatchUpdate(
+	VOID
+);
+
+static NTSTATUS
+ShvVmxWatchBuild(
+	PSHV_WATCH_TABLE *table
+);
+
+static ULONG
+ShvVmxWatchProtection(
+	ULONG access
+);
+
+static VOID
+ShvVmxWatchRecord(
+	PSHV_VP_STATE VpState,
+	const SHV_WATCH_INTERVAL *interval,
+	ULONG64 gpa,
+	ULONG access
+);
+
+SHV_EPT_VIOLATION_HANDLER ShvVmxWatchHandleViolation;
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+NTSTATUS
+ShvVmxWatchInitialize(
+	VOID
+)
+{
+	NTSTATUS ret;
+	INT64 control;
+
+	if (ShvVmxWatchRequested == FALSE)
+	{
+		return STATUS_SUCCESS;
+	}
+
+	ExInitializeFastMutex(&ShvVmxWatchLock);
+
+	//
+	// Accesses to watched pages are single stepped with the monitor trap
+	// flag, in a view of their own.  Without either, there are no
+	// watchpoints, but the SHV works all the same.
+	//
+	control = __readmsr(MSR_IA32_VMX_PROCBASED_CTLS);
+
+	if (_bittest64(&control, 32 + 27) == 0)
+	{
+		SHV_DEBUG_PRINT("Watchpoints are not supported: no monitor trap flag\n");
+		return STATUS_SUCCESS;
+	}
+
+	ret = ShvVmxEptCreateView(&ShvVmxWatchView);
+	if (ret != STATUS_SUCCESS)
+	{
+		SHV_DEBUG_PRINT("Watchpoints are not supported: %x\n", ret);
+		return STATUS_SUCCESS;
+	}
+
+	ShvVmxWatchRingCount = KeQueryActiveProcessorCountEx(ALL_PROCESSOR_GROUPS);
+
+	ShvVmxWatchRings = (PSHV_WATCH_RING)ExAllocatePoolWithTag(NonPagedPoolNx,
+		ShvVmxWatchRingCount * sizeof(SHV_WATCH_RING),
+		SHV_WATCH_TAG);
+	if (ShvVmxWatchRings == NULL)
+	{
+		return STATUS_HV_NO_RESOURCES;
+	}
+
+	__stosb((PUCHAR)ShvVmxWatchRings, 0, ShvVmxWatchRingCount * sizeof(SHV_WATCH_RING));
+
+	ret = ShvVmxEptRegisterViolationHandler(ShvVmxWatchHandleViolation);
+	if (ret != STATUS_SUCCESS)
+	{
+		ExFreePoolWithTag(ShvVmxWatchRings, SHV_WATCH_TAG);
+		ShvVmxWatchRings = NULL;
+		return ret;
+	}
+
+	ShvVmxWatchEnabled = TRUE;
+
+	return STATUS_SUCCESS;
+}
+
+VOID
+ShvVmxWatchCleanup(
+	VOID
+)
+{
+	PSHV_WATCH watch;
+
+	if (ShvVmxWatchEnabled == FALSE)
+	{
+		return;
+	}
+
+	//
+	// Drop every watch, which gives the pages their permissions back.
+	//
+	ExAcquireFastMutex(&ShvVmxWatchLock);
+
+	while ((watch = ShvVmxWatchList) != NULL)
+	{
+		ShvVmxWatchList = watch->Next;
+		ExFreePoolWithTag(watch, SHV_WATCH_TAG);
+	}
+
+	ShvVmxWatchUpdate();
+
+	ExReleaseFastMutex(&ShvVmxWatchLock);
+
+	//
+	// This waits for every LP to be done with the rings.  A VP that is still
+	// stepping an access finishes it without them.
+	//
+	ShvVmxEptUnregisterViolationHandler(ShvVmxWatchHandleViolation);
+	ShvVmxWatchEnabled = FALSE;
+
+	ExFreePoolWithTag(ShvVmxWatchRings, SHV_WATCH_TAG);
+	ShvVmxWatchRings = NULL;
+	ShvVmxWatchRingCount = 0;
+	ShvVmxWatchNextId = 1;
+}
+
+NTSTATUS
+ShvVmxWatchAddPhysical(
+	_In_ ULONG64 Gpa,
+	_In_ ULONG64 Length,
+	_In_ ULONG Access,
+	_Out_ PULONG Id
+)
+{
+	PSHV_WATCH watch;
+	NTSTATUS ret;
+
+	*Id = 0;
+
+	if (ShvVmxWatchEnabled == FALSE)
+	{
+		return STATUS_HV_NOT_PRESENT;
+	}
+
+	if (Length == 0 ||
+		Gpa + Length < Gpa ||
+		Access == 0 ||
+		(Access & ~(SHV_WATCH_READ | SHV_WATCH_WRITE)) != 0)
+	{
+		return STATUS_INVALID_PARAMETER;
+	}
+
+	watch = (PSHV_WATCH)ExAllocatePoolWithTag(NonPagedPoolNx, sizeof(SHV_WATCH), SHV_WATCH_TAG);
+	if (watch == NULL)
+	{
+		return STATUS_HV_NO_RESOURCES;
+	}
+
+	watch->Access = Access;
+	watch->RangeCount = 1;
+	watch->Ranges[0].Base = Gpa;
+	watch->Ranges[0].Size = Length;
+
+	ret = ShvVmxWatchInsert(watch, Id);
+	if (ret != STATUS_SUCCESS)
+	{
+		ExFreePoolWithTag(watch, SHV_WATCH_TAG);
+	}
+
+	return ret;
+}
+
+NTSTATUS
+ShvVmxWatchAddVirtual(
+	_In_ PVOID Va,
+	_In_ SIZE_T Length,
+	_In_ ULONG Access,
+	_Out_ PULONG Id
+)
+{
+	PHYSICAL_ADDRESS pa;
+	PSHV_WATCH watch;
+	PSHV_EPT_REGION range;
+	ULONG_PTR va, end, next;
+	ULONG pages;
+	NTSTATUS ret;
+
+	//
+	// The virtual range is translated once, here, in the context of the
+	// caller.  The caller has to keep it resident and mapped to the same
+	// pages for as long as the watch exists.
+	//
+	*Id = 0;
+
+	if (ShvVmxWatchEnabled == FALSE)
+	{
+		return STATUS_HV_NOT_PRESENT;
+	}
+
+	if (Length == 0 ||
+		(ULONG_PTR)Va + Length < (ULONG_PTR)Va ||
+		Access == 0 ||
+		(Access & ~(SHV_WATCH_READ | SHV_WATCH_WRITE)) != 0)
+	{
+		return STATUS_INVALID_PARAMETER;
+	}
+
+	pages = ADDRESS_AND_SIZE_TO_SPAN_PAGES(Va, Length);
+
+	watch = (PSHV_WATCH)ExAllocatePoolWithTag(NonPagedPoolNx,
+		FIELD_OFFSET(SHV_WATCH, Ranges) + pages * sizeof(SHV_EPT_REGION),
+		SHV_WATCH_TAG);
+	if (watch == NULL)
+	{
+		return STATUS_HV_NO_RESOURCES;
+	}
+
+	watch->Access = Access;
+	watch->RangeCount = 0;
+
+	range = NULL;
+	end = (ULONG_PTR)Va + Length;
+
+	for (va = (ULONG_PTR)Va; va < end; va = next)
+	{
+		next = min((va | (PAGE_SIZE - 1)) + 1, end);
+
+		pa = MmGetPhysicalAddress((PVOID)va);
+		if (pa.QuadPart == 0)
+		{
+			ExFreePoolWithTag(watch, SHV_WATCH_TAG);
+			return STATUS_INVALID_PARAMETER;
+		}
+
+		//
+		// Extend the last range when the page follows it physically too.
+		//
+		if (range != NULL && range->Base + range->Size == (ULONG64)pa.QuadPart)
+		{
+			range->Size += next - va;
+			continue;
+		}
+
+		range = &watch->Ranges[watch->RangeCount++];
+		range->Base = pa.QuadPart;
+		range->Size = next - va;
+	}
+
+	ret = ShvVmxWatchInsert(watch, Id);
+	if (ret != STATUS_SUCCESS)
+	{
+		ExFreePoolWithTag(watch, SHV_WATCH_TAG);
+	}
+
+	return ret;
+}
+
+NTSTATUS
+ShvVmxWatchRemove(
+	_In_ ULONG Id
+)
+{
+	PSHV_WATCH watch, *link;
+	NTSTATUS ret;
+
+	if (ShvVmxWatchEnabled == FALSE)
+	{
+		return STATUS_HV_NOT_PRESENT;
+	}
+
+	ExAcquireFastMutex(&ShvVmxWatchLock);
+
+	for (link = &ShvVmxWatchList; *link != NULL; link = &(*link)->Next)
+	{
+		if ((*link)->Id == Id)
+		{
+			break;
+		}
+	}
+
+	watch = *link;
+	if (watch == NULL)
+	{
+		ExReleaseFastMutex(&ShvVmxWatchLock);
+		return STATUS_NOT_FOUND;
+	}
+
+	*link = watch->Next;
+
+	//
+	// Lifting or narrowing a protection never needs tables, so this only
+	// fails if something else changed the pages underneath us.
+	//
+	ret = ShvVmxWatchUpdate();
+
+	ExReleaseFastMutex(&ShvVmxWatchLock);
+
+	ExFreePoolWithTag(watch, SHV_WATCH_TAG);
+
+	return ret;
+}
+
+NTSTATUS
+ShvVmxWatchReadHits(
+	_In_ ULONG Vp,
+	_Out_writes_to_(Count, *Returned) PSHV_WATCH_HIT Hits,
+	_In_ ULONG Count,
+	_Out_ PULONG Returned
+)
+{
+	PSHV_WATCH_RING ring;
+	LONG head, tail;
+	ULONG returned;
+
+	*Returned = 0;
+
+	if (ShvVmxWatchEnabled == FALSE)
+	{
+		return STATUS_HV_NOT_PRESENT;
+	}
+
+	if (Vp >= ShvVmxWatchRingCount)
+	{
+		return STATUS_INVALID_PARAMETER;
+	}
+
+	ring = &ShvVmxWatchRings[Vp];
+
+	ExAcquireFastMutex(&ShvVmxWatchLock);
+
+	//
+	// Everything up to the head was written before the head moved past it.
+	// Moving the tail hands the slots back to the VP.
+	//
+	head = ring->Head;
+	tail = ring->Tail;
+
+	for (returned = 0; returned < Count && tail != head; returned++, tail++)
+	{
+		Hits[returned] = ring->Hits[tail & (SHV_WATCH_RING_SIZE - 1)];
+	}
+
+	InterlockedExchange(&ring->Tail, tail);
+
+	ExReleaseFastMutex(&ShvVmxWatchLock);
+
+	*Returned = returned;
+
+	return STATUS_SUCCESS;
+}
+
+VOID
+ShvVmxWatchQuery(
+	_Out_ PSHV_WATCH_STATISTICS Statistics
+)
+{
+	*Statistics = ShvVmxWatchStatistics;
+}
+
+VOID
+ShvVmxWatchHandleStep(
+	_In_ PSHV_VP_STATE VpState
+)
+{
+	ULONG64 start;
+
+	UNREFERENCED_PARAMETER(VpState);
+
+	//
+	// The access that was stepped is done, or an interrupt came first and
+	// it will fault again later.  Either way, put the VP back in the default
+	// view.  This doesn't touch anything cleanup frees, since a VP can still
+	// be stepping after the watchpoints went away.
+	//
+	start = __rdtsc();
+
+	ShvVmxEptSwitchView(SHV_EPT_DEFAULT_VIEW);
+	ShvUtilSetMonitorTrap(FALSE);
+
+	InterlockedAdd64((volatile LONG64 *)&ShvVmxWatchStatistics.FilterCycles, __rdtsc() - start);
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+static NTSTATUS
+ShvVmxWatchInsert(
+	PSHV_WATCH watch,
+	PULONG id
+)
+{
+	NTSTATUS ret;
+
+	ExAcquireFastMutex(&ShvVmxWatchLock);
+
+	watch->Id = ShvVmxWatchNextId++;
+	watch->Next = ShvVmxWatchList;
+	ShvVmxWatchList = watch;
+
+	ret = ShvVmxWatchUpdate();
+	if (ret != STATUS_SUCCESS)
+	{
+		//
+		// Put everything back the way it was without the watch.
+		//
+		ShvVmxWatchList = watch->Next;
+		ShvVmxWatchUpdate();
+	}
+	else
+	{
+		*id = watch->Id;
+	}
+
+	ExReleaseFastMutex(&ShvVmxWatchLock);
+
+	return ret;
+}
+
+static NTSTATUS
+ShvVmxWatchUpdate(
+	VOID
+)
+{
+	PSHV_EPT_PROTECTION protections;
+	PSHV_WATCH_TABLE table, old;
+	PSHV_WATCH_PAGE page, oldPage;
+	ULONG64 hpa, end;
+	ULONG count, i, j;
+	NTSTATUS ret;
+
+	ret = ShvVmxWatchBuild(&table);
+	if (ret != STATUS_SUCCESS)
+	{
+		return ret;
+	}
+
+	old = ShvVmxWatchTable;
+
+	//
+	// Work out what changes, walking both tables in order.  A page that
+	// wasn't watched before has to be RAM that maps to itself with full
+	// access, or it belongs to someone else.
+	//
+	count = ((table != NULL) ? table->PageCount : 0) + ((old != NULL) ? old->PageCount : 0);
+
+	protections = NULL;
+	if (count != 0)
+	{
+		protections = (PSHV_EPT_PROTECTION)ExAllocatePoolWithTag(NonPagedPoolNx,
+			count * sizeof(SHV_EPT_PROTECTION),
+			SHV_WATCH_TAG);
+		if (protections == NULL)
+		{
+			ExFreePoolWithTag(table, SHV_WATCH_TAG);
+			return STATUS_HV_NO_RESOURCES;
+		}
+	}
+
+	count = 0;
+	i = 0;
+	j = 0;
+
+	while ((table != NULL && i < table->PageCount) || (old != NULL && j < old->PageCount))
+	{
+		page = (table != NULL && i < table->PageCount) ? &table->Pages[i] : NULL;
+		oldPage = (old != NULL && j < old->PageCount) ? &old->Pages[j] : NULL;
+
+		if (page != NULL && (oldPage == NULL || page->Gpa < oldPage->Gpa))
+		{
+			if (ShvMemMapLookup(page->Gpa, &end) != ShvMemoryRam ||
+				ShvVmxEptGetAccess(page->Gpa, &hpa) != VMX_EPT_ACCESS_RWX ||
+				hpa != page->Gpa)
+			{
+				ExFreePoolWithTag(protections, SHV_WATCH_TAG);
+				if (table != NULL)
+				{
+					ExFreePoolWithTag(table, SHV_WATCH_TAG);
+				}
+				return STATUS_CONFLICTING_ADDRESSES;
+			}
+
+			protections[count].Gpa = page->Gpa;
+			protections[count].Length = PAGE_SIZE;
+			protections[count].Access = ShvVmxWatchProtection(page->Access);
+			count++;
+			i++;
+		}
+		else if (oldPage != NULL && (page == NULL || oldPage->Gpa < page->Gpa))
+		{
+			protections[count].Gpa = oldPage->Gpa;
+			protections[count].Length = PAGE_SIZE;
+			protections[count].Access = VMX_EPT_ACCESS_RWX;
+			count++;
+			j++;
+		}
+		else
+		{
+			if (page->Access != oldPage->Access)
+			{
+				protections[count].Gpa = page->Gpa;
+				protections[count].Length = PAGE_SIZE;
+				protections[count].Access = ShvVmxWatchProtection(page->Access);
+				count++;
+			}
+
+			i++;
+			j++;
+		}
+	}
+
+	//
+	// Publish the new table before protecting anything, so that every
+	// violation on a newly watched page finds it.  A page that is no
+	// longer watched may fault once more before it is unprotected, which
+	// the EPT code handles by lifting the protection itself.
+	//
+	InterlockedExchangePointer((PVOID volatile *)&ShvVmxWatchTable, table);
+
+	ret = STATUS_SUCCESS;
+	if (count != 0)
+	{
+		ret = ShvVmxEptProtectRanges(protections, count);
+	}
+
+	if (protections != NULL)
+	{
+		ExFreePoolWithTag(protections, SHV_WATCH_TAG);
+	}
+
+	//
+	// Root mode runs with interrupts off, so once every LP took the IPI,
+	// none of them can still be looking at the old table.
+	//
+	if (old != NULL)
+	{
+		KeIpiGenericCall(ShvUtilIpiBarrier, 0);
+		ExFreePoolWithTag(old, SHV_WATCH_TAG);
+	}
+
+	ShvVmxWatchStatistics.Pages = (table != NULL) ? table->PageCount : 0;
+
+	return ret;
+}
+
+static NTSTATUS
+ShvVmxWatchBuild(
+	PSHV_WATCH_TABLE *table
+)
+{
+	PSHV_WATCH_INTERVAL interval;
+	PSHV_WATCH_TABLE result;
+	PSHV_WATCH_PAGE page;
+	PSHV_WATCH watch;
+	ULONG64 start, end, next;
+	ULONG count, watches;
+
+	//
+	// Every watch adds an interval for each page it touches.
+	//
+	*table = NULL;
+	count = 0;
+	watches = 0;
+
+	for (watch = ShvVmxWatchList; watch != NULL; watch = watch->Next)
+	{
+		for (ULONG i = 0; i < watch->RangeCount; i++)
+		{
+			count += (ULONG)(((watch->Ranges[i].Base + watch->Ranges[i].Size - 1) >> PAGE_SHIFT) -
+				(watch->Ranges[i].Base >> PAGE_SHIFT) + 1);
+		}
+
+		watches++;
+	}
+
+	ShvVmxWatchStatistics.Watches = watches;
+
+	if (count == 0)
+	{
+		return STATUS_SUCCESS;
+	}
+
+	//
+	// There are never more pages than intervals, so size both arrays for
+	// the intervals and put them after the header.
+	//
+	result = (PSHV_WATCH_TABLE)ExAllocatePoolWithTag(NonPagedPoolNx,
+		sizeof(SHV_WATCH_TABLE) + count * (sizeof(SHV_WATCH_INTERVAL) + sizeof(SHV_WATCH_PAGE)),
+		SHV_WATCH_TAG);
+	if (result == NULL)
+	{
+		return STATUS_HV_NO_RESOURCES;
+	}
+
+	result->Intervals = (PSHV_WATCH_INTERVAL)(result + 1);
+	result->Pages = (PSHV_WATCH_PAGE)(result->Intervals + count);
+	result->IntervalCount = count;
+	result->PageCount = 0;
+
+	interval = result->Intervals;
+
+	for (watch = ShvVmxWatchList; watch != NULL; watch = watch->Next)
+	{
+		for (ULONG i = 0; i < watch->RangeCount; i++)
+		{
+			end = watch->Ranges[i].Base + watch->Ranges[i].Size;
+
+			for (start = watch->Ranges[i].Base; start < end; start = next)
+			{
+				next = min((start | (PAGE_SIZE - 1)) + 1, end);
+
+				interval->Start = start;
+				interval->End = next;
+				interval->Access = watch->Access;
+				interval->Id = watch->Id;
+				interval++;
+			}
+		}
+	}
+
+	//
+	// Intervals sorted by start are also grouped by page, in page order.
+	//
+	ShvUtilSortByKey(result->Intervals, count, sizeof(SHV_WATCH_INTERVAL));
+
+	page = NULL;
+
+	for (ULONG i = 0; i < count; i++)
+	{
+		interval = &result->Intervals[i];
+
+		if (page == NULL || page->Gpa != (interval->Start & ~(ULONG64)(PAGE_SIZE - 1)))
+		{
+			page = &result->Pages[result->PageCount++];
+			page->Gpa = interval->Start & ~(ULONG64)(PAGE_SIZE - 1);
+			page->First = i;
+			page->Count = 0;
+			page->Access = 0;
+		}
+
+		page->Count++;
+		page->Access |= interval->Access;
+	}
+
+	*table = result;
+
+	return STATUS_SUCCESS;
+}
+
+static ULONG
+ShvVmxWatchProtection(
+	ULONG access
+)
+{
+	//
+	// Pages that can't be read can't be written either, so a page with a
+	// read watch on it is left execute-only.
+	//
+	if (access & SHV_WATCH_READ)
+	{
+		return VMX_EPT_ACCESS_EXECUTE;
+	}
+
+	return VMX_EPT_ACCESS_READ | VMX_EPT_ACCESS_EXECUTE;
+}
+
+static VOID
+ShvVmxWatchRecord(
+	PSHV_VP_STATE VpState,
+	const SHV_WATCH_INTERVAL *interval,
+	ULONG64 gpa,
+	ULONG access
+)
+{
+	PSHV_WATCH_RING ring;
+	PSHV_WATCH_HIT hit;
+	ULONG vp;
+	LONG head;
+
+	InterlockedIncrement64((volatile LONG64 *)&ShvVmxWatchStatistics.Hits);
+
+	vp = KeGetCurrentProcessorNumberEx(NULL);
+	if (vp >= ShvVmxWatchRingCount)
+	{
+		InterlockedIncrement64((volatile LONG64 *)&ShvVmxWatchStatistics.Dropped);
+		return;
+	}
+
+	//
+	// Drop the hit if the ring is full, rather than overwrite hits that
+	// may be being read.
+	//
+	ring = &ShvVmxWatchRings[vp];
+	head = ring->Head;
+
+	if ((ULONG)(head - ring->Tail) >= SHV_WATCH_RING_SIZE)
+	{
+		InterlockedIncrement64((volatile LONG64 *)&ShvVmxWatchStatistics.Dropped);
+		return;
+	}
+
+	hit = &ring->Hits[head & (SHV_WATCH_RING_SIZE - 1)];
+	hit->Tsc = __rdtsc();
+	hit->Gpa = gpa;
+	hit->Rip = VpState->GuestRip;
+	hit->Id = interval->Id;
+	hit->Vp = (USHORT)vp;
+	hit->Access = (USHORT)(access & interval->Access);
+
+	//
+	// Only publish the hit once it is all there.
+	//
+	InterlockedExchange(&ring->Head, head + 1);
+}
+
+BOOLEAN
+ShvVmxWatchHandleViolation(
+	_In_ PSHV_VP_STATE VpState,
+	_In_ ULONG64 Gpa,
+	_In_ ULONG Access
+)
+{
+	const SHV_WATCH_INTERVAL *interval;
+	PSHV_WATCH_TABLE table;
+	PSHV_WATCH_PAGE page;
+	PSHV_VP_DATA vpData;
+	SHV_EMUL_STORE store;
+	ULONG64 start, base, end;
+	BOOLEAN emulated;
+	NTSTATUS ret;
+
+	start = __rdtsc();
+
+	table = ShvVmxWatchTable;
+	if (table == NULL)
+	{
+		return FALSE;
+	}
+
+	page = (PSHV_WATCH_PAGE)ShvUtilFindByKey(table->Pages,
+		table->PageCount,
+		sizeof(SHV_WATCH_PAGE),
+		Gpa & ~(ULONG64)(PAGE_SIZE - 1));
+	if (page == NULL)
+	{
+		return FALSE;
+	}
+
+	InterlockedIncrement64((volatile LONG64 *)&ShvVmxWatchStatistics.Faults);
+
+	//
+	// A write that decodes is known down to the byte, and string writes may
+	// cover a batch of elements.
+	//
+	vpData = &ShvGlobalData->VpData[KeGetCurrentProcessorNumberEx(NULL)];
+	emulated = FALSE;
+	base = Gpa;
+	end = Gpa + SHV_WATCH_ACCESS_WIDTH;
+
+	if (ShvVmxWatchEmulate && (Access & SHV_WATCH_WRITE) != 0)
+	{
+		ret = ShvVmxEmulPrepareStore(vpData, VpState, Gpa, &store);
+		if (ret == STATUS_SUCCESS)
+		{
+			emulated = TRUE;
+			base = store.Gpa;
+			end = store.Gpa + store.Size;
+		}
+		else if (ret == STATUS_ILLEGAL_INSTRUCTION)
+		{
+			//
+			// The instruction faults instead of writing, so there is
+			// nothing to log or let through.
+			//
+			return TRUE;
+		}
+	}
+
+	//
+	// Log every watch the access overlaps and is of a kind it watches.
+	// Intervals are sorted by start, so stop at the first one that starts
+	// past the access.  Most faults on a busy page touch nothing watched,
+	// and end right here.
+	//
+	for (ULONG i = 0; i < page->Count; i++)
+	{
+		interval = &table->Intervals[page->First + i];
+
+		if (interval->Start >= end)
+		{
+			break;
+		}
+
+		if (interval->End > base && (interval->Access & Access) != 0)
+		{
+			ShvVmxWatchRecord(VpState, interval, Gpa, Access);
+		}
+	}
+
+	//
+	// Carry out the write ourselves and resume past it, which leaves the
+	// page protected and saves the exit the step would take.
+	//
+	if (emulated && ShvVmxEmulCommitStore(vpData, VpState, &store) == STATUS_SUCCESS)
+	{
+		InterlockedIncrement64((volatile LONG64 *)&ShvVmxWatchStatistics.Emulated);
+		InterlockedAdd64((volatile LONG64 *)&ShvVmxWatchStatistics.FilterCycles, __rdtsc() - start);
+
+		return TRUE;
+	}
+
+	//
+	// Let the access through by stepping the instruction in the view that
+	// withholds nothing, on this VP only.  Every other VP still faults on
+	// the page in the meantime.
+	//
+	ShvVmxEptSwitchView(ShvVmxWatchView);
+	ShvUtilSetMonitorTrap(TRUE);
+
+	InterlockedAdd64((volatile LONG64 *)&ShvVmxWatchStatistics.FilterCycles, __rdtsc() - start);
+
+	return TRUE;
+}
@@ -0,0 +1,324 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Header Name:
+
+	intrin.h
+
+Abstract:
+
+	This header provides the Microsoft compiler intrinsics and extensions
+	the hypervisor modules use, for building the test harness with GCC or
+	Clang.  Only this directory's copy is ever found by those compilers;
+	the Visual Studio project uses the real one.
+
+Author:
+
+	agent (@agent) 16-Oct-2026 - Initial version
+
+Environment:
+
+	User mode only.
+
+--*/
+
+#pragma once
+#include <immintrin.h>
+#include <x86intrin.h>
+#include <cpuid.h>
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// Map the __declspec forms that are used onto attributes.
+//
+#define __declspec(x)                   __shv_declspec_##x
+#define __shv_declspec_align(n)         __attribute__((aligned(n)))
+#define __shv_declspec_noreturn         __attribute__((noreturn))
+#define __shv_declspec_thread           __thread
+#define __forceinline                   inline __attribute__((always_inline))
+#define __int64                         long long
+#define __cdecl
+
+//
+// Structured exception handling has no equivalent, and nothing the harness
+// runs ever faults, so the guarded block just runs.
+//
+#define __try                           if (1)
+#define __except(x)                     else if (0)
+
+// ===========================================================================
+//
+// STRING INSTRUCTIONS
+//
+// ===========================================================================
+
+static inline void
+__stosb(unsigned char *Destination, unsigned char Data, unsigned long long Count)
+{
+	__asm__ __volatile__("rep stosb" : "+D"(Destination), "+c"(Count) : "a"(Data) : "memory");
+}
+
+static inline void
+__stosd(unsigned int *Destination, unsigned int Data, unsigned long long Count)
+{
+	__asm__ __volatile__("rep stosl" : "+D"(Destination), "+c"(Count) : "a"(Data) : "memory");
+}
+
+static inline void
+__stosq(unsigned long long *Destination, unsigned long long Data, unsigned long long Count)
+{
+	__asm__ __volatile__("rep stosq" : "+D"(Destination), "+c"(Count) : "a"(Data) : "memory");
+}
+
+static inline void
+__movsb(unsigned char *Destination, const unsigned char *Source, unsigned long long Count)
+{
+	__asm__ __volatile__("rep movsb" : "+D"(Destination), "+S"(Source), "+c"(Count) : : "memory");
+}
+
+static inline void
+__movsq(unsigned long long *Destination, const unsigned long long *Source, unsigned long long Count)
+{
+	__asm__ __volatile__("rep movsq" : "+D"(Destination), "+S"(Source), "+c"(Count) : : "memory");
+}
+
+// ===========================================================================
+//
+// BIT MANIPULATION
+//
+// ===========================================================================
+
+static inline unsigned char
+_bittest64(const long long *Base, long long Bit)
+{
+	return (unsigned char)((Base[Bit >> 6] >> (Bit & 63)) & 1);
+}
+
+static inline unsigned char
+_BitScanForward(unsigned int *Index, unsigned int Mask)
+{
+	if (Mask == 0)
+	{
+		return 0;
+	}
+
+	*Index = (unsigned int)__builtin_ctz(Mask);
+	return 1;
+}
+
+static inline unsigned char
+_BitScanReverse(unsigned int *Index, unsigned int Mask)
+{
+	if (Mask == 0)
+	{
+		return 0;
+	}
+
+	*Index = 31 - (unsigned int)__builtin_clz(Mask);
+	return 1;
+}
+
+static inline unsigned char
+_BitScanForward64(unsigned int *Index, unsigned long long Mask)
+{
+	if (Mask == 0)
+	{
+		return 0;
+	}
+
+	*Index = (unsigned int)__builtin_ctzll(Mask);
+	return 1;
+}
+
+static inline unsigned char
+_BitScanReverse64(unsigned int *Index, unsigned long long Mask)
+{
+	if (Mask == 0)
+	{
+		return 0;
+	}
+
+	*Index = 63 - (unsigned int)__builtin_clzll(Mask);
+	return 1;
+}
+
+static inline unsigned long long
+__popcnt64(unsigned long long Value)
+{
+	return (unsigned long long)__builtin_popcountll(Value);
+}
+
+// ===========================================================================
+//
+// INTERLOCKED OPERATIONS
+//
+// ===========================================================================
+
+//
+// These are functions rather than macros over the GCC builtins so that,
+// like the real intrinsics, their results can be ignored without a
+// warning, and their arguments are checked.
+//
+static inline int
+_InterlockedIncrement(volatile int *Addend)
+{
+	return __atomic_add_fetch(Addend, 1, __ATOMIC_SEQ_CST);
+}
+
+static inline int
+_InterlockedDecrement(volatile int *Addend)
+{
+	return __atomic_sub_fetch(Addend, 1, __ATOMIC_SEQ_CST);
+}
+
+static inline int
+_InterlockedExchange(volatile int *Target, int Value)
+{
+	return __atomic_exchange_n(Target, Value, __ATOMIC_SEQ_CST);
+}
+
+static inline int
+_InterlockedExchangeAdd(volatile int *Addend, int Value)
+{
+	return __atomic_fetch_add(Addend, Value, __ATOMIC_SEQ_CST);
+}
+
+static inline int
+_InterlockedOr(volatile int *Destination, int Value)
+{
+	return __atomic_fetch_or(Destination, Value, __ATOMIC_SEQ_CST);
+}
+
+static inline int
+_InterlockedAnd(volatile int *Destination, int Value)
+{
+	return __atomic_fetch_and(Destination, Value, __ATOMIC_SEQ_CST);
+}
+
+static inline long long
+_InterlockedIncrement64(volatile long long *Addend)
+{
+	return __atomic_add_fetch(Addend, 1, __ATOMIC_SEQ_CST);
+}
+
+static inline long long
+_InterlockedDecrement64(volatile long long *Addend)
+{
+	return __atomic_sub_fetch(Addend, 1, __ATOMIC_SEQ_CST);
+}
+
+static inline long long
+_InterlockedExchange64(volatile long long *Target, long long Value)
+{
+	return __atomic_exchange_n(Target, Value, __ATOMIC_SEQ_CST);
+}
+
+static inline long long
+_InterlockedExchangeAdd64(volatile long long *Addend, long long Value)
+{
+	return __atomic_fetch_add(Addend, Value, __ATOMIC_SEQ_CST);
+}
+
+static inline long long
+_InterlockedOr64(volatile long long *Destination, long long Value)
+{
+	return __atomic_fetch_or(Destination, Value, __ATOMIC_SEQ_CST);
+}
+
+static inline long long
+_InterlockedAnd64(volatile long long *Destination, long long Value)
+{
+	return __atomic_fetch_and(Destination, Value, __ATOMIC_SEQ_CST);
+}
+
+static inline long long
+_InterlockedXor64(volatile long long *Destination, long long Value)
+{
+	return __atomic_fetch_xor(Destination, Value, __ATOMIC_SEQ_CST);
+}
+
+static inline void *
+_InterlockedExchangePointer(void *volatile *Target, void *Value)
+{
+	return __atomic_exchange_n(Target, Value, __ATOMIC_SEQ_CST);
+}
+
+//
+// The compare and exchange intrinsics take the exchange before the
+// comparand and return the initial value.
+//
+static inline int
+_InterlockedCompareExchange(volatile int *Destination, int Exchange, int Comparand)
+{
+	return __sync_val_compare_and_swap(Destination, Comparand, Exchange);
+}
+
+static inline char
+_InterlockedCompareExchange8(volatile char *Destination, char Exchange, char Comparand)
+{
+	return __sync_val_compare_and_swap(Destination, Comparand, Exchange);
+}
+
+static inline short
+_InterlockedCompareExchange16(volatile short *Destination, short Exchange, short Comparand)
+{
+	return __sync_val_compare_and_swap(Destination, Comparand, Exchange);
+}
+
+static inline long long
+_InterlockedCompareExchange64(volatile long long *Destination, long long Exchange, long long Comparand)
+{
+	return __sync_val_compare_and_swap(Destination, Comparand, Exchange);
+}
+
+static inline void *
+_InterlockedCompareExchangePointer(void *volatile *Destination, void *Exchange, void *Comparand)
+{
+	return __sync_val_compare_and_swap(Destination, Comparand, Exchange);
+}
+
+static inline unsigned char
+_interlockedbittestandset(volatile int *Base, int Bit)
+{
+	return (unsigned char)((__atomic_fetch_or(&Base[Bit >> 5], 1 << (Bit & 31), __ATOMIC_SEQ_CST) >> (Bit & 31)) & 1);
+}
+
+static inline unsigned char
+_interlockedbittestandset64(volatile long long *Base, long long Bit)
+{
+	return (unsigned char)((__atomic_fetch_or(&Base[Bit >> 6], 1LL << (Bit & 63), __ATOMIC_SEQ_CST) >> (Bit & 63)) & 1);
+}
+
+static inline unsigned char
+_interlockedbittestandreset64(volatile long long *Base, long long Bit)
+{
+	return (unsigned char)((__atomic_fetch_and(&Base[Bit >> 6], ~(1LL << (Bit & 63)), __ATOMIC_SEQ_CST) >> (Bit & 63)) & 1);
+}
+
+#define _ReadWriteBarrier()             __asm__ __volatile__("" : : : "memory")
+
+// ===========================================================================
+//
+// PROCESSOR INSTRUCTIONS
+//
+// ===========================================================================
+
+//
+// Newer versions of cpuid.h have their own __cpuidex, and all of them
+// define __cpuid as a macro with a different signature.
+//
+static inline void
+__shv_cpuidex(int Info[4], int Leaf, int Subleaf)
+{
+	__cpuid_count(Leaf, Subleaf, Info[0], Info[1], Info[2], Info[3]);
+}
+
+#undef __cpuid
+#define __cpuidex(Info, Leaf, Subleaf)  __shv_cpuidex((Info), (Leaf), (Subleaf))
+#define __cpuid(Info, Leaf)             __shv_cpuidex((Info), (Leaf), 0)
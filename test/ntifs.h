@@ -0,0 +1,1164 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Header Name:
+
+	ntifs.h
+
+Abstract:
+
+	This header stands in for the WDK kernel headers when the hypervisor
+	modules are built into the user-mode test harness.  It defines the
+	types, constants and kernel routines they use, and sends every
+	privileged intrinsic to the simulated processor of the harness.
+
+Author:
+
+	agent (@agent) 16-Oct-2026 - Initial version
+
+Environment:
+
+	User mode only.
+
+--*/
+
+#pragma once
+#include <stddef.h>
+#include <wchar.h>
+#include <intrin.h>
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// Annotations.  Only the compiler that ships with the WDK checks them.
+//
+#define _In_
+#define _In_opt_
+#define _Out_
+#define _Out_opt_
+#define _Inout_
+#define _Inout_opt_
+#define _In_reads_(x)
+#define _In_reads_bytes_(x)
+#define _Out_writes_(x)
+#define _Out_writes_bytes_(x)
+#define _Out_writes_bytes_opt_(x)
+#define _Out_writes_to_(x, y)
+#define _Out_writes_bytes_to_(x, y)
+#define _Inout_updates_(x)
+#define _Inout_updates_bytes_(x)
+#define _Outptr_
+#define _Success_(x)
+#define _Must_inspect_result_
+#define _IRQL_requires_max_(x)
+#define _IRQL_requires_min_(x)
+#define _IRQL_requires_(x)
+#define _IRQL_requires_same_
+#define _Requires_lock_held_(x)
+#define _Function_class_(x)
+#define _Dispatch_type_(x)
+#define _Use_decl_annotations_
+
+#define NTKERNELAPI
+#define NTSYSAPI
+#define EXTERN_C
+#define UNALIGNED
+#define FORCEINLINE                     __forceinline
+#define DECLSPEC_NORETURN               __declspec(noreturn)
+#define DECLSPEC_ALIGN(x)               __declspec(align(x))
+#define DECLSPEC_CACHEALIGN             DECLSPEC_ALIGN(64)
+#define C_ASSERT(e)                     typedef char __C_ASSERT__[(e) ? 1 : -1]
+
+#define VOID                            void
+#define TRUE                            1
+#define FALSE                           0
+#define ANYSIZE_ARRAY                   1
+
+//
+// Debug builds of the harness print and assert the same way debug builds
+// of the driver do.  Release builds are what the benchmarks measure.
+//
+#if DBG
+#define IF_DEBUG                        if (TRUE)
+#define NT_ASSERT(e)                    ((e) ? (VOID)0 : ShvTestAssertFailed(__FILE__, __LINE__, #e))
+#define NT_ASSERTMSG(m, e)              ((e) ? (VOID)0 : ShvTestAssertFailed(__FILE__, __LINE__, m))
+#define NT_VERIFY(e)                    ShvTestVerify((e) ? TRUE : (ShvTestAssertFailed(__FILE__, __LINE__, #e), FALSE))
+#define NT_VERIFYMSG(m, e)              ShvTestVerify((e) ? TRUE : (ShvTestAssertFailed(__FILE__, __LINE__, m), FALSE))
+#else
+#define IF_DEBUG                        if (FALSE)
+#define NT_ASSERT(e)                    ((VOID)0)
+#define NT_ASSERTMSG(m, e)              ((VOID)0)
+#define NT_VERIFY(e)                    ShvTestVerify((e) ? TRUE : FALSE)
+#define NT_VERIFYMSG(m, e)              ShvTestVerify((e) ? TRUE : FALSE)
+#endif
+#define KD_DEBUGGER_NOT_PRESENT         TRUE
+#define KdBreakPoint()                  ((VOID)0)
+
+#define PAGE_SIZE                       0x1000
+#define PAGE_SHIFT                      12
+#define KERNEL_STACK_SIZE               0x6000
+#define MAXUSHORT                       0xffff
+#define MAXLONG                         0x7fffffff
+#define MAXULONG                        0xffffffffUL
+#define MAXULONG32                      0xffffffffUL
+#define MAXULONG64                      0xffffffffffffffffULL
+#define MAXULONG_PTR                    MAXULONG64
+#define _UI64_MAX                       0xffffffffffffffffULL
+
+#define PASSIVE_LEVEL                   0
+#define APC_LEVEL                       1
+#define DISPATCH_LEVEL                  2
+#define IPI_LEVEL                       14
+#define HIGH_LEVEL                      15
+#define ALL_PROCESSOR_GROUPS            0xffff
+
+#define NonPagedPool                    0
+#define NonPagedPoolExecute             0
+#define PagedPool                       1
+#define NonPagedPoolNx                  512
+#define PAGE_READWRITE                  0x04
+#define PAGE_EXECUTE_READWRITE          0x40
+#define MM_ANY_NODE_OK                  0x80000000
+#define MmNonCached                     0
+#define MmCached                        1
+#define NormalPagePriority              16
+#define MdlMappingNoExecute             0x40000000
+#define KernelMode                      0
+#define UserMode                        1
+#define Executive                       0
+#define IoWriteAccess                   1
+#define IoModifyAccess                  2
+#define NotificationEvent               0
+#define SynchronizationEvent            1
+
+#define NTDDI_WIN7                      0x06010000
+#define NTDDI_WIN8                      0x06020000
+#define NTDDI_WINTHRESHOLD              0x0A000000
+#define NTDDI_VERSION                   NTDDI_WINTHRESHOLD
+
+#define RTL_NUMBER_OF(a)                (sizeof(a) / sizeof((a)[0]))
+#define ARRAYSIZE(a)                    RTL_NUMBER_OF(a)
+#define FIELD_OFFSET(t, f)              ((LONG)offsetof(t, f))
+#define RTL_FIELD_SIZE(t, f)            (sizeof(((t *)0)->f))
+#define CONTAINING_RECORD(a, t, f)      ((t *)((PCHAR)(a) - offsetof(t, f)))
+#define UNREFERENCED_PARAMETER(x)       ((VOID)(x))
+#define ARGUMENT_PRESENT(x)             ((x) != NULL)
+#define NT_SUCCESS(s)                   (((NTSTATUS)(s)) >= 0)
+#define RTL_CONSTANT_STRING(s)          { sizeof(s) - sizeof((s)[0]), sizeof(s), (PWSTR)(s) }
+#define ALIGN_DOWN_BY(l, a)             ((ULONG_PTR)(l) & ~((ULONG_PTR)(a) - 1))
+#define ALIGN_UP_BY(l, a)               ALIGN_DOWN_BY(((ULONG_PTR)(l) + (a) - 1), a)
+#define BYTES_TO_PAGES(s)               (((s) >> PAGE_SHIFT) + (((s) & (PAGE_SIZE - 1)) != 0))
+#define ROUND_TO_PAGES(s)               (((ULONG_PTR)(s) + PAGE_SIZE - 1) & ~(ULONG_PTR)(PAGE_SIZE - 1))
+#define PAGE_ALIGN(va)                  ((PVOID)((ULONG_PTR)(va) & ~(ULONG_PTR)(PAGE_SIZE - 1)))
+#define BYTE_OFFSET(va)                 ((ULONG)((LONG_PTR)(va) & (PAGE_SIZE - 1)))
+#define ADDRESS_AND_SIZE_TO_SPAN_PAGES(va, s) \
+	((ULONG)((((ULONG_PTR)(va) & (PAGE_SIZE - 1)) + (s) + (PAGE_SIZE - 1)) >> PAGE_SHIFT))
+#ifndef min
+#define min(a, b)                       (((a) < (b)) ? (a) : (b))
+#endif
+#ifndef max
+#define max(a, b)                       (((a) > (b)) ? (a) : (b))
+#endif
+
+#define STATUS_SUCCESS                  ((NTSTATUS)0x00000000L)
+#define STATUS_TIMEOUT                  ((NTSTATUS)0x00000102L)
+#define STATUS_BUFFER_OVERFLOW          ((NTSTATUS)0x80000005L)
+#define STATUS_DEVICE_BUSY              ((NTSTATUS)0x80000011L)
+#define STATUS_NO_MORE_ENTRIES          ((NTSTATUS)0x8000001AL)
+#define STATUS_UNSUCCESSFUL             ((NTSTATUS)0xC0000001L)
+#define STATUS_ACCESS_VIOLATION         ((NTSTATUS)0xC0000005L)
+#define STATUS_INVALID_HANDLE           ((NTSTATUS)0xC0000008L)
+#define STATUS_INVALID_PARAMETER        ((NTSTATUS)0xC000000DL)
+#define STATUS_INVALID_DEVICE_REQUEST   ((NTSTATUS)0xC0000010L)
+#define STATUS_END_OF_FILE              ((NTSTATUS)0xC0000011L)
+#define STATUS_CONFLICTING_ADDRESSES    ((NTSTATUS)0xC0000018L)
+#define STATUS_ILLEGAL_INSTRUCTION      ((NTSTATUS)0xC000001DL)
+#define STATUS_BUFFER_TOO_SMALL         ((NTSTATUS)0xC0000023L)
+#define STATUS_OBJECT_NAME_NOT_FOUND    ((NTSTATUS)0xC0000034L)
+#define STATUS_OBJECT_NAME_COLLISION    ((NTSTATUS)0xC0000035L)
+#define STATUS_DATA_ERROR               ((NTSTATUS)0xC000003EL)
+#define STATUS_REVISION_MISMATCH        ((NTSTATUS)0xC0000059L)
+#define STATUS_INVALID_IMAGE_FORMAT     ((NTSTATUS)0xC000007BL)
+#define STATUS_INSUFFICIENT_RESOURCES   ((NTSTATUS)0xC000009AL)
+#define STATUS_NOT_SUPPORTED            ((NTSTATUS)0xC00000BBL)
+#define STATUS_INVALID_DEVICE_STATE     ((NTSTATUS)0xC0000184L)
+#define STATUS_NOT_FOUND                ((NTSTATUS)0xC0000225L)
+#define STATUS_ALREADY_REGISTERED       ((NTSTATUS)0xC0000718L)
+#define STATUS_HV_INVALID_PARAMETER     ((NTSTATUS)0xC0350005L)
+#define STATUS_HV_ACCESS_DENIED         ((NTSTATUS)0xC0350006L)
+#define STATUS_HV_INVALID_PARTITION_STATE ((NTSTATUS)0xC0350007L)
+#define STATUS_HV_OPERATION_DENIED      ((NTSTATUS)0xC0350008L)
+#define STATUS_HV_INSUFFICIENT_MEMORY   ((NTSTATUS)0xC035000BL)
+#define STATUS_HV_OBJECT_IN_USE         ((NTSTATUS)0xC0350011L)
+#define STATUS_HV_NO_RESOURCES          ((NTSTATUS)0xC035001DL)
+#define STATUS_HV_FEATURE_UNAVAILABLE   ((NTSTATUS)0xC035001EL)
+#define STATUS_HV_INSUFFICIENT_BUFFER   ((NTSTATUS)0xC0350033L)
+#define STATUS_HV_NOT_PRESENT           ((NTSTATUS)0xC0351000L)
+
+#define IRP_MJ_CREATE                   0x00
+#define IRP_MJ_CLOSE                    0x02
+#define IRP_MJ_DEVICE_CONTROL           0x0e
+#define IRP_MJ_CLEANUP                  0x12
+#define IRP_MJ_MAXIMUM_FUNCTION         0x1b
+#define IO_NO_INCREMENT                 0
+#define FILE_DEVICE_UNKNOWN             0x22
+#define FILE_DEVICE_SECURE_OPEN         0x100
+#define DO_DEVICE_INITIALIZING          0x80
+#define METHOD_BUFFERED                 0
+#define FILE_ANY_ACCESS                 0
+#define FILE_READ_DATA                  1
+#define FILE_WRITE_DATA                 2
+#define CTL_CODE(t, f, m, a)            (((t) << 16) | ((a) << 14) | ((f) << 2) | (m))
+
+#define GENERIC_READ                    0x80000000
+#define GENERIC_WRITE                   0x40000000
+#define SYNCHRONIZE                     0x00100000
+#define THREAD_ALL_ACCESS               0x001fffff
+#define SECTION_ALL_ACCESS              0x000f001f
+#define SEC_COMMIT                      0x08000000
+#define ViewUnmap                       2
+#define FILE_ATTRIBUTE_NORMAL           0x80
+#define FILE_SHARE_READ                 0x01
+#define FILE_OPEN                       0x01
+#define FILE_OVERWRITE_IF               0x05
+#define FILE_SYNCHRONOUS_IO_NONALERT    0x20
+#define FILE_NON_DIRECTORY_FILE         0x40
+#define FileStandardInformation         5
+#define OBJ_PERMANENT                   0x10
+#define OBJ_CASE_INSENSITIVE            0x40
+#define OBJ_OPENIF                      0x80
+#define OBJ_KERNEL_HANDLE               0x200
+#define RTL_REGISTRY_ABSOLUTE           0
+#define RTL_QUERY_REGISTRY_DIRECT       0x20
+#define RTL_QUERY_REGISTRY_TYPECHECK    0x100
+#define RTL_QUERY_REGISTRY_TYPECHECK_SHIFT 24
+#define REG_SZ                          1
+#define REG_DWORD                       4
+#define MM_COPY_MEMORY_PHYSICAL         1
+#define EXCEPTION_EXECUTE_HANDLER       1
+
+#define InitializeObjectAttributes(p, n, a, r, s) { \
+	(p)->Length = sizeof(OBJECT_ATTRIBUTES);        \
+	(p)->RootDirectory = r;                         \
+	(p)->Attributes = a;                            \
+	(p)->ObjectName = n;                            \
+	(p)->SecurityDescriptor = s;                    \
+	(p)->SecurityQualityOfService = NULL;           \
+}
+
+//
+// The interlocked routines are the compiler intrinsics, as in the WDK.
+//
+#define InterlockedIncrement            _InterlockedIncrement
+#define InterlockedDecrement            _InterlockedDecrement
+#define InterlockedExchange             _InterlockedExchange
+#define InterlockedExchangeAdd          _InterlockedExchangeAdd
+#define InterlockedCompareExchange      _InterlockedCompareExchange
+#define InterlockedOr                   _InterlockedOr
+#define InterlockedAnd                  _InterlockedAnd
+#define InterlockedCompareExchange8     _InterlockedCompareExchange8
+#define InterlockedCompareExchange16    _InterlockedCompareExchange16
+#define InterlockedIncrement64          _InterlockedIncrement64
+#define InterlockedDecrement64          _InterlockedDecrement64
+#define InterlockedExchange64           _InterlockedExchange64
+#define InterlockedExchangeAdd64        _InterlockedExchangeAdd64
+#define InterlockedCompareExchange64    _InterlockedCompareExchange64
+#define InterlockedOr64                 _InterlockedOr64
+#define InterlockedAnd64                _InterlockedAnd64
+#define InterlockedXor64                _InterlockedXor64
+#define InterlockedExchangePointer      _InterlockedExchangePointer
+#define InterlockedCompareExchangePointer _InterlockedCompareExchangePointer
+#define InterlockedBitTestAndSet        _interlockedbittestandset
+#define InterlockedBitTestAndSet64      _interlockedbittestandset64
+#define InterlockedBitTestAndReset64    _interlockedbittestandreset64
+#define InterlockedAdd64(p, v)          ShvTestInterlockedAdd64((p), (v))
+#define KeMemoryBarrier()               _ReadWriteBarrier()
+#define YieldProcessor                  _mm_pause
+
+//
+// Privileged instructions go to the simulated processor.  Each thread of
+// the harness is an LP with a VMCS of its own.
+//
+#undef __cpuid
+#define __cpuid                         ShvTestCpuid
+#define __readmsr                       ShvTestReadMsr
+#define __writemsr                      ShvTestWriteMsr
+#define __vmx_vmread                    ShvTestVmRead
+#define __vmx_vmwrite                   ShvTestVmWrite
+#define __vmx_invept                    ShvTestInvept
+#define __invlpg                        ShvTestInvlpg
+#define __readcr3                       ShvTestReadCr3
+#define __readcr4                       ShvTestReadCr4
+#define __segmentlimit                  ShvTestSegmentLimit
+
+// ===========================================================================
+//
+// TYPES
+//
+// ===========================================================================
+
+typedef void *PVOID, **PPVOID;
+typedef const void *PCVOID;
+typedef char CHAR, *PCHAR, CCHAR;
+typedef const char *PCSTR;
+typedef unsigned char UCHAR, *PUCHAR, BOOLEAN, *PBOOLEAN, BYTE, UINT8;
+typedef short SHORT;
+typedef unsigned short USHORT, *PUSHORT, UINT16;
+typedef wchar_t WCHAR, *PWCHAR, *PWSTR;
+typedef const wchar_t *PCWSTR;
+typedef int INT, INT32;
+typedef unsigned int UINT32;
+
+//
+// LONG and ULONG are 32 bits on every target, like on Windows.
+//
+#if defined(_MSC_VER)
+typedef long LONG, *PLONG;
+typedef unsigned long ULONG, *PULONG, DWORD;
+#else
+typedef int LONG, *PLONG;
+typedef unsigned int ULONG, *PULONG, DWORD;
+#endif
+
+typedef long long LONG64, *PLONG64, LONGLONG, INT64, LONG_PTR, SSIZE_T;
+typedef unsigned long long ULONG64, *PULONG64, ULONGLONG, *PULONGLONG, UINT64, *PUINT64, DWORD64;
+typedef unsigned long long ULONG_PTR, *PULONG_PTR, SIZE_T, *PSIZE_T, KAFFINITY;
+typedef LONG NTSTATUS, LOGICAL, KPRIORITY;
+typedef ULONG POOL_TYPE, MEMORY_CACHING_TYPE, ACCESS_MASK;
+typedef int KPROCESSOR_MODE, LOCK_OPERATION;
+typedef UCHAR KIRQL, *PKIRQL;
+typedef ULONG_PTR KSPIN_LOCK, *PKSPIN_LOCK;
+typedef PVOID HANDLE, *PHANDLE;
+typedef PVOID POBJECT_TYPE;
+
+typedef union _LARGE_INTEGER {
+	struct {
+		ULONG LowPart;
+		LONG HighPart;
+	};
+	LONGLONG QuadPart;
+} LARGE_INTEGER, *PLARGE_INTEGER, PHYSICAL_ADDRESS, *PPHYSICAL_ADDRESS;
+
+typedef union _ULARGE_INTEGER {
+	struct {
+		ULONG LowPart;
+		ULONG HighPart;
+	};
+	ULONGLONG QuadPart;
+} ULARGE_INTEGER, *PULARGE_INTEGER;
+
+typedef struct _UNICODE_STRING {
+	USHORT Length;
+	USHORT MaximumLength;
+	PWSTR Buffer;
+} UNICODE_STRING, *PUNICODE_STRING;
+typedef const UNICODE_STRING *PCUNICODE_STRING;
+
+typedef struct _GUID {
+	ULONG Data1;
+	USHORT Data2;
+	USHORT Data3;
+	UCHAR Data4[8];
+} GUID;
+
+typedef struct DECLSPEC_ALIGN(16) _M128A {
+	ULONGLONG Low;
+	LONGLONG High;
+} M128A, *PM128A;
+
+typedef struct DECLSPEC_ALIGN(16) _XSAVE_FORMAT {
+	USHORT ControlWord;
+	USHORT StatusWord;
+	UCHAR TagWord;
+	UCHAR Reserved1;
+	USHORT ErrorOpcode;
+	ULONG ErrorOffset;
+	USHORT ErrorSelector;
+	USHORT Reserved2;
+	ULONG DataOffset;
+	USHORT DataSelector;
+	USHORT Reserved3;
+	ULONG MxCsr;
+	ULONG MxCsr_Mask;
+	M128A FloatRegisters[8];
+	M128A XmmRegisters[16];
+	UCHAR Reserved4[96];
+} XSAVE_FORMAT, XMM_SAVE_AREA32;
+
+typedef struct DECLSPEC_ALIGN(16) _CONTEXT {
+	ULONG64 P1Home;
+	ULONG64 P2Home;
+	ULONG64 P3Home;
+	ULONG64 P4Home;
+	ULONG64 P5Home;
+	ULONG64 P6Home;
+	ULONG ContextFlags;
+	ULONG MxCsr;
+	USHORT SegCs;
+	USHORT SegDs;
+	USHORT SegEs;
+	USHORT SegFs;
+	USHORT SegGs;
+	USHORT SegSs;
+	ULONG EFlags;
+	ULONG64 Dr0;
+	ULONG64 Dr1;
+	ULONG64 Dr2;
+	ULONG64 Dr3;
+	ULONG64 Dr6;
+	ULONG64 Dr7;
+	ULONG64 Rax;
+	ULONG64 Rcx;
+	ULONG64 Rdx;
+	ULONG64 Rbx;
+	ULONG64 Rsp;
+	ULONG64 Rbp;
+	ULONG64 Rsi;
+	ULONG64 Rdi;
+	ULONG64 R8;
+	ULONG64 R9;
+	ULONG64 R10;
+	ULONG64 R11;
+	ULONG64 R12;
+	ULONG64 R13;
+	ULONG64 R14;
+	ULONG64 R15;
+	ULONG64 Rip;
+	union {
+		XMM_SAVE_AREA32 FltSave;
+		struct {
+			M128A Header[2];
+			M128A Legacy[8];
+			M128A Xmm0;
+			M128A Xmm1;
+			M128A Xmm2;
+			M128A Xmm3;
+			M128A Xmm4;
+			M128A Xmm5;
+			M128A Xmm6;
+			M128A Xmm7;
+			M128A Xmm8;
+			M128A Xmm9;
+			M128A Xmm10;
+			M128A Xmm11;
+			M128A Xmm12;
+			M128A Xmm13;
+			M128A Xmm14;
+			M128A Xmm15;
+		};
+	};
+	M128A VectorRegister[26];
+	ULONG64 VectorControl;
+	ULONG64 DebugControl;
+	ULONG64 LastBranchToRip;
+	ULONG64 LastBranchFromRip;
+	ULONG64 LastExceptionToRip;
+	ULONG64 LastExceptionFromRip;
+} CONTEXT, *PCONTEXT;
+
+C_ASSERT(sizeof(CONTEXT) == 0x4d0);
+
+struct _EXCEPTION_RECORD;
+
+typedef struct _PHYSICAL_MEMORY_RANGE {
+	PHYSICAL_ADDRESS BaseAddress;
+	LARGE_INTEGER NumberOfBytes;
+} PHYSICAL_MEMORY_RANGE, *PPHYSICAL_MEMORY_RANGE;
+
+typedef struct _PROCESSOR_NUMBER {
+	USHORT Group;
+	UCHAR Number;
+	UCHAR Reserved;
+} PROCESSOR_NUMBER, *PPROCESSOR_NUMBER;
+
+typedef struct _GROUP_AFFINITY {
+	KAFFINITY Mask;
+	USHORT Group;
+	USHORT Reserved[3];
+} GROUP_AFFINITY, *PGROUP_AFFINITY;
+
+typedef struct _SLIST_ENTRY {
+	struct _SLIST_ENTRY *Next;
+} SLIST_ENTRY, *PSLIST_ENTRY;
+
+//
+// The harness keeps the list head in the first half and a lock in the
+// second, which is all it takes to be safe without a 128-bit exchange.
+//
+typedef union DECLSPEC_ALIGN(16) _SLIST_HEADER {
+	struct {
+		ULONGLONG Alignment;
+		ULONGLONG Region;
+	};
+} SLIST_HEADER, *PSLIST_HEADER;
+
+//
+// Dispatcher objects only need to be distinct and large enough to hold
+// what the harness tracks for them.
+//
+typedef struct _KDPC {
+	PVOID DeferredRoutine;
+	PVOID DeferredContext;
+} KDPC, *PKDPC, *PRKDPC;
+
+typedef struct _KTIMER {
+	LONG64 DueTime;
+} KTIMER, *PKTIMER;
+
+typedef struct _KEVENT {
+	volatile LONG State;
+} KEVENT, *PKEVENT;
+
+typedef struct _FAST_MUTEX {
+	volatile LONG64 Owner;
+} FAST_MUTEX, *PFAST_MUTEX;
+
+typedef struct _KAPC_STATE {
+	PVOID Reserved[6];
+} KAPC_STATE, *PKAPC_STATE;
+
+typedef struct _KTHREAD *PKTHREAD;
+typedef struct _ETHREAD *PETHREAD;
+typedef struct _EPROCESS *PEPROCESS;
+
+typedef struct _MDL {
+	struct _MDL *Next;
+	SHORT Size;
+	SHORT MdlFlags;
+	PVOID Process;
+	PVOID MappedSystemVa;
+	PVOID StartVa;
+	ULONG ByteCount;
+	ULONG ByteOffset;
+} MDL, *PMDL;
+
+typedef struct _IO_STATUS_BLOCK {
+	union {
+		NTSTATUS Status;
+		PVOID Pointer;
+	};
+	ULONG_PTR Information;
+} IO_STATUS_BLOCK, *PIO_STATUS_BLOCK;
+
+typedef struct _DEVICE_OBJECT {
+	ULONG Flags;
+} DEVICE_OBJECT, *PDEVICE_OBJECT;
+
+typedef struct _FILE_OBJECT {
+	PVOID FsContext;
+} FILE_OBJECT, *PFILE_OBJECT;
+
+typedef struct _IRP {
+	struct {
+		PVOID SystemBuffer;
+	} AssociatedIrp;
+	IO_STATUS_BLOCK IoStatus;
+	CHAR RequestorMode;
+} IRP, *PIRP;
+
+typedef struct _IO_STACK_LOCATION {
+	UCHAR MajorFunction;
+	union {
+		struct {
+			ULONG OutputBufferLength;
+			ULONG InputBufferLength;
+			ULONG IoControlCode;
+			PVOID Type3InputBuffer;
+		} DeviceIoControl;
+	} Parameters;
+	PFILE_OBJECT FileObject;
+} IO_STACK_LOCATION, *PIO_STACK_LOCATION;
+
+typedef NTSTATUS DRIVER_DISPATCH(PDEVICE_OBJECT DeviceObject, PIRP Irp);
+typedef DRIVER_DISPATCH *PDRIVER_DISPATCH;
+
+typedef struct _DRIVER_OBJECT {
+	PVOID DriverUnload;
+	PDRIVER_DISPATCH MajorFunction[IRP_MJ_MAXIMUM_FUNCTION + 1];
+} DRIVER_OBJECT, *PDRIVER_OBJECT;
+
+typedef struct _OBJECT_ATTRIBUTES {
+	ULONG Length;
+	HANDLE RootDirectory;
+	PUNICODE_STRING ObjectName;
+	ULONG Attributes;
+	PVOID SecurityDescriptor;
+	PVOID SecurityQualityOfService;
+} OBJECT_ATTRIBUTES, *POBJECT_ATTRIBUTES;
+
+typedef struct _FILE_STANDARD_INFORMATION {
+	LARGE_INTEGER AllocationSize;
+	LARGE_INTEGER EndOfFile;
+	ULONG NumberOfLinks;
+	BOOLEAN DeletePending;
+	BOOLEAN Directory;
+} FILE_STANDARD_INFORMATION, *PFILE_STANDARD_INFORMATION;
+
+typedef struct _RTL_QUERY_REGISTRY_TABLE {
+	PVOID QueryRoutine;
+	ULONG Flags;
+	PWSTR Name;
+	PVOID EntryContext;
+	ULONG DefaultType;
+	PVOID DefaultData;
+	ULONG DefaultLength;
+} RTL_QUERY_REGISTRY_TABLE, *PRTL_QUERY_REGISTRY_TABLE;
+
+typedef struct _RTL_BITMAP {
+	ULONG SizeOfBitMap;
+	PULONG Buffer;
+} RTL_BITMAP, *PRTL_BITMAP;
+
+typedef struct _MM_COPY_ADDRESS {
+	union {
+		PVOID VirtualAddress;
+		PHYSICAL_ADDRESS PhysicalAddress;
+	};
+} MM_COPY_ADDRESS;
+
+typedef enum _IO_NOTIFICATION_EVENT_CATEGORY {
+	EventCategoryReserved,
+	EventCategoryHardwareProfileChange,
+	EventCategoryDeviceInterfaceChange,
+} IO_NOTIFICATION_EVENT_CATEGORY;
+
+typedef VOID KDEFERRED_ROUTINE(PKDPC Dpc, PVOID DeferredContext, PVOID SystemArgument1, PVOID SystemArgument2);
+typedef KDEFERRED_ROUTINE *PKDEFERRED_ROUTINE;
+typedef ULONG_PTR KIPI_BROADCAST_WORKER(ULONG_PTR Argument);
+typedef KIPI_BROADCAST_WORKER *PKIPI_BROADCAST_WORKER;
+typedef BOOLEAN NMI_CALLBACK(PVOID Context, BOOLEAN Handled);
+typedef NMI_CALLBACK *PNMI_CALLBACK;
+typedef VOID KSTART_ROUTINE(PVOID StartContext);
+typedef KSTART_ROUTINE *PKSTART_ROUTINE;
+typedef NTSTATUS DRIVER_INITIALIZE(PDRIVER_OBJECT DriverObject, PUNICODE_STRING RegistryPath);
+typedef VOID DRIVER_UNLOAD(PDRIVER_OBJECT DriverObject);
+typedef NTSTATUS DRIVER_NOTIFICATION_CALLBACK_ROUTINE(PVOID NotificationStructure, PVOID Context);
+typedef VOID CREATE_PROCESS_NOTIFY_ROUTINE(HANDLE ParentId, HANDLE ProcessId, BOOLEAN Create);
+typedef CREATE_PROCESS_NOTIFY_ROUTINE *PCREATE_PROCESS_NOTIFY_ROUTINE;
+
+// ===========================================================================
+//
+// SIMULATED PROCESSOR
+//
+// ===========================================================================
+
+VOID
+ShvTestCpuid(
+	_Out_ INT CpuInfo[4],
+	_In_ INT Leaf
+);
+
+ULONG64
+ShvTestReadMsr(
+	_In_ ULONG Msr
+);
+
+VOID
+ShvTestWriteMsr(
+	_In_ ULONG Msr,
+	_In_ ULONG64 Value
+);
+
+UCHAR
+ShvTestVmRead(
+	_In_ SIZE_T Field,
+	_Out_ PSIZE_T Value
+);
+
+UCHAR
+ShvTestVmWrite(
+	_In_ SIZE_T Field,
+	_In_ SIZE_T Value
+);
+
+UCHAR
+ShvTestInvept(
+	_In_ ULONG Type,
+	_In_ PVOID Descriptor
+);
+
+VOID
+ShvTestInvlpg(
+	_In_ PVOID Address
+);
+
+ULONG64
+ShvTestReadCr3(
+	VOID
+);
+
+ULONG64
+ShvTestReadCr4(
+	VOID
+);
+
+ULONG
+ShvTestSegmentLimit(
+	_In_ ULONG Selector
+);
+
+VOID
+ShvTestAssertFailed(
+	_In_ PCSTR File,
+	_In_ ULONG Line,
+	_In_ PCSTR Expression
+);
+
+//
+// NT_VERIFY is used both as a statement and as a condition, so its result
+// goes through a function to be ignored without a warning.
+//
+static __inline BOOLEAN
+ShvTestVerify(
+	_In_ BOOLEAN Value
+)
+{
+	return Value;
+}
+
+static __inline LONG64
+ShvTestInterlockedAdd64(
+	_Inout_ volatile LONG64 *Addend,
+	_In_ LONG64 Value
+)
+{
+	return _InterlockedExchangeAdd64(Addend, Value) + Value;
+}
+
+// ===========================================================================
+//
+// KERNEL ROUTINES
+//
+// ===========================================================================
+
+ULONG
+DbgPrintEx(
+	_In_ ULONG ComponentId,
+	_In_ ULONG Level,
+	_In_ PCSTR Format,
+	...
+);
+
+PVOID
+ExAllocatePoolWithTag(
+	_In_ POOL_TYPE PoolType,
+	_In_ SIZE_T NumberOfBytes,
+	_In_ ULONG Tag
+);
+
+VOID
+ExFreePoolWithTag(
+	_In_ PVOID P,
+	_In_ ULONG Tag
+);
+
+VOID
+ExFreePool(
+	_In_ PVOID P
+);
+
+VOID
+ExInitializeFastMutex(
+	_Out_ PFAST_MUTEX FastMutex
+);
+
+VOID
+ExAcquireFastMutex(
+	_Inout_ PFAST_MUTEX FastMutex
+);
+
+VOID
+ExReleaseFastMutex(
+	_Inout_ PFAST_MUTEX FastMutex
+);
+
+VOID
+InitializeSListHead(
+	_Out_ PSLIST_HEADER SListHead
+);
+
+PSLIST_ENTRY
+InterlockedPushEntrySList(
+	_Inout_ PSLIST_HEADER ListHead,
+	_Inout_ PSLIST_ENTRY ListEntry
+);
+
+PSLIST_ENTRY
+InterlockedPopEntrySList(
+	_Inout_ PSLIST_HEADER ListHead
+);
+
+USHORT
+QueryDepthSList(
+	_In_ PSLIST_HEADER SListHead
+);
+
+VOID
+KeInitializeSpinLock(
+	_Out_ PKSPIN_LOCK SpinLock
+);
+
+VOID
+KeAcquireSpinLock(
+	_Inout_ PKSPIN_LOCK SpinLock,
+	_Out_ PKIRQL OldIrql
+);
+
+VOID
+KeReleaseSpinLock(
+	_Inout_ PKSPIN_LOCK SpinLock,
+	_In_ KIRQL NewIrql
+);
+
+VOID
+KeAcquireSpinLockAtDpcLevel(
+	_Inout_ PKSPIN_LOCK SpinLock
+);
+
+BOOLEAN
+KeTryToAcquireSpinLockAtDpcLevel(
+	_Inout_ PKSPIN_LOCK SpinLock
+);
+
+VOID
+KeReleaseSpinLockFromDpcLevel(
+	_Inout_ PKSPIN_LOCK SpinLock
+);
+
+KIRQL
+KeGetCurrentIrql(
+	VOID
+);
+
+VOID
+KeRaiseIrql(
+	_In_ KIRQL NewIrql,
+	_Out_ PKIRQL OldIrql
+);
+
+VOID
+KeLowerIrql(
+	_In_ KIRQL NewIrql
+);
+
+ULONG
+KeGetCurrentProcessorNumberEx(
+	_Out_opt_ PPROCESSOR_NUMBER ProcNumber
+);
+
+ULONG
+KeGetCurrentProcessorIndex(
+	VOID
+);
+
+ULONG
+KeQueryActiveProcessorCountEx(
+	_In_ USHORT GroupNumber
+);
+
+USHORT
+KeGetCurrentNodeNumber(
+	VOID
+);
+
+USHORT
+KeQueryHighestNodeNumber(
+	VOID
+);
+
+ULONG_PTR
+KeIpiGenericCall(
+	_In_ PKIPI_BROADCAST_WORKER BroadcastFunction,
+	_In_ ULONG_PTR Context
+);
+
+LARGE_INTEGER
+KeQueryPerformanceCounter(
+	_Out_opt_ PLARGE_INTEGER PerformanceFrequency
+);
+
+VOID
+KeInitializeDpc(
+	_Out_ PRKDPC Dpc,
+	_In_ PKDEFERRED_ROUTINE DeferredRoutine,
+	_In_opt_ PVOID DeferredContext
+);
+
+VOID
+KeInitializeTimer(
+	_Out_ PKTIMER Timer
+);
+
+BOOLEAN
+KeSetTimerEx(
+	_Inout_ PKTIMER Timer,
+	_In_ LARGE_INTEGER DueTime,
+	_In_ LONG Period,
+	_In_opt_ PKDPC Dpc
+);
+
+BOOLEAN
+KeCancelTimer(
+	_Inout_ PKTIMER Timer
+);
+
+VOID
+KeFlushQueuedDpcs(
+	VOID
+);
+
+PVOID
+KeRegisterNmiCallback(
+	_In_ PNMI_CALLBACK CallbackRoutine,
+	_In_opt_ PVOID Context
+);
+
+NTSTATUS
+KeDeregisterNmiCallback(
+	_In_ PVOID Handle
+);
+
+VOID
+KeInitializeEvent(
+	_Out_ PKEVENT Event,
+	_In_ ULONG Type,
+	_In_ BOOLEAN State
+);
+
+LONG
+KeSetEvent(
+	_Inout_ PKEVENT Event,
+	_In_ KPRIORITY Increment,
+	_In_ BOOLEAN Wait
+);
+
+VOID
+KeClearEvent(
+	_Inout_ PKEVENT Event
+);
+
+NTSTATUS
+KeWaitForSingleObject(
+	_In_ PVOID Object,
+	_In_ ULONG WaitReason,
+	_In_ KPROCESSOR_MODE WaitMode,
+	_In_ BOOLEAN Alertable,
+	_In_opt_ PLARGE_INTEGER Timeout
+);
+
+NTSTATUS
+KeDelayExecutionThread(
+	_In_ KPROCESSOR_MODE WaitMode,
+	_In_ BOOLEAN Alertable,
+	_In_ PLARGE_INTEGER Interval
+);
+
+PVOID
+MmAllocateContiguousMemorySpecifyCache(
+	_In_ SIZE_T NumberOfBytes,
+	_In_ PHYSICAL_ADDRESS LowestAcceptableAddress,
+	_In_ PHYSICAL_ADDRESS HighestAcceptableAddress,
+	_In_opt_ PHYSICAL_ADDRESS BoundaryAddressMultiple,
+	_In_ MEMORY_CACHING_TYPE CacheType
+);
+
+PVOID
+MmAllocateContiguousNodeMemory(
+	_In_ SIZE_T NumberOfBytes,
+	_In_ PHYSICAL_ADDRESS LowestAcceptableAddress,
+	_In_ PHYSICAL_ADDRESS HighestAcceptableAddress,
+	_In_opt_ PHYSICAL_ADDRESS BoundaryAddressMultiple,
+	_In_ ULONG Protect,
+	_In_ ULONG PreferredNode
+);
+
+VOID
+MmFreeContiguousMemory(
+	_In_ PVOID BaseAddress
+);
+
+PHYSICAL_ADDRESS
+MmGetPhysicalAddress(
+	_In_ PVOID BaseAddress
+);
+
+PVOID
+MmGetVirtualForPhysical(
+	_In_ PHYSICAL_ADDRESS PhysicalAddress
+);
+
+PPHYSICAL_MEMORY_RANGE
+MmGetPhysicalMemoryRanges(
+	VOID
+);
+
+PVOID
+MmMapIoSpace(
+	_In_ PHYSICAL_ADDRESS PhysicalAddress,
+	_In_ SIZE_T NumberOfBytes,
+	_In_ MEMORY_CACHING_TYPE CacheType
+);
+
+VOID
+MmUnmapIoSpace(
+	_In_ PVOID BaseAddress,
+	_In_ SIZE_T NumberOfBytes
+);
+
+PVOID
+MmAllocateMappingAddress(
+	_In_ SIZE_T NumberOfBytes,
+	_In_ ULONG PoolTag
+);
+
+VOID
+MmFreeMappingAddress(
+	_In_ PVOID BaseAddress,
+	_In_ ULONG PoolTag
+);
+
+NTSTATUS
+MmCopyMemory(
+	_In_ PVOID TargetAddress,
+	_In_ MM_COPY_ADDRESS SourceAddress,
+	_In_ SIZE_T NumberOfBytes,
+	_In_ ULONG Flags,
+	_Out_ PSIZE_T NumberOfBytesTransferred
+);
+
+PVOID
+MmGetSystemRoutineAddress(
+	_In_ PUNICODE_STRING SystemRoutineName
+);
+
+NTSTATUS
+IoRegisterPlugPlayNotification(
+	_In_ IO_NOTIFICATION_EVENT_CATEGORY EventCategory,
+	_In_ ULONG EventCategoryFlags,
+	_In_opt_ PVOID EventCategoryData,
+	_In_ PDRIVER_OBJECT DriverObject,
+	_In_ DRIVER_NOTIFICATION_CALLBACK_ROUTINE *CallbackRoutine,
+	_Inout_opt_ PVOID Context,
+	_Out_ PVOID *NotificationEntry
+);
+
+NTSTATUS
+IoUnregisterPlugPlayNotificationEx(
+	_In_ PVOID NotificationEntry
+);
+
+extern POBJECT_TYPE *PsThreadType;
+
+NTSTATUS
+ObReferenceObjectByHandle(
+	_In_ HANDLE Handle,
+	_In_ ACCESS_MASK DesiredAccess,
+	_In_opt_ POBJECT_TYPE ObjectType,
+	_In_ KPROCESSOR_MODE AccessMode,
+	_Out_ PVOID *Object,
+	_Out_opt_ PVOID HandleInformation
+);
+
+VOID
+ObDereferenceObject(
+	_In_ PVOID Object
+);
+
+NTSTATUS
+PsCreateSystemThread(
+	_Out_ PHANDLE ThreadHandle,
+	_In_ ULONG DesiredAccess,
+	_In_opt_ POBJECT_ATTRIBUTES ObjectAttributes,
+	_In_opt_ HANDLE ProcessHandle,
+	_Out_opt_ PVOID ClientId,
+	_In_ PKSTART_ROUTINE StartRoutine,
+	_In_opt_ PVOID StartContext
+);
+
+NTSTATUS
+PsTerminateSystemThread(
+	_In_ NTSTATUS ExitStatus
+);
+
+BOOLEAN
+RtlIsNtDdiVersionAvailable(
+	_In_ ULONG Version
+);
+
+VOID
+RtlInitUnicodeString(
+	_Out_ PUNICODE_STRING DestinationString,
+	_In_opt_ PCWSTR SourceString
+);
+
+SIZE_T
+RtlCompareMemory(
+	_In_ const VOID *Source1,
+	_In_ const VOID *Source2,
+	_In_ SIZE_T Length
+);
+
+ULONG
+RtlRandomEx(
+	_Inout_ PULONG Seed
+);
+
+NTSTATUS
+ZwCreateFile(
+	_Out_ PHANDLE FileHandle,
+	_In_ ACCESS_MASK DesiredAccess,
+	_In_ POBJECT_ATTRIBUTES ObjectAttributes,
+	_Out_ PIO_STATUS_BLOCK IoStatusBlock,
+	_In_opt_ PLARGE_INTEGER AllocationSize,
+	_In_ ULONG FileAttributes,
+	_In_ ULONG ShareAccess,
+	_In_ ULONG CreateDisposition,
+	_In_ ULONG CreateOptions,
+	_In_opt_ PVOID EaBuffer,
+	_In_ ULONG EaLength
+);
+
+NTSTATUS
+ZwQueryInformationFile(
+	_In_ HANDLE FileHandle,
+	_Out_ PIO_STATUS_BLOCK IoStatusBlock,
+	_Out_ PVOID FileInformation,
+	_In_ ULONG Length,
+	_In_ INT FileInformationClass
+);
+
+NTSTATUS
+ZwReadFile(
+	_In_ HANDLE FileHandle,
+	_In_opt_ HANDLE Event,
+	_In_opt_ PVOID ApcRoutine,
+	_In_opt_ PVOID ApcContext,
+	_Out_ PIO_STATUS_BLOCK IoStatusBlock,
+	_Out_ PVOID Buffer,
+	_In_ ULONG Length,
+	_In_opt_ PLARGE_INTEGER ByteOffset,
+	_In_opt_ PULONG Key
+);
+
+NTSTATUS
+ZwWriteFile(
+	_In_ HANDLE FileHandle,
+	_In_opt_ HANDLE Event,
+	_In_opt_ PVOID ApcRoutine,
+	_In_opt_ PVOID ApcContext,
+	_Out_ PIO_STATUS_BLOCK IoStatusBlock,
+	_In_ PVOID Buffer,
+	_In_ ULONG Length,
+	_In_opt_ PLARGE_INTEGER ByteOffset,
+	_In_opt_ PULONG Key
+);
+
+NTSTATUS
+ZwClose(
+	_In_ HANDLE Handle
+);
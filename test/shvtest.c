@@ -0,0 +1,241 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvtest.c
+
+Abstract:
+
+	This module implements the entry point of the test harness, which runs
+	the tests and benchmarks named on its command line, or every test if
+	none are named.
+
+Author:
+
+	agent (@agent) 16-Oct-2026 - Initial version
+
+Environment:
+
+	User mode only.
+
+--*/
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <stdlib.h>
+#include "shvtest.h"
+
+// ===========================================================================
+//
+// LOCAL DATA
+//
+// ===========================================================================
+
+BOOLEAN ShvTestVerbose = FALSE;
+
+static volatile LONG ShvTestFailures = 0;
+
+//
+// Benchmarks only run when they are named, since they take a while and
+// print timings rather than pass or fail.
+//
+static const SHV_TEST ShvTests[] = {
+	{ "largepages", "Identity map leaves are as large as the memory allows", ShvTestLargePages, FALSE },
+	{ "largepages-bench", "Identity map build time, size and walk latency by page size", ShvTestLargePagesBenchmark, TRUE },
+	{ "mtrr", "Synthetic MTRR sets compile to the types, ranges and large pages they call for", ShvTestMtrr, FALSE },
+	{ "maprange", "Ranges map with the largest leaves they allow, and only once", ShvTestMapRange, FALSE },
+	{ "maprange-bench", "Identity map build time up to 8 TiB, and range against page mapping", ShvTestMapRangeBenchmark, TRUE },
+	{ "arena", "Racing arena growth publishes each chunk once, and every table translates both ways", ShvTestArena, FALSE },
+	{ "arena-bench", "PFN to VA translation time by chunk count, indexed against scanned", ShvTestArenaBenchmark, TRUE },
+	{ "violations", "Racing MMIO violations build the same hierarchy as one VP", ShvTestViolations, FALSE },
+	{ "violations-bench", "MMIO violation scaling with compare and swap against a global lock", ShvTestViolationsBenchmark, TRUE },
+	{ "flush", "EPT changes flush only where needed, and every VP catches up once", ShvTestFlush, FALSE },
+	{ "demand", "Violations map the largest region their types allow, and complete tables are promoted", ShvTestDemand, FALSE },
+	{ "parallelbuild", "Building the identity map on every LP gives the same map as on one", ShvTestParallelBuild, FALSE },
+	{ "parallelbuild-bench", "Identity map build time by LP count", ShvTestParallelBuildBenchmark, TRUE },
+	{ "workingset", "Sweeps count the pages touched since the last one at every page size", ShvTestWorkingSet, FALSE },
+	{ "pml", "Logged writes, large pages included, drain and collect into the dirty bitmap once", ShvTestDirtyPages, FALSE },
+	{ "views", "Views share the tables they don't change, and each change stays in its own view", ShvTestViews, FALSE },
+	{ "ve", "Violations are only reported to the guest as #VE on the ranges asked for", ShvTestVirtualizationExceptions, FALSE },
+	{ "inspect", "The inspector counts tables, leaves, collapsible tables and violations", ShvTestInspect, FALSE },
+	{ "inspect-bench", "Identity map memory by RAM, page size and LPs, and the cost of inspecting it", ShvTestInspectBenchmark, TRUE },
+	{ "image", "EPT images round trip, and damaged or stale ones are rejected", ShvTestImageRoundTrip, FALSE },
+	{ "warmstart", "The identity map loads from its saved image, and only when it is valid", ShvTestWarmStart, FALSE },
+	{ "warmstart-bench", "Identity map load time from an image against the cold build", ShvTestWarmStartBenchmark, TRUE },
+	{ "replication", "Each node walks its own replica, and violations keep them all the same", ShvTestReplication, FALSE },
+	{ "replication-bench", "Page walk latency by node count with and without replicas", ShvTestReplicationBenchmark, TRUE },
+	{ "translate", "Software TLB hits are only used while every guest entry of the walk is unchanged", ShvTestGuestTlb, FALSE },
+	{ "memmap", "The memory map index covers everything, and hot-added RAM is mapped right away", ShvTestMemMap, FALSE },
+	{ "merge", "Identical pages share a frame, and a write gives the page its own back once no VP can read the shared one", ShvTestMergePages, FALSE },
+	{ "hook", "Hooked pages execute their patches and read their originals, and a read or write is stepped in another view", ShvTestInlineHooks, FALSE },
+	{ "watch", "Watched pages log the accesses that hit a watch, and let every access through", ShvTestWatchFilter, FALSE },
+	{ "watch-bench", "Fault to resume time for unwatched bytes of watched pages", ShvTestWatchFilterBenchmark, TRUE },
+	{ "decode", "The store decoder agrees with objdump on every instruction of the corpus", ShvTestDecode, FALSE },
+	{ "decode-bench", "Time to decode, prepare and carry out each kind of store in one exit", ShvTestDecodeBenchmark, TRUE },
+	{ "cover", "Coverage only arms and claims the pages nobody else protects or remaps, and only disarms its own", ShvTestArmCoverage, FALSE },
+	{ "sampler", "NUMA rounds only arm and claim the pages nobody else protects or remaps, and report pages touched remotely", ShvTestRemoteSampling, FALSE },
+};
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+int
+main(
+	_In_ int argc,
+	_In_reads_(argc) char **argv
+)
+{
+	ULONG failures, ran;
+	BOOLEAN named;
+
+	named = FALSE;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-v") == 0)
+		{
+			ShvTestVerbose = TRUE;
+		}
+		else if ((strcmp(argv[i], "-l") == 0) || (strcmp(argv[i], "-h") == 0))
+		{
+			printf("usage: shvtest [-v] [test...]\n\n");
+
+			for (ULONG j = 0; j < RTL_NUMBER_OF(ShvTests); j++)
+			{
+				printf("  %-20s %s%s\n",
+					ShvTests[j].Name,
+					ShvTests[j].Description,
+					ShvTests[j].Benchmark ? " (benchmark)" : "");
+			}
+
+			return 0;
+		}
+		else
+		{
+			named = TRUE;
+		}
+	}
+
+	failures = 0;
+	ran = 0;
+
+	for (ULONG j = 0; j < RTL_NUMBER_OF(ShvTests); j++)
+	{
+		BOOLEAN run;
+
+		run = !named && !ShvTests[j].Benchmark;
+
+		for (int i = 1; i < argc && !run; i++)
+		{
+			run = (strcmp(argv[i], ShvTests[j].Name) == 0);
+		}
+
+		if (!run)
+		{
+			continue;
+		}
+
+		//
+		// Every test starts out with the default machine.
+		//
+		ShvTestResetMachine();
+		ShvTestFailures = 0;
+
+		printf("[ RUN  ] %s\n", ShvTests[j].Name);
+		ShvTests[j].Routine();
+		printf("[ %s ] %s\n", (ShvTestFailures == 0) ? " OK " : "FAIL", ShvTests[j].Name);
+
+		failures += (ShvTestFailures != 0);
+		ran++;
+	}
+
+	if (ran == 0)
+	{
+		printf("No such test; -l lists them\n");
+		return 2;
+	}
+
+	printf("%u of %u failed\n", failures, ran);
+
+	return (failures == 0) ? 0 : 1;
+}
+
+ULONG64
+ShvTestNow(
+	VOID
+)
+{
+	return ShvTestPlatNanoseconds();
+}
+
+ULONG64
+ShvTestRandom(
+	_Inout_ PULONG64 State
+)
+{
+	ULONG64 x;
+
+	//
+	// xorshift64*, which is plenty for picking addresses, and gives every
+	// run the same sequence.
+	//
+	x = *State;
+	x ^= x >> 12;
+	x ^= x << 25;
+	x ^= x >> 27;
+	*State = x;
+
+	return x * 0x2545f4914f6cdd1dULL;
+}
+
+VOID
+ShvTestPrint(
+	_In_ PCSTR Format,
+	...
+)
+{
+	va_list arguments;
+
+	printf("         ");
+
+	va_start(arguments, Format);
+	vprintf(Format, arguments);
+	va_end(arguments);
+
+	fflush(stdout);
+}
+
+VOID
+ShvTestFailed(
+	_In_ PCSTR File,
+	_In_ ULONG Line,
+	_In_ PCSTR Expression
+)
+{
+	printf("%s(%u): check failed: %s\n", File, Line, Expression);
+
+	InterlockedIncrement(&ShvTestFailures);
+}
+
+VOID
+ShvTestAssertFailed(
+	_In_ PCSTR File,
+	_In_ ULONG Line,
+	_In_ PCSTR Expression
+)
+{
+	//
+	// An assertion in a module is as good as a crash, so there is no point
+	// in going on.
+	//
+	printf("%s(%u): assertion failed: %s\n", File, Line, Expression);
+	fflush(stdout);
+
+	abort();
+}
@@ -0,0 +1,604 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Header Name:
+
+	shvtest.h
+
+Abstract:
+
+	This header defines the user-mode test harness.  The harness links the
+	hypervisor modules against a simulated machine: a physical memory map,
+	MSRs, LPs spread over NUMA nodes, and a VMCS for each of them, so that
+	they can be tested and benchmarked without loading the driver.
+
+Author:
+
+	agent (@agent) 16-Oct-2026 - Initial version
+
+Environment:
+
+	User mode only.
+
+--*/
+
+#pragma once
+#include "../shv.h"
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// The most LPs, NUMA nodes and physical memory ranges the simulated machine
+// can have.
+//
+#define SHV_TEST_MAX_PROCESSORS         (64)
+#define SHV_TEST_MAX_NODES              (8)
+#define SHV_TEST_MAX_RANGES             (32)
+
+//
+// The EPT capabilities of a processor with and without large pages.  The
+// default machine has every capability the modules use.
+//
+#define SHV_TEST_EPT_CAPS_4KB           (VMX_EPT_CAP_EXECUTE_ONLY | \
+                                         VMX_EPT_CAP_PAGE_WALK_4 | \
+                                         VMX_EPT_CAP_MEMORY_TYPE_UC | \
+                                         VMX_EPT_CAP_MEMORY_TYPE_WB | \
+                                         VMX_EPT_CAP_INVEPT | \
+                                         VMX_EPT_CAP_INVEPT_SINGLE_CONTEXT | \
+                                         VMX_EPT_CAP_INVEPT_ALL_CONTEXT)
+#define SHV_TEST_EPT_CAPS_2MB           (SHV_TEST_EPT_CAPS_4KB | VMX_EPT_CAP_PDE_2MB)
+#define SHV_TEST_EPT_CAPS_1GB           (SHV_TEST_EPT_CAPS_2MB | VMX_EPT_CAP_PDPTE_1GB)
+
+#define SHV_TEST_GB                     (1024ULL * 1024 * 1024)
+
+//
+// Record a failed expectation, and keep going so that one run reports
+// every failure of a test.
+//
+#define SHV_TEST_CHECK(e) \
+	((e) ? TRUE : (ShvTestFailed(__FILE__, __LINE__, #e), FALSE))
+
+//
+// Check that a call returned STATUS_SUCCESS.
+//
+#define SHV_TEST_CHECK_SUCCESS(e) \
+	SHV_TEST_CHECK((e) == STATUS_SUCCESS)
+
+// ===========================================================================
+//
+// STRUCTURES
+//
+// ===========================================================================
+
+//
+// A test or benchmark, run by name from the command line.
+//
+typedef VOID SHV_TEST_ROUTINE(VOID);
+typedef SHV_TEST_ROUTINE *PSHV_TEST_ROUTINE;
+
+typedef struct _SHV_TEST {
+	PCSTR Name;
+	PCSTR Description;
+	PSHV_TEST_ROUTINE Routine;
+	BOOLEAN Benchmark;
+} SHV_TEST, *PSHV_TEST;
+
+//
+// Work for ShvTestRunOnProcessors, which runs on every simulated LP at
+// once.
+//
+typedef VOID SHV_TEST_WORKER(_In_ ULONG Processor, _In_opt_ PVOID Context);
+typedef SHV_TEST_WORKER *PSHV_TEST_WORKER;
+
+// ===========================================================================
+//
+// PUBLIC PROTOTYPES
+//
+// ===========================================================================
+
+//
+// The simulated machine.
+//
+VOID
+ShvTestResetMachine(
+	VOID
+);
+
+VOID
+ShvTestSetProcessors(
+	_In_ ULONG Count,
+	_In_ ULONG Nodes
+);
+
+VOID
+ShvTestSetMemoryMap(
+	_In_reads_(Count) const PHYSICAL_MEMORY_RANGE *Ranges,
+	_In_ ULONG Count
+);
+
+VOID
+ShvTestSetTypicalMemoryMap(
+	_In_ ULONG64 RamBytes
+);
+
+VOID
+ShvTestSetMsr(
+	_In_ ULONG Msr,
+	_In_ ULONG64 Value
+);
+
+VOID
+ShvTestSetCurrentProcessor(
+	_In_ ULONG Processor
+);
+
+VOID
+ShvTestRunOnProcessors(
+	_In_ ULONG Count,
+	_In_ PSHV_TEST_WORKER Worker,
+	_In_opt_ PVOID Context
+);
+
+ULONG64
+ShvTestCountInvept(
+	_In_ ULONG Processor
+);
+
+VOID
+ShvTestDeleteFiles(
+	VOID
+);
+
+//
+// Bringing the memory map and the identity map up the way the driver does.
+//
+NTSTATUS
+ShvTestStartEpt(
+	VOID
+);
+
+VOID
+ShvTestStopEpt(
+	VOID
+);
+
+VOID
+ShvTestResetEpt(
+	VOID
+);
+
+VOID
+ShvTestConfigureEpt(
+	_In_ BOOLEAN DemandPopulate,
+	_In_ BOOLEAN WarmStart,
+	_In_ BOOLEAN Replicate
+);
+
+VOID
+ShvTestTrackEptWorkingSet(
+	_In_ BOOLEAN Track
+);
+
+VOID
+ShvTestRequestEptVe(
+	_In_ BOOLEAN Request
+);
+
+NTSTATUS
+ShvTestReserveEpt(
+	_In_ ULONG Pages
+);
+
+VOID
+ShvTestQueryEptArena(
+	_Out_ PULONG64 TablesInUse,
+	_Out_ PULONG Exhausted
+);
+
+ULONG
+ShvTestCountEptChunks(
+	VOID
+);
+
+ULONG
+ShvTestCheckEptArena(
+	VOID
+);
+
+VOID
+ShvTestSampleEptPfns(
+	_Out_writes_(Count) PULONG64 Pfns,
+	_In_ ULONG Count,
+	_Inout_ PULONG64 State
+);
+
+ULONG64
+ShvTestTranslateEptPfns(
+	_In_reads_(Count) const ULONG64 *Pfns,
+	_In_ ULONG Count,
+	_In_ BOOLEAN Scan
+);
+
+NTSTATUS
+ShvTestWriteEptImage(
+	_Outptr_ PVOID *Image,
+	_Out_ PSIZE_T Size
+);
+
+ULONG64
+ShvTestCountEptTablesOffNode(
+	_In_ ULONG Node
+);
+
+ULONG64
+ShvTestMakeEptLeaf(
+	_In_ ULONG Level,
+	_In_ ULONG64 Gpa,
+	_In_ ULONG Access
+);
+
+ULONG
+ShvTestClassifyEptChange(
+	_In_ ULONG64 Old,
+	_In_ ULONG64 New,
+	_In_ ULONG Level
+);
+
+VOID
+ShvTestCommitEptChange(
+	_In_ ULONG Flush
+);
+
+LONG64
+ShvTestGetEptGeneration(
+	VOID
+);
+
+PVOID
+ShvTestRetireEptTable(
+	VOID
+);
+
+ULONG
+ShvTestReclaimEptTables(
+	VOID
+);
+
+ULONG64
+ShvTestLookupEptView(
+	_In_ ULONG View,
+	_In_ ULONG64 Gpa,
+	_Out_ PULONG Level
+);
+
+ULONG64
+ShvTestGetEptViewEptp(
+	_In_ ULONG View
+);
+
+VOID
+ShvTestAccessEpt(
+	_In_ ULONG64 Gpa,
+	_In_ BOOLEAN Write
+);
+
+BOOLEAN
+ShvTestScanEptWorkingSet(
+	VOID
+);
+
+VOID
+ShvTestSetEptDirty(
+	_In_ ULONG64 Gpa
+);
+
+BOOLEAN
+ShvTestIsEptDirty(
+	_In_ ULONG64 Gpa
+);
+
+NTSTATUS
+ShvTestReadEptImageFile(
+	_Outptr_ PVOID *Image,
+	_Out_ PSIZE_T Size
+);
+
+NTSTATUS
+ShvTestWriteEptImageFile(
+	_In_reads_bytes_(Size) const VOID *Image,
+	_In_ SIZE_T Size
+);
+
+//
+// Bringing PML up after the EPT, and what the processor does with its log.
+//
+NTSTATUS
+ShvTestStartPml(
+	VOID
+);
+
+VOID
+ShvTestStopPml(
+	VOID
+);
+
+ULONG
+ShvTestLogPml(
+	_In_reads_(Count) const ULONG64 *Gpas,
+	_In_ ULONG Count
+);
+
+VOID
+ShvTestDrainPml(
+	VOID
+);
+
+//
+// Bringing watchpoints up after the EPT, and the memory of the guest.
+//
+NTSTATUS
+ShvTestStartWatch(
+	_In_ BOOLEAN Emulate
+);
+
+VOID
+ShvTestStopWatch(
+	VOID
+);
+
+BOOLEAN
+ShvTestFilterWatch(
+	_In_ PSHV_VP_STATE VpState,
+	_In_ ULONG64 Gpa,
+	_In_ ULONG Access
+);
+
+VOID
+ShvTestSetGuestMemory(
+	_In_ ULONG64 Gpa,
+	_In_opt_ PVOID Buffer,
+	_In_ SIZE_T Size
+);
+
+PVOID
+ShvTestFindGuestMemory(
+	_In_ ULONG64 Pa
+);
+
+ULONG64
+ShvTestFindGuestPhysical(
+	_In_ const VOID *Address
+);
+
+//
+// Bringing page merging up after the EPT, with its frames in guest
+// memory, and running its scanner.
+//
+NTSTATUS
+ShvTestStartMerge(
+	_In_ ULONG64 Frames
+);
+
+ULONG
+ShvTestStopMerge(
+	VOID
+);
+
+VOID
+ShvTestScanMerge(
+	VOID
+);
+
+//
+// Bringing hooks up after the EPT, and the views they split pages
+// between.
+//
+NTSTATUS
+ShvTestStartHook(
+	VOID
+);
+
+VOID
+ShvTestStopHook(
+	VOID
+);
+
+ULONG
+ShvTestGetHookView(
+	_In_ BOOLEAN Step
+);
+
+BOOLEAN
+ShvTestFilterHook(
+	_In_ PSHV_VP_STATE VpState,
+	_In_ ULONG64 Gpa,
+	_In_ ULONG Access
+);
+
+//
+// Bringing coverage up after the EPT, and the violations it claims.
+//
+NTSTATUS
+ShvTestStartCover(
+	VOID
+);
+
+VOID
+ShvTestStopCover(
+	VOID
+);
+
+BOOLEAN
+ShvTestFilterCover(
+	_In_ PSHV_VP_STATE VpState,
+	_In_ ULONG64 Gpa,
+	_In_ ULONG Access
+);
+
+//
+// Bringing the NUMA sampler up after the EPT, running its rounds in place
+// of its thread, and the pages the round in progress samples.
+//
+NTSTATUS
+ShvTestStartSampler(
+	VOID
+);
+
+VOID
+ShvTestStopSampler(
+	VOID
+);
+
+VOID
+ShvTestStepSampler(
+	VOID
+);
+
+ULONG
+ShvTestGetSamples(
+	_Out_writes_to_(Count, return) PULONG64 Gpas,
+	_In_ ULONG Count
+);
+
+BOOLEAN
+ShvTestFilterSampler(
+	_In_ PSHV_VP_STATE VpState,
+	_In_ ULONG64 Gpa,
+	_In_ ULONG Access
+);
+
+//
+// Measuring.
+//
+ULONG64
+ShvTestNow(
+	VOID
+);
+
+ULONG64
+ShvTestRandom(
+	_Inout_ PULONG64 State
+);
+
+VOID
+ShvTestPrint(
+	_In_ PCSTR Format,
+	...
+);
+
+VOID
+ShvTestFailed(
+	_In_ PCSTR File,
+	_In_ ULONG Line,
+	_In_ PCSTR Expression
+);
+
+//
+// What the platform provides.
+//
+PVOID
+ShvTestPlatAllocate(
+	_In_ SIZE_T Size,
+	_In_ SIZE_T Alignment
+);
+
+VOID
+ShvTestPlatFree(
+	_In_ PVOID P
+);
+
+PVOID
+ShvTestPlatAllocatePages(
+	_In_ SIZE_T Size,
+	_In_ ULONG Node
+);
+
+VOID
+ShvTestPlatFreePages(
+	_In_ PVOID Base,
+	_In_ SIZE_T Size
+);
+
+ULONG64
+ShvTestPlatNanoseconds(
+	VOID
+);
+
+ULONG
+ShvTestPlatProcessorCount(
+	VOID
+);
+
+ULONG
+ShvTestPlatNodeCount(
+	VOID
+);
+
+VOID
+ShvTestPlatBindToNode(
+	_In_ ULONG Node
+);
+
+//
+// Reading guest memory through the guest page tables, the way the guest
+// memory module does, rather than through the stand-in.
+//
+NTSTATUS
+ShvTestReadGuestVirtual(
+	_In_ PSHV_VP_DATA VpData,
+	_In_ ULONG64 Va,
+	_Out_writes_bytes_(Size) PVOID Buffer,
+	_In_ SIZE_T Size
+);
+
+VOID
+ShvTestPlatRunThreads(
+	_In_ ULONG Count,
+	_In_ VOID (*Routine)(ULONG Index, PVOID Context),
+	_In_opt_ PVOID Context
+);
+
+//
+// The tests.
+//
+SHV_TEST_ROUTINE ShvTestLargePages;
+SHV_TEST_ROUTINE ShvTestLargePagesBenchmark;
+SHV_TEST_ROUTINE ShvTestMtrr;
+SHV_TEST_ROUTINE ShvTestMapRange;
+SHV_TEST_ROUTINE ShvTestMapRangeBenchmark;
+SHV_TEST_ROUTINE ShvTestArena;
+SHV_TEST_ROUTINE ShvTestArenaBenchmark;
+SHV_TEST_ROUTINE ShvTestViolations;
+SHV_TEST_ROUTINE ShvTestViolationsBenchmark;
+SHV_TEST_ROUTINE ShvTestFlush;
+SHV_TEST_ROUTINE ShvTestDemand;
+SHV_TEST_ROUTINE ShvTestParallelBuild;
+SHV_TEST_ROUTINE ShvTestParallelBuildBenchmark;
+SHV_TEST_ROUTINE ShvTestWorkingSet;
+SHV_TEST_ROUTINE ShvTestDirtyPages;
+SHV_TEST_ROUTINE ShvTestViews;
+SHV_TEST_ROUTINE ShvTestVirtualizationExceptions;
+SHV_TEST_ROUTINE ShvTestInspect;
+SHV_TEST_ROUTINE ShvTestInspectBenchmark;
+SHV_TEST_ROUTINE ShvTestImageRoundTrip;
+SHV_TEST_ROUTINE ShvTestWarmStart;
+SHV_TEST_ROUTINE ShvTestWarmStartBenchmark;
+SHV_TEST_ROUTINE ShvTestReplication;
+SHV_TEST_ROUTINE ShvTestReplicationBenchmark;
+SHV_TEST_ROUTINE ShvTestGuestTlb;
+SHV_TEST_ROUTINE ShvTestMemMap;
+SHV_TEST_ROUTINE ShvTestMergePages;
+SHV_TEST_ROUTINE ShvTestInlineHooks;
+SHV_TEST_ROUTINE ShvTestWatchFilter;
+SHV_TEST_ROUTINE ShvTestWatchFilterBenchmark;
+SHV_TEST_ROUTINE ShvTestDecode;
+SHV_TEST_ROUTINE ShvTestDecodeBenchmark;
+SHV_TEST_ROUTINE ShvTestArmCoverage;
+SHV_TEST_ROUTINE ShvTestRemoteSampling;
+
+extern BOOLEAN ShvTestVerbose;
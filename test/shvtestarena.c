@@ -0,0 +1,219 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvtestarena.c
+
+Abstract:
+
+	This module tests that the EPT table arena publishes every chunk once
+	when several LPs grow it at once, and that it translates each of its
+	pages between PFN and VA, and benchmarks that translation as the number
+	of chunks grows.
+
+Author:
+
+	agent (@agent) 16-Oct-2026 - Initial version
+
+Environment:
+
+	User mode only.
+
+--*/
+
+#include "shvtest.h"
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// How many LPs grow the arena at once, and how many chunks each asks for.
+// Together they ask for more than the arena has room for.
+//
+#define SHV_TEST_ARENA_PROCESSORS       (16)
+#define SHV_TEST_ARENA_GROWS            (5)
+
+//
+// The most chunks the arena can be made of, and how many PFNs each round
+// of the benchmark translates.
+//
+#define SHV_TEST_ARENA_MAX_CHUNKS       (64)
+#define SHV_TEST_ARENA_PFNS             (4096)
+#define SHV_TEST_ARENA_ROUNDS           (256)
+
+// ===========================================================================
+//
+// LOCAL TYPES
+//
+// ===========================================================================
+
+typedef struct _SHV_TEST_ARENA_GROWTH {
+	volatile LONG Grown;
+	volatile LONG Failed;
+} SHV_TEST_ARENA_GROWTH, *PSHV_TEST_ARENA_GROWTH;
+
+// ===========================================================================
+//
+// LOCAL DATA
+//
+// ===========================================================================
+
+static const ULONG ShvTestArenaChunks[] = { 1, 2, 4, 8, 16, 32, 64 };
+
+// ===========================================================================
+//
+// LOCAL PROTOTYPES
+//
+// ===========================================================================
+
+static VOID
+ShvTestArenaGrow(
+	_In_ ULONG Processor,
+	_In_opt_ PVOID Context
+);
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+VOID
+ShvTestArena(
+	VOID
+)
+{
+	SHV_TEST_ARENA_GROWTH growth;
+	ULONG initial;
+
+	ShvTestSetProcessors(SHV_TEST_ARENA_PROCESSORS, 1);
+
+	if (!SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+	{
+		return;
+	}
+
+	initial = ShvTestCountEptChunks();
+	SHV_TEST_CHECK(ShvTestCheckEptArena() == 0);
+
+	//
+	// Every LP grows the arena at once, until it is full.  Each chunk that
+	// was grown has to be published in a slot of its own, and the ones
+	// that didn't fit have to fail without publishing anything.
+	//
+	growth.Grown = 0;
+	growth.Failed = 0;
+
+	ShvTestRunOnProcessors(SHV_TEST_ARENA_PROCESSORS, ShvTestArenaGrow, &growth);
+
+	SHV_TEST_CHECK(ShvTestCountEptChunks() == SHV_TEST_ARENA_MAX_CHUNKS);
+	SHV_TEST_CHECK((ULONG)growth.Grown == SHV_TEST_ARENA_MAX_CHUNKS - initial);
+	SHV_TEST_CHECK((ULONG)growth.Failed ==
+		SHV_TEST_ARENA_PROCESSORS * SHV_TEST_ARENA_GROWS - (SHV_TEST_ARENA_MAX_CHUNKS - initial));
+	SHV_TEST_CHECK(ShvTestCheckEptArena() == 0);
+
+	SHV_TEST_CHECK(ShvTestReserveEpt(1) != STATUS_SUCCESS);
+	SHV_TEST_CHECK(ShvTestCountEptChunks() == SHV_TEST_ARENA_MAX_CHUNKS);
+
+	ShvTestStopEpt();
+}
+
+VOID
+ShvTestArenaBenchmark(
+	VOID
+)
+{
+	ULONG64 pfns[SHV_TEST_ARENA_PFNS];
+	ULONG64 state, start, indexed, scanned, sum;
+
+	if (!SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+	{
+		return;
+	}
+
+	//
+	// Every walk step translates the PFN of the next table, so this is
+	// paid up to four times per walk.  Scanning the chunks gets slower
+	// the more of them there are, while the index doesn't.
+	//
+	ShvTestPrint("%6s %12s %12s\n", "chunks", "indexed ns", "scanned ns");
+
+	state = 1;
+	sum = 0;
+
+	for (ULONG c = 0; c < RTL_NUMBER_OF(ShvTestArenaChunks); c++)
+	{
+		while (ShvTestCountEptChunks() < ShvTestArenaChunks[c])
+		{
+			if (!SHV_TEST_CHECK_SUCCESS(ShvTestReserveEpt(1)))
+			{
+				ShvTestStopEpt();
+				return;
+			}
+		}
+
+		ShvTestSampleEptPfns(pfns, SHV_TEST_ARENA_PFNS, &state);
+
+		start = ShvTestNow();
+		for (ULONG r = 0; r < SHV_TEST_ARENA_ROUNDS; r++)
+		{
+			sum += ShvTestTranslateEptPfns(pfns, SHV_TEST_ARENA_PFNS, FALSE);
+		}
+		indexed = ShvTestNow() - start;
+
+		start = ShvTestNow();
+		for (ULONG r = 0; r < SHV_TEST_ARENA_ROUNDS; r++)
+		{
+			sum -= ShvTestTranslateEptPfns(pfns, SHV_TEST_ARENA_PFNS, TRUE);
+		}
+		scanned = ShvTestNow() - start;
+
+		ShvTestPrint("%6u %12.1f %12.1f\n",
+			ShvTestArenaChunks[c],
+			(double)indexed / (SHV_TEST_ARENA_ROUNDS * SHV_TEST_ARENA_PFNS),
+			(double)scanned / (SHV_TEST_ARENA_ROUNDS * SHV_TEST_ARENA_PFNS));
+	}
+
+	//
+	// Both ways translate every PFN to the same address.
+	//
+	SHV_TEST_CHECK(sum == 0);
+
+	ShvTestStopEpt();
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+static VOID
+ShvTestArenaGrow(
+	_In_ ULONG Processor,
+	_In_opt_ PVOID Context
+)
+{
+	PSHV_TEST_ARENA_GROWTH growth;
+
+	UNREFERENCED_PARAMETER(Processor);
+
+	growth = (PSHV_TEST_ARENA_GROWTH)Context;
+
+	for (ULONG i = 0; i < SHV_TEST_ARENA_GROWS; i++)
+	{
+		if (ShvTestReserveEpt(1) == STATUS_SUCCESS)
+		{
+			InterlockedIncrement(&growth->Grown);
+		}
+		else
+		{
+			InterlockedIncrement(&growth->Failed);
+		}
+	}
+}
@@ -0,0 +1,314 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvtestarm.c
+
+Abstract:
+
+	This module tests code coverage: that it only arms the pages of its
+	regions that nobody else protected or remapped, only claims execute
+	violations of the pages it armed, gives up the pages someone else
+	changes between epochs and takes back the ones they give back, and
+	only gives execute access back to its own pages when it stops.
+
+Author:
+
+	agent (@agent) 16-Oct-2026 - Initial version
+
+Environment:
+
+	User mode only.
+
+--*/
+
+#include "shvtest.h"
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// The guest memory the test provides, in the first 1 GiB of RAM.  The
+// regions are pages 0 to 3 and 8 and 9, and the last page is a frame to
+// remap one of them to.
+//
+#define SHV_TEST_ARM_BASE               (0x10000000ULL)
+#define SHV_TEST_ARM_SIZE               (12 * PAGE_SIZE)
+#define SHV_TEST_ARM_PAGE(n)            (SHV_TEST_ARM_BASE + (n) * PAGE_SIZE)
+
+//
+// What an armed page can still do.
+//
+#define SHV_TEST_ARM_ARMED              (VMX_EPT_ACCESS_READ | VMX_EPT_ACCESS_WRITE)
+
+// ===========================================================================
+//
+// LOCAL PROTOTYPES
+//
+// ===========================================================================
+
+static ULONG
+ShvTestArmAccess(
+	_In_ ULONG64 Gpa
+);
+
+static VOID
+ShvTestArmProtect(
+	_In_ ULONG64 Gpa,
+	_In_ ULONG Access
+);
+
+static VOID
+ShvTestArmExecute(
+	_In_ ULONG64 Gpa
+);
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+VOID
+ShvTestArmCoverage(
+	VOID
+)
+{
+	static const UCHAR expected[] = { 0, 1, 4, 1 };
+	SHV_COVER_STATISTICS statistics;
+	SHV_EPT_REGION regions[2];
+	SHV_EPT_REMAP remap;
+	SHV_VP_STATE vpState;
+	UCHAR buffer[16];
+	ULONG64 hpa;
+	ULONG length;
+	PVOID memory;
+
+	memory = ShvTestPlatAllocatePages(SHV_TEST_ARM_SIZE, MM_ANY_NODE_OK);
+	if (!SHV_TEST_CHECK(memory != NULL))
+	{
+		return;
+	}
+
+	ShvTestSetGuestMemory(SHV_TEST_ARM_BASE, memory, SHV_TEST_ARM_SIZE);
+
+	regions[0].Base = SHV_TEST_ARM_PAGE(0);
+	regions[0].Size = 4 * PAGE_SIZE;
+	regions[1].Base = SHV_TEST_ARM_PAGE(8);
+	regions[1].Size = 2 * PAGE_SIZE;
+
+	//
+	// Coverage is off unless it was asked for.
+	//
+	if (!SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+	{
+		goto Free;
+	}
+
+	SHV_TEST_CHECK(ShvVmxCoverStart(regions, 2) == STATUS_HV_NOT_PRESENT);
+
+	if (!SHV_TEST_CHECK_SUCCESS(ShvTestStartCover()))
+	{
+		ShvTestStopEpt();
+		goto Free;
+	}
+
+	SHV_TEST_CHECK(ShvVmxCoverStartEpoch() == STATUS_INVALID_DEVICE_STATE);
+
+	//
+	// Someone else already took the execute access of a page away, which
+	// leaves it just like an armed page, and remapped another.  Those stay
+	// theirs, and everything else is armed.
+	//
+	ShvTestArmProtect(SHV_TEST_ARM_PAGE(1), SHV_TEST_ARM_ARMED);
+
+	remap.Gpa = SHV_TEST_ARM_PAGE(8);
+	remap.Hpa = SHV_TEST_ARM_PAGE(11);
+	remap.Access = VMX_EPT_ACCESS_RWX;
+	SHV_TEST_CHECK_SUCCESS(ShvVmxEptRemapPages(&remap, 1));
+
+	if (!SHV_TEST_CHECK_SUCCESS(ShvVmxCoverStart(regions, 2)))
+	{
+		ShvTestStopCover();
+		ShvTestStopEpt();
+		goto Free;
+	}
+
+	SHV_TEST_CHECK(ShvVmxCoverStart(regions, 2) == STATUS_DEVICE_BUSY);
+
+	ShvVmxCoverQuery(&statistics);
+	SHV_TEST_CHECK(statistics.Epoch == 0);
+	SHV_TEST_CHECK(statistics.Pages == 6);
+	SHV_TEST_CHECK(statistics.Armed == 4);
+	SHV_TEST_CHECK(statistics.Executed == 0);
+
+	SHV_TEST_CHECK(ShvTestArmAccess(SHV_TEST_ARM_PAGE(0)) == SHV_TEST_ARM_ARMED);
+	SHV_TEST_CHECK(ShvTestArmAccess(SHV_TEST_ARM_PAGE(1)) == SHV_TEST_ARM_ARMED);
+	SHV_TEST_CHECK(ShvTestArmAccess(SHV_TEST_ARM_PAGE(3)) == SHV_TEST_ARM_ARMED);
+	SHV_TEST_CHECK(ShvTestArmAccess(SHV_TEST_ARM_PAGE(4)) == VMX_EPT_ACCESS_RWX);
+	SHV_TEST_CHECK(ShvTestArmAccess(SHV_TEST_ARM_PAGE(9)) == SHV_TEST_ARM_ARMED);
+
+	SHV_TEST_CHECK(ShvVmxEptGetAccess(SHV_TEST_ARM_PAGE(8), &hpa) == VMX_EPT_ACCESS_RWX);
+	SHV_TEST_CHECK(hpa == SHV_TEST_ARM_PAGE(11));
+
+	//
+	// The first execution of an armed page is recorded, and gives it its
+	// execute access back.  Executing a page someone else took it from is
+	// theirs to deal with, and so is anything but executing.
+	//
+	ShvTestArmExecute(SHV_TEST_ARM_PAGE(0) + 0x123);
+	ShvTestArmExecute(SHV_TEST_ARM_PAGE(9));
+
+	SHV_TEST_CHECK(ShvTestArmAccess(SHV_TEST_ARM_PAGE(0)) == VMX_EPT_ACCESS_RWX);
+	SHV_TEST_CHECK(ShvTestArmAccess(SHV_TEST_ARM_PAGE(9)) == VMX_EPT_ACCESS_RWX);
+
+	__stosb((PUCHAR)&vpState, 0, sizeof(vpState));
+
+	SHV_TEST_CHECK(!ShvTestFilterCover(&vpState, SHV_TEST_ARM_PAGE(1), VMX_EPT_ACCESS_EXECUTE));
+	SHV_TEST_CHECK(!ShvTestFilterCover(&vpState, SHV_TEST_ARM_PAGE(3), VMX_EPT_ACCESS_READ));
+	SHV_TEST_CHECK(!ShvTestFilterCover(&vpState, SHV_TEST_ARM_PAGE(5), VMX_EPT_ACCESS_EXECUTE));
+	SHV_TEST_CHECK(ShvTestArmAccess(SHV_TEST_ARM_PAGE(1)) == SHV_TEST_ARM_ARMED);
+
+	ShvVmxCoverQuery(&statistics);
+	SHV_TEST_CHECK(statistics.Executed == 2);
+	SHV_TEST_CHECK(statistics.Faults == 2);
+	SHV_TEST_CHECK(statistics.Coarse == 0);
+
+	SHV_TEST_CHECK(ShvVmxCoverExport(buffer, sizeof(buffer), &length) == STATUS_INVALID_DEVICE_STATE);
+
+	//
+	// In the meantime, someone else protects one of the armed pages, and
+	// gives back the page they had.  The next epoch gives up the one and
+	// arms the other, along with the pages that were executed.
+	//
+	ShvTestArmProtect(SHV_TEST_ARM_PAGE(2), VMX_EPT_ACCESS_READ);
+	ShvTestArmProtect(SHV_TEST_ARM_PAGE(1), VMX_EPT_ACCESS_RWX);
+
+	SHV_TEST_CHECK_SUCCESS(ShvVmxCoverStartEpoch());
+
+	ShvVmxCoverQuery(&statistics);
+	SHV_TEST_CHECK(statistics.Epoch == 1);
+	SHV_TEST_CHECK(statistics.Armed == 4);
+	SHV_TEST_CHECK(statistics.Executed == 0);
+
+	SHV_TEST_CHECK(ShvTestArmAccess(SHV_TEST_ARM_PAGE(0)) == SHV_TEST_ARM_ARMED);
+	SHV_TEST_CHECK(ShvTestArmAccess(SHV_TEST_ARM_PAGE(1)) == SHV_TEST_ARM_ARMED);
+	SHV_TEST_CHECK(ShvTestArmAccess(SHV_TEST_ARM_PAGE(2)) == VMX_EPT_ACCESS_READ);
+	SHV_TEST_CHECK(ShvTestArmAccess(SHV_TEST_ARM_PAGE(9)) == SHV_TEST_ARM_ARMED);
+
+	SHV_TEST_CHECK(!ShvTestFilterCover(&vpState, SHV_TEST_ARM_PAGE(2), VMX_EPT_ACCESS_EXECUTE));
+
+	ShvTestArmExecute(SHV_TEST_ARM_PAGE(1));
+
+	ShvVmxCoverQuery(&statistics);
+	SHV_TEST_CHECK(statistics.Executed == 1);
+	SHV_TEST_CHECK(statistics.Faults == 3);
+
+	//
+	// The completed epoch executed the first page of each region, which
+	// are the first and fifth page of the bitmap.
+	//
+	SHV_TEST_CHECK(ShvVmxCoverExport(buffer, 1, &length) == STATUS_BUFFER_TOO_SMALL);
+	SHV_TEST_CHECK(length == sizeof(expected));
+
+	SHV_TEST_CHECK_SUCCESS(ShvVmxCoverExport(buffer, sizeof(buffer), &length));
+	SHV_TEST_CHECK(length == sizeof(expected));
+	SHV_TEST_CHECK(RtlCompareMemory(buffer, expected, sizeof(expected)) == sizeof(expected));
+
+	//
+	// Stopping only gives execute access back to the pages that are still
+	// armed.  One more was protected by someone else since the epoch
+	// started, and the ones they have stay the way they made them.
+	//
+	ShvTestArmProtect(SHV_TEST_ARM_PAGE(3), VMX_EPT_ACCESS_READ);
+
+	SHV_TEST_CHECK_SUCCESS(ShvVmxCoverStop());
+
+	SHV_TEST_CHECK(ShvTestArmAccess(SHV_TEST_ARM_PAGE(0)) == VMX_EPT_ACCESS_RWX);
+	SHV_TEST_CHECK(ShvTestArmAccess(SHV_TEST_ARM_PAGE(1)) == VMX_EPT_ACCESS_RWX);
+	SHV_TEST_CHECK(ShvTestArmAccess(SHV_TEST_ARM_PAGE(2)) == VMX_EPT_ACCESS_READ);
+	SHV_TEST_CHECK(ShvTestArmAccess(SHV_TEST_ARM_PAGE(3)) == VMX_EPT_ACCESS_READ);
+	SHV_TEST_CHECK(ShvTestArmAccess(SHV_TEST_ARM_PAGE(9)) == VMX_EPT_ACCESS_RWX);
+
+	SHV_TEST_CHECK(ShvVmxEptGetAccess(SHV_TEST_ARM_PAGE(8), &hpa) == VMX_EPT_ACCESS_RWX);
+	SHV_TEST_CHECK(hpa == SHV_TEST_ARM_PAGE(11));
+
+	ShvVmxCoverQuery(&statistics);
+	SHV_TEST_CHECK(statistics.Pages == 0);
+	SHV_TEST_CHECK(statistics.Faults == 3);
+
+	ShvTestStopCover();
+	ShvTestStopEpt();
+
+Free:
+	ShvTestSetGuestMemory(0, NULL, 0);
+	ShvTestPlatFreePages(memory, SHV_TEST_ARM_SIZE);
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+static ULONG
+ShvTestArmAccess(
+	_In_ ULONG64 Gpa
+)
+{
+	ULONG64 hpa;
+	ULONG access;
+
+	//
+	// What the default view allows on a page that maps its own frame.
+	//
+	access = ShvVmxEptGetAccess(Gpa, &hpa);
+
+	return (hpa == Gpa) ? access : MAXULONG;
+}
+
+static VOID
+ShvTestArmProtect(
+	_In_ ULONG64 Gpa,
+	_In_ ULONG Access
+)
+{
+	SHV_EPT_PROTECTION protection;
+
+	//
+	// Another subsystem changes the access of a page.
+	//
+	protection.Gpa = Gpa;
+	protection.Length = PAGE_SIZE;
+	protection.Access = Access;
+
+	SHV_TEST_CHECK_SUCCESS(ShvVmxEptProtectRanges(&protection, 1));
+}
+
+static VOID
+ShvTestArmExecute(
+	_In_ ULONG64 Gpa
+)
+{
+	SHV_VP_STATE vpState;
+	KIRQL irql;
+
+	//
+	// The guest executes an armed page, and takes a violation, in root
+	// mode with interrupts off.
+	//
+	__stosb((PUCHAR)&vpState, 0, sizeof(vpState));
+	vpState.GuestRip = Gpa;
+
+	__vmx_vmwrite(GUEST_PHYSICAL_ADDRESS, Gpa);
+	__vmx_vmwrite(EXIT_QUALIFICATION, VMX_EPT_ACCESS_EXECUTE);
+
+	KeRaiseIrql(HIGH_LEVEL, &irql);
+	ShvVmxEptHandleViolation(&vpState);
+	KeLowerIrql(irql);
+}
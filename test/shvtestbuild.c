@@ -0,0 +1,263 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvtestbuild.c
+
+Abstract:
+
+	This module tests that building the identity map on every LP at once
+	gives exactly the map that building it on one LP does, and benchmarks
+	how the build time scales with the number of LPs.
+
+Author:
+
+	agent (@agent) 16-Oct-2026 - Initial version
+
+Environment:
+
+	User mode only.
+
+--*/
+
+#include <string.h>
+#include "shvtest.h"
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+#define SHV_TEST_MB                     (1024ULL * 1024)
+#define SHV_TEST_TB                     (1024 * SHV_TEST_GB)
+
+// ===========================================================================
+//
+// LOCAL TYPES
+//
+// ===========================================================================
+
+typedef struct _SHV_TEST_BUILD_MODE {
+	PCSTR Name;
+	ULONG64 Capabilities;
+	ULONG64 Ram;
+} SHV_TEST_BUILD_MODE, *PSHV_TEST_BUILD_MODE;
+
+// ===========================================================================
+//
+// LOCAL DATA
+//
+// ===========================================================================
+
+static const ULONG ShvTestBuildProcessors[] = { 1, 2, 3, 4, 8, 16 };
+
+//
+// Every range starts and ends off a 2 MiB boundary, and most of them
+// cross a 1 GiB one, which is where the build splits the work.
+//
+static const PHYSICAL_MEMORY_RANGE ShvTestBuildRanges[] = {
+	{ { .QuadPart = 0x1000 }, { .QuadPart = 0x9d000 } },
+	{ { .QuadPart = 0x100000 }, { .QuadPart = 0x3fe05000 } },
+	{ { .QuadPart = 0x40207000 }, { .QuadPart = 0x3fbf6000 } },
+	{ { .QuadPart = 0x80000000 }, { .QuadPart = 0x40000000 } },
+	{ { .QuadPart = 0xfffff000 }, { .QuadPart = 0x40003000 } },
+	{ { .QuadPart = 0x300201000 }, { .QuadPart = 0x2000 } },
+};
+
+static const ULONG64 ShvTestBuildCapabilities[] = {
+	SHV_TEST_EPT_CAPS_4KB,
+	SHV_TEST_EPT_CAPS_2MB,
+	SHV_TEST_EPT_CAPS_1GB,
+};
+
+static const SHV_TEST_BUILD_MODE ShvTestBuildModes[] = {
+	{ "4 KiB", SHV_TEST_EPT_CAPS_4KB, 64 * SHV_TEST_GB },
+	{ "2 MiB", SHV_TEST_EPT_CAPS_2MB, 2 * SHV_TEST_TB },
+	{ "1 GiB", SHV_TEST_EPT_CAPS_1GB, 8 * SHV_TEST_TB },
+};
+
+// ===========================================================================
+//
+// LOCAL PROTOTYPES
+//
+// ===========================================================================
+
+static VOID
+ShvTestBuildCompare(
+	_In_ PCSTR Name,
+	_In_ ULONG64 Capabilities
+);
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+VOID
+ShvTestParallelBuild(
+	VOID
+)
+{
+	//
+	// A UC window that straddles 1 GiB, so that the slices on either side
+	// of it each map a part of it.
+	//
+	ShvTestSetMsr(MSR_IA32_MTRRCAP, 2);
+	ShvTestSetMsr(MSR_IA32_MTRR_PHYSBASE0 + 2, (SHV_TEST_GB - 2 * SHV_TEST_MB) | Uncacheable);
+	ShvTestSetMsr(MSR_IA32_MTRR_PHYSMASK0 + 2,
+		(((1ULL << 46) - 1) & ~(4 * SHV_TEST_MB - 1)) | MTRR_PHYSMASK_VALID);
+
+	for (ULONG c = 0; c < RTL_NUMBER_OF(ShvTestBuildCapabilities); c++)
+	{
+		ShvTestSetMsr(MSR_IA32_VMX_EPT_VPID_CAP, ShvTestBuildCapabilities[c]);
+
+		ShvTestSetTypicalMemoryMap(16 * SHV_TEST_GB);
+		ShvTestBuildCompare("typical", ShvTestBuildCapabilities[c]);
+
+		ShvTestSetMemoryMap(ShvTestBuildRanges, RTL_NUMBER_OF(ShvTestBuildRanges));
+		ShvTestBuildCompare("ragged", ShvTestBuildCapabilities[c]);
+	}
+}
+
+VOID
+ShvTestParallelBuildBenchmark(
+	VOID
+)
+{
+	SHV_EPT_INSPECTION inspection;
+	ULONG64 start, elapsed, serial;
+
+	//
+	// The LPs are threads, so the speedup is bounded by the processors
+	// this runs on, not by the simulated LP count.
+	//
+	ShvTestPrint("%u processors available\n", ShvTestPlatProcessorCount());
+	ShvTestPrint("%-6s %8s %4s %10s %8s %12s\n", "pages", "RAM", "LPs", "build ms", "speedup", "tables KiB");
+
+	for (ULONG m = 0; m < RTL_NUMBER_OF(ShvTestBuildModes); m++)
+	{
+		ShvTestSetTypicalMemoryMap(ShvTestBuildModes[m].Ram);
+		ShvTestSetMsr(MSR_IA32_VMX_EPT_VPID_CAP, ShvTestBuildModes[m].Capabilities);
+
+		serial = 0;
+
+		for (ULONG p = 0; p < RTL_NUMBER_OF(ShvTestBuildProcessors); p++)
+		{
+			ShvTestSetProcessors(ShvTestBuildProcessors[p], 1);
+
+			start = ShvTestNow();
+
+			if (!SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+			{
+				return;
+			}
+
+			elapsed = ShvTestNow() - start;
+
+			if (ShvTestBuildProcessors[p] == 1)
+			{
+				serial = elapsed;
+			}
+
+			ShvVmxEptInspect(&inspection);
+
+			ShvTestPrint("%-6s %5llu GiB %4u %10.1f %7.2fx %12llu\n",
+				ShvTestBuildModes[m].Name,
+				ShvTestBuildModes[m].Ram / SHV_TEST_GB,
+				ShvTestBuildProcessors[p],
+				elapsed / 1e6,
+				(double)serial / elapsed,
+				inspection.TableBytes / 1024);
+
+			ShvTestStopEpt();
+		}
+	}
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+static VOID
+ShvTestBuildCompare(
+	_In_ PCSTR Name,
+	_In_ ULONG64 Capabilities
+)
+{
+	SHV_EPT_INSPECTION serialInspection, inspection;
+	PVOID serialImage, image;
+	SIZE_T serialSize, size;
+	ULONG64 tablesInUse;
+	ULONG exhausted;
+
+	//
+	// One LP claims every slice in order, which is the serial build.
+	//
+	ShvTestSetProcessors(1, 1);
+
+	if (!SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+	{
+		return;
+	}
+
+	ShvVmxEptInspect(&serialInspection);
+
+	if (!SHV_TEST_CHECK_SUCCESS(ShvTestWriteEptImage(&serialImage, &serialSize)))
+	{
+		ShvTestStopEpt();
+		return;
+	}
+
+	ShvTestStopEpt();
+
+	if (ShvTestVerbose)
+	{
+		ShvTestPrint("%s map, caps %llx: %llu bytes mapped, %llu KiB of tables, %zu byte image\n",
+			Name,
+			Capabilities,
+			serialInspection.MappedBytes,
+			serialInspection.TableBytes / 1024,
+			serialSize);
+	}
+
+	//
+	// Each LP count has to give the same leaves and the same tables, and
+	// the tables that lost a race to install an entry must all have gone
+	// back to the arena.
+	//
+	for (ULONG p = 1; p < RTL_NUMBER_OF(ShvTestBuildProcessors); p++)
+	{
+		ShvTestSetProcessors(ShvTestBuildProcessors[p], min(ShvTestBuildProcessors[p], 2));
+
+		if (!SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+		{
+			continue;
+		}
+
+		ShvVmxEptInspect(&inspection);
+		ShvTestQueryEptArena(&tablesInUse, &exhausted);
+
+		SHV_TEST_CHECK(memcmp(inspection.Tables, serialInspection.Tables, sizeof(inspection.Tables)) == 0);
+		SHV_TEST_CHECK(memcmp(inspection.Leaves, serialInspection.Leaves, sizeof(inspection.Leaves)) == 0);
+		SHV_TEST_CHECK(inspection.MappedBytes == serialInspection.MappedBytes);
+		SHV_TEST_CHECK(tablesInUse == inspection.TableBytes / PAGE_SIZE);
+
+		if (SHV_TEST_CHECK_SUCCESS(ShvTestWriteEptImage(&image, &size)))
+		{
+			SHV_TEST_CHECK(size == serialSize);
+			SHV_TEST_CHECK((size == serialSize) && (memcmp(image, serialImage, size) == 0));
+
+			ShvTestPlatFree(image);
+		}
+
+		ShvTestStopEpt();
+	}
+
+	ShvTestPlatFree(serialImage);
+}
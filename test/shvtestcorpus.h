@@ -0,0 +1,3555 @@
+//
+// Generated by shvtestcorpus.py from the disassembly of
+// GNU objdump (GNU Binutils for Debian) 2.40.  Do not edit.
+//
+// Code, its length, the length it decodes to or 0 if it has to be rejected,
+// the operation, size, flags, register, base, index, scale, segment,
+// displacement and immediate it decodes to, and what objdump made of it.
+//
+static const SHV_TEST_DECODE_CASE ShvTestDecodeCorpus[] =
+{
+	{ "\x00\x00", 2, 2, ShvEmulAdd, 1, 0x00, 0x00, 0x00, 0xff, 0, 0, 0x0, 0x0, "add BYTE PTR [rax],al" },
+	{ "\x00\x3b", 2, 2, ShvEmulAdd, 1, 0x00, 0x07, 0x03, 0xff, 0, 0, 0x0, 0x0, "add BYTE PTR [rbx],bh" },
+	{ "\x00\x16", 2, 2, ShvEmulAdd, 1, 0x00, 0x02, 0x06, 0xff, 0, 0, 0x0, 0x0, "add BYTE PTR [rsi],dl" },
+	{ "\x00\x07", 2, 2, ShvEmulAdd, 1, 0x00, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "add BYTE PTR [rdi],al" },
+	{ "\x00\x3d\x10\x00\x00\x00", 6, 6, ShvEmulAdd, 1, 0x00, 0x07, 0x10, 0xff, 0, 0, 0x10, 0x0, "add BYTE PTR [rip+0x10],bh # 0x96" },
+	{ "\x00\x05\xf0\xff\xff\xff", 6, 6, ShvEmulAdd, 1, 0x00, 0x00, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "add BYTE PTR [rip+0xfffffffffffffff0],al # 0x96" },
+	{ "\x00\x04\x24", 3, 3, ShvEmulAdd, 1, 0x00, 0x00, 0x04, 0xff, 0, 0, 0x0, 0x0, "add BYTE PTR [rsp],al" },
+	{ "\x00\x14\x98", 3, 3, ShvEmulAdd, 1, 0x00, 0x02, 0x00, 0x03, 4, 0, 0x0, 0x0, "add BYTE PTR [rax+rbx*4],dl" },
+	{ "\x00\x04\x20", 3, 3, ShvEmulAdd, 1, 0x00, 0x00, 0x00, 0xff, 0, 0, 0x0, 0x0, "add BYTE PTR [rax+riz*1],al" },
+	{ "\x00\x3c\xa0", 3, 3, ShvEmulAdd, 1, 0x00, 0x07, 0x00, 0xff, 0, 0, 0x0, 0x0, "add BYTE PTR [rax+riz*4],bh" },
+	{ "\x00\x34\x25\x78\x56\x34\x12", 7, 7, ShvEmulAdd, 1, 0x00, 0x06, 0xff, 0xff, 0, 0, 0x12345678, 0x0, "add BYTE PTR ds:0x12345678,dh" },
+	{ "\x00\x34\x25\xf0\xff\xff\xff", 7, 7, ShvEmulAdd, 1, 0x00, 0x06, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "add BYTE PTR ds:0xfffffffffffffff0,dh" },
+	{ "\x00\x24\x65\x00\x10\x00\x00", 7, 7, ShvEmulAdd, 1, 0x00, 0x04, 0xff, 0xff, 0, 0, 0x1000, 0x0, "add BYTE PTR [riz*2+0x1000],ah" },
+	{ "\x00\x04\xcd\x40\x00\x00\x00", 7, 7, ShvEmulAdd, 1, 0x00, 0x00, 0xff, 0x01, 8, 0, 0x40, 0x0, "add BYTE PTR [rcx*8+0x40],al" },
+	{ "\x00\x34\x1d\x40\x00\x00\x00", 7, 7, ShvEmulAdd, 1, 0x00, 0x06, 0xff, 0x03, 1, 0, 0x40, 0x0, "add BYTE PTR [rbx*1+0x40],dh" },
+	{ "\x00\x48\x7f", 3, 3, ShvEmulAdd, 1, 0x00, 0x01, 0x00, 0xff, 0, 0, 0x7f, 0x0, "add BYTE PTR [rax+0x7f],cl" },
+	{ "\x00\x79\x80", 3, 3, ShvEmulAdd, 1, 0x00, 0x07, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "add BYTE PTR [rcx-0x80],bh" },
+	{ "\x00\x45\x08", 3, 3, ShvEmulAdd, 1, 0x00, 0x00, 0x05, 0xff, 0, 0, 0x8, 0x0, "add BYTE PTR [rbp+0x8],al" },
+	{ "\x00\x7c\x24\x10", 4, 4, ShvEmulAdd, 1, 0x00, 0x07, 0x04, 0xff, 0, 0, 0x10, 0x0, "add BYTE PTR [rsp+0x10],bh" },
+	{ "\x00\x74\x5d\xf8", 4, 4, ShvEmulAdd, 1, 0x00, 0x06, 0x05, 0x03, 2, 0, 0xfffffffffffffff8, 0x0, "add BYTE PTR [rbp+rbx*2-0x8],dh" },
+	{ "\x00\xb9\x00\x10\x00\x00", 6, 6, ShvEmulAdd, 1, 0x00, 0x07, 0x01, 0xff, 0, 0, 0x1000, 0x0, "add BYTE PTR [rcx+0x1000],bh" },
+	{ "\x00\xbd\x00\x00\x00\x80", 6, 6, ShvEmulAdd, 1, 0x00, 0x07, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x0, "add BYTE PTR [rbp-0x80000000],bh" },
+	{ "\x00\x84\xe5\x44\x33\x22\x11", 7, 7, ShvEmulAdd, 1, 0x00, 0x00, 0x05, 0xff, 0, 0, 0x11223344, 0x0, "add BYTE PTR [rbp+riz*8+0x11223344],al" },
+	{ "\x00\xd8", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "add al,bl" },
+	{ "\x00\xdf", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "add bh,bl" },
+	{ "\xf0\x65\x67\x00\x2c\x25\x78\x56\x34\x12", 10, 10, ShvEmulAdd, 1, 0x09, 0x05, 0xff, 0xff, 0, 2, 0x12345678, 0x0, "lock add BYTE PTR gs:[eiz*1+0x12345678],ch" },
+	{ "\x2e\x00\x38", 3, 3, ShvEmulAdd, 1, 0x00, 0x07, 0x00, 0xff, 0, 0, 0x0, 0x0, "cs add BYTE PTR [rax],bh" },
+	{ "\xf2\xf3\x00\xb5\x00\x00\x00\x80", 8, 8, ShvEmulAdd, 1, 0x00, 0x06, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x0, "repnz repz add BYTE PTR [rbp-0x80000000],dh" },
+	{ "\x00\x24\x20", 3, 3, ShvEmulAdd, 1, 0x00, 0x04, 0x00, 0xff, 0, 0, 0x0, 0x0, "add BYTE PTR [rax+riz*1],ah" },
+	{ "\xf2\x00\x7c\x24\x10", 5, 5, ShvEmulAdd, 1, 0x00, 0x07, 0x04, 0xff, 0, 0, 0x10, 0x0, "repnz add BYTE PTR [rsp+0x10],bh" },
+	{ "\x67\x00\x14\xcd\x40\x00\x00\x00", 8, 8, ShvEmulAdd, 1, 0x08, 0x02, 0xff, 0x01, 8, 0, 0x40, 0x0, "add BYTE PTR [ecx*8+0x40],dl" },
+	{ "\xf0\x00\x08", 3, 3, ShvEmulAdd, 1, 0x01, 0x01, 0x00, 0xff, 0, 0, 0x0, 0x0, "lock add BYTE PTR [rax],cl" },
+	{ "\x66\x66\x00\x79\x80", 5, 5, ShvEmulAdd, 1, 0x00, 0x07, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "data16 data16 add BYTE PTR [rcx-0x80],bh" },
+	{ "\x64\x00\x0c\xa0", 4, 4, ShvEmulAdd, 1, 0x00, 0x01, 0x00, 0xff, 0, 1, 0x0, 0x0, "add BYTE PTR fs:[rax+riz*4],cl" },
+	{ "\x66\xf2\x00\x14\x24", 5, 5, ShvEmulAdd, 1, 0x00, 0x02, 0x04, 0xff, 0, 0, 0x0, 0x0, "data16 repnz add BYTE PTR [rsp],dl" },
+	{ "\x3e\x00\x2b", 3, 3, ShvEmulAdd, 1, 0x00, 0x05, 0x03, 0xff, 0, 0, 0x0, 0x0, "ds add BYTE PTR [rbx],ch" },
+	{ "\x2e\x64\x00\x7d\x08", 5, 5, ShvEmulAdd, 1, 0x00, 0x07, 0x05, 0xff, 0, 1, 0x8, 0x0, "cs add BYTE PTR fs:[rbp+0x8],bh" },
+	{ "\x48\x00\x2c\x25\xf0\xff\xff\xff", 8, 8, ShvEmulAdd, 1, 0x04, 0x05, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "rex.W add BYTE PTR ds:0xfffffffffffffff0,bpl" },
+	{ "\x64\x4f\x00\x2c\xcd\x40\x00\x00\x00", 9, 9, ShvEmulAdd, 1, 0x04, 0x0d, 0xff, 0x09, 8, 1, 0x40, 0x0, "rex.WRXB add BYTE PTR fs:[r9*8+0x40],r13b" },
+	{ "\xf2\x41\x00\x2e", 4, 4, ShvEmulAdd, 1, 0x04, 0x05, 0x0e, 0xff, 0, 0, 0x0, 0x0, "repnz add BYTE PTR [r14],bpl" },
+	{ "\x67\x4c\x00\x24\x24", 5, 5, ShvEmulAdd, 1, 0x0c, 0x0c, 0x04, 0xff, 0, 0, 0x0, 0x0, "rex.WR add BYTE PTR [esp],r12b" },
+	{ "\x01\x30", 2, 2, ShvEmulAdd, 4, 0x00, 0x06, 0x00, 0xff, 0, 0, 0x0, 0x0, "add DWORD PTR [rax],esi" },
+	{ "\x01\x03", 2, 2, ShvEmulAdd, 4, 0x00, 0x00, 0x03, 0xff, 0, 0, 0x0, 0x0, "add DWORD PTR [rbx],eax" },
+	{ "\x01\x2e", 2, 2, ShvEmulAdd, 4, 0x00, 0x05, 0x06, 0xff, 0, 0, 0x0, 0x0, "add DWORD PTR [rsi],ebp" },
+	{ "\x01\x1f", 2, 2, ShvEmulAdd, 4, 0x00, 0x03, 0x07, 0xff, 0, 0, 0x0, 0x0, "add DWORD PTR [rdi],ebx" },
+	{ "\x01\x0d\x10\x00\x00\x00", 6, 6, ShvEmulAdd, 4, 0x00, 0x01, 0x10, 0xff, 0, 0, 0x10, 0x0, "add DWORD PTR [rip+0x10],ecx # 0x5b6" },
+	{ "\x01\x0d\xf0\xff\xff\xff", 6, 6, ShvEmulAdd, 4, 0x00, 0x01, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "add DWORD PTR [rip+0xfffffffffffffff0],ecx # 0x5b6" },
+	{ "\x01\x2c\x24", 3, 3, ShvEmulAdd, 4, 0x00, 0x05, 0x04, 0xff, 0, 0, 0x0, 0x0, "add DWORD PTR [rsp],ebp" },
+	{ "\x01\x24\x98", 3, 3, ShvEmulAdd, 4, 0x00, 0x04, 0x00, 0x03, 4, 0, 0x0, 0x0, "add DWORD PTR [rax+rbx*4],esp" },
+	{ "\x01\x2c\x20", 3, 3, ShvEmulAdd, 4, 0x00, 0x05, 0x00, 0xff, 0, 0, 0x0, 0x0, "add DWORD PTR [rax+riz*1],ebp" },
+	{ "\x01\x2c\xa0", 3, 3, ShvEmulAdd, 4, 0x00, 0x05, 0x00, 0xff, 0, 0, 0x0, 0x0, "add DWORD PTR [rax+riz*4],ebp" },
+	{ "\x01\x1c\x25\x78\x56\x34\x12", 7, 7, ShvEmulAdd, 4, 0x00, 0x03, 0xff, 0xff, 0, 0, 0x12345678, 0x0, "add DWORD PTR ds:0x12345678,ebx" },
+	{ "\x01\x04\x25\xf0\xff\xff\xff", 7, 7, ShvEmulAdd, 4, 0x00, 0x00, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "add DWORD PTR ds:0xfffffffffffffff0,eax" },
+	{ "\x01\x04\x65\x00\x10\x00\x00", 7, 7, ShvEmulAdd, 4, 0x00, 0x00, 0xff, 0xff, 0, 0, 0x1000, 0x0, "add DWORD PTR [riz*2+0x1000],eax" },
+	{ "\x01\x0c\xcd\x40\x00\x00\x00", 7, 7, ShvEmulAdd, 4, 0x00, 0x01, 0xff, 0x01, 8, 0, 0x40, 0x0, "add DWORD PTR [rcx*8+0x40],ecx" },
+	{ "\x01\x14\x1d\x40\x00\x00\x00", 7, 7, ShvEmulAdd, 4, 0x00, 0x02, 0xff, 0x03, 1, 0, 0x40, 0x0, "add DWORD PTR [rbx*1+0x40],edx" },
+	{ "\x01\x48\x7f", 3, 3, ShvEmulAdd, 4, 0x00, 0x01, 0x00, 0xff, 0, 0, 0x7f, 0x0, "add DWORD PTR [rax+0x7f],ecx" },
+	{ "\x01\x59\x80", 3, 3, ShvEmulAdd, 4, 0x00, 0x03, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "add DWORD PTR [rcx-0x80],ebx" },
+	{ "\x01\x75\x08", 3, 3, ShvEmulAdd, 4, 0x00, 0x06, 0x05, 0xff, 0, 0, 0x8, 0x0, "add DWORD PTR [rbp+0x8],esi" },
+	{ "\x01\x64\x24\x10", 4, 4, ShvEmulAdd, 4, 0x00, 0x04, 0x04, 0xff, 0, 0, 0x10, 0x0, "add DWORD PTR [rsp+0x10],esp" },
+	{ "\x01\x44\x5d\xf8", 4, 4, ShvEmulAdd, 4, 0x00, 0x00, 0x05, 0x03, 2, 0, 0xfffffffffffffff8, 0x0, "add DWORD PTR [rbp+rbx*2-0x8],eax" },
+	{ "\x01\x81\x00\x10\x00\x00", 6, 6, ShvEmulAdd, 4, 0x00, 0x00, 0x01, 0xff, 0, 0, 0x1000, 0x0, "add DWORD PTR [rcx+0x1000],eax" },
+	{ "\x01\xb5\x00\x00\x00\x80", 6, 6, ShvEmulAdd, 4, 0x00, 0x06, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x0, "add DWORD PTR [rbp-0x80000000],esi" },
+	{ "\x01\x8c\xe5\x44\x33\x22\x11", 7, 7, ShvEmulAdd, 4, 0x00, 0x01, 0x05, 0xff, 0, 0, 0x11223344, 0x0, "add DWORD PTR [rbp+riz*8+0x11223344],ecx" },
+	{ "\x01\xc8", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "add eax,ecx" },
+	{ "\x01\xd7", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "add edi,edx" },
+	{ "\x64\x65\x01\x0c\x20", 5, 5, ShvEmulAdd, 4, 0x00, 0x01, 0x00, 0xff, 0, 2, 0x0, 0x0, "fs add DWORD PTR gs:[rax+riz*1],ecx" },
+	{ "\x65\x01\x15\x10\x00\x00\x00", 7, 7, ShvEmulAdd, 4, 0x00, 0x02, 0x10, 0xff, 0, 2, 0x10, 0x0, "add DWORD PTR gs:[rip+0x10],edx # 0x877" },
+	{ "\x66\x66\x01\x3c\xcd\x40\x00\x00\x00", 9, 9, ShvEmulAdd, 2, 0x00, 0x07, 0xff, 0x01, 8, 0, 0x40, 0x0, "data16 add WORD PTR [rcx*8+0x40],di" },
+	{ "\x66\x67\x01\x04\x25\xf0\xff\xff\xff", 9, 9, ShvEmulAdd, 2, 0x08, 0x00, 0xff, 0xff, 0, 0, 0xfffffff0, 0x0, "add WORD PTR [eiz*1+0xfffffff0],ax" },
+	{ "\x26\x01\x4c\x5d\xf8", 5, 5, ShvEmulAdd, 4, 0x00, 0x01, 0x05, 0x03, 2, 0, 0xfffffffffffffff8, 0x0, "es add DWORD PTR [rbp+rbx*2-0x8],ecx" },
+	{ "\xf2\xf3\x01\x2c\x98", 5, 5, ShvEmulAdd, 4, 0x00, 0x05, 0x00, 0x03, 4, 0, 0x0, 0x0, "repnz repz add DWORD PTR [rax+rbx*4],ebp" },
+	{ "\x66\x01\x74\x5d\xf8", 5, 5, ShvEmulAdd, 2, 0x00, 0x06, 0x05, 0x03, 2, 0, 0xfffffffffffffff8, 0x0, "add WORD PTR [rbp+rbx*2-0x8],si" },
+	{ "\x67\x01\x70\x7f", 4, 4, ShvEmulAdd, 4, 0x08, 0x06, 0x00, 0xff, 0, 0, 0x7f, 0x0, "add DWORD PTR [eax+0x7f],esi" },
+	{ "\x64\x01\x2b", 3, 3, ShvEmulAdd, 4, 0x00, 0x05, 0x03, 0xff, 0, 1, 0x0, 0x0, "add DWORD PTR fs:[rbx],ebp" },
+	{ "\xf2\x01\x13", 3, 3, ShvEmulAdd, 4, 0x00, 0x02, 0x03, 0xff, 0, 0, 0x0, 0x0, "repnz add DWORD PTR [rbx],edx" },
+	{ "\x3e\x01\x2c\x25\xf0\xff\xff\xff", 8, 8, ShvEmulAdd, 4, 0x00, 0x05, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "ds add DWORD PTR ds:0xfffffffffffffff0,ebp" },
+	{ "\x65\x2e\x01\x3f", 4, 4, ShvEmulAdd, 4, 0x00, 0x07, 0x07, 0xff, 0, 2, 0x0, 0x0, "gs add DWORD PTR gs:[rdi],edi" },
+	{ "\xf2\x4f\x01\x9d\x00\x00\x00\x80", 8, 8, ShvEmulAdd, 8, 0x04, 0x0b, 0x0d, 0xff, 0, 0, 0xffffffff80000000, 0x0, "repnz rex.WRXB add QWORD PTR [r13-0x80000000],r11" },
+	{ "\xf2\x4c\x01\x3c\xcd\x40\x00\x00\x00", 9, 9, ShvEmulAdd, 8, 0x04, 0x0f, 0xff, 0x01, 8, 0, 0x40, 0x0, "repnz add QWORD PTR [rcx*8+0x40],r15" },
+	{ "\x66\x41\x01\x15\xf0\xff\xff\xff", 8, 8, ShvEmulAdd, 2, 0x04, 0x02, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "add WORD PTR [rip+0xfffffffffffffff0],dx # 0x9f8" },
+	{ "\xf3\x40\x01\x36", 4, 4, ShvEmulAdd, 4, 0x04, 0x06, 0x06, 0xff, 0, 0, 0x0, 0x0, "repz rex add DWORD PTR [rsi],esi" },
+	{ "\x08\x30", 2, 2, ShvEmulOr, 1, 0x00, 0x06, 0x00, 0xff, 0, 0, 0x0, 0x0, "or BYTE PTR [rax],dh" },
+	{ "\x08\x13", 2, 2, ShvEmulOr, 1, 0x00, 0x02, 0x03, 0xff, 0, 0, 0x0, 0x0, "or BYTE PTR [rbx],dl" },
+	{ "\x08\x1e", 2, 2, ShvEmulOr, 1, 0x00, 0x03, 0x06, 0xff, 0, 0, 0x0, 0x0, "or BYTE PTR [rsi],bl" },
+	{ "\x08\x37", 2, 2, ShvEmulOr, 1, 0x00, 0x06, 0x07, 0xff, 0, 0, 0x0, 0x0, "or BYTE PTR [rdi],dh" },
+	{ "\x08\x25\x10\x00\x00\x00", 6, 6, ShvEmulOr, 1, 0x00, 0x04, 0x10, 0xff, 0, 0, 0x10, 0x0, "or BYTE PTR [rip+0x10],ah # 0xad6" },
+	{ "\x08\x2d\xf0\xff\xff\xff", 6, 6, ShvEmulOr, 1, 0x00, 0x05, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "or BYTE PTR [rip+0xfffffffffffffff0],ch # 0xad6" },
+	{ "\x08\x04\x24", 3, 3, ShvEmulOr, 1, 0x00, 0x00, 0x04, 0xff, 0, 0, 0x0, 0x0, "or BYTE PTR [rsp],al" },
+	{ "\x08\x14\x98", 3, 3, ShvEmulOr, 1, 0x00, 0x02, 0x00, 0x03, 4, 0, 0x0, 0x0, "or BYTE PTR [rax+rbx*4],dl" },
+	{ "\x08\x3c\x20", 3, 3, ShvEmulOr, 1, 0x00, 0x07, 0x00, 0xff, 0, 0, 0x0, 0x0, "or BYTE PTR [rax+riz*1],bh" },
+	{ "\x08\x1c\xa0", 3, 3, ShvEmulOr, 1, 0x00, 0x03, 0x00, 0xff, 0, 0, 0x0, 0x0, "or BYTE PTR [rax+riz*4],bl" },
+	{ "\x08\x24\x25\x78\x56\x34\x12", 7, 7, ShvEmulOr, 1, 0x00, 0x04, 0xff, 0xff, 0, 0, 0x12345678, 0x0, "or BYTE PTR ds:0x12345678,ah" },
+	{ "\x08\x2c\x25\xf0\xff\xff\xff", 7, 7, ShvEmulOr, 1, 0x00, 0x05, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "or BYTE PTR ds:0xfffffffffffffff0,ch" },
+	{ "\x08\x3c\x65\x00\x10\x00\x00", 7, 7, ShvEmulOr, 1, 0x00, 0x07, 0xff, 0xff, 0, 0, 0x1000, 0x0, "or BYTE PTR [riz*2+0x1000],bh" },
+	{ "\x08\x14\xcd\x40\x00\x00\x00", 7, 7, ShvEmulOr, 1, 0x00, 0x02, 0xff, 0x01, 8, 0, 0x40, 0x0, "or BYTE PTR [rcx*8+0x40],dl" },
+	{ "\x08\x3c\x1d\x40\x00\x00\x00", 7, 7, ShvEmulOr, 1, 0x00, 0x07, 0xff, 0x03, 1, 0, 0x40, 0x0, "or BYTE PTR [rbx*1+0x40],bh" },
+	{ "\x08\x40\x7f", 3, 3, ShvEmulOr, 1, 0x00, 0x00, 0x00, 0xff, 0, 0, 0x7f, 0x0, "or BYTE PTR [rax+0x7f],al" },
+	{ "\x08\x61\x80", 3, 3, ShvEmulOr, 1, 0x00, 0x04, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "or BYTE PTR [rcx-0x80],ah" },
+	{ "\x08\x75\x08", 3, 3, ShvEmulOr, 1, 0x00, 0x06, 0x05, 0xff, 0, 0, 0x8, 0x0, "or BYTE PTR [rbp+0x8],dh" },
+	{ "\x08\x7c\x24\x10", 4, 4, ShvEmulOr, 1, 0x00, 0x07, 0x04, 0xff, 0, 0, 0x10, 0x0, "or BYTE PTR [rsp+0x10],bh" },
+	{ "\x08\x4c\x5d\xf8", 4, 4, ShvEmulOr, 1, 0x00, 0x01, 0x05, 0x03, 2, 0, 0xfffffffffffffff8, 0x0, "or BYTE PTR [rbp+rbx*2-0x8],cl" },
+	{ "\x08\xa9\x00\x10\x00\x00", 6, 6, ShvEmulOr, 1, 0x00, 0x05, 0x01, 0xff, 0, 0, 0x1000, 0x0, "or BYTE PTR [rcx+0x1000],ch" },
+	{ "\x08\x85\x00\x00\x00\x80", 6, 6, ShvEmulOr, 1, 0x00, 0x00, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x0, "or BYTE PTR [rbp-0x80000000],al" },
+	{ "\x08\xac\xe5\x44\x33\x22\x11", 7, 7, ShvEmulOr, 1, 0x00, 0x05, 0x05, 0xff, 0, 0, 0x11223344, 0x0, "or BYTE PTR [rbp+riz*8+0x11223344],ch" },
+	{ "\x08\xe0", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "or al,ah" },
+	{ "\x08\xdf", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "or bh,bl" },
+	{ "\xf0\x08\x1d\x10\x00\x00\x00", 7, 7, ShvEmulOr, 1, 0x01, 0x03, 0x10, 0xff, 0, 0, 0x10, 0x0, "lock or BYTE PTR [rip+0x10],bl # 0xd77" },
+	{ "\x64\x65\x08\x0c\x25\xf0\xff\xff\xff", 9, 9, ShvEmulOr, 1, 0x00, 0x01, 0xff, 0xff, 0, 2, 0xfffffffffffffff0, 0x0, "fs or BYTE PTR gs:0xfffffffffffffff0,cl" },
+	{ "\xf3\xf2\x08\xb4\xe5\x44\x33\x22\x11", 9, 9, ShvEmulOr, 1, 0x00, 0x06, 0x05, 0xff, 0, 0, 0x11223344, 0x0, "repz repnz or BYTE PTR [rbp+riz*8+0x11223344],dh" },
+	{ "\xf2\xf3\x08\x44\x24\x10", 6, 6, ShvEmulOr, 1, 0x00, 0x00, 0x04, 0xff, 0, 0, 0x10, 0x0, "repnz repz or BYTE PTR [rsp+0x10],al" },
+	{ "\xf0\xf0\x08\x04\x20", 5, 5, ShvEmulOr, 1, 0x01, 0x00, 0x00, 0xff, 0, 0, 0x0, 0x0, "lock lock or BYTE PTR [rax+riz*1],al" },
+	{ "\xf3\x08\x2c\xa0", 4, 4, ShvEmulOr, 1, 0x00, 0x05, 0x00, 0xff, 0, 0, 0x0, 0x0, "repz or BYTE PTR [rax+riz*4],ch" },
+	{ "\x2e\x08\x64\x24\x10", 5, 5, ShvEmulOr, 1, 0x00, 0x04, 0x04, 0xff, 0, 0, 0x10, 0x0, "cs or BYTE PTR [rsp+0x10],ah" },
+	{ "\x3e\x08\x8c\xe5\x44\x33\x22\x11", 8, 8, ShvEmulOr, 1, 0x00, 0x01, 0x05, 0xff, 0, 0, 0x11223344, 0x0, "ds or BYTE PTR [rbp+riz*8+0x11223344],cl" },
+	{ "\x36\x08\x40\x7f", 4, 4, ShvEmulOr, 1, 0x00, 0x00, 0x00, 0xff, 0, 0, 0x7f, 0x0, "ss or BYTE PTR [rax+0x7f],al" },
+	{ "\xf0\x65\x67\x08\x07", 5, 5, ShvEmulOr, 1, 0x09, 0x00, 0x07, 0xff, 0, 2, 0x0, 0x0, "lock or BYTE PTR gs:[edi],al" },
+	{ "\x66\x67\x08\x14\x1d\x40\x00\x00\x00", 9, 9, ShvEmulOr, 1, 0x08, 0x02, 0xff, 0x03, 1, 0, 0x40, 0x0, "data16 or BYTE PTR [ebx*1+0x40],dl" },
+	{ "\x66\x66\x08\x24\x65\x00\x10\x00\x00", 9, 9, ShvEmulOr, 1, 0x00, 0x04, 0xff, 0xff, 0, 0, 0x1000, 0x0, "data16 data16 or BYTE PTR [riz*2+0x1000],ah" },
+	{ "\x64\x41\x08\x5c\x24\x10", 6, 6, ShvEmulOr, 1, 0x04, 0x03, 0x0c, 0xff, 0, 1, 0x10, 0x0, "or BYTE PTR fs:[r12+0x10],bl" },
+	{ "\x67\x44\x08\x6c\x24\x10", 6, 6, ShvEmulOr, 1, 0x0c, 0x0d, 0x04, 0xff, 0, 0, 0x10, 0x0, "or BYTE PTR [esp+0x10],r13b" },
+	{ "\x64\x40\x08\x28", 4, 4, ShvEmulOr, 1, 0x04, 0x05, 0x00, 0xff, 0, 1, 0x0, 0x0, "or BYTE PTR fs:[rax],bpl" },
+	{ "\xf0\x4c\x08\xbc\xe5\x44\x33\x22\x11", 9, 9, ShvEmulOr, 1, 0x05, 0x0f, 0x05, 0xff, 0, 0, 0x11223344, 0x0, "lock rex.WR or BYTE PTR [rbp+riz*8+0x11223344],r15b" },
+	{ "\x09\x10", 2, 2, ShvEmulOr, 4, 0x00, 0x02, 0x00, 0xff, 0, 0, 0x0, 0x0, "or DWORD PTR [rax],edx" },
+	{ "\x09\x3b", 2, 2, ShvEmulOr, 4, 0x00, 0x07, 0x03, 0xff, 0, 0, 0x0, 0x0, "or DWORD PTR [rbx],edi" },
+	{ "\x09\x2e", 2, 2, ShvEmulOr, 4, 0x00, 0x05, 0x06, 0xff, 0, 0, 0x0, 0x0, "or DWORD PTR [rsi],ebp" },
+	{ "\x09\x2f", 2, 2, ShvEmulOr, 4, 0x00, 0x05, 0x07, 0xff, 0, 0, 0x0, 0x0, "or DWORD PTR [rdi],ebp" },
+	{ "\x09\x1d\x10\x00\x00\x00", 6, 6, ShvEmulOr, 4, 0x00, 0x03, 0x10, 0xff, 0, 0, 0x10, 0x0, "or DWORD PTR [rip+0x10],ebx # 0xff6" },
+	{ "\x09\x0d\xf0\xff\xff\xff", 6, 6, ShvEmulOr, 4, 0x00, 0x01, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "or DWORD PTR [rip+0xfffffffffffffff0],ecx # 0xff6" },
+	{ "\x09\x0c\x24", 3, 3, ShvEmulOr, 4, 0x00, 0x01, 0x04, 0xff, 0, 0, 0x0, 0x0, "or DWORD PTR [rsp],ecx" },
+	{ "\x09\x1c\x98", 3, 3, ShvEmulOr, 4, 0x00, 0x03, 0x00, 0x03, 4, 0, 0x0, 0x0, "or DWORD PTR [rax+rbx*4],ebx" },
+	{ "\x09\x3c\x20", 3, 3, ShvEmulOr, 4, 0x00, 0x07, 0x00, 0xff, 0, 0, 0x0, 0x0, "or DWORD PTR [rax+riz*1],edi" },
+	{ "\x09\x24\xa0", 3, 3, ShvEmulOr, 4, 0x00, 0x04, 0x00, 0xff, 0, 0, 0x0, 0x0, "or DWORD PTR [rax+riz*4],esp" },
+	{ "\x09\x24\x25\x78\x56\x34\x12", 7, 7, ShvEmulOr, 4, 0x00, 0x04, 0xff, 0xff, 0, 0, 0x12345678, 0x0, "or DWORD PTR ds:0x12345678,esp" },
+	{ "\x09\x34\x25\xf0\xff\xff\xff", 7, 7, ShvEmulOr, 4, 0x00, 0x06, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "or DWORD PTR ds:0xfffffffffffffff0,esi" },
+	{ "\x09\x2c\x65\x00\x10\x00\x00", 7, 7, ShvEmulOr, 4, 0x00, 0x05, 0xff, 0xff, 0, 0, 0x1000, 0x0, "or DWORD PTR [riz*2+0x1000],ebp" },
+	{ "\x09\x1c\xcd\x40\x00\x00\x00", 7, 7, ShvEmulOr, 4, 0x00, 0x03, 0xff, 0x01, 8, 0, 0x40, 0x0, "or DWORD PTR [rcx*8+0x40],ebx" },
+	{ "\x09\x1c\x1d\x40\x00\x00\x00", 7, 7, ShvEmulOr, 4, 0x00, 0x03, 0xff, 0x03, 1, 0, 0x40, 0x0, "or DWORD PTR [rbx*1+0x40],ebx" },
+	{ "\x09\x40\x7f", 3, 3, ShvEmulOr, 4, 0x00, 0x00, 0x00, 0xff, 0, 0, 0x7f, 0x0, "or DWORD PTR [rax+0x7f],eax" },
+	{ "\x09\x49\x80", 3, 3, ShvEmulOr, 4, 0x00, 0x01, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "or DWORD PTR [rcx-0x80],ecx" },
+	{ "\x09\x65\x08", 3, 3, ShvEmulOr, 4, 0x00, 0x04, 0x05, 0xff, 0, 0, 0x8, 0x0, "or DWORD PTR [rbp+0x8],esp" },
+	{ "\x09\x6c\x24\x10", 4, 4, ShvEmulOr, 4, 0x00, 0x05, 0x04, 0xff, 0, 0, 0x10, 0x0, "or DWORD PTR [rsp+0x10],ebp" },
+	{ "\x09\x64\x5d\xf8", 4, 4, ShvEmulOr, 4, 0x00, 0x04, 0x05, 0x03, 2, 0, 0xfffffffffffffff8, 0x0, "or DWORD PTR [rbp+rbx*2-0x8],esp" },
+	{ "\x09\x89\x00\x10\x00\x00", 6, 6, ShvEmulOr, 4, 0x00, 0x01, 0x01, 0xff, 0, 0, 0x1000, 0x0, "or DWORD PTR [rcx+0x1000],ecx" },
+	{ "\x09\x85\x00\x00\x00\x80", 6, 6, ShvEmulOr, 4, 0x00, 0x00, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x0, "or DWORD PTR [rbp-0x80000000],eax" },
+	{ "\x09\x84\xe5\x44\x33\x22\x11", 7, 7, ShvEmulOr, 4, 0x00, 0x00, 0x05, 0xff, 0, 0, 0x11223344, 0x0, "or DWORD PTR [rbp+riz*8+0x11223344],eax" },
+	{ "\x09\xe0", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "or eax,esp" },
+	{ "\x09\xf7", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "or edi,esi" },
+	{ "\x09\x1f", 2, 2, ShvEmulOr, 4, 0x00, 0x03, 0x07, 0xff, 0, 0, 0x0, 0x0, "or DWORD PTR [rdi],ebx" },
+	{ "\x67\x09\x8d\x00\x00\x00\x80", 7, 7, ShvEmulOr, 4, 0x08, 0x01, 0x05, 0xff, 0, 0, 0x80000000, 0x0, "or DWORD PTR [ebp-0x80000000],ecx" },
+	{ "\x64\x65\x09\xb4\xe5\x44\x33\x22\x11", 9, 9, ShvEmulOr, 4, 0x00, 0x06, 0x05, 0xff, 0, 2, 0x11223344, 0x0, "fs or DWORD PTR gs:[rbp+riz*8+0x11223344],esi" },
+	{ "\x36\x09\x14\x20", 4, 4, ShvEmulOr, 4, 0x00, 0x02, 0x00, 0xff, 0, 0, 0x0, 0x0, "ss or DWORD PTR [rax+riz*1],edx" },
+	{ "\x3e\x09\x2c\x1d\x40\x00\x00\x00", 8, 8, ShvEmulOr, 4, 0x00, 0x05, 0xff, 0x03, 1, 0, 0x40, 0x0, "ds or DWORD PTR [rbx*1+0x40],ebp" },
+	{ "\x2e\x09\x0d\xf0\xff\xff\xff", 7, 7, ShvEmulOr, 4, 0x00, 0x01, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "cs or DWORD PTR [rip+0xfffffffffffffff0],ecx # 0x1317" },
+	{ "\x65\x2e\x09\x24\x65\x00\x10\x00\x00", 9, 9, ShvEmulOr, 4, 0x00, 0x04, 0xff, 0xff, 0, 2, 0x1000, 0x0, "gs or DWORD PTR gs:[riz*2+0x1000],esp" },
+	{ "\xf3\x66\x09\x6d\x08", 5, 5, ShvEmulOr, 2, 0x00, 0x05, 0x05, 0xff, 0, 0, 0x8, 0x0, "repz or WORD PTR [rbp+0x8],bp" },
+	{ "\xf0\x65\x67\x09\x3d\x10\x00\x00\x00", 9, 9, ShvEmulOr, 4, 0x09, 0x07, 0x10, 0xff, 0, 2, 0x10, 0x0, "lock or DWORD PTR gs:[eip+0x10],edi # 0x1399" },
+	{ "\x26\x09\x3c\x20", 4, 4, ShvEmulOr, 4, 0x00, 0x07, 0x00, 0xff, 0, 0, 0x0, 0x0, "es or DWORD PTR [rax+riz*1],edi" },
+	{ "\x66\x66\x09\x41\x80", 5, 5, ShvEmulOr, 2, 0x00, 0x00, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "data16 or WORD PTR [rcx-0x80],ax" },
+	{ "\xf0\x66\x09\x18", 4, 4, ShvEmulOr, 2, 0x01, 0x03, 0x00, 0xff, 0, 0, 0x0, 0x0, "lock or WORD PTR [rax],bx" },
+	{ "\x44\x09\x75\x08", 4, 4, ShvEmulOr, 4, 0x04, 0x0e, 0x05, 0xff, 0, 0, 0x8, 0x0, "or DWORD PTR [rbp+0x8],r14d" },
+	{ "\x4c\x09\xa1\x00\x10\x00\x00", 7, 7, ShvEmulOr, 8, 0x04, 0x0c, 0x01, 0xff, 0, 0, 0x1000, 0x0, "or QWORD PTR [rcx+0x1000],r12" },
+	{ "\x40\x09\x24\x25\x78\x56\x34\x12", 8, 8, ShvEmulOr, 4, 0x04, 0x04, 0xff, 0xff, 0, 0, 0x12345678, 0x0, "rex or DWORD PTR ds:0x12345678,esp" },
+	{ "\x41\x09\x49\x80", 4, 4, ShvEmulOr, 4, 0x04, 0x01, 0x09, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "or DWORD PTR [r9-0x80],ecx" },
+	{ "\x20\x18", 2, 2, ShvEmulAnd, 1, 0x00, 0x03, 0x00, 0xff, 0, 0, 0x0, 0x0, "and BYTE PTR [rax],bl" },
+	{ "\x20\x0b", 2, 2, ShvEmulAnd, 1, 0x00, 0x01, 0x03, 0xff, 0, 0, 0x0, 0x0, "and BYTE PTR [rbx],cl" },
+	{ "\x20\x3e", 2, 2, ShvEmulAnd, 1, 0x00, 0x07, 0x06, 0xff, 0, 0, 0x0, 0x0, "and BYTE PTR [rsi],bh" },
+	{ "\x20\x37", 2, 2, ShvEmulAnd, 1, 0x00, 0x06, 0x07, 0xff, 0, 0, 0x0, 0x0, "and BYTE PTR [rdi],dh" },
+	{ "\x20\x1d\x10\x00\x00\x00", 6, 6, ShvEmulAnd, 1, 0x00, 0x03, 0x10, 0xff, 0, 0, 0x10, 0x0, "and BYTE PTR [rip+0x10],bl # 0x1516" },
+	{ "\x20\x1d\xf0\xff\xff\xff", 6, 6, ShvEmulAnd, 1, 0x00, 0x03, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "and BYTE PTR [rip+0xfffffffffffffff0],bl # 0x1516" },
+	{ "\x20\x04\x24", 3, 3, ShvEmulAnd, 1, 0x00, 0x00, 0x04, 0xff, 0, 0, 0x0, 0x0, "and BYTE PTR [rsp],al" },
+	{ "\x20\x2c\x98", 3, 3, ShvEmulAnd, 1, 0x00, 0x05, 0x00, 0x03, 4, 0, 0x0, 0x0, "and BYTE PTR [rax+rbx*4],ch" },
+	{ "\x20\x2c\x20", 3, 3, ShvEmulAnd, 1, 0x00, 0x05, 0x00, 0xff, 0, 0, 0x0, 0x0, "and BYTE PTR [rax+riz*1],ch" },
+	{ "\x20\x34\xa0", 3, 3, ShvEmulAnd, 1, 0x00, 0x06, 0x00, 0xff, 0, 0, 0x0, 0x0, "and BYTE PTR [rax+riz*4],dh" },
+	{ "\x20\x3c\x25\x78\x56\x34\x12", 7, 7, ShvEmulAnd, 1, 0x00, 0x07, 0xff, 0xff, 0, 0, 0x12345678, 0x0, "and BYTE PTR ds:0x12345678,bh" },
+	{ "\x20\x3c\x25\xf0\xff\xff\xff", 7, 7, ShvEmulAnd, 1, 0x00, 0x07, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "and BYTE PTR ds:0xfffffffffffffff0,bh" },
+	{ "\x20\x34\x65\x00\x10\x00\x00", 7, 7, ShvEmulAnd, 1, 0x00, 0x06, 0xff, 0xff, 0, 0, 0x1000, 0x0, "and BYTE PTR [riz*2+0x1000],dh" },
+	{ "\x20\x14\xcd\x40\x00\x00\x00", 7, 7, ShvEmulAnd, 1, 0x00, 0x02, 0xff, 0x01, 8, 0, 0x40, 0x0, "and BYTE PTR [rcx*8+0x40],dl" },
+	{ "\x20\x14\x1d\x40\x00\x00\x00", 7, 7, ShvEmulAnd, 1, 0x00, 0x02, 0xff, 0x03, 1, 0, 0x40, 0x0, "and BYTE PTR [rbx*1+0x40],dl" },
+	{ "\x20\x78\x7f", 3, 3, ShvEmulAnd, 1, 0x00, 0x07, 0x00, 0xff, 0, 0, 0x7f, 0x0, "and BYTE PTR [rax+0x7f],bh" },
+	{ "\x20\x59\x80", 3, 3, ShvEmulAnd, 1, 0x00, 0x03, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "and BYTE PTR [rcx-0x80],bl" },
+	{ "\x20\x75\x08", 3, 3, ShvEmulAnd, 1, 0x00, 0x06, 0x05, 0xff, 0, 0, 0x8, 0x0, "and BYTE PTR [rbp+0x8],dh" },
+	{ "\x20\x54\x24\x10", 4, 4, ShvEmulAnd, 1, 0x00, 0x02, 0x04, 0xff, 0, 0, 0x10, 0x0, "and BYTE PTR [rsp+0x10],dl" },
+	{ "\x20\x6c\x5d\xf8", 4, 4, ShvEmulAnd, 1, 0x00, 0x05, 0x05, 0x03, 2, 0, 0xfffffffffffffff8, 0x0, "and BYTE PTR [rbp+rbx*2-0x8],ch" },
+	{ "\x20\x81\x00\x10\x00\x00", 6, 6, ShvEmulAnd, 1, 0x00, 0x00, 0x01, 0xff, 0, 0, 0x1000, 0x0, "and BYTE PTR [rcx+0x1000],al" },
+	{ "\x20\xb5\x00\x00\x00\x80", 6, 6, ShvEmulAnd, 1, 0x00, 0x06, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x0, "and BYTE PTR [rbp-0x80000000],dh" },
+	{ "\x20\x84\xe5\x44\x33\x22\x11", 7, 7, ShvEmulAnd, 1, 0x00, 0x00, 0x05, 0xff, 0, 0, 0x11223344, 0x0, "and BYTE PTR [rbp+riz*8+0x11223344],al" },
+	{ "\x20\xf0", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "and al,dh" },
+	{ "\x20\xd7", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "and bh,dl" },
+	{ "\xf3\x20\x24\xa0", 4, 4, ShvEmulAnd, 1, 0x00, 0x04, 0x00, 0xff, 0, 0, 0x0, 0x0, "repz and BYTE PTR [rax+riz*4],ah" },
+	{ "\xf0\xf0\x20\x2c\xa0", 5, 5, ShvEmulAnd, 1, 0x01, 0x05, 0x00, 0xff, 0, 0, 0x0, 0x0, "lock lock and BYTE PTR [rax+riz*4],ch" },
+	{ "\xf0\x65\x67\x20\x7c\x5d\xf8", 7, 7, ShvEmulAnd, 1, 0x09, 0x07, 0x05, 0x03, 2, 2, 0xfffffff8, 0x0, "lock and BYTE PTR gs:[ebp+ebx*2-0x8],bh" },
+	{ "\xf3\x66\x20\x48\x7f", 5, 5, ShvEmulAnd, 1, 0x00, 0x01, 0x00, 0xff, 0, 0, 0x7f, 0x0, "repz data16 and BYTE PTR [rax+0x7f],cl" },
+	{ "\x67\x20\x04\x98", 4, 4, ShvEmulAnd, 1, 0x08, 0x00, 0x00, 0x03, 4, 0, 0x0, 0x0, "and BYTE PTR [eax+ebx*4],al" },
+	{ "\x66\x66\x20\x34\x25\xf0\xff\xff\xff", 9, 9, ShvEmulAnd, 1, 0x00, 0x06, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "data16 data16 and BYTE PTR ds:0xfffffffffffffff0,dh" },
+	{ "\x20\x3c\x1d\x40\x00\x00\x00", 7, 7, ShvEmulAnd, 1, 0x00, 0x07, 0xff, 0x03, 1, 0, 0x40, 0x0, "and BYTE PTR [rbx*1+0x40],bh" },
+	{ "\x2e\x64\x20\x48\x7f", 5, 5, ShvEmulAnd, 1, 0x00, 0x01, 0x00, 0xff, 0, 1, 0x7f, 0x0, "cs and BYTE PTR fs:[rax+0x7f],cl" },
+	{ "\x66\x20\x44\x5d\xf8", 5, 5, ShvEmulAnd, 1, 0x00, 0x00, 0x05, 0x03, 2, 0, 0xfffffffffffffff8, 0x0, "data16 and BYTE PTR [rbp+rbx*2-0x8],al" },
+	{ "\x65\x2e\x20\x3c\xcd\x40\x00\x00\x00", 9, 9, ShvEmulAnd, 1, 0x00, 0x07, 0xff, 0x01, 8, 2, 0x40, 0x0, "gs and BYTE PTR gs:[rcx*8+0x40],bh" },
+	{ "\x66\x67\x20\x61\x80", 5, 5, ShvEmulAnd, 1, 0x08, 0x04, 0x01, 0xff, 0, 0, 0xffffff80, 0x0, "data16 and BYTE PTR [ecx-0x80],ah" },
+	{ "\xf0\x20\xb4\xe5\x44\x33\x22\x11", 8, 8, ShvEmulAnd, 1, 0x01, 0x06, 0x05, 0xff, 0, 0, 0x11223344, 0x0, "lock and BYTE PTR [rbp+riz*8+0x11223344],dh" },
+	{ "\x66\x4f\x20\x14\x98", 5, 5, ShvEmulAnd, 1, 0x04, 0x0a, 0x08, 0x0b, 4, 0, 0x0, 0x0, "data16 rex.WRXB and BYTE PTR [r8+r11*4],r10b" },
+	{ "\xf2\x40\x20\x1e", 4, 4, ShvEmulAnd, 1, 0x04, 0x03, 0x06, 0xff, 0, 0, 0x0, 0x0, "repnz rex and BYTE PTR [rsi],bl" },
+	{ "\xf2\x4c\x20\x3c\xcd\x40\x00\x00\x00", 9, 9, ShvEmulAnd, 1, 0x04, 0x0f, 0xff, 0x01, 8, 0, 0x40, 0x0, "repnz rex.WR and BYTE PTR [rcx*8+0x40],r15b" },
+	{ "\x67\x41\x20\x3c\x1d\x40\x00\x00\x00", 9, 9, ShvEmulAnd, 1, 0x0c, 0x07, 0xff, 0x03, 1, 0, 0x40, 0x0, "and BYTE PTR [ebx*1+0x40],dil" },
+	{ "\x21\x30", 2, 2, ShvEmulAnd, 4, 0x00, 0x06, 0x00, 0xff, 0, 0, 0x0, 0x0, "and DWORD PTR [rax],esi" },
+	{ "\x21\x0b", 2, 2, ShvEmulAnd, 4, 0x00, 0x01, 0x03, 0xff, 0, 0, 0x0, 0x0, "and DWORD PTR [rbx],ecx" },
+	{ "\x21\x06", 2, 2, ShvEmulAnd, 4, 0x00, 0x00, 0x06, 0xff, 0, 0, 0x0, 0x0, "and DWORD PTR [rsi],eax" },
+	{ "\x21\x37", 2, 2, ShvEmulAnd, 4, 0x00, 0x06, 0x07, 0xff, 0, 0, 0x0, 0x0, "and DWORD PTR [rdi],esi" },
+	{ "\x21\x1d\x10\x00\x00\x00", 6, 6, ShvEmulAnd, 4, 0x00, 0x03, 0x10, 0xff, 0, 0, 0x10, 0x0, "and DWORD PTR [rip+0x10],ebx # 0x1a36" },
+	{ "\x21\x15\xf0\xff\xff\xff", 6, 6, ShvEmulAnd, 4, 0x00, 0x02, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "and DWORD PTR [rip+0xfffffffffffffff0],edx # 0x1a36" },
+	{ "\x21\x3c\x24", 3, 3, ShvEmulAnd, 4, 0x00, 0x07, 0x04, 0xff, 0, 0, 0x0, 0x0, "and DWORD PTR [rsp],edi" },
+	{ "\x21\x1c\x98", 3, 3, ShvEmulAnd, 4, 0x00, 0x03, 0x00, 0x03, 4, 0, 0x0, 0x0, "and DWORD PTR [rax+rbx*4],ebx" },
+	{ "\x21\x24\x20", 3, 3, ShvEmulAnd, 4, 0x00, 0x04, 0x00, 0xff, 0, 0, 0x0, 0x0, "and DWORD PTR [rax+riz*1],esp" },
+	{ "\x21\x04\xa0", 3, 3, ShvEmulAnd, 4, 0x00, 0x00, 0x00, 0xff, 0, 0, 0x0, 0x0, "and DWORD PTR [rax+riz*4],eax" },
+	{ "\x21\x24\x25\x78\x56\x34\x12", 7, 7, ShvEmulAnd, 4, 0x00, 0x04, 0xff, 0xff, 0, 0, 0x12345678, 0x0, "and DWORD PTR ds:0x12345678,esp" },
+	{ "\x21\x0c\x25\xf0\xff\xff\xff", 7, 7, ShvEmulAnd, 4, 0x00, 0x01, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "and DWORD PTR ds:0xfffffffffffffff0,ecx" },
+	{ "\x21\x3c\x65\x00\x10\x00\x00", 7, 7, ShvEmulAnd, 4, 0x00, 0x07, 0xff, 0xff, 0, 0, 0x1000, 0x0, "and DWORD PTR [riz*2+0x1000],edi" },
+	{ "\x21\x34\xcd\x40\x00\x00\x00", 7, 7, ShvEmulAnd, 4, 0x00, 0x06, 0xff, 0x01, 8, 0, 0x40, 0x0, "and DWORD PTR [rcx*8+0x40],esi" },
+	{ "\x21\x3c\x1d\x40\x00\x00\x00", 7, 7, ShvEmulAnd, 4, 0x00, 0x07, 0xff, 0x03, 1, 0, 0x40, 0x0, "and DWORD PTR [rbx*1+0x40],edi" },
+	{ "\x21\x48\x7f", 3, 3, ShvEmulAnd, 4, 0x00, 0x01, 0x00, 0xff, 0, 0, 0x7f, 0x0, "and DWORD PTR [rax+0x7f],ecx" },
+	{ "\x21\x61\x80", 3, 3, ShvEmulAnd, 4, 0x00, 0x04, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "and DWORD PTR [rcx-0x80],esp" },
+	{ "\x21\x4d\x08", 3, 3, ShvEmulAnd, 4, 0x00, 0x01, 0x05, 0xff, 0, 0, 0x8, 0x0, "and DWORD PTR [rbp+0x8],ecx" },
+	{ "\x21\x44\x24\x10", 4, 4, ShvEmulAnd, 4, 0x00, 0x00, 0x04, 0xff, 0, 0, 0x10, 0x0, "and DWORD PTR [rsp+0x10],eax" },
+	{ "\x21\x64\x5d\xf8", 4, 4, ShvEmulAnd, 4, 0x00, 0x04, 0x05, 0x03, 2, 0, 0xfffffffffffffff8, 0x0, "and DWORD PTR [rbp+rbx*2-0x8],esp" },
+	{ "\x21\x91\x00\x10\x00\x00", 6, 6, ShvEmulAnd, 4, 0x00, 0x02, 0x01, 0xff, 0, 0, 0x1000, 0x0, "and DWORD PTR [rcx+0x1000],edx" },
+	{ "\x21\x95\x00\x00\x00\x80", 6, 6, ShvEmulAnd, 4, 0x00, 0x02, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x0, "and DWORD PTR [rbp-0x80000000],edx" },
+	{ "\x21\x9c\xe5\x44\x33\x22\x11", 7, 7, ShvEmulAnd, 4, 0x00, 0x03, 0x05, 0xff, 0, 0, 0x11223344, 0x0, "and DWORD PTR [rbp+riz*8+0x11223344],ebx" },
+	{ "\x21\xe0", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "and eax,esp" },
+	{ "\x21\xf7", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "and edi,esi" },
+	{ "\x2e\x21\xad\x00\x00\x00\x80", 7, 7, ShvEmulAnd, 4, 0x00, 0x05, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x0, "cs and DWORD PTR [rbp-0x80000000],ebp" },
+	{ "\xf2\x21\x50\x7f", 4, 4, ShvEmulAnd, 4, 0x00, 0x02, 0x00, 0xff, 0, 0, 0x7f, 0x0, "repnz and DWORD PTR [rax+0x7f],edx" },
+	{ "\x64\x65\x21\x14\xcd\x40\x00\x00\x00", 9, 9, ShvEmulAnd, 4, 0x00, 0x02, 0xff, 0x01, 8, 2, 0x40, 0x0, "fs and DWORD PTR gs:[rcx*8+0x40],edx" },
+	{ "\x66\x67\x21\x28", 4, 4, ShvEmulAnd, 2, 0x08, 0x05, 0x00, 0xff, 0, 0, 0x0, 0x0, "and WORD PTR [eax],bp" },
+	{ "\x65\x21\x35\x10\x00\x00\x00", 7, 7, ShvEmulAnd, 4, 0x00, 0x06, 0x10, 0xff, 0, 2, 0x10, 0x0, "and DWORD PTR gs:[rip+0x10],esi # 0x1d57" },
+	{ "\xf0\x66\x21\x3c\x25\xf0\xff\xff\xff", 9, 9, ShvEmulAnd, 2, 0x01, 0x07, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "lock and WORD PTR ds:0xfffffffffffffff0,di" },
+	{ "\x66\x21\x35\x10\x00\x00\x00", 7, 7, ShvEmulAnd, 2, 0x00, 0x06, 0x10, 0xff, 0, 0, 0x10, 0x0, "and WORD PTR [rip+0x10],si # 0x1d97" },
+	{ "\x36\x21\x15\x10\x00\x00\x00", 7, 7, ShvEmulAnd, 4, 0x00, 0x02, 0x10, 0xff, 0, 0, 0x10, 0x0, "ss and DWORD PTR [rip+0x10],edx # 0x1db7" },
+	{ "\xf2\xf3\x21\xa4\xe5\x44\x33\x22\x11", 9, 9, ShvEmulAnd, 4, 0x00, 0x04, 0x05, 0xff, 0, 0, 0x11223344, 0x0, "repnz repz and DWORD PTR [rbp+riz*8+0x11223344],esp" },
+	{ "\x2e\x64\x21\x3c\x25\xf0\xff\xff\xff", 9, 9, ShvEmulAnd, 4, 0x00, 0x07, 0xff, 0xff, 0, 1, 0xfffffffffffffff0, 0x0, "cs and DWORD PTR fs:0xfffffffffffffff0,edi" },
+	{ "\xf0\x21\x1f", 3, 3, ShvEmulAnd, 4, 0x01, 0x03, 0x07, 0xff, 0, 0, 0x0, 0x0, "lock and DWORD PTR [rdi],ebx" },
+	{ "\x64\x44\x21\x7c\x5d\xf8", 6, 6, ShvEmulAnd, 4, 0x04, 0x0f, 0x05, 0x03, 2, 1, 0xfffffffffffffff8, 0x0, "and DWORD PTR fs:[rbp+rbx*2-0x8],r15d" },
+	{ "\x65\x4f\x21\x1c\x98", 5, 5, ShvEmulAnd, 8, 0x04, 0x0b, 0x08, 0x0b, 4, 2, 0x0, 0x0, "and QWORD PTR gs:[r8+r11*4],r11" },
+	{ "\x65\x40\x21\x34\x24", 5, 5, ShvEmulAnd, 4, 0x04, 0x06, 0x04, 0xff, 0, 2, 0x0, 0x0, "rex and DWORD PTR gs:[rsp],esi" },
+	{ "\x4c\x21\x13", 3, 3, ShvEmulAnd, 8, 0x04, 0x0a, 0x03, 0xff, 0, 0, 0x0, 0x0, "and QWORD PTR [rbx],r10" },
+	{ "\x28\x18", 2, 2, ShvEmulSub, 1, 0x00, 0x03, 0x00, 0xff, 0, 0, 0x0, 0x0, "sub BYTE PTR [rax],bl" },
+	{ "\x28\x2b", 2, 2, ShvEmulSub, 1, 0x00, 0x05, 0x03, 0xff, 0, 0, 0x0, 0x0, "sub BYTE PTR [rbx],ch" },
+	{ "\x28\x2e", 2, 2, ShvEmulSub, 1, 0x00, 0x05, 0x06, 0xff, 0, 0, 0x0, 0x0, "sub BYTE PTR [rsi],ch" },
+	{ "\x28\x07", 2, 2, ShvEmulSub, 1, 0x00, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "sub BYTE PTR [rdi],al" },
+	{ "\x28\x0d\x10\x00\x00\x00", 6, 6, ShvEmulSub, 1, 0x00, 0x01, 0x10, 0xff, 0, 0, 0x10, 0x0, "sub BYTE PTR [rip+0x10],cl # 0x1f36" },
+	{ "\x28\x1d\xf0\xff\xff\xff", 6, 6, ShvEmulSub, 1, 0x00, 0x03, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "sub BYTE PTR [rip+0xfffffffffffffff0],bl # 0x1f36" },
+	{ "\x28\x2c\x24", 3, 3, ShvEmulSub, 1, 0x00, 0x05, 0x04, 0xff, 0, 0, 0x0, 0x0, "sub BYTE PTR [rsp],ch" },
+	{ "\x28\x24\x98", 3, 3, ShvEmulSub, 1, 0x00, 0x04, 0x00, 0x03, 4, 0, 0x0, 0x0, "sub BYTE PTR [rax+rbx*4],ah" },
+	{ "\x28\x1c\x20", 3, 3, ShvEmulSub, 1, 0x00, 0x03, 0x00, 0xff, 0, 0, 0x0, 0x0, "sub BYTE PTR [rax+riz*1],bl" },
+	{ "\x28\x2c\xa0", 3, 3, ShvEmulSub, 1, 0x00, 0x05, 0x00, 0xff, 0, 0, 0x0, 0x0, "sub BYTE PTR [rax+riz*4],ch" },
+	{ "\x28\x0c\x25\x78\x56\x34\x12", 7, 7, ShvEmulSub, 1, 0x00, 0x01, 0xff, 0xff, 0, 0, 0x12345678, 0x0, "sub BYTE PTR ds:0x12345678,cl" },
+	{ "\x28\x14\x25\xf0\xff\xff\xff", 7, 7, ShvEmulSub, 1, 0x00, 0x02, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "sub BYTE PTR ds:0xfffffffffffffff0,dl" },
+	{ "\x28\x34\x65\x00\x10\x00\x00", 7, 7, ShvEmulSub, 1, 0x00, 0x06, 0xff, 0xff, 0, 0, 0x1000, 0x0, "sub BYTE PTR [riz*2+0x1000],dh" },
+	{ "\x28\x3c\xcd\x40\x00\x00\x00", 7, 7, ShvEmulSub, 1, 0x00, 0x07, 0xff, 0x01, 8, 0, 0x40, 0x0, "sub BYTE PTR [rcx*8+0x40],bh" },
+	{ "\x28\x2c\x1d\x40\x00\x00\x00", 7, 7, ShvEmulSub, 1, 0x00, 0x05, 0xff, 0x03, 1, 0, 0x40, 0x0, "sub BYTE PTR [rbx*1+0x40],ch" },
+	{ "\x28\x40\x7f", 3, 3, ShvEmulSub, 1, 0x00, 0x00, 0x00, 0xff, 0, 0, 0x7f, 0x0, "sub BYTE PTR [rax+0x7f],al" },
+	{ "\x28\x71\x80", 3, 3, ShvEmulSub, 1, 0x00, 0x06, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "sub BYTE PTR [rcx-0x80],dh" },
+	{ "\x28\x65\x08", 3, 3, ShvEmulSub, 1, 0x00, 0x04, 0x05, 0xff, 0, 0, 0x8, 0x0, "sub BYTE PTR [rbp+0x8],ah" },
+	{ "\x28\x7c\x24\x10", 4, 4, ShvEmulSub, 1, 0x00, 0x07, 0x04, 0xff, 0, 0, 0x10, 0x0, "sub BYTE PTR [rsp+0x10],bh" },
+	{ "\x28\x7c\x5d\xf8", 4, 4, ShvEmulSub, 1, 0x00, 0x07, 0x05, 0x03, 2, 0, 0xfffffffffffffff8, 0x0, "sub BYTE PTR [rbp+rbx*2-0x8],bh" },
+	{ "\x28\xa9\x00\x10\x00\x00", 6, 6, ShvEmulSub, 1, 0x00, 0x05, 0x01, 0xff, 0, 0, 0x1000, 0x0, "sub BYTE PTR [rcx+0x1000],ch" },
+	{ "\x28\x9d\x00\x00\x00\x80", 6, 6, ShvEmulSub, 1, 0x00, 0x03, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x0, "sub BYTE PTR [rbp-0x80000000],bl" },
+	{ "\x28\xa4\xe5\x44\x33\x22\x11", 7, 7, ShvEmulSub, 1, 0x00, 0x04, 0x05, 0xff, 0, 0, 0x11223344, 0x0, "sub BYTE PTR [rbp+riz*8+0x11223344],ah" },
+	{ "\x28\xc0", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "sub al,al" },
+	{ "\x28\xf7", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "sub bh,dh" },
+	{ "\x2e\x28\x0c\x20", 4, 4, ShvEmulSub, 1, 0x00, 0x01, 0x00, 0xff, 0, 0, 0x0, 0x0, "cs sub BYTE PTR [rax+riz*1],cl" },
+	{ "\xf0\x65\x67\x28\x1c\x20", 6, 6, ShvEmulSub, 1, 0x09, 0x03, 0x00, 0xff, 0, 2, 0x0, 0x0, "lock sub BYTE PTR gs:[eax+eiz*1],bl" },
+	{ "\xf2\xf3\x28\x20", 4, 4, ShvEmulSub, 1, 0x00, 0x04, 0x00, 0xff, 0, 0, 0x0, 0x0, "repnz repz sub BYTE PTR [rax],ah" },
+	{ "\x2e\x64\x28\x0f", 4, 4, ShvEmulSub, 1, 0x00, 0x01, 0x07, 0xff, 0, 1, 0x0, 0x0, "cs sub BYTE PTR fs:[rdi],cl" },
+	{ "\x26\x28\x1c\x25\xf0\xff\xff\xff", 8, 8, ShvEmulSub, 1, 0x00, 0x03, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "es sub BYTE PTR ds:0xfffffffffffffff0,bl" },
+	{ "\xf3\xf2\x28\x3c\x24", 5, 5, ShvEmulSub, 1, 0x00, 0x07, 0x04, 0xff, 0, 0, 0x0, 0x0, "repz repnz sub BYTE PTR [rsp],bh" },
+	{ "\x64\x65\x28\x54\x5d\xf8", 6, 6, ShvEmulSub, 1, 0x00, 0x02, 0x05, 0x03, 2, 2, 0xfffffffffffffff8, 0x0, "fs sub BYTE PTR gs:[rbp+rbx*2-0x8],dl" },
+	{ "\x3e\x28\x14\x20", 4, 4, ShvEmulSub, 1, 0x00, 0x02, 0x00, 0xff, 0, 0, 0x0, 0x0, "ds sub BYTE PTR [rax+riz*1],dl" },
+	{ "\xf3\x66\x28\x7d\x08", 5, 5, ShvEmulSub, 1, 0x00, 0x07, 0x05, 0xff, 0, 0, 0x8, 0x0, "repz data16 sub BYTE PTR [rbp+0x8],bh" },
+	{ "\x28\x34\x20", 3, 3, ShvEmulSub, 1, 0x00, 0x06, 0x00, 0xff, 0, 0, 0x0, 0x0, "sub BYTE PTR [rax+riz*1],dh" },
+	{ "\x65\x28\x10", 3, 3, ShvEmulSub, 1, 0x00, 0x02, 0x00, 0xff, 0, 2, 0x0, 0x0, "sub BYTE PTR gs:[rax],dl" },
+	{ "\xf3\x28\x3c\xa0", 4, 4, ShvEmulSub, 1, 0x00, 0x07, 0x00, 0xff, 0, 0, 0x0, 0x0, "repz sub BYTE PTR [rax+riz*4],bh" },
+	{ "\x42\x28\x25\x10\x00\x00\x00", 7, 7, ShvEmulSub, 1, 0x04, 0x04, 0x10, 0xff, 0, 0, 0x10, 0x0, "rex.X sub BYTE PTR [rip+0x10],spl # 0x2357" },
+	{ "\xf0\x4c\x28\x7c\x5d\xf8", 6, 6, ShvEmulSub, 1, 0x05, 0x0f, 0x05, 0x03, 2, 0, 0xfffffffffffffff8, 0x0, "lock rex.WR sub BYTE PTR [rbp+rbx*2-0x8],r15b" },
+	{ "\x65\x40\x28\x68\x7f", 5, 5, ShvEmulSub, 1, 0x04, 0x05, 0x00, 0xff, 0, 2, 0x7f, 0x0, "sub BYTE PTR gs:[rax+0x7f],bpl" },
+	{ "\xf2\x4f\x28\x0c\x98", 5, 5, ShvEmulSub, 1, 0x04, 0x09, 0x08, 0x0b, 4, 0, 0x0, 0x0, "repnz rex.WRXB sub BYTE PTR [r8+r11*4],r9b" },
+	{ "\x29\x38", 2, 2, ShvEmulSub, 4, 0x00, 0x07, 0x00, 0xff, 0, 0, 0x0, 0x0, "sub DWORD PTR [rax],edi" },
+	{ "\x29\x23", 2, 2, ShvEmulSub, 4, 0x00, 0x04, 0x03, 0xff, 0, 0, 0x0, 0x0, "sub DWORD PTR [rbx],esp" },
+	{ "\x29\x3e", 2, 2, ShvEmulSub, 4, 0x00, 0x07, 0x06, 0xff, 0, 0, 0x0, 0x0, "sub DWORD PTR [rsi],edi" },
+	{ "\x29\x17", 2, 2, ShvEmulSub, 4, 0x00, 0x02, 0x07, 0xff, 0, 0, 0x0, 0x0, "sub DWORD PTR [rdi],edx" },
+	{ "\x29\x3d\x10\x00\x00\x00", 6, 6, ShvEmulSub, 4, 0x00, 0x07, 0x10, 0xff, 0, 0, 0x10, 0x0, "sub DWORD PTR [rip+0x10],edi # 0x2456" },
+	{ "\x29\x3d\xf0\xff\xff\xff", 6, 6, ShvEmulSub, 4, 0x00, 0x07, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "sub DWORD PTR [rip+0xfffffffffffffff0],edi # 0x2456" },
+	{ "\x29\x2c\x24", 3, 3, ShvEmulSub, 4, 0x00, 0x05, 0x04, 0xff, 0, 0, 0x0, 0x0, "sub DWORD PTR [rsp],ebp" },
+	{ "\x29\x34\x98", 3, 3, ShvEmulSub, 4, 0x00, 0x06, 0x00, 0x03, 4, 0, 0x0, 0x0, "sub DWORD PTR [rax+rbx*4],esi" },
+	{ "\x29\x1c\x20", 3, 3, ShvEmulSub, 4, 0x00, 0x03, 0x00, 0xff, 0, 0, 0x0, 0x0, "sub DWORD PTR [rax+riz*1],ebx" },
+	{ "\x29\x14\xa0", 3, 3, ShvEmulSub, 4, 0x00, 0x02, 0x00, 0xff, 0, 0, 0x0, 0x0, "sub DWORD PTR [rax+riz*4],edx" },
+	{ "\x29\x24\x25\x78\x56\x34\x12", 7, 7, ShvEmulSub, 4, 0x00, 0x04, 0xff, 0xff, 0, 0, 0x12345678, 0x0, "sub DWORD PTR ds:0x12345678,esp" },
+	{ "\x29\x34\x25\xf0\xff\xff\xff", 7, 7, ShvEmulSub, 4, 0x00, 0x06, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "sub DWORD PTR ds:0xfffffffffffffff0,esi" },
+	{ "\x29\x1c\x65\x00\x10\x00\x00", 7, 7, ShvEmulSub, 4, 0x00, 0x03, 0xff, 0xff, 0, 0, 0x1000, 0x0, "sub DWORD PTR [riz*2+0x1000],ebx" },
+	{ "\x29\x14\xcd\x40\x00\x00\x00", 7, 7, ShvEmulSub, 4, 0x00, 0x02, 0xff, 0x01, 8, 0, 0x40, 0x0, "sub DWORD PTR [rcx*8+0x40],edx" },
+	{ "\x29\x2c\x1d\x40\x00\x00\x00", 7, 7, ShvEmulSub, 4, 0x00, 0x05, 0xff, 0x03, 1, 0, 0x40, 0x0, "sub DWORD PTR [rbx*1+0x40],ebp" },
+	{ "\x29\x68\x7f", 3, 3, ShvEmulSub, 4, 0x00, 0x05, 0x00, 0xff, 0, 0, 0x7f, 0x0, "sub DWORD PTR [rax+0x7f],ebp" },
+	{ "\x29\x51\x80", 3, 3, ShvEmulSub, 4, 0x00, 0x02, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "sub DWORD PTR [rcx-0x80],edx" },
+	{ "\x29\x75\x08", 3, 3, ShvEmulSub, 4, 0x00, 0x06, 0x05, 0xff, 0, 0, 0x8, 0x0, "sub DWORD PTR [rbp+0x8],esi" },
+	{ "\x29\x7c\x24\x10", 4, 4, ShvEmulSub, 4, 0x00, 0x07, 0x04, 0xff, 0, 0, 0x10, 0x0, "sub DWORD PTR [rsp+0x10],edi" },
+	{ "\x29\x64\x5d\xf8", 4, 4, ShvEmulSub, 4, 0x00, 0x04, 0x05, 0x03, 2, 0, 0xfffffffffffffff8, 0x0, "sub DWORD PTR [rbp+rbx*2-0x8],esp" },
+	{ "\x29\x81\x00\x10\x00\x00", 6, 6, ShvEmulSub, 4, 0x00, 0x00, 0x01, 0xff, 0, 0, 0x1000, 0x0, "sub DWORD PTR [rcx+0x1000],eax" },
+	{ "\x29\x95\x00\x00\x00\x80", 6, 6, ShvEmulSub, 4, 0x00, 0x02, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x0, "sub DWORD PTR [rbp-0x80000000],edx" },
+	{ "\x29\xa4\xe5\x44\x33\x22\x11", 7, 7, ShvEmulSub, 4, 0x00, 0x04, 0x05, 0xff, 0, 0, 0x11223344, 0x0, "sub DWORD PTR [rbp+riz*8+0x11223344],esp" },
+	{ "\x29\xd8", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "sub eax,ebx" },
+	{ "\x29\xdf", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "sub edi,ebx" },
+	{ "\xf3\x66\x29\xa5\x00\x00\x00\x80", 8, 8, ShvEmulSub, 2, 0x00, 0x04, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x0, "repz sub WORD PTR [rbp-0x80000000],sp" },
+	{ "\x66\x67\x29\x3b", 4, 4, ShvEmulSub, 2, 0x08, 0x07, 0x03, 0xff, 0, 0, 0x0, 0x0, "sub WORD PTR [ebx],di" },
+	{ "\x64\x65\x29\x3c\x24", 5, 5, ShvEmulSub, 4, 0x00, 0x07, 0x04, 0xff, 0, 2, 0x0, 0x0, "fs sub DWORD PTR gs:[rsp],edi" },
+	{ "\xf0\xf0\x29\x79\x80", 5, 5, ShvEmulSub, 4, 0x01, 0x07, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "lock lock sub DWORD PTR [rcx-0x80],edi" },
+	{ "\x65\x2e\x29\x3c\x65\x00\x10\x00\x00", 9, 9, ShvEmulSub, 4, 0x00, 0x07, 0xff, 0xff, 0, 2, 0x1000, 0x0, "gs sub DWORD PTR gs:[riz*2+0x1000],edi" },
+	{ "\xf0\x66\x29\x4c\x24\x10", 6, 6, ShvEmulSub, 2, 0x01, 0x01, 0x04, 0xff, 0, 0, 0x10, 0x0, "lock sub WORD PTR [rsp+0x10],cx" },
+	{ "\x65\x29\x54\x5d\xf8", 5, 5, ShvEmulSub, 4, 0x00, 0x02, 0x05, 0x03, 2, 2, 0xfffffffffffffff8, 0x0, "sub DWORD PTR gs:[rbp+rbx*2-0x8],edx" },
+	{ "\x2e\x29\x5c\x24\x10", 5, 5, ShvEmulSub, 4, 0x00, 0x03, 0x04, 0xff, 0, 0, 0x10, 0x0, "cs sub DWORD PTR [rsp+0x10],ebx" },
+	{ "\x2e\x64\x29\x24\x1d\x40\x00\x00\x00", 9, 9, ShvEmulSub, 4, 0x00, 0x04, 0xff, 0x03, 1, 1, 0x40, 0x0, "cs sub DWORD PTR fs:[rbx*1+0x40],esp" },
+	{ "\x29\x71\x80", 3, 3, ShvEmulSub, 4, 0x00, 0x06, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "sub DWORD PTR [rcx-0x80],esi" },
+	{ "\xf3\x29\x3c\x24", 4, 4, ShvEmulSub, 4, 0x00, 0x07, 0x04, 0xff, 0, 0, 0x0, 0x0, "repz sub DWORD PTR [rsp],edi" },
+	{ "\x67\x29\x4c\x5d\xf8", 5, 5, ShvEmulSub, 4, 0x08, 0x01, 0x05, 0x03, 2, 0, 0xfffffff8, 0x0, "sub DWORD PTR [ebp+ebx*2-0x8],ecx" },
+	{ "\x67\x4f\x29\x1c\x20", 5, 5, ShvEmulSub, 8, 0x0c, 0x0b, 0x08, 0x0c, 1, 0, 0x0, 0x0, "sub QWORD PTR [r8d+r12d*1],r11" },
+	{ "\x65\x4c\x29\x81\x00\x10\x00\x00", 8, 8, ShvEmulSub, 8, 0x04, 0x08, 0x01, 0xff, 0, 2, 0x1000, 0x0, "sub QWORD PTR gs:[rcx+0x1000],r8" },
+	{ "\xf2\x40\x29\x1c\xcd\x40\x00\x00\x00", 9, 9, ShvEmulSub, 4, 0x04, 0x03, 0xff, 0x01, 8, 0, 0x40, 0x0, "repnz rex sub DWORD PTR [rcx*8+0x40],ebx" },
+	{ "\xf2\x48\x29\x08", 4, 4, ShvEmulSub, 8, 0x04, 0x01, 0x00, 0xff, 0, 0, 0x0, 0x0, "repnz sub QWORD PTR [rax],rcx" },
+	{ "\x30\x00", 2, 2, ShvEmulXor, 1, 0x00, 0x00, 0x00, 0xff, 0, 0, 0x0, 0x0, "xor BYTE PTR [rax],al" },
+	{ "\x30\x0b", 2, 2, ShvEmulXor, 1, 0x00, 0x01, 0x03, 0xff, 0, 0, 0x0, 0x0, "xor BYTE PTR [rbx],cl" },
+	{ "\x30\x1e", 2, 2, ShvEmulXor, 1, 0x00, 0x03, 0x06, 0xff, 0, 0, 0x0, 0x0, "xor BYTE PTR [rsi],bl" },
+	{ "\x30\x17", 2, 2, ShvEmulXor, 1, 0x00, 0x02, 0x07, 0xff, 0, 0, 0x0, 0x0, "xor BYTE PTR [rdi],dl" },
+	{ "\x30\x25\x10\x00\x00\x00", 6, 6, ShvEmulXor, 1, 0x00, 0x04, 0x10, 0xff, 0, 0, 0x10, 0x0, "xor BYTE PTR [rip+0x10],ah # 0x2976" },
+	{ "\x30\x0d\xf0\xff\xff\xff", 6, 6, ShvEmulXor, 1, 0x00, 0x01, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "xor BYTE PTR [rip+0xfffffffffffffff0],cl # 0x2976" },
+	{ "\x30\x24\x24", 3, 3, ShvEmulXor, 1, 0x00, 0x04, 0x04, 0xff, 0, 0, 0x0, 0x0, "xor BYTE PTR [rsp],ah" },
+	{ "\x30\x1c\x98", 3, 3, ShvEmulXor, 1, 0x00, 0x03, 0x00, 0x03, 4, 0, 0x0, 0x0, "xor BYTE PTR [rax+rbx*4],bl" },
+	{ "\x30\x3c\x20", 3, 3, ShvEmulXor, 1, 0x00, 0x07, 0x00, 0xff, 0, 0, 0x0, 0x0, "xor BYTE PTR [rax+riz*1],bh" },
+	{ "\x30\x2c\xa0", 3, 3, ShvEmulXor, 1, 0x00, 0x05, 0x00, 0xff, 0, 0, 0x0, 0x0, "xor BYTE PTR [rax+riz*4],ch" },
+	{ "\x30\x14\x25\x78\x56\x34\x12", 7, 7, ShvEmulXor, 1, 0x00, 0x02, 0xff, 0xff, 0, 0, 0x12345678, 0x0, "xor BYTE PTR ds:0x12345678,dl" },
+	{ "\x30\x2c\x25\xf0\xff\xff\xff", 7, 7, ShvEmulXor, 1, 0x00, 0x05, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "xor BYTE PTR ds:0xfffffffffffffff0,ch" },
+	{ "\x30\x2c\x65\x00\x10\x00\x00", 7, 7, ShvEmulXor, 1, 0x00, 0x05, 0xff, 0xff, 0, 0, 0x1000, 0x0, "xor BYTE PTR [riz*2+0x1000],ch" },
+	{ "\x30\x14\xcd\x40\x00\x00\x00", 7, 7, ShvEmulXor, 1, 0x00, 0x02, 0xff, 0x01, 8, 0, 0x40, 0x0, "xor BYTE PTR [rcx*8+0x40],dl" },
+	{ "\x30\x24\x1d\x40\x00\x00\x00", 7, 7, ShvEmulXor, 1, 0x00, 0x04, 0xff, 0x03, 1, 0, 0x40, 0x0, "xor BYTE PTR [rbx*1+0x40],ah" },
+	{ "\x30\x68\x7f", 3, 3, ShvEmulXor, 1, 0x00, 0x05, 0x00, 0xff, 0, 0, 0x7f, 0x0, "xor BYTE PTR [rax+0x7f],ch" },
+	{ "\x30\x59\x80", 3, 3, ShvEmulXor, 1, 0x00, 0x03, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "xor BYTE PTR [rcx-0x80],bl" },
+	{ "\x30\x7d\x08", 3, 3, ShvEmulXor, 1, 0x00, 0x07, 0x05, 0xff, 0, 0, 0x8, 0x0, "xor BYTE PTR [rbp+0x8],bh" },
+	{ "\x30\x5c\x24\x10", 4, 4, ShvEmulXor, 1, 0x00, 0x03, 0x04, 0xff, 0, 0, 0x10, 0x0, "xor BYTE PTR [rsp+0x10],bl" },
+	{ "\x30\x64\x5d\xf8", 4, 4, ShvEmulXor, 1, 0x00, 0x04, 0x05, 0x03, 2, 0, 0xfffffffffffffff8, 0x0, "xor BYTE PTR [rbp+rbx*2-0x8],ah" },
+	{ "\x30\x81\x00\x10\x00\x00", 6, 6, ShvEmulXor, 1, 0x00, 0x00, 0x01, 0xff, 0, 0, 0x1000, 0x0, "xor BYTE PTR [rcx+0x1000],al" },
+	{ "\x30\xad\x00\x00\x00\x80", 6, 6, ShvEmulXor, 1, 0x00, 0x05, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x0, "xor BYTE PTR [rbp-0x80000000],ch" },
+	{ "\x30\x9c\xe5\x44\x33\x22\x11", 7, 7, ShvEmulXor, 1, 0x00, 0x03, 0x05, 0xff, 0, 0, 0x11223344, 0x0, "xor BYTE PTR [rbp+riz*8+0x11223344],bl" },
+	{ "\x30\xe0", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "xor al,ah" },
+	{ "\x30\xff", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "xor bh,bh" },
+	{ "\xf0\x66\x30\x59\x80", 5, 5, ShvEmulXor, 1, 0x01, 0x03, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "lock data16 xor BYTE PTR [rcx-0x80],bl" },
+	{ "\xf2\xf3\x30\xbd\x00\x00\x00\x80", 8, 8, ShvEmulXor, 1, 0x00, 0x07, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x0, "repnz repz xor BYTE PTR [rbp-0x80000000],bh" },
+	{ "\x66\x67\x30\x3c\x65\x00\x10\x00\x00", 9, 9, ShvEmulXor, 1, 0x08, 0x07, 0xff, 0xff, 0, 0, 0x1000, 0x0, "data16 xor BYTE PTR [eiz*2+0x1000],bh" },
+	{ "\xf2\x30\x5c\x5d\xf8", 5, 5, ShvEmulXor, 1, 0x00, 0x03, 0x05, 0x03, 2, 0, 0xfffffffffffffff8, 0x0, "repnz xor BYTE PTR [rbp+rbx*2-0x8],bl" },
+	{ "\xf3\x66\x30\x2c\x25\x78\x56\x34\x12", 9, 9, ShvEmulXor, 1, 0x00, 0x05, 0xff, 0xff, 0, 0, 0x12345678, 0x0, "repz data16 xor BYTE PTR ds:0x12345678,ch" },
+	{ "\x26\x30\x14\x65\x00\x10\x00\x00", 8, 8, ShvEmulXor, 1, 0x00, 0x02, 0xff, 0xff, 0, 0, 0x1000, 0x0, "es xor BYTE PTR [riz*2+0x1000],dl" },
+	{ "\x67\x30\x30", 3, 3, ShvEmulXor, 1, 0x08, 0x06, 0x00, 0xff, 0, 0, 0x0, 0x0, "xor BYTE PTR [eax],dh" },
+	{ "\x2e\x30\x9d\x00\x00\x00\x80", 7, 7, ShvEmulXor, 1, 0x00, 0x03, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x0, "cs xor BYTE PTR [rbp-0x80000000],bl" },
+	{ "\x3e\x30\x99\x00\x10\x00\x00", 7, 7, ShvEmulXor, 1, 0x00, 0x03, 0x01, 0xff, 0, 0, 0x1000, 0x0, "ds xor BYTE PTR [rcx+0x1000],bl" },
+	{ "\x66\xf2\x30\x81\x00\x10\x00\x00", 8, 8, ShvEmulXor, 1, 0x00, 0x00, 0x01, 0xff, 0, 0, 0x1000, 0x0, "data16 repnz xor BYTE PTR [rcx+0x1000],al" },
+	{ "\xf0\x65\x67\x30\x05\x10\x00\x00\x00", 9, 9, ShvEmulXor, 1, 0x09, 0x00, 0x10, 0xff, 0, 2, 0x10, 0x0, "lock xor BYTE PTR gs:[eip+0x10],al # 0x2d59" },
+	{ "\xf0\xf0\x30\x1c\x25\xf0\xff\xff\xff", 9, 9, ShvEmulXor, 1, 0x01, 0x03, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "lock lock xor BYTE PTR ds:0xfffffffffffffff0,bl" },
+	{ "\x64\x42\x30\x0c\x24", 5, 5, ShvEmulXor, 1, 0x04, 0x01, 0x04, 0x0c, 1, 1, 0x0, 0x0, "xor BYTE PTR fs:[rsp+r12*1],cl" },
+	{ "\xf2\x40\x30\x3c\x25\x78\x56\x34\x12", 9, 9, ShvEmulXor, 1, 0x04, 0x07, 0xff, 0xff, 0, 0, 0x12345678, 0x0, "repnz xor BYTE PTR ds:0x12345678,dil" },
+	{ "\x66\x41\x30\x0c\x65\x00\x10\x00\x00", 9, 9, ShvEmulXor, 1, 0x04, 0x01, 0xff, 0xff, 0, 0, 0x1000, 0x0, "data16 xor BYTE PTR [riz*2+0x1000],cl" },
+	{ "\x44\x30\x41\x80", 4, 4, ShvEmulXor, 1, 0x04, 0x08, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "xor BYTE PTR [rcx-0x80],r8b" },
+	{ "\x31\x18", 2, 2, ShvEmulXor, 4, 0x00, 0x03, 0x00, 0xff, 0, 0, 0x0, 0x0, "xor DWORD PTR [rax],ebx" },
+	{ "\x31\x23", 2, 2, ShvEmulXor, 4, 0x00, 0x04, 0x03, 0xff, 0, 0, 0x0, 0x0, "xor DWORD PTR [rbx],esp" },
+	{ "\x31\x3e", 2, 2, ShvEmulXor, 4, 0x00, 0x07, 0x06, 0xff, 0, 0, 0x0, 0x0, "xor DWORD PTR [rsi],edi" },
+	{ "\x31\x3f", 2, 2, ShvEmulXor, 4, 0x00, 0x07, 0x07, 0xff, 0, 0, 0x0, 0x0, "xor DWORD PTR [rdi],edi" },
+	{ "\x31\x2d\x10\x00\x00\x00", 6, 6, ShvEmulXor, 4, 0x00, 0x05, 0x10, 0xff, 0, 0, 0x10, 0x0, "xor DWORD PTR [rip+0x10],ebp # 0x2e96" },
+	{ "\x31\x3d\xf0\xff\xff\xff", 6, 6, ShvEmulXor, 4, 0x00, 0x07, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "xor DWORD PTR [rip+0xfffffffffffffff0],edi # 0x2e96" },
+	{ "\x31\x2c\x24", 3, 3, ShvEmulXor, 4, 0x00, 0x05, 0x04, 0xff, 0, 0, 0x0, 0x0, "xor DWORD PTR [rsp],ebp" },
+	{ "\x31\x2c\x98", 3, 3, ShvEmulXor, 4, 0x00, 0x05, 0x00, 0x03, 4, 0, 0x0, 0x0, "xor DWORD PTR [rax+rbx*4],ebp" },
+	{ "\x31\x2c\x20", 3, 3, ShvEmulXor, 4, 0x00, 0x05, 0x00, 0xff, 0, 0, 0x0, 0x0, "xor DWORD PTR [rax+riz*1],ebp" },
+	{ "\x31\x3c\xa0", 3, 3, ShvEmulXor, 4, 0x00, 0x07, 0x00, 0xff, 0, 0, 0x0, 0x0, "xor DWORD PTR [rax+riz*4],edi" },
+	{ "\x31\x2c\x25\x78\x56\x34\x12", 7, 7, ShvEmulXor, 4, 0x00, 0x05, 0xff, 0xff, 0, 0, 0x12345678, 0x0, "xor DWORD PTR ds:0x12345678,ebp" },
+	{ "\x31\x3c\x25\xf0\xff\xff\xff", 7, 7, ShvEmulXor, 4, 0x00, 0x07, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "xor DWORD PTR ds:0xfffffffffffffff0,edi" },
+	{ "\x31\x14\x65\x00\x10\x00\x00", 7, 7, ShvEmulXor, 4, 0x00, 0x02, 0xff, 0xff, 0, 0, 0x1000, 0x0, "xor DWORD PTR [riz*2+0x1000],edx" },
+	{ "\x31\x1c\xcd\x40\x00\x00\x00", 7, 7, ShvEmulXor, 4, 0x00, 0x03, 0xff, 0x01, 8, 0, 0x40, 0x0, "xor DWORD PTR [rcx*8+0x40],ebx" },
+	{ "\x31\x34\x1d\x40\x00\x00\x00", 7, 7, ShvEmulXor, 4, 0x00, 0x06, 0xff, 0x03, 1, 0, 0x40, 0x0, "xor DWORD PTR [rbx*1+0x40],esi" },
+	{ "\x31\x48\x7f", 3, 3, ShvEmulXor, 4, 0x00, 0x01, 0x00, 0xff, 0, 0, 0x7f, 0x0, "xor DWORD PTR [rax+0x7f],ecx" },
+	{ "\x31\x51\x80", 3, 3, ShvEmulXor, 4, 0x00, 0x02, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "xor DWORD PTR [rcx-0x80],edx" },
+	{ "\x31\x6d\x08", 3, 3, ShvEmulXor, 4, 0x00, 0x05, 0x05, 0xff, 0, 0, 0x8, 0x0, "xor DWORD PTR [rbp+0x8],ebp" },
+	{ "\x31\x44\x24\x10", 4, 4, ShvEmulXor, 4, 0x00, 0x00, 0x04, 0xff, 0, 0, 0x10, 0x0, "xor DWORD PTR [rsp+0x10],eax" },
+	{ "\x31\x54\x5d\xf8", 4, 4, ShvEmulXor, 4, 0x00, 0x02, 0x05, 0x03, 2, 0, 0xfffffffffffffff8, 0x0, "xor DWORD PTR [rbp+rbx*2-0x8],edx" },
+	{ "\x31\xa9\x00\x10\x00\x00", 6, 6, ShvEmulXor, 4, 0x00, 0x05, 0x01, 0xff, 0, 0, 0x1000, 0x0, "xor DWORD PTR [rcx+0x1000],ebp" },
+	{ "\x31\x85\x00\x00\x00\x80", 6, 6, ShvEmulXor, 4, 0x00, 0x00, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x0, "xor DWORD PTR [rbp-0x80000000],eax" },
+	{ "\x31\xa4\xe5\x44\x33\x22\x11", 7, 7, ShvEmulXor, 4, 0x00, 0x04, 0x05, 0xff, 0, 0, 0x11223344, 0x0, "xor DWORD PTR [rbp+riz*8+0x11223344],esp" },
+	{ "\x31\xc0", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "xor eax,eax" },
+	{ "\x31\xff", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "xor edi,edi" },
+	{ "\xf0\x31\x10", 3, 3, ShvEmulXor, 4, 0x01, 0x02, 0x00, 0xff, 0, 0, 0x0, 0x0, "lock xor DWORD PTR [rax],edx" },
+	{ "\x66\x66\x31\x04\x98", 5, 5, ShvEmulXor, 2, 0x00, 0x00, 0x00, 0x03, 4, 0, 0x0, 0x0, "data16 xor WORD PTR [rax+rbx*4],ax" },
+	{ "\xf3\x66\x31\x24\x20", 5, 5, ShvEmulXor, 2, 0x00, 0x04, 0x00, 0xff, 0, 0, 0x0, 0x0, "repz xor WORD PTR [rax+riz*1],sp" },
+	{ "\xf0\x65\x67\x31\x35\xf0\xff\xff\xff", 9, 9, ShvEmulXor, 4, 0x09, 0x06, 0x10, 0xff, 0, 2, 0xfffffff0, 0x0, "lock xor DWORD PTR gs:[eip+0xfffffffffffffff0],esi # 0x3179" },
+	{ "\x31\x7c\x5d\xf8", 4, 4, ShvEmulXor, 4, 0x00, 0x07, 0x05, 0x03, 2, 0, 0xfffffffffffffff8, 0x0, "xor DWORD PTR [rbp+rbx*2-0x8],edi" },
+	{ "\x36\x31\x64\x24\x10", 5, 5, ShvEmulXor, 4, 0x00, 0x04, 0x04, 0xff, 0, 0, 0x10, 0x0, "ss xor DWORD PTR [rsp+0x10],esp" },
+	{ "\x65\x2e\x31\x24\x1d\x40\x00\x00\x00", 9, 9, ShvEmulXor, 4, 0x00, 0x04, 0xff, 0x03, 1, 2, 0x40, 0x0, "gs xor DWORD PTR gs:[rbx*1+0x40],esp" },
+	{ "\x2e\x31\xb1\x00\x10\x00\x00", 7, 7, ShvEmulXor, 4, 0x00, 0x06, 0x01, 0xff, 0, 0, 0x1000, 0x0, "cs xor DWORD PTR [rcx+0x1000],esi" },
+	{ "\x26\x31\x79\x80", 4, 4, ShvEmulXor, 4, 0x00, 0x07, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "es xor DWORD PTR [rcx-0x80],edi" },
+	{ "\xf3\xf2\x31\x8d\x00\x00\x00\x80", 8, 8, ShvEmulXor, 4, 0x00, 0x01, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x0, "repz repnz xor DWORD PTR [rbp-0x80000000],ecx" },
+	{ "\x66\x67\x31\x61\x80", 5, 5, ShvEmulXor, 2, 0x08, 0x04, 0x01, 0xff, 0, 0, 0xffffff80, 0x0, "xor WORD PTR [ecx-0x80],sp" },
+	{ "\x64\x65\x31\x0f", 4, 4, ShvEmulXor, 4, 0x00, 0x01, 0x07, 0xff, 0, 2, 0x0, 0x0, "fs xor DWORD PTR gs:[rdi],ecx" },
+	{ "\x65\x48\x31\x04\x25\xf0\xff\xff\xff", 9, 9, ShvEmulXor, 8, 0x04, 0x00, 0xff, 0xff, 0, 2, 0xfffffffffffffff0, 0x0, "xor QWORD PTR gs:0xfffffffffffffff0,rax" },
+	{ "\xf3\x41\x31\x1c\x25\x78\x56\x34\x12", 9, 9, ShvEmulXor, 4, 0x04, 0x03, 0xff, 0xff, 0, 0, 0x12345678, 0x0, "repz xor DWORD PTR ds:0x12345678,ebx" },
+	{ "\x65\x44\x31\x14\x1d\x40\x00\x00\x00", 9, 9, ShvEmulXor, 4, 0x04, 0x0a, 0xff, 0x03, 1, 2, 0x40, 0x0, "xor DWORD PTR gs:[rbx*1+0x40],r10d" },
+	{ "\x67\x4c\x31\x6c\x5d\xf8", 6, 6, ShvEmulXor, 8, 0x0c, 0x0d, 0x05, 0x03, 2, 0, 0xfffffff8, 0x0, "xor QWORD PTR [ebp+ebx*2-0x8],r13" },
+	{ "\x80\x30\xf0", 3, 3, ShvEmulXor, 1, 0x00, 0xff, 0x00, 0xff, 0, 0, 0x0, 0xf0, "xor BYTE PTR [rax],0xf0" },
+	{ "\x80\x2b\x34", 3, 3, ShvEmulSub, 1, 0x00, 0xff, 0x03, 0xff, 0, 0, 0x0, 0x34, "sub BYTE PTR [rbx],0x34" },
+	{ "\x80\x26\xf0", 3, 3, ShvEmulAnd, 1, 0x00, 0xff, 0x06, 0xff, 0, 0, 0x0, 0xf0, "and BYTE PTR [rsi],0xf0" },
+	{ "\x80\x1f\xf0", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "sbb BYTE PTR [rdi],0xf0" },
+	{ "\x80\x0d\x10\x00\x00\x00\x7f", 7, 7, ShvEmulOr, 1, 0x00, 0xff, 0x10, 0xff, 0, 0, 0x10, 0x7f, "or BYTE PTR [rip+0x10],0x7f # 0x33b7" },
+	{ "\x80\x0d\xf0\xff\xff\xff\x7f", 7, 7, ShvEmulOr, 1, 0x00, 0xff, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x7f, "or BYTE PTR [rip+0xfffffffffffffff0],0x7f # 0x33b7" },
+	{ "\x80\x14\x24\x7f", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "adc BYTE PTR [rsp],0x7f" },
+	{ "\x80\x1c\x98\x34", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "sbb BYTE PTR [rax+rbx*4],0x34" },
+	{ "\x80\x04\x20\x34", 4, 4, ShvEmulAdd, 1, 0x00, 0xff, 0x00, 0xff, 0, 0, 0x0, 0x34, "add BYTE PTR [rax+riz*1],0x34" },
+	{ "\x80\x24\xa0\x34", 4, 4, ShvEmulAnd, 1, 0x00, 0xff, 0x00, 0xff, 0, 0, 0x0, 0x34, "and BYTE PTR [rax+riz*4],0x34" },
+	{ "\x80\x1c\x25\x78\x56\x34\x12\x7f", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "sbb BYTE PTR ds:0x12345678,0x7f" },
+	{ "\x80\x04\x25\xf0\xff\xff\xff\xf0", 8, 8, ShvEmulAdd, 1, 0x00, 0xff, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0xf0, "add BYTE PTR ds:0xfffffffffffffff0,0xf0" },
+	{ "\x80\x14\x65\x00\x10\x00\x00\x7f", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "adc BYTE PTR [riz*2+0x1000],0x7f" },
+	{ "\x80\x24\xcd\x40\x00\x00\x00\x7f", 8, 8, ShvEmulAnd, 1, 0x00, 0xff, 0xff, 0x01, 8, 0, 0x40, 0x7f, "and BYTE PTR [rcx*8+0x40],0x7f" },
+	{ "\x80\x0c\x1d\x40\x00\x00\x00\x34", 8, 8, ShvEmulOr, 1, 0x00, 0xff, 0xff, 0x03, 1, 0, 0x40, 0x34, "or BYTE PTR [rbx*1+0x40],0x34" },
+	{ "\x80\x68\x7f\x7f", 4, 4, ShvEmulSub, 1, 0x00, 0xff, 0x00, 0xff, 0, 0, 0x7f, 0x7f, "sub BYTE PTR [rax+0x7f],0x7f" },
+	{ "\x80\x41\x80\xf0", 4, 4, ShvEmulAdd, 1, 0x00, 0xff, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0xf0, "add BYTE PTR [rcx-0x80],0xf0" },
+	{ "\x80\x65\x08\xf0", 4, 4, ShvEmulAnd, 1, 0x00, 0xff, 0x05, 0xff, 0, 0, 0x8, 0xf0, "and BYTE PTR [rbp+0x8],0xf0" },
+	{ "\x80\x6c\x24\x10\x34", 5, 5, ShvEmulSub, 1, 0x00, 0xff, 0x04, 0xff, 0, 0, 0x10, 0x34, "sub BYTE PTR [rsp+0x10],0x34" },
+	{ "\x80\x4c\x5d\xf8\xf0", 5, 5, ShvEmulOr, 1, 0x00, 0xff, 0x05, 0x03, 2, 0, 0xfffffffffffffff8, 0xf0, "or BYTE PTR [rbp+rbx*2-0x8],0xf0" },
+	{ "\x80\x89\x00\x10\x00\x00\x7f", 7, 7, ShvEmulOr, 1, 0x00, 0xff, 0x01, 0xff, 0, 0, 0x1000, 0x7f, "or BYTE PTR [rcx+0x1000],0x7f" },
+	{ "\x80\xb5\x00\x00\x00\x80\x7f", 7, 7, ShvEmulXor, 1, 0x00, 0xff, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x7f, "xor BYTE PTR [rbp-0x80000000],0x7f" },
+	{ "\x80\x94\xe5\x44\x33\x22\x11\x34", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "adc BYTE PTR [rbp+riz*8+0x11223344],0x34" },
+	{ "\x80\xe8\x7f", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "sub al,0x7f" },
+	{ "\x80\xd7\x7f", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "adc bh,0x7f" },
+	{ "\xf3\x66\x80\x70\x7f\x34", 6, 6, ShvEmulXor, 1, 0x00, 0xff, 0x00, 0xff, 0, 0, 0x7f, 0x34, "repz data16 xor BYTE PTR [rax+0x7f],0x34" },
+	{ "\x65\x2e\x80\x25\x10\x00\x00\x00\x34", 9, 9, ShvEmulAnd, 1, 0x00, 0xff, 0x10, 0xff, 0, 2, 0x10, 0x34, "gs and BYTE PTR gs:[rip+0x10],0x34 # 0x3679" },
+	{ "\x64\x80\x24\x24\x34", 5, 5, ShvEmulAnd, 1, 0x00, 0xff, 0x04, 0xff, 0, 1, 0x0, 0x34, "and BYTE PTR fs:[rsp],0x34" },
+	{ "\x66\x67\x80\x6d\x08\x7f", 6, 6, ShvEmulSub, 1, 0x08, 0xff, 0x05, 0xff, 0, 0, 0x8, 0x7f, "data16 sub BYTE PTR [ebp+0x8],0x7f" },
+	{ "\xf0\x80\x2c\x25\x78\x56\x34\x12\x7f", 9, 9, ShvEmulSub, 1, 0x01, 0xff, 0xff, 0xff, 0, 0, 0x12345678, 0x7f, "lock sub BYTE PTR ds:0x12345678,0x7f" },
+	{ "\xf0\xf0\x80\x04\x25\xf0\xff\xff\xff\x7f", 10, 10, ShvEmulAdd, 1, 0x01, 0xff, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x7f, "lock lock add BYTE PTR ds:0xfffffffffffffff0,0x7f" },
+	{ "\x66\x66\x80\xb9\x00\x10\x00\x00\xf0", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 data16 cmp BYTE PTR [rcx+0x1000],0xf0" },
+	{ "\x66\xf2\x80\x7c\x5d\xf8\xf0", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 repnz cmp BYTE PTR [rbp+rbx*2-0x8],0xf0" },
+	{ "\x2e\x80\x60\x7f\x34", 5, 5, ShvEmulAnd, 1, 0x00, 0xff, 0x00, 0xff, 0, 0, 0x7f, 0x34, "cs and BYTE PTR [rax+0x7f],0x34" },
+	{ "\x26\x80\x0c\xa0\xf0", 5, 5, ShvEmulOr, 1, 0x00, 0xff, 0x00, 0xff, 0, 0, 0x0, 0xf0, "es or BYTE PTR [rax+riz*4],0xf0" },
+	{ "\xf2\xf3\x80\x1f\x34", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz repz sbb BYTE PTR [rdi],0x34" },
+	{ "\xf3\x80\x24\x1d\x40\x00\x00\x00\xf0", 9, 9, ShvEmulAnd, 1, 0x00, 0xff, 0xff, 0x03, 1, 0, 0x40, 0xf0, "repz and BYTE PTR [rbx*1+0x40],0xf0" },
+	{ "\xf3\x4f\x80\x20\xf0", 5, 5, ShvEmulAnd, 1, 0x04, 0xff, 0x08, 0xff, 0, 0, 0x0, 0xf0, "repz rex.WRXB and BYTE PTR [r8],0xf0" },
+	{ "\xf3\x44\x80\x20\xf0", 5, 5, ShvEmulAnd, 1, 0x04, 0xff, 0x00, 0xff, 0, 0, 0x0, 0xf0, "repz rex.R and BYTE PTR [rax],0xf0" },
+	{ "\x64\x41\x80\x69\x80\x7f", 6, 6, ShvEmulSub, 1, 0x04, 0xff, 0x09, 0xff, 0, 1, 0xffffffffffffff80, 0x7f, "sub BYTE PTR fs:[r9-0x80],0x7f" },
+	{ "\xf3\x48\x80\x06\x7f", 5, 5, ShvEmulAdd, 1, 0x04, 0xff, 0x06, 0xff, 0, 0, 0x0, 0x7f, "repz rex.W add BYTE PTR [rsi],0x7f" },
+	{ "\x81\x20\xf0\xff\xff\xff", 6, 6, ShvEmulAnd, 4, 0x00, 0xff, 0x00, 0xff, 0, 0, 0x0, 0xfffffff0, "and DWORD PTR [rax],0xfffffff0" },
+	{ "\x81\x23\x7f\x80\xff\x01", 6, 6, ShvEmulAnd, 4, 0x00, 0xff, 0x03, 0xff, 0, 0, 0x0, 0x1ff807f, "and DWORD PTR [rbx],0x1ff807f" },
+	{ "\x81\x36\x34\x12\x00\x00", 6, 6, ShvEmulXor, 4, 0x00, 0xff, 0x06, 0xff, 0, 0, 0x0, 0x1234, "xor DWORD PTR [rsi],0x1234" },
+	{ "\x81\x3f\xf0\xff\xff\xff", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmp DWORD PTR [rdi],0xfffffff0" },
+	{ "\x81\x05\x10\x00\x00\x00\x34\x12\x00\x00", 10, 10, ShvEmulAdd, 4, 0x00, 0xff, 0x10, 0xff, 0, 0, 0x10, 0x1234, "add DWORD PTR [rip+0x10],0x1234 # 0x38da" },
+	{ "\x81\x0d\xf0\xff\xff\xff\x34\x12\x00\x00", 10, 10, ShvEmulOr, 4, 0x00, 0xff, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x1234, "or DWORD PTR [rip+0xfffffffffffffff0],0x1234 # 0x38da" },
+	{ "\x81\x2c\x24\x7f\x80\xff\x01", 7, 7, ShvEmulSub, 4, 0x00, 0xff, 0x04, 0xff, 0, 0, 0x0, 0x1ff807f, "sub DWORD PTR [rsp],0x1ff807f" },
+	{ "\x81\x14\x98\xf0\xff\xff\xff", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "adc DWORD PTR [rax+rbx*4],0xfffffff0" },
+	{ "\x81\x3c\x20\xf0\xff\xff\xff", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmp DWORD PTR [rax+riz*1],0xfffffff0" },
+	{ "\x81\x24\xa0\x34\x12\x00\x00", 7, 7, ShvEmulAnd, 4, 0x00, 0xff, 0x00, 0xff, 0, 0, 0x0, 0x1234, "and DWORD PTR [rax+riz*4],0x1234" },
+	{ "\x81\x04\x25\x78\x56\x34\x12\x34\x12\x00\x00", 11, 11, ShvEmulAdd, 4, 0x00, 0xff, 0xff, 0xff, 0, 0, 0x12345678, 0x1234, "add DWORD PTR ds:0x12345678,0x1234" },
+	{ "\x81\x14\x25\xf0\xff\xff\xff\xf0\xff\xff\xff", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "adc DWORD PTR ds:0xfffffffffffffff0,0xfffffff0" },
+	{ "\x81\x2c\x65\x00\x10\x00\x00\x7f\x80\xff\x01", 11, 11, ShvEmulSub, 4, 0x00, 0xff, 0xff, 0xff, 0, 0, 0x1000, 0x1ff807f, "sub DWORD PTR [riz*2+0x1000],0x1ff807f" },
+	{ "\x81\x3c\xcd\x40\x00\x00\x00\x7f\x80\xff\x01", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmp DWORD PTR [rcx*8+0x40],0x1ff807f" },
+	{ "\x81\x0c\x1d\x40\x00\x00\x00\xf0\xff\xff\xff", 11, 11, ShvEmulOr, 4, 0x00, 0xff, 0xff, 0x03, 1, 0, 0x40, 0xfffffff0, "or DWORD PTR [rbx*1+0x40],0xfffffff0" },
+	{ "\x81\x58\x7f\x34\x12\x00\x00", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "sbb DWORD PTR [rax+0x7f],0x1234" },
+	{ "\x81\x61\x80\xf0\xff\xff\xff", 7, 7, ShvEmulAnd, 4, 0x00, 0xff, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0xfffffff0, "and DWORD PTR [rcx-0x80],0xfffffff0" },
+	{ "\x81\x65\x08\xf0\xff\xff\xff", 7, 7, ShvEmulAnd, 4, 0x00, 0xff, 0x05, 0xff, 0, 0, 0x8, 0xfffffff0, "and DWORD PTR [rbp+0x8],0xfffffff0" },
+	{ "\x81\x4c\x24\x10\x7f\x80\xff\x01", 8, 8, ShvEmulOr, 4, 0x00, 0xff, 0x04, 0xff, 0, 0, 0x10, 0x1ff807f, "or DWORD PTR [rsp+0x10],0x1ff807f" },
+	{ "\x81\x44\x5d\xf8\x7f\x80\xff\x01", 8, 8, ShvEmulAdd, 4, 0x00, 0xff, 0x05, 0x03, 2, 0, 0xfffffffffffffff8, 0x1ff807f, "add DWORD PTR [rbp+rbx*2-0x8],0x1ff807f" },
+	{ "\x81\xb1\x00\x10\x00\x00\xf0\xff\xff\xff", 10, 10, ShvEmulXor, 4, 0x00, 0xff, 0x01, 0xff, 0, 0, 0x1000, 0xfffffff0, "xor DWORD PTR [rcx+0x1000],0xfffffff0" },
+	{ "\x81\x95\x00\x00\x00\x80\x7f\x80\xff\x01", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "adc DWORD PTR [rbp-0x80000000],0x1ff807f" },
+	{ "\x81\xbc\xe5\x44\x33\x22\x11\x34\x12\x00\x00", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmp DWORD PTR [rbp+riz*8+0x11223344],0x1234" },
+	{ "\x81\xc0\xf0\xff\xff\xff", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "add eax,0xfffffff0" },
+	{ "\x81\xdf\x34\x12\x00\x00", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "sbb edi,0x1234" },
+	{ "\x2e\x81\x0c\x24\x7f\x80\xff\x01", 8, 8, ShvEmulOr, 4, 0x00, 0xff, 0x04, 0xff, 0, 0, 0x0, 0x1ff807f, "cs or DWORD PTR [rsp],0x1ff807f" },
+	{ "\x66\x81\x2c\x1d\x40\x00\x00\x00\xf0\xff", 10, 10, ShvEmulSub, 2, 0x00, 0xff, 0xff, 0x03, 1, 0, 0x40, 0xfff0, "sub WORD PTR [rbx*1+0x40],0xfff0" },
+	{ "\xf3\x66\x81\x34\x20\xf0\xff", 7, 7, ShvEmulXor, 2, 0x00, 0xff, 0x00, 0xff, 0, 0, 0x0, 0xfff0, "repz xor WORD PTR [rax+riz*1],0xfff0" },
+	{ "\xf0\xf0\x81\x1c\x98\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock lock sbb DWORD PTR [rax+rbx*4],0xfffffff0" },
+	{ "\x3e\x81\x7d\x08\x34\x12\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ds cmp DWORD PTR [rbp+0x8],0x1234" },
+	{ "\x65\x2e\x81\x44\x24\x10\x7f\x80\xff\x01", 10, 10, ShvEmulAdd, 4, 0x00, 0xff, 0x04, 0xff, 0, 2, 0x10, 0x1ff807f, "gs add DWORD PTR gs:[rsp+0x10],0x1ff807f" },
+	{ "\x26\x81\x0e\x34\x12\x00\x00", 7, 7, ShvEmulOr, 4, 0x00, 0xff, 0x06, 0xff, 0, 0, 0x0, 0x1234, "es or DWORD PTR [rsi],0x1234" },
+	{ "\x36\x81\x2c\x98\x34\x12\x00\x00", 8, 8, ShvEmulSub, 4, 0x00, 0xff, 0x00, 0x03, 4, 0, 0x0, 0x1234, "ss sub DWORD PTR [rax+rbx*4],0x1234" },
+	{ "\x67\x81\x74\x5d\xf8\xf0\xff\xff\xff", 9, 9, ShvEmulXor, 4, 0x08, 0xff, 0x05, 0x03, 2, 0, 0xfffffff8, 0xfffffff0, "xor DWORD PTR [ebp+ebx*2-0x8],0xfffffff0" },
+	{ "\xf3\x81\x0c\x25\x78\x56\x34\x12\x34\x12\x00\x00", 12, 12, ShvEmulOr, 4, 0x00, 0xff, 0xff, 0xff, 0, 0, 0x12345678, 0x1234, "repz or DWORD PTR ds:0x12345678,0x1234" },
+	{ "\x2e\x64\x81\x8d\x00\x00\x00\x80\x34\x12\x00\x00", 12, 12, ShvEmulOr, 4, 0x00, 0xff, 0x05, 0xff, 0, 1, 0xffffffff80000000, 0x1234, "cs or DWORD PTR fs:[rbp-0x80000000],0x1234" },
+	{ "\x66\x66\x81\x0d\x10\x00\x00\x00\x7f\x80", 10, 10, ShvEmulOr, 2, 0x00, 0xff, 0x10, 0xff, 0, 0, 0x10, 0x807f, "data16 or WORD PTR [rip+0x10],0x807f # 0x3cda" },
+	{ "\xf2\x41\x81\x7c\x5d\xf8\xf0\xff\xff\xff", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz cmp DWORD PTR [r13+rbx*2-0x8],0xfffffff0" },
+	{ "\xf0\x4c\x81\x14\x98\x7f\x80\xff\x01", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock rex.WR adc QWORD PTR [rax+rbx*4],0x1ff807f" },
+	{ "\xf0\x4f\x81\x34\xa0\x34\x12\x00\x00", 9, 9, ShvEmulXor, 8, 0x05, 0xff, 0x08, 0x0c, 4, 0, 0x0, 0x1234, "lock rex.WRXB xor QWORD PTR [r8+r12*4],0x1234" },
+	{ "\x66\x48\x81\x2e\x34\x12\x00\x00", 8, 8, ShvEmulSub, 8, 0x04, 0xff, 0x06, 0xff, 0, 0, 0x0, 0x1234, "data16 sub QWORD PTR [rsi],0x1234" },
+	{ "\x83\x38\x34", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmp DWORD PTR [rax],0x34" },
+	{ "\x83\x23\x34", 3, 3, ShvEmulAnd, 4, 0x00, 0xff, 0x03, 0xff, 0, 0, 0x0, 0x34, "and DWORD PTR [rbx],0x34" },
+	{ "\x83\x36\xf0", 3, 3, ShvEmulXor, 4, 0x00, 0xff, 0x06, 0xff, 0, 0, 0x0, 0xfffffff0, "xor DWORD PTR [rsi],0xfffffff0" },
+	{ "\x83\x07\x7f", 3, 3, ShvEmulAdd, 4, 0x00, 0xff, 0x07, 0xff, 0, 0, 0x0, 0x7f, "add DWORD PTR [rdi],0x7f" },
+	{ "\x83\x1d\x10\x00\x00\x00\x7f", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "sbb DWORD PTR [rip+0x10],0x7f # 0x3df7" },
+	{ "\x83\x15\xf0\xff\xff\xff\xf0", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "adc DWORD PTR [rip+0xfffffffffffffff0],0xfffffff0 # 0x3df7" },
+	{ "\x83\x34\x24\x7f", 4, 4, ShvEmulXor, 4, 0x00, 0xff, 0x04, 0xff, 0, 0, 0x0, 0x7f, "xor DWORD PTR [rsp],0x7f" },
+	{ "\x83\x0c\x98\x34", 4, 4, ShvEmulOr, 4, 0x00, 0xff, 0x00, 0x03, 4, 0, 0x0, 0x34, "or DWORD PTR [rax+rbx*4],0x34" },
+	{ "\x83\x3c\x20\x7f", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmp DWORD PTR [rax+riz*1],0x7f" },
+	{ "\x83\x14\xa0\x34", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "adc DWORD PTR [rax+riz*4],0x34" },
+	{ "\x83\x3c\x25\x78\x56\x34\x12\x7f", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmp DWORD PTR ds:0x12345678,0x7f" },
+	{ "\x83\x34\x25\xf0\xff\xff\xff\x34", 8, 8, ShvEmulXor, 4, 0x00, 0xff, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x34, "xor DWORD PTR ds:0xfffffffffffffff0,0x34" },
+	{ "\x83\x3c\x65\x00\x10\x00\x00\x7f", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmp DWORD PTR [riz*2+0x1000],0x7f" },
+	{ "\x83\x34\xcd\x40\x00\x00\x00\x7f", 8, 8, ShvEmulXor, 4, 0x00, 0xff, 0xff, 0x01, 8, 0, 0x40, 0x7f, "xor DWORD PTR [rcx*8+0x40],0x7f" },
+	{ "\x83\x04\x1d\x40\x00\x00\x00\xf0", 8, 8, ShvEmulAdd, 4, 0x00, 0xff, 0xff, 0x03, 1, 0, 0x40, 0xfffffff0, "add DWORD PTR [rbx*1+0x40],0xfffffff0" },
+	{ "\x83\x78\x7f\xf0", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmp DWORD PTR [rax+0x7f],0xfffffff0" },
+	{ "\x83\x41\x80\x34", 4, 4, ShvEmulAdd, 4, 0x00, 0xff, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x34, "add DWORD PTR [rcx-0x80],0x34" },
+	{ "\x83\x4d\x08\x34", 4, 4, ShvEmulOr, 4, 0x00, 0xff, 0x05, 0xff, 0, 0, 0x8, 0x34, "or DWORD PTR [rbp+0x8],0x34" },
+	{ "\x83\x7c\x24\x10\x7f", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmp DWORD PTR [rsp+0x10],0x7f" },
+	{ "\x83\x5c\x5d\xf8\x34", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "sbb DWORD PTR [rbp+rbx*2-0x8],0x34" },
+	{ "\x83\xb9\x00\x10\x00\x00\x7f", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmp DWORD PTR [rcx+0x1000],0x7f" },
+	{ "\x83\xa5\x00\x00\x00\x80\x34", 7, 7, ShvEmulAnd, 4, 0x00, 0xff, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x34, "and DWORD PTR [rbp-0x80000000],0x34" },
+	{ "\x83\x94\xe5\x44\x33\x22\x11\xf0", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "adc DWORD PTR [rbp+riz*8+0x11223344],0xfffffff0" },
+	{ "\x83\xd0\x34", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "adc eax,0x34" },
+	{ "\x83\xd7\x7f", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "adc edi,0x7f" },
+	{ "\x3e\x83\x14\x1d\x40\x00\x00\x00\x34", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ds adc DWORD PTR [rbx*1+0x40],0x34" },
+	{ "\xf0\xf0\x83\x06\xf0", 5, 5, ShvEmulAdd, 4, 0x01, 0xff, 0x06, 0xff, 0, 0, 0x0, 0xfffffff0, "lock lock add DWORD PTR [rsi],0xfffffff0" },
+	{ "\x64\x83\x0d\xf0\xff\xff\xff\x7f", 8, 8, ShvEmulOr, 4, 0x00, 0xff, 0x10, 0xff, 0, 1, 0xfffffffffffffff0, 0x7f, "or DWORD PTR fs:[rip+0xfffffffffffffff0],0x7f # 0x40b8" },
+	{ "\x66\xf2\x83\x4c\x5d\xf8\xf0", 7, 7, ShvEmulOr, 2, 0x00, 0xff, 0x05, 0x03, 2, 0, 0xfffffffffffffff8, 0xfff0, "repnz or WORD PTR [rbp+rbx*2-0x8],0xfff0" },
+	{ "\xf2\xf3\x83\xbc\xe5\x44\x33\x22\x11\xf0", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz repz cmp DWORD PTR [rbp+riz*8+0x11223344],0xfffffff0" },
+	{ "\x66\x83\xad\x00\x00\x00\x80\x34", 8, 8, ShvEmulSub, 2, 0x00, 0xff, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x34, "sub WORD PTR [rbp-0x80000000],0x34" },
+	{ "\x67\x83\x2e\x34", 4, 4, ShvEmulSub, 4, 0x08, 0xff, 0x06, 0xff, 0, 0, 0x0, 0x34, "sub DWORD PTR [esi],0x34" },
+	{ "\xf0\x65\x67\x83\x20\xf0", 6, 6, ShvEmulAnd, 4, 0x09, 0xff, 0x00, 0xff, 0, 2, 0x0, 0xfffffff0, "lock and DWORD PTR gs:[eax],0xfffffff0" },
+	{ "\x26\x83\x81\x00\x10\x00\x00\x7f", 8, 8, ShvEmulAdd, 4, 0x00, 0xff, 0x01, 0xff, 0, 0, 0x1000, 0x7f, "es add DWORD PTR [rcx+0x1000],0x7f" },
+	{ "\x36\x83\x1c\x1d\x40\x00\x00\x00\x7f", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ss sbb DWORD PTR [rbx*1+0x40],0x7f" },
+	{ "\xf0\x66\x83\x2b\x34", 5, 5, ShvEmulSub, 2, 0x01, 0xff, 0x03, 0xff, 0, 0, 0x0, 0x34, "lock sub WORD PTR [rbx],0x34" },
+	{ "\xf0\x83\x34\x98\x34", 5, 5, ShvEmulXor, 4, 0x01, 0xff, 0x00, 0x03, 4, 0, 0x0, 0x34, "lock xor DWORD PTR [rax+rbx*4],0x34" },
+	{ "\x67\x40\x83\x04\xcd\x40\x00\x00\x00\x7f", 10, 10, ShvEmulAdd, 4, 0x0c, 0xff, 0xff, 0x01, 8, 0, 0x40, 0x7f, "rex add DWORD PTR [ecx*8+0x40],0x7f" },
+	{ "\x65\x41\x83\x3c\x25\x78\x56\x34\x12\x34", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmp DWORD PTR gs:0x12345678,0x34" },
+	{ "\x67\x48\x83\x34\x98\x34", 6, 6, ShvEmulXor, 8, 0x0c, 0xff, 0x00, 0x03, 4, 0, 0x0, 0x34, "xor QWORD PTR [eax+ebx*4],0x34" },
+	{ "\xf0\x42\x83\x2c\x24\xf0", 6, 6, ShvEmulSub, 4, 0x05, 0xff, 0x04, 0x0c, 1, 0, 0x0, 0xfffffff0, "lock sub DWORD PTR [rsp+r12*1],0xfffffff0" },
+	{ "\x86\x10", 2, 2, ShvEmulXchg, 1, 0x00, 0x02, 0x00, 0xff, 0, 0, 0x0, 0x0, "xchg BYTE PTR [rax],dl" },
+	{ "\x86\x23", 2, 2, ShvEmulXchg, 1, 0x00, 0x04, 0x03, 0xff, 0, 0, 0x0, 0x0, "xchg BYTE PTR [rbx],ah" },
+	{ "\x86\x0e", 2, 2, ShvEmulXchg, 1, 0x00, 0x01, 0x06, 0xff, 0, 0, 0x0, 0x0, "xchg BYTE PTR [rsi],cl" },
+	{ "\x86\x1f", 2, 2, ShvEmulXchg, 1, 0x00, 0x03, 0x07, 0xff, 0, 0, 0x0, 0x0, "xchg BYTE PTR [rdi],bl" },
+	{ "\x86\x15\x10\x00\x00\x00", 6, 6, ShvEmulXchg, 1, 0x00, 0x02, 0x10, 0xff, 0, 0, 0x10, 0x0, "xchg BYTE PTR [rip+0x10],dl # 0x4316" },
+	{ "\x86\x0d\xf0\xff\xff\xff", 6, 6, ShvEmulXchg, 1, 0x00, 0x01, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "xchg BYTE PTR [rip+0xfffffffffffffff0],cl # 0x4316" },
+	{ "\x86\x34\x24", 3, 3, ShvEmulXchg, 1, 0x00, 0x06, 0x04, 0xff, 0, 0, 0x0, 0x0, "xchg BYTE PTR [rsp],dh" },
+	{ "\x86\x14\x98", 3, 3, ShvEmulXchg, 1, 0x00, 0x02, 0x00, 0x03, 4, 0, 0x0, 0x0, "xchg BYTE PTR [rax+rbx*4],dl" },
+	{ "\x86\x14\x20", 3, 3, ShvEmulXchg, 1, 0x00, 0x02, 0x00, 0xff, 0, 0, 0x0, 0x0, "xchg BYTE PTR [rax+riz*1],dl" },
+	{ "\x86\x2c\xa0", 3, 3, ShvEmulXchg, 1, 0x00, 0x05, 0x00, 0xff, 0, 0, 0x0, 0x0, "xchg BYTE PTR [rax+riz*4],ch" },
+	{ "\x86\x2c\x25\x78\x56\x34\x12", 7, 7, ShvEmulXchg, 1, 0x00, 0x05, 0xff, 0xff, 0, 0, 0x12345678, 0x0, "xchg BYTE PTR ds:0x12345678,ch" },
+	{ "\x86\x1c\x25\xf0\xff\xff\xff", 7, 7, ShvEmulXchg, 1, 0x00, 0x03, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "xchg BYTE PTR ds:0xfffffffffffffff0,bl" },
+	{ "\x86\x0c\x65\x00\x10\x00\x00", 7, 7, ShvEmulXchg, 1, 0x00, 0x01, 0xff, 0xff, 0, 0, 0x1000, 0x0, "xchg BYTE PTR [riz*2+0x1000],cl" },
+	{ "\x86\x14\xcd\x40\x00\x00\x00", 7, 7, ShvEmulXchg, 1, 0x00, 0x02, 0xff, 0x01, 8, 0, 0x40, 0x0, "xchg BYTE PTR [rcx*8+0x40],dl" },
+	{ "\x86\x14\x1d\x40\x00\x00\x00", 7, 7, ShvEmulXchg, 1, 0x00, 0x02, 0xff, 0x03, 1, 0, 0x40, 0x0, "xchg BYTE PTR [rbx*1+0x40],dl" },
+	{ "\x86\x70\x7f", 3, 3, ShvEmulXchg, 1, 0x00, 0x06, 0x00, 0xff, 0, 0, 0x7f, 0x0, "xchg BYTE PTR [rax+0x7f],dh" },
+	{ "\x86\x61\x80", 3, 3, ShvEmulXchg, 1, 0x00, 0x04, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "xchg BYTE PTR [rcx-0x80],ah" },
+	{ "\x86\x65\x08", 3, 3, ShvEmulXchg, 1, 0x00, 0x04, 0x05, 0xff, 0, 0, 0x8, 0x0, "xchg BYTE PTR [rbp+0x8],ah" },
+	{ "\x86\x4c\x24\x10", 4, 4, ShvEmulXchg, 1, 0x00, 0x01, 0x04, 0xff, 0, 0, 0x10, 0x0, "xchg BYTE PTR [rsp+0x10],cl" },
+	{ "\x86\x5c\x5d\xf8", 4, 4, ShvEmulXchg, 1, 0x00, 0x03, 0x05, 0x03, 2, 0, 0xfffffffffffffff8, 0x0, "xchg BYTE PTR [rbp+rbx*2-0x8],bl" },
+	{ "\x86\x89\x00\x10\x00\x00", 6, 6, ShvEmulXchg, 1, 0x00, 0x01, 0x01, 0xff, 0, 0, 0x1000, 0x0, "xchg BYTE PTR [rcx+0x1000],cl" },
+	{ "\x86\xbd\x00\x00\x00\x80", 6, 6, ShvEmulXchg, 1, 0x00, 0x07, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x0, "xchg BYTE PTR [rbp-0x80000000],bh" },
+	{ "\x86\x94\xe5\x44\x33\x22\x11", 7, 7, ShvEmulXchg, 1, 0x00, 0x02, 0x05, 0xff, 0, 0, 0x11223344, 0x0, "xchg BYTE PTR [rbp+riz*8+0x11223344],dl" },
+	{ "\x86\xc8", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "xchg al,cl" },
+	{ "\x86\xd7", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "xchg bh,dl" },
+	{ "\x66\xf2\x86\x04\xcd\x40\x00\x00\x00", 9, 9, ShvEmulXchg, 1, 0x00, 0x00, 0xff, 0x01, 8, 0, 0x40, 0x0, "data16 xacquire xchg BYTE PTR [rcx*8+0x40],al" },
+	{ "\x65\x86\x0b", 3, 3, ShvEmulXchg, 1, 0x00, 0x01, 0x03, 0xff, 0, 2, 0x0, 0x0, "xchg BYTE PTR gs:[rbx],cl" },
+	{ "\xf3\x86\x36", 3, 3, ShvEmulXchg, 1, 0x00, 0x06, 0x06, 0xff, 0, 0, 0x0, 0x0, "xrelease xchg BYTE PTR [rsi],dh" },
+	{ "\xf0\x66\x86\x0c\x25\x78\x56\x34\x12", 9, 9, ShvEmulXchg, 1, 0x01, 0x01, 0xff, 0xff, 0, 0, 0x12345678, 0x0, "lock data16 xchg BYTE PTR ds:0x12345678,cl" },
+	{ "\x26\x86\x68\x7f", 4, 4, ShvEmulXchg, 1, 0x00, 0x05, 0x00, 0xff, 0, 0, 0x7f, 0x0, "es xchg BYTE PTR [rax+0x7f],ch" },
+	{ "\x86\x3d\xf0\xff\xff\xff", 6, 6, ShvEmulXchg, 1, 0x00, 0x07, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "xchg BYTE PTR [rip+0xfffffffffffffff0],bh # 0x4636" },
+	{ "\x65\x2e\x86\x25\x10\x00\x00\x00", 8, 8, ShvEmulXchg, 1, 0x00, 0x04, 0x10, 0xff, 0, 2, 0x10, 0x0, "gs xchg BYTE PTR gs:[rip+0x10],ah # 0x4678" },
+	{ "\x64\x86\x17", 3, 3, ShvEmulXchg, 1, 0x00, 0x02, 0x07, 0xff, 0, 1, 0x0, 0x0, "xchg BYTE PTR fs:[rdi],dl" },
+	{ "\x66\x86\x18", 3, 3, ShvEmulXchg, 1, 0x00, 0x03, 0x00, 0xff, 0, 0, 0x0, 0x0, "data16 xchg BYTE PTR [rax],bl" },
+	{ "\xf0\xf0\x86\x74\x24\x10", 6, 6, ShvEmulXchg, 1, 0x01, 0x06, 0x04, 0xff, 0, 0, 0x10, 0x0, "lock lock xchg BYTE PTR [rsp+0x10],dh" },
+	{ "\xf3\xf2\x86\x24\x25\xf0\xff\xff\xff", 9, 9, ShvEmulXchg, 1, 0x00, 0x04, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "xrelease xacquire xchg BYTE PTR ds:0xfffffffffffffff0,ah" },
+	{ "\x66\x66\x86\x40\x7f", 5, 5, ShvEmulXchg, 1, 0x00, 0x00, 0x00, 0xff, 0, 0, 0x7f, 0x0, "data16 data16 xchg BYTE PTR [rax+0x7f],al" },
+	{ "\x67\x40\x86\x50\x7f", 5, 5, ShvEmulXchg, 1, 0x0c, 0x02, 0x00, 0xff, 0, 0, 0x7f, 0x0, "rex xchg BYTE PTR [eax+0x7f],dl" },
+	{ "\x67\x41\x86\x2c\x24", 5, 5, ShvEmulXchg, 1, 0x0c, 0x05, 0x0c, 0xff, 0, 0, 0x0, 0x0, "xchg BYTE PTR [r12d],bpl" },
+	{ "\x64\x42\x86\x0f", 4, 4, ShvEmulXchg, 1, 0x04, 0x01, 0x07, 0xff, 0, 1, 0x0, 0x0, "rex.X xchg BYTE PTR fs:[rdi],cl" },
+	{ "\xf2\x4c\x86\x6d\x08", 5, 5, ShvEmulXchg, 1, 0x04, 0x0d, 0x05, 0xff, 0, 0, 0x8, 0x0, "xacquire rex.WR xchg BYTE PTR [rbp+0x8],r13b" },
+	{ "\x87\x38", 2, 2, ShvEmulXchg, 4, 0x00, 0x07, 0x00, 0xff, 0, 0, 0x0, 0x0, "xchg DWORD PTR [rax],edi" },
+	{ "\x87\x03", 2, 2, ShvEmulXchg, 4, 0x00, 0x00, 0x03, 0xff, 0, 0, 0x0, 0x0, "xchg DWORD PTR [rbx],eax" },
+	{ "\x87\x3e", 2, 2, ShvEmulXchg, 4, 0x00, 0x07, 0x06, 0xff, 0, 0, 0x0, 0x0, "xchg DWORD PTR [rsi],edi" },
+	{ "\x87\x1f", 2, 2, ShvEmulXchg, 4, 0x00, 0x03, 0x07, 0xff, 0, 0, 0x0, 0x0, "xchg DWORD PTR [rdi],ebx" },
+	{ "\x87\x2d\x10\x00\x00\x00", 6, 6, ShvEmulXchg, 4, 0x00, 0x05, 0x10, 0xff, 0, 0, 0x10, 0x0, "xchg DWORD PTR [rip+0x10],ebp # 0x4836" },
+	{ "\x87\x1d\xf0\xff\xff\xff", 6, 6, ShvEmulXchg, 4, 0x00, 0x03, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "xchg DWORD PTR [rip+0xfffffffffffffff0],ebx # 0x4836" },
+	{ "\x87\x3c\x24", 3, 3, ShvEmulXchg, 4, 0x00, 0x07, 0x04, 0xff, 0, 0, 0x0, 0x0, "xchg DWORD PTR [rsp],edi" },
+	{ "\x87\x04\x98", 3, 3, ShvEmulXchg, 4, 0x00, 0x00, 0x00, 0x03, 4, 0, 0x0, 0x0, "xchg DWORD PTR [rax+rbx*4],eax" },
+	{ "\x87\x3c\x20", 3, 3, ShvEmulXchg, 4, 0x00, 0x07, 0x00, 0xff, 0, 0, 0x0, 0x0, "xchg DWORD PTR [rax+riz*1],edi" },
+	{ "\x87\x3c\xa0", 3, 3, ShvEmulXchg, 4, 0x00, 0x07, 0x00, 0xff, 0, 0, 0x0, 0x0, "xchg DWORD PTR [rax+riz*4],edi" },
+	{ "\x87\x14\x25\x78\x56\x34\x12", 7, 7, ShvEmulXchg, 4, 0x00, 0x02, 0xff, 0xff, 0, 0, 0x12345678, 0x0, "xchg DWORD PTR ds:0x12345678,edx" },
+	{ "\x87\x14\x25\xf0\xff\xff\xff", 7, 7, ShvEmulXchg, 4, 0x00, 0x02, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "xchg DWORD PTR ds:0xfffffffffffffff0,edx" },
+	{ "\x87\x14\x65\x00\x10\x00\x00", 7, 7, ShvEmulXchg, 4, 0x00, 0x02, 0xff, 0xff, 0, 0, 0x1000, 0x0, "xchg DWORD PTR [riz*2+0x1000],edx" },
+	{ "\x87\x14\xcd\x40\x00\x00\x00", 7, 7, ShvEmulXchg, 4, 0x00, 0x02, 0xff, 0x01, 8, 0, 0x40, 0x0, "xchg DWORD PTR [rcx*8+0x40],edx" },
+	{ "\x87\x04\x1d\x40\x00\x00\x00", 7, 7, ShvEmulXchg, 4, 0x00, 0x00, 0xff, 0x03, 1, 0, 0x40, 0x0, "xchg DWORD PTR [rbx*1+0x40],eax" },
+	{ "\x87\x48\x7f", 3, 3, ShvEmulXchg, 4, 0x00, 0x01, 0x00, 0xff, 0, 0, 0x7f, 0x0, "xchg DWORD PTR [rax+0x7f],ecx" },
+	{ "\x87\x59\x80", 3, 3, ShvEmulXchg, 4, 0x00, 0x03, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "xchg DWORD PTR [rcx-0x80],ebx" },
+	{ "\x87\x75\x08", 3, 3, ShvEmulXchg, 4, 0x00, 0x06, 0x05, 0xff, 0, 0, 0x8, 0x0, "xchg DWORD PTR [rbp+0x8],esi" },
+	{ "\x87\x7c\x24\x10", 4, 4, ShvEmulXchg, 4, 0x00, 0x07, 0x04, 0xff, 0, 0, 0x10, 0x0, "xchg DWORD PTR [rsp+0x10],edi" },
+	{ "\x87\x44\x5d\xf8", 4, 4, ShvEmulXchg, 4, 0x00, 0x00, 0x05, 0x03, 2, 0, 0xfffffffffffffff8, 0x0, "xchg DWORD PTR [rbp+rbx*2-0x8],eax" },
+	{ "\x87\x89\x00\x10\x00\x00", 6, 6, ShvEmulXchg, 4, 0x00, 0x01, 0x01, 0xff, 0, 0, 0x1000, 0x0, "xchg DWORD PTR [rcx+0x1000],ecx" },
+	{ "\x87\xbd\x00\x00\x00\x80", 6, 6, ShvEmulXchg, 4, 0x00, 0x07, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x0, "xchg DWORD PTR [rbp-0x80000000],edi" },
+	{ "\x87\xac\xe5\x44\x33\x22\x11", 7, 7, ShvEmulXchg, 4, 0x00, 0x05, 0x05, 0xff, 0, 0, 0x11223344, 0x0, "xchg DWORD PTR [rbp+riz*8+0x11223344],ebp" },
+	{ "\x87\xf8", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "xchg eax,edi" },
+	{ "\x87\xff", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "xchg edi,edi" },
+	{ "\xf3\x87\x78\x7f", 4, 4, ShvEmulXchg, 4, 0x00, 0x07, 0x00, 0xff, 0, 0, 0x7f, 0x0, "xrelease xchg DWORD PTR [rax+0x7f],edi" },
+	{ "\xf0\x87\x1c\x1d\x40\x00\x00\x00", 8, 8, ShvEmulXchg, 4, 0x01, 0x03, 0xff, 0x03, 1, 0, 0x40, 0x0, "lock xchg DWORD PTR [rbx*1+0x40],ebx" },
+	{ "\xf2\x87\xa5\x00\x00\x00\x80", 7, 7, ShvEmulXchg, 4, 0x00, 0x04, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x0, "xacquire xchg DWORD PTR [rbp-0x80000000],esp" },
+	{ "\x67\x87\x14\x25\x78\x56\x34\x12", 8, 8, ShvEmulXchg, 4, 0x08, 0x02, 0xff, 0xff, 0, 0, 0x12345678, 0x0, "xchg DWORD PTR [eiz*1+0x12345678],edx" },
+	{ "\x66\x66\x87\x0d\xf0\xff\xff\xff", 8, 8, ShvEmulXchg, 2, 0x00, 0x01, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "data16 xchg WORD PTR [rip+0xfffffffffffffff0],cx # 0x4b38" },
+	{ "\x66\xf2\x87\x1c\x65\x00\x10\x00\x00", 9, 9, ShvEmulXchg, 2, 0x00, 0x03, 0xff, 0xff, 0, 0, 0x1000, 0x0, "xacquire xchg WORD PTR [riz*2+0x1000],bx" },
+	{ "\xf2\xf3\x87\x79\x80", 5, 5, ShvEmulXchg, 4, 0x00, 0x07, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "xacquire xrelease xchg DWORD PTR [rcx-0x80],edi" },
+	{ "\xf0\x66\x87\x33", 4, 4, ShvEmulXchg, 2, 0x01, 0x06, 0x03, 0xff, 0, 0, 0x0, 0x0, "lock xchg WORD PTR [rbx],si" },
+	{ "\x2e\x64\x87\x4d\x08", 5, 5, ShvEmulXchg, 4, 0x00, 0x01, 0x05, 0xff, 0, 1, 0x8, 0x0, "cs xchg DWORD PTR fs:[rbp+0x8],ecx" },
+	{ "\xf0\xf0\x87\x49\x80", 5, 5, ShvEmulXchg, 4, 0x01, 0x01, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "lock lock xchg DWORD PTR [rcx-0x80],ecx" },
+	{ "\xf0\x65\x67\x87\x24\x65\x00\x10\x00\x00", 10, 10, ShvEmulXchg, 4, 0x09, 0x04, 0xff, 0xff, 0, 2, 0x1000, 0x0, "lock xchg DWORD PTR gs:[eiz*2+0x1000],esp" },
+	{ "\x66\x67\x87\x4d\x08", 5, 5, ShvEmulXchg, 2, 0x08, 0x01, 0x05, 0xff, 0, 0, 0x8, 0x0, "xchg WORD PTR [ebp+0x8],cx" },
+	{ "\x65\x4c\x87\x1c\x98", 5, 5, ShvEmulXchg, 8, 0x04, 0x0b, 0x00, 0x03, 4, 2, 0x0, 0x0, "xchg QWORD PTR gs:[rax+rbx*4],r11" },
+	{ "\x66\x41\x87\x0c\xa0", 5, 5, ShvEmulXchg, 2, 0x04, 0x01, 0x08, 0xff, 0, 0, 0x0, 0x0, "xchg WORD PTR [r8+riz*4],cx" },
+	{ "\x65\x4f\x87\x04\x65\x00\x10\x00\x00", 9, 9, ShvEmulXchg, 8, 0x04, 0x08, 0xff, 0x0c, 2, 2, 0x1000, 0x0, "xchg QWORD PTR gs:[r12*2+0x1000],r8" },
+	{ "\x66\x40\x87\x2c\x1d\x40\x00\x00\x00", 9, 9, ShvEmulXchg, 2, 0x04, 0x05, 0xff, 0x03, 1, 0, 0x40, 0x0, "rex xchg WORD PTR [rbx*1+0x40],bp" },
+	{ "\x88\x38", 2, 2, ShvEmulMov, 1, 0x00, 0x07, 0x00, 0xff, 0, 0, 0x0, 0x0, "mov BYTE PTR [rax],bh" },
+	{ "\x88\x2b", 2, 2, ShvEmulMov, 1, 0x00, 0x05, 0x03, 0xff, 0, 0, 0x0, 0x0, "mov BYTE PTR [rbx],ch" },
+	{ "\x88\x3e", 2, 2, ShvEmulMov, 1, 0x00, 0x07, 0x06, 0xff, 0, 0, 0x0, 0x0, "mov BYTE PTR [rsi],bh" },
+	{ "\x88\x37", 2, 2, ShvEmulMov, 1, 0x00, 0x06, 0x07, 0xff, 0, 0, 0x0, 0x0, "mov BYTE PTR [rdi],dh" },
+	{ "\x88\x0d\x10\x00\x00\x00", 6, 6, ShvEmulMov, 1, 0x00, 0x01, 0x10, 0xff, 0, 0, 0x10, 0x0, "mov BYTE PTR [rip+0x10],cl # 0x4d56" },
+	{ "\x88\x3d\xf0\xff\xff\xff", 6, 6, ShvEmulMov, 1, 0x00, 0x07, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "mov BYTE PTR [rip+0xfffffffffffffff0],bh # 0x4d56" },
+	{ "\x88\x2c\x24", 3, 3, ShvEmulMov, 1, 0x00, 0x05, 0x04, 0xff, 0, 0, 0x0, 0x0, "mov BYTE PTR [rsp],ch" },
+	{ "\x88\x04\x98", 3, 3, ShvEmulMov, 1, 0x00, 0x00, 0x00, 0x03, 4, 0, 0x0, 0x0, "mov BYTE PTR [rax+rbx*4],al" },
+	{ "\x88\x0c\x20", 3, 3, ShvEmulMov, 1, 0x00, 0x01, 0x00, 0xff, 0, 0, 0x0, 0x0, "mov BYTE PTR [rax+riz*1],cl" },
+	{ "\x88\x0c\xa0", 3, 3, ShvEmulMov, 1, 0x00, 0x01, 0x00, 0xff, 0, 0, 0x0, 0x0, "mov BYTE PTR [rax+riz*4],cl" },
+	{ "\x88\x04\x25\x78\x56\x34\x12", 7, 7, ShvEmulMov, 1, 0x00, 0x00, 0xff, 0xff, 0, 0, 0x12345678, 0x0, "mov BYTE PTR ds:0x12345678,al" },
+	{ "\x88\x04\x25\xf0\xff\xff\xff", 7, 7, ShvEmulMov, 1, 0x00, 0x00, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "mov BYTE PTR ds:0xfffffffffffffff0,al" },
+	{ "\x88\x24\x65\x00\x10\x00\x00", 7, 7, ShvEmulMov, 1, 0x00, 0x04, 0xff, 0xff, 0, 0, 0x1000, 0x0, "mov BYTE PTR [riz*2+0x1000],ah" },
+	{ "\x88\x04\xcd\x40\x00\x00\x00", 7, 7, ShvEmulMov, 1, 0x00, 0x00, 0xff, 0x01, 8, 0, 0x40, 0x0, "mov BYTE PTR [rcx*8+0x40],al" },
+	{ "\x88\x2c\x1d\x40\x00\x00\x00", 7, 7, ShvEmulMov, 1, 0x00, 0x05, 0xff, 0x03, 1, 0, 0x40, 0x0, "mov BYTE PTR [rbx*1+0x40],ch" },
+	{ "\x88\x48\x7f", 3, 3, ShvEmulMov, 1, 0x00, 0x01, 0x00, 0xff, 0, 0, 0x7f, 0x0, "mov BYTE PTR [rax+0x7f],cl" },
+	{ "\x88\x79\x80", 3, 3, ShvEmulMov, 1, 0x00, 0x07, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "mov BYTE PTR [rcx-0x80],bh" },
+	{ "\x88\x4d\x08", 3, 3, ShvEmulMov, 1, 0x00, 0x01, 0x05, 0xff, 0, 0, 0x8, 0x0, "mov BYTE PTR [rbp+0x8],cl" },
+	{ "\x88\x74\x24\x10", 4, 4, ShvEmulMov, 1, 0x00, 0x06, 0x04, 0xff, 0, 0, 0x10, 0x0, "mov BYTE PTR [rsp+0x10],dh" },
+	{ "\x88\x6c\x5d\xf8", 4, 4, ShvEmulMov, 1, 0x00, 0x05, 0x05, 0x03, 2, 0, 0xfffffffffffffff8, 0x0, "mov BYTE PTR [rbp+rbx*2-0x8],ch" },
+	{ "\x88\xa9\x00\x10\x00\x00", 6, 6, ShvEmulMov, 1, 0x00, 0x05, 0x01, 0xff, 0, 0, 0x1000, 0x0, "mov BYTE PTR [rcx+0x1000],ch" },
+	{ "\x88\x9d\x00\x00\x00\x80", 6, 6, ShvEmulMov, 1, 0x00, 0x03, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x0, "mov BYTE PTR [rbp-0x80000000],bl" },
+	{ "\x88\x84\xe5\x44\x33\x22\x11", 7, 7, ShvEmulMov, 1, 0x00, 0x00, 0x05, 0xff, 0, 0, 0x11223344, 0x0, "mov BYTE PTR [rbp+riz*8+0x11223344],al" },
+	{ "\x88\xf0", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov al,dh" },
+	{ "\x88\xdf", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov bh,bl" },
+	{ "\x65\x88\x24\x25\xf0\xff\xff\xff", 8, 8, ShvEmulMov, 1, 0x00, 0x04, 0xff, 0xff, 0, 2, 0xfffffffffffffff0, 0x0, "mov BYTE PTR gs:0xfffffffffffffff0,ah" },
+	{ "\x2e\x88\x1c\x20", 4, 4, ShvEmulMov, 1, 0x00, 0x03, 0x00, 0xff, 0, 0, 0x0, 0x0, "cs mov BYTE PTR [rax+riz*1],bl" },
+	{ "\x66\xf2\x88\x44\x5d\xf8", 6, 6, ShvEmulMov, 1, 0x00, 0x00, 0x05, 0x03, 2, 0, 0xfffffffffffffff8, 0x0, "data16 repnz mov BYTE PTR [rbp+rbx*2-0x8],al" },
+	{ "\x66\x88\x85\x00\x00\x00\x80", 7, 7, ShvEmulMov, 1, 0x00, 0x00, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x0, "data16 mov BYTE PTR [rbp-0x80000000],al" },
+	{ "\xf3\xf2\x88\x04\x25\x78\x56\x34\x12", 9, 9, ShvEmulMov, 1, 0x00, 0x00, 0xff, 0xff, 0, 0, 0x12345678, 0x0, "repz repnz mov BYTE PTR ds:0x12345678,al" },
+	{ "\xf3\x66\x88\x14\xa0", 5, 5, ShvEmulMov, 1, 0x00, 0x02, 0x00, 0xff, 0, 0, 0x0, 0x0, "xrelease data16 mov BYTE PTR [rax+riz*4],dl" },
+	{ "\xf0\x66\x88\x34\x24", 5, 5, ShvEmulMov, 1, 0x01, 0x06, 0x04, 0xff, 0, 0, 0x0, 0x0, "lock data16 mov BYTE PTR [rsp],dh" },
+	{ "\x67\x88\x0c\x25\xf0\xff\xff\xff", 8, 8, ShvEmulMov, 1, 0x08, 0x01, 0xff, 0xff, 0, 0, 0xfffffff0, 0x0, "mov BYTE PTR [eiz*1+0xfffffff0],cl" },
+	{ "\xf2\xf3\x88\x95\x00\x00\x00\x80", 8, 8, ShvEmulMov, 1, 0x00, 0x02, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x0, "repnz xrelease mov BYTE PTR [rbp-0x80000000],dl" },
+	{ "\x64\x65\x88\x1c\xa0", 5, 5, ShvEmulMov, 1, 0x00, 0x03, 0x00, 0xff, 0, 2, 0x0, 0x0, "fs mov BYTE PTR gs:[rax+riz*4],bl" },
+	{ "\x64\x88\x9d\x00\x00\x00\x80", 7, 7, ShvEmulMov, 1, 0x00, 0x03, 0x05, 0xff, 0, 1, 0xffffffff80000000, 0x0, "mov BYTE PTR fs:[rbp-0x80000000],bl" },
+	{ "\x3e\x88\xa5\x00\x00\x00\x80", 7, 7, ShvEmulMov, 1, 0x00, 0x04, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x0, "ds mov BYTE PTR [rbp-0x80000000],ah" },
+	{ "\x64\x4f\x88\x04\xa0", 5, 5, ShvEmulMov, 1, 0x04, 0x08, 0x08, 0x0c, 4, 1, 0x0, 0x0, "rex.WRXB mov BYTE PTR fs:[r8+r12*4],r8b" },
+	{ "\x67\x42\x88\x2b", 4, 4, ShvEmulMov, 1, 0x0c, 0x05, 0x03, 0xff, 0, 0, 0x0, 0x0, "rex.X mov BYTE PTR [ebx],bpl" },
+	{ "\x65\x48\x88\x70\x7f", 5, 5, ShvEmulMov, 1, 0x04, 0x06, 0x00, 0xff, 0, 2, 0x7f, 0x0, "rex.W mov BYTE PTR gs:[rax+0x7f],sil" },
+	{ "\xf2\x41\x88\x3b", 4, 4, ShvEmulMov, 1, 0x04, 0x07, 0x0b, 0xff, 0, 0, 0x0, 0x0, "repnz mov BYTE PTR [r11],dil" },
+	{ "\x89\x20", 2, 2, ShvEmulMov, 4, 0x00, 0x04, 0x00, 0xff, 0, 0, 0x0, 0x0, "mov DWORD PTR [rax],esp" },
+	{ "\x89\x0b", 2, 2, ShvEmulMov, 4, 0x00, 0x01, 0x03, 0xff, 0, 0, 0x0, 0x0, "mov DWORD PTR [rbx],ecx" },
+	{ "\x89\x3e", 2, 2, ShvEmulMov, 4, 0x00, 0x07, 0x06, 0xff, 0, 0, 0x0, 0x0, "mov DWORD PTR [rsi],edi" },
+	{ "\x89\x17", 2, 2, ShvEmulMov, 4, 0x00, 0x02, 0x07, 0xff, 0, 0, 0x0, 0x0, "mov DWORD PTR [rdi],edx" },
+	{ "\x89\x15\x10\x00\x00\x00", 6, 6, ShvEmulMov, 4, 0x00, 0x02, 0x10, 0xff, 0, 0, 0x10, 0x0, "mov DWORD PTR [rip+0x10],edx # 0x5276" },
+	{ "\x89\x25\xf0\xff\xff\xff", 6, 6, ShvEmulMov, 4, 0x00, 0x04, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "mov DWORD PTR [rip+0xfffffffffffffff0],esp # 0x5276" },
+	{ "\x89\x3c\x24", 3, 3, ShvEmulMov, 4, 0x00, 0x07, 0x04, 0xff, 0, 0, 0x0, 0x0, "mov DWORD PTR [rsp],edi" },
+	{ "\x89\x3c\x98", 3, 3, ShvEmulMov, 4, 0x00, 0x07, 0x00, 0x03, 4, 0, 0x0, 0x0, "mov DWORD PTR [rax+rbx*4],edi" },
+	{ "\x89\x24\x20", 3, 3, ShvEmulMov, 4, 0x00, 0x04, 0x00, 0xff, 0, 0, 0x0, 0x0, "mov DWORD PTR [rax+riz*1],esp" },
+	{ "\x89\x04\xa0", 3, 3, ShvEmulMov, 4, 0x00, 0x00, 0x00, 0xff, 0, 0, 0x0, 0x0, "mov DWORD PTR [rax+riz*4],eax" },
+	{ "\x89\x1c\x25\x78\x56\x34\x12", 7, 7, ShvEmulMov, 4, 0x00, 0x03, 0xff, 0xff, 0, 0, 0x12345678, 0x0, "mov DWORD PTR ds:0x12345678,ebx" },
+	{ "\x89\x14\x25\xf0\xff\xff\xff", 7, 7, ShvEmulMov, 4, 0x00, 0x02, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "mov DWORD PTR ds:0xfffffffffffffff0,edx" },
+	{ "\x89\x2c\x65\x00\x10\x00\x00", 7, 7, ShvEmulMov, 4, 0x00, 0x05, 0xff, 0xff, 0, 0, 0x1000, 0x0, "mov DWORD PTR [riz*2+0x1000],ebp" },
+	{ "\x89\x1c\xcd\x40\x00\x00\x00", 7, 7, ShvEmulMov, 4, 0x00, 0x03, 0xff, 0x01, 8, 0, 0x40, 0x0, "mov DWORD PTR [rcx*8+0x40],ebx" },
+	{ "\x89\x24\x1d\x40\x00\x00\x00", 7, 7, ShvEmulMov, 4, 0x00, 0x04, 0xff, 0x03, 1, 0, 0x40, 0x0, "mov DWORD PTR [rbx*1+0x40],esp" },
+	{ "\x89\x60\x7f", 3, 3, ShvEmulMov, 4, 0x00, 0x04, 0x00, 0xff, 0, 0, 0x7f, 0x0, "mov DWORD PTR [rax+0x7f],esp" },
+	{ "\x89\x61\x80", 3, 3, ShvEmulMov, 4, 0x00, 0x04, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "mov DWORD PTR [rcx-0x80],esp" },
+	{ "\x89\x55\x08", 3, 3, ShvEmulMov, 4, 0x00, 0x02, 0x05, 0xff, 0, 0, 0x8, 0x0, "mov DWORD PTR [rbp+0x8],edx" },
+	{ "\x89\x6c\x24\x10", 4, 4, ShvEmulMov, 4, 0x00, 0x05, 0x04, 0xff, 0, 0, 0x10, 0x0, "mov DWORD PTR [rsp+0x10],ebp" },
+	{ "\x89\x4c\x5d\xf8", 4, 4, ShvEmulMov, 4, 0x00, 0x01, 0x05, 0x03, 2, 0, 0xfffffffffffffff8, 0x0, "mov DWORD PTR [rbp+rbx*2-0x8],ecx" },
+	{ "\x89\xb9\x00\x10\x00\x00", 6, 6, ShvEmulMov, 4, 0x00, 0x07, 0x01, 0xff, 0, 0, 0x1000, 0x0, "mov DWORD PTR [rcx+0x1000],edi" },
+	{ "\x89\x8d\x00\x00\x00\x80", 6, 6, ShvEmulMov, 4, 0x00, 0x01, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x0, "mov DWORD PTR [rbp-0x80000000],ecx" },
+	{ "\x89\xb4\xe5\x44\x33\x22\x11", 7, 7, ShvEmulMov, 4, 0x00, 0x06, 0x05, 0xff, 0, 0, 0x11223344, 0x0, "mov DWORD PTR [rbp+riz*8+0x11223344],esi" },
+	{ "\x89\xe8", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov eax,ebp" },
+	{ "\x89\xf7", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov edi,esi" },
+	{ "\x64\x89\x85\x00\x00\x00\x80", 7, 7, ShvEmulMov, 4, 0x00, 0x00, 0x05, 0xff, 0, 1, 0xffffffff80000000, 0x0, "mov DWORD PTR fs:[rbp-0x80000000],eax" },
+	{ "\x36\x89\x14\xcd\x40\x00\x00\x00", 8, 8, ShvEmulMov, 4, 0x00, 0x02, 0xff, 0x01, 8, 0, 0x40, 0x0, "ss mov DWORD PTR [rcx*8+0x40],edx" },
+	{ "\xf2\x89\x2c\x25\xf0\xff\xff\xff", 8, 8, ShvEmulMov, 4, 0x00, 0x05, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "repnz mov DWORD PTR ds:0xfffffffffffffff0,ebp" },
+	{ "\xf3\x66\x89\x50\x7f", 5, 5, ShvEmulMov, 2, 0x00, 0x02, 0x00, 0xff, 0, 0, 0x7f, 0x0, "xrelease mov WORD PTR [rax+0x7f],dx" },
+	{ "\x65\x2e\x89\x3d\xf0\xff\xff\xff", 8, 8, ShvEmulMov, 4, 0x00, 0x07, 0x10, 0xff, 0, 2, 0xfffffffffffffff0, 0x0, "gs mov DWORD PTR gs:[rip+0xfffffffffffffff0],edi # 0x5578" },
+	{ "\xf0\x65\x67\x89\x1c\x20", 6, 6, ShvEmulMov, 4, 0x09, 0x03, 0x00, 0xff, 0, 2, 0x0, 0x0, "lock mov DWORD PTR gs:[eax+eiz*1],ebx" },
+	{ "\xf0\x66\x89\x05\xf0\xff\xff\xff", 8, 8, ShvEmulMov, 2, 0x01, 0x00, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "lock mov WORD PTR [rip+0xfffffffffffffff0],ax # 0x55b8" },
+	{ "\x66\x66\x89\x71\x80", 5, 5, ShvEmulMov, 2, 0x00, 0x06, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "data16 mov WORD PTR [rcx-0x80],si" },
+	{ "\xf0\x89\x9d\x00\x00\x00\x80", 7, 7, ShvEmulMov, 4, 0x01, 0x03, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x0, "lock mov DWORD PTR [rbp-0x80000000],ebx" },
+	{ "\xf3\xf2\x89\x08", 4, 4, ShvEmulMov, 4, 0x00, 0x01, 0x00, 0xff, 0, 0, 0x0, 0x0, "repz repnz mov DWORD PTR [rax],ecx" },
+	{ "\x66\x67\x89\x99\x00\x10\x00\x00", 8, 8, ShvEmulMov, 2, 0x08, 0x03, 0x01, 0xff, 0, 0, 0x1000, 0x0, "mov WORD PTR [ecx+0x1000],bx" },
+	{ "\x65\x89\xb9\x00\x10\x00\x00", 7, 7, ShvEmulMov, 4, 0x00, 0x07, 0x01, 0xff, 0, 2, 0x1000, 0x0, "mov DWORD PTR gs:[rcx+0x1000],edi" },
+	{ "\xf2\x4f\x89\x3c\xcd\x40\x00\x00\x00", 9, 9, ShvEmulMov, 8, 0x04, 0x0f, 0xff, 0x09, 8, 0, 0x40, 0x0, "repnz mov QWORD PTR [r9*8+0x40],r15" },
+	{ "\xf0\x44\x89\x1c\x25\x78\x56\x34\x12", 9, 9, ShvEmulMov, 4, 0x05, 0x0b, 0xff, 0xff, 0, 0, 0x12345678, 0x0, "lock mov DWORD PTR ds:0x12345678,r11d" },
+	{ "\xf2\x4c\x89\x14\x25\xf0\xff\xff\xff", 9, 9, ShvEmulMov, 8, 0x04, 0x0a, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "repnz mov QWORD PTR ds:0xfffffffffffffff0,r10" },
+	{ "\x66\x41\x89\x14\x65\x00\x10\x00\x00", 9, 9, ShvEmulMov, 2, 0x04, 0x02, 0xff, 0xff, 0, 0, 0x1000, 0x0, "mov WORD PTR [riz*2+0x1000],dx" },
+	{ "\xc6\x08\x34\x12\x00\x00", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc6\x13\x34\x12\x00\x00", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc6\x06\xf0", 3, 3, ShvEmulMovImmediate, 1, 0x00, 0xff, 0x06, 0xff, 0, 0, 0x0, 0xf0, "mov BYTE PTR [rsi],0xf0" },
+	{ "\xc6\x37\x34\x12\x00\x00", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc6\x3d\x10\x00\x00\x00\xf0\xff\xff\xff", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc6\x35\xf0\xff\xff\xff\x7f\x80\xff\x01", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc6\x2c\x24\xf0\xff\xff\xff", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc6\x34\x98\xf0\xff\xff\xff", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc6\x14\x20\x34\x12\x00\x00", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc6\x14\xa0\xf0\xff\xff\xff", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc6\x1c\x25\x78\x56\x34\x12\x7f\x80\xff\x01", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc6\x24\x25\xf0\xff\xff\xff\x7f\x80\xff\x01", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc6\x24\x65\x00\x10\x00\x00\x7f\x80\xff\x01", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc6\x14\xcd\x40\x00\x00\x00\x7f\x80\xff\x01", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc6\x24\x1d\x40\x00\x00\x00\x7f\x80\xff\x01", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc6\x48\x7f\x7f\x80\xff\x01", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc6\x69\x80\xf0\xff\xff\xff", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc6\x45\x08\x7f", 4, 4, ShvEmulMovImmediate, 1, 0x00, 0xff, 0x05, 0xff, 0, 0, 0x8, 0x7f, "mov BYTE PTR [rbp+0x8],0x7f" },
+	{ "\xc6\x5c\x24\x10\xf0\xff\xff\xff", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc6\x6c\x5d\xf8\x7f\x80\xff\x01", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc6\xb9\x00\x10\x00\x00\x34\x12\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc6\xb5\x00\x00\x00\x80\x7f\x80\xff\x01", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc6\xac\xe5\x44\x33\x22\x11\xf0\xff\xff\xff", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc6\xf0\xf0\xff\xff\xff", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc6\xff\x7f\x80\xff\x01", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x64\xc6\xa1\x00\x10\x00\x00\x34\x12\x00\x00", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "fs (bad)" },
+	{ "\x66\xf2\xc6\x3c\x98\x34\x12\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 repnz (bad)" },
+	{ "\xf0\x66\xc6\x3f\x34\x12\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock data16 (bad)" },
+	{ "\x36\xc6\x54\x5d\xf8\x34\x12\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ss (bad)" },
+	{ "\x66\x67\xc6\x2c\x98\x7f\x80\xff\x01", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 addr32 (bad)" },
+	{ "\xf3\xc6\x04\xa0\x7f", 5, 5, ShvEmulMovImmediate, 1, 0x00, 0xff, 0x00, 0xff, 0, 0, 0x0, 0x7f, "xrelease mov BYTE PTR [rax+riz*4],0x7f" },
+	{ "\xf2\xc6\x14\x65\x00\x10\x00\x00\xf0\xff\xff\xff", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz (bad)" },
+	{ "\xf0\xc6\x2d\x10\x00\x00\x00\x34\x12\x00\x00", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock (bad)" },
+	{ "\xf3\xf2\xc6\x35\x10\x00\x00\x00\xf0\xff\xff\xff", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz repnz (bad)" },
+	{ "\xf2\xf3\xc6\x99\x00\x10\x00\x00\x7f\x80\xff\x01", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz repz (bad)" },
+	{ "\x26\xc6\x04\x25\xf0\xff\xff\xff\x34", 9, 9, ShvEmulMovImmediate, 1, 0x00, 0xff, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x34, "es mov BYTE PTR ds:0xfffffffffffffff0,0x34" },
+	{ "\x66\xc6\x3c\xcd\x40\x00\x00\x00\xf0\xff\xff\xff", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 (bad)" },
+	{ "\x66\x48\xc6\x2c\x1d\x40\x00\x00\x00\xf0\xff\xff\xff", 13, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 rex.W (bad)" },
+	{ "\xf3\x41\xc6\x0f\x7f\x80\xff\x01", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz rex.B (bad)" },
+	{ "\x4f\xc6\x1c\x20\x34\x12\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WRXB (bad)" },
+	{ "\xf3\x42\xc6\x1d\xf0\xff\xff\xff\xf0\xff\xff\xff", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz rex.X (bad)" },
+	{ "\xc7\x30\x34\x12\x00\x00", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc7\x13\x34\x12\x00\x00", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc7\x3e\xf0\xff\xff\xff", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc7\x3f\x7f\x80\xff\x01", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc7\x25\x10\x00\x00\x00\xf0\xff\xff\xff", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc7\x05\xf0\xff\xff\xff\x7f\x80\xff\x01", 10, 10, ShvEmulMovImmediate, 4, 0x00, 0xff, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x1ff807f, "mov DWORD PTR [rip+0xfffffffffffffff0],0x1ff807f # 0x5cba" },
+	{ "\xc7\x1c\x24\x7f\x80\xff\x01", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc7\x24\x98\xf0\xff\xff\xff", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc7\x3c\x20\x34\x12\x00\x00", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc7\x04\xa0\x34\x12\x00\x00", 7, 7, ShvEmulMovImmediate, 4, 0x00, 0xff, 0x00, 0xff, 0, 0, 0x0, 0x1234, "mov DWORD PTR [rax+riz*4],0x1234" },
+	{ "\xc7\x24\x25\x78\x56\x34\x12\x7f\x80\xff\x01", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc7\x04\x25\xf0\xff\xff\xff\xf0\xff\xff\xff", 11, 11, ShvEmulMovImmediate, 4, 0x00, 0xff, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0xfffffff0, "mov DWORD PTR ds:0xfffffffffffffff0,0xfffffff0" },
+	{ "\xc7\x14\x65\x00\x10\x00\x00\xf0\xff\xff\xff", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc7\x34\xcd\x40\x00\x00\x00\xf0\xff\xff\xff", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc7\x24\x1d\x40\x00\x00\x00\x7f\x80\xff\x01", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc7\x40\x7f\x34\x12\x00\x00", 7, 7, ShvEmulMovImmediate, 4, 0x00, 0xff, 0x00, 0xff, 0, 0, 0x7f, 0x1234, "mov DWORD PTR [rax+0x7f],0x1234" },
+	{ "\xc7\x51\x80\xf0\xff\xff\xff", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc7\x55\x08\x7f\x80\xff\x01", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc7\x74\x24\x10\xf0\xff\xff\xff", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc7\x7c\x5d\xf8\x34\x12\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc7\x81\x00\x10\x00\x00\x34\x12\x00\x00", 10, 10, ShvEmulMovImmediate, 4, 0x00, 0xff, 0x01, 0xff, 0, 0, 0x1000, 0x1234, "mov DWORD PTR [rcx+0x1000],0x1234" },
+	{ "\xc7\xad\x00\x00\x00\x80\x34\x12\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc7\xa4\xe5\x44\x33\x22\x11\xf0\xff\xff\xff", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc7\xe0\x34\x12\x00\x00", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc7\xff\xf0\xff\xff\xff", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x67\xc7\x7d\x08\x7f\x80\xff\x01", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "addr32 (bad)" },
+	{ "\xf0\x66\xc7\x04\x1d\x40\x00\x00\x00\x7f\x80", 11, 11, ShvEmulMovImmediate, 2, 0x01, 0xff, 0xff, 0x03, 1, 0, 0x40, 0x807f, "lock mov WORD PTR [rbx*1+0x40],0x807f" },
+	{ "\xf3\xf2\xc7\x2d\x10\x00\x00\x00\x34\x12\x00\x00", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz repnz (bad)" },
+	{ "\xf3\x66\xc7\x0c\x24\x34\x12\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz data16 (bad)" },
+	{ "\x64\x65\xc7\x0c\xa0\x34\x12\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "fs gs (bad)" },
+	{ "\xf3\xc7\x2c\x25\x78\x56\x34\x12\xf0\xff\xff\xff", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz (bad)" },
+	{ "\x65\xc7\x05\x10\x00\x00\x00\x34\x12\x00\x00", 11, 11, ShvEmulMovImmediate, 4, 0x00, 0xff, 0x10, 0xff, 0, 2, 0x10, 0x1234, "mov DWORD PTR gs:[rip+0x10],0x1234 # 0x601b" },
+	{ "\xf0\xc7\x04\x1d\x40\x00\x00\x00\xf0\xff\xff\xff", 12, 12, ShvEmulMovImmediate, 4, 0x01, 0xff, 0xff, 0x03, 1, 0, 0x40, 0xfffffff0, "lock mov DWORD PTR [rbx*1+0x40],0xfffffff0" },
+	{ "\x65\x2e\xc7\x16\x7f\x80\xff\x01", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "gs cs (bad)" },
+	{ "\x2e\x64\xc7\x14\x1d\x40\x00\x00\x00\x34\x12\x00\x00", 13, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs fs (bad)" },
+	{ "\x36\xc7\x10\xf0\xff\xff\xff", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ss (bad)" },
+	{ "\x66\xc7\x3d\xf0\xff\xff\xff\xf0\xff\xff\xff", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 (bad)" },
+	{ "\x67\x40\xc7\x5c\x24\x10\x7f\x80\xff\x01", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "addr32 rex (bad)" },
+	{ "\x66\x4c\xc7\xb4\xe5\x44\x33\x22\x11\x7f\x80\xff\x01", 13, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 rex.WR (bad)" },
+	{ "\xf2\x4f\xc7\x1c\x98\x7f\x80\xff\x01", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz rex.WRXB (bad)" },
+	{ "\xf0\x42\xc7\x59\x80\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock rex.X (bad)" },
+	{ "\x0f\x11\x10", 3, 3, ShvEmulMov, 16, 0x10, 0x02, 0x00, 0xff, 0, 0, 0x0, 0x0, "movups XMMWORD PTR [rax],xmm2" },
+	{ "\x0f\x11\x0b", 3, 3, ShvEmulMov, 16, 0x10, 0x01, 0x03, 0xff, 0, 0, 0x0, 0x0, "movups XMMWORD PTR [rbx],xmm1" },
+	{ "\x0f\x11\x2e", 3, 3, ShvEmulMov, 16, 0x10, 0x05, 0x06, 0xff, 0, 0, 0x0, 0x0, "movups XMMWORD PTR [rsi],xmm5" },
+	{ "\x0f\x11\x37", 3, 3, ShvEmulMov, 16, 0x10, 0x06, 0x07, 0xff, 0, 0, 0x0, 0x0, "movups XMMWORD PTR [rdi],xmm6" },
+	{ "\x0f\x11\x05\x10\x00\x00\x00", 7, 7, ShvEmulMov, 16, 0x10, 0x00, 0x10, 0xff, 0, 0, 0x10, 0x0, "movups XMMWORD PTR [rip+0x10],xmm0 # 0x61d7" },
+	{ "\x0f\x11\x1d\xf0\xff\xff\xff", 7, 7, ShvEmulMov, 16, 0x10, 0x03, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "movups XMMWORD PTR [rip+0xfffffffffffffff0],xmm3 # 0x61d7" },
+	{ "\x0f\x11\x3c\x24", 4, 4, ShvEmulMov, 16, 0x10, 0x07, 0x04, 0xff, 0, 0, 0x0, 0x0, "movups XMMWORD PTR [rsp],xmm7" },
+	{ "\x0f\x11\x24\x98", 4, 4, ShvEmulMov, 16, 0x10, 0x04, 0x00, 0x03, 4, 0, 0x0, 0x0, "movups XMMWORD PTR [rax+rbx*4],xmm4" },
+	{ "\x0f\x11\x34\x20", 4, 4, ShvEmulMov, 16, 0x10, 0x06, 0x00, 0xff, 0, 0, 0x0, 0x0, "movups XMMWORD PTR [rax+riz*1],xmm6" },
+	{ "\x0f\x11\x2c\xa0", 4, 4, ShvEmulMov, 16, 0x10, 0x05, 0x00, 0xff, 0, 0, 0x0, 0x0, "movups XMMWORD PTR [rax+riz*4],xmm5" },
+	{ "\x0f\x11\x14\x25\x78\x56\x34\x12", 8, 8, ShvEmulMov, 16, 0x10, 0x02, 0xff, 0xff, 0, 0, 0x12345678, 0x0, "movups XMMWORD PTR ds:0x12345678,xmm2" },
+	{ "\x0f\x11\x3c\x25\xf0\xff\xff\xff", 8, 8, ShvEmulMov, 16, 0x10, 0x07, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "movups XMMWORD PTR ds:0xfffffffffffffff0,xmm7" },
+	{ "\x0f\x11\x1c\x65\x00\x10\x00\x00", 8, 8, ShvEmulMov, 16, 0x10, 0x03, 0xff, 0xff, 0, 0, 0x1000, 0x0, "movups XMMWORD PTR [riz*2+0x1000],xmm3" },
+	{ "\x0f\x11\x1c\xcd\x40\x00\x00\x00", 8, 8, ShvEmulMov, 16, 0x10, 0x03, 0xff, 0x01, 8, 0, 0x40, 0x0, "movups XMMWORD PTR [rcx*8+0x40],xmm3" },
+	{ "\x0f\x11\x0c\x1d\x40\x00\x00\x00", 8, 8, ShvEmulMov, 16, 0x10, 0x01, 0xff, 0x03, 1, 0, 0x40, 0x0, "movups XMMWORD PTR [rbx*1+0x40],xmm1" },
+	{ "\x0f\x11\x48\x7f", 4, 4, ShvEmulMov, 16, 0x10, 0x01, 0x00, 0xff, 0, 0, 0x7f, 0x0, "movups XMMWORD PTR [rax+0x7f],xmm1" },
+	{ "\x0f\x11\x41\x80", 4, 4, ShvEmulMov, 16, 0x10, 0x00, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "movups XMMWORD PTR [rcx-0x80],xmm0" },
+	{ "\x0f\x11\x75\x08", 4, 4, ShvEmulMov, 16, 0x10, 0x06, 0x05, 0xff, 0, 0, 0x8, 0x0, "movups XMMWORD PTR [rbp+0x8],xmm6" },
+	{ "\x0f\x11\x7c\x24\x10", 5, 5, ShvEmulMov, 16, 0x10, 0x07, 0x04, 0xff, 0, 0, 0x10, 0x0, "movups XMMWORD PTR [rsp+0x10],xmm7" },
+	{ "\x0f\x11\x44\x5d\xf8", 5, 5, ShvEmulMov, 16, 0x10, 0x00, 0x05, 0x03, 2, 0, 0xfffffffffffffff8, 0x0, "movups XMMWORD PTR [rbp+rbx*2-0x8],xmm0" },
+	{ "\x0f\x11\xb1\x00\x10\x00\x00", 7, 7, ShvEmulMov, 16, 0x10, 0x06, 0x01, 0xff, 0, 0, 0x1000, 0x0, "movups XMMWORD PTR [rcx+0x1000],xmm6" },
+	{ "\x0f\x11\xa5\x00\x00\x00\x80", 7, 7, ShvEmulMov, 16, 0x10, 0x04, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x0, "movups XMMWORD PTR [rbp-0x80000000],xmm4" },
+	{ "\x0f\x11\xb4\xe5\x44\x33\x22\x11", 8, 8, ShvEmulMov, 16, 0x10, 0x06, 0x05, 0xff, 0, 0, 0x11223344, 0x0, "movups XMMWORD PTR [rbp+riz*8+0x11223344],xmm6" },
+	{ "\x0f\x11\xd0", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movups xmm0,xmm2" },
+	{ "\x0f\x11\xdf", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movups xmm7,xmm3" },
+	{ "\xf2\xf3\x0f\x11\x1d\xf0\xff\xff\xff", 9, 9, ShvEmulMov, 4, 0x10, 0x03, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "repnz movss DWORD PTR [rip+0xfffffffffffffff0],xmm3 # 0x6459" },
+	{ "\x66\x66\x0f\x11\x3c\x24", 6, 6, ShvEmulMov, 16, 0x10, 0x07, 0x04, 0xff, 0, 0, 0x0, 0x0, "data16 movupd XMMWORD PTR [rsp],xmm7" },
+	{ "\x2e\x64\x0f\x11\x38", 5, 5, ShvEmulMov, 16, 0x10, 0x07, 0x00, 0xff, 0, 1, 0x0, 0x0, "cs movups XMMWORD PTR fs:[rax],xmm7" },
+	{ "\xf0\x65\x67\x0f\x11\x3c\x20", 7, 7, ShvEmulMov, 16, 0x19, 0x07, 0x00, 0xff, 0, 2, 0x0, 0x0, "lock movups XMMWORD PTR gs:[eax+eiz*1],xmm7" },
+	{ "\x65\x0f\x11\x2d\x10\x00\x00\x00", 8, 8, ShvEmulMov, 16, 0x10, 0x05, 0x10, 0xff, 0, 2, 0x10, 0x0, "movups XMMWORD PTR gs:[rip+0x10],xmm5 # 0x64f8" },
+	{ "\xf0\x66\x0f\x11\x05\xf0\xff\xff\xff", 9, 9, ShvEmulMov, 16, 0x11, 0x00, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "lock movupd XMMWORD PTR [rip+0xfffffffffffffff0],xmm0 # 0x64f9" },
+	{ "\x36\x0f\x11\x75\x08", 5, 5, ShvEmulMov, 16, 0x10, 0x06, 0x05, 0xff, 0, 0, 0x8, 0x0, "ss movups XMMWORD PTR [rbp+0x8],xmm6" },
+	{ "\x26\x0f\x11\x69\x80", 5, 5, ShvEmulMov, 16, 0x10, 0x05, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "es movups XMMWORD PTR [rcx-0x80],xmm5" },
+	{ "\x64\x65\x0f\x11\x1d\x10\x00\x00\x00", 9, 9, ShvEmulMov, 16, 0x10, 0x03, 0x10, 0xff, 0, 2, 0x10, 0x0, "fs movups XMMWORD PTR gs:[rip+0x10],xmm3 # 0x6579" },
+	{ "\x67\x0f\x11\x99\x00\x10\x00\x00", 8, 8, ShvEmulMov, 16, 0x18, 0x03, 0x01, 0xff, 0, 0, 0x1000, 0x0, "movups XMMWORD PTR [ecx+0x1000],xmm3" },
+	{ "\x66\xf2\x0f\x11\x5d\x08", 6, 6, ShvEmulMov, 8, 0x10, 0x03, 0x05, 0xff, 0, 0, 0x8, 0x0, "data16 movsd QWORD PTR [rbp+0x8],xmm3" },
+	{ "\xf3\x41\x0f\x11\x04\x24", 6, 6, ShvEmulMov, 4, 0x14, 0x00, 0x0c, 0xff, 0, 0, 0x0, 0x0, "movss DWORD PTR [r12],xmm0" },
+	{ "\x67\x44\x0f\x11\x24\xa0", 6, 6, ShvEmulMov, 16, 0x1c, 0x0c, 0x00, 0xff, 0, 0, 0x0, 0x0, "movups XMMWORD PTR [eax+eiz*4],xmm12" },
+	{ "\x66\x4c\x0f\x11\x34\x65\x00\x10\x00\x00", 10, 10, ShvEmulMov, 16, 0x14, 0x0e, 0xff, 0xff, 0, 0, 0x1000, 0x0, "rex.WR movupd XMMWORD PTR [riz*2+0x1000],xmm14" },
+	{ "\x67\x42\x0f\x11\x36", 5, 5, ShvEmulMov, 16, 0x1c, 0x06, 0x06, 0xff, 0, 0, 0x0, 0x0, "rex.X movups XMMWORD PTR [esi],xmm6" },
+	{ "\x0f\x29\x08", 3, 3, ShvEmulMov, 16, 0x10, 0x01, 0x00, 0xff, 0, 0, 0x0, 0x0, "movaps XMMWORD PTR [rax],xmm1" },
+	{ "\x0f\x29\x03", 3, 3, ShvEmulMov, 16, 0x10, 0x00, 0x03, 0xff, 0, 0, 0x0, 0x0, "movaps XMMWORD PTR [rbx],xmm0" },
+	{ "\x0f\x29\x36", 3, 3, ShvEmulMov, 16, 0x10, 0x06, 0x06, 0xff, 0, 0, 0x0, 0x0, "movaps XMMWORD PTR [rsi],xmm6" },
+	{ "\x0f\x29\x27", 3, 3, ShvEmulMov, 16, 0x10, 0x04, 0x07, 0xff, 0, 0, 0x0, 0x0, "movaps XMMWORD PTR [rdi],xmm4" },
+	{ "\x0f\x29\x3d\x10\x00\x00\x00", 7, 7, ShvEmulMov, 16, 0x10, 0x07, 0x10, 0xff, 0, 0, 0x10, 0x0, "movaps XMMWORD PTR [rip+0x10],xmm7 # 0x66d7" },
+	{ "\x0f\x29\x05\xf0\xff\xff\xff", 7, 7, ShvEmulMov, 16, 0x10, 0x00, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "movaps XMMWORD PTR [rip+0xfffffffffffffff0],xmm0 # 0x66d7" },
+	{ "\x0f\x29\x3c\x24", 4, 4, ShvEmulMov, 16, 0x10, 0x07, 0x04, 0xff, 0, 0, 0x0, 0x0, "movaps XMMWORD PTR [rsp],xmm7" },
+	{ "\x0f\x29\x3c\x98", 4, 4, ShvEmulMov, 16, 0x10, 0x07, 0x00, 0x03, 4, 0, 0x0, 0x0, "movaps XMMWORD PTR [rax+rbx*4],xmm7" },
+	{ "\x0f\x29\x14\x20", 4, 4, ShvEmulMov, 16, 0x10, 0x02, 0x00, 0xff, 0, 0, 0x0, 0x0, "movaps XMMWORD PTR [rax+riz*1],xmm2" },
+	{ "\x0f\x29\x14\xa0", 4, 4, ShvEmulMov, 16, 0x10, 0x02, 0x00, 0xff, 0, 0, 0x0, 0x0, "movaps XMMWORD PTR [rax+riz*4],xmm2" },
+	{ "\x0f\x29\x24\x25\x78\x56\x34\x12", 8, 8, ShvEmulMov, 16, 0x10, 0x04, 0xff, 0xff, 0, 0, 0x12345678, 0x0, "movaps XMMWORD PTR ds:0x12345678,xmm4" },
+	{ "\x0f\x29\x3c\x25\xf0\xff\xff\xff", 8, 8, ShvEmulMov, 16, 0x10, 0x07, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "movaps XMMWORD PTR ds:0xfffffffffffffff0,xmm7" },
+	{ "\x0f\x29\x24\x65\x00\x10\x00\x00", 8, 8, ShvEmulMov, 16, 0x10, 0x04, 0xff, 0xff, 0, 0, 0x1000, 0x0, "movaps XMMWORD PTR [riz*2+0x1000],xmm4" },
+	{ "\x0f\x29\x04\xcd\x40\x00\x00\x00", 8, 8, ShvEmulMov, 16, 0x10, 0x00, 0xff, 0x01, 8, 0, 0x40, 0x0, "movaps XMMWORD PTR [rcx*8+0x40],xmm0" },
+	{ "\x0f\x29\x1c\x1d\x40\x00\x00\x00", 8, 8, ShvEmulMov, 16, 0x10, 0x03, 0xff, 0x03, 1, 0, 0x40, 0x0, "movaps XMMWORD PTR [rbx*1+0x40],xmm3" },
+	{ "\x0f\x29\x60\x7f", 4, 4, ShvEmulMov, 16, 0x10, 0x04, 0x00, 0xff, 0, 0, 0x7f, 0x0, "movaps XMMWORD PTR [rax+0x7f],xmm4" },
+	{ "\x0f\x29\x41\x80", 4, 4, ShvEmulMov, 16, 0x10, 0x00, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "movaps XMMWORD PTR [rcx-0x80],xmm0" },
+	{ "\x0f\x29\x6d\x08", 4, 4, ShvEmulMov, 16, 0x10, 0x05, 0x05, 0xff, 0, 0, 0x8, 0x0, "movaps XMMWORD PTR [rbp+0x8],xmm5" },
+	{ "\x0f\x29\x4c\x24\x10", 5, 5, ShvEmulMov, 16, 0x10, 0x01, 0x04, 0xff, 0, 0, 0x10, 0x0, "movaps XMMWORD PTR [rsp+0x10],xmm1" },
+	{ "\x0f\x29\x7c\x5d\xf8", 5, 5, ShvEmulMov, 16, 0x10, 0x07, 0x05, 0x03, 2, 0, 0xfffffffffffffff8, 0x0, "movaps XMMWORD PTR [rbp+rbx*2-0x8],xmm7" },
+	{ "\x0f\x29\x91\x00\x10\x00\x00", 7, 7, ShvEmulMov, 16, 0x10, 0x02, 0x01, 0xff, 0, 0, 0x1000, 0x0, "movaps XMMWORD PTR [rcx+0x1000],xmm2" },
+	{ "\x0f\x29\xbd\x00\x00\x00\x80", 7, 7, ShvEmulMov, 16, 0x10, 0x07, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x0, "movaps XMMWORD PTR [rbp-0x80000000],xmm7" },
+	{ "\x0f\x29\x9c\xe5\x44\x33\x22\x11", 8, 8, ShvEmulMov, 16, 0x10, 0x03, 0x05, 0xff, 0, 0, 0x11223344, 0x0, "movaps XMMWORD PTR [rbp+riz*8+0x11223344],xmm3" },
+	{ "\x0f\x29\xe8", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movaps xmm0,xmm5" },
+	{ "\x0f\x29\xdf", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movaps xmm7,xmm3" },
+	{ "\x36\x0f\x29\x24\x25\x78\x56\x34\x12", 9, 9, ShvEmulMov, 16, 0x10, 0x04, 0xff, 0xff, 0, 0, 0x12345678, 0x0, "ss movaps XMMWORD PTR ds:0x12345678,xmm4" },
+	{ "\x66\x0f\x29\x04\x1d\x40\x00\x00\x00", 9, 9, ShvEmulMov, 16, 0x10, 0x00, 0xff, 0x03, 1, 0, 0x40, 0x0, "movapd XMMWORD PTR [rbx*1+0x40],xmm0" },
+	{ "\x66\x66\x0f\x29\x1d\xf0\xff\xff\xff", 9, 9, ShvEmulMov, 16, 0x10, 0x03, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "data16 movapd XMMWORD PTR [rip+0xfffffffffffffff0],xmm3 # 0x6999" },
+	{ "\xf3\xf2\x0f\x29\x95\x00\x00\x00\x80\x34\x12\x00\x00", 13, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xf0\x0f\x29\x24\xa0", 5, 5, ShvEmulMov, 16, 0x11, 0x04, 0x00, 0xff, 0, 0, 0x0, 0x0, "lock movaps XMMWORD PTR [rax+riz*4],xmm4" },
+	{ "\xf0\x65\x67\x0f\x29\x14\x65\x00\x10\x00\x00", 11, 11, ShvEmulMov, 16, 0x19, 0x02, 0xff, 0xff, 0, 2, 0x1000, 0x0, "lock movaps XMMWORD PTR gs:[eiz*2+0x1000],xmm2" },
+	{ "\x65\x2e\x0f\x29\xbc\xe5\x44\x33\x22\x11", 10, 10, ShvEmulMov, 16, 0x10, 0x07, 0x05, 0xff, 0, 2, 0x11223344, 0x0, "gs movaps XMMWORD PTR gs:[rbp+riz*8+0x11223344],xmm7" },
+	{ "\x2e\x0f\x29\x3b", 4, 4, ShvEmulMov, 16, 0x10, 0x07, 0x03, 0xff, 0, 0, 0x0, 0x0, "cs movaps XMMWORD PTR [rbx],xmm7" },
+	{ "\x64\x0f\x29\x34\x98", 5, 5, ShvEmulMov, 16, 0x10, 0x06, 0x00, 0x03, 4, 1, 0x0, 0x0, "movaps XMMWORD PTR fs:[rax+rbx*4],xmm6" },
+	{ "\x3e\x0f\x29\x1c\x20", 5, 5, ShvEmulMov, 16, 0x10, 0x03, 0x00, 0xff, 0, 0, 0x0, 0x0, "ds movaps XMMWORD PTR [rax+riz*1],xmm3" },
+	{ "\x2e\x64\x0f\x29\x35\x10\x00\x00\x00", 9, 9, ShvEmulMov, 16, 0x10, 0x06, 0x10, 0xff, 0, 1, 0x10, 0x0, "cs movaps XMMWORD PTR fs:[rip+0x10],xmm6 # 0x6ab9" },
+	{ "\x48\x0f\x29\xac\xe5\x44\x33\x22\x11", 9, 9, ShvEmulMov, 16, 0x14, 0x05, 0x05, 0xff, 0, 0, 0x11223344, 0x0, "rex.W movaps XMMWORD PTR [rbp+riz*8+0x11223344],xmm5" },
+	{ "\x65\x4f\x0f\x29\x3c\x98", 6, 6, ShvEmulMov, 16, 0x14, 0x0f, 0x08, 0x0b, 4, 2, 0x0, 0x0, "rex.WRXB movaps XMMWORD PTR gs:[r8+r11*4],xmm15" },
+	{ "\xf2\x41\x0f\x29\x08\x34\x12\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xf2\x4c\x0f\x29\x2c\x25\x78\x56\x34\x12\x34\x12\x00\x00", 14, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x0f\x2b\x38", 3, 3, ShvEmulMov, 16, 0x10, 0x07, 0x00, 0xff, 0, 0, 0x0, 0x0, "movntps XMMWORD PTR [rax],xmm7" },
+	{ "\x0f\x2b\x13", 3, 3, ShvEmulMov, 16, 0x10, 0x02, 0x03, 0xff, 0, 0, 0x0, 0x0, "movntps XMMWORD PTR [rbx],xmm2" },
+	{ "\x0f\x2b\x1e", 3, 3, ShvEmulMov, 16, 0x10, 0x03, 0x06, 0xff, 0, 0, 0x0, 0x0, "movntps XMMWORD PTR [rsi],xmm3" },
+	{ "\x0f\x2b\x17", 3, 3, ShvEmulMov, 16, 0x10, 0x02, 0x07, 0xff, 0, 0, 0x0, 0x0, "movntps XMMWORD PTR [rdi],xmm2" },
+	{ "\x0f\x2b\x3d\x10\x00\x00\x00", 7, 7, ShvEmulMov, 16, 0x10, 0x07, 0x10, 0xff, 0, 0, 0x10, 0x0, "movntps XMMWORD PTR [rip+0x10],xmm7 # 0x6bd7" },
+	{ "\x0f\x2b\x15\xf0\xff\xff\xff", 7, 7, ShvEmulMov, 16, 0x10, 0x02, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "movntps XMMWORD PTR [rip+0xfffffffffffffff0],xmm2 # 0x6bd7" },
+	{ "\x0f\x2b\x34\x24", 4, 4, ShvEmulMov, 16, 0x10, 0x06, 0x04, 0xff, 0, 0, 0x0, 0x0, "movntps XMMWORD PTR [rsp],xmm6" },
+	{ "\x0f\x2b\x3c\x98", 4, 4, ShvEmulMov, 16, 0x10, 0x07, 0x00, 0x03, 4, 0, 0x0, 0x0, "movntps XMMWORD PTR [rax+rbx*4],xmm7" },
+	{ "\x0f\x2b\x24\x20", 4, 4, ShvEmulMov, 16, 0x10, 0x04, 0x00, 0xff, 0, 0, 0x0, 0x0, "movntps XMMWORD PTR [rax+riz*1],xmm4" },
+	{ "\x0f\x2b\x14\xa0", 4, 4, ShvEmulMov, 16, 0x10, 0x02, 0x00, 0xff, 0, 0, 0x0, 0x0, "movntps XMMWORD PTR [rax+riz*4],xmm2" },
+	{ "\x0f\x2b\x04\x25\x78\x56\x34\x12", 8, 8, ShvEmulMov, 16, 0x10, 0x00, 0xff, 0xff, 0, 0, 0x12345678, 0x0, "movntps XMMWORD PTR ds:0x12345678,xmm0" },
+	{ "\x0f\x2b\x34\x25\xf0\xff\xff\xff", 8, 8, ShvEmulMov, 16, 0x10, 0x06, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "movntps XMMWORD PTR ds:0xfffffffffffffff0,xmm6" },
+	{ "\x0f\x2b\x14\x65\x00\x10\x00\x00", 8, 8, ShvEmulMov, 16, 0x10, 0x02, 0xff, 0xff, 0, 0, 0x1000, 0x0, "movntps XMMWORD PTR [riz*2+0x1000],xmm2" },
+	{ "\x0f\x2b\x14\xcd\x40\x00\x00\x00", 8, 8, ShvEmulMov, 16, 0x10, 0x02, 0xff, 0x01, 8, 0, 0x40, 0x0, "movntps XMMWORD PTR [rcx*8+0x40],xmm2" },
+	{ "\x0f\x2b\x04\x1d\x40\x00\x00\x00", 8, 8, ShvEmulMov, 16, 0x10, 0x00, 0xff, 0x03, 1, 0, 0x40, 0x0, "movntps XMMWORD PTR [rbx*1+0x40],xmm0" },
+	{ "\x0f\x2b\x48\x7f", 4, 4, ShvEmulMov, 16, 0x10, 0x01, 0x00, 0xff, 0, 0, 0x7f, 0x0, "movntps XMMWORD PTR [rax+0x7f],xmm1" },
+	{ "\x0f\x2b\x79\x80", 4, 4, ShvEmulMov, 16, 0x10, 0x07, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "movntps XMMWORD PTR [rcx-0x80],xmm7" },
+	{ "\x0f\x2b\x45\x08", 4, 4, ShvEmulMov, 16, 0x10, 0x00, 0x05, 0xff, 0, 0, 0x8, 0x0, "movntps XMMWORD PTR [rbp+0x8],xmm0" },
+	{ "\x0f\x2b\x4c\x24\x10", 5, 5, ShvEmulMov, 16, 0x10, 0x01, 0x04, 0xff, 0, 0, 0x10, 0x0, "movntps XMMWORD PTR [rsp+0x10],xmm1" },
+	{ "\x0f\x2b\x6c\x5d\xf8", 5, 5, ShvEmulMov, 16, 0x10, 0x05, 0x05, 0x03, 2, 0, 0xfffffffffffffff8, 0x0, "movntps XMMWORD PTR [rbp+rbx*2-0x8],xmm5" },
+	{ "\x0f\x2b\x81\x00\x10\x00\x00", 7, 7, ShvEmulMov, 16, 0x10, 0x00, 0x01, 0xff, 0, 0, 0x1000, 0x0, "movntps XMMWORD PTR [rcx+0x1000],xmm0" },
+	{ "\x0f\x2b\x95\x00\x00\x00\x80", 7, 7, ShvEmulMov, 16, 0x10, 0x02, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x0, "movntps XMMWORD PTR [rbp-0x80000000],xmm2" },
+	{ "\x0f\x2b\x9c\xe5\x44\x33\x22\x11", 8, 8, ShvEmulMov, 16, 0x10, 0x03, 0x05, 0xff, 0, 0, 0x11223344, 0x0, "movntps XMMWORD PTR [rbp+riz*8+0x11223344],xmm3" },
+	{ "\x0f\x2b\xe0\x7f\x80\xff\x01", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x0f\x2b\xf7\x34\x12\x00\x00", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xf0\x66\x0f\x2b\x1c\x25\x78\x56\x34\x12", 10, 10, ShvEmulMov, 16, 0x11, 0x03, 0xff, 0xff, 0, 0, 0x12345678, 0x0, "lock movntpd XMMWORD PTR ds:0x12345678,xmm3" },
+	{ "\x65\x2e\x0f\x2b\x2c\xcd\x40\x00\x00\x00", 10, 10, ShvEmulMov, 16, 0x10, 0x05, 0xff, 0x01, 8, 2, 0x40, 0x0, "gs movntps XMMWORD PTR gs:[rcx*8+0x40],xmm5" },
+	{ "\x67\x0f\x2b\x3d\x10\x00\x00\x00", 8, 8, ShvEmulMov, 16, 0x18, 0x07, 0x10, 0xff, 0, 0, 0x10, 0x0, "movntps XMMWORD PTR [eip+0x10],xmm7 # 0x6ed8" },
+	{ "\x65\x0f\x2b\x24\x1d\x40\x00\x00\x00", 9, 9, ShvEmulMov, 16, 0x10, 0x04, 0xff, 0x03, 1, 2, 0x40, 0x0, "movntps XMMWORD PTR gs:[rbx*1+0x40],xmm4" },
+	{ "\x66\x66\x0f\x2b\x3e", 5, 5, ShvEmulMov, 16, 0x10, 0x07, 0x06, 0xff, 0, 0, 0x0, 0x0, "data16 movntpd XMMWORD PTR [rsi],xmm7" },
+	{ "\xf2\x0f\x2b\x5c\x24\x10", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movntsd QWORD PTR [rsp+0x10],xmm3" },
+	{ "\x64\x0f\x2b\x24\x25\x78\x56\x34\x12", 9, 9, ShvEmulMov, 16, 0x10, 0x04, 0xff, 0xff, 0, 1, 0x12345678, 0x0, "movntps XMMWORD PTR fs:0x12345678,xmm4" },
+	{ "\xf3\x0f\x2b\x06", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movntss DWORD PTR [rsi],xmm0" },
+	{ "\x36\x0f\x2b\x3d\x10\x00\x00\x00", 8, 8, ShvEmulMov, 16, 0x10, 0x07, 0x10, 0xff, 0, 0, 0x10, 0x0, "ss movntps XMMWORD PTR [rip+0x10],xmm7 # 0x6f98" },
+	{ "\x2e\x64\x0f\x2b\x05\x10\x00\x00\x00", 9, 9, ShvEmulMov, 16, 0x10, 0x00, 0x10, 0xff, 0, 1, 0x10, 0x0, "cs movntps XMMWORD PTR fs:[rip+0x10],xmm0 # 0x6fb9" },
+	{ "\x66\x67\x0f\x2b\x3f", 5, 5, ShvEmulMov, 16, 0x18, 0x07, 0x07, 0xff, 0, 0, 0x0, 0x0, "movntpd XMMWORD PTR [edi],xmm7" },
+	{ "\x48\x0f\x2b\x04\xcd\x40\x00\x00\x00", 9, 9, ShvEmulMov, 16, 0x14, 0x00, 0xff, 0x01, 8, 0, 0x40, 0x0, "rex.W movntps XMMWORD PTR [rcx*8+0x40],xmm0" },
+	{ "\x67\x4f\x0f\x2b\x15\xf0\xff\xff\xff", 9, 9, ShvEmulMov, 16, 0x1c, 0x0a, 0x10, 0xff, 0, 0, 0xfffffff0, 0x0, "rex.WRXB movntps XMMWORD PTR [eip+0xfffffffffffffff0],xmm10 # 0x6ff9" },
+	{ "\x65\x41\x0f\x2b\xac\xe5\x44\x33\x22\x11", 10, 10, ShvEmulMov, 16, 0x14, 0x05, 0x0d, 0xff, 0, 2, 0x11223344, 0x0, "movntps XMMWORD PTR gs:[r13+riz*8+0x11223344],xmm5" },
+	{ "\x67\x4c\x0f\x2b\x10", 5, 5, ShvEmulMov, 16, 0x1c, 0x0a, 0x00, 0xff, 0, 0, 0x0, 0x0, "rex.WR movntps XMMWORD PTR [eax],xmm10" },
+	{ "\x0f\x7e\x00", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movd DWORD PTR [rax],mm0" },
+	{ "\x0f\x7e\x13", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movd DWORD PTR [rbx],mm2" },
+	{ "\x0f\x7e\x2e", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movd DWORD PTR [rsi],mm5" },
+	{ "\x0f\x7e\x3f", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movd DWORD PTR [rdi],mm7" },
+	{ "\x0f\x7e\x15\x10\x00\x00\x00", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movd DWORD PTR [rip+0x10],mm2 # 0x70f7" },
+	{ "\x0f\x7e\x05\xf0\xff\xff\xff", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movd DWORD PTR [rip+0xfffffffffffffff0],mm0 # 0x70f7" },
+	{ "\x0f\x7e\x14\x24", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movd DWORD PTR [rsp],mm2" },
+	{ "\x0f\x7e\x3c\x98", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movd DWORD PTR [rax+rbx*4],mm7" },
+	{ "\x0f\x7e\x3c\x20", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movd DWORD PTR [rax+riz*1],mm7" },
+	{ "\x0f\x7e\x2c\xa0", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movd DWORD PTR [rax+riz*4],mm5" },
+	{ "\x0f\x7e\x34\x25\x78\x56\x34\x12", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movd DWORD PTR ds:0x12345678,mm6" },
+	{ "\x0f\x7e\x34\x25\xf0\xff\xff\xff", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movd DWORD PTR ds:0xfffffffffffffff0,mm6" },
+	{ "\x0f\x7e\x0c\x65\x00\x10\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movd DWORD PTR [riz*2+0x1000],mm1" },
+	{ "\x0f\x7e\x24\xcd\x40\x00\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movd DWORD PTR [rcx*8+0x40],mm4" },
+	{ "\x0f\x7e\x04\x1d\x40\x00\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movd DWORD PTR [rbx*1+0x40],mm0" },
+	{ "\x0f\x7e\x58\x7f", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movd DWORD PTR [rax+0x7f],mm3" },
+	{ "\x0f\x7e\x61\x80", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movd DWORD PTR [rcx-0x80],mm4" },
+	{ "\x0f\x7e\x4d\x08", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movd DWORD PTR [rbp+0x8],mm1" },
+	{ "\x0f\x7e\x7c\x24\x10", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movd DWORD PTR [rsp+0x10],mm7" },
+	{ "\x0f\x7e\x7c\x5d\xf8", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movd DWORD PTR [rbp+rbx*2-0x8],mm7" },
+	{ "\x0f\x7e\xa9\x00\x10\x00\x00", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movd DWORD PTR [rcx+0x1000],mm5" },
+	{ "\x0f\x7e\x8d\x00\x00\x00\x80", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movd DWORD PTR [rbp-0x80000000],mm1" },
+	{ "\x0f\x7e\xa4\xe5\x44\x33\x22\x11", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movd DWORD PTR [rbp+riz*8+0x11223344],mm4" },
+	{ "\x0f\x7e\xe8", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movd eax,mm5" },
+	{ "\x0f\x7e\xdf", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movd edi,mm3" },
+	{ "\xf2\x0f\x7e\x14\x25\x78\x56\x34\x12\x34\x12\x00\x00", 13, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x67\x0f\x7e\x44\x5d\xf8", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movd DWORD PTR [ebp+ebx*2-0x8],mm0" },
+	{ "\xf0\x66\x0f\x7e\x35\x10\x00\x00\x00", 9, 9, ShvEmulMov, 4, 0x11, 0x06, 0x10, 0xff, 0, 0, 0x10, 0x0, "lock movd DWORD PTR [rip+0x10],xmm6 # 0x73d9" },
+	{ "\x66\xf2\x0f\x7e\x34\x65\x00\x10\x00\x00\xf0\xff\xff\xff", 14, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 (bad)" },
+	{ "\x0f\x7e\x2c\x25\xf0\xff\xff\xff", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movd DWORD PTR ds:0xfffffffffffffff0,mm5" },
+	{ "\xf0\x65\x67\x0f\x7e\x1c\x20", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock movd DWORD PTR gs:[eax+eiz*1],mm3" },
+	{ "\x2e\x64\x0f\x7e\x24\x65\x00\x10\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs movd DWORD PTR fs:[riz*2+0x1000],mm4" },
+	{ "\x64\x65\x0f\x7e\x37", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "fs movd DWORD PTR gs:[rdi],mm6" },
+	{ "\x65\x0f\x7e\x36", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movd DWORD PTR gs:[rsi],mm6" },
+	{ "\x66\x67\x0f\x7e\x54\x5d\xf8", 7, 7, ShvEmulMov, 4, 0x18, 0x02, 0x05, 0x03, 2, 0, 0xfffffff8, 0x0, "movd DWORD PTR [ebp+ebx*2-0x8],xmm2" },
+	{ "\xf0\xf0\x0f\x7e\x65\x08", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock lock movd DWORD PTR [rbp+0x8],mm4" },
+	{ "\x3e\x0f\x7e\xa4\xe5\x44\x33\x22\x11", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ds movd DWORD PTR [rbp+riz*8+0x11223344],mm4" },
+	{ "\xf0\x42\x0f\x7e\x04\x25\xf0\xff\xff\xff", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock movd DWORD PTR [r12*1-0x10],mm0" },
+	{ "\x66\x4f\x0f\x7e\x0c\x1d\x40\x00\x00\x00", 10, 10, ShvEmulMov, 8, 0x14, 0x09, 0xff, 0x0b, 1, 0, 0x40, 0x0, "movq QWORD PTR [r11*1+0x40],xmm9" },
+	{ "\x67\x48\x0f\x7e\x07", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movq QWORD PTR [edi],mm0" },
+	{ "\xf2\x44\x0f\x7e\x0b\x7f\x80\xff\x01", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.R (bad)" },
+	{ "\x0f\x7f\x18", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movq QWORD PTR [rax],mm3" },
+	{ "\x0f\x7f\x1b", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movq QWORD PTR [rbx],mm3" },
+	{ "\x0f\x7f\x3e", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movq QWORD PTR [rsi],mm7" },
+	{ "\x0f\x7f\x1f", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movq QWORD PTR [rdi],mm3" },
+	{ "\x0f\x7f\x2d\x10\x00\x00\x00", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movq QWORD PTR [rip+0x10],mm5 # 0x7617" },
+	{ "\x0f\x7f\x1d\xf0\xff\xff\xff", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movq QWORD PTR [rip+0xfffffffffffffff0],mm3 # 0x7617" },
+	{ "\x0f\x7f\x2c\x24", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movq QWORD PTR [rsp],mm5" },
+	{ "\x0f\x7f\x0c\x98", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movq QWORD PTR [rax+rbx*4],mm1" },
+	{ "\x0f\x7f\x24\x20", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movq QWORD PTR [rax+riz*1],mm4" },
+	{ "\x0f\x7f\x0c\xa0", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movq QWORD PTR [rax+riz*4],mm1" },
+	{ "\x0f\x7f\x0c\x25\x78\x56\x34\x12", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movq QWORD PTR ds:0x12345678,mm1" },
+	{ "\x0f\x7f\x14\x25\xf0\xff\xff\xff", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movq QWORD PTR ds:0xfffffffffffffff0,mm2" },
+	{ "\x0f\x7f\x0c\x65\x00\x10\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movq QWORD PTR [riz*2+0x1000],mm1" },
+	{ "\x0f\x7f\x0c\xcd\x40\x00\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movq QWORD PTR [rcx*8+0x40],mm1" },
+	{ "\x0f\x7f\x04\x1d\x40\x00\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movq QWORD PTR [rbx*1+0x40],mm0" },
+	{ "\x0f\x7f\x48\x7f", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movq QWORD PTR [rax+0x7f],mm1" },
+	{ "\x0f\x7f\x69\x80", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movq QWORD PTR [rcx-0x80],mm5" },
+	{ "\x0f\x7f\x75\x08", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movq QWORD PTR [rbp+0x8],mm6" },
+	{ "\x0f\x7f\x4c\x24\x10", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movq QWORD PTR [rsp+0x10],mm1" },
+	{ "\x0f\x7f\x4c\x5d\xf8", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movq QWORD PTR [rbp+rbx*2-0x8],mm1" },
+	{ "\x0f\x7f\xa9\x00\x10\x00\x00", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movq QWORD PTR [rcx+0x1000],mm5" },
+	{ "\x0f\x7f\xad\x00\x00\x00\x80", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movq QWORD PTR [rbp-0x80000000],mm5" },
+	{ "\x0f\x7f\xb4\xe5\x44\x33\x22\x11", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movq QWORD PTR [rbp+riz*8+0x11223344],mm6" },
+	{ "\x0f\x7f\xc8", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movq mm0,mm1" },
+	{ "\x0f\x7f\xdf", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movq mm7,mm3" },
+	{ "\xf3\x0f\x7f\x2c\x25\xf0\xff\xff\xff", 9, 9, ShvEmulMov, 16, 0x10, 0x05, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "movdqu XMMWORD PTR ds:0xfffffffffffffff0,xmm5" },
+	{ "\x66\x66\x0f\x7f\x35\xf0\xff\xff\xff", 9, 9, ShvEmulMov, 16, 0x10, 0x06, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "data16 movdqa XMMWORD PTR [rip+0xfffffffffffffff0],xmm6 # 0x78b9" },
+	{ "\x64\x0f\x7f\x04\x1d\x40\x00\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movq QWORD PTR fs:[rbx*1+0x40],mm0" },
+	{ "\x65\x2e\x0f\x7f\x14\xa0", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "gs movq QWORD PTR gs:[rax+riz*4],mm2" },
+	{ "\xf0\x66\x0f\x7f\x91\x00\x10\x00\x00", 9, 9, ShvEmulMov, 16, 0x11, 0x02, 0x01, 0xff, 0, 0, 0x1000, 0x0, "lock movdqa XMMWORD PTR [rcx+0x1000],xmm2" },
+	{ "\xf0\x0f\x7f\x3c\x1d\x40\x00\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock movq QWORD PTR [rbx*1+0x40],mm7" },
+	{ "\xf3\xf2\x0f\x7f\x14\x24\x7f\x80\xff\x01", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz (bad)" },
+	{ "\x64\x65\x0f\x7f\x30", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "fs movq QWORD PTR gs:[rax],mm6" },
+	{ "\xf2\xf3\x0f\x7f\x03", 5, 5, ShvEmulMov, 16, 0x10, 0x00, 0x03, 0xff, 0, 0, 0x0, 0x0, "repnz movdqu XMMWORD PTR [rbx],xmm0" },
+	{ "\x67\x0f\x7f\x03", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movq QWORD PTR [ebx],mm0" },
+	{ "\xf0\x65\x67\x0f\x7f\x6c\x5d\xf8", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock movq QWORD PTR gs:[ebp+ebx*2-0x8],mm5" },
+	{ "\x0f\x7f\xb5\x00\x00\x00\x80", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movq QWORD PTR [rbp-0x80000000],mm6" },
+	{ "\xf2\x42\x0f\x7f\x06\x34\x12\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.X (bad)" },
+	{ "\x66\x48\x0f\x7f\x3c\x25\xf0\xff\xff\xff", 10, 10, ShvEmulMov, 16, 0x14, 0x07, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "rex.W movdqa XMMWORD PTR ds:0xfffffffffffffff0,xmm7" },
+	{ "\x66\x4c\x0f\x7f\x24\x1d\x40\x00\x00\x00", 10, 10, ShvEmulMov, 16, 0x14, 0x0c, 0xff, 0x03, 1, 0, 0x40, 0x0, "rex.WR movdqa XMMWORD PTR [rbx*1+0x40],xmm12" },
+	{ "\x66\x44\x0f\x7f\x24\x20", 6, 6, ShvEmulMov, 16, 0x14, 0x0c, 0x00, 0xff, 0, 0, 0x0, 0x0, "movdqa XMMWORD PTR [rax+riz*1],xmm12" },
+	{ "\x0f\xb0\x28", 3, 3, ShvEmulCmpxchg, 1, 0x00, 0x05, 0x00, 0xff, 0, 0, 0x0, 0x0, "cmpxchg BYTE PTR [rax],ch" },
+	{ "\x0f\xb0\x0b", 3, 3, ShvEmulCmpxchg, 1, 0x00, 0x01, 0x03, 0xff, 0, 0, 0x0, 0x0, "cmpxchg BYTE PTR [rbx],cl" },
+	{ "\x0f\xb0\x36", 3, 3, ShvEmulCmpxchg, 1, 0x00, 0x06, 0x06, 0xff, 0, 0, 0x0, 0x0, "cmpxchg BYTE PTR [rsi],dh" },
+	{ "\x0f\xb0\x17", 3, 3, ShvEmulCmpxchg, 1, 0x00, 0x02, 0x07, 0xff, 0, 0, 0x0, 0x0, "cmpxchg BYTE PTR [rdi],dl" },
+	{ "\x0f\xb0\x35\x10\x00\x00\x00", 7, 7, ShvEmulCmpxchg, 1, 0x00, 0x06, 0x10, 0xff, 0, 0, 0x10, 0x0, "cmpxchg BYTE PTR [rip+0x10],dh # 0x7b37" },
+	{ "\x0f\xb0\x2d\xf0\xff\xff\xff", 7, 7, ShvEmulCmpxchg, 1, 0x00, 0x05, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "cmpxchg BYTE PTR [rip+0xfffffffffffffff0],ch # 0x7b37" },
+	{ "\x0f\xb0\x04\x24", 4, 4, ShvEmulCmpxchg, 1, 0x00, 0x00, 0x04, 0xff, 0, 0, 0x0, 0x0, "cmpxchg BYTE PTR [rsp],al" },
+	{ "\x0f\xb0\x1c\x98", 4, 4, ShvEmulCmpxchg, 1, 0x00, 0x03, 0x00, 0x03, 4, 0, 0x0, 0x0, "cmpxchg BYTE PTR [rax+rbx*4],bl" },
+	{ "\x0f\xb0\x0c\x20", 4, 4, ShvEmulCmpxchg, 1, 0x00, 0x01, 0x00, 0xff, 0, 0, 0x0, 0x0, "cmpxchg BYTE PTR [rax+riz*1],cl" },
+	{ "\x0f\xb0\x24\xa0", 4, 4, ShvEmulCmpxchg, 1, 0x00, 0x04, 0x00, 0xff, 0, 0, 0x0, 0x0, "cmpxchg BYTE PTR [rax+riz*4],ah" },
+	{ "\x0f\xb0\x14\x25\x78\x56\x34\x12", 8, 8, ShvEmulCmpxchg, 1, 0x00, 0x02, 0xff, 0xff, 0, 0, 0x12345678, 0x0, "cmpxchg BYTE PTR ds:0x12345678,dl" },
+	{ "\x0f\xb0\x2c\x25\xf0\xff\xff\xff", 8, 8, ShvEmulCmpxchg, 1, 0x00, 0x05, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "cmpxchg BYTE PTR ds:0xfffffffffffffff0,ch" },
+	{ "\x0f\xb0\x0c\x65\x00\x10\x00\x00", 8, 8, ShvEmulCmpxchg, 1, 0x00, 0x01, 0xff, 0xff, 0, 0, 0x1000, 0x0, "cmpxchg BYTE PTR [riz*2+0x1000],cl" },
+	{ "\x0f\xb0\x14\xcd\x40\x00\x00\x00", 8, 8, ShvEmulCmpxchg, 1, 0x00, 0x02, 0xff, 0x01, 8, 0, 0x40, 0x0, "cmpxchg BYTE PTR [rcx*8+0x40],dl" },
+	{ "\x0f\xb0\x1c\x1d\x40\x00\x00\x00", 8, 8, ShvEmulCmpxchg, 1, 0x00, 0x03, 0xff, 0x03, 1, 0, 0x40, 0x0, "cmpxchg BYTE PTR [rbx*1+0x40],bl" },
+	{ "\x0f\xb0\x58\x7f", 4, 4, ShvEmulCmpxchg, 1, 0x00, 0x03, 0x00, 0xff, 0, 0, 0x7f, 0x0, "cmpxchg BYTE PTR [rax+0x7f],bl" },
+	{ "\x0f\xb0\x49\x80", 4, 4, ShvEmulCmpxchg, 1, 0x00, 0x01, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "cmpxchg BYTE PTR [rcx-0x80],cl" },
+	{ "\x0f\xb0\x5d\x08", 4, 4, ShvEmulCmpxchg, 1, 0x00, 0x03, 0x05, 0xff, 0, 0, 0x8, 0x0, "cmpxchg BYTE PTR [rbp+0x8],bl" },
+	{ "\x0f\xb0\x6c\x24\x10", 5, 5, ShvEmulCmpxchg, 1, 0x00, 0x05, 0x04, 0xff, 0, 0, 0x10, 0x0, "cmpxchg BYTE PTR [rsp+0x10],ch" },
+	{ "\x0f\xb0\x64\x5d\xf8", 5, 5, ShvEmulCmpxchg, 1, 0x00, 0x04, 0x05, 0x03, 2, 0, 0xfffffffffffffff8, 0x0, "cmpxchg BYTE PTR [rbp+rbx*2-0x8],ah" },
+	{ "\x0f\xb0\xa9\x00\x10\x00\x00", 7, 7, ShvEmulCmpxchg, 1, 0x00, 0x05, 0x01, 0xff, 0, 0, 0x1000, 0x0, "cmpxchg BYTE PTR [rcx+0x1000],ch" },
+	{ "\x0f\xb0\x85\x00\x00\x00\x80", 7, 7, ShvEmulCmpxchg, 1, 0x00, 0x00, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x0, "cmpxchg BYTE PTR [rbp-0x80000000],al" },
+	{ "\x0f\xb0\xa4\xe5\x44\x33\x22\x11", 8, 8, ShvEmulCmpxchg, 1, 0x00, 0x04, 0x05, 0xff, 0, 0, 0x11223344, 0x0, "cmpxchg BYTE PTR [rbp+riz*8+0x11223344],ah" },
+	{ "\x0f\xb0\xd0", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmpxchg al,dl" },
+	{ "\x0f\xb0\xff", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmpxchg bh,bh" },
+	{ "\xf0\x66\x0f\xb0\x15\x10\x00\x00\x00", 9, 9, ShvEmulCmpxchg, 1, 0x01, 0x02, 0x10, 0xff, 0, 0, 0x10, 0x0, "lock data16 cmpxchg BYTE PTR [rip+0x10],dl # 0x7dd9" },
+	{ "\x67\x0f\xb0\x84\xe5\x44\x33\x22\x11", 9, 9, ShvEmulCmpxchg, 1, 0x08, 0x00, 0x05, 0xff, 0, 0, 0x11223344, 0x0, "cmpxchg BYTE PTR [ebp+eiz*8+0x11223344],al" },
+	{ "\x65\x0f\xb0\x24\xa0", 5, 5, ShvEmulCmpxchg, 1, 0x00, 0x04, 0x00, 0xff, 0, 2, 0x0, 0x0, "cmpxchg BYTE PTR gs:[rax+riz*4],ah" },
+	{ "\xf3\x66\x0f\xb0\x3c\xcd\x40\x00\x00\x00", 10, 10, ShvEmulCmpxchg, 1, 0x00, 0x07, 0xff, 0x01, 8, 0, 0x40, 0x0, "repz data16 cmpxchg BYTE PTR [rcx*8+0x40],bh" },
+	{ "\xf0\x65\x67\x0f\xb0\x04\x25\x78\x56\x34\x12", 11, 11, ShvEmulCmpxchg, 1, 0x09, 0x00, 0xff, 0xff, 0, 2, 0x12345678, 0x0, "lock cmpxchg BYTE PTR gs:[eiz*1+0x12345678],al" },
+	{ "\xf2\x0f\xb0\x24\x65\x00\x10\x00\x00", 9, 9, ShvEmulCmpxchg, 1, 0x00, 0x04, 0xff, 0xff, 0, 0, 0x1000, 0x0, "repnz cmpxchg BYTE PTR [riz*2+0x1000],ah" },
+	{ "\xf3\xf2\x0f\xb0\x24\x24", 6, 6, ShvEmulCmpxchg, 1, 0x00, 0x04, 0x04, 0xff, 0, 0, 0x0, 0x0, "repz repnz cmpxchg BYTE PTR [rsp],ah" },
+	{ "\xf0\x0f\xb0\x3c\xcd\x40\x00\x00\x00", 9, 9, ShvEmulCmpxchg, 1, 0x01, 0x07, 0xff, 0x01, 8, 0, 0x40, 0x0, "lock cmpxchg BYTE PTR [rcx*8+0x40],bh" },
+	{ "\x36\x0f\xb0\x0e", 4, 4, ShvEmulCmpxchg, 1, 0x00, 0x01, 0x06, 0xff, 0, 0, 0x0, 0x0, "ss cmpxchg BYTE PTR [rsi],cl" },
+	{ "\x65\x2e\x0f\xb0\xbc\xe5\x44\x33\x22\x11", 10, 10, ShvEmulCmpxchg, 1, 0x00, 0x07, 0x05, 0xff, 0, 2, 0x11223344, 0x0, "gs cmpxchg BYTE PTR gs:[rbp+riz*8+0x11223344],bh" },
+	{ "\x64\x0f\xb0\x0c\x25\xf0\xff\xff\xff", 9, 9, ShvEmulCmpxchg, 1, 0x00, 0x01, 0xff, 0xff, 0, 1, 0xfffffffffffffff0, 0x0, "cmpxchg BYTE PTR fs:0xfffffffffffffff0,cl" },
+	{ "\x26\x0f\xb0\x20", 4, 4, ShvEmulCmpxchg, 1, 0x00, 0x04, 0x00, 0xff, 0, 0, 0x0, 0x0, "es cmpxchg BYTE PTR [rax],ah" },
+	{ "\x66\x4f\x0f\xb0\x6c\x24\x10", 7, 7, ShvEmulCmpxchg, 1, 0x04, 0x0d, 0x0c, 0x0c, 1, 0, 0x10, 0x0, "data16 rex.WRXB cmpxchg BYTE PTR [r12+r12*1+0x10],r13b" },
+	{ "\x66\x42\x0f\xb0\x1c\x25\xf0\xff\xff\xff", 10, 10, ShvEmulCmpxchg, 1, 0x04, 0x03, 0xff, 0x0c, 1, 0, 0xfffffffffffffff0, 0x0, "data16 cmpxchg BYTE PTR [r12*1-0x10],bl" },
+	{ "\x66\x4c\x0f\xb0\x1c\xa0", 6, 6, ShvEmulCmpxchg, 1, 0x04, 0x0b, 0x00, 0xff, 0, 0, 0x0, 0x0, "data16 rex.WR cmpxchg BYTE PTR [rax+riz*4],r11b" },
+	{ "\x67\x41\x0f\xb0\x14\x25\x78\x56\x34\x12", 10, 10, ShvEmulCmpxchg, 1, 0x0c, 0x02, 0xff, 0xff, 0, 0, 0x12345678, 0x0, "cmpxchg BYTE PTR [eiz*1+0x12345678],dl" },
+	{ "\x0f\xb1\x08", 3, 3, ShvEmulCmpxchg, 4, 0x00, 0x01, 0x00, 0xff, 0, 0, 0x0, 0x0, "cmpxchg DWORD PTR [rax],ecx" },
+	{ "\x0f\xb1\x03", 3, 3, ShvEmulCmpxchg, 4, 0x00, 0x00, 0x03, 0xff, 0, 0, 0x0, 0x0, "cmpxchg DWORD PTR [rbx],eax" },
+	{ "\x0f\xb1\x1e", 3, 3, ShvEmulCmpxchg, 4, 0x00, 0x03, 0x06, 0xff, 0, 0, 0x0, 0x0, "cmpxchg DWORD PTR [rsi],ebx" },
+	{ "\x0f\xb1\x2f", 3, 3, ShvEmulCmpxchg, 4, 0x00, 0x05, 0x07, 0xff, 0, 0, 0x0, 0x0, "cmpxchg DWORD PTR [rdi],ebp" },
+	{ "\x0f\xb1\x3d\x10\x00\x00\x00", 7, 7, ShvEmulCmpxchg, 4, 0x00, 0x07, 0x10, 0xff, 0, 0, 0x10, 0x0, "cmpxchg DWORD PTR [rip+0x10],edi # 0x8057" },
+	{ "\x0f\xb1\x3d\xf0\xff\xff\xff", 7, 7, ShvEmulCmpxchg, 4, 0x00, 0x07, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "cmpxchg DWORD PTR [rip+0xfffffffffffffff0],edi # 0x8057" },
+	{ "\x0f\xb1\x04\x24", 4, 4, ShvEmulCmpxchg, 4, 0x00, 0x00, 0x04, 0xff, 0, 0, 0x0, 0x0, "cmpxchg DWORD PTR [rsp],eax" },
+	{ "\x0f\xb1\x2c\x98", 4, 4, ShvEmulCmpxchg, 4, 0x00, 0x05, 0x00, 0x03, 4, 0, 0x0, 0x0, "cmpxchg DWORD PTR [rax+rbx*4],ebp" },
+	{ "\x0f\xb1\x04\x20", 4, 4, ShvEmulCmpxchg, 4, 0x00, 0x00, 0x00, 0xff, 0, 0, 0x0, 0x0, "cmpxchg DWORD PTR [rax+riz*1],eax" },
+	{ "\x0f\xb1\x3c\xa0", 4, 4, ShvEmulCmpxchg, 4, 0x00, 0x07, 0x00, 0xff, 0, 0, 0x0, 0x0, "cmpxchg DWORD PTR [rax+riz*4],edi" },
+	{ "\x0f\xb1\x0c\x25\x78\x56\x34\x12", 8, 8, ShvEmulCmpxchg, 4, 0x00, 0x01, 0xff, 0xff, 0, 0, 0x12345678, 0x0, "cmpxchg DWORD PTR ds:0x12345678,ecx" },
+	{ "\x0f\xb1\x24\x25\xf0\xff\xff\xff", 8, 8, ShvEmulCmpxchg, 4, 0x00, 0x04, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "cmpxchg DWORD PTR ds:0xfffffffffffffff0,esp" },
+	{ "\x0f\xb1\x14\x65\x00\x10\x00\x00", 8, 8, ShvEmulCmpxchg, 4, 0x00, 0x02, 0xff, 0xff, 0, 0, 0x1000, 0x0, "cmpxchg DWORD PTR [riz*2+0x1000],edx" },
+	{ "\x0f\xb1\x2c\xcd\x40\x00\x00\x00", 8, 8, ShvEmulCmpxchg, 4, 0x00, 0x05, 0xff, 0x01, 8, 0, 0x40, 0x0, "cmpxchg DWORD PTR [rcx*8+0x40],ebp" },
+	{ "\x0f\xb1\x14\x1d\x40\x00\x00\x00", 8, 8, ShvEmulCmpxchg, 4, 0x00, 0x02, 0xff, 0x03, 1, 0, 0x40, 0x0, "cmpxchg DWORD PTR [rbx*1+0x40],edx" },
+	{ "\x0f\xb1\x70\x7f", 4, 4, ShvEmulCmpxchg, 4, 0x00, 0x06, 0x00, 0xff, 0, 0, 0x7f, 0x0, "cmpxchg DWORD PTR [rax+0x7f],esi" },
+	{ "\x0f\xb1\x61\x80", 4, 4, ShvEmulCmpxchg, 4, 0x00, 0x04, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "cmpxchg DWORD PTR [rcx-0x80],esp" },
+	{ "\x0f\xb1\x45\x08", 4, 4, ShvEmulCmpxchg, 4, 0x00, 0x00, 0x05, 0xff, 0, 0, 0x8, 0x0, "cmpxchg DWORD PTR [rbp+0x8],eax" },
+	{ "\x0f\xb1\x74\x24\x10", 5, 5, ShvEmulCmpxchg, 4, 0x00, 0x06, 0x04, 0xff, 0, 0, 0x10, 0x0, "cmpxchg DWORD PTR [rsp+0x10],esi" },
+	{ "\x0f\xb1\x4c\x5d\xf8", 5, 5, ShvEmulCmpxchg, 4, 0x00, 0x01, 0x05, 0x03, 2, 0, 0xfffffffffffffff8, 0x0, "cmpxchg DWORD PTR [rbp+rbx*2-0x8],ecx" },
+	{ "\x0f\xb1\x99\x00\x10\x00\x00", 7, 7, ShvEmulCmpxchg, 4, 0x00, 0x03, 0x01, 0xff, 0, 0, 0x1000, 0x0, "cmpxchg DWORD PTR [rcx+0x1000],ebx" },
+	{ "\x0f\xb1\xb5\x00\x00\x00\x80", 7, 7, ShvEmulCmpxchg, 4, 0x00, 0x06, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x0, "cmpxchg DWORD PTR [rbp-0x80000000],esi" },
+	{ "\x0f\xb1\x94\xe5\x44\x33\x22\x11", 8, 8, ShvEmulCmpxchg, 4, 0x00, 0x02, 0x05, 0xff, 0, 0, 0x11223344, 0x0, "cmpxchg DWORD PTR [rbp+riz*8+0x11223344],edx" },
+	{ "\x0f\xb1\xd8", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmpxchg eax,ebx" },
+	{ "\x0f\xb1\xf7", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmpxchg edi,esi" },
+	{ "\x66\x67\x0f\xb1\x3b", 5, 5, ShvEmulCmpxchg, 2, 0x08, 0x07, 0x03, 0xff, 0, 0, 0x0, 0x0, "cmpxchg WORD PTR [ebx],di" },
+	{ "\x3e\x0f\xb1\x74\x24\x10", 6, 6, ShvEmulCmpxchg, 4, 0x00, 0x06, 0x04, 0xff, 0, 0, 0x10, 0x0, "ds cmpxchg DWORD PTR [rsp+0x10],esi" },
+	{ "\xf3\x0f\xb1\x44\x24\x10", 6, 6, ShvEmulCmpxchg, 4, 0x00, 0x00, 0x04, 0xff, 0, 0, 0x10, 0x0, "repz cmpxchg DWORD PTR [rsp+0x10],eax" },
+	{ "\x64\x65\x0f\xb1\x04\x98", 6, 6, ShvEmulCmpxchg, 4, 0x00, 0x00, 0x00, 0x03, 4, 2, 0x0, 0x0, "fs cmpxchg DWORD PTR gs:[rax+rbx*4],eax" },
+	{ "\x65\x2e\x0f\xb1\x2f", 5, 5, ShvEmulCmpxchg, 4, 0x00, 0x05, 0x07, 0xff, 0, 2, 0x0, 0x0, "gs cmpxchg DWORD PTR gs:[rdi],ebp" },
+	{ "\x26\x0f\xb1\x34\xcd\x40\x00\x00\x00", 9, 9, ShvEmulCmpxchg, 4, 0x00, 0x06, 0xff, 0x01, 8, 0, 0x40, 0x0, "es cmpxchg DWORD PTR [rcx*8+0x40],esi" },
+	{ "\x67\x0f\xb1\x3c\x1d\x40\x00\x00\x00", 9, 9, ShvEmulCmpxchg, 4, 0x08, 0x07, 0xff, 0x03, 1, 0, 0x40, 0x0, "cmpxchg DWORD PTR [ebx*1+0x40],edi" },
+	{ "\x66\x0f\xb1\x8d\x00\x00\x00\x80", 8, 8, ShvEmulCmpxchg, 2, 0x00, 0x01, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x0, "cmpxchg WORD PTR [rbp-0x80000000],cx" },
+	{ "\x2e\x0f\xb1\x34\x24", 5, 5, ShvEmulCmpxchg, 4, 0x00, 0x06, 0x04, 0xff, 0, 0, 0x0, 0x0, "cs cmpxchg DWORD PTR [rsp],esi" },
+	{ "\xf2\x0f\xb1\x3c\x24", 5, 5, ShvEmulCmpxchg, 4, 0x00, 0x07, 0x04, 0xff, 0, 0, 0x0, 0x0, "repnz cmpxchg DWORD PTR [rsp],edi" },
+	{ "\xf0\x65\x67\x0f\xb1\x1b", 6, 6, ShvEmulCmpxchg, 4, 0x09, 0x03, 0x03, 0xff, 0, 2, 0x0, 0x0, "lock cmpxchg DWORD PTR gs:[ebx],ebx" },
+	{ "\xf2\x4f\x0f\xb1\x74\x24\x10", 7, 7, ShvEmulCmpxchg, 8, 0x04, 0x0e, 0x0c, 0x0c, 1, 0, 0x10, 0x0, "repnz cmpxchg QWORD PTR [r12+r12*1+0x10],r14" },
+	{ "\x65\x48\x0f\xb1\x0d\x10\x00\x00\x00", 9, 9, ShvEmulCmpxchg, 8, 0x04, 0x01, 0x10, 0xff, 0, 2, 0x10, 0x0, "cmpxchg QWORD PTR gs:[rip+0x10],rcx # 0x8499" },
+	{ "\xf0\x42\x0f\xb1\x84\xe5\x44\x33\x22\x11", 10, 10, ShvEmulCmpxchg, 4, 0x05, 0x00, 0x05, 0x0c, 8, 0, 0x11223344, 0x0, "lock cmpxchg DWORD PTR [rbp+r12*8+0x11223344],eax" },
+	{ "\x65\x4c\x0f\xb1\x3f", 5, 5, ShvEmulCmpxchg, 8, 0x04, 0x0f, 0x07, 0xff, 0, 2, 0x0, 0x0, "cmpxchg QWORD PTR gs:[rdi],r15" },
+	{ "\x0f\xc0\x20", 3, 3, ShvEmulXadd, 1, 0x00, 0x04, 0x00, 0xff, 0, 0, 0x0, 0x0, "xadd BYTE PTR [rax],ah" },
+	{ "\x0f\xc0\x1b", 3, 3, ShvEmulXadd, 1, 0x00, 0x03, 0x03, 0xff, 0, 0, 0x0, 0x0, "xadd BYTE PTR [rbx],bl" },
+	{ "\x0f\xc0\x16", 3, 3, ShvEmulXadd, 1, 0x00, 0x02, 0x06, 0xff, 0, 0, 0x0, 0x0, "xadd BYTE PTR [rsi],dl" },
+	{ "\x0f\xc0\x27", 3, 3, ShvEmulXadd, 1, 0x00, 0x04, 0x07, 0xff, 0, 0, 0x0, 0x0, "xadd BYTE PTR [rdi],ah" },
+	{ "\x0f\xc0\x15\x10\x00\x00\x00", 7, 7, ShvEmulXadd, 1, 0x00, 0x02, 0x10, 0xff, 0, 0, 0x10, 0x0, "xadd BYTE PTR [rip+0x10],dl # 0x8577" },
+	{ "\x0f\xc0\x3d\xf0\xff\xff\xff", 7, 7, ShvEmulXadd, 1, 0x00, 0x07, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "xadd BYTE PTR [rip+0xfffffffffffffff0],bh # 0x8577" },
+	{ "\x0f\xc0\x0c\x24", 4, 4, ShvEmulXadd, 1, 0x00, 0x01, 0x04, 0xff, 0, 0, 0x0, 0x0, "xadd BYTE PTR [rsp],cl" },
+	{ "\x0f\xc0\x2c\x98", 4, 4, ShvEmulXadd, 1, 0x00, 0x05, 0x00, 0x03, 4, 0, 0x0, 0x0, "xadd BYTE PTR [rax+rbx*4],ch" },
+	{ "\x0f\xc0\x3c\x20", 4, 4, ShvEmulXadd, 1, 0x00, 0x07, 0x00, 0xff, 0, 0, 0x0, 0x0, "xadd BYTE PTR [rax+riz*1],bh" },
+	{ "\x0f\xc0\x2c\xa0", 4, 4, ShvEmulXadd, 1, 0x00, 0x05, 0x00, 0xff, 0, 0, 0x0, 0x0, "xadd BYTE PTR [rax+riz*4],ch" },
+	{ "\x0f\xc0\x1c\x25\x78\x56\x34\x12", 8, 8, ShvEmulXadd, 1, 0x00, 0x03, 0xff, 0xff, 0, 0, 0x12345678, 0x0, "xadd BYTE PTR ds:0x12345678,bl" },
+	{ "\x0f\xc0\x0c\x25\xf0\xff\xff\xff", 8, 8, ShvEmulXadd, 1, 0x00, 0x01, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "xadd BYTE PTR ds:0xfffffffffffffff0,cl" },
+	{ "\x0f\xc0\x34\x65\x00\x10\x00\x00", 8, 8, ShvEmulXadd, 1, 0x00, 0x06, 0xff, 0xff, 0, 0, 0x1000, 0x0, "xadd BYTE PTR [riz*2+0x1000],dh" },
+	{ "\x0f\xc0\x34\xcd\x40\x00\x00\x00", 8, 8, ShvEmulXadd, 1, 0x00, 0x06, 0xff, 0x01, 8, 0, 0x40, 0x0, "xadd BYTE PTR [rcx*8+0x40],dh" },
+	{ "\x0f\xc0\x34\x1d\x40\x00\x00\x00", 8, 8, ShvEmulXadd, 1, 0x00, 0x06, 0xff, 0x03, 1, 0, 0x40, 0x0, "xadd BYTE PTR [rbx*1+0x40],dh" },
+	{ "\x0f\xc0\x78\x7f", 4, 4, ShvEmulXadd, 1, 0x00, 0x07, 0x00, 0xff, 0, 0, 0x7f, 0x0, "xadd BYTE PTR [rax+0x7f],bh" },
+	{ "\x0f\xc0\x49\x80", 4, 4, ShvEmulXadd, 1, 0x00, 0x01, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "xadd BYTE PTR [rcx-0x80],cl" },
+	{ "\x0f\xc0\x45\x08", 4, 4, ShvEmulXadd, 1, 0x00, 0x00, 0x05, 0xff, 0, 0, 0x8, 0x0, "xadd BYTE PTR [rbp+0x8],al" },
+	{ "\x0f\xc0\x54\x24\x10", 5, 5, ShvEmulXadd, 1, 0x00, 0x02, 0x04, 0xff, 0, 0, 0x10, 0x0, "xadd BYTE PTR [rsp+0x10],dl" },
+	{ "\x0f\xc0\x4c\x5d\xf8", 5, 5, ShvEmulXadd, 1, 0x00, 0x01, 0x05, 0x03, 2, 0, 0xfffffffffffffff8, 0x0, "xadd BYTE PTR [rbp+rbx*2-0x8],cl" },
+	{ "\x0f\xc0\xb1\x00\x10\x00\x00", 7, 7, ShvEmulXadd, 1, 0x00, 0x06, 0x01, 0xff, 0, 0, 0x1000, 0x0, "xadd BYTE PTR [rcx+0x1000],dh" },
+	{ "\x0f\xc0\x85\x00\x00\x00\x80", 7, 7, ShvEmulXadd, 1, 0x00, 0x00, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x0, "xadd BYTE PTR [rbp-0x80000000],al" },
+	{ "\x0f\xc0\xac\xe5\x44\x33\x22\x11", 8, 8, ShvEmulXadd, 1, 0x00, 0x05, 0x05, 0xff, 0, 0, 0x11223344, 0x0, "xadd BYTE PTR [rbp+riz*8+0x11223344],ch" },
+	{ "\x0f\xc0\xd0", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "xadd al,dl" },
+	{ "\x0f\xc0\xff", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "xadd bh,bh" },
+	{ "\x66\x0f\xc0\x91\x00\x10\x00\x00", 8, 8, ShvEmulXadd, 1, 0x00, 0x02, 0x01, 0xff, 0, 0, 0x1000, 0x0, "data16 xadd BYTE PTR [rcx+0x1000],dl" },
+	{ "\x66\x66\x0f\xc0\x34\x24", 6, 6, ShvEmulXadd, 1, 0x00, 0x06, 0x04, 0xff, 0, 0, 0x0, 0x0, "data16 data16 xadd BYTE PTR [rsp],dh" },
+	{ "\xf0\x65\x67\x0f\xc0\x24\x98", 7, 7, ShvEmulXadd, 1, 0x09, 0x04, 0x00, 0x03, 4, 2, 0x0, 0x0, "lock xadd BYTE PTR gs:[eax+ebx*4],ah" },
+	{ "\x36\x0f\xc0\x4c\x5d\xf8", 6, 6, ShvEmulXadd, 1, 0x00, 0x01, 0x05, 0x03, 2, 0, 0xfffffffffffffff8, 0x0, "ss xadd BYTE PTR [rbp+rbx*2-0x8],cl" },
+	{ "\xf0\xf0\x0f\xc0\x1f", 5, 5, ShvEmulXadd, 1, 0x01, 0x03, 0x07, 0xff, 0, 0, 0x0, 0x0, "lock lock xadd BYTE PTR [rdi],bl" },
+	{ "\xf0\x66\x0f\xc0\x24\x20", 6, 6, ShvEmulXadd, 1, 0x01, 0x04, 0x00, 0xff, 0, 0, 0x0, 0x0, "lock data16 xadd BYTE PTR [rax+riz*1],ah" },
+	{ "\x65\x2e\x0f\xc0\x10", 5, 5, ShvEmulXadd, 1, 0x00, 0x02, 0x00, 0xff, 0, 2, 0x0, 0x0, "gs xadd BYTE PTR gs:[rax],dl" },
+	{ "\x26\x0f\xc0\xbd\x00\x00\x00\x80", 8, 8, ShvEmulXadd, 1, 0x00, 0x07, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x0, "es xadd BYTE PTR [rbp-0x80000000],bh" },
+	{ "\x2e\x0f\xc0\x1c\x20", 5, 5, ShvEmulXadd, 1, 0x00, 0x03, 0x00, 0xff, 0, 0, 0x0, 0x0, "cs xadd BYTE PTR [rax+riz*1],bl" },
+	{ "\xf2\xf3\x0f\xc0\x5c\x5d\xf8", 7, 7, ShvEmulXadd, 1, 0x00, 0x03, 0x05, 0x03, 2, 0, 0xfffffffffffffff8, 0x0, "repnz repz xadd BYTE PTR [rbp+rbx*2-0x8],bl" },
+	{ "\x2e\x64\x0f\xc0\x64\x24\x10", 7, 7, ShvEmulXadd, 1, 0x00, 0x04, 0x04, 0xff, 0, 1, 0x10, 0x0, "cs xadd BYTE PTR fs:[rsp+0x10],ah" },
+	{ "\x65\x0f\xc0\x25\xf0\xff\xff\xff", 8, 8, ShvEmulXadd, 1, 0x00, 0x04, 0x10, 0xff, 0, 2, 0xfffffffffffffff0, 0x0, "xadd BYTE PTR gs:[rip+0xfffffffffffffff0],ah # 0x8958" },
+	{ "\xf0\x4f\x0f\xc0\x15\x10\x00\x00\x00", 9, 9, ShvEmulXadd, 1, 0x05, 0x0a, 0x10, 0xff, 0, 0, 0x10, 0x0, "lock rex.WRXB xadd BYTE PTR [rip+0x10],r10b # 0x8999" },
+	{ "\xf2\x42\x0f\xc0\x91\x00\x10\x00\x00", 9, 9, ShvEmulXadd, 1, 0x04, 0x02, 0x01, 0xff, 0, 0, 0x1000, 0x0, "repnz rex.X xadd BYTE PTR [rcx+0x1000],dl" },
+	{ "\xf0\x4c\x0f\xc0\xa1\x00\x10\x00\x00", 9, 9, ShvEmulXadd, 1, 0x05, 0x0c, 0x01, 0xff, 0, 0, 0x1000, 0x0, "lock rex.WR xadd BYTE PTR [rcx+0x1000],r12b" },
+	{ "\x64\x44\x0f\xc0\x9d\x00\x00\x00\x80", 9, 9, ShvEmulXadd, 1, 0x04, 0x0b, 0x05, 0xff, 0, 1, 0xffffffff80000000, 0x0, "xadd BYTE PTR fs:[rbp-0x80000000],r11b" },
+	{ "\x0f\xc1\x08", 3, 3, ShvEmulXadd, 4, 0x00, 0x01, 0x00, 0xff, 0, 0, 0x0, 0x0, "xadd DWORD PTR [rax],ecx" },
+	{ "\x0f\xc1\x23", 3, 3, ShvEmulXadd, 4, 0x00, 0x04, 0x03, 0xff, 0, 0, 0x0, 0x0, "xadd DWORD PTR [rbx],esp" },
+	{ "\x0f\xc1\x2e", 3, 3, ShvEmulXadd, 4, 0x00, 0x05, 0x06, 0xff, 0, 0, 0x0, 0x0, "xadd DWORD PTR [rsi],ebp" },
+	{ "\x0f\xc1\x27", 3, 3, ShvEmulXadd, 4, 0x00, 0x04, 0x07, 0xff, 0, 0, 0x0, 0x0, "xadd DWORD PTR [rdi],esp" },
+	{ "\x0f\xc1\x15\x10\x00\x00\x00", 7, 7, ShvEmulXadd, 4, 0x00, 0x02, 0x10, 0xff, 0, 0, 0x10, 0x0, "xadd DWORD PTR [rip+0x10],edx # 0x8a97" },
+	{ "\x0f\xc1\x05\xf0\xff\xff\xff", 7, 7, ShvEmulXadd, 4, 0x00, 0x00, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "xadd DWORD PTR [rip+0xfffffffffffffff0],eax # 0x8a97" },
+	{ "\x0f\xc1\x14\x24", 4, 4, ShvEmulXadd, 4, 0x00, 0x02, 0x04, 0xff, 0, 0, 0x0, 0x0, "xadd DWORD PTR [rsp],edx" },
+	{ "\x0f\xc1\x3c\x98", 4, 4, ShvEmulXadd, 4, 0x00, 0x07, 0x00, 0x03, 4, 0, 0x0, 0x0, "xadd DWORD PTR [rax+rbx*4],edi" },
+	{ "\x0f\xc1\x0c\x20", 4, 4, ShvEmulXadd, 4, 0x00, 0x01, 0x00, 0xff, 0, 0, 0x0, 0x0, "xadd DWORD PTR [rax+riz*1],ecx" },
+	{ "\x0f\xc1\x24\xa0", 4, 4, ShvEmulXadd, 4, 0x00, 0x04, 0x00, 0xff, 0, 0, 0x0, 0x0, "xadd DWORD PTR [rax+riz*4],esp" },
+	{ "\x0f\xc1\x04\x25\x78\x56\x34\x12", 8, 8, ShvEmulXadd, 4, 0x00, 0x00, 0xff, 0xff, 0, 0, 0x12345678, 0x0, "xadd DWORD PTR ds:0x12345678,eax" },
+	{ "\x0f\xc1\x34\x25\xf0\xff\xff\xff", 8, 8, ShvEmulXadd, 4, 0x00, 0x06, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "xadd DWORD PTR ds:0xfffffffffffffff0,esi" },
+	{ "\x0f\xc1\x3c\x65\x00\x10\x00\x00", 8, 8, ShvEmulXadd, 4, 0x00, 0x07, 0xff, 0xff, 0, 0, 0x1000, 0x0, "xadd DWORD PTR [riz*2+0x1000],edi" },
+	{ "\x0f\xc1\x34\xcd\x40\x00\x00\x00", 8, 8, ShvEmulXadd, 4, 0x00, 0x06, 0xff, 0x01, 8, 0, 0x40, 0x0, "xadd DWORD PTR [rcx*8+0x40],esi" },
+	{ "\x0f\xc1\x0c\x1d\x40\x00\x00\x00", 8, 8, ShvEmulXadd, 4, 0x00, 0x01, 0xff, 0x03, 1, 0, 0x40, 0x0, "xadd DWORD PTR [rbx*1+0x40],ecx" },
+	{ "\x0f\xc1\x50\x7f", 4, 4, ShvEmulXadd, 4, 0x00, 0x02, 0x00, 0xff, 0, 0, 0x7f, 0x0, "xadd DWORD PTR [rax+0x7f],edx" },
+	{ "\x0f\xc1\x51\x80", 4, 4, ShvEmulXadd, 4, 0x00, 0x02, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "xadd DWORD PTR [rcx-0x80],edx" },
+	{ "\x0f\xc1\x4d\x08", 4, 4, ShvEmulXadd, 4, 0x00, 0x01, 0x05, 0xff, 0, 0, 0x8, 0x0, "xadd DWORD PTR [rbp+0x8],ecx" },
+	{ "\x0f\xc1\x7c\x24\x10", 5, 5, ShvEmulXadd, 4, 0x00, 0x07, 0x04, 0xff, 0, 0, 0x10, 0x0, "xadd DWORD PTR [rsp+0x10],edi" },
+	{ "\x0f\xc1\x4c\x5d\xf8", 5, 5, ShvEmulXadd, 4, 0x00, 0x01, 0x05, 0x03, 2, 0, 0xfffffffffffffff8, 0x0, "xadd DWORD PTR [rbp+rbx*2-0x8],ecx" },
+	{ "\x0f\xc1\xa9\x00\x10\x00\x00", 7, 7, ShvEmulXadd, 4, 0x00, 0x05, 0x01, 0xff, 0, 0, 0x1000, 0x0, "xadd DWORD PTR [rcx+0x1000],ebp" },
+	{ "\x0f\xc1\x95\x00\x00\x00\x80", 7, 7, ShvEmulXadd, 4, 0x00, 0x02, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x0, "xadd DWORD PTR [rbp-0x80000000],edx" },
+	{ "\x0f\xc1\x8c\xe5\x44\x33\x22\x11", 8, 8, ShvEmulXadd, 4, 0x00, 0x01, 0x05, 0xff, 0, 0, 0x11223344, 0x0, "xadd DWORD PTR [rbp+riz*8+0x11223344],ecx" },
+	{ "\x0f\xc1\xe0", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "xadd eax,esp" },
+	{ "\x0f\xc1\xff", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "xadd edi,edi" },
+	{ "\xf3\xf2\x0f\xc1\x5c\x5d\xf8", 7, 7, ShvEmulXadd, 4, 0x00, 0x03, 0x05, 0x03, 2, 0, 0xfffffffffffffff8, 0x0, "repz repnz xadd DWORD PTR [rbp+rbx*2-0x8],ebx" },
+	{ "\xf3\x0f\xc1\x25\xf0\xff\xff\xff", 8, 8, ShvEmulXadd, 4, 0x00, 0x04, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "repz xadd DWORD PTR [rip+0xfffffffffffffff0],esp # 0x8d38" },
+	{ "\x2e\x64\x0f\xc1\x0c\xcd\x40\x00\x00\x00", 10, 10, ShvEmulXadd, 4, 0x00, 0x01, 0xff, 0x01, 8, 1, 0x40, 0x0, "cs xadd DWORD PTR fs:[rcx*8+0x40],ecx" },
+	{ "\xf0\x66\x0f\xc1\x35\x10\x00\x00\x00", 9, 9, ShvEmulXadd, 2, 0x01, 0x06, 0x10, 0xff, 0, 0, 0x10, 0x0, "lock xadd WORD PTR [rip+0x10],si # 0x8d99" },
+	{ "\x36\x0f\xc1\x16", 4, 4, ShvEmulXadd, 4, 0x00, 0x02, 0x06, 0xff, 0, 0, 0x0, 0x0, "ss xadd DWORD PTR [rsi],edx" },
+	{ "\x65\x2e\x0f\xc1\x0c\x65\x00\x10\x00\x00", 10, 10, ShvEmulXadd, 4, 0x00, 0x01, 0xff, 0xff, 0, 2, 0x1000, 0x0, "gs xadd DWORD PTR gs:[riz*2+0x1000],ecx" },
+	{ "\xf0\xf0\x0f\xc1\x1c\x24", 6, 6, ShvEmulXadd, 4, 0x01, 0x03, 0x04, 0xff, 0, 0, 0x0, 0x0, "lock lock xadd DWORD PTR [rsp],ebx" },
+	{ "\x66\xf2\x0f\xc1\x59\x80", 6, 6, ShvEmulXadd, 2, 0x00, 0x03, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "repnz xadd WORD PTR [rcx-0x80],bx" },
+	{ "\xf3\x66\x0f\xc1\x04\x24", 6, 6, ShvEmulXadd, 2, 0x00, 0x00, 0x04, 0xff, 0, 0, 0x0, 0x0, "repz xadd WORD PTR [rsp],ax" },
+	{ "\xf2\x0f\xc1\x04\x98", 5, 5, ShvEmulXadd, 4, 0x00, 0x00, 0x00, 0x03, 4, 0, 0x0, 0x0, "repnz xadd DWORD PTR [rax+rbx*4],eax" },
+	{ "\x64\x0f\xc1\x1e", 4, 4, ShvEmulXadd, 4, 0x00, 0x03, 0x06, 0xff, 0, 1, 0x0, 0x0, "xadd DWORD PTR fs:[rsi],ebx" },
+	{ "\x66\x66\x0f\xc1\x34\x25\xf0\xff\xff\xff", 10, 10, ShvEmulXadd, 2, 0x00, 0x06, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "data16 xadd WORD PTR ds:0xfffffffffffffff0,si" },
+	{ "\xf2\x48\x0f\xc1\x24\x25\x78\x56\x34\x12", 10, 10, ShvEmulXadd, 8, 0x04, 0x04, 0xff, 0xff, 0, 0, 0x12345678, 0x0, "repnz xadd QWORD PTR ds:0x12345678,rsp" },
+	{ "\x67\x44\x0f\xc1\x2c\x65\x00\x10\x00\x00", 10, 10, ShvEmulXadd, 4, 0x0c, 0x0d, 0xff, 0xff, 0, 0, 0x1000, 0x0, "xadd DWORD PTR [eiz*2+0x1000],r13d" },
+	{ "\x66\x4c\x0f\xc1\x26", 5, 5, ShvEmulXadd, 8, 0x04, 0x0c, 0x06, 0xff, 0, 0, 0x0, 0x0, "data16 xadd QWORD PTR [rsi],r12" },
+	{ "\x41\x0f\xc1\x68\x7f", 5, 5, ShvEmulXadd, 4, 0x04, 0x05, 0x08, 0xff, 0, 0, 0x7f, 0x0, "xadd DWORD PTR [r8+0x7f],ebp" },
+	{ "\x0f\xc3\x38", 3, 3, ShvEmulMov, 4, 0x00, 0x07, 0x00, 0xff, 0, 0, 0x0, 0x0, "movnti DWORD PTR [rax],edi" },
+	{ "\x0f\xc3\x0b", 3, 3, ShvEmulMov, 4, 0x00, 0x01, 0x03, 0xff, 0, 0, 0x0, 0x0, "movnti DWORD PTR [rbx],ecx" },
+	{ "\x0f\xc3\x06", 3, 3, ShvEmulMov, 4, 0x00, 0x00, 0x06, 0xff, 0, 0, 0x0, 0x0, "movnti DWORD PTR [rsi],eax" },
+	{ "\x0f\xc3\x3f", 3, 3, ShvEmulMov, 4, 0x00, 0x07, 0x07, 0xff, 0, 0, 0x0, 0x0, "movnti DWORD PTR [rdi],edi" },
+	{ "\x0f\xc3\x0d\x10\x00\x00\x00", 7, 7, ShvEmulMov, 4, 0x00, 0x01, 0x10, 0xff, 0, 0, 0x10, 0x0, "movnti DWORD PTR [rip+0x10],ecx # 0x8fb7" },
+	{ "\x0f\xc3\x1d\xf0\xff\xff\xff", 7, 7, ShvEmulMov, 4, 0x00, 0x03, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "movnti DWORD PTR [rip+0xfffffffffffffff0],ebx # 0x8fb7" },
+	{ "\x0f\xc3\x24\x24", 4, 4, ShvEmulMov, 4, 0x00, 0x04, 0x04, 0xff, 0, 0, 0x0, 0x0, "movnti DWORD PTR [rsp],esp" },
+	{ "\x0f\xc3\x34\x98", 4, 4, ShvEmulMov, 4, 0x00, 0x06, 0x00, 0x03, 4, 0, 0x0, 0x0, "movnti DWORD PTR [rax+rbx*4],esi" },
+	{ "\x0f\xc3\x34\x20", 4, 4, ShvEmulMov, 4, 0x00, 0x06, 0x00, 0xff, 0, 0, 0x0, 0x0, "movnti DWORD PTR [rax+riz*1],esi" },
+	{ "\x0f\xc3\x2c\xa0", 4, 4, ShvEmulMov, 4, 0x00, 0x05, 0x00, 0xff, 0, 0, 0x0, 0x0, "movnti DWORD PTR [rax+riz*4],ebp" },
+	{ "\x0f\xc3\x14\x25\x78\x56\x34\x12", 8, 8, ShvEmulMov, 4, 0x00, 0x02, 0xff, 0xff, 0, 0, 0x12345678, 0x0, "movnti DWORD PTR ds:0x12345678,edx" },
+	{ "\x0f\xc3\x0c\x25\xf0\xff\xff\xff", 8, 8, ShvEmulMov, 4, 0x00, 0x01, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "movnti DWORD PTR ds:0xfffffffffffffff0,ecx" },
+	{ "\x0f\xc3\x0c\x65\x00\x10\x00\x00", 8, 8, ShvEmulMov, 4, 0x00, 0x01, 0xff, 0xff, 0, 0, 0x1000, 0x0, "movnti DWORD PTR [riz*2+0x1000],ecx" },
+	{ "\x0f\xc3\x1c\xcd\x40\x00\x00\x00", 8, 8, ShvEmulMov, 4, 0x00, 0x03, 0xff, 0x01, 8, 0, 0x40, 0x0, "movnti DWORD PTR [rcx*8+0x40],ebx" },
+	{ "\x0f\xc3\x34\x1d\x40\x00\x00\x00", 8, 8, ShvEmulMov, 4, 0x00, 0x06, 0xff, 0x03, 1, 0, 0x40, 0x0, "movnti DWORD PTR [rbx*1+0x40],esi" },
+	{ "\x0f\xc3\x48\x7f", 4, 4, ShvEmulMov, 4, 0x00, 0x01, 0x00, 0xff, 0, 0, 0x7f, 0x0, "movnti DWORD PTR [rax+0x7f],ecx" },
+	{ "\x0f\xc3\x59\x80", 4, 4, ShvEmulMov, 4, 0x00, 0x03, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "movnti DWORD PTR [rcx-0x80],ebx" },
+	{ "\x0f\xc3\x45\x08", 4, 4, ShvEmulMov, 4, 0x00, 0x00, 0x05, 0xff, 0, 0, 0x8, 0x0, "movnti DWORD PTR [rbp+0x8],eax" },
+	{ "\x0f\xc3\x4c\x24\x10", 5, 5, ShvEmulMov, 4, 0x00, 0x01, 0x04, 0xff, 0, 0, 0x10, 0x0, "movnti DWORD PTR [rsp+0x10],ecx" },
+	{ "\x0f\xc3\x74\x5d\xf8", 5, 5, ShvEmulMov, 4, 0x00, 0x06, 0x05, 0x03, 2, 0, 0xfffffffffffffff8, 0x0, "movnti DWORD PTR [rbp+rbx*2-0x8],esi" },
+	{ "\x0f\xc3\xb9\x00\x10\x00\x00", 7, 7, ShvEmulMov, 4, 0x00, 0x07, 0x01, 0xff, 0, 0, 0x1000, 0x0, "movnti DWORD PTR [rcx+0x1000],edi" },
+	{ "\x0f\xc3\x85\x00\x00\x00\x80", 7, 7, ShvEmulMov, 4, 0x00, 0x00, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x0, "movnti DWORD PTR [rbp-0x80000000],eax" },
+	{ "\x0f\xc3\x84\xe5\x44\x33\x22\x11", 8, 8, ShvEmulMov, 4, 0x00, 0x00, 0x05, 0xff, 0, 0, 0x11223344, 0x0, "movnti DWORD PTR [rbp+riz*8+0x11223344],eax" },
+	{ "\x0f\xc3\xe0\x7f\x80\xff\x01", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x0f\xc3\xff\x7f\x80\xff\x01", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xf0\xf0\x0f\xc3\xb5\x00\x00\x00\x80", 9, 9, ShvEmulMov, 4, 0x01, 0x06, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x0, "lock lock movnti DWORD PTR [rbp-0x80000000],esi" },
+	{ "\x66\x0f\xc3\xad\x00\x00\x00\x80\x7f\x80\xff\x01", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x66\xf2\x0f\xc3\x24\x25\x78\x56\x34\x12\x7f\x80\xff\x01", 14, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x65\x0f\xc3\x54\x24\x10", 6, 6, ShvEmulMov, 4, 0x00, 0x02, 0x04, 0xff, 0, 2, 0x10, 0x0, "movnti DWORD PTR gs:[rsp+0x10],edx" },
+	{ "\xf3\x0f\xc3\x34\x25\xf0\xff\xff\xff\x34\x12\x00\x00", 13, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x64\x65\x0f\xc3\x06", 5, 5, ShvEmulMov, 4, 0x00, 0x00, 0x06, 0xff, 0, 2, 0x0, 0x0, "fs movnti DWORD PTR gs:[rsi],eax" },
+	{ "\x3e\x0f\xc3\x2c\x98", 5, 5, ShvEmulMov, 4, 0x00, 0x05, 0x00, 0x03, 4, 0, 0x0, 0x0, "ds movnti DWORD PTR [rax+rbx*4],ebp" },
+	{ "\x2e\x64\x0f\xc3\x69\x80", 6, 6, ShvEmulMov, 4, 0x00, 0x05, 0x01, 0xff, 0, 1, 0xffffffffffffff80, 0x0, "cs movnti DWORD PTR fs:[rcx-0x80],ebp" },
+	{ "\xf0\x65\x67\x0f\xc3\x2c\xa0", 7, 7, ShvEmulMov, 4, 0x09, 0x05, 0x00, 0xff, 0, 2, 0x0, 0x0, "lock movnti DWORD PTR gs:[eax+eiz*4],ebp" },
+	{ "\x65\x2e\x0f\xc3\x14\x24", 6, 6, ShvEmulMov, 4, 0x00, 0x02, 0x04, 0xff, 0, 2, 0x0, 0x0, "gs movnti DWORD PTR gs:[rsp],edx" },
+	{ "\xf3\x66\x0f\xc3\x1c\x25\xf0\xff\xff\xff\x34\x12\x00\x00", 14, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xf2\xf3\x0f\xc3\x04\xcd\x40\x00\x00\x00\xf0\xff\xff\xff", 14, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xf3\x40\x0f\xc3\x34\x65\x00\x10\x00\x00\x34\x12\x00\x00", 14, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xf3\x42\x0f\xc3\x30\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x44\x0f\xc3\xa9\x00\x10\x00\x00", 8, 8, ShvEmulMov, 4, 0x04, 0x0d, 0x01, 0xff, 0, 0, 0x1000, 0x0, "movnti DWORD PTR [rcx+0x1000],r13d" },
+	{ "\x66\x4f\x0f\xc3\x7d\x08\xf0\xff\xff\xff", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x0f\xd6\x28\x7f\x80\xff\x01", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x0f\xd6\x03\xf0\xff\xff\xff", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x0f\xd6\x16\xf0\xff\xff\xff", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x0f\xd6\x37\xf0\xff\xff\xff", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x0f\xd6\x15\x10\x00\x00\x00\x34\x12\x00\x00", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x0f\xd6\x2d\xf0\xff\xff\xff\x7f\x80\xff\x01", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x0f\xd6\x04\x24\x34\x12\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x0f\xd6\x0c\x98\x7f\x80\xff\x01", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x0f\xd6\x34\x20\xf0\xff\xff\xff", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x0f\xd6\x1c\xa0\xf0\xff\xff\xff", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x0f\xd6\x04\x25\x78\x56\x34\x12\xf0\xff\xff\xff", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x0f\xd6\x1c\x25\xf0\xff\xff\xff\x7f\x80\xff\x01", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x0f\xd6\x1c\x65\x00\x10\x00\x00\x34\x12\x00\x00", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x0f\xd6\x04\xcd\x40\x00\x00\x00\xf0\xff\xff\xff", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x0f\xd6\x24\x1d\x40\x00\x00\x00\x7f\x80\xff\x01", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x0f\xd6\x68\x7f\x7f\x80\xff\x01", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x0f\xd6\x61\x80\xf0\xff\xff\xff", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x0f\xd6\x7d\x08\xf0\xff\xff\xff", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x0f\xd6\x6c\x24\x10\x7f\x80\xff\x01", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x0f\xd6\x6c\x5d\xf8\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x0f\xd6\xb9\x00\x10\x00\x00\x7f\x80\xff\x01", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x0f\xd6\x85\x00\x00\x00\x80\x34\x12\x00\x00", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x0f\xd6\xa4\xe5\x44\x33\x22\x11\xf0\xff\xff\xff", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x0f\xd6\xe0\x7f\x80\xff\x01", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x0f\xd6\xf7\x7f\x80\xff\x01", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xf3\xf2\x0f\xd6\x13\x7f\x80\xff\x01", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz movdq2q mm2,(bad)" },
+	{ "\x64\x0f\xd6\x58\x7f\x7f\x80\xff\x01", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "fs (bad)" },
+	{ "\x66\x67\x0f\xd6\x7c\x5d\xf8", 7, 7, ShvEmulMov, 8, 0x18, 0x07, 0x05, 0x03, 2, 0, 0xfffffff8, 0x0, "movq QWORD PTR [ebp+ebx*2-0x8],xmm7" },
+	{ "\x64\x65\x0f\xd6\x99\x00\x10\x00\x00\x7f\x80\xff\x01", 13, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "fs gs (bad)" },
+	{ "\x0f\xd6\x0c\x25\xf0\xff\xff\xff\x7f\x80\xff\x01", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x66\xf2\x0f\xd6\x3c\xcd\x40\x00\x00\x00\x34\x12\x00\x00", 14, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movdq2q xmm7,(bad)" },
+	{ "\x2e\x64\x0f\xd6\x2c\xcd\x40\x00\x00\x00\x34\x12\x00\x00", 14, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs fs (bad)" },
+	{ "\x67\x0f\xd6\x6c\x5d\xf8\x34\x12\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "addr32 (bad)" },
+	{ "\xf2\xf3\x0f\xd6\x0c\xa0\x7f\x80\xff\x01", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz movq2dq xmm1,(bad)" },
+	{ "\xf3\x0f\xd6\x99\x00\x10\x00\x00\xf0\xff\xff\xff", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movq2dq xmm3,(bad)" },
+	{ "\x36\x0f\xd6\x5c\x24\x10\x7f\x80\xff\x01", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ss (bad)" },
+	{ "\x65\x2e\x0f\xd6\x55\x08\xf0\xff\xff\xff", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "gs cs (bad)" },
+	{ "\x67\x44\x0f\xd6\x1f\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "addr32 rex.R (bad)" },
+	{ "\x66\x48\x0f\xd6\x14\x24", 6, 6, ShvEmulMov, 8, 0x14, 0x02, 0x04, 0xff, 0, 0, 0x0, 0x0, "rex.W movq QWORD PTR [rsp],xmm2" },
+	{ "\xf3\x4f\x0f\xd6\x07\x34\x12\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WRXB movq2dq xmm8,(bad)" },
+	{ "\x66\x40\x0f\xd6\x79\x80", 6, 6, ShvEmulMov, 8, 0x14, 0x07, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "rex movq QWORD PTR [rcx-0x80],xmm7" },
+	{ "\x0f\xe7\x20", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movntq QWORD PTR [rax],mm4" },
+	{ "\x0f\xe7\x33", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movntq QWORD PTR [rbx],mm6" },
+	{ "\x0f\xe7\x06", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movntq QWORD PTR [rsi],mm0" },
+	{ "\x0f\xe7\x37", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movntq QWORD PTR [rdi],mm6" },
+	{ "\x0f\xe7\x05\x10\x00\x00\x00", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movntq QWORD PTR [rip+0x10],mm0 # 0x99f7" },
+	{ "\x0f\xe7\x2d\xf0\xff\xff\xff", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movntq QWORD PTR [rip+0xfffffffffffffff0],mm5 # 0x99f7" },
+	{ "\x0f\xe7\x24\x24", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movntq QWORD PTR [rsp],mm4" },
+	{ "\x0f\xe7\x34\x98", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movntq QWORD PTR [rax+rbx*4],mm6" },
+	{ "\x0f\xe7\x3c\x20", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movntq QWORD PTR [rax+riz*1],mm7" },
+	{ "\x0f\xe7\x04\xa0", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movntq QWORD PTR [rax+riz*4],mm0" },
+	{ "\x0f\xe7\x14\x25\x78\x56\x34\x12", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movntq QWORD PTR ds:0x12345678,mm2" },
+	{ "\x0f\xe7\x0c\x25\xf0\xff\xff\xff", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movntq QWORD PTR ds:0xfffffffffffffff0,mm1" },
+	{ "\x0f\xe7\x14\x65\x00\x10\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movntq QWORD PTR [riz*2+0x1000],mm2" },
+	{ "\x0f\xe7\x1c\xcd\x40\x00\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movntq QWORD PTR [rcx*8+0x40],mm3" },
+	{ "\x0f\xe7\x24\x1d\x40\x00\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movntq QWORD PTR [rbx*1+0x40],mm4" },
+	{ "\x0f\xe7\x70\x7f", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movntq QWORD PTR [rax+0x7f],mm6" },
+	{ "\x0f\xe7\x61\x80", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movntq QWORD PTR [rcx-0x80],mm4" },
+	{ "\x0f\xe7\x65\x08", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movntq QWORD PTR [rbp+0x8],mm4" },
+	{ "\x0f\xe7\x44\x24\x10", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movntq QWORD PTR [rsp+0x10],mm0" },
+	{ "\x0f\xe7\x5c\x5d\xf8", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movntq QWORD PTR [rbp+rbx*2-0x8],mm3" },
+	{ "\x0f\xe7\x81\x00\x10\x00\x00", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movntq QWORD PTR [rcx+0x1000],mm0" },
+	{ "\x0f\xe7\xb5\x00\x00\x00\x80", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movntq QWORD PTR [rbp-0x80000000],mm6" },
+	{ "\x0f\xe7\xac\xe5\x44\x33\x22\x11", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movntq QWORD PTR [rbp+riz*8+0x11223344],mm5" },
+	{ "\x0f\xe7\xf8\x34\x12\x00\x00", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movntq (bad),mm7" },
+	{ "\x0f\xe7\xdf\x34\x12\x00\x00", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movntq (bad),mm3" },
+	{ "\xf2\xf3\x0f\xe7\x0b\x7f\x80\xff\x01", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz (bad)" },
+	{ "\xf0\x65\x67\x0f\xe7\x38", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock movntq QWORD PTR gs:[eax],mm7" },
+	{ "\x65\x2e\x0f\xe7\x1c\x25\x78\x56\x34\x12", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "gs movntq QWORD PTR gs:0x12345678,mm3" },
+	{ "\x36\x0f\xe7\x14\xcd\x40\x00\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ss movntq QWORD PTR [rcx*8+0x40],mm2" },
+	{ "\x26\x0f\xe7\x14\xa0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "es movntq QWORD PTR [rax+riz*4],mm2" },
+	{ "\x2e\x64\x0f\xe7\x89\x00\x10\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs movntq QWORD PTR fs:[rcx+0x1000],mm1" },
+	{ "\x66\x66\x0f\xe7\x14\x25\x78\x56\x34\x12", 10, 10, ShvEmulMov, 16, 0x10, 0x02, 0xff, 0xff, 0, 0, 0x12345678, 0x0, "data16 movntdq XMMWORD PTR ds:0x12345678,xmm2" },
+	{ "\xf0\x66\x0f\xe7\xa5\x00\x00\x00\x80", 9, 9, ShvEmulMov, 16, 0x11, 0x04, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x0, "lock movntdq XMMWORD PTR [rbp-0x80000000],xmm4" },
+	{ "\x66\xf2\x0f\xe7\x2c\x25\xf0\xff\xff\xff\x34\x12\x00\x00", 14, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 (bad)" },
+	{ "\x66\x0f\xe7\xb9\x00\x10\x00\x00", 8, 8, ShvEmulMov, 16, 0x10, 0x07, 0x01, 0xff, 0, 0, 0x1000, 0x0, "movntdq XMMWORD PTR [rcx+0x1000],xmm7" },
+	{ "\x66\x67\x0f\xe7\x07", 5, 5, ShvEmulMov, 16, 0x18, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "movntdq XMMWORD PTR [edi],xmm0" },
+	{ "\x0f\xe7\x7c\x24\x10", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movntq QWORD PTR [rsp+0x10],mm7" },
+	{ "\x64\x42\x0f\xe7\x9d\x00\x00\x00\x80", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.X movntq QWORD PTR fs:[rbp-0x80000000],mm3" },
+	{ "\xf3\x40\x0f\xe7\xb4\xe5\x44\x33\x22\x11\xf0\xff\xff\xff", 14, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex (bad)" },
+	{ "\xf2\x4f\x0f\xe7\xb4\xe5\x44\x33\x22\x11\xf0\xff\xff\xff", 14, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WRXB (bad)" },
+	{ "\x44\x0f\xe7\x0d\x10\x00\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.R movntq QWORD PTR [rip+0x10],mm1 # 0x9e78" },
+	{ "\x02\x24\x1d\x40\x00\x00\x00", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "add ah,BYTE PTR [rbx*1+0x40]" },
+	{ "\x02\x1c\x98", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "add bl,BYTE PTR [rax+rbx*4]" },
+	{ "\x02\x35\x10\x00\x00\x00", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "add dh,BYTE PTR [rip+0x10] # 0x9ed6" },
+	{ "\x02\x7d\x08", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "add bh,BYTE PTR [rbp+0x8]" },
+	{ "\xf2\x02\x34\xcd\x40\x00\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz add dh,BYTE PTR [rcx*8+0x40]" },
+	{ "\x26\x02\x94\xe5\x44\x33\x22\x11", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "es add dl,BYTE PTR [rbp+riz*8+0x11223344]" },
+	{ "\xf0\xf0\x02\x1c\x25\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock lock add bl,BYTE PTR ds:0xfffffffffffffff0" },
+	{ "\xf3\x66\x02\x34\x20", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz data16 add dh,BYTE PTR [rax+riz*1]" },
+	{ "\xf3\x42\x02\x04\x25\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz add al,BYTE PTR [r12*1-0x10]" },
+	{ "\x65\x4c\x02\x3c\xa0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WR add r15b,BYTE PTR gs:[rax+riz*4]" },
+	{ "\x03\x04\x20", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "add eax,DWORD PTR [rax+riz*1]" },
+	{ "\x03\x3c\xa0", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "add edi,DWORD PTR [rax+riz*4]" },
+	{ "\x03\xb1\x00\x10\x00\x00", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "add esi,DWORD PTR [rcx+0x1000]" },
+	{ "\x03\x3d\x10\x00\x00\x00", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "add edi,DWORD PTR [rip+0x10] # 0xa036" },
+	{ "\xf3\x03\x00", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz add eax,DWORD PTR [rax]" },
+	{ "\xf0\xf0\x03\x1c\x65\x00\x10\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock lock add ebx,DWORD PTR [riz*2+0x1000]" },
+	{ "\xf3\x66\x03\x23", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz add sp,WORD PTR [rbx]" },
+	{ "\x66\xf2\x03\x3b", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz add di,WORD PTR [rbx]" },
+	{ "\x64\x44\x03\x9c\xe5\x44\x33\x22\x11", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "add r11d,DWORD PTR fs:[rbp+riz*8+0x11223344]" },
+	{ "\x67\x48\x03\x33", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "add rsi,QWORD PTR [ebx]" },
+	{ "\x0a\x24\x20", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "or ah,BYTE PTR [rax+riz*1]" },
+	{ "\x0a\x14\x24", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "or dl,BYTE PTR [rsp]" },
+	{ "\x0a\x2c\x1d\x40\x00\x00\x00", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "or ch,BYTE PTR [rbx*1+0x40]" },
+	{ "\x0a\x24\xa0", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "or ah,BYTE PTR [rax+riz*4]" },
+	{ "\x64\x65\x0a\x33", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "fs or dh,BYTE PTR gs:[rbx]" },
+	{ "\x66\x0a\x24\x24", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 or ah,BYTE PTR [rsp]" },
+	{ "\xf3\x0a\x5c\x24\x10", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz or bl,BYTE PTR [rsp+0x10]" },
+	{ "\x36\x0a\x6c\x24\x10", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ss or ch,BYTE PTR [rsp+0x10]" },
+	{ "\x64\x40\x0a\xb1\x00\x10\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "or sil,BYTE PTR fs:[rcx+0x1000]" },
+	{ "\xf3\x44\x0a\x1c\x25\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz or r11b,BYTE PTR ds:0xfffffffffffffff0" },
+	{ "\x10\x74\x24\x10", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "adc BYTE PTR [rsp+0x10],dh" },
+	{ "\x10\x34\x25\xf0\xff\xff\xff", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "adc BYTE PTR ds:0xfffffffffffffff0,dh" },
+	{ "\x10\x85\x00\x00\x00\x80", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "adc BYTE PTR [rbp-0x80000000],al" },
+	{ "\x10\x9c\xe5\x44\x33\x22\x11", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "adc BYTE PTR [rbp+riz*8+0x11223344],bl" },
+	{ "\x3e\x10\x78\x7f", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ds adc BYTE PTR [rax+0x7f],bh" },
+	{ "\x2e\x10\x05\x10\x00\x00\x00", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs adc BYTE PTR [rip+0x10],al # 0xa2f7" },
+	{ "\x65\x10\xa9\x00\x10\x00\x00", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "adc BYTE PTR gs:[rcx+0x1000],ch" },
+	{ "\xf0\x65\x67\x10\x14\x1d\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock adc BYTE PTR gs:[ebx*1+0x40],dl" },
+	{ "\x66\x4c\x10\x34\x24", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 rex.WR adc BYTE PTR [rsp],r14b" },
+	{ "\x64\x48\x10\x23", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W adc BYTE PTR fs:[rbx],spl" },
+	{ "\x11\x3c\x1d\x40\x00\x00\x00", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "adc DWORD PTR [rbx*1+0x40],edi" },
+	{ "\x11\x6c\x5d\xf8", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "adc DWORD PTR [rbp+rbx*2-0x8],ebp" },
+	{ "\x11\xbc\xe5\x44\x33\x22\x11", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "adc DWORD PTR [rbp+riz*8+0x11223344],edi" },
+	{ "\x11\x68\x7f", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "adc DWORD PTR [rax+0x7f],ebp" },
+	{ "\xf3\x11\x04\x25\xf0\xff\xff\xff", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz adc DWORD PTR ds:0xfffffffffffffff0,eax" },
+	{ "\xf0\x11\x10", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock adc DWORD PTR [rax],edx" },
+	{ "\xf2\xf3\x11\x3c\x25\x78\x56\x34\x12", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz repz adc DWORD PTR ds:0x12345678,edi" },
+	{ "\x26\x11\x1c\x24", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "es adc DWORD PTR [rsp],ebx" },
+	{ "\x64\x41\x11\x14\x20", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "adc DWORD PTR fs:[r8+riz*1],edx" },
+	{ "\xf3\x44\x11\x49\x80", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz adc DWORD PTR [rcx-0x80],r9d" },
+	{ "\x18\x14\x25\x78\x56\x34\x12", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "sbb BYTE PTR ds:0x12345678,dl" },
+	{ "\x18\x35\xf0\xff\xff\xff", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "sbb BYTE PTR [rip+0xfffffffffffffff0],dh # 0xa4d6" },
+	{ "\x18\x0f", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "sbb BYTE PTR [rdi],cl" },
+	{ "\x18\xd7", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "sbb bh,dl" },
+	{ "\xf0\xf0\x18\xb1\x00\x10\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock lock sbb BYTE PTR [rcx+0x1000],dh" },
+	{ "\xf0\x18\xa5\x00\x00\x00\x80", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock sbb BYTE PTR [rbp-0x80000000],ah" },
+	{ "\xf0\x66\x18\x0b", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock data16 sbb BYTE PTR [rbx],cl" },
+	{ "\x3e\x18\xa1\x00\x10\x00\x00", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ds sbb BYTE PTR [rcx+0x1000],ah" },
+	{ "\xf3\x42\x18\x59\x80", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz rex.X sbb BYTE PTR [rcx-0x80],bl" },
+	{ "\x44\x18\x9c\xe5\x44\x33\x22\x11", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "sbb BYTE PTR [rbp+riz*8+0x11223344],r11b" },
+	{ "\x22\x84\xe5\x44\x33\x22\x11", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "and al,BYTE PTR [rbp+riz*8+0x11223344]" },
+	{ "\x22\x4c\x24\x10", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "and cl,BYTE PTR [rsp+0x10]" },
+	{ "\x22\x25\x10\x00\x00\x00", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "and ah,BYTE PTR [rip+0x10] # 0xa656" },
+	{ "\x22\xbd\x00\x00\x00\x80", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "and bh,BYTE PTR [rbp-0x80000000]" },
+	{ "\xf3\x22\x48\x7f", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz and cl,BYTE PTR [rax+0x7f]" },
+	{ "\xf0\x65\x67\x22\x6d\x08", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock and ch,BYTE PTR gs:[ebp+0x8]" },
+	{ "\xf0\x22\x35\x10\x00\x00\x00", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock and dh,BYTE PTR [rip+0x10] # 0xa6d7" },
+	{ "\x22\x78\x7f", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "and bh,BYTE PTR [rax+0x7f]" },
+	{ "\x64\x44\x22\x04\x65\x00\x10\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "and r8b,BYTE PTR fs:[riz*2+0x1000]" },
+	{ "\x4f\x22\x2d\x10\x00\x00\x00", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WRXB and r13b,BYTE PTR [rip+0x10] # 0xa737" },
+	{ "\x2a\x14\x25\xf0\xff\xff\xff", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "sub dl,BYTE PTR ds:0xfffffffffffffff0" },
+	{ "\x2a\x54\x5d\xf8", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "sub dl,BYTE PTR [rbp+rbx*2-0x8]" },
+	{ "\x2a\xdf", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "sub bl,bh" },
+	{ "\x2a\x0c\x98", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "sub cl,BYTE PTR [rax+rbx*4]" },
+	{ "\xf0\x66\x2a\x10", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock data16 sub dl,BYTE PTR [rax]" },
+	{ "\x64\x65\x2a\xa9\x00\x10\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "fs sub ch,BYTE PTR gs:[rcx+0x1000]" },
+	{ "\xf2\x2a\x54\x5d\xf8", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz sub dl,BYTE PTR [rbp+rbx*2-0x8]" },
+	{ "\xf3\xf2\x2a\x1c\x24", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz repnz sub bl,BYTE PTR [rsp]" },
+	{ "\x65\x40\x2a\x2b", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "sub bpl,BYTE PTR gs:[rbx]" },
+	{ "\xf3\x48\x2a\xa9\x00\x10\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz rex.W sub bpl,BYTE PTR [rcx+0x1000]" },
+	{ "\x32\x26", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "xor ah,BYTE PTR [rsi]" },
+	{ "\x32\xa5\x00\x00\x00\x80", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "xor ah,BYTE PTR [rbp-0x80000000]" },
+	{ "\x32\x44\x24\x10", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "xor al,BYTE PTR [rsp+0x10]" },
+	{ "\x32\x0d\xf0\xff\xff\xff", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "xor cl,BYTE PTR [rip+0xfffffffffffffff0] # 0xa8d6" },
+	{ "\xf0\x32\x25\x10\x00\x00\x00", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock xor ah,BYTE PTR [rip+0x10] # 0xa917" },
+	{ "\x65\x32\x65\x08", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "xor ah,BYTE PTR gs:[rbp+0x8]" },
+	{ "\x65\x2e\x32\x0d\x10\x00\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "gs xor cl,BYTE PTR gs:[rip+0x10] # 0xa958" },
+	{ "\x3e\x32\x1b", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ds xor bl,BYTE PTR [rbx]" },
+	{ "\x44\x32\x04\x25\x78\x56\x34\x12", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "xor r8b,BYTE PTR ds:0x12345678" },
+	{ "\xf3\x40\x32\x0d\x10\x00\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz rex xor cl,BYTE PTR [rip+0x10] # 0xa9b8" },
+	{ "\x38\x1c\x65\x00\x10\x00\x00", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmp BYTE PTR [riz*2+0x1000],bl" },
+	{ "\x38\x64\x24\x10", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmp BYTE PTR [rsp+0x10],ah" },
+	{ "\x38\x27", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmp BYTE PTR [rdi],ah" },
+	{ "\x38\xc0", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmp al,al" },
+	{ "\x65\x2e\x38\x3f", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "gs cmp BYTE PTR gs:[rdi],bh" },
+	{ "\x64\x38\x54\x5d\xf8", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmp BYTE PTR fs:[rbp+rbx*2-0x8],dl" },
+	{ "\x64\x65\x38\x85\x00\x00\x00\x80", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "fs cmp BYTE PTR gs:[rbp-0x80000000],al" },
+	{ "\xf0\x38\x89\x00\x10\x00\x00", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock cmp BYTE PTR [rcx+0x1000],cl" },
+	{ "\x4f\x38\x27", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WRXB cmp BYTE PTR [r15],r12b" },
+	{ "\x66\x4c\x38\x75\x08", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 rex.WR cmp BYTE PTR [rbp+0x8],r14b" },
+	{ "\x39\x64\x24\x10", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmp DWORD PTR [rsp+0x10],esp" },
+	{ "\x39\x4d\x08", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmp DWORD PTR [rbp+0x8],ecx" },
+	{ "\x39\x0c\x65\x00\x10\x00\x00", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmp DWORD PTR [riz*2+0x1000],ecx" },
+	{ "\x39\x81\x00\x10\x00\x00", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmp DWORD PTR [rcx+0x1000],eax" },
+	{ "\x66\x67\x39\x2c\xcd\x40\x00\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmp WORD PTR [ecx*8+0x40],bp" },
+	{ "\xf0\x65\x67\x39\x2c\x25\x78\x56\x34\x12", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock cmp DWORD PTR gs:[eiz*1+0x12345678],ebp" },
+	{ "\x64\x39\x0c\x1d\x40\x00\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmp DWORD PTR fs:[rbx*1+0x40],ecx" },
+	{ "\x66\x66\x39\x4d\x08", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 cmp WORD PTR [rbp+0x8],cx" },
+	{ "\x65\x44\x39\x04\x1d\x40\x00\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmp DWORD PTR gs:[rbx*1+0x40],r8d" },
+	{ "\x65\x40\x39\x59\x80", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex cmp DWORD PTR gs:[rcx-0x80],ebx" },
+	{ "\x84\x74\x24\x10", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "test BYTE PTR [rsp+0x10],dh" },
+	{ "\x84\x64\x5d\xf8", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "test BYTE PTR [rbp+rbx*2-0x8],ah" },
+	{ "\x84\x3c\x1d\x40\x00\x00\x00", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "test BYTE PTR [rbx*1+0x40],bh" },
+	{ "\x84\x3d\x10\x00\x00\x00", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "test BYTE PTR [rip+0x10],bh # 0xacb6" },
+	{ "\x66\x84\x0f", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 test BYTE PTR [rdi],cl" },
+	{ "\x3e\x84\x3c\x25\xf0\xff\xff\xff", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ds test BYTE PTR ds:0xfffffffffffffff0,bh" },
+	{ "\x65\x2e\x84\x33", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "gs test BYTE PTR gs:[rbx],dh" },
+	{ "\x66\x66\x84\x24\xa0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 data16 test BYTE PTR [rax+riz*4],ah" },
+	{ "\x67\x44\x84\x16", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "test BYTE PTR [esi],r10b" },
+	{ "\x64\x40\x84\x2c\x1d\x40\x00\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "test BYTE PTR fs:[rbx*1+0x40],bpl" },
+	{ "\x85\x0b", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "test DWORD PTR [rbx],ecx" },
+	{ "\x85\x04\x98", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "test DWORD PTR [rax+rbx*4],eax" },
+	{ "\x85\x3c\x25\xf0\xff\xff\xff", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "test DWORD PTR ds:0xfffffffffffffff0,edi" },
+	{ "\x85\x0c\x20", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "test DWORD PTR [rax+riz*1],ecx" },
+	{ "\x66\x85\x04\x25\xf0\xff\xff\xff", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "test WORD PTR ds:0xfffffffffffffff0,ax" },
+	{ "\xf2\x85\x64\x5d\xf8", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz test DWORD PTR [rbp+rbx*2-0x8],esp" },
+	{ "\x3e\x85\x14\x24", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ds test DWORD PTR [rsp],edx" },
+	{ "\xf3\x66\x85\x5c\x5d\xf8", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz test WORD PTR [rbp+rbx*2-0x8],bx" },
+	{ "\xf0\x41\x85\x99\x00\x10\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock test DWORD PTR [r9+0x1000],ebx" },
+	{ "\x67\x4c\x85\x10", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "test QWORD PTR [eax],r10" },
+	{ "\x8a\x14\x20", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov dl,BYTE PTR [rax+riz*1]" },
+	{ "\x8a\x04\x98", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov al,BYTE PTR [rax+rbx*4]" },
+	{ "\x8a\x36", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov dh,BYTE PTR [rsi]" },
+	{ "\x8a\x24\x1d\x40\x00\x00\x00", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov ah,BYTE PTR [rbx*1+0x40]" },
+	{ "\x36\x8a\x1c\x1d\x40\x00\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ss mov bl,BYTE PTR [rbx*1+0x40]" },
+	{ "\x2e\x8a\x3c\xa0", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs mov bh,BYTE PTR [rax+riz*4]" },
+	{ "\x26\x8a\x04\x65\x00\x10\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "es mov al,BYTE PTR [riz*2+0x1000]" },
+	{ "\x2e\x64\x8a\x1d\xf0\xff\xff\xff", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs mov bl,BYTE PTR fs:[rip+0xfffffffffffffff0] # 0xaf98" },
+	{ "\x65\x41\x8a\x44\x24\x10", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov al,BYTE PTR gs:[r12+0x10]" },
+	{ "\x67\x44\x8a\x54\x24\x10", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov r10b,BYTE PTR [esp+0x10]" },
+	{ "\x8b\x2c\xcd\x40\x00\x00\x00", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov ebp,DWORD PTR [rcx*8+0x40]" },
+	{ "\x8b\x4d\x08", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov ecx,DWORD PTR [rbp+0x8]" },
+	{ "\x8b\x54\x24\x10", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov edx,DWORD PTR [rsp+0x10]" },
+	{ "\x8b\x2d\xf0\xff\xff\xff", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov ebp,DWORD PTR [rip+0xfffffffffffffff0] # 0xb056" },
+	{ "\x65\x8b\x16", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov edx,DWORD PTR gs:[rsi]" },
+	{ "\x8b\x0e", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov ecx,DWORD PTR [rsi]" },
+	{ "\xf0\xf0\x8b\x33", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock lock mov esi,DWORD PTR [rbx]" },
+	{ "\xf0\x65\x67\x8b\x81\x00\x10\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock mov eax,DWORD PTR gs:[ecx+0x1000]" },
+	{ "\x41\x8b\x36", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov esi,DWORD PTR [r14]" },
+	{ "\x66\x48\x8b\x04\x65\x00\x10\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 mov rax,QWORD PTR [riz*2+0x1000]" },
+	{ "\x8c\xd7", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov edi,ss" },
+	{ "\x8c\x0c\x1d\x40\x00\x00\x00", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov WORD PTR [rbx*1+0x40],cs" },
+	{ "\x8c\x61\x80", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov WORD PTR [rcx-0x80],fs" },
+	{ "\x8c\xe0", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov eax,fs" },
+	{ "\x66\xf2\x8c\x14\x24", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 repnz mov WORD PTR [rsp],ss" },
+	{ "\x66\x8c\x2d\xf0\xff\xff\xff", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 mov WORD PTR [rip+0xfffffffffffffff0],gs # 0xb1d7" },
+	{ "\xf2\x8c\x34\x98", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz mov WORD PTR [rax+rbx*4],?" },
+	{ "\x67\x8c\x2c\x25\x78\x56\x34\x12", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov WORD PTR [eiz*1+0x12345678],gs" },
+	{ "\x48\x8c\x0c\x24", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W mov WORD PTR [rsp],cs" },
+	{ "\xf0\x4c\x8c\xa5\x00\x00\x00\x80", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock rex.WR mov WORD PTR [rbp-0x80000000],fs" },
+	{ "\x8f\x84\xe5\x44\x33\x22\x11", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "pop QWORD PTR [rbp+riz*8+0x11223344]" },
+	{ "\x8f\x4c\x24\x10\x7f\x80\xff\x01", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x8f\x2d\x10\x00\x00\x00\xf0\xff\xff\xff", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x8f\x37\xf0\xff\xff\xff", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x66\x66\x8f\x16\xf0\xff\xff\xff", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 data16 (bad)" },
+	{ "\x26\x8f\x17\xf0\xff\xff\xff", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "es (bad)" },
+	{ "\xf0\xf0\x8f\x0c\x25\x78\x56\x34\x12\x34\x12\x00\x00", 13, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock lock (bad)" },
+	{ "\x8f\x5c\x24\x10\x7f\x80\xff\x01", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x67\x4f\x8f\x55\x08\x7f\x80\xff\x01", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "addr32 rex.WRXB (bad)" },
+	{ "\xf0\x4c\x8f\x37\x34\x12\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock rex.WR (bad)" },
+	{ "\xc0\x0b\x34", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ror BYTE PTR [rbx],0x34" },
+	{ "\xc0\xd7\xf0", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rcl bh,0xf0" },
+	{ "\xc0\x1c\x24\x34", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rcr BYTE PTR [rsp],0x34" },
+	{ "\xc0\x3c\x65\x00\x10\x00\x00\x7f", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "sar BYTE PTR [riz*2+0x1000],0x7f" },
+	{ "\x2e\xc0\x24\xcd\x40\x00\x00\x00\x7f", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs shl BYTE PTR [rcx*8+0x40],0x7f" },
+	{ "\x65\x2e\xc0\x15\x10\x00\x00\x00\x34", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "gs rcl BYTE PTR gs:[rip+0x10],0x34 # 0xb479" },
+	{ "\xf0\x65\x67\xc0\x74\x5d\xf8\x7f", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock shl BYTE PTR gs:[ebp+ebx*2-0x8],0x7f" },
+	{ "\xc0\x14\x24\xf0", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rcl BYTE PTR [rsp],0xf0" },
+	{ "\xf3\x41\xc0\x81\x00\x10\x00\x00\x7f", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz rol BYTE PTR [r9+0x1000],0x7f" },
+	{ "\x64\x42\xc0\x85\x00\x00\x00\x80\x7f", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.X rol BYTE PTR fs:[rbp-0x80000000],0x7f" },
+	{ "\xd1\x5d\x08", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rcr DWORD PTR [rbp+0x8],1" },
+	{ "\xd1\x1c\x65\x00\x10\x00\x00", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rcr DWORD PTR [riz*2+0x1000],1" },
+	{ "\xd1\x04\xa0", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rol DWORD PTR [rax+riz*4],1" },
+	{ "\xd1\x06", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rol DWORD PTR [rsi],1" },
+	{ "\x26\xd1\xb4\xe5\x44\x33\x22\x11", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "es shl DWORD PTR [rbp+riz*8+0x11223344],1" },
+	{ "\xf0\xd1\x0c\xcd\x40\x00\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock ror DWORD PTR [rcx*8+0x40],1" },
+	{ "\x2e\x64\xd1\x34\x20", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs shl DWORD PTR fs:[rax+riz*1],1" },
+	{ "\xf0\xf0\xd1\x1f", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock lock rcr DWORD PTR [rdi],1" },
+	{ "\x65\x4f\xd1\x2c\x25\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WRXB shr QWORD PTR gs:[r12*1-0x10],1" },
+	{ "\x65\x42\xd1\x15\x10\x00\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.X rcl DWORD PTR gs:[rip+0x10],1 # 0xb638" },
+	{ "\xf6\x3d\xf0\xff\xff\xff", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "idiv BYTE PTR [rip+0xfffffffffffffff0] # 0xb636" },
+	{ "\xf6\xbc\xe5\x44\x33\x22\x11", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "idiv BYTE PTR [rbp+riz*8+0x11223344]" },
+	{ "\xf6\x04\x24\x34", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "test BYTE PTR [rsp],0x34" },
+	{ "\xf6\x89\x00\x10\x00\x00\xf0", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "test BYTE PTR [rcx+0x1000],0xf0" },
+	{ "\xf0\xf0\xf6\x95\x00\x00\x00\x80", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock lock not BYTE PTR [rbp-0x80000000]" },
+	{ "\x26\xf6\x2c\x65\x00\x10\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "es imul BYTE PTR [riz*2+0x1000]" },
+	{ "\x65\xf6\x04\x25\x78\x56\x34\x12\x7f", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "test BYTE PTR gs:0x12345678,0x7f" },
+	{ "\xf6\x23", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mul BYTE PTR [rbx]" },
+	{ "\xf3\x4f\xf6\x6d\x08", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz rex.WRXB imul BYTE PTR [r13+0x8]" },
+	{ "\xf2\x44\xf6\x2c\x98", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz rex.R imul BYTE PTR [rax+rbx*4]" },
+	{ "\xf7\x74\x5d\xf8", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "div DWORD PTR [rbp+rbx*2-0x8]" },
+	{ "\xf7\x2c\x25\x78\x56\x34\x12", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "imul DWORD PTR ds:0x12345678" },
+	{ "\xf7\xd7", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "not edi" },
+	{ "\xf7\x2c\xa0", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "imul DWORD PTR [rax+riz*4]" },
+	{ "\xf7\x9d\x00\x00\x00\x80", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "neg DWORD PTR [rbp-0x80000000]" },
+	{ "\x65\x2e\xf7\x03\xf0\xff\xff\xff", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "gs test DWORD PTR gs:[rbx],0xfffffff0" },
+	{ "\xf2\xf7\x04\x65\x00\x10\x00\x00\x34\x12\x00\x00", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz test DWORD PTR [riz*2+0x1000],0x1234" },
+	{ "\xf0\xf7\x23", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock mul DWORD PTR [rbx]" },
+	{ "\xf0\x42\xf7\x04\xa0\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock test DWORD PTR [rax+r12*4],0xfffffff0" },
+	{ "\xf3\x40\xf7\x20", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz rex mul DWORD PTR [rax]" },
+	{ "\xfe\x6c\x5d\xf8\x7f\x80\xff\x01", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xfe\xb1\x00\x10\x00\x00\x7f\x80\xff\x01", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xfe\x07", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "inc BYTE PTR [rdi]" },
+	{ "\xfe\x3c\xa0\x7f\x80\xff\x01", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x66\x67\xfe\x74\x5d\xf8\x7f\x80\xff\x01", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 addr32 (bad)" },
+	{ "\x66\xfe\x8d\x00\x00\x00\x80", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 dec BYTE PTR [rbp-0x80000000]" },
+	{ "\xf2\xfe\x28\x34\x12\x00\x00", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz (bad)" },
+	{ "\xf0\xf0\xfe\x54\x24\x10\xf0\xff\xff\xff", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock lock (bad)" },
+	{ "\x4c\xfe\x41\x80", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WR inc BYTE PTR [rcx-0x80]" },
+	{ "\x67\x42\xfe\x9d\x00\x00\x00\x80\x7f\x80\xff\x01", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "addr32 rex.X (bad)" },
+	{ "\xff\xa9\x00\x10\x00\x00", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "jmp FWORD PTR [rcx+0x1000]" },
+	{ "\xff\x1c\x98", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "call FWORD PTR [rax+rbx*4]" },
+	{ "\xff\x54\x24\x10", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "call QWORD PTR [rsp+0x10]" },
+	{ "\xff\x20", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "jmp QWORD PTR [rax]" },
+	{ "\xf0\x66\xff\x35\x10\x00\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock push WORD PTR [rip+0x10] # 0xba98" },
+	{ "\xf3\xff\x3c\xcd\x40\x00\x00\x00\x7f\x80\xff\x01", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz (bad)" },
+	{ "\x36\xff\x2e", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ss jmp FWORD PTR [rsi]" },
+	{ "\x2e\xff\x16", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs call QWORD PTR [rsi]" },
+	{ "\x67\x44\xff\x8c\xe5\x44\x33\x22\x11", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.R dec DWORD PTR [ebp+eiz*8+0x11223344]" },
+	{ "\x67\x4f\xff\x24\xcd\x40\x00\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WRXB jmp QWORD PTR [r9d*8+0x40]" },
+	{ "\x0f\x10\x24\x1d\x40\x00\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movups xmm4,XMMWORD PTR [rbx*1+0x40]" },
+	{ "\x0f\x10\x74\x5d\xf8", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movups xmm6,XMMWORD PTR [rbp+rbx*2-0x8]" },
+	{ "\x0f\x10\xd8", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movups xmm3,xmm0" },
+	{ "\x0f\x10\x34\x98", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movups xmm6,XMMWORD PTR [rax+rbx*4]" },
+	{ "\x26\x0f\x10\x48\x7f", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "es movups xmm1,XMMWORD PTR [rax+0x7f]" },
+	{ "\xf0\x0f\x10\xac\xe5\x44\x33\x22\x11", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock movups xmm5,XMMWORD PTR [rbp+riz*8+0x11223344]" },
+	{ "\xf0\x65\x67\x0f\x10\x14\x1d\x40\x00\x00\x00", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock movups xmm2,XMMWORD PTR gs:[ebx*1+0x40]" },
+	{ "\x2e\x64\x0f\x10\x50\x7f", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs movups xmm2,XMMWORD PTR fs:[rax+0x7f]" },
+	{ "\x42\x0f\x10\x08", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.X movups xmm1,XMMWORD PTR [rax]" },
+	{ "\x66\x4f\x0f\x10\x5c\x24\x10", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WRXB movupd xmm11,XMMWORD PTR [r12+r12*1+0x10]" },
+	{ "\x0f\x13\x41\x80", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movlps QWORD PTR [rcx-0x80],xmm0" },
+	{ "\x0f\x13\x16", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movlps QWORD PTR [rsi],xmm2" },
+	{ "\x0f\x13\x1d\x10\x00\x00\x00", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movlps QWORD PTR [rip+0x10],xmm3 # 0xbcd7" },
+	{ "\x0f\x13\xa5\x00\x00\x00\x80", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movlps QWORD PTR [rbp-0x80000000],xmm4" },
+	{ "\x67\x0f\x13\x34\x65\x00\x10\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movlps QWORD PTR [eiz*2+0x1000],xmm6" },
+	{ "\xf3\x66\x0f\x13\xac\xe5\x44\x33\x22\x11\xf0\xff\xff\xff", 14, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x66\xf2\x0f\x13\x26\x34\x12\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xf3\x0f\x13\x70\x7f\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x64\x40\x0f\x13\x14\x98", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex movlps QWORD PTR fs:[rax+rbx*4],xmm2" },
+	{ "\x67\x42\x0f\x13\x4c\x24\x10", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movlps QWORD PTR [esp+r12d*1+0x10],xmm1" },
+	{ "\x0f\x17\x34\x98", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movhps QWORD PTR [rax+rbx*4],xmm6" },
+	{ "\x0f\x17\x04\x25\x78\x56\x34\x12", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movhps QWORD PTR ds:0x12345678,xmm0" },
+	{ "\x0f\x17\x2d\xf0\xff\xff\xff", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movhps QWORD PTR [rip+0xfffffffffffffff0],xmm5 # 0xbdf7" },
+	{ "\x0f\x17\xac\xe5\x44\x33\x22\x11", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movhps QWORD PTR [rbp+riz*8+0x11223344],xmm5" },
+	{ "\x65\x2e\x0f\x17\x74\x24\x10", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "gs movhps QWORD PTR gs:[rsp+0x10],xmm6" },
+	{ "\x2e\x64\x0f\x17\x0c\x25\x78\x56\x34\x12", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs movhps QWORD PTR fs:0x12345678,xmm1" },
+	{ "\x66\x0f\x17\x34\x20", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movhpd QWORD PTR [rax+riz*1],xmm6" },
+	{ "\xf0\x66\x0f\x17\x07", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock movhpd QWORD PTR [rdi],xmm0" },
+	{ "\x67\x4c\x0f\x17\xb5\x00\x00\x00\x80", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WR movhps QWORD PTR [ebp-0x80000000],xmm14" },
+	{ "\x67\x41\x0f\x17\x0d\x10\x00\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movhps QWORD PTR [eip+0x10],xmm1 # 0xbef9" },
+	{ "\x0f\x28\x1d\x10\x00\x00\x00", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movaps xmm3,XMMWORD PTR [rip+0x10] # 0xbf17" },
+	{ "\x0f\x28\x68\x7f", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movaps xmm5,XMMWORD PTR [rax+0x7f]" },
+	{ "\x0f\x28\x1c\x98", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movaps xmm3,XMMWORD PTR [rax+rbx*4]" },
+	{ "\x0f\x28\x35\xf0\xff\xff\xff", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movaps xmm6,XMMWORD PTR [rip+0xfffffffffffffff0] # 0xbf57" },
+	{ "\xf0\x0f\x28\x34\x24", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock movaps xmm6,XMMWORD PTR [rsp]" },
+	{ "\xf3\x66\x0f\x28\x34\x20\xf0\xff\xff\xff", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x26\x0f\x28\x4c\x24\x10", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "es movaps xmm1,XMMWORD PTR [rsp+0x10]" },
+	{ "\xf0\x65\x67\x0f\x28\x44\x5d\xf8", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock movaps xmm0,XMMWORD PTR gs:[ebp+ebx*2-0x8]" },
+	{ "\x67\x4c\x0f\x28\x41\x80", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WR movaps xmm8,XMMWORD PTR [ecx-0x80]" },
+	{ "\x40\x0f\x28\x6c\x5d\xf8", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex movaps xmm5,XMMWORD PTR [rbp+rbx*2-0x8]" },
+	{ "\x0f\x6f\x0c\x20", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movq mm1,QWORD PTR [rax+riz*1]" },
+	{ "\x0f\x6f\x24\x1d\x40\x00\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movq mm4,QWORD PTR [rbx*1+0x40]" },
+	{ "\x0f\x6f\x48\x7f", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movq mm1,QWORD PTR [rax+0x7f]" },
+	{ "\x0f\x6f\x04\xa0", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movq mm0,QWORD PTR [rax+riz*4]" },
+	{ "\x65\x0f\x6f\x17", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movq mm2,QWORD PTR gs:[rdi]" },
+	{ "\x26\x0f\x6f\x3d\xf0\xff\xff\xff", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "es movq mm7,QWORD PTR [rip+0xfffffffffffffff0] # 0xc0d8" },
+	{ "\xf0\xf0\x0f\x6f\x34\x24", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock lock movq mm6,QWORD PTR [rsp]" },
+	{ "\x66\x0f\x6f\x65\x08", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movdqa xmm4,XMMWORD PTR [rbp+0x8]" },
+	{ "\x64\x42\x0f\x6f\x34\x25\x78\x56\x34\x12", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movq mm6,QWORD PTR fs:[r12*1+0x12345678]" },
+	{ "\x66\x44\x0f\x6f\x04\x25\xf0\xff\xff\xff", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movdqa xmm8,XMMWORD PTR ds:0xfffffffffffffff0" },
+	{ "\x0f\x90\xe8", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "seto al" },
+	{ "\x0f\x90\x25\xf0\xff\xff\xff", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "seto BYTE PTR [rip+0xfffffffffffffff0] # 0xc197" },
+	{ "\x0f\x90\x6c\x24\x10", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "seto BYTE PTR [rsp+0x10]" },
+	{ "\x0f\x90\x1c\x65\x00\x10\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "seto BYTE PTR [riz*2+0x1000]" },
+	{ "\x64\x0f\x90\x7c\x5d\xf8", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "seto BYTE PTR fs:[rbp+rbx*2-0x8]" },
+	{ "\x65\x0f\x90\x7c\x24\x10", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "seto BYTE PTR gs:[rsp+0x10]" },
+	{ "\x2e\x64\x0f\x90\x85\x00\x00\x00\x80", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs seto BYTE PTR fs:[rbp-0x80000000]" },
+	{ "\x3e\x0f\x90\x45\x08", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ds seto BYTE PTR [rbp+0x8]" },
+	{ "\x4c\x0f\x90\x3d\xf0\xff\xff\xff", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WR seto BYTE PTR [rip+0xfffffffffffffff0] # 0xc278" },
+	{ "\xf2\x48\x0f\x90\x2c\x25\xf0\xff\xff\xff", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz rex.W seto BYTE PTR ds:0xfffffffffffffff0" },
+	{ "\x0f\xab\x1c\x98", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "bts DWORD PTR [rax+rbx*4],ebx" },
+	{ "\x0f\xab\x49\x80", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "bts DWORD PTR [rcx-0x80],ecx" },
+	{ "\x0f\xab\x99\x00\x10\x00\x00", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "bts DWORD PTR [rcx+0x1000],ebx" },
+	{ "\x0f\xab\x1f", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "bts DWORD PTR [rdi],ebx" },
+	{ "\x0f\xab\x74\x5d\xf8", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "bts DWORD PTR [rbp+rbx*2-0x8],esi" },
+	{ "\xf0\x0f\xab\x59\x80", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock bts DWORD PTR [rcx-0x80],ebx" },
+	{ "\x66\xf2\x0f\xab\xb1\x00\x10\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz bts WORD PTR [rcx+0x1000],si" },
+	{ "\x36\x0f\xab\x74\x5d\xf8", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ss bts DWORD PTR [rbp+rbx*2-0x8],esi" },
+	{ "\xf0\x41\x0f\xab\x24\x25\x78\x56\x34\x12", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock bts DWORD PTR ds:0x12345678,esp" },
+	{ "\x65\x4f\x0f\xab\x1c\xcd\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "bts QWORD PTR gs:[r9*8+0x40],r11" },
+	{ "\x0f\xae\x2c\x65\x00\x10\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "xrstor [riz*2+0x1000]" },
+	{ "\x0f\xae\x51\x80", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ldmxcsr DWORD PTR [rcx-0x80]" },
+	{ "\x0f\xae\x05\xf0\xff\xff\xff", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "fxsave [rip+0xfffffffffffffff0] # 0xc437" },
+	{ "\x0f\xae\x33", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "xsaveopt [rbx]" },
+	{ "\xf0\x65\x67\x0f\xae\x04\x25\xf0\xff\xff\xff", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock fxsave gs:[eiz*1+0xfffffff0]" },
+	{ "\x26\x0f\xae\x2c\xcd\x40\x00\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "es xrstor [rcx*8+0x40]" },
+	{ "\x2e\x0f\xae\x23", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs xsave [rbx]" },
+	{ "\xf2\x0f\xae\x38\x34\x12\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x67\x42\x0f\xae\x0c\x65\x00\x10\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "fxrstor [r12d*2+0x1000]" },
+	{ "\xf3\x48\x0f\xae\x14\xcd\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz rex.W ldmxcsr DWORD PTR [rcx*8+0x40]" },
+	{ "\x0f\xb3\x24\x65\x00\x10\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "btr DWORD PTR [riz*2+0x1000],esp" },
+	{ "\x0f\xb3\x9d\x00\x00\x00\x80", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "btr DWORD PTR [rbp-0x80000000],ebx" },
+	{ "\x0f\xb3\x1c\x20", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "btr DWORD PTR [rax+riz*1],ebx" },
+	{ "\x0f\xb3\xf0", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "btr eax,esi" },
+	{ "\x64\x0f\xb3\xb1\x00\x10\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "btr DWORD PTR fs:[rcx+0x1000],esi" },
+	{ "\xf0\xf0\x0f\xb3\x24\x20", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock lock btr DWORD PTR [rax+riz*1],esp" },
+	{ "\x66\x67\x0f\xb3\x60\x7f", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "btr WORD PTR [eax+0x7f],sp" },
+	{ "\xf2\x0f\xb3\x24\x65\x00\x10\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz btr DWORD PTR [riz*2+0x1000],esp" },
+	{ "\xf3\x4f\x0f\xb3\x0b", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz rex.WRXB btr QWORD PTR [r11],r9" },
+	{ "\xf3\x42\x0f\xb3\x2d\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz rex.X btr DWORD PTR [rip+0xfffffffffffffff0],ebp # 0xc659" },
+	{ "\x0f\xc7\x05\x10\x00\x00\x00\xf0\xff\xff\xff", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x0f\xc7\x2d\xf0\xff\xff\xff", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "xsaves [rip+0xfffffffffffffff0] # 0xc697" },
+	{ "\x0f\xc7\x2e", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "xsaves [rsi]" },
+	{ "\x0f\xc7\x14\x24\x7f\x80\xff\x01", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xf0\xf0\x0f\xc7\x51\x80\x7f\x80\xff\x01", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock lock (bad)" },
+	{ "\x67\x0f\xc7\x0f", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmpxchg8b QWORD PTR [edi]" },
+	{ "\x66\x67\x0f\xc7\x41\x80\x7f\x80\xff\x01", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 addr32 (bad)" },
+	{ "\xf2\x0f\xc7\x0c\x24", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz cmpxchg8b QWORD PTR [rsp]" },
+	{ "\x64\x42\x0f\xc7\x36", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.X vmptrld QWORD PTR fs:[rsi]" },
+	{ "\x66\x41\x0f\xc7\x25\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 xsavec [rip+0xfffffffffffffff0] # 0xc799" },
+	{ "\x80\x04\x98\x7f", 4, 4, ShvEmulAdd, 1, 0x00, 0xff, 0x00, 0x03, 4, 0, 0x0, 0x7f, "add BYTE PTR [rax+rbx*4],0x7f" },
+	{ "\x66\x80\x41\x80\xf0", 5, 5, ShvEmulAdd, 1, 0x00, 0xff, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0xf0, "data16 add BYTE PTR [rcx-0x80],0xf0" },
+	{ "\x48\x80\x05\x10\x00\x00\x00\x34", 8, 8, ShvEmulAdd, 1, 0x04, 0xff, 0x10, 0xff, 0, 0, 0x10, 0x34, "rex.W add BYTE PTR [rip+0x10],0x34 # 0xc818" },
+	{ "\x66\x48\x80\x04\xcd\x40\x00\x00\x00\xf0", 10, 10, ShvEmulAdd, 1, 0x04, 0xff, 0xff, 0x01, 8, 0, 0x40, 0xf0, "data16 rex.W add BYTE PTR [rcx*8+0x40],0xf0" },
+	{ "\x80\x0c\x24\x7f", 4, 4, ShvEmulOr, 1, 0x00, 0xff, 0x04, 0xff, 0, 0, 0x0, 0x7f, "or BYTE PTR [rsp],0x7f" },
+	{ "\x66\x80\x0f\x34", 4, 4, ShvEmulOr, 1, 0x00, 0xff, 0x07, 0xff, 0, 0, 0x0, 0x34, "data16 or BYTE PTR [rdi],0x34" },
+	{ "\x48\x80\x0c\x1d\x40\x00\x00\x00\xf0", 9, 9, ShvEmulOr, 1, 0x04, 0xff, 0xff, 0x03, 1, 0, 0x40, 0xf0, "rex.W or BYTE PTR [rbx*1+0x40],0xf0" },
+	{ "\x66\x48\x80\x8c\xe5\x44\x33\x22\x11\x34", 10, 10, ShvEmulOr, 1, 0x04, 0xff, 0x05, 0xff, 0, 0, 0x11223344, 0x34, "data16 rex.W or BYTE PTR [rbp+riz*8+0x11223344],0x34" },
+	{ "\x80\x14\x98\x34", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "adc BYTE PTR [rax+rbx*4],0x34" },
+	{ "\x66\x80\x14\x20\x7f", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 adc BYTE PTR [rax+riz*1],0x7f" },
+	{ "\x48\x80\x50\x7f\x34", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W adc BYTE PTR [rax+0x7f],0x34" },
+	{ "\x66\x48\x80\x13\x34", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 rex.W adc BYTE PTR [rbx],0x34" },
+	{ "\x80\x1b\x7f", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "sbb BYTE PTR [rbx],0x7f" },
+	{ "\x66\x80\x1c\x25\xf0\xff\xff\xff\x34", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 sbb BYTE PTR ds:0xfffffffffffffff0,0x34" },
+	{ "\x48\x80\x59\x80\xf0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W sbb BYTE PTR [rcx-0x80],0xf0" },
+	{ "\x66\x48\x80\x99\x00\x10\x00\x00\x7f", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 rex.W sbb BYTE PTR [rcx+0x1000],0x7f" },
+	{ "\x80\x24\x20\xf0", 4, 4, ShvEmulAnd, 1, 0x00, 0xff, 0x00, 0xff, 0, 0, 0x0, 0xf0, "and BYTE PTR [rax+riz*1],0xf0" },
+	{ "\x66\x80\x25\x10\x00\x00\x00\xf0", 8, 8, ShvEmulAnd, 1, 0x00, 0xff, 0x10, 0xff, 0, 0, 0x10, 0xf0, "data16 and BYTE PTR [rip+0x10],0xf0 # 0xc9f8" },
+	{ "\x48\x80\xa5\x00\x00\x00\x80\xf0", 8, 8, ShvEmulAnd, 1, 0x04, 0xff, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0xf0, "rex.W and BYTE PTR [rbp-0x80000000],0xf0" },
+	{ "\x66\x48\x80\x64\x5d\xf8\x34", 7, 7, ShvEmulAnd, 1, 0x04, 0xff, 0x05, 0x03, 2, 0, 0xfffffffffffffff8, 0x34, "data16 rex.W and BYTE PTR [rbp+rbx*2-0x8],0x34" },
+	{ "\x80\x2c\x1d\x40\x00\x00\x00\x34", 8, 8, ShvEmulSub, 1, 0x00, 0xff, 0xff, 0x03, 1, 0, 0x40, 0x34, "sub BYTE PTR [rbx*1+0x40],0x34" },
+	{ "\x66\x80\x28\xf0", 4, 4, ShvEmulSub, 1, 0x00, 0xff, 0x00, 0xff, 0, 0, 0x0, 0xf0, "data16 sub BYTE PTR [rax],0xf0" },
+	{ "\x48\x80\xa9\x00\x10\x00\x00\x34", 8, 8, ShvEmulSub, 1, 0x04, 0xff, 0x01, 0xff, 0, 0, 0x1000, 0x34, "rex.W sub BYTE PTR [rcx+0x1000],0x34" },
+	{ "\x66\x48\x80\x69\x80\x34", 6, 6, ShvEmulSub, 1, 0x04, 0xff, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x34, "data16 rex.W sub BYTE PTR [rcx-0x80],0x34" },
+	{ "\x80\x36\xf0", 3, 3, ShvEmulXor, 1, 0x00, 0xff, 0x06, 0xff, 0, 0, 0x0, 0xf0, "xor BYTE PTR [rsi],0xf0" },
+	{ "\x66\x80\x36\xf0", 4, 4, ShvEmulXor, 1, 0x00, 0xff, 0x06, 0xff, 0, 0, 0x0, 0xf0, "data16 xor BYTE PTR [rsi],0xf0" },
+	{ "\x48\x80\x70\x7f\x7f", 5, 5, ShvEmulXor, 1, 0x04, 0xff, 0x00, 0xff, 0, 0, 0x7f, 0x7f, "rex.W xor BYTE PTR [rax+0x7f],0x7f" },
+	{ "\x66\x48\x80\x34\x20\x7f", 6, 6, ShvEmulXor, 1, 0x04, 0xff, 0x00, 0xff, 0, 0, 0x0, 0x7f, "data16 rex.W xor BYTE PTR [rax+riz*1],0x7f" },
+	{ "\x80\x3b\xf0", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmp BYTE PTR [rbx],0xf0" },
+	{ "\x66\x80\xb9\x00\x10\x00\x00\x7f", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 cmp BYTE PTR [rcx+0x1000],0x7f" },
+	{ "\x48\x80\x3c\x24\x34", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W cmp BYTE PTR [rsp],0x34" },
+	{ "\x66\x48\x80\x3d\x10\x00\x00\x00\x7f", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 rex.W cmp BYTE PTR [rip+0x10],0x7f # 0xcbb9" },
+	{ "\x81\x04\x25\x78\x56\x34\x12\xf0\xff\xff\xff", 11, 11, ShvEmulAdd, 4, 0x00, 0xff, 0xff, 0xff, 0, 0, 0x12345678, 0xfffffff0, "add DWORD PTR ds:0x12345678,0xfffffff0" },
+	{ "\x66\x81\x04\xcd\x40\x00\x00\x00\x34\x12", 10, 10, ShvEmulAdd, 2, 0x00, 0xff, 0xff, 0x01, 8, 0, 0x40, 0x1234, "add WORD PTR [rcx*8+0x40],0x1234" },
+	{ "\x48\x81\x04\x24\xf0\xff\xff\xff", 8, 8, ShvEmulAdd, 8, 0x04, 0xff, 0x04, 0xff, 0, 0, 0x0, 0xfffffffffffffff0, "add QWORD PTR [rsp],0xfffffffffffffff0" },
+	{ "\x66\x48\x81\x04\x25\x78\x56\x34\x12\x34\x12\x00\x00", 13, 13, ShvEmulAdd, 8, 0x04, 0xff, 0xff, 0xff, 0, 0, 0x12345678, 0x1234, "data16 add QWORD PTR ds:0x12345678,0x1234" },
+	{ "\x81\x0c\xcd\x40\x00\x00\x00\x34\x12\x00\x00", 11, 11, ShvEmulOr, 4, 0x00, 0xff, 0xff, 0x01, 8, 0, 0x40, 0x1234, "or DWORD PTR [rcx*8+0x40],0x1234" },
+	{ "\x66\x81\x4c\x5d\xf8\x7f\x80", 7, 7, ShvEmulOr, 2, 0x00, 0xff, 0x05, 0x03, 2, 0, 0xfffffffffffffff8, 0x807f, "or WORD PTR [rbp+rbx*2-0x8],0x807f" },
+	{ "\x48\x81\x4c\x24\x10\x34\x12\x00\x00", 9, 9, ShvEmulOr, 8, 0x04, 0xff, 0x04, 0xff, 0, 0, 0x10, 0x1234, "or QWORD PTR [rsp+0x10],0x1234" },
+	{ "\x66\x48\x81\x08\x34\x12\x00\x00", 8, 8, ShvEmulOr, 8, 0x04, 0xff, 0x00, 0xff, 0, 0, 0x0, 0x1234, "data16 or QWORD PTR [rax],0x1234" },
+	{ "\x66\x81\x14\xa0\x7f\x80", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "adc WORD PTR [rax+riz*4],0x807f" },
+	{ "\x48\x81\x14\xcd\x40\x00\x00\x00\x7f\x80\xff\x01", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "adc QWORD PTR [rcx*8+0x40],0x1ff807f" },
+	{ "\x66\x48\x81\x14\x24\x7f\x80\xff\x01", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 adc QWORD PTR [rsp],0x1ff807f" },
+	{ "\x81\x1c\x1d\x40\x00\x00\x00\x34\x12\x00\x00", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "sbb DWORD PTR [rbx*1+0x40],0x1234" },
+	{ "\x66\x81\x99\x00\x10\x00\x00\xf0\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "sbb WORD PTR [rcx+0x1000],0xfff0" },
+	{ "\x48\x81\x99\x00\x10\x00\x00\x7f\x80\xff\x01", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "sbb QWORD PTR [rcx+0x1000],0x1ff807f" },
+	{ "\x66\x48\x81\x1c\xcd\x40\x00\x00\x00\x7f\x80\xff\x01", 13, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 sbb QWORD PTR [rcx*8+0x40],0x1ff807f" },
+	{ "\x81\x60\x7f\x7f\x80\xff\x01", 7, 7, ShvEmulAnd, 4, 0x00, 0xff, 0x00, 0xff, 0, 0, 0x7f, 0x1ff807f, "and DWORD PTR [rax+0x7f],0x1ff807f" },
+	{ "\x66\x81\x25\x10\x00\x00\x00\x34\x12", 9, 9, ShvEmulAnd, 2, 0x00, 0xff, 0x10, 0xff, 0, 0, 0x10, 0x1234, "and WORD PTR [rip+0x10],0x1234 # 0xcdd9" },
+	{ "\x48\x81\x24\x25\x78\x56\x34\x12\x7f\x80\xff\x01", 12, 12, ShvEmulAnd, 8, 0x04, 0xff, 0xff, 0xff, 0, 0, 0x12345678, 0x1ff807f, "and QWORD PTR ds:0x12345678,0x1ff807f" },
+	{ "\x66\x48\x81\x26\x34\x12\x00\x00", 8, 8, ShvEmulAnd, 8, 0x04, 0xff, 0x06, 0xff, 0, 0, 0x0, 0x1234, "data16 and QWORD PTR [rsi],0x1234" },
+	{ "\x81\x2c\x65\x00\x10\x00\x00\x34\x12\x00\x00", 11, 11, ShvEmulSub, 4, 0x00, 0xff, 0xff, 0xff, 0, 0, 0x1000, 0x1234, "sub DWORD PTR [riz*2+0x1000],0x1234" },
+	{ "\x66\x81\x2e\x7f\x80", 5, 5, ShvEmulSub, 2, 0x00, 0xff, 0x06, 0xff, 0, 0, 0x0, 0x807f, "sub WORD PTR [rsi],0x807f" },
+	{ "\x48\x81\x2e\xf0\xff\xff\xff", 7, 7, ShvEmulSub, 8, 0x04, 0xff, 0x06, 0xff, 0, 0, 0x0, 0xfffffffffffffff0, "sub QWORD PTR [rsi],0xfffffffffffffff0" },
+	{ "\x66\x48\x81\x6d\x08\x7f\x80\xff\x01", 9, 9, ShvEmulSub, 8, 0x04, 0xff, 0x05, 0xff, 0, 0, 0x8, 0x1ff807f, "data16 sub QWORD PTR [rbp+0x8],0x1ff807f" },
+	{ "\x81\xb1\x00\x10\x00\x00\x34\x12\x00\x00", 10, 10, ShvEmulXor, 4, 0x00, 0xff, 0x01, 0xff, 0, 0, 0x1000, 0x1234, "xor DWORD PTR [rcx+0x1000],0x1234" },
+	{ "\x66\x81\x34\x24\x34\x12", 6, 6, ShvEmulXor, 2, 0x00, 0xff, 0x04, 0xff, 0, 0, 0x0, 0x1234, "xor WORD PTR [rsp],0x1234" },
+	{ "\x48\x81\x70\x7f\x7f\x80\xff\x01", 8, 8, ShvEmulXor, 8, 0x04, 0xff, 0x00, 0xff, 0, 0, 0x7f, 0x1ff807f, "xor QWORD PTR [rax+0x7f],0x1ff807f" },
+	{ "\x66\x48\x81\x34\xcd\x40\x00\x00\x00\xf0\xff\xff\xff", 13, 13, ShvEmulXor, 8, 0x04, 0xff, 0xff, 0x01, 8, 0, 0x40, 0xfffffffffffffff0, "data16 xor QWORD PTR [rcx*8+0x40],0xfffffffffffffff0" },
+	{ "\x81\x3d\x10\x00\x00\x00\xf0\xff\xff\xff", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmp DWORD PTR [rip+0x10],0xfffffff0 # 0xcf3a" },
+	{ "\x66\x81\x3d\x10\x00\x00\x00\x7f\x80", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmp WORD PTR [rip+0x10],0x807f # 0xcf59" },
+	{ "\x48\x81\x3c\x25\x78\x56\x34\x12\x34\x12\x00\x00", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmp QWORD PTR ds:0x12345678,0x1234" },
+	{ "\x66\x48\x81\x3c\x65\x00\x10\x00\x00\x34\x12\x00\x00", 13, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 cmp QWORD PTR [riz*2+0x1000],0x1234" },
+	{ "\x83\x85\x00\x00\x00\x80\xf0", 7, 7, ShvEmulAdd, 4, 0x00, 0xff, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0xfffffff0, "add DWORD PTR [rbp-0x80000000],0xfffffff0" },
+	{ "\x66\x83\x84\xe5\x44\x33\x22\x11\xf0", 9, 9, ShvEmulAdd, 2, 0x00, 0xff, 0x05, 0xff, 0, 0, 0x11223344, 0xfff0, "add WORD PTR [rbp+riz*8+0x11223344],0xfff0" },
+	{ "\x48\x83\x04\xa0\x34", 5, 5, ShvEmulAdd, 8, 0x04, 0xff, 0x00, 0xff, 0, 0, 0x0, 0x34, "add QWORD PTR [rax+riz*4],0x34" },
+	{ "\x66\x48\x83\x44\x24\x10\x34", 7, 7, ShvEmulAdd, 8, 0x04, 0xff, 0x04, 0xff, 0, 0, 0x10, 0x34, "data16 add QWORD PTR [rsp+0x10],0x34" },
+	{ "\x83\x0c\xa0\x7f", 4, 4, ShvEmulOr, 4, 0x00, 0xff, 0x00, 0xff, 0, 0, 0x0, 0x7f, "or DWORD PTR [rax+riz*4],0x7f" },
+	{ "\x66\x83\x0c\x65\x00\x10\x00\x00\x34", 9, 9, ShvEmulOr, 2, 0x00, 0xff, 0xff, 0xff, 0, 0, 0x1000, 0x34, "or WORD PTR [riz*2+0x1000],0x34" },
+	{ "\x48\x83\x48\x7f\x7f", 5, 5, ShvEmulOr, 8, 0x04, 0xff, 0x00, 0xff, 0, 0, 0x7f, 0x7f, "or QWORD PTR [rax+0x7f],0x7f" },
+	{ "\x66\x48\x83\x8c\xe5\x44\x33\x22\x11\x34", 10, 10, ShvEmulOr, 8, 0x04, 0xff, 0x05, 0xff, 0, 0, 0x11223344, 0x34, "data16 or QWORD PTR [rbp+riz*8+0x11223344],0x34" },
+	{ "\x83\x17\x7f", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "adc DWORD PTR [rdi],0x7f" },
+	{ "\x66\x83\x14\x24\x34", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "adc WORD PTR [rsp],0x34" },
+	{ "\x48\x83\x17\x34", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "adc QWORD PTR [rdi],0x34" },
+	{ "\x66\x48\x83\x13\x7f", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 adc QWORD PTR [rbx],0x7f" },
+	{ "\x83\x58\x7f\x7f", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "sbb DWORD PTR [rax+0x7f],0x7f" },
+	{ "\x66\x83\x1c\x24\x7f", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "sbb WORD PTR [rsp],0x7f" },
+	{ "\x48\x83\x1f\x34", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "sbb QWORD PTR [rdi],0x34" },
+	{ "\x66\x48\x83\x59\x80\x7f", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 sbb QWORD PTR [rcx-0x80],0x7f" },
+	{ "\x83\xa5\x00\x00\x00\x80\xf0", 7, 7, ShvEmulAnd, 4, 0x00, 0xff, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0xfffffff0, "and DWORD PTR [rbp-0x80000000],0xfffffff0" },
+	{ "\x66\x83\x25\x10\x00\x00\x00\xf0", 8, 8, ShvEmulAnd, 2, 0x00, 0xff, 0x10, 0xff, 0, 0, 0x10, 0xfff0, "and WORD PTR [rip+0x10],0xfff0 # 0xd1d8" },
+	{ "\x48\x83\x61\x80\xf0", 5, 5, ShvEmulAnd, 8, 0x04, 0xff, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0xfffffffffffffff0, "and QWORD PTR [rcx-0x80],0xfffffffffffffff0" },
+	{ "\x66\x48\x83\x20\xf0", 5, 5, ShvEmulAnd, 8, 0x04, 0xff, 0x00, 0xff, 0, 0, 0x0, 0xfffffffffffffff0, "data16 and QWORD PTR [rax],0xfffffffffffffff0" },
+	{ "\x83\x2c\x20\xf0", 4, 4, ShvEmulSub, 4, 0x00, 0xff, 0x00, 0xff, 0, 0, 0x0, 0xfffffff0, "sub DWORD PTR [rax+riz*1],0xfffffff0" },
+	{ "\x66\x83\x2e\x7f", 4, 4, ShvEmulSub, 2, 0x00, 0xff, 0x06, 0xff, 0, 0, 0x0, 0x7f, "sub WORD PTR [rsi],0x7f" },
+	{ "\x48\x83\x28\x34", 4, 4, ShvEmulSub, 8, 0x04, 0xff, 0x00, 0xff, 0, 0, 0x0, 0x34, "sub QWORD PTR [rax],0x34" },
+	{ "\x66\x48\x83\xad\x00\x00\x00\x80\x34", 9, 9, ShvEmulSub, 8, 0x04, 0xff, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x34, "data16 sub QWORD PTR [rbp-0x80000000],0x34" },
+	{ "\x83\x34\x1d\x40\x00\x00\x00\x34", 8, 8, ShvEmulXor, 4, 0x00, 0xff, 0xff, 0x03, 1, 0, 0x40, 0x34, "xor DWORD PTR [rbx*1+0x40],0x34" },
+	{ "\x66\x83\x34\xcd\x40\x00\x00\x00\x34", 9, 9, ShvEmulXor, 2, 0x00, 0xff, 0xff, 0x01, 8, 0, 0x40, 0x34, "xor WORD PTR [rcx*8+0x40],0x34" },
+	{ "\x48\x83\x33\x7f", 4, 4, ShvEmulXor, 8, 0x04, 0xff, 0x03, 0xff, 0, 0, 0x0, 0x7f, "xor QWORD PTR [rbx],0x7f" },
+	{ "\x66\x48\x83\x34\x98\x7f", 6, 6, ShvEmulXor, 8, 0x04, 0xff, 0x00, 0x03, 4, 0, 0x0, 0x7f, "data16 xor QWORD PTR [rax+rbx*4],0x7f" },
+	{ "\x83\x3b\xf0", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmp DWORD PTR [rbx],0xfffffff0" },
+	{ "\x66\x83\x3c\x65\x00\x10\x00\x00\x34", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmp WORD PTR [riz*2+0x1000],0x34" },
+	{ "\x48\x83\x3c\x65\x00\x10\x00\x00\x34", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmp QWORD PTR [riz*2+0x1000],0x34" },
+	{ "\x66\x48\x83\x7c\x5d\xf8\x7f", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 cmp QWORD PTR [rbp+rbx*2-0x8],0x7f" },
+	{ "\xc6\x05\xf0\xff\xff\xff\x7f", 7, 7, ShvEmulMovImmediate, 1, 0x00, 0xff, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x7f, "mov BYTE PTR [rip+0xfffffffffffffff0],0x7f # 0xd397" },
+	{ "\x66\xc6\x05\x10\x00\x00\x00\x34", 8, 8, ShvEmulMovImmediate, 1, 0x00, 0xff, 0x10, 0xff, 0, 0, 0x10, 0x34, "data16 mov BYTE PTR [rip+0x10],0x34 # 0xd3d8" },
+	{ "\x48\xc6\x04\xa0\x34", 5, 5, ShvEmulMovImmediate, 1, 0x04, 0xff, 0x00, 0xff, 0, 0, 0x0, 0x34, "rex.W mov BYTE PTR [rax+riz*4],0x34" },
+	{ "\x66\x48\xc6\x45\x08\xf0", 6, 6, ShvEmulMovImmediate, 1, 0x04, 0xff, 0x05, 0xff, 0, 0, 0x8, 0xf0, "data16 rex.W mov BYTE PTR [rbp+0x8],0xf0" },
+	{ "\xc6\x8d\x00\x00\x00\x80\x7f\x80\xff\x01", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x66\xc6\x0c\x1d\x40\x00\x00\x00\xf0\xff\xff\xff", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 (bad)" },
+	{ "\x48\xc6\x49\x80\x7f\x80\xff\x01", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W (bad)" },
+	{ "\x66\x48\xc6\x0c\x25\x78\x56\x34\x12\x7f\x80\xff\x01", 13, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 rex.W (bad)" },
+	{ "\xc6\x15\xf0\xff\xff\xff\xf0\xff\xff\xff", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x66\xc6\x91\x00\x10\x00\x00\xf0\xff\xff\xff", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 (bad)" },
+	{ "\x48\xc6\x54\x24\x10\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W (bad)" },
+	{ "\x66\x48\xc6\x55\x08\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 rex.W (bad)" },
+	{ "\x66\xc6\x1c\x24\xf0\xff\xff\xff", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 (bad)" },
+	{ "\x48\xc6\x1c\x98\xf0\xff\xff\xff", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W (bad)" },
+	{ "\x66\x48\xc6\x1c\x25\x78\x56\x34\x12\xf0\xff\xff\xff", 13, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 rex.W (bad)" },
+	{ "\xc6\x65\x08\x7f\x80\xff\x01", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x66\xc6\x24\x24\x7f\x80\xff\x01", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 (bad)" },
+	{ "\x48\xc6\x26\xf0\xff\xff\xff", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W (bad)" },
+	{ "\x66\x48\xc6\x24\x65\x00\x10\x00\x00\xf0\xff\xff\xff", 13, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 rex.W (bad)" },
+	{ "\xc6\x2c\x65\x00\x10\x00\x00\x34\x12\x00\x00", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x66\xc6\x2c\xcd\x40\x00\x00\x00\x7f\x80\xff\x01", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 (bad)" },
+	{ "\x48\xc6\xad\x00\x00\x00\x80\x34\x12\x00\x00", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W (bad)" },
+	{ "\x66\x48\xc6\x2b\xf0\xff\xff\xff", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 rex.W (bad)" },
+	{ "\xc6\x70\x7f\xf0\xff\xff\xff", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x66\xc6\x30\x7f\x80\xff\x01", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 (bad)" },
+	{ "\x48\xc6\x33\xf0\xff\xff\xff", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W (bad)" },
+	{ "\x66\x48\xc6\x34\x25\x78\x56\x34\x12\xf0\xff\xff\xff", 13, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 rex.W (bad)" },
+	{ "\xc6\x7c\x5d\xf8\x7f\x80\xff\x01", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x66\xc6\x3c\x98\xf0\xff\xff\xff", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 (bad)" },
+	{ "\x48\xc6\x3c\x1d\x40\x00\x00\x00\x7f\x80\xff\x01", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W (bad)" },
+	{ "\x66\x48\xc6\x3c\x1d\x40\x00\x00\x00\x7f\x80\xff\x01", 13, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 rex.W (bad)" },
+	{ "\x66\xc7\x04\x98\x34\x12", 6, 6, ShvEmulMovImmediate, 2, 0x00, 0xff, 0x00, 0x03, 4, 0, 0x0, 0x1234, "mov WORD PTR [rax+rbx*4],0x1234" },
+	{ "\x48\xc7\x04\x20\x34\x12\x00\x00", 8, 8, ShvEmulMovImmediate, 8, 0x04, 0xff, 0x00, 0xff, 0, 0, 0x0, 0x1234, "mov QWORD PTR [rax+riz*1],0x1234" },
+	{ "\x66\x48\xc7\x00\x7f\x80\xff\x01", 8, 8, ShvEmulMovImmediate, 8, 0x04, 0xff, 0x00, 0xff, 0, 0, 0x0, 0x1ff807f, "data16 mov QWORD PTR [rax],0x1ff807f" },
+	{ "\xc7\x0c\x65\x00\x10\x00\x00\x34\x12\x00\x00", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x66\xc7\x8d\x00\x00\x00\x80\x7f\x80\xff\x01", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 (bad)" },
+	{ "\x48\xc7\x49\x80\x34\x12\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W (bad)" },
+	{ "\x66\x48\xc7\x0c\x1d\x40\x00\x00\x00\xf0\xff\xff\xff", 13, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 rex.W (bad)" },
+	{ "\xc7\x14\xa0\x7f\x80\xff\x01", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x66\xc7\x14\x20\xf0\xff\xff\xff", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 (bad)" },
+	{ "\x48\xc7\x55\x08\xf0\xff\xff\xff", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W (bad)" },
+	{ "\x66\x48\xc7\x15\x10\x00\x00\x00\xf0\xff\xff\xff", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 rex.W (bad)" },
+	{ "\xc7\x9d\x00\x00\x00\x80\x7f\x80\xff\x01", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x66\xc7\x18\x7f\x80\xff\x01", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 (bad)" },
+	{ "\x48\xc7\x1d\x10\x00\x00\x00\x34\x12\x00\x00", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W (bad)" },
+	{ "\x66\x48\xc7\x1d\x10\x00\x00\x00\xf0\xff\xff\xff", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 rex.W (bad)" },
+	{ "\xc7\x64\x5d\xf8\xf0\xff\xff\xff", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x66\xc7\x24\x20\x34\x12\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 (bad)" },
+	{ "\x48\xc7\x24\x98\x7f\x80\xff\x01", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W (bad)" },
+	{ "\x66\x48\xc7\x26\x7f\x80\xff\x01", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 rex.W (bad)" },
+	{ "\xc7\x2c\xa0\x34\x12\x00\x00", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x66\xc7\x2c\x1d\x40\x00\x00\x00\x34\x12\x00\x00", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 (bad)" },
+	{ "\x48\xc7\x2b\x34\x12\x00\x00", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W (bad)" },
+	{ "\x66\x48\xc7\x2f\x34\x12\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 rex.W (bad)" },
+	{ "\xc7\xb4\xe5\x44\x33\x22\x11\x7f\x80\xff\x01", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x66\xc7\x34\x1d\x40\x00\x00\x00\x34\x12\x00\x00", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 (bad)" },
+	{ "\x48\xc7\x35\x10\x00\x00\x00\x34\x12\x00\x00", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W (bad)" },
+	{ "\x66\x48\xc7\x75\x08\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 rex.W (bad)" },
+	{ "\xc7\xbd\x00\x00\x00\x80\x34\x12\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x66\xc7\x3c\x25\x78\x56\x34\x12\x7f\x80\xff\x01", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 (bad)" },
+	{ "\x48\xc7\x7d\x08\x34\x12\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W (bad)" },
+	{ "\x66\x48\xc7\x3d\xf0\xff\xff\xff\x7f\x80\xff\x01", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 rex.W (bad)" },
+	{ "\x3e\xa0\x88\x77\x66\x55\x44\x33\x22\x11", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ds movabs al,ds:0x1122334455667788" },
+	{ "\x65\xa0\x88\x77\x66\x55\x44\x33\x22\x11", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movabs al,gs:0x1122334455667788" },
+	{ "\x64\x65\xa0\x88\x77\x66\x55\x44\x33\x22\x11", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "fs movabs al,gs:0x1122334455667788" },
+	{ "\xf0\xa0\x88\x77\x66\x55\x44\x33\x22\x11", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock movabs al,ds:0x1122334455667788" },
+	{ "\x67\xa0\x88\x77\x66\x55", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "addr32 mov al,ds:0x55667788" },
+	{ "\x36\xa0\x88\x77\x66\x55\x44\x33\x22\x11", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ss movabs al,ds:0x1122334455667788" },
+	{ "\xf3\x66\xa0\x88\x77\x66\x55\x44\x33\x22\x11", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz data16 movabs al,ds:0x1122334455667788" },
+	{ "\xf0\x66\xa0\x88\x77\x66\x55\x44\x33\x22\x11", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock data16 movabs al,ds:0x1122334455667788" },
+	{ "\xf3\xf2\xa0\x88\x77\x66\x55\x44\x33\x22\x11", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz repnz movabs al,ds:0x1122334455667788" },
+	{ "\x66\x66\xa0\x88\x77\x66\x55\x44\x33\x22\x11", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 data16 movabs al,ds:0x1122334455667788" },
+	{ "\x2e\xa0\x88\x77\x66\x55\x44\x33\x22\x11", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs movabs al,ds:0x1122334455667788" },
+	{ "\x2e\x64\xa0\x88\x77\x66\x55\x44\x33\x22\x11", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs movabs al,fs:0x1122334455667788" },
+	{ "\xf3\xf2\x48\xa0\x88\x77\x66\x55\x44\x33\x22\x11", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz repnz rex.W movabs al,ds:0x1122334455667788" },
+	{ "\xf3\xf2\x41\xa0\x88\x77\x66\x55\x44\x33\x22\x11", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz repnz rex.B movabs al,ds:0x1122334455667788" },
+	{ "\x3e\x48\xa0\x88\x77\x66\x55\x44\x33\x22\x11", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ds rex.W movabs al,ds:0x1122334455667788" },
+	{ "\x3e\x41\xa0\x88\x77\x66\x55\x44\x33\x22\x11", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ds rex.B movabs al,ds:0x1122334455667788" },
+	{ "\x48\xa0\x88\x77\x66\x55\x44\x33\x22\x11", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W movabs al,ds:0x1122334455667788" },
+	{ "\x41\xa0\x88\x77\x66\x55\x44\x33\x22\x11", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.B movabs al,ds:0x1122334455667788" },
+	{ "\x65\x48\xa0\x88\x77\x66\x55\x44\x33\x22\x11", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W movabs al,gs:0x1122334455667788" },
+	{ "\x65\x41\xa0\x88\x77\x66\x55\x44\x33\x22\x11", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.B movabs al,gs:0x1122334455667788" },
+	{ "\xf2\xa1\x88\x77\x66\x55\x44\x33\x22\x11", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz movabs eax,ds:0x1122334455667788" },
+	{ "\x26\xa1\x88\x77\x66\x55\x44\x33\x22\x11", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "es movabs eax,ds:0x1122334455667788" },
+	{ "\xf0\xf0\xa1\x88\x77\x66\x55\x44\x33\x22\x11", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock lock movabs eax,ds:0x1122334455667788" },
+	{ "\xf0\x66\xa1\x88\x77\x66\x55\x44\x33\x22\x11", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock movabs ax,ds:0x1122334455667788" },
+	{ "\xf3\xa1\x88\x77\x66\x55\x44\x33\x22\x11", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz movabs eax,ds:0x1122334455667788" },
+	{ "\x67\xa1\x88\x77\x66\x55", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "addr32 mov eax,ds:0x55667788" },
+	{ "\x66\xa1\x88\x77\x66\x55\x44\x33\x22\x11", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movabs ax,ds:0x1122334455667788" },
+	{ "\x65\xa1\x88\x77\x66\x55\x44\x33\x22\x11", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movabs eax,gs:0x1122334455667788" },
+	{ "\x2e\x64\xa1\x88\x77\x66\x55\x44\x33\x22\x11", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs movabs eax,fs:0x1122334455667788" },
+	{ "\x64\x65\xa1\x88\x77\x66\x55\x44\x33\x22\x11", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "fs movabs eax,gs:0x1122334455667788" },
+	{ "\x2e\xa1\x88\x77\x66\x55\x44\x33\x22\x11", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs movabs eax,ds:0x1122334455667788" },
+	{ "\x36\xa1\x88\x77\x66\x55\x44\x33\x22\x11", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ss movabs eax,ds:0x1122334455667788" },
+	{ "\x48\xa1\x88\x77\x66\x55\x44\x33\x22\x11", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movabs rax,ds:0x1122334455667788" },
+	{ "\x41\xa1\x88\x77\x66\x55\x44\x33\x22\x11", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.B movabs eax,ds:0x1122334455667788" },
+	{ "\xf3\xf2\x48\xa1\x88\x77\x66\x55\x44\x33\x22\x11", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz repnz movabs rax,ds:0x1122334455667788" },
+	{ "\xf3\xf2\x41\xa1\x88\x77\x66\x55\x44\x33\x22\x11", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz repnz rex.B movabs eax,ds:0x1122334455667788" },
+	{ "\x64\x65\x48\xa1\x88\x77\x66\x55\x44\x33\x22\x11", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "fs movabs rax,gs:0x1122334455667788" },
+	{ "\x64\x65\x41\xa1\x88\x77\x66\x55\x44\x33\x22\x11", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "fs rex.B movabs eax,gs:0x1122334455667788" },
+	{ "\x66\xf2\x48\xa1\x88\x77\x66\x55\x44\x33\x22\x11", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 repnz movabs rax,ds:0x1122334455667788" },
+	{ "\x66\xf2\x41\xa1\x88\x77\x66\x55\x44\x33\x22\x11", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz rex.B movabs ax,ds:0x1122334455667788" },
+	{ "\xf3\xa2\x88\x77\x66\x55\x44\x33\x22\x11", 10, 10, ShvEmulMov, 1, 0x00, 0x00, 0xff, 0xff, 0, 0, 0x1122334455667788, 0x0, "repz movabs ds:0x1122334455667788,al" },
+	{ "\x2e\x64\xa2\x88\x77\x66\x55\x44\x33\x22\x11", 11, 11, ShvEmulMov, 1, 0x00, 0x00, 0xff, 0xff, 0, 1, 0x1122334455667788, 0x0, "cs movabs fs:0x1122334455667788,al" },
+	{ "\xf0\x65\x67\xa2\x88\x77\x66\x55", 8, 8, ShvEmulMov, 1, 0x09, 0x00, 0xff, 0xff, 0, 2, 0x55667788, 0x0, "lock addr32 mov gs:0x55667788,al" },
+	{ "\x3e\xa2\x88\x77\x66\x55\x44\x33\x22\x11", 10, 10, ShvEmulMov, 1, 0x00, 0x00, 0xff, 0xff, 0, 0, 0x1122334455667788, 0x0, "ds movabs ds:0x1122334455667788,al" },
+	{ "\x36\xa2\x88\x77\x66\x55\x44\x33\x22\x11", 10, 10, ShvEmulMov, 1, 0x00, 0x00, 0xff, 0xff, 0, 0, 0x1122334455667788, 0x0, "ss movabs ds:0x1122334455667788,al" },
+	{ "\xf0\xf0\xa2\x88\x77\x66\x55\x44\x33\x22\x11", 11, 11, ShvEmulMov, 1, 0x01, 0x00, 0xff, 0xff, 0, 0, 0x1122334455667788, 0x0, "lock lock movabs ds:0x1122334455667788,al" },
+	{ "\x64\x65\xa2\x88\x77\x66\x55\x44\x33\x22\x11", 11, 11, ShvEmulMov, 1, 0x00, 0x00, 0xff, 0xff, 0, 2, 0x1122334455667788, 0x0, "fs movabs gs:0x1122334455667788,al" },
+	{ "\x66\xf2\xa2\x88\x77\x66\x55\x44\x33\x22\x11", 11, 11, ShvEmulMov, 1, 0x00, 0x00, 0xff, 0xff, 0, 0, 0x1122334455667788, 0x0, "data16 repnz movabs ds:0x1122334455667788,al" },
+	{ "\x65\xa2\x88\x77\x66\x55\x44\x33\x22\x11", 10, 10, ShvEmulMov, 1, 0x00, 0x00, 0xff, 0xff, 0, 2, 0x1122334455667788, 0x0, "movabs gs:0x1122334455667788,al" },
+	{ "\xf3\x66\xa2\x88\x77\x66\x55\x44\x33\x22\x11", 11, 11, ShvEmulMov, 1, 0x00, 0x00, 0xff, 0xff, 0, 0, 0x1122334455667788, 0x0, "repz data16 movabs ds:0x1122334455667788,al" },
+	{ "\x66\x66\xa2\x88\x77\x66\x55\x44\x33\x22\x11", 11, 11, ShvEmulMov, 1, 0x00, 0x00, 0xff, 0xff, 0, 0, 0x1122334455667788, 0x0, "data16 data16 movabs ds:0x1122334455667788,al" },
+	{ "\x64\xa2\x88\x77\x66\x55\x44\x33\x22\x11", 10, 10, ShvEmulMov, 1, 0x00, 0x00, 0xff, 0xff, 0, 1, 0x1122334455667788, 0x0, "movabs fs:0x1122334455667788,al" },
+	{ "\x65\x2e\x48\xa2\x88\x77\x66\x55\x44\x33\x22\x11", 12, 12, ShvEmulMov, 1, 0x04, 0x00, 0xff, 0xff, 0, 2, 0x1122334455667788, 0x0, "gs rex.W movabs gs:0x1122334455667788,al" },
+	{ "\x65\x2e\x41\xa2\x88\x77\x66\x55\x44\x33\x22\x11", 12, 12, ShvEmulMov, 1, 0x04, 0x00, 0xff, 0xff, 0, 2, 0x1122334455667788, 0x0, "gs rex.B movabs gs:0x1122334455667788,al" },
+	{ "\x64\x65\x48\xa2\x88\x77\x66\x55\x44\x33\x22\x11", 12, 12, ShvEmulMov, 1, 0x04, 0x00, 0xff, 0xff, 0, 2, 0x1122334455667788, 0x0, "fs rex.W movabs gs:0x1122334455667788,al" },
+	{ "\x64\x65\x41\xa2\x88\x77\x66\x55\x44\x33\x22\x11", 12, 12, ShvEmulMov, 1, 0x04, 0x00, 0xff, 0xff, 0, 2, 0x1122334455667788, 0x0, "fs rex.B movabs gs:0x1122334455667788,al" },
+	{ "\x66\x66\x48\xa2\x88\x77\x66\x55\x44\x33\x22\x11", 12, 12, ShvEmulMov, 1, 0x04, 0x00, 0xff, 0xff, 0, 0, 0x1122334455667788, 0x0, "data16 data16 rex.W movabs ds:0x1122334455667788,al" },
+	{ "\x66\x66\x41\xa2\x88\x77\x66\x55\x44\x33\x22\x11", 12, 12, ShvEmulMov, 1, 0x04, 0x00, 0xff, 0xff, 0, 0, 0x1122334455667788, 0x0, "data16 data16 rex.B movabs ds:0x1122334455667788,al" },
+	{ "\xf0\xf0\x48\xa2\x88\x77\x66\x55\x44\x33\x22\x11", 12, 12, ShvEmulMov, 1, 0x05, 0x00, 0xff, 0xff, 0, 0, 0x1122334455667788, 0x0, "lock lock rex.W movabs ds:0x1122334455667788,al" },
+	{ "\xf0\xf0\x41\xa2\x88\x77\x66\x55\x44\x33\x22\x11", 12, 12, ShvEmulMov, 1, 0x05, 0x00, 0xff, 0xff, 0, 0, 0x1122334455667788, 0x0, "lock lock rex.B movabs ds:0x1122334455667788,al" },
+	{ "\x2e\xa3\x88\x77\x66\x55\x44\x33\x22\x11", 10, 10, ShvEmulMov, 4, 0x00, 0x00, 0xff, 0xff, 0, 0, 0x1122334455667788, 0x0, "cs movabs ds:0x1122334455667788,eax" },
+	{ "\xf0\x65\x67\xa3\x88\x77\x66\x55", 8, 8, ShvEmulMov, 4, 0x09, 0x00, 0xff, 0xff, 0, 2, 0x55667788, 0x0, "lock addr32 mov gs:0x55667788,eax" },
+	{ "\xa3\x88\x77\x66\x55\x44\x33\x22\x11", 9, 9, ShvEmulMov, 4, 0x00, 0x00, 0xff, 0xff, 0, 0, 0x1122334455667788, 0x0, "movabs ds:0x1122334455667788,eax" },
+	{ "\xf3\xf2\xa3\x88\x77\x66\x55\x44\x33\x22\x11", 11, 11, ShvEmulMov, 4, 0x00, 0x00, 0xff, 0xff, 0, 0, 0x1122334455667788, 0x0, "repz repnz movabs ds:0x1122334455667788,eax" },
+	{ "\x66\x67\xa3\x88\x77\x66\x55", 7, 7, ShvEmulMov, 2, 0x08, 0x00, 0xff, 0xff, 0, 0, 0x55667788, 0x0, "addr32 mov ds:0x55667788,ax" },
+	{ "\x26\xa3\x88\x77\x66\x55\x44\x33\x22\x11", 10, 10, ShvEmulMov, 4, 0x00, 0x00, 0xff, 0xff, 0, 0, 0x1122334455667788, 0x0, "es movabs ds:0x1122334455667788,eax" },
+	{ "\x66\x66\xa3\x88\x77\x66\x55\x44\x33\x22\x11", 11, 11, ShvEmulMov, 2, 0x00, 0x00, 0xff, 0xff, 0, 0, 0x1122334455667788, 0x0, "data16 movabs ds:0x1122334455667788,ax" },
+	{ "\xf0\xa3\x88\x77\x66\x55\x44\x33\x22\x11", 10, 10, ShvEmulMov, 4, 0x01, 0x00, 0xff, 0xff, 0, 0, 0x1122334455667788, 0x0, "lock movabs ds:0x1122334455667788,eax" },
+	{ "\x3e\xa3\x88\x77\x66\x55\x44\x33\x22\x11", 10, 10, ShvEmulMov, 4, 0x00, 0x00, 0xff, 0xff, 0, 0, 0x1122334455667788, 0x0, "ds movabs ds:0x1122334455667788,eax" },
+	{ "\xf2\xa3\x88\x77\x66\x55\x44\x33\x22\x11", 10, 10, ShvEmulMov, 4, 0x00, 0x00, 0xff, 0xff, 0, 0, 0x1122334455667788, 0x0, "repnz movabs ds:0x1122334455667788,eax" },
+	{ "\xf0\x66\xa3\x88\x77\x66\x55\x44\x33\x22\x11", 11, 11, ShvEmulMov, 2, 0x01, 0x00, 0xff, 0xff, 0, 0, 0x1122334455667788, 0x0, "lock movabs ds:0x1122334455667788,ax" },
+	{ "\xf2\xf3\xa3\x88\x77\x66\x55\x44\x33\x22\x11", 11, 11, ShvEmulMov, 4, 0x00, 0x00, 0xff, 0xff, 0, 0, 0x1122334455667788, 0x0, "repnz repz movabs ds:0x1122334455667788,eax" },
+	{ "\xf0\x48\xa3\x88\x77\x66\x55\x44\x33\x22\x11", 11, 11, ShvEmulMov, 8, 0x05, 0x00, 0xff, 0xff, 0, 0, 0x1122334455667788, 0x0, "lock movabs ds:0x1122334455667788,rax" },
+	{ "\xf0\x41\xa3\x88\x77\x66\x55\x44\x33\x22\x11", 11, 11, ShvEmulMov, 4, 0x05, 0x00, 0xff, 0xff, 0, 0, 0x1122334455667788, 0x0, "lock rex.B movabs ds:0x1122334455667788,eax" },
+	{ "\x64\x48\xa3\x88\x77\x66\x55\x44\x33\x22\x11", 11, 11, ShvEmulMov, 8, 0x04, 0x00, 0xff, 0xff, 0, 1, 0x1122334455667788, 0x0, "movabs fs:0x1122334455667788,rax" },
+	{ "\x64\x41\xa3\x88\x77\x66\x55\x44\x33\x22\x11", 11, 11, ShvEmulMov, 4, 0x04, 0x00, 0xff, 0xff, 0, 1, 0x1122334455667788, 0x0, "rex.B movabs fs:0x1122334455667788,eax" },
+	{ "\x3e\x48\xa3\x88\x77\x66\x55\x44\x33\x22\x11", 11, 11, ShvEmulMov, 8, 0x04, 0x00, 0xff, 0xff, 0, 0, 0x1122334455667788, 0x0, "ds movabs ds:0x1122334455667788,rax" },
+	{ "\x3e\x41\xa3\x88\x77\x66\x55\x44\x33\x22\x11", 11, 11, ShvEmulMov, 4, 0x04, 0x00, 0xff, 0xff, 0, 0, 0x1122334455667788, 0x0, "ds rex.B movabs ds:0x1122334455667788,eax" },
+	{ "\xf0\x66\x48\xa3\x88\x77\x66\x55\x44\x33\x22\x11", 12, 12, ShvEmulMov, 8, 0x05, 0x00, 0xff, 0xff, 0, 0, 0x1122334455667788, 0x0, "lock data16 movabs ds:0x1122334455667788,rax" },
+	{ "\xf0\x66\x41\xa3\x88\x77\x66\x55\x44\x33\x22\x11", 12, 12, ShvEmulMov, 2, 0x05, 0x00, 0xff, 0xff, 0, 0, 0x1122334455667788, 0x0, "lock rex.B movabs ds:0x1122334455667788,ax" },
+	{ "\xf0\xf0\xa4", 3, 3, ShvEmulMovs, 1, 0x01, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "lock lock movs BYTE PTR es:[rdi],BYTE PTR ds:[rsi]" },
+	{ "\x3e\xa4", 2, 2, ShvEmulMovs, 1, 0x00, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "movs BYTE PTR es:[rdi],BYTE PTR ds:[rsi]" },
+	{ "\x66\x67\xa4", 3, 3, ShvEmulMovs, 1, 0x08, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "data16 movs BYTE PTR es:[edi],BYTE PTR ds:[esi]" },
+	{ "\x64\x65\xa4", 3, 3, ShvEmulMovs, 1, 0x00, 0x00, 0x07, 0xff, 0, 2, 0x0, 0x0, "fs movs BYTE PTR es:[rdi],BYTE PTR gs:[rsi]" },
+	{ "\x2e\xa4", 2, 2, ShvEmulMovs, 1, 0x00, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "movs BYTE PTR es:[rdi],BYTE PTR ds:[rsi]" },
+	{ "\x2e\x64\xa4", 3, 3, ShvEmulMovs, 1, 0x00, 0x00, 0x07, 0xff, 0, 1, 0x0, 0x0, "cs movs BYTE PTR es:[rdi],BYTE PTR fs:[rsi]" },
+	{ "\xf0\x65\x67\xa4", 4, 4, ShvEmulMovs, 1, 0x09, 0x00, 0x07, 0xff, 0, 2, 0x0, 0x0, "lock movs BYTE PTR es:[edi],BYTE PTR gs:[esi]" },
+	{ "\xf3\x66\xa4", 3, 3, ShvEmulMovs, 1, 0x02, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "rep data16 movs BYTE PTR es:[rdi],BYTE PTR ds:[rsi]" },
+	{ "\x36\xa4", 2, 2, ShvEmulMovs, 1, 0x00, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "movs BYTE PTR es:[rdi],BYTE PTR ds:[rsi]" },
+	{ "\xf3\xa4", 2, 2, ShvEmulMovs, 1, 0x02, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "rep movs BYTE PTR es:[rdi],BYTE PTR ds:[rsi]" },
+	{ "\x66\x66\xa4", 3, 3, ShvEmulMovs, 1, 0x00, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "data16 data16 movs BYTE PTR es:[rdi],BYTE PTR ds:[rsi]" },
+	{ "\x64\xa4", 2, 2, ShvEmulMovs, 1, 0x00, 0x00, 0x07, 0xff, 0, 1, 0x0, 0x0, "movs BYTE PTR es:[rdi],BYTE PTR fs:[rsi]" },
+	{ "\xf2\x48\xa4", 3, 3, ShvEmulMovs, 1, 0x06, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "repnz rex.W movs BYTE PTR es:[rdi],BYTE PTR ds:[rsi]" },
+	{ "\xf2\x41\xa4", 3, 3, ShvEmulMovs, 1, 0x06, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "repnz rex.B movs BYTE PTR es:[rdi],BYTE PTR ds:[rsi]" },
+	{ "\x66\x48\xa4", 3, 3, ShvEmulMovs, 1, 0x04, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "data16 rex.W movs BYTE PTR es:[rdi],BYTE PTR ds:[rsi]" },
+	{ "\x66\x41\xa4", 3, 3, ShvEmulMovs, 1, 0x04, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "data16 rex.B movs BYTE PTR es:[rdi],BYTE PTR ds:[rsi]" },
+	{ "\xf0\x66\x48\xa4", 4, 4, ShvEmulMovs, 1, 0x05, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "lock data16 rex.W movs BYTE PTR es:[rdi],BYTE PTR ds:[rsi]" },
+	{ "\xf0\x66\x41\xa4", 4, 4, ShvEmulMovs, 1, 0x05, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "lock data16 rex.B movs BYTE PTR es:[rdi],BYTE PTR ds:[rsi]" },
+	{ "\xf3\x48\xa4", 3, 3, ShvEmulMovs, 1, 0x06, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "rep rex.W movs BYTE PTR es:[rdi],BYTE PTR ds:[rsi]" },
+	{ "\xf3\x41\xa4", 3, 3, ShvEmulMovs, 1, 0x06, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "rep rex.B movs BYTE PTR es:[rdi],BYTE PTR ds:[rsi]" },
+	{ "\x66\x67\xa5", 3, 3, ShvEmulMovs, 2, 0x08, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "movs WORD PTR es:[edi],WORD PTR ds:[esi]" },
+	{ "\x66\x66\xa5", 3, 3, ShvEmulMovs, 2, 0x00, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "data16 movs WORD PTR es:[rdi],WORD PTR ds:[rsi]" },
+	{ "\xf3\x66\xa5", 3, 3, ShvEmulMovs, 2, 0x02, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "rep movs WORD PTR es:[rdi],WORD PTR ds:[rsi]" },
+	{ "\xf2\xf3\xa5", 3, 3, ShvEmulMovs, 4, 0x02, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "repnz rep movs DWORD PTR es:[rdi],DWORD PTR ds:[rsi]" },
+	{ "\x65\x2e\xa5", 3, 3, ShvEmulMovs, 4, 0x00, 0x00, 0x07, 0xff, 0, 2, 0x0, 0x0, "gs movs DWORD PTR es:[rdi],DWORD PTR gs:[rsi]" },
+	{ "\x65\xa5", 2, 2, ShvEmulMovs, 4, 0x00, 0x00, 0x07, 0xff, 0, 2, 0x0, 0x0, "movs DWORD PTR es:[rdi],DWORD PTR gs:[rsi]" },
+	{ "\x2e\xa5", 2, 2, ShvEmulMovs, 4, 0x00, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "movs DWORD PTR es:[rdi],DWORD PTR ds:[rsi]" },
+	{ "\xf0\x65\x67\xa5", 4, 4, ShvEmulMovs, 4, 0x09, 0x00, 0x07, 0xff, 0, 2, 0x0, 0x0, "lock movs DWORD PTR es:[edi],DWORD PTR gs:[esi]" },
+	{ "\xf0\xa5", 2, 2, ShvEmulMovs, 4, 0x01, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "lock movs DWORD PTR es:[rdi],DWORD PTR ds:[rsi]" },
+	{ "\x36\xa5", 2, 2, ShvEmulMovs, 4, 0x00, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "movs DWORD PTR es:[rdi],DWORD PTR ds:[rsi]" },
+	{ "\xa5", 1, 1, ShvEmulMovs, 4, 0x00, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "movs DWORD PTR es:[rdi],DWORD PTR ds:[rsi]" },
+	{ "\xf0\xf0\xa5", 3, 3, ShvEmulMovs, 4, 0x01, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "lock lock movs DWORD PTR es:[rdi],DWORD PTR ds:[rsi]" },
+	{ "\xf2\x48\xa5", 3, 3, ShvEmulMovs, 8, 0x06, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "repnz movs QWORD PTR es:[rdi],QWORD PTR ds:[rsi]" },
+	{ "\xf2\x41\xa5", 3, 3, ShvEmulMovs, 4, 0x06, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "repnz rex.B movs DWORD PTR es:[rdi],DWORD PTR ds:[rsi]" },
+	{ "\x67\x48\xa5", 3, 3, ShvEmulMovs, 8, 0x0c, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "movs QWORD PTR es:[edi],QWORD PTR ds:[esi]" },
+	{ "\x67\x41\xa5", 3, 3, ShvEmulMovs, 4, 0x0c, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "rex.B movs DWORD PTR es:[edi],DWORD PTR ds:[esi]" },
+	{ "\xf0\x48\xa5", 3, 3, ShvEmulMovs, 8, 0x05, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "lock movs QWORD PTR es:[rdi],QWORD PTR ds:[rsi]" },
+	{ "\xf0\x41\xa5", 3, 3, ShvEmulMovs, 4, 0x05, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "lock rex.B movs DWORD PTR es:[rdi],DWORD PTR ds:[rsi]" },
+	{ "\xf2\xf3\x48\xa5", 4, 4, ShvEmulMovs, 8, 0x06, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "repnz rep movs QWORD PTR es:[rdi],QWORD PTR ds:[rsi]" },
+	{ "\xf2\xf3\x41\xa5", 4, 4, ShvEmulMovs, 4, 0x06, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "repnz rep rex.B movs DWORD PTR es:[rdi],DWORD PTR ds:[rsi]" },
+	{ "\x66\x66\xa6", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 data16 cmps BYTE PTR ds:[rsi],BYTE PTR es:[rdi]" },
+	{ "\xf0\xa6", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock cmps BYTE PTR ds:[rsi],BYTE PTR es:[rdi]" },
+	{ "\x2e\xa6", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmps BYTE PTR ds:[rsi],BYTE PTR es:[rdi]" },
+	{ "\xf3\xa6", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz cmps BYTE PTR ds:[rsi],BYTE PTR es:[rdi]" },
+	{ "\x64\x65\xa6", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "fs cmps BYTE PTR gs:[rsi],BYTE PTR es:[rdi]" },
+	{ "\x26\xa6", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmps BYTE PTR ds:[rsi],BYTE PTR es:[rdi]" },
+	{ "\xf2\xa6", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz cmps BYTE PTR ds:[rsi],BYTE PTR es:[rdi]" },
+	{ "\xf0\x66\xa6", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock data16 cmps BYTE PTR ds:[rsi],BYTE PTR es:[rdi]" },
+	{ "\xf2\xf3\xa6", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz repz cmps BYTE PTR ds:[rsi],BYTE PTR es:[rdi]" },
+	{ "\x64\xa6", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmps BYTE PTR fs:[rsi],BYTE PTR es:[rdi]" },
+	{ "\xa6", 1, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmps BYTE PTR ds:[rsi],BYTE PTR es:[rdi]" },
+	{ "\x3e\xa6", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmps BYTE PTR ds:[rsi],BYTE PTR es:[rdi]" },
+	{ "\xf0\x66\x48\xa6", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock data16 rex.W cmps BYTE PTR ds:[rsi],BYTE PTR es:[rdi]" },
+	{ "\xf0\x66\x41\xa6", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock data16 rex.B cmps BYTE PTR ds:[rsi],BYTE PTR es:[rdi]" },
+	{ "\x64\x48\xa6", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W cmps BYTE PTR fs:[rsi],BYTE PTR es:[rdi]" },
+	{ "\x64\x41\xa6", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.B cmps BYTE PTR fs:[rsi],BYTE PTR es:[rdi]" },
+	{ "\x66\x48\xa6", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 rex.W cmps BYTE PTR ds:[rsi],BYTE PTR es:[rdi]" },
+	{ "\x66\x41\xa6", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 rex.B cmps BYTE PTR ds:[rsi],BYTE PTR es:[rdi]" },
+	{ "\x67\x48\xa6", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W cmps BYTE PTR ds:[esi],BYTE PTR es:[edi]" },
+	{ "\x67\x41\xa6", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.B cmps BYTE PTR ds:[esi],BYTE PTR es:[edi]" },
+	{ "\x64\x65\xa7", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "fs cmps DWORD PTR gs:[rsi],DWORD PTR es:[rdi]" },
+	{ "\x3e\xa7", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmps DWORD PTR ds:[rsi],DWORD PTR es:[rdi]" },
+	{ "\x26\xa7", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmps DWORD PTR ds:[rsi],DWORD PTR es:[rdi]" },
+	{ "\xf3\xf2\xa7", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz repnz cmps DWORD PTR ds:[rsi],DWORD PTR es:[rdi]" },
+	{ "\x2e\x64\xa7", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs cmps DWORD PTR fs:[rsi],DWORD PTR es:[rdi]" },
+	{ "\x66\xf2\xa7", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz cmps WORD PTR ds:[rsi],WORD PTR es:[rdi]" },
+	{ "\x67\xa7", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmps DWORD PTR ds:[esi],DWORD PTR es:[edi]" },
+	{ "\xf0\xa7", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock cmps DWORD PTR ds:[rsi],DWORD PTR es:[rdi]" },
+	{ "\xf3\xa7", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz cmps DWORD PTR ds:[rsi],DWORD PTR es:[rdi]" },
+	{ "\xf2\xf3\xa7", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz repz cmps DWORD PTR ds:[rsi],DWORD PTR es:[rdi]" },
+	{ "\xf0\x66\xa7", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock cmps WORD PTR ds:[rsi],WORD PTR es:[rdi]" },
+	{ "\x2e\xa7", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmps DWORD PTR ds:[rsi],DWORD PTR es:[rdi]" },
+	{ "\x66\x66\x48\xa7", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 data16 cmps QWORD PTR ds:[rsi],QWORD PTR es:[rdi]" },
+	{ "\x66\x66\x41\xa7", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 rex.B cmps WORD PTR ds:[rsi],WORD PTR es:[rdi]" },
+	{ "\x36\x48\xa7", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmps QWORD PTR ds:[rsi],QWORD PTR es:[rdi]" },
+	{ "\x36\x41\xa7", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.B cmps DWORD PTR ds:[rsi],DWORD PTR es:[rdi]" },
+	{ "\x64\x65\x48\xa7", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "fs cmps QWORD PTR gs:[rsi],QWORD PTR es:[rdi]" },
+	{ "\x64\x65\x41\xa7", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "fs rex.B cmps DWORD PTR gs:[rsi],DWORD PTR es:[rdi]" },
+	{ "\x2e\x48\xa7", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmps QWORD PTR ds:[rsi],QWORD PTR es:[rdi]" },
+	{ "\x2e\x41\xa7", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.B cmps DWORD PTR ds:[rsi],DWORD PTR es:[rdi]" },
+	{ "\x66\x67\xaa", 3, 3, ShvEmulStos, 1, 0x08, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "data16 stos BYTE PTR es:[edi],al" },
+	{ "\xaa", 1, 1, ShvEmulStos, 1, 0x00, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "stos BYTE PTR es:[rdi],al" },
+	{ "\x66\xf2\xaa", 3, 3, ShvEmulStos, 1, 0x02, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "data16 repnz stos BYTE PTR es:[rdi],al" },
+	{ "\x2e\x64\xaa", 3, 3, ShvEmulStos, 1, 0x00, 0x00, 0x07, 0xff, 0, 1, 0x0, 0x0, "cs fs stos BYTE PTR es:[rdi],al" },
+	{ "\x65\xaa", 2, 2, ShvEmulStos, 1, 0x00, 0x00, 0x07, 0xff, 0, 2, 0x0, 0x0, "gs stos BYTE PTR es:[rdi],al" },
+	{ "\x2e\xaa", 2, 2, ShvEmulStos, 1, 0x00, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "cs stos BYTE PTR es:[rdi],al" },
+	{ "\xf2\xf3\xaa", 3, 3, ShvEmulStos, 1, 0x02, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "repnz rep stos BYTE PTR es:[rdi],al" },
+	{ "\x64\xaa", 2, 2, ShvEmulStos, 1, 0x00, 0x00, 0x07, 0xff, 0, 1, 0x0, 0x0, "fs stos BYTE PTR es:[rdi],al" },
+	{ "\xf3\x66\xaa", 3, 3, ShvEmulStos, 1, 0x02, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "rep data16 stos BYTE PTR es:[rdi],al" },
+	{ "\xf0\x65\x67\xaa", 4, 4, ShvEmulStos, 1, 0x09, 0x00, 0x07, 0xff, 0, 2, 0x0, 0x0, "lock gs stos BYTE PTR es:[edi],al" },
+	{ "\xf3\xaa", 2, 2, ShvEmulStos, 1, 0x02, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "rep stos BYTE PTR es:[rdi],al" },
+	{ "\x36\xaa", 2, 2, ShvEmulStos, 1, 0x00, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "ss stos BYTE PTR es:[rdi],al" },
+	{ "\x64\x48\xaa", 3, 3, ShvEmulStos, 1, 0x04, 0x00, 0x07, 0xff, 0, 1, 0x0, 0x0, "fs rex.W stos BYTE PTR es:[rdi],al" },
+	{ "\x64\x41\xaa", 3, 3, ShvEmulStos, 1, 0x04, 0x00, 0x07, 0xff, 0, 1, 0x0, 0x0, "fs rex.B stos BYTE PTR es:[rdi],al" },
+	{ "\x65\x48\xaa", 3, 3, ShvEmulStos, 1, 0x04, 0x00, 0x07, 0xff, 0, 2, 0x0, 0x0, "gs rex.W stos BYTE PTR es:[rdi],al" },
+	{ "\x65\x41\xaa", 3, 3, ShvEmulStos, 1, 0x04, 0x00, 0x07, 0xff, 0, 2, 0x0, 0x0, "gs rex.B stos BYTE PTR es:[rdi],al" },
+	{ "\xf0\x66\x48\xaa", 4, 4, ShvEmulStos, 1, 0x05, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "lock data16 rex.W stos BYTE PTR es:[rdi],al" },
+	{ "\xf0\x66\x41\xaa", 4, 4, ShvEmulStos, 1, 0x05, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "lock data16 rex.B stos BYTE PTR es:[rdi],al" },
+	{ "\xf0\xf0\x48\xaa", 4, 4, ShvEmulStos, 1, 0x05, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "lock lock rex.W stos BYTE PTR es:[rdi],al" },
+	{ "\xf0\xf0\x41\xaa", 4, 4, ShvEmulStos, 1, 0x05, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "lock lock rex.B stos BYTE PTR es:[rdi],al" },
+	{ "\x26\xab", 2, 2, ShvEmulStos, 4, 0x00, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "es stos DWORD PTR es:[rdi],eax" },
+	{ "\x64\x65\xab", 3, 3, ShvEmulStos, 4, 0x00, 0x00, 0x07, 0xff, 0, 2, 0x0, 0x0, "fs gs stos DWORD PTR es:[rdi],eax" },
+	{ "\xf0\x66\xab", 3, 3, ShvEmulStos, 2, 0x01, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "lock stos WORD PTR es:[rdi],ax" },
+	{ "\x36\xab", 2, 2, ShvEmulStos, 4, 0x00, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "ss stos DWORD PTR es:[rdi],eax" },
+	{ "\x65\xab", 2, 2, ShvEmulStos, 4, 0x00, 0x00, 0x07, 0xff, 0, 2, 0x0, 0x0, "gs stos DWORD PTR es:[rdi],eax" },
+	{ "\xf3\xf2\xab", 3, 3, ShvEmulStos, 4, 0x02, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "rep repnz stos DWORD PTR es:[rdi],eax" },
+	{ "\x64\xab", 2, 2, ShvEmulStos, 4, 0x00, 0x00, 0x07, 0xff, 0, 1, 0x0, 0x0, "fs stos DWORD PTR es:[rdi],eax" },
+	{ "\x2e\x64\xab", 3, 3, ShvEmulStos, 4, 0x00, 0x00, 0x07, 0xff, 0, 1, 0x0, 0x0, "cs fs stos DWORD PTR es:[rdi],eax" },
+	{ "\x66\x67\xab", 3, 3, ShvEmulStos, 2, 0x08, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "stos WORD PTR es:[edi],ax" },
+	{ "\xf3\x66\xab", 3, 3, ShvEmulStos, 2, 0x02, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "rep stos WORD PTR es:[rdi],ax" },
+	{ "\x2e\xab", 2, 2, ShvEmulStos, 4, 0x00, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "cs stos DWORD PTR es:[rdi],eax" },
+	{ "\xf0\xf0\xab", 3, 3, ShvEmulStos, 4, 0x01, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "lock lock stos DWORD PTR es:[rdi],eax" },
+	{ "\x3e\x48\xab", 3, 3, ShvEmulStos, 8, 0x04, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "ds stos QWORD PTR es:[rdi],rax" },
+	{ "\x3e\x41\xab", 3, 3, ShvEmulStos, 4, 0x04, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "ds rex.B stos DWORD PTR es:[rdi],eax" },
+	{ "\xf0\x48\xab", 3, 3, ShvEmulStos, 8, 0x05, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "lock stos QWORD PTR es:[rdi],rax" },
+	{ "\xf0\x41\xab", 3, 3, ShvEmulStos, 4, 0x05, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "lock rex.B stos DWORD PTR es:[rdi],eax" },
+	{ "\x67\x48\xab", 3, 3, ShvEmulStos, 8, 0x0c, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "stos QWORD PTR es:[edi],rax" },
+	{ "\x67\x41\xab", 3, 3, ShvEmulStos, 4, 0x0c, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "rex.B stos DWORD PTR es:[edi],eax" },
+	{ "\x36\x48\xab", 3, 3, ShvEmulStos, 8, 0x04, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "ss stos QWORD PTR es:[rdi],rax" },
+	{ "\x36\x41\xab", 3, 3, ShvEmulStos, 4, 0x04, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "ss rex.B stos DWORD PTR es:[rdi],eax" },
+	{ "\xf3\xf2\xac", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rep repnz lods al,BYTE PTR ds:[rsi]" },
+	{ "\xf2\xf3\xac", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz rep lods al,BYTE PTR ds:[rsi]" },
+	{ "\xf0\xac", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock lods al,BYTE PTR ds:[rsi]" },
+	{ "\xf3\xac", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rep lods al,BYTE PTR ds:[rsi]" },
+	{ "\xac", 1, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lods al,BYTE PTR ds:[rsi]" },
+	{ "\x36\xac", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lods al,BYTE PTR ds:[rsi]" },
+	{ "\x66\x67\xac", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 lods al,BYTE PTR ds:[esi]" },
+	{ "\xf3\x66\xac", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rep data16 lods al,BYTE PTR ds:[rsi]" },
+	{ "\x2e\xac", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lods al,BYTE PTR ds:[rsi]" },
+	{ "\x66\xac", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 lods al,BYTE PTR ds:[rsi]" },
+	{ "\x2e\x64\xac", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs lods al,BYTE PTR fs:[rsi]" },
+	{ "\x3e\xac", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lods al,BYTE PTR ds:[rsi]" },
+	{ "\xf0\x65\x67\x48\xac", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock rex.W lods al,BYTE PTR gs:[esi]" },
+	{ "\xf0\x65\x67\x41\xac", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock rex.B lods al,BYTE PTR gs:[esi]" },
+	{ "\xf0\x66\x48\xac", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock data16 rex.W lods al,BYTE PTR ds:[rsi]" },
+	{ "\xf0\x66\x41\xac", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock data16 rex.B lods al,BYTE PTR ds:[rsi]" },
+	{ "\xf0\xf0\x48\xac", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock lock rex.W lods al,BYTE PTR ds:[rsi]" },
+	{ "\xf0\xf0\x41\xac", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock lock rex.B lods al,BYTE PTR ds:[rsi]" },
+	{ "\x66\xf2\x48\xac", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 repnz rex.W lods al,BYTE PTR ds:[rsi]" },
+	{ "\x66\xf2\x41\xac", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 repnz rex.B lods al,BYTE PTR ds:[rsi]" },
+	{ "\xf0\x66\xae", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock data16 scas al,BYTE PTR es:[rdi]" },
+	{ "\xf0\xf0\xae", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock lock scas al,BYTE PTR es:[rdi]" },
+	{ "\x66\x66\xae", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 data16 scas al,BYTE PTR es:[rdi]" },
+	{ "\x65\xae", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "gs scas al,BYTE PTR es:[rdi]" },
+	{ "\xf2\xf3\xae", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz repz scas al,BYTE PTR es:[rdi]" },
+	{ "\xae", 1, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "scas al,BYTE PTR es:[rdi]" },
+	{ "\x64\x65\xae", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "fs gs scas al,BYTE PTR es:[rdi]" },
+	{ "\xf3\xae", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz scas al,BYTE PTR es:[rdi]" },
+	{ "\xf3\xf2\xae", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz repnz scas al,BYTE PTR es:[rdi]" },
+	{ "\x67\xae", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "scas al,BYTE PTR es:[edi]" },
+	{ "\x2e\xae", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs scas al,BYTE PTR es:[rdi]" },
+	{ "\x66\x67\xae", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 scas al,BYTE PTR es:[edi]" },
+	{ "\xf2\xf3\x48\xae", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz repz rex.W scas al,BYTE PTR es:[rdi]" },
+	{ "\xf2\xf3\x41\xae", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz repz rex.B scas al,BYTE PTR es:[rdi]" },
+	{ "\xf3\x48\xae", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz rex.W scas al,BYTE PTR es:[rdi]" },
+	{ "\xf3\x41\xae", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz rex.B scas al,BYTE PTR es:[rdi]" },
+	{ "\x2e\x64\x48\xae", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs fs rex.W scas al,BYTE PTR es:[rdi]" },
+	{ "\x2e\x64\x41\xae", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs fs rex.B scas al,BYTE PTR es:[rdi]" },
+	{ "\x48\xae", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W scas al,BYTE PTR es:[rdi]" },
+	{ "\x41\xae", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.B scas al,BYTE PTR es:[rdi]" },
+	{ "\xc4\xe1\x78\x10\x05\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovups xmm0,XMMWORD PTR [rip+0xfffffffffffffff0] # 0xf959" },
+	{ "\xc4\x01\x78\x10\x04\xcd\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovups xmm8,XMMWORD PTR [r9*8+0x40]" },
+	{ "\xc4\xa1\x78\x10\x04\xcd\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovups xmm0,XMMWORD PTR [r9*8+0x40]" },
+	{ "\xc4\x41\x78\x10\x41\x80", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovups xmm8,XMMWORD PTR [r9-0x80]" },
+	{ "\xc4\xe1\xf8\x10\x41\x80", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovups xmm0,XMMWORD PTR [rcx-0x80]" },
+	{ "\xc4\x01\xf8\x10\x06", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovups xmm8,XMMWORD PTR [r14]" },
+	{ "\xc4\xa1\xf8\x10\x40\x7f", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovups xmm0,XMMWORD PTR [rax+0x7f]" },
+	{ "\xc4\x41\xf8\x10\x07", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovups xmm8,XMMWORD PTR [r15]" },
+	{ "\xc4\xe1\x7c\x10\x05\x10\x00\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovups ymm0,YMMWORD PTR [rip+0x10] # 0xfa79" },
+	{ "\xc4\x01\x7c\x10\xc0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovups ymm8,ymm8" },
+	{ "\xc4\xa1\x7c\x10\x05\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovups ymm0,YMMWORD PTR [rip+0xfffffffffffffff0] # 0xfa99" },
+	{ "\xc4\x41\x7c\x10\x04\xa0", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovups ymm8,YMMWORD PTR [r8+riz*4]" },
+	{ "\xc4\xe1\xfc\x10\x06", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovups ymm0,YMMWORD PTR [rsi]" },
+	{ "\xc4\x01\xfc\x10\x44\x5d\xf8", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovups ymm8,YMMWORD PTR [r13+r11*2-0x8]" },
+	{ "\xc4\xa1\xfc\x10\x44\x5d\xf8", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovups ymm0,YMMWORD PTR [rbp+r11*2-0x8]" },
+	{ "\xc4\x41\xfc\x10\x03", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovups ymm8,YMMWORD PTR [r11]" },
+	{ "\xc5\xf9\x10\x07", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovupd xmm0,XMMWORD PTR [rdi]" },
+	{ "\xc4\x01\x79\x10\x45\x08", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovupd xmm8,XMMWORD PTR [r13+0x8]" },
+	{ "\xc4\xa1\x79\x10\x04\x65\x00\x10\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovupd xmm0,XMMWORD PTR [r12*2+0x1000]" },
+	{ "\xc4\x41\x79\x10\x04\xcd\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovupd xmm8,XMMWORD PTR [rcx*8+0x40]" },
+	{ "\xc4\xe1\xf9\x10\x06", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovupd xmm0,XMMWORD PTR [rsi]" },
+	{ "\xc4\x01\xf9\x10\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovupd xmm8,XMMWORD PTR [r8]" },
+	{ "\xc4\xa1\xf9\x10\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovupd xmm0,XMMWORD PTR [rax]" },
+	{ "\xc4\x41\xf9\x10\x41\x80", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovupd xmm8,XMMWORD PTR [r9-0x80]" },
+	{ "\xc4\xe1\x7d\x10\x40\x7f", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovupd ymm0,YMMWORD PTR [rax+0x7f]" },
+	{ "\xc4\x01\x7d\x10\x04\x1d\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovupd ymm8,YMMWORD PTR [r11*1+0x40]" },
+	{ "\xc4\xa1\x7d\x10\x40\x7f", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovupd ymm0,YMMWORD PTR [rax+0x7f]" },
+	{ "\xc4\x41\x7d\x10\xd7", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovupd ymm10,ymm15" },
+	{ "\xc4\xe1\xfd\x10\xc0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovupd ymm0,ymm0" },
+	{ "\xc4\x01\xfd\x10\x05\x10\x00\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovupd ymm8,YMMWORD PTR [rip+0x10] # 0xfd19" },
+	{ "\xc4\xa1\xfd\x10\x04\x65\x00\x10\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovupd ymm0,YMMWORD PTR [r12*2+0x1000]" },
+	{ "\xc4\x41\xfd\x10\x84\xe5\x44\x33\x22\x11", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovupd ymm8,YMMWORD PTR [r13+riz*8+0x11223344]" },
+	{ "\xc5\xfa\x10\xd7", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovss xmm2,xmm0,xmm7" },
+	{ "\xc4\x01\x7a\x10\x04\xcd\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovss xmm8,DWORD PTR [r9*8+0x40]" },
+	{ "\xc4\xa1\x7a\x10\x03", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovss xmm0,DWORD PTR [rbx]" },
+	{ "\xc4\x41\x7a\x10\x85\x00\x00\x00\x80", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovss xmm8,DWORD PTR [r13-0x80000000]" },
+	{ "\xc4\xe1\xfa\x10\x04\x24", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovss xmm0,DWORD PTR [rsp]" },
+	{ "\xc4\x01\xfa\x10\x04\xcd\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovss xmm8,DWORD PTR [r9*8+0x40]" },
+	{ "\xc4\xa1\xfa\x10\x07", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovss xmm0,DWORD PTR [rdi]" },
+	{ "\xc4\x41\xfa\x10\x05\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovss xmm8,DWORD PTR [rip+0xfffffffffffffff0] # 0xfe39" },
+	{ "\xc4\xe1\x7e\x10\xd7", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovss xmm2,xmm0,xmm7" },
+	{ "\xc4\x01\x7e\x10\x44\x5d\xf8", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovss xmm8,DWORD PTR [r13+r11*2-0x8]" },
+	{ "\xc4\xa1\x7e\x10\xd7", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovss xmm2,xmm0,xmm7" },
+	{ "\xc4\x41\x7e\x10\x81\x00\x10\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovss xmm8,DWORD PTR [r9+0x1000]" },
+	{ "\xc4\xe1\xfe\x10\x04\x25\xf0\xff\xff\xff", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovss xmm0,DWORD PTR ds:0xfffffffffffffff0" },
+	{ "\xc4\x01\xfe\x10\x04\x98", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovss xmm8,DWORD PTR [r8+r11*4]" },
+	{ "\xc4\xa1\xfe\x10\xd7", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovss xmm2,xmm0,xmm7" },
+	{ "\xc4\x41\xfe\x10\x06", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovss xmm8,DWORD PTR [r14]" },
+	{ "\xc5\xfb\x10\xc0", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovsd xmm0,xmm0,xmm0" },
+	{ "\xc4\x01\x7b\x10\x04\x25\xf0\xff\xff\xff", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovsd xmm8,QWORD PTR [r12*1-0x10]" },
+	{ "\xc4\xa1\x7b\x10\xc0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovsd xmm0,xmm0,xmm0" },
+	{ "\xc4\x41\x7b\x10\x81\x00\x10\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovsd xmm8,QWORD PTR [r9+0x1000]" },
+	{ "\xc4\xe1\xfb\x10\x85\x00\x00\x00\x80", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovsd xmm0,QWORD PTR [rbp-0x80000000]" },
+	{ "\xc4\x01\xfb\x10\x04\x24", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovsd xmm8,QWORD PTR [r12+r12*1]" },
+	{ "\xc4\xa1\xfb\x10\x04\xa0", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovsd xmm0,QWORD PTR [rax+r12*4]" },
+	{ "\xc4\x41\xfb\x10\x45\x08", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovsd xmm8,QWORD PTR [r13+0x8]" },
+	{ "\xc4\xe1\x7f\x10\xc0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovsd xmm0,xmm0,xmm0" },
+	{ "\xc4\x01\x7f\x10\x41\x80", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovsd xmm8,QWORD PTR [r9-0x80]" },
+	{ "\xc4\xa1\x7f\x10\x06", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovsd xmm0,QWORD PTR [rsi]" },
+	{ "\xc4\x41\x7f\x10\x04\x25\xf0\xff\xff\xff", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovsd xmm8,QWORD PTR ds:0xfffffffffffffff0" },
+	{ "\xc4\xe1\xff\x10\x04\x20", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovsd xmm0,QWORD PTR [rax+riz*1]" },
+	{ "\xc4\x01\xff\x10\x04\xa0", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovsd xmm8,QWORD PTR [r8+r12*4]" },
+	{ "\xc4\xa1\xff\x10\xc0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovsd xmm0,xmm0,xmm0" },
+	{ "\xc4\x41\xff\x10\x45\x08", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovsd xmm8,QWORD PTR [r13+0x8]" },
+	{ "\xc4\xe1\x71\x10\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc5\x80\x10\x00", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe2\x79\x10\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe3\x79\x10\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x66\xc5\xf9\x10\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 vmovupd xmm0,XMMWORD PTR [rax]" },
+	{ "\xf3\xc5\xf9\x10\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz vmovupd xmm0,XMMWORD PTR [rax]" },
+	{ "\xf0\xc5\xf9\x10\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock vmovupd xmm0,XMMWORD PTR [rax]" },
+	{ "\x48\xc5\xf9\x10\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W vmovupd xmm0,XMMWORD PTR [rax]" },
+	{ "\x64\xc5\xf9\x10\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovupd xmm0,XMMWORD PTR fs:[rax]" },
+	{ "\x67\xc5\xf9\x10\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovupd xmm0,XMMWORD PTR [eax]" },
+	{ "\x2e\xc5\xf9\x10\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs vmovupd xmm0,XMMWORD PTR [rax]" },
+	{ "\xc5\xf8\x11\xc0", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovups xmm0,xmm0" },
+	{ "\xc4\x01\x78\x11\x07", 5, 5, ShvEmulMov, 16, 0x10, 0x08, 0x0f, 0xff, 0, 0, 0x0, 0x0, "vmovups XMMWORD PTR [r15],xmm8" },
+	{ "\xc4\xa1\x78\x11\x07", 5, 5, ShvEmulMov, 16, 0x10, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "vmovups XMMWORD PTR [rdi],xmm0" },
+	{ "\xc4\x41\x78\x11\x00", 5, 5, ShvEmulMov, 16, 0x10, 0x08, 0x08, 0xff, 0, 0, 0x0, 0x0, "vmovups XMMWORD PTR [r8],xmm8" },
+	{ "\xc4\xe1\xf8\x11\xd7", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovups xmm7,xmm2" },
+	{ "\xc4\x01\xf8\x11\x85\x00\x00\x00\x80", 9, 9, ShvEmulMov, 16, 0x10, 0x08, 0x0d, 0xff, 0, 0, 0xffffffff80000000, 0x0, "vmovups XMMWORD PTR [r13-0x80000000],xmm8" },
+	{ "\xc4\xa1\xf8\x11\x05\xf0\xff\xff\xff", 9, 9, ShvEmulMov, 16, 0x10, 0x00, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "vmovups XMMWORD PTR [rip+0xfffffffffffffff0],xmm0 # 0x10379" },
+	{ "\xc4\x41\xf8\x11\x00", 5, 5, ShvEmulMov, 16, 0x10, 0x08, 0x08, 0xff, 0, 0, 0x0, 0x0, "vmovups XMMWORD PTR [r8],xmm8" },
+	{ "\xc4\xe1\x7c\x11\x04\x1d\x40\x00\x00\x00", 10, 10, ShvEmulMov, 32, 0x10, 0x00, 0xff, 0x03, 1, 0, 0x40, 0x0, "vmovups YMMWORD PTR [rbx*1+0x40],ymm0" },
+	{ "\xc4\x01\x7c\x11\x04\xa0", 6, 6, ShvEmulMov, 32, 0x10, 0x08, 0x08, 0x0c, 4, 0, 0x0, 0x0, "vmovups YMMWORD PTR [r8+r12*4],ymm8" },
+	{ "\xc4\xa1\x7c\x11\x07", 5, 5, ShvEmulMov, 32, 0x10, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "vmovups YMMWORD PTR [rdi],ymm0" },
+	{ "\xc4\x41\x7c\x11\x05\xf0\xff\xff\xff", 9, 9, ShvEmulMov, 32, 0x10, 0x08, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "vmovups YMMWORD PTR [rip+0xfffffffffffffff0],ymm8 # 0x10419" },
+	{ "\xc4\xe1\xfc\x11\x44\x5d\xf8", 7, 7, ShvEmulMov, 32, 0x10, 0x00, 0x05, 0x03, 2, 0, 0xfffffffffffffff8, 0x0, "vmovups YMMWORD PTR [rbp+rbx*2-0x8],ymm0" },
+	{ "\xc4\x01\xfc\x11\x04\x20", 6, 6, ShvEmulMov, 32, 0x10, 0x08, 0x08, 0x0c, 1, 0, 0x0, 0x0, "vmovups YMMWORD PTR [r8+r12*1],ymm8" },
+	{ "\xc4\xa1\xfc\x11\x45\x08", 6, 6, ShvEmulMov, 32, 0x10, 0x00, 0x05, 0xff, 0, 0, 0x8, 0x0, "vmovups YMMWORD PTR [rbp+0x8],ymm0" },
+	{ "\xc4\x41\xfc\x11\x04\xa0", 6, 6, ShvEmulMov, 32, 0x10, 0x08, 0x08, 0xff, 0, 0, 0x0, 0x0, "vmovups YMMWORD PTR [r8+riz*4],ymm8" },
+	{ "\xc5\xf9\x11\x81\x00\x10\x00\x00", 8, 8, ShvEmulMov, 16, 0x10, 0x00, 0x01, 0xff, 0, 0, 0x1000, 0x0, "vmovupd XMMWORD PTR [rcx+0x1000],xmm0" },
+	{ "\xc4\x01\x79\x11\x04\x25\xf0\xff\xff\xff", 10, 10, ShvEmulMov, 16, 0x10, 0x08, 0xff, 0x0c, 1, 0, 0xfffffffffffffff0, 0x0, "vmovupd XMMWORD PTR [r12*1-0x10],xmm8" },
+	{ "\xc4\xa1\x79\x11\xd7", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovupd xmm7,xmm2" },
+	{ "\xc4\x41\x79\x11\x04\x25\xf0\xff\xff\xff", 10, 10, ShvEmulMov, 16, 0x10, 0x08, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "vmovupd XMMWORD PTR ds:0xfffffffffffffff0,xmm8" },
+	{ "\xc4\xe1\xf9\x11\x84\xe5\x44\x33\x22\x11", 10, 10, ShvEmulMov, 16, 0x10, 0x00, 0x05, 0xff, 0, 0, 0x11223344, 0x0, "vmovupd XMMWORD PTR [rbp+riz*8+0x11223344],xmm0" },
+	{ "\xc4\x01\xf9\x11\x07", 5, 5, ShvEmulMov, 16, 0x10, 0x08, 0x0f, 0xff, 0, 0, 0x0, 0x0, "vmovupd XMMWORD PTR [r15],xmm8" },
+	{ "\xc4\xa1\xf9\x11\x44\x24\x10", 7, 7, ShvEmulMov, 16, 0x10, 0x00, 0x04, 0x0c, 1, 0, 0x10, 0x0, "vmovupd XMMWORD PTR [rsp+r12*1+0x10],xmm0" },
+	{ "\xc4\x41\xf9\x11\x06", 5, 5, ShvEmulMov, 16, 0x10, 0x08, 0x0e, 0xff, 0, 0, 0x0, 0x0, "vmovupd XMMWORD PTR [r14],xmm8" },
+	{ "\xc5\xfd\x11\x04\xcd\x40\x00\x00\x00", 9, 9, ShvEmulMov, 32, 0x10, 0x00, 0xff, 0x01, 8, 0, 0x40, 0x0, "vmovupd YMMWORD PTR [rcx*8+0x40],ymm0" },
+	{ "\xc4\x01\x7d\x11\x44\x5d\xf8", 7, 7, ShvEmulMov, 32, 0x10, 0x08, 0x0d, 0x0b, 2, 0, 0xfffffffffffffff8, 0x0, "vmovupd YMMWORD PTR [r13+r11*2-0x8],ymm8" },
+	{ "\xc4\xa1\x7d\x11\x04\x24", 6, 6, ShvEmulMov, 32, 0x10, 0x00, 0x04, 0x0c, 1, 0, 0x0, 0x0, "vmovupd YMMWORD PTR [rsp+r12*1],ymm0" },
+	{ "\xc4\x41\x7d\x11\x85\x00\x00\x00\x80", 9, 9, ShvEmulMov, 32, 0x10, 0x08, 0x0d, 0xff, 0, 0, 0xffffffff80000000, 0x0, "vmovupd YMMWORD PTR [r13-0x80000000],ymm8" },
+	{ "\xc4\xe1\xfd\x11\x04\x98", 6, 6, ShvEmulMov, 32, 0x10, 0x00, 0x00, 0x03, 4, 0, 0x0, 0x0, "vmovupd YMMWORD PTR [rax+rbx*4],ymm0" },
+	{ "\xc4\x01\xfd\x11\x04\x65\x00\x10\x00\x00", 10, 10, ShvEmulMov, 32, 0x10, 0x08, 0xff, 0x0c, 2, 0, 0x1000, 0x0, "vmovupd YMMWORD PTR [r12*2+0x1000],ymm8" },
+	{ "\xc4\xa1\xfd\x11\x07", 5, 5, ShvEmulMov, 32, 0x10, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "vmovupd YMMWORD PTR [rdi],ymm0" },
+	{ "\xc4\x41\xfd\x11\x40\x7f", 6, 6, ShvEmulMov, 32, 0x10, 0x08, 0x08, 0xff, 0, 0, 0x7f, 0x0, "vmovupd YMMWORD PTR [r8+0x7f],ymm8" },
+	{ "\xc4\xe1\x7a\x11\x05\xf0\xff\xff\xff", 9, 9, ShvEmulMov, 4, 0x10, 0x00, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "vmovss DWORD PTR [rip+0xfffffffffffffff0],xmm0 # 0x106b9" },
+	{ "\xc4\x01\x7a\x11\x05\x10\x00\x00\x00", 9, 9, ShvEmulMov, 4, 0x10, 0x08, 0x10, 0xff, 0, 0, 0x10, 0x0, "vmovss DWORD PTR [rip+0x10],xmm8 # 0x106f9" },
+	{ "\xc4\xa1\x7a\x11\x04\x25\x78\x56\x34\x12", 10, 10, ShvEmulMov, 4, 0x10, 0x00, 0xff, 0x0c, 1, 0, 0x12345678, 0x0, "vmovss DWORD PTR [r12*1+0x12345678],xmm0" },
+	{ "\xc4\x41\x7a\x11\x04\x65\x00\x10\x00\x00", 10, 10, ShvEmulMov, 4, 0x10, 0x08, 0xff, 0xff, 0, 0, 0x1000, 0x0, "vmovss DWORD PTR [riz*2+0x1000],xmm8" },
+	{ "\xc4\xe1\xfa\x11\x04\x20", 6, 6, ShvEmulMov, 4, 0x10, 0x00, 0x00, 0xff, 0, 0, 0x0, 0x0, "vmovss DWORD PTR [rax+riz*1],xmm0" },
+	{ "\xc4\x01\xfa\x11\x04\xcd\x40\x00\x00\x00", 10, 10, ShvEmulMov, 4, 0x10, 0x08, 0xff, 0x09, 8, 0, 0x40, 0x0, "vmovss DWORD PTR [r9*8+0x40],xmm8" },
+	{ "\xc4\xa1\xfa\x11\x41\x80", 6, 6, ShvEmulMov, 4, 0x10, 0x00, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "vmovss DWORD PTR [rcx-0x80],xmm0" },
+	{ "\xc4\x41\xfa\x11\x04\x20", 6, 6, ShvEmulMov, 4, 0x10, 0x08, 0x08, 0xff, 0, 0, 0x0, 0x0, "vmovss DWORD PTR [r8+riz*1],xmm8" },
+	{ "\xc5\xfe\x11\x06", 4, 4, ShvEmulMov, 4, 0x10, 0x00, 0x06, 0xff, 0, 0, 0x0, 0x0, "vmovss DWORD PTR [rsi],xmm0" },
+	{ "\xc4\x01\x7e\x11\x04\x20", 6, 6, ShvEmulMov, 4, 0x10, 0x08, 0x08, 0x0c, 1, 0, 0x0, 0x0, "vmovss DWORD PTR [r8+r12*1],xmm8" },
+	{ "\xc4\xa1\x7e\x11\x85\x00\x00\x00\x80", 9, 9, ShvEmulMov, 4, 0x10, 0x00, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x0, "vmovss DWORD PTR [rbp-0x80000000],xmm0" },
+	{ "\xc4\x41\x7e\x11\x04\x20", 6, 6, ShvEmulMov, 4, 0x10, 0x08, 0x08, 0xff, 0, 0, 0x0, 0x0, "vmovss DWORD PTR [r8+riz*1],xmm8" },
+	{ "\xc4\xe1\xfe\x11\xc0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovss ymm0,xmm0,xmm0" },
+	{ "\xc4\x01\xfe\x11\x85\x00\x00\x00\x80", 9, 9, ShvEmulMov, 4, 0x10, 0x08, 0x0d, 0xff, 0, 0, 0xffffffff80000000, 0x0, "vmovss DWORD PTR [r13-0x80000000],xmm8" },
+	{ "\xc4\xa1\xfe\x11\x00", 5, 5, ShvEmulMov, 4, 0x10, 0x00, 0x00, 0xff, 0, 0, 0x0, 0x0, "vmovss DWORD PTR [rax],xmm0" },
+	{ "\xc4\x41\xfe\x11\xd7", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovss ymm15,xmm0,xmm10" },
+	{ "\xc5\xfb\x11\x07", 4, 4, ShvEmulMov, 8, 0x10, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "vmovsd QWORD PTR [rdi],xmm0" },
+	{ "\xc4\x01\x7b\x11\x05\x10\x00\x00\x00", 9, 9, ShvEmulMov, 8, 0x10, 0x08, 0x10, 0xff, 0, 0, 0x10, 0x0, "vmovsd QWORD PTR [rip+0x10],xmm8 # 0x108f9" },
+	{ "\xc4\xa1\x7b\x11\x81\x00\x10\x00\x00", 9, 9, ShvEmulMov, 8, 0x10, 0x00, 0x01, 0xff, 0, 0, 0x1000, 0x0, "vmovsd QWORD PTR [rcx+0x1000],xmm0" },
+	{ "\xc4\x41\x7b\x11\x04\x1d\x40\x00\x00\x00", 10, 10, ShvEmulMov, 8, 0x10, 0x08, 0xff, 0x03, 1, 0, 0x40, 0x0, "vmovsd QWORD PTR [rbx*1+0x40],xmm8" },
+	{ "\xc4\xe1\xfb\x11\x04\xa0", 6, 6, ShvEmulMov, 8, 0x10, 0x00, 0x00, 0xff, 0, 0, 0x0, 0x0, "vmovsd QWORD PTR [rax+riz*4],xmm0" },
+	{ "\xc4\x01\xfb\x11\x04\x24", 6, 6, ShvEmulMov, 8, 0x10, 0x08, 0x0c, 0x0c, 1, 0, 0x0, 0x0, "vmovsd QWORD PTR [r12+r12*1],xmm8" },
+	{ "\xc4\xa1\xfb\x11\x41\x80", 6, 6, ShvEmulMov, 8, 0x10, 0x00, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "vmovsd QWORD PTR [rcx-0x80],xmm0" },
+	{ "\xc4\x41\xfb\x11\x05\x10\x00\x00\x00", 9, 9, ShvEmulMov, 8, 0x10, 0x08, 0x10, 0xff, 0, 0, 0x10, 0x0, "vmovsd QWORD PTR [rip+0x10],xmm8 # 0x109b9" },
+	{ "\xc5\xff\x11\x04\x25\xf0\xff\xff\xff", 9, 9, ShvEmulMov, 8, 0x10, 0x00, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "vmovsd QWORD PTR ds:0xfffffffffffffff0,xmm0" },
+	{ "\xc4\x01\x7f\x11\x44\x24\x10", 7, 7, ShvEmulMov, 8, 0x10, 0x08, 0x0c, 0x0c, 1, 0, 0x10, 0x0, "vmovsd QWORD PTR [r12+r12*1+0x10],xmm8" },
+	{ "\xc4\xa1\x7f\x11\x81\x00\x10\x00\x00", 9, 9, ShvEmulMov, 8, 0x10, 0x00, 0x01, 0xff, 0, 0, 0x1000, 0x0, "vmovsd QWORD PTR [rcx+0x1000],xmm0" },
+	{ "\xc4\x41\x7f\x11\x05\xf0\xff\xff\xff", 9, 9, ShvEmulMov, 8, 0x10, 0x08, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "vmovsd QWORD PTR [rip+0xfffffffffffffff0],xmm8 # 0x10a19" },
+	{ "\xc4\xe1\xff\x11\xc0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovsd ymm0,xmm0,xmm0" },
+	{ "\xc4\x01\xff\x11\x04\xcd\x40\x00\x00\x00", 10, 10, ShvEmulMov, 8, 0x10, 0x08, 0xff, 0x09, 8, 0, 0x40, 0x0, "vmovsd QWORD PTR [r9*8+0x40],xmm8" },
+	{ "\xc4\xa1\xff\x11\x45\x08", 6, 6, ShvEmulMov, 8, 0x10, 0x00, 0x05, 0xff, 0, 0, 0x8, 0x0, "vmovsd QWORD PTR [rbp+0x8],xmm0" },
+	{ "\xc4\x41\xff\x11\x04\xcd\x40\x00\x00\x00", 10, 10, ShvEmulMov, 8, 0x10, 0x08, 0xff, 0x01, 8, 0, 0x40, 0x0, "vmovsd QWORD PTR [rcx*8+0x40],xmm8" },
+	{ "\xc4\xe1\x71\x11\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc5\x80\x11\x00", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe2\x79\x11\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe3\x79\x11\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x66\xc5\xf9\x11\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 vmovupd XMMWORD PTR [rax],xmm0" },
+	{ "\xf3\xc5\xf9\x11\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz vmovupd XMMWORD PTR [rax],xmm0" },
+	{ "\xf0\xc5\xf9\x11\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock vmovupd XMMWORD PTR [rax],xmm0" },
+	{ "\x48\xc5\xf9\x11\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W vmovupd XMMWORD PTR [rax],xmm0" },
+	{ "\x64\xc5\xf9\x11\x00", 5, 5, ShvEmulMov, 16, 0x10, 0x00, 0x00, 0xff, 0, 1, 0x0, 0x0, "vmovupd XMMWORD PTR fs:[rax],xmm0" },
+	{ "\x67\xc5\xf9\x11\x00", 5, 5, ShvEmulMov, 16, 0x18, 0x00, 0x00, 0xff, 0, 0, 0x0, 0x0, "vmovupd XMMWORD PTR [eax],xmm0" },
+	{ "\x2e\xc5\xf9\x11\x00", 5, 5, ShvEmulMov, 16, 0x10, 0x00, 0x00, 0xff, 0, 0, 0x0, 0x0, "cs vmovupd XMMWORD PTR [rax],xmm0" },
+	{ "\xc5\xf8\x13\x03", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovlps QWORD PTR [rbx],xmm0" },
+	{ "\xc4\x01\x78\x13\x04\x25\x78\x56\x34\x12", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovlps QWORD PTR [r12*1+0x12345678],xmm8" },
+	{ "\xc4\xa1\x78\x13\x04\x24", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovlps QWORD PTR [rsp+r12*1],xmm0" },
+	{ "\xc4\x41\x78\x13\xc0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xf8\x13\xd7", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xf8\x13\x03", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovlps QWORD PTR [r11],xmm8" },
+	{ "\xc4\xa1\xf8\x13\x04\xa0", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovlps QWORD PTR [rax+r12*4],xmm0" },
+	{ "\xc4\x41\xf8\x13\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovlps QWORD PTR [r8],xmm8" },
+	{ "\xc4\xe1\x7c\x13\x41\x80", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7c\x13\x04\x1d\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7c\x13\x81\x00\x10\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7c\x13\x07", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xfc\x13\x04\x25\xf0\xff\xff\xff", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xfc\x13\xc0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xfc\x13\xc0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xfc\x13\xc0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\x79\x13\x05\x10\x00\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovlpd QWORD PTR [rip+0x10],xmm0 # 0x10e39" },
+	{ "\xc4\x01\x79\x13\x44\x5d\xf8", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovlpd QWORD PTR [r13+r11*2-0x8],xmm8" },
+	{ "\xc4\xa1\x79\x13\x41\x80", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovlpd QWORD PTR [rcx-0x80],xmm0" },
+	{ "\xc4\x41\x79\x13\xd7", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xf9\x13\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovlpd QWORD PTR [rax],xmm0" },
+	{ "\xc4\x01\xf9\x13\x04\x24", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovlpd QWORD PTR [r12+r12*1],xmm8" },
+	{ "\xc4\xa1\xf9\x13\x04\x65\x00\x10\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovlpd QWORD PTR [r12*2+0x1000],xmm0" },
+	{ "\xc4\x41\xf9\x13\x07", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovlpd QWORD PTR [r15],xmm8" },
+	{ "\xc4\xe1\x7d\x13\x04\x25\x78\x56\x34\x12", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7d\x13\x04\x20", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7d\x13\x44\x24\x10", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7d\x13\x04\x25\x78\x56\x34\x12", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xfd\x13\x07", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xfd\x13\x06", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xfd\x13\x41\x80", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xfd\x13\x04\x24", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc5\xfa\x13\x05\x10\x00\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7a\x13\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7a\x13\x04\xcd\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7a\x13\x45\x08", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xfa\x13\xd7", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xfa\x13\x40\x7f", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xfa\x13\x04\xa0", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xfa\x13\xc0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\x7e\x13\x41\x80", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7e\x13\xc0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7e\x13\x84\xe5\x44\x33\x22\x11", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7e\x13\x85\x00\x00\x00\x80", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xfe\x13\x05\x10\x00\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xfe\x13\x04\xa0", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xfe\x13\xc0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xfe\x13\x04\x98", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\x7b\x13\x05\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7b\x13\x04\xcd\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7b\x13\xc0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7b\x13\x04\x24", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xfb\x13\x44\x5d\xf8", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xfb\x13\x04\x25\xf0\xff\xff\xff", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xfb\x13\x05\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xfb\x13\x84\xe5\x44\x33\x22\x11", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\x7f\x13\x05\x10\x00\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7f\x13\x40\x7f", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7f\x13\x03", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7f\x13\xc0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xff\x13\x44\x24\x10", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xff\x13\x40\x7f", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xff\x13\x45\x08", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xff\x13\x07", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\x71\x13\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc5\x80\x13\x00", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe2\x79\x13\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vcvtph2ps xmm0,QWORD PTR [rax]" },
+	{ "\xc4\xe3\x79\x13\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x66\xc5\xf9\x13\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 vmovlpd QWORD PTR [rax],xmm0" },
+	{ "\xf3\xc5\xf9\x13\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz vmovlpd QWORD PTR [rax],xmm0" },
+	{ "\xf0\xc5\xf9\x13\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock vmovlpd QWORD PTR [rax],xmm0" },
+	{ "\x48\xc5\xf9\x13\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W vmovlpd QWORD PTR [rax],xmm0" },
+	{ "\x64\xc5\xf9\x13\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovlpd QWORD PTR fs:[rax],xmm0" },
+	{ "\x67\xc5\xf9\x13\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovlpd QWORD PTR [eax],xmm0" },
+	{ "\x2e\xc5\xf9\x13\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs vmovlpd QWORD PTR [rax],xmm0" },
+	{ "\xc4\xe1\x78\x29\x04\x25\x78\x56\x34\x12", 10, 10, ShvEmulMov, 16, 0x10, 0x00, 0xff, 0xff, 0, 0, 0x12345678, 0x0, "vmovaps XMMWORD PTR ds:0x12345678,xmm0" },
+	{ "\xc4\x01\x78\x29\x44\x5d\xf8", 7, 7, ShvEmulMov, 16, 0x10, 0x08, 0x0d, 0x0b, 2, 0, 0xfffffffffffffff8, 0x0, "vmovaps XMMWORD PTR [r13+r11*2-0x8],xmm8" },
+	{ "\xc4\xa1\x78\x29\x04\x98", 6, 6, ShvEmulMov, 16, 0x10, 0x00, 0x00, 0x0b, 4, 0, 0x0, 0x0, "vmovaps XMMWORD PTR [rax+r11*4],xmm0" },
+	{ "\xc4\x41\x78\x29\x44\x5d\xf8", 7, 7, ShvEmulMov, 16, 0x10, 0x08, 0x0d, 0x03, 2, 0, 0xfffffffffffffff8, 0x0, "vmovaps XMMWORD PTR [r13+rbx*2-0x8],xmm8" },
+	{ "\xc4\xe1\xf8\x29\xd7", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovaps xmm7,xmm2" },
+	{ "\xc4\x01\xf8\x29\x05\xf0\xff\xff\xff", 9, 9, ShvEmulMov, 16, 0x10, 0x08, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "vmovaps XMMWORD PTR [rip+0xfffffffffffffff0],xmm8 # 0x11619" },
+	{ "\xc4\xa1\xf8\x29\x04\x25\xf0\xff\xff\xff", 10, 10, ShvEmulMov, 16, 0x10, 0x00, 0xff, 0x0c, 1, 0, 0xfffffffffffffff0, 0x0, "vmovaps XMMWORD PTR [r12*1-0x10],xmm0" },
+	{ "\xc4\x41\xf8\x29\x04\x1d\x40\x00\x00\x00", 10, 10, ShvEmulMov, 16, 0x10, 0x08, 0xff, 0x03, 1, 0, 0x40, 0x0, "vmovaps XMMWORD PTR [rbx*1+0x40],xmm8" },
+	{ "\xc4\xe1\x7c\x29\x81\x00\x10\x00\x00", 9, 9, ShvEmulMov, 32, 0x10, 0x00, 0x01, 0xff, 0, 0, 0x1000, 0x0, "vmovaps YMMWORD PTR [rcx+0x1000],ymm0" },
+	{ "\xc4\x01\x7c\x29\x04\x65\x00\x10\x00\x00", 10, 10, ShvEmulMov, 32, 0x10, 0x08, 0xff, 0x0c, 2, 0, 0x1000, 0x0, "vmovaps YMMWORD PTR [r12*2+0x1000],ymm8" },
+	{ "\xc4\xa1\x7c\x29\x81\x00\x10\x00\x00", 9, 9, ShvEmulMov, 32, 0x10, 0x00, 0x01, 0xff, 0, 0, 0x1000, 0x0, "vmovaps YMMWORD PTR [rcx+0x1000],ymm0" },
+	{ "\xc4\x41\x7c\x29\x04\xa0", 6, 6, ShvEmulMov, 32, 0x10, 0x08, 0x08, 0xff, 0, 0, 0x0, 0x0, "vmovaps YMMWORD PTR [r8+riz*4],ymm8" },
+	{ "\xc4\xe1\xfc\x29\x04\x24", 6, 6, ShvEmulMov, 32, 0x10, 0x00, 0x04, 0xff, 0, 0, 0x0, 0x0, "vmovaps YMMWORD PTR [rsp],ymm0" },
+	{ "\xc4\x01\xfc\x29\x45\x08", 6, 6, ShvEmulMov, 32, 0x10, 0x08, 0x0d, 0xff, 0, 0, 0x8, 0x0, "vmovaps YMMWORD PTR [r13+0x8],ymm8" },
+	{ "\xc4\xa1\xfc\x29\x45\x08", 6, 6, ShvEmulMov, 32, 0x10, 0x00, 0x05, 0xff, 0, 0, 0x8, 0x0, "vmovaps YMMWORD PTR [rbp+0x8],ymm0" },
+	{ "\xc4\x41\xfc\x29\x85\x00\x00\x00\x80", 9, 9, ShvEmulMov, 32, 0x10, 0x08, 0x0d, 0xff, 0, 0, 0xffffffff80000000, 0x0, "vmovaps YMMWORD PTR [r13-0x80000000],ymm8" },
+	{ "\xc4\xe1\x79\x29\x04\x25\xf0\xff\xff\xff", 10, 10, ShvEmulMov, 16, 0x10, 0x00, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "vmovapd XMMWORD PTR ds:0xfffffffffffffff0,xmm0" },
+	{ "\xc4\x01\x79\x29\x04\x25\xf0\xff\xff\xff", 10, 10, ShvEmulMov, 16, 0x10, 0x08, 0xff, 0x0c, 1, 0, 0xfffffffffffffff0, 0x0, "vmovapd XMMWORD PTR [r12*1-0x10],xmm8" },
+	{ "\xc4\xa1\x79\x29\x04\x20", 6, 6, ShvEmulMov, 16, 0x10, 0x00, 0x00, 0x0c, 1, 0, 0x0, 0x0, "vmovapd XMMWORD PTR [rax+r12*1],xmm0" },
+	{ "\xc4\x41\x79\x29\x85\x00\x00\x00\x80", 9, 9, ShvEmulMov, 16, 0x10, 0x08, 0x0d, 0xff, 0, 0, 0xffffffff80000000, 0x0, "vmovapd XMMWORD PTR [r13-0x80000000],xmm8" },
+	{ "\xc4\xe1\xf9\x29\xd7", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovapd xmm7,xmm2" },
+	{ "\xc4\x01\xf9\x29\x81\x00\x10\x00\x00", 9, 9, ShvEmulMov, 16, 0x10, 0x08, 0x09, 0xff, 0, 0, 0x1000, 0x0, "vmovapd XMMWORD PTR [r9+0x1000],xmm8" },
+	{ "\xc4\xa1\xf9\x29\x04\x25\xf0\xff\xff\xff", 10, 10, ShvEmulMov, 16, 0x10, 0x00, 0xff, 0x0c, 1, 0, 0xfffffffffffffff0, 0x0, "vmovapd XMMWORD PTR [r12*1-0x10],xmm0" },
+	{ "\xc4\x41\xf9\x29\x41\x80", 6, 6, ShvEmulMov, 16, 0x10, 0x08, 0x09, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "vmovapd XMMWORD PTR [r9-0x80],xmm8" },
+	{ "\xc4\xe1\x7d\x29\xc0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovapd ymm0,ymm0" },
+	{ "\xc4\x01\x7d\x29\x85\x00\x00\x00\x80", 9, 9, ShvEmulMov, 32, 0x10, 0x08, 0x0d, 0xff, 0, 0, 0xffffffff80000000, 0x0, "vmovapd YMMWORD PTR [r13-0x80000000],ymm8" },
+	{ "\xc4\xa1\x7d\x29\x04\x25\xf0\xff\xff\xff", 10, 10, ShvEmulMov, 32, 0x10, 0x00, 0xff, 0x0c, 1, 0, 0xfffffffffffffff0, 0x0, "vmovapd YMMWORD PTR [r12*1-0x10],ymm0" },
+	{ "\xc4\x41\x7d\x29\x84\xe5\x44\x33\x22\x11", 10, 10, ShvEmulMov, 32, 0x10, 0x08, 0x0d, 0xff, 0, 0, 0x11223344, 0x0, "vmovapd YMMWORD PTR [r13+riz*8+0x11223344],ymm8" },
+	{ "\xc4\xe1\xfd\x29\x45\x08", 6, 6, ShvEmulMov, 32, 0x10, 0x00, 0x05, 0xff, 0, 0, 0x8, 0x0, "vmovapd YMMWORD PTR [rbp+0x8],ymm0" },
+	{ "\xc4\x01\xfd\x29\x04\xcd\x40\x00\x00\x00", 10, 10, ShvEmulMov, 32, 0x10, 0x08, 0xff, 0x09, 8, 0, 0x40, 0x0, "vmovapd YMMWORD PTR [r9*8+0x40],ymm8" },
+	{ "\xc4\xa1\xfd\x29\x07", 5, 5, ShvEmulMov, 32, 0x10, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "vmovapd YMMWORD PTR [rdi],ymm0" },
+	{ "\xc4\x41\xfd\x29\x04\x1d\x40\x00\x00\x00", 10, 10, ShvEmulMov, 32, 0x10, 0x08, 0xff, 0x03, 1, 0, 0x40, 0x0, "vmovapd YMMWORD PTR [rbx*1+0x40],ymm8" },
+	{ "\xc5\xfa\x29\x04\x25\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7a\x29\x04\x24", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7a\x29\x44\x24\x10", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7a\x29\x04\x20", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xfa\x29\x07", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xfa\x29\x04\xa0", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xfa\x29\x40\x7f", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xfa\x29\x04\xa0", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\x7e\x29\x05\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7e\x29\x04\x65\x00\x10\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7e\x29\x07", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7e\x29\x04\x24", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xfe\x29\x41\x80", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xfe\x29\x85\x00\x00\x00\x80", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xfe\x29\x41\x80", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xfe\x29\x84\xe5\x44\x33\x22\x11", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\x7b\x29\xd7", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7b\x29\x04\x24", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7b\x29\x04\x65\x00\x10\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7b\x29\x05\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xfb\x29\x85\x00\x00\x00\x80", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xfb\x29\x41\x80", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xfb\x29\x04\x65\x00\x10\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xfb\x29\x04\x1d\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\x7f\x29\x04\x24", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7f\x29\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7f\x29\x05\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7f\x29\x04\x24", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xff\x29\x44\x5d\xf8", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xff\x29\x05\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xff\x29\x04\x1d\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xff\x29\xc0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\x71\x29\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc5\x80\x29\x00", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe2\x79\x29\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vpcmpeqq xmm0,xmm0,XMMWORD PTR [rax]" },
+	{ "\xc4\xe3\x79\x29\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x66\xc5\xf9\x29\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 vmovapd XMMWORD PTR [rax],xmm0" },
+	{ "\xf3\xc5\xf9\x29\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz vmovapd XMMWORD PTR [rax],xmm0" },
+	{ "\xf0\xc5\xf9\x29\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock vmovapd XMMWORD PTR [rax],xmm0" },
+	{ "\x48\xc5\xf9\x29\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W vmovapd XMMWORD PTR [rax],xmm0" },
+	{ "\x64\xc5\xf9\x29\x00", 5, 5, ShvEmulMov, 16, 0x10, 0x00, 0x00, 0xff, 0, 1, 0x0, 0x0, "vmovapd XMMWORD PTR fs:[rax],xmm0" },
+	{ "\x67\xc5\xf9\x29\x00", 5, 5, ShvEmulMov, 16, 0x18, 0x00, 0x00, 0xff, 0, 0, 0x0, 0x0, "vmovapd XMMWORD PTR [eax],xmm0" },
+	{ "\x2e\xc5\xf9\x29\x00", 5, 5, ShvEmulMov, 16, 0x10, 0x00, 0x00, 0xff, 0, 0, 0x0, 0x0, "cs vmovapd XMMWORD PTR [rax],xmm0" },
+	{ "\xc4\xe1\x78\x2b\x04\x25\xf0\xff\xff\xff", 10, 10, ShvEmulMov, 16, 0x10, 0x00, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "vmovntps XMMWORD PTR ds:0xfffffffffffffff0,xmm0" },
+	{ "\xc4\x01\x78\x2b\x05\x10\x00\x00\x00", 9, 9, ShvEmulMov, 16, 0x10, 0x08, 0x10, 0xff, 0, 0, 0x10, 0x0, "vmovntps XMMWORD PTR [rip+0x10],xmm8 # 0x11f19" },
+	{ "\xc4\xa1\x78\x2b\x04\x25\x78\x56\x34\x12", 10, 10, ShvEmulMov, 16, 0x10, 0x00, 0xff, 0x0c, 1, 0, 0x12345678, 0x0, "vmovntps XMMWORD PTR [r12*1+0x12345678],xmm0" },
+	{ "\xc4\x41\x78\x2b\x85\x00\x00\x00\x80", 9, 9, ShvEmulMov, 16, 0x10, 0x08, 0x0d, 0xff, 0, 0, 0xffffffff80000000, 0x0, "vmovntps XMMWORD PTR [r13-0x80000000],xmm8" },
+	{ "\xc4\xe1\xf8\x2b\x04\x24", 6, 6, ShvEmulMov, 16, 0x10, 0x00, 0x04, 0xff, 0, 0, 0x0, 0x0, "vmovntps XMMWORD PTR [rsp],xmm0" },
+	{ "\xc4\x01\xf8\x2b\x44\x24\x10", 7, 7, ShvEmulMov, 16, 0x10, 0x08, 0x0c, 0x0c, 1, 0, 0x10, 0x0, "vmovntps XMMWORD PTR [r12+r12*1+0x10],xmm8" },
+	{ "\xc4\xa1\xf8\x2b\xc0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xf8\x2b\x04\x1d\x40\x00\x00\x00", 10, 10, ShvEmulMov, 16, 0x10, 0x08, 0xff, 0x03, 1, 0, 0x40, 0x0, "vmovntps XMMWORD PTR [rbx*1+0x40],xmm8" },
+	{ "\xc4\xe1\x7c\x2b\x04\x98", 6, 6, ShvEmulMov, 32, 0x10, 0x00, 0x00, 0x03, 4, 0, 0x0, 0x0, "vmovntps YMMWORD PTR [rax+rbx*4],ymm0" },
+	{ "\xc4\x01\x7c\x2b\x04\x1d\x40\x00\x00\x00", 10, 10, ShvEmulMov, 32, 0x10, 0x08, 0xff, 0x0b, 1, 0, 0x40, 0x0, "vmovntps YMMWORD PTR [r11*1+0x40],ymm8" },
+	{ "\xc4\xa1\x7c\x2b\x04\x65\x00\x10\x00\x00", 10, 10, ShvEmulMov, 32, 0x10, 0x00, 0xff, 0x0c, 2, 0, 0x1000, 0x0, "vmovntps YMMWORD PTR [r12*2+0x1000],ymm0" },
+	{ "\xc4\x41\x7c\x2b\x07", 5, 5, ShvEmulMov, 32, 0x10, 0x08, 0x0f, 0xff, 0, 0, 0x0, 0x0, "vmovntps YMMWORD PTR [r15],ymm8" },
+	{ "\xc4\xe1\xfc\x2b\x84\xe5\x44\x33\x22\x11", 10, 10, ShvEmulMov, 32, 0x10, 0x00, 0x05, 0xff, 0, 0, 0x11223344, 0x0, "vmovntps YMMWORD PTR [rbp+riz*8+0x11223344],ymm0" },
+	{ "\xc4\x01\xfc\x2b\x07", 5, 5, ShvEmulMov, 32, 0x10, 0x08, 0x0f, 0xff, 0, 0, 0x0, 0x0, "vmovntps YMMWORD PTR [r15],ymm8" },
+	{ "\xc4\xa1\xfc\x2b\x04\x20", 6, 6, ShvEmulMov, 32, 0x10, 0x00, 0x00, 0x0c, 1, 0, 0x0, 0x0, "vmovntps YMMWORD PTR [rax+r12*1],ymm0" },
+	{ "\xc4\x41\xfc\x2b\x84\xe5\x44\x33\x22\x11", 10, 10, ShvEmulMov, 32, 0x10, 0x08, 0x0d, 0xff, 0, 0, 0x11223344, 0x0, "vmovntps YMMWORD PTR [r13+riz*8+0x11223344],ymm8" },
+	{ "\xc5\xf9\x2b\x04\x24", 5, 5, ShvEmulMov, 16, 0x10, 0x00, 0x04, 0xff, 0, 0, 0x0, 0x0, "vmovntpd XMMWORD PTR [rsp],xmm0" },
+	{ "\xc4\x01\x79\x2b\x81\x00\x10\x00\x00", 9, 9, ShvEmulMov, 16, 0x10, 0x08, 0x09, 0xff, 0, 0, 0x1000, 0x0, "vmovntpd XMMWORD PTR [r9+0x1000],xmm8" },
+	{ "\xc4\xa1\x79\x2b\x03", 5, 5, ShvEmulMov, 16, 0x10, 0x00, 0x03, 0xff, 0, 0, 0x0, 0x0, "vmovntpd XMMWORD PTR [rbx],xmm0" },
+	{ "\xc4\x41\x79\x2b\x00", 5, 5, ShvEmulMov, 16, 0x10, 0x08, 0x08, 0xff, 0, 0, 0x0, 0x0, "vmovntpd XMMWORD PTR [r8],xmm8" },
+	{ "\xc4\xe1\xf9\x2b\x41\x80", 6, 6, ShvEmulMov, 16, 0x10, 0x00, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "vmovntpd XMMWORD PTR [rcx-0x80],xmm0" },
+	{ "\xc4\x01\xf9\x2b\x05\xf0\xff\xff\xff", 9, 9, ShvEmulMov, 16, 0x10, 0x08, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "vmovntpd XMMWORD PTR [rip+0xfffffffffffffff0],xmm8 # 0x12179" },
+	{ "\xc4\xa1\xf9\x2b\x04\x20", 6, 6, ShvEmulMov, 16, 0x10, 0x00, 0x00, 0x0c, 1, 0, 0x0, 0x0, "vmovntpd XMMWORD PTR [rax+r12*1],xmm0" },
+	{ "\xc4\x41\xf9\x2b\x40\x7f", 6, 6, ShvEmulMov, 16, 0x10, 0x08, 0x08, 0xff, 0, 0, 0x7f, 0x0, "vmovntpd XMMWORD PTR [r8+0x7f],xmm8" },
+	{ "\xc4\xe1\x7d\x2b\x44\x24\x10", 7, 7, ShvEmulMov, 32, 0x10, 0x00, 0x04, 0xff, 0, 0, 0x10, 0x0, "vmovntpd YMMWORD PTR [rsp+0x10],ymm0" },
+	{ "\xc4\x01\x7d\x2b\x40\x7f", 6, 6, ShvEmulMov, 32, 0x10, 0x08, 0x08, 0xff, 0, 0, 0x7f, 0x0, "vmovntpd YMMWORD PTR [r8+0x7f],ymm8" },
+	{ "\xc4\xa1\x7d\x2b\x04\x65\x00\x10\x00\x00", 10, 10, ShvEmulMov, 32, 0x10, 0x00, 0xff, 0x0c, 2, 0, 0x1000, 0x0, "vmovntpd YMMWORD PTR [r12*2+0x1000],ymm0" },
+	{ "\xc4\x41\x7d\x2b\x04\x24", 6, 6, ShvEmulMov, 32, 0x10, 0x08, 0x0c, 0xff, 0, 0, 0x0, 0x0, "vmovntpd YMMWORD PTR [r12],ymm8" },
+	{ "\xc4\xe1\xfd\x2b\x00", 5, 5, ShvEmulMov, 32, 0x10, 0x00, 0x00, 0xff, 0, 0, 0x0, 0x0, "vmovntpd YMMWORD PTR [rax],ymm0" },
+	{ "\xc4\x01\xfd\x2b\xc0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xfd\x2b\x45\x08", 6, 6, ShvEmulMov, 32, 0x10, 0x00, 0x05, 0xff, 0, 0, 0x8, 0x0, "vmovntpd YMMWORD PTR [rbp+0x8],ymm0" },
+	{ "\xc4\x41\xfd\x2b\x04\x65\x00\x10\x00\x00", 10, 10, ShvEmulMov, 32, 0x10, 0x08, 0xff, 0xff, 0, 0, 0x1000, 0x0, "vmovntpd YMMWORD PTR [riz*2+0x1000],ymm8" },
+	{ "\xc4\xe1\x7a\x2b\x03", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7a\x2b\x04\x25\x78\x56\x34\x12", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7a\x2b\x04\x24", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7a\x2b\x40\x7f", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xfa\x2b\x04\x98", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xfa\x2b\x44\x24\x10", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xfa\x2b\x41\x80", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xfa\x2b\x04\x1d\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\x7e\x2b\x04\xcd\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7e\x2b\xd7", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7e\x2b\x45\x08", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7e\x2b\x04\x98", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xfe\x2b\x04\x65\x00\x10\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xfe\x2b\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xfe\x2b\x05\x10\x00\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xfe\x2b\xd7", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\x7b\x2b\x45\x08", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7b\x2b\x45\x08", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7b\x2b\x45\x08", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7b\x2b\x40\x7f", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xfb\x2b\x04\x25\xf0\xff\xff\xff", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xfb\x2b\x04\x24", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xfb\x2b\xd7", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xfb\x2b\x81\x00\x10\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\x7f\x2b\x04\x20", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7f\x2b\x84\xe5\x44\x33\x22\x11", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7f\x2b\x07", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7f\x2b\x81\x00\x10\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xff\x2b\x05\x10\x00\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xff\x2b\x04\x24", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xff\x2b\x07", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xff\x2b\x85\x00\x00\x00\x80", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\x71\x2b\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc5\x80\x2b\x00", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe2\x79\x2b\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vpackusdw xmm0,xmm0,XMMWORD PTR [rax]" },
+	{ "\xc4\xe3\x79\x2b\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x66\xc5\xf9\x2b\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 vmovntpd XMMWORD PTR [rax],xmm0" },
+	{ "\xf3\xc5\xf9\x2b\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz vmovntpd XMMWORD PTR [rax],xmm0" },
+	{ "\xf0\xc5\xf9\x2b\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock vmovntpd XMMWORD PTR [rax],xmm0" },
+	{ "\x48\xc5\xf9\x2b\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W vmovntpd XMMWORD PTR [rax],xmm0" },
+	{ "\x64\xc5\xf9\x2b\x00", 5, 5, ShvEmulMov, 16, 0x10, 0x00, 0x00, 0xff, 0, 1, 0x0, 0x0, "vmovntpd XMMWORD PTR fs:[rax],xmm0" },
+	{ "\x67\xc5\xf9\x2b\x00", 5, 5, ShvEmulMov, 16, 0x18, 0x00, 0x00, 0xff, 0, 0, 0x0, 0x0, "vmovntpd XMMWORD PTR [eax],xmm0" },
+	{ "\x2e\xc5\xf9\x2b\x00", 5, 5, ShvEmulMov, 16, 0x10, 0x00, 0x00, 0xff, 0, 0, 0x0, 0x0, "cs vmovntpd XMMWORD PTR [rax],xmm0" },
+	{ "\xc4\xe1\x78\x6f\x07", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x78\x6f\x07", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x78\x6f\xc0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x78\x6f\x81\x00\x10\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xf8\x6f\x05\x10\x00\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xf8\x6f\x04\x25\x78\x56\x34\x12", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xf8\x6f\x03", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xf8\x6f\x04\x98", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\x7c\x6f\x45\x08", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7c\x6f\x41\x80", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7c\x6f\x81\x00\x10\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7c\x6f\x45\x08", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xfc\x6f\x04\x98", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xfc\x6f\x06", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xfc\x6f\x04\x1d\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xfc\x6f\x04\x1d\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc5\xf9\x6f\x05\x10\x00\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovdqa xmm0,XMMWORD PTR [rip+0x10] # 0x12a58" },
+	{ "\xc4\x01\x79\x6f\x85\x00\x00\x00\x80", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovdqa xmm8,XMMWORD PTR [r13-0x80000000]" },
+	{ "\xc4\xa1\x79\x6f\x45\x08", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovdqa xmm0,XMMWORD PTR [rbp+0x8]" },
+	{ "\xc4\x41\x79\x6f\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovdqa xmm8,XMMWORD PTR [r8]" },
+	{ "\xc4\xe1\xf9\x6f\xc0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovdqa xmm0,xmm0" },
+	{ "\xc4\x01\xf9\x6f\x05\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovdqa xmm8,XMMWORD PTR [rip+0xfffffffffffffff0] # 0x12ad9" },
+	{ "\xc4\xa1\xf9\x6f\x05\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovdqa xmm0,XMMWORD PTR [rip+0xfffffffffffffff0] # 0x12af9" },
+	{ "\xc4\x41\xf9\x6f\x04\x20", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovdqa xmm8,XMMWORD PTR [r8+riz*1]" },
+	{ "\xc5\xfd\x6f\x41\x80", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovdqa ymm0,YMMWORD PTR [rcx-0x80]" },
+	{ "\xc4\x01\x7d\x6f\x05\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovdqa ymm8,YMMWORD PTR [rip+0xfffffffffffffff0] # 0x12b59" },
+	{ "\xc4\xa1\x7d\x6f\x04\x65\x00\x10\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovdqa ymm0,YMMWORD PTR [r12*2+0x1000]" },
+	{ "\xc4\x41\x7d\x6f\x81\x00\x10\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovdqa ymm8,YMMWORD PTR [r9+0x1000]" },
+	{ "\xc4\xe1\xfd\x6f\x04\x24", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovdqa ymm0,YMMWORD PTR [rsp]" },
+	{ "\xc4\x01\xfd\x6f\x06", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovdqa ymm8,YMMWORD PTR [r14]" },
+	{ "\xc4\xa1\xfd\x6f\x05\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovdqa ymm0,YMMWORD PTR [rip+0xfffffffffffffff0] # 0x12bf9" },
+	{ "\xc4\x41\xfd\x6f\x04\x25\x78\x56\x34\x12", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovdqa ymm8,YMMWORD PTR ds:0x12345678" },
+	{ "\xc5\xfa\x6f\x04\x25\x78\x56\x34\x12", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovdqu xmm0,XMMWORD PTR ds:0x12345678" },
+	{ "\xc4\x01\x7a\x6f\x44\x24\x10", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovdqu xmm8,XMMWORD PTR [r12+r12*1+0x10]" },
+	{ "\xc4\xa1\x7a\x6f\x07", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovdqu xmm0,XMMWORD PTR [rdi]" },
+	{ "\xc4\x41\x7a\x6f\x85\x00\x00\x00\x80", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovdqu xmm8,XMMWORD PTR [r13-0x80000000]" },
+	{ "\xc4\xe1\xfa\x6f\x44\x24\x10", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovdqu xmm0,XMMWORD PTR [rsp+0x10]" },
+	{ "\xc4\x01\xfa\x6f\x44\x5d\xf8", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovdqu xmm8,XMMWORD PTR [r13+r11*2-0x8]" },
+	{ "\xc4\xa1\xfa\x6f\x04\xcd\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovdqu xmm0,XMMWORD PTR [r9*8+0x40]" },
+	{ "\xc4\x41\xfa\x6f\x04\x20", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovdqu xmm8,XMMWORD PTR [r8+riz*1]" },
+	{ "\xc4\xe1\x7e\x6f\x07", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovdqu ymm0,YMMWORD PTR [rdi]" },
+	{ "\xc4\x01\x7e\x6f\xd7", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovdqu ymm10,ymm15" },
+	{ "\xc4\xa1\x7e\x6f\x03", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovdqu ymm0,YMMWORD PTR [rbx]" },
+	{ "\xc4\x41\x7e\x6f\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovdqu ymm8,YMMWORD PTR [r8]" },
+	{ "\xc4\xe1\xfe\x6f\xc0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovdqu ymm0,ymm0" },
+	{ "\xc4\x01\xfe\x6f\x04\x25\x78\x56\x34\x12", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovdqu ymm8,YMMWORD PTR [r12*1+0x12345678]" },
+	{ "\xc4\xa1\xfe\x6f\x05\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovdqu ymm0,YMMWORD PTR [rip+0xfffffffffffffff0] # 0x12df9" },
+	{ "\xc4\x41\xfe\x6f\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovdqu ymm8,YMMWORD PTR [r8]" },
+	{ "\xc4\xe1\x7b\x6f\x40\x7f", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7b\x6f\x04\xa0", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7b\x6f\x04\x24", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7b\x6f\x44\x5d\xf8", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xfb\x6f\x84\xe5\x44\x33\x22\x11", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xfb\x6f\x04\x98", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xfb\x6f\x04\x25\x78\x56\x34\x12", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xfb\x6f\x44\x5d\xf8", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc5\xff\x6f\x05\x10\x00\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7f\x6f\x04\x25\x78\x56\x34\x12", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7f\x6f\x07", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7f\x6f\x04\x20", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xff\x6f\xc0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xff\x6f\x41\x80", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xff\x6f\x04\xcd\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xff\x6f\x04\x1d\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\x71\x6f\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc5\x80\x6f\x00", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe2\x79\x6f\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe3\x79\x6f\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vfmsubsd xmm0,xmm0,QWORD PTR [rax],xmm9" },
+	{ "\x66\xc5\xf9\x6f\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 vmovdqa xmm0,XMMWORD PTR [rax]" },
+	{ "\xf3\xc5\xf9\x6f\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz vmovdqa xmm0,XMMWORD PTR [rax]" },
+	{ "\xf0\xc5\xf9\x6f\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock vmovdqa xmm0,XMMWORD PTR [rax]" },
+	{ "\x48\xc5\xf9\x6f\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W vmovdqa xmm0,XMMWORD PTR [rax]" },
+	{ "\x64\xc5\xf9\x6f\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovdqa xmm0,XMMWORD PTR fs:[rax]" },
+	{ "\x67\xc5\xf9\x6f\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovdqa xmm0,XMMWORD PTR [eax]" },
+	{ "\x2e\xc5\xf9\x6f\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs vmovdqa xmm0,XMMWORD PTR [rax]" },
+	{ "\xc4\xe1\x78\x7e\x40\x7f", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x78\x7e\x05\x10\x00\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x78\x7e\x44\x24\x10", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x78\x7e\x45\x08", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xf8\x7e\x84\xe5\x44\x33\x22\x11", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xf8\x7e\x04\xa0", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xf8\x7e\x04\xa0", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xf8\x7e\x41\x80", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\x7c\x7e\x06", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7c\x7e\x05\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7c\x7e\x04\x98", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7c\x7e\x04\x25\xf0\xff\xff\xff", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xfc\x7e\x04\x1d\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xfc\x7e\x05\x10\x00\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xfc\x7e\xc0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xfc\x7e\x81\x00\x10\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc5\xf9\x7e\x04\x25\xf0\xff\xff\xff", 9, 9, ShvEmulMov, 4, 0x10, 0x00, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "vmovd DWORD PTR ds:0xfffffffffffffff0,xmm0" },
+	{ "\xc4\x01\x79\x7e\x05\xf0\xff\xff\xff", 9, 9, ShvEmulMov, 4, 0x10, 0x08, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "vmovd DWORD PTR [rip+0xfffffffffffffff0],xmm8 # 0x133b9" },
+	{ "\xc4\xa1\x79\x7e\x04\x24", 6, 6, ShvEmulMov, 4, 0x10, 0x00, 0x04, 0x0c, 1, 0, 0x0, 0x0, "vmovd DWORD PTR [rsp+r12*1],xmm0" },
+	{ "\xc4\x41\x79\x7e\x06", 5, 5, ShvEmulMov, 4, 0x10, 0x08, 0x0e, 0xff, 0, 0, 0x0, 0x0, "vmovd DWORD PTR [r14],xmm8" },
+	{ "\xc4\xe1\xf9\x7e\x41\x80", 6, 6, ShvEmulMov, 8, 0x10, 0x00, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "vmovq QWORD PTR [rcx-0x80],xmm0" },
+	{ "\xc4\x01\xf9\x7e\x04\xcd\x40\x00\x00\x00", 10, 10, ShvEmulMov, 8, 0x10, 0x08, 0xff, 0x09, 8, 0, 0x40, 0x0, "vmovq QWORD PTR [r9*8+0x40],xmm8" },
+	{ "\xc4\xa1\xf9\x7e\xd7", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovq rdi,xmm2" },
+	{ "\xc4\x41\xf9\x7e\x04\x65\x00\x10\x00\x00", 10, 10, ShvEmulMov, 8, 0x10, 0x08, 0xff, 0xff, 0, 0, 0x1000, 0x0, "vmovq QWORD PTR [riz*2+0x1000],xmm8" },
+	{ "\xc5\xfd\x7e\x81\x00\x10\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7d\x7e\x04\x65\x00\x10\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7d\x7e\x85\x00\x00\x00\x80", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7d\x7e\x05\x10\x00\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xfd\x7e\x04\x25\x78\x56\x34\x12", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xfd\x7e\x06", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xfd\x7e\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xfd\x7e\x44\x5d\xf8", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\x7a\x7e\xd7", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovq xmm2,xmm7" },
+	{ "\xc4\x01\x7a\x7e\x04\xa0", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovq xmm8,QWORD PTR [r8+r12*4]" },
+	{ "\xc4\xa1\x7a\x7e\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovq xmm0,QWORD PTR [rax]" },
+	{ "\xc4\x41\x7a\x7e\x04\x65\x00\x10\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovq xmm8,QWORD PTR [riz*2+0x1000]" },
+	{ "\xc4\xe1\xfa\x7e\x06", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovq xmm0,QWORD PTR [rsi]" },
+	{ "\xc4\x01\xfa\x7e\x03", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovq xmm8,QWORD PTR [r11]" },
+	{ "\xc4\xa1\xfa\x7e\x07", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovq xmm0,QWORD PTR [rdi]" },
+	{ "\xc4\x41\xfa\x7e\x84\xe5\x44\x33\x22\x11", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovq xmm8,QWORD PTR [r13+riz*8+0x11223344]" },
+	{ "\xc4\xe1\x7e\x7e\xd7", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7e\x7e\x04\xa0", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7e\x7e\x04\x1d\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7e\x7e\x04\x25\xf0\xff\xff\xff", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xfe\x7e\x05\x10\x00\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xfe\x7e\x45\x08", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xfe\x7e\x85\x00\x00\x00\x80", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xfe\x7e\x04\x65\x00\x10\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc5\xfb\x7e\x05\xf0\xff\xff\xff", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7b\x7e\x03", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7b\x7e\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7b\x7e\x04\x25\xf0\xff\xff\xff", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xfb\x7e\xd7", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xfb\x7e\x04\x1d\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xfb\x7e\x04\x1d\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xfb\x7e\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\x7f\x7e\xc0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7f\x7e\x03", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7f\x7e\x04\xa0", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7f\x7e\x04\x20", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xff\x7e\x04\x65\x00\x10\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xff\x7e\x04\x25\x78\x56\x34\x12", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xff\x7e\x05\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xff\x7e\x04\x24", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\x71\x7e\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc5\x80\x7e\x00", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe2\x79\x7e\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe3\x79\x7e\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vfnmsubss xmm0,xmm0,DWORD PTR [rax],xmm9" },
+	{ "\x66\xc5\xf9\x7e\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 vmovd DWORD PTR [rax],xmm0" },
+	{ "\xf3\xc5\xf9\x7e\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz vmovd DWORD PTR [rax],xmm0" },
+	{ "\xf0\xc5\xf9\x7e\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock vmovd DWORD PTR [rax],xmm0" },
+	{ "\x48\xc5\xf9\x7e\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W vmovd DWORD PTR [rax],xmm0" },
+	{ "\x64\xc5\xf9\x7e\x00", 5, 5, ShvEmulMov, 4, 0x10, 0x00, 0x00, 0xff, 0, 1, 0x0, 0x0, "vmovd DWORD PTR fs:[rax],xmm0" },
+	{ "\x67\xc5\xf9\x7e\x00", 5, 5, ShvEmulMov, 4, 0x18, 0x00, 0x00, 0xff, 0, 0, 0x0, 0x0, "vmovd DWORD PTR [eax],xmm0" },
+	{ "\x2e\xc5\xf9\x7e\x00", 5, 5, ShvEmulMov, 4, 0x10, 0x00, 0x00, 0xff, 0, 0, 0x0, 0x0, "cs vmovd DWORD PTR [rax],xmm0" },
+	{ "\xc5\xf8\x7f\x05\xf0\xff\xff\xff", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x78\x7f\x04\x24", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x78\x7f\x04\x25\x78\x56\x34\x12", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x78\x7f\x05\x10\x00\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xf8\x7f\x41\x80", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xf8\x7f\x04\x1d\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xf8\x7f\xd7", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xf8\x7f\x03", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc5\xfc\x7f\x04\x25\x78\x56\x34\x12", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7c\x7f\x40\x7f", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7c\x7f\x04\x25\x78\x56\x34\x12", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7c\x7f\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xfc\x7f\x07", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xfc\x7f\x85\x00\x00\x00\x80", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xfc\x7f\x04\x65\x00\x10\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xfc\x7f\x84\xe5\x44\x33\x22\x11", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\x79\x7f\x03", 5, 5, ShvEmulMov, 16, 0x10, 0x00, 0x03, 0xff, 0, 0, 0x0, 0x0, "vmovdqa XMMWORD PTR [rbx],xmm0" },
+	{ "\xc4\x01\x79\x7f\x41\x80", 6, 6, ShvEmulMov, 16, 0x10, 0x08, 0x09, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "vmovdqa XMMWORD PTR [r9-0x80],xmm8" },
+	{ "\xc4\xa1\x79\x7f\x04\x65\x00\x10\x00\x00", 10, 10, ShvEmulMov, 16, 0x10, 0x00, 0xff, 0x0c, 2, 0, 0x1000, 0x0, "vmovdqa XMMWORD PTR [r12*2+0x1000],xmm0" },
+	{ "\xc4\x41\x79\x7f\x40\x7f", 6, 6, ShvEmulMov, 16, 0x10, 0x08, 0x08, 0xff, 0, 0, 0x7f, 0x0, "vmovdqa XMMWORD PTR [r8+0x7f],xmm8" },
+	{ "\xc4\xe1\xf9\x7f\x85\x00\x00\x00\x80", 9, 9, ShvEmulMov, 16, 0x10, 0x00, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x0, "vmovdqa XMMWORD PTR [rbp-0x80000000],xmm0" },
+	{ "\xc4\x01\xf9\x7f\x00", 5, 5, ShvEmulMov, 16, 0x10, 0x08, 0x08, 0xff, 0, 0, 0x0, 0x0, "vmovdqa XMMWORD PTR [r8],xmm8" },
+	{ "\xc4\xa1\xf9\x7f\x85\x00\x00\x00\x80", 9, 9, ShvEmulMov, 16, 0x10, 0x00, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x0, "vmovdqa XMMWORD PTR [rbp-0x80000000],xmm0" },
+	{ "\xc4\x41\xf9\x7f\x45\x08", 6, 6, ShvEmulMov, 16, 0x10, 0x08, 0x0d, 0xff, 0, 0, 0x8, 0x0, "vmovdqa XMMWORD PTR [r13+0x8],xmm8" },
+	{ "\xc5\xfd\x7f\x41\x80", 5, 5, ShvEmulMov, 32, 0x10, 0x00, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "vmovdqa YMMWORD PTR [rcx-0x80],ymm0" },
+	{ "\xc4\x01\x7d\x7f\x05\xf0\xff\xff\xff", 9, 9, ShvEmulMov, 32, 0x10, 0x08, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "vmovdqa YMMWORD PTR [rip+0xfffffffffffffff0],ymm8 # 0x13e19" },
+	{ "\xc4\xa1\x7d\x7f\x05\x10\x00\x00\x00", 9, 9, ShvEmulMov, 32, 0x10, 0x00, 0x10, 0xff, 0, 0, 0x10, 0x0, "vmovdqa YMMWORD PTR [rip+0x10],ymm0 # 0x13e59" },
+	{ "\xc4\x41\x7d\x7f\x85\x00\x00\x00\x80", 9, 9, ShvEmulMov, 32, 0x10, 0x08, 0x0d, 0xff, 0, 0, 0xffffffff80000000, 0x0, "vmovdqa YMMWORD PTR [r13-0x80000000],ymm8" },
+	{ "\xc4\xe1\xfd\x7f\x04\xcd\x40\x00\x00\x00", 10, 10, ShvEmulMov, 32, 0x10, 0x00, 0xff, 0x01, 8, 0, 0x40, 0x0, "vmovdqa YMMWORD PTR [rcx*8+0x40],ymm0" },
+	{ "\xc4\x01\xfd\x7f\x40\x7f", 6, 6, ShvEmulMov, 32, 0x10, 0x08, 0x08, 0xff, 0, 0, 0x7f, 0x0, "vmovdqa YMMWORD PTR [r8+0x7f],ymm8" },
+	{ "\xc4\xa1\xfd\x7f\x03", 5, 5, ShvEmulMov, 32, 0x10, 0x00, 0x03, 0xff, 0, 0, 0x0, 0x0, "vmovdqa YMMWORD PTR [rbx],ymm0" },
+	{ "\xc4\x41\xfd\x7f\x04\x24", 6, 6, ShvEmulMov, 32, 0x10, 0x08, 0x0c, 0xff, 0, 0, 0x0, 0x0, "vmovdqa YMMWORD PTR [r12],ymm8" },
+	{ "\xc4\xe1\x7a\x7f\x45\x08", 6, 6, ShvEmulMov, 16, 0x10, 0x00, 0x05, 0xff, 0, 0, 0x8, 0x0, "vmovdqu XMMWORD PTR [rbp+0x8],xmm0" },
+	{ "\xc4\x01\x7a\x7f\x04\x25\xf0\xff\xff\xff", 10, 10, ShvEmulMov, 16, 0x10, 0x08, 0xff, 0x0c, 1, 0, 0xfffffffffffffff0, 0x0, "vmovdqu XMMWORD PTR [r12*1-0x10],xmm8" },
+	{ "\xc4\xa1\x7a\x7f\x04\x25\x78\x56\x34\x12", 10, 10, ShvEmulMov, 16, 0x10, 0x00, 0xff, 0x0c, 1, 0, 0x12345678, 0x0, "vmovdqu XMMWORD PTR [r12*1+0x12345678],xmm0" },
+	{ "\xc4\x41\x7a\x7f\x04\x24", 6, 6, ShvEmulMov, 16, 0x10, 0x08, 0x0c, 0xff, 0, 0, 0x0, 0x0, "vmovdqu XMMWORD PTR [r12],xmm8" },
+	{ "\xc4\xe1\xfa\x7f\x85\x00\x00\x00\x80", 9, 9, ShvEmulMov, 16, 0x10, 0x00, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x0, "vmovdqu XMMWORD PTR [rbp-0x80000000],xmm0" },
+	{ "\xc4\x01\xfa\x7f\x03", 5, 5, ShvEmulMov, 16, 0x10, 0x08, 0x0b, 0xff, 0, 0, 0x0, 0x0, "vmovdqu XMMWORD PTR [r11],xmm8" },
+	{ "\xc4\xa1\xfa\x7f\x05\xf0\xff\xff\xff", 9, 9, ShvEmulMov, 16, 0x10, 0x00, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "vmovdqu XMMWORD PTR [rip+0xfffffffffffffff0],xmm0 # 0x13fb9" },
+	{ "\xc4\x41\xfa\x7f\x81\x00\x10\x00\x00", 9, 9, ShvEmulMov, 16, 0x10, 0x08, 0x09, 0xff, 0, 0, 0x1000, 0x0, "vmovdqu XMMWORD PTR [r9+0x1000],xmm8" },
+	{ "\xc5\xfe\x7f\x07", 4, 4, ShvEmulMov, 32, 0x10, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "vmovdqu YMMWORD PTR [rdi],ymm0" },
+	{ "\xc4\x01\x7e\x7f\xc0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovdqu ymm8,ymm8" },
+	{ "\xc4\xa1\x7e\x7f\x04\xa0", 6, 6, ShvEmulMov, 32, 0x10, 0x00, 0x00, 0x0c, 4, 0, 0x0, 0x0, "vmovdqu YMMWORD PTR [rax+r12*4],ymm0" },
+	{ "\xc4\x41\x7e\x7f\x04\xa0", 6, 6, ShvEmulMov, 32, 0x10, 0x08, 0x08, 0xff, 0, 0, 0x0, 0x0, "vmovdqu YMMWORD PTR [r8+riz*4],ymm8" },
+	{ "\xc4\xe1\xfe\x7f\x04\x65\x00\x10\x00\x00", 10, 10, ShvEmulMov, 32, 0x10, 0x00, 0xff, 0xff, 0, 0, 0x1000, 0x0, "vmovdqu YMMWORD PTR [riz*2+0x1000],ymm0" },
+	{ "\xc4\x01\xfe\x7f\x85\x00\x00\x00\x80", 9, 9, ShvEmulMov, 32, 0x10, 0x08, 0x0d, 0xff, 0, 0, 0xffffffff80000000, 0x0, "vmovdqu YMMWORD PTR [r13-0x80000000],ymm8" },
+	{ "\xc4\xa1\xfe\x7f\x07", 5, 5, ShvEmulMov, 32, 0x10, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "vmovdqu YMMWORD PTR [rdi],ymm0" },
+	{ "\xc4\x41\xfe\x7f\x04\x98", 6, 6, ShvEmulMov, 32, 0x10, 0x08, 0x08, 0x03, 4, 0, 0x0, 0x0, "vmovdqu YMMWORD PTR [r8+rbx*4],ymm8" },
+	{ "\xc5\xfb\x7f\x06", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7b\x7f\xc0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7b\x7f\x04\x24", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7b\x7f\x07", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xfb\x7f\x04\x20", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xfb\x7f\x04\x20", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xfb\x7f\x04\x1d\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xfb\x7f\x04\x25\xf0\xff\xff\xff", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc5\xff\x7f\x45\x08", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7f\x7f\x85\x00\x00\x00\x80", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7f\x7f\x44\x5d\xf8", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7f\x7f\x05\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xff\x7f\x04\x25\xf0\xff\xff\xff", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xff\x7f\x84\xe5\x44\x33\x22\x11", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xff\x7f\x04\x1d\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xff\x7f\xc0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\x71\x7f\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc5\x80\x7f\x00", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe2\x79\x7f\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe3\x79\x7f\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vfnmsubsd xmm0,xmm0,QWORD PTR [rax],xmm9" },
+	{ "\x66\xc5\xf9\x7f\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 vmovdqa XMMWORD PTR [rax],xmm0" },
+	{ "\xf3\xc5\xf9\x7f\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz vmovdqa XMMWORD PTR [rax],xmm0" },
+	{ "\xf0\xc5\xf9\x7f\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock vmovdqa XMMWORD PTR [rax],xmm0" },
+	{ "\x48\xc5\xf9\x7f\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W vmovdqa XMMWORD PTR [rax],xmm0" },
+	{ "\x64\xc5\xf9\x7f\x00", 5, 5, ShvEmulMov, 16, 0x10, 0x00, 0x00, 0xff, 0, 1, 0x0, 0x0, "vmovdqa XMMWORD PTR fs:[rax],xmm0" },
+	{ "\x67\xc5\xf9\x7f\x00", 5, 5, ShvEmulMov, 16, 0x18, 0x00, 0x00, 0xff, 0, 0, 0x0, 0x0, "vmovdqa XMMWORD PTR [eax],xmm0" },
+	{ "\x2e\xc5\xf9\x7f\x00", 5, 5, ShvEmulMov, 16, 0x10, 0x00, 0x00, 0xff, 0, 0, 0x0, 0x0, "cs vmovdqa XMMWORD PTR [rax],xmm0" },
+	{ "\xc5\xf8\xd6\x07", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x78\xd6\x04\x20", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x78\xd6\x04\x25\x78\x56\x34\x12", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x78\xd6\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xf8\xd6\x40\x7f", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xf8\xd6\xd7", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xf8\xd6\x04\x20", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xf8\xd6\x03", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\x7c\xd6\x04\x20", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7c\xd6\x84\xe5\x44\x33\x22\x11", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7c\xd6\x04\x65\x00\x10\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7c\xd6\xd7", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xfc\xd6\x04\x98", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xfc\xd6\x04\x24", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xfc\xd6\x06", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xfc\xd6\x04\x25\xf0\xff\xff\xff", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc5\xf9\xd6\x84\xe5\x44\x33\x22\x11", 9, 9, ShvEmulMov, 8, 0x10, 0x00, 0x05, 0xff, 0, 0, 0x11223344, 0x0, "vmovq QWORD PTR [rbp+riz*8+0x11223344],xmm0" },
+	{ "\xc4\x01\x79\xd6\x04\x1d\x40\x00\x00\x00", 10, 10, ShvEmulMov, 8, 0x10, 0x08, 0xff, 0x0b, 1, 0, 0x40, 0x0, "vmovq QWORD PTR [r11*1+0x40],xmm8" },
+	{ "\xc4\xa1\x79\xd6\x04\x98", 6, 6, ShvEmulMov, 8, 0x10, 0x00, 0x00, 0x0b, 4, 0, 0x0, 0x0, "vmovq QWORD PTR [rax+r11*4],xmm0" },
+	{ "\xc4\x41\x79\xd6\x04\x25\xf0\xff\xff\xff", 10, 10, ShvEmulMov, 8, 0x10, 0x08, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "vmovq QWORD PTR ds:0xfffffffffffffff0,xmm8" },
+	{ "\xc4\xe1\xf9\xd6\x44\x24\x10", 7, 7, ShvEmulMov, 8, 0x10, 0x00, 0x04, 0xff, 0, 0, 0x10, 0x0, "vmovq QWORD PTR [rsp+0x10],xmm0" },
+	{ "\xc4\x01\xf9\xd6\x04\x65\x00\x10\x00\x00", 10, 10, ShvEmulMov, 8, 0x10, 0x08, 0xff, 0x0c, 2, 0, 0x1000, 0x0, "vmovq QWORD PTR [r12*2+0x1000],xmm8" },
+	{ "\xc4\xa1\xf9\xd6\x04\x20", 6, 6, ShvEmulMov, 8, 0x10, 0x00, 0x00, 0x0c, 1, 0, 0x0, 0x0, "vmovq QWORD PTR [rax+r12*1],xmm0" },
+	{ "\xc4\x41\xf9\xd6\x04\x98", 6, 6, ShvEmulMov, 8, 0x10, 0x08, 0x08, 0x03, 4, 0, 0x0, 0x0, "vmovq QWORD PTR [r8+rbx*4],xmm8" },
+	{ "\xc5\xfd\xd6\x84\xe5\x44\x33\x22\x11", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7d\xd6\x85\x00\x00\x00\x80", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7d\xd6\x40\x7f", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7d\xd6\x85\x00\x00\x00\x80", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xfd\xd6\x04\xa0", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xfd\xd6\x04\x1d\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xfd\xd6\x41\x80", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xfd\xd6\x44\x5d\xf8", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc5\xfa\xd6\x04\x98", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7a\xd6\x41\x80", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7a\xd6\x04\x65\x00\x10\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7a\xd6\x40\x7f", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xfa\xd6\x44\x5d\xf8", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xfa\xd6\x44\x24\x10", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xfa\xd6\x07", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xfa\xd6\x44\x5d\xf8", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\x7e\xd6\x04\xcd\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7e\xd6\xc0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7e\xd6\x84\xe5\x44\x33\x22\x11", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7e\xd6\x44\x24\x10", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xfe\xd6\x04\x65\x00\x10\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xfe\xd6\x06", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xfe\xd6\x07", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xfe\xd6\x04\x24", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc5\xfb\xd6\xd7", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7b\xd6\x41\x80", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7b\xd6\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7b\xd6\x06", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xfb\xd6\x05\x10\x00\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xfb\xd6\x41\x80", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xfb\xd6\x07", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xfb\xd6\x40\x7f", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc5\xff\xd6\xc0", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7f\xd6\x04\x65\x00\x10\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7f\xd6\x40\x7f", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7f\xd6\x04\x24", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xff\xd6\x40\x7f", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xff\xd6\x85\x00\x00\x00\x80", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xff\xd6\x04\xcd\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xff\xd6\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\x71\xd6\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc5\x80\xd6\x00", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe2\x79\xd6\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe3\x79\xd6\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x66\xc5\xf9\xd6\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 vmovq QWORD PTR [rax],xmm0" },
+	{ "\xf3\xc5\xf9\xd6\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz vmovq QWORD PTR [rax],xmm0" },
+	{ "\xf0\xc5\xf9\xd6\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock vmovq QWORD PTR [rax],xmm0" },
+	{ "\x48\xc5\xf9\xd6\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W vmovq QWORD PTR [rax],xmm0" },
+	{ "\x64\xc5\xf9\xd6\x00", 5, 5, ShvEmulMov, 8, 0x10, 0x00, 0x00, 0xff, 0, 1, 0x0, 0x0, "vmovq QWORD PTR fs:[rax],xmm0" },
+	{ "\x67\xc5\xf9\xd6\x00", 5, 5, ShvEmulMov, 8, 0x18, 0x00, 0x00, 0xff, 0, 0, 0x0, 0x0, "vmovq QWORD PTR [eax],xmm0" },
+	{ "\x2e\xc5\xf9\xd6\x00", 5, 5, ShvEmulMov, 8, 0x10, 0x00, 0x00, 0xff, 0, 0, 0x0, 0x0, "cs vmovq QWORD PTR [rax],xmm0" },
+	{ "\xc4\xe1\x78\xe7\x44\x5d\xf8", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x78\xe7\x04\x25\xf0\xff\xff\xff", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x78\xe7\xd7", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x78\xe7\x45\x08", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xf8\xe7\x40\x7f", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xf8\xe7\xc0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xf8\xe7\x04\x25\xf0\xff\xff\xff", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xf8\xe7\x44\x24\x10", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\x7c\xe7\x05\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7c\xe7\x85\x00\x00\x00\x80", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7c\xe7\x44\x24\x10", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7c\xe7\x40\x7f", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xfc\xe7\x05\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xfc\xe7\x04\x98", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xfc\xe7\x84\xe5\x44\x33\x22\x11", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xfc\xe7\x07", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\x79\xe7\x40\x7f", 6, 6, ShvEmulMov, 16, 0x10, 0x00, 0x00, 0xff, 0, 0, 0x7f, 0x0, "vmovntdq XMMWORD PTR [rax+0x7f],xmm0" },
+	{ "\xc4\x01\x79\xe7\x40\x7f", 6, 6, ShvEmulMov, 16, 0x10, 0x08, 0x08, 0xff, 0, 0, 0x7f, 0x0, "vmovntdq XMMWORD PTR [r8+0x7f],xmm8" },
+	{ "\xc4\xa1\x79\xe7\x03", 5, 5, ShvEmulMov, 16, 0x10, 0x00, 0x03, 0xff, 0, 0, 0x0, 0x0, "vmovntdq XMMWORD PTR [rbx],xmm0" },
+	{ "\xc4\x41\x79\xe7\x04\x1d\x40\x00\x00\x00", 10, 10, ShvEmulMov, 16, 0x10, 0x08, 0xff, 0x03, 1, 0, 0x40, 0x0, "vmovntdq XMMWORD PTR [rbx*1+0x40],xmm8" },
+	{ "\xc4\xe1\xf9\xe7\x04\x24", 6, 6, ShvEmulMov, 16, 0x10, 0x00, 0x04, 0xff, 0, 0, 0x0, 0x0, "vmovntdq XMMWORD PTR [rsp],xmm0" },
+	{ "\xc4\x01\xf9\xe7\x03", 5, 5, ShvEmulMov, 16, 0x10, 0x08, 0x0b, 0xff, 0, 0, 0x0, 0x0, "vmovntdq XMMWORD PTR [r11],xmm8" },
+	{ "\xc4\xa1\xf9\xe7\x00", 5, 5, ShvEmulMov, 16, 0x10, 0x00, 0x00, 0xff, 0, 0, 0x0, 0x0, "vmovntdq XMMWORD PTR [rax],xmm0" },
+	{ "\xc4\x41\xf9\xe7\x03", 5, 5, ShvEmulMov, 16, 0x10, 0x08, 0x0b, 0xff, 0, 0, 0x0, 0x0, "vmovntdq XMMWORD PTR [r11],xmm8" },
+	{ "\xc5\xfd\xe7\x04\x25\x78\x56\x34\x12", 9, 9, ShvEmulMov, 32, 0x10, 0x00, 0xff, 0xff, 0, 0, 0x12345678, 0x0, "vmovntdq YMMWORD PTR ds:0x12345678,ymm0" },
+	{ "\xc4\x01\x7d\xe7\x06", 5, 5, ShvEmulMov, 32, 0x10, 0x08, 0x0e, 0xff, 0, 0, 0x0, 0x0, "vmovntdq YMMWORD PTR [r14],ymm8" },
+	{ "\xc4\xa1\x7d\xe7\x45\x08", 6, 6, ShvEmulMov, 32, 0x10, 0x00, 0x05, 0xff, 0, 0, 0x8, 0x0, "vmovntdq YMMWORD PTR [rbp+0x8],ymm0" },
+	{ "\xc4\x41\x7d\xe7\x04\x65\x00\x10\x00\x00", 10, 10, ShvEmulMov, 32, 0x10, 0x08, 0xff, 0xff, 0, 0, 0x1000, 0x0, "vmovntdq YMMWORD PTR [riz*2+0x1000],ymm8" },
+	{ "\xc4\xe1\xfd\xe7\x05\xf0\xff\xff\xff", 9, 9, ShvEmulMov, 32, 0x10, 0x00, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "vmovntdq YMMWORD PTR [rip+0xfffffffffffffff0],ymm0 # 0x15139" },
+	{ "\xc4\x01\xfd\xe7\x04\x25\xf0\xff\xff\xff", 10, 10, ShvEmulMov, 32, 0x10, 0x08, 0xff, 0x0c, 1, 0, 0xfffffffffffffff0, 0x0, "vmovntdq YMMWORD PTR [r12*1-0x10],ymm8" },
+	{ "\xc4\xa1\xfd\xe7\x05\x10\x00\x00\x00", 9, 9, ShvEmulMov, 32, 0x10, 0x00, 0x10, 0xff, 0, 0, 0x10, 0x0, "vmovntdq YMMWORD PTR [rip+0x10],ymm0 # 0x15199" },
+	{ "\xc4\x41\xfd\xe7\x04\x25\xf0\xff\xff\xff", 10, 10, ShvEmulMov, 32, 0x10, 0x08, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "vmovntdq YMMWORD PTR ds:0xfffffffffffffff0,ymm8" },
+	{ "\xc4\xe1\x7a\xe7\x84\xe5\x44\x33\x22\x11", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7a\xe7\x44\x24\x10", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7a\xe7\x04\x65\x00\x10\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7a\xe7\x04\x24", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xfa\xe7\x44\x24\x10", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xfa\xe7\x04\x20", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xfa\xe7\x04\x20", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xfa\xe7\x44\x24\x10", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\x7e\xe7\xd7", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7e\xe7\x85\x00\x00\x00\x80", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7e\xe7\x04\x20", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7e\xe7\x44\x5d\xf8", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xfe\xe7\x07", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xfe\xe7\x41\x80", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xfe\xe7\x04\x65\x00\x10\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xfe\xe7\x04\x65\x00\x10\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\x7b\xe7\x41\x80", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7b\xe7\x05\x10\x00\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7b\xe7\x44\x5d\xf8", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7b\xe7\x04\x25\x78\x56\x34\x12", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xfb\xe7\xd7", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xfb\xe7\x04\x25\x78\x56\x34\x12", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xfb\xe7\x04\x20", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xfb\xe7\x84\xe5\x44\x33\x22\x11", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\x7f\xe7\x81\x00\x10\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7f\xe7\x85\x00\x00\x00\x80", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7f\xe7\x85\x00\x00\x00\x80", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7f\xe7\x04\xcd\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xff\xe7\x06", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xff\xe7\x04\x20", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xff\xe7\x04\xa0", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xff\xe7\x04\x20", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\x71\xe7\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc5\x80\xe7\x00", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe2\x79\xe7\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmpnbexadd DWORD PTR [rax],eax,eax" },
+	{ "\xc4\xe3\x79\xe7\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x66\xc5\xf9\xe7\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 vmovntdq XMMWORD PTR [rax],xmm0" },
+	{ "\xf3\xc5\xf9\xe7\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz vmovntdq XMMWORD PTR [rax],xmm0" },
+	{ "\xf0\xc5\xf9\xe7\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock vmovntdq XMMWORD PTR [rax],xmm0" },
+	{ "\x48\xc5\xf9\xe7\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W vmovntdq XMMWORD PTR [rax],xmm0" },
+	{ "\x64\xc5\xf9\xe7\x00", 5, 5, ShvEmulMov, 16, 0x10, 0x00, 0x00, 0xff, 0, 1, 0x0, 0x0, "vmovntdq XMMWORD PTR fs:[rax],xmm0" },
+	{ "\x67\xc5\xf9\xe7\x00", 5, 5, ShvEmulMov, 16, 0x18, 0x00, 0x00, 0xff, 0, 0, 0x0, 0x0, "vmovntdq XMMWORD PTR [eax],xmm0" },
+	{ "\x2e\xc5\xf9\xe7\x00", 5, 5, ShvEmulMov, 16, 0x10, 0x00, 0x00, 0xff, 0, 0, 0x0, 0x0, "cs vmovntdq XMMWORD PTR [rax],xmm0" },
+	{ "\xc5\xf8\xb1\x06", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x78\xb1\xd7", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x78\xb1\xc0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x78\xb1\x04\x25\xf0\xff\xff\xff", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xf8\xb1\x04\x24", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xf8\xb1\x81\x00\x10\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xf8\xb1\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xf8\xb1\x04\x25\xf0\xff\xff\xff", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\x7c\xb1\x84\xe5\x44\x33\x22\x11", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7c\xb1\xc0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7c\xb1\x04\xa0", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7c\xb1\x07", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xfc\xb1\x07", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xfc\xb1\x41\x80", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xfc\xb1\xd7", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xfc\xb1\x85\x00\x00\x00\x80", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\x79\xb1\x44\x24\x10", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x79\xb1\x05\x10\x00\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x79\xb1\x05\x10\x00\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x79\xb1\x06", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xf9\xb1\xc0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xf9\xb1\x41\x80", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xf9\xb1\x06", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xf9\xb1\x04\xcd\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc5\xfd\xb1\x84\xe5\x44\x33\x22\x11", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7d\xb1\x44\x24\x10", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7d\xb1\x04\x65\x00\x10\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7d\xb1\x04\xcd\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xfd\xb1\x04\x25\x78\x56\x34\x12", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xfd\xb1\x04\x25\x78\x56\x34\x12", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xfd\xb1\x04\x1d\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xfd\xb1\x40\x7f", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\x7a\xb1\x04\x1d\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7a\xb1\x85\x00\x00\x00\x80", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7a\xb1\x04\x98", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7a\xb1\x84\xe5\x44\x33\x22\x11", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xfa\xb1\x04\xa0", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xfa\xb1\xc0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xfa\xb1\x04\x24", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xfa\xb1\x04\x25\x78\x56\x34\x12", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\x7e\xb1\x84\xe5\x44\x33\x22\x11", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7e\xb1\x04\x20", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7e\xb1\x85\x00\x00\x00\x80", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7e\xb1\x04\x25\xf0\xff\xff\xff", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xfe\xb1\x06", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xfe\xb1\x04\x1d\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xfe\xb1\xd7", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xfe\xb1\x07", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc5\xfb\xb1\x44\x24\x10", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7b\xb1\x04\xcd\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7b\xb1\x06", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7b\xb1\x04\x98", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xfb\xb1\x04\x24", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xfb\xb1\x04\x20", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xfb\xb1\x04\x25\x78\x56\x34\x12", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xfb\xb1\x85\x00\x00\x00\x80", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\x7f\xb1\x44\x5d\xf8", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7f\xb1\x85\x00\x00\x00\x80", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7f\xb1\x41\x80", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7f\xb1\x44\x5d\xf8", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xff\xb1\x04\x65\x00\x10\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xff\xb1\x04\xa0", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xff\xb1\x44\x5d\xf8", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xff\xb1\x04\x98", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\x71\xb1\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc5\x80\xb1\x00", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe2\x79\xb1\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vbcstnesh2ps xmm0,WORD PTR [rax]" },
+	{ "\xc4\xe3\x79\xb1\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x66\xc5\xf9\xb1\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 (bad)" },
+	{ "\xf3\xc5\xf9\xb1\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz (bad)" },
+	{ "\xf0\xc5\xf9\xb1\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock (bad)" },
+	{ "\x48\xc5\xf9\xb1\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W (bad)" },
+	{ "\x64\xc5\xf9\xb1\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "fs (bad)" },
+	{ "\x67\xc5\xf9\xb1\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "addr32 (bad)" },
+	{ "\x2e\xc5\xf9\xb1\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs (bad)" },
+	{ "\xc5\xf8\x89\x45\x08", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x78\x89\xd7", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x78\x89\x05\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x78\x89\x40\x7f", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xf8\x89\x04\x25\xf0\xff\xff\xff", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xf8\x89\x45\x08", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xf8\x89\x04\xcd\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xf8\x89\x04\x98", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc5\xfc\x89\x07", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7c\x89\x84\xe5\x44\x33\x22\x11", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7c\x89\x84\xe5\x44\x33\x22\x11", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7c\x89\x04\xcd\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xfc\x89\x04\x1d\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xfc\x89\x84\xe5\x44\x33\x22\x11", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xfc\x89\x85\x00\x00\x00\x80", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xfc\x89\x40\x7f", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc5\xf9\x89\xd7", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x79\x89\x07", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x79\x89\x05\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x79\x89\x41\x80", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xf9\x89\x04\x24", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xf9\x89\x05\x10\x00\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xf9\x89\x04\x98", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xf9\x89\x07", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc5\xfd\x89\x85\x00\x00\x00\x80", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7d\x89\x04\x24", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7d\x89\x07", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7d\x89\x04\x24", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xfd\x89\x04\xcd\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xfd\x89\x04\x20", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xfd\x89\x45\x08", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xfd\x89\x04\x25\xf0\xff\xff\xff", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc5\xfa\x89\x03", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7a\x89\xc0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7a\x89\x05\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7a\x89\x05\x10\x00\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xfa\x89\x04\x65\x00\x10\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xfa\x89\x06", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xfa\x89\x45\x08", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xfa\x89\x81\x00\x10\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\x7e\x89\x04\x65\x00\x10\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7e\x89\xc0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7e\x89\x04\x25\xf0\xff\xff\xff", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7e\x89\x04\x65\x00\x10\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xfe\x89\xc0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xfe\x89\x44\x5d\xf8", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xfe\x89\x04\x25\xf0\xff\xff\xff", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xfe\x89\x05\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\x7b\x89\xc0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7b\x89\x40\x7f", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7b\x89\x05\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7b\x89\xd7", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xfb\x89\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xfb\x89\x45\x08", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xfb\x89\x84\xe5\x44\x33\x22\x11", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xfb\x89\x07", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\x7f\x89\xd7", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\x7f\x89\x04\x98", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\x7f\x89\xd7", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\x7f\x89\x04\x65\x00\x10\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\xff\x89\x44\x24\x10", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x01\xff\x89\xd7", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xa1\xff\x89\x85\x00\x00\x00\x80", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x41\xff\x89\x05\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe1\x71\x89\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc5\x80\x89\x00", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe2\x79\x89\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xe3\x79\x89\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x66\xc5\xf9\x89\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 (bad)" },
+	{ "\xf3\xc5\xf9\x89\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz (bad)" },
+	{ "\xf0\xc5\xf9\x89\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock (bad)" },
+	{ "\x48\xc5\xf9\x89\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W (bad)" },
+	{ "\x64\xc5\xf9\x89\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "fs (bad)" },
+	{ "\x67\xc5\xf9\x89\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "addr32 (bad)" },
+	{ "\x2e\xc5\xf9\x89\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs (bad)" },
+	{ "\xf3\x4f\x8f\xeb\x63\xf2\x0f\x53\x7a\x57\x26\xa5\x09\x93\xba", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz (bad)" },
+	{ "\x64\x2e\x64\x44\x0f\x17\x4a\xfe", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "fs cs movhps QWORD PTR fs:[rdx-0x2],xmm9" },
+	{ "\x42\x8b\xa4\x02\x1b\x67\x52\x57", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov esp,DWORD PTR [rdx+r8*1+0x5752671b]" },
+	{ "\x42\xac", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.X lods al,BYTE PTR ds:[rsi]" },
+	{ "\x66\x26\x42\x88\xaa\xf7\x73\xe0\x19", 9, 9, ShvEmulMov, 1, 0x04, 0x05, 0x02, 0xff, 0, 0, 0x19e073f7, 0x0, "data16 es rex.X mov BYTE PTR [rdx+0x19e073f7],bpl" },
+	{ "\xf0\x4f\xfe\x41\x80", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock rex.WRXB inc BYTE PTR [r9-0x80]" },
+	{ "\x48\x0f\x28\x8b\xf7\xbe\xe9\xc9", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W movaps xmm1,XMMWORD PTR [rbx-0x36164109]" },
+	{ "\x4c\x21\x06", 3, 3, ShvEmulAnd, 8, 0x04, 0x08, 0x06, 0xff, 0, 0, 0x0, 0x0, "and QWORD PTR [rsi],r8" },
+	{ "\x67\x42\x81\x41\x80\x03\xb5\x7b\x53", 9, 9, ShvEmulAdd, 4, 0x0c, 0xff, 0x01, 0xff, 0, 0, 0xffffff80, 0x537bb503, "rex.X add DWORD PTR [ecx-0x80],0x537bb503" },
+	{ "\x44\xff\x64\xbd\xac", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.R jmp QWORD PTR [rbp+rdi*4-0x54]" },
+	{ "\x36\xf0\xf0\xc4\xa2\x79\x89\x03\x1d\x1a\xfd\xee\x7c\xa0\x80", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ss lock lock (bad)" },
+	{ "\xf3\x48\xff\x45\x08", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz inc QWORD PTR [rbp+0x8]" },
+	{ "\xf2\x42\x81\x66\xf6\x37\x91\xef\x1f", 9, 9, ShvEmulAnd, 4, 0x04, 0xff, 0x06, 0xff, 0, 0, 0xfffffffffffffff6, 0x1fef9137, "repnz rex.X and DWORD PTR [rsi-0xa],0x1fef9137" },
+	{ "\x3e\x41\x28\xf9", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ds sub r9b,dil" },
+	{ "\x65\x4f\x0a\xf4", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "gs rex.WRXB or r14b,r12b" },
+	{ "\x36\x3e\xf3\x18\x55\x5c", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ss ds repz sbb BYTE PTR [rbp+0x5c],dl" },
+	{ "\x26\x48\xc6\xe7\xce\x74\xef\x17\x2f\xcc\x1b\xde\x12\xc0\x38", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "es rex.W (bad)" },
+	{ "\x2e\x4f\x0f\xab\x87\xc3\xc5\x4c\x53", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs rex.WRXB bts QWORD PTR [r15+0x534cc5c3],r8" },
+	{ "\x42\x0f\xc7\x89\x7a\xae\x8f\x4c", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.X cmpxchg8b QWORD PTR [rcx+0x4c8fae7a]" },
+	{ "\x4f\xfe\x81\x00\x10\x00\x00", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WRXB inc BYTE PTR [r9+0x1000]" },
+	{ "\x36\xf0\x4c\xd1\x04\x65\x00\x10\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ss lock rex.WR rol QWORD PTR [riz*2+0x1000],1" },
+	{ "\xf2\xf3\x41\x0f\xb3\xad\x76\x94\x7f\x64", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz repz btr DWORD PTR [r13+0x647f9476],ebp" },
+	{ "\x3e\x67\x4f\x87\x04\x1d\x40\x00\x00\x00", 10, 10, ShvEmulXchg, 8, 0x0c, 0x08, 0xff, 0x0b, 1, 0, 0x40, 0x0, "ds xchg QWORD PTR [r11d*1+0x40],r8" },
+	{ "\x2e\xf0\x4c\x0f\xae\x40\x7f", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs lock rex.WR fxsave64 [rax+0x7f]" },
+	{ "\x26\x40\x00\x45\x08", 5, 5, ShvEmulAdd, 1, 0x04, 0x00, 0x05, 0xff, 0, 0, 0x8, 0x0, "es rex add BYTE PTR [rbp+0x8],al" },
+	{ "\x26\x64\xf0\x0f\x7e\x3d\x9d\x54\x06\x94", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "es lock movd DWORD PTR fs:[rip+0xffffffff9406549d],mm7 # 0xffffffff9407c1a7" },
+	{ "\x65\x40\x08\xb9\x8c\x92\xc6\xa8", 8, 8, ShvEmulOr, 1, 0x04, 0x07, 0x01, 0xff, 0, 2, 0xffffffffa8c6928c, 0x0, "or BYTE PTR gs:[rcx-0x57396d74],dil" },
+	{ "\xf0\x42\xaa", 3, 3, ShvEmulStos, 1, 0x05, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "lock rex.X stos BYTE PTR es:[rdi],al" },
+	{ "\x26\x65\x64\x4f\xf6\x04\x25\x78\x56\x34\x12\x17", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "es gs rex.WRXB test BYTE PTR fs:[r12*1+0x12345678],0x17" },
+	{ "\x67\x4f\x0f\xc7\xbe\x40\x46\xf3\xcc", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WRXB vmptrst QWORD PTR [r14d-0x330cb9c0]" },
+	{ "\x40\x8a\xab\xbf\xde\xb8\x75", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov bpl,BYTE PTR [rbx+0x75b8debf]" },
+	{ "\x65\x66\x67\x0f\xd6\x03", 6, 6, ShvEmulMov, 8, 0x18, 0x00, 0x03, 0xff, 0, 2, 0x0, 0x0, "movq QWORD PTR gs:[ebx],xmm0" },
+	{ "\x3e\x48\xa7", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmps QWORD PTR ds:[rsi],QWORD PTR es:[rdi]" },
+	{ "\x2e\x4f\x29\x04\x1d\x40\x00\x00\x00", 9, 9, ShvEmulSub, 8, 0x04, 0x08, 0xff, 0x0b, 1, 0, 0x40, 0x0, "cs sub QWORD PTR [r11*1+0x40],r8" },
+	{ "\x64\x67\x26\x48\x20\x7b\x10", 7, 7, ShvEmulAnd, 1, 0x0c, 0x07, 0x03, 0xff, 0, 1, 0x10, 0x0, "fs rex.W and BYTE PTR fs:[ebx+0x10],dil" },
+	{ "\x40\x8f\x05\x10\x00\x00\x00", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex pop QWORD PTR [rip+0x10] # 0x16e57" },
+	{ "\xf0\x40\x0f\xc1\x05\x10\x00\x00\x00", 9, 9, ShvEmulXadd, 4, 0x05, 0x00, 0x10, 0xff, 0, 0, 0x10, 0x0, "lock rex xadd DWORD PTR [rip+0x10],eax # 0x16e79" },
+	{ "\x65\xf3\x66\x48\x02\x84\xe5\x44\x33\x22\x11", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz data16 rex.W add al,BYTE PTR gs:[rbp+riz*8+0x11223344]" },
+	{ "\x67\x2e\xc4\x21\xfe\x13\x04\x65\x00\x10\x00\x00\xa8\xd7\x9d", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "addr32 cs (bad)" },
+	{ "\x2e\xc4\x21\x79\xe7\x04\x65\x00\x10\x00\x00", 11, 11, ShvEmulMov, 16, 0x10, 0x08, 0xff, 0x0c, 2, 0, 0x1000, 0x0, "cs vmovntdq XMMWORD PTR [r12*2+0x1000],xmm8" },
+	{ "\x26\x44\x30\x04\xcd\x40\x00\x00\x00", 9, 9, ShvEmulXor, 1, 0x04, 0x08, 0xff, 0x01, 8, 0, 0x40, 0x0, "es xor BYTE PTR [rcx*8+0x40],r8b" },
+	{ "\x67\xf0\x41\x0f\x2b\xf8\xba\x6d\x6f\x98\xe5\x37\x72\x01\xa3", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "addr32 lock rex.B (bad)" },
+	{ "\x3e\x3e\x0f\xb1\x04\x25\xf0\xff\xff\xff", 10, 10, ShvEmulCmpxchg, 4, 0x00, 0x00, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "ds ds cmpxchg DWORD PTR ds:0xfffffffffffffff0,eax" },
+	{ "\x4c\x01\x40\x7f", 4, 4, ShvEmulAdd, 8, 0x04, 0x08, 0x00, 0xff, 0, 0, 0x7f, 0x0, "add QWORD PTR [rax+0x7f],r8" },
+	{ "\x65\x44\xd1\x00", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.R rol DWORD PTR gs:[rax],1" },
+	{ "\x36\x42\x8f\x04\x20", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ss pop QWORD PTR [rax+r12*1]" },
+	{ "\x67\xf3\x66\x44\x22\x04\x98", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz data16 and r8b,BYTE PTR [eax+ebx*4]" },
+	{ "\x4f\xae", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WRXB scas al,BYTE PTR es:[rdi]" },
+	{ "\xf2\xf2\x64\x4c\xf6\x05\x10\x00\x00\x00\xbc", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz repnz rex.WR test BYTE PTR fs:[rip+0x10],0xbc # 0x16ffb" },
+	{ "\x64\x2e\x65\x4c\x09\x2d\x7b\x20\xc9\x31", 10, 10, ShvEmulOr, 8, 0x04, 0x0d, 0x10, 0xff, 0, 2, 0x31c9207b, 0x0, "fs cs or QWORD PTR gs:[rip+0x31c9207b],r13 # 0x31ca9085" },
+	{ "\x66\x4c\x85\xba\x8d\x25\x8f\xbb", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 test QWORD PTR [rdx-0x4470da73],r15" },
+	{ "\xf3\x3e\x48\x28\x84\xe5\x44\x33\x22\x11", 10, 10, ShvEmulSub, 1, 0x04, 0x00, 0x05, 0xff, 0, 0, 0x11223344, 0x0, "repz ds rex.W sub BYTE PTR [rbp+riz*8+0x11223344],al" },
+	{ "\x66\x44\xa3\x04\x65\x00\x10\x00\x00\x4b\x53", 11, 11, ShvEmulMov, 2, 0x04, 0x00, 0xff, 0xff, 0, 0, 0x534b000010006504, 0x0, "rex.R movabs ds:0x534b000010006504,ax" },
+	{ "\xc4\x01\x3c\x10\x04\x98\xe0\x1e\x46\xfe\x74\x05\x78\xe3\x2d", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x66\xf3\xc4\xa1\x7e\x6f\xd2", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 repz vmovdqu ymm2,ymm2" },
+	{ "\x26\x36\x42\xa5", 4, 4, ShvEmulMovs, 4, 0x04, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "es rex.X movs DWORD PTR es:[rdi],DWORD PTR ds:[rsi]" },
+	{ "\x4c\xac", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WR lods al,BYTE PTR ds:[rsi]" },
+	{ "\x44\x8c\xa7\x5b\x9e\x4a\xf5", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.R mov WORD PTR [rdi-0xab561a5],fs" },
+	{ "\x66\x65\xc4\x21\x7e\x11\x98\xec\xb2\xc0\xe6", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 vmovss DWORD PTR gs:[rax-0x193f4d14],xmm11" },
+	{ "\x67\x2e\xc4\xe2\xff\x29\x04\x25\xf0\xff\xff\xff\x76\xb9\x19", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x4c\x8a\x07", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WR mov r8b,BYTE PTR [rdi]" },
+	{ "\x4c\x0f\x2b\x05\x10\x00\x00\x00", 8, 8, ShvEmulMov, 16, 0x14, 0x08, 0x10, 0xff, 0, 0, 0x10, 0x0, "rex.WR movntps XMMWORD PTR [rip+0x10],xmm8 # 0x17198" },
+	{ "\x26\x42\x0f\xc1\x1b", 5, 5, ShvEmulXadd, 4, 0x04, 0x03, 0x03, 0xff, 0, 0, 0x0, 0x0, "es rex.X xadd DWORD PTR [rbx],ebx" },
+	{ "\x64\x2e\xf2\x42\x28\x6d\xd3", 7, 7, ShvEmulSub, 1, 0x04, 0x05, 0x05, 0xff, 0, 1, 0xffffffffffffffd3, 0x0, "fs repnz rex.X sub BYTE PTR fs:[rbp-0x2d],bpl" },
+	{ "\x4f\x0f\x29\xf3", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WRXB movaps xmm11,xmm14" },
+	{ "\x26\x65\x2e\x83\xba\xc1\xba\x7c\x9d\x91", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "es gs cmp DWORD PTR gs:[rdx-0x6283453f],0xffffff91" },
+	{ "\xc4\x22\xbe\xe7\x04\x24\x82\xdb\x53\x53\x68\x97\x72\xab\x23", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x26\x41\x02\x45\x08", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "es add al,BYTE PTR [r13+0x8]" },
+	{ "\x64\x64\x64\x40\xc0\xf6\x8d", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "fs fs fs shl sil,0x8d" },
+	{ "\x44\x85\x23", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "test DWORD PTR [rbx],r12d" },
+	{ "\x26\x42\x0f\xc0\x04\x24", 6, 6, ShvEmulXadd, 1, 0x04, 0x00, 0x04, 0x0c, 1, 0, 0x0, 0x0, "es xadd BYTE PTR [rsp+r12*1],al" },
+	{ "\x4c\xaa", 2, 2, ShvEmulStos, 1, 0x04, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "rex.WR stos BYTE PTR es:[rdi],al" },
+	{ "\xf0\x3e\x65\x48\x01\x00", 6, 6, ShvEmulAdd, 8, 0x05, 0x00, 0x00, 0xff, 0, 2, 0x0, 0x0, "lock ds add QWORD PTR gs:[rax],rax" },
+	{ "\x26\x48\x38\x22", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "es rex.W cmp BYTE PTR [rdx],spl" },
+	{ "\x26\x36\x4c\x02\xd2", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "es ss rex.WR add r10b,dl" },
+	{ "\x26\xc4\x62\x3a\x11\x45\x08\x55\x51\x77\xf0\x20\x5f\x3f\xb0", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x3e\x65\x48\x32\x04\xcd\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ds rex.W xor al,BYTE PTR gs:[rcx*8+0x40]" },
+	{ "\x4f\x29\x3e", 3, 3, ShvEmulSub, 8, 0x04, 0x0f, 0x0e, 0xff, 0, 0, 0x0, 0x0, "rex.WRXB sub QWORD PTR [r14],r15" },
+	{ "\x4f\x01\x2c\x33", 4, 4, ShvEmulAdd, 8, 0x04, 0x0d, 0x0b, 0x0e, 1, 0, 0x0, 0x0, "add QWORD PTR [r11+r14*1],r13" },
+	{ "\x2e\x44\x21\xd3", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs and ebx,r10d" },
+	{ "\x4f\x0f\xc1\x38", 4, 4, ShvEmulXadd, 8, 0x04, 0x0f, 0x08, 0xff, 0, 0, 0x0, 0x0, "rex.WRXB xadd QWORD PTR [r8],r15" },
+	{ "\x4c\x18\x00", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WR sbb BYTE PTR [rax],r8b" },
+	{ "\x48\x0f\xb0\x00", 4, 4, ShvEmulCmpxchg, 1, 0x04, 0x00, 0x00, 0xff, 0, 0, 0x0, 0x0, "rex.W cmpxchg BYTE PTR [rax],al" },
+	{ "\xc4\x01\xfc\x7e\xc8\xd6\xea\xb4\x1e\xfe\x50\x11\xed\x4d\x96", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x64\x40\xc6\x0f\x75\xf9\x58\xb1\x7e\x3d\x5c\xbc\x62\xf8\xe4", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "fs rex (bad)" },
+	{ "\x4f\x10\x94\xc7\x30\xbd\xe6\x98", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WRXB adc BYTE PTR [r15+r8*8-0x671942d0],r10b" },
+	{ "\x65\xf0\x2e\xc4\x81\x7b\x11\x7f\x92", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "gs lock vmovsd QWORD PTR gs:[r15-0x6e],xmm7" },
+	{ "\x67\xf0\x2e\x03\x04\xa0", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock cs add eax,DWORD PTR [eax+eiz*4]" },
+	{ "\xf2\x44\x80\x50\x3e\xe1", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz rex.R adc BYTE PTR [rax+0x3e],0xe1" },
+	{ "\x8a\x08", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov cl,BYTE PTR [rax]" },
+	{ "\x64\xc4\x81\xfb\x11\x41\x80", 7, 7, ShvEmulMov, 8, 0x10, 0x00, 0x09, 0xff, 0, 1, 0xffffffffffffff80, 0x0, "vmovsd QWORD PTR fs:[r9-0x80],xmm0" },
+	{ "\x65\x41\xa6", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.B cmps BYTE PTR gs:[rsi],BYTE PTR es:[rdi]" },
+	{ "\x2e\xf0\x2e\x42\x0a\x08", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs lock cs rex.X or cl,BYTE PTR [rax]" },
+	{ "\xc4\x61\x79\x7f\x0b", 5, 5, ShvEmulMov, 16, 0x10, 0x09, 0x03, 0xff, 0, 0, 0x0, 0x0, "vmovdqa XMMWORD PTR [rbx],xmm9" },
+	{ "\x67\xf2\x4c\x39\x04\xcd\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz cmp QWORD PTR [ecx*8+0x40],r8" },
+	{ "\x36\xf2\x48\x0f\xab\x04\x20", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ss repnz bts QWORD PTR [rax+riz*1],rax" },
+	{ "\x4f\xa2\x05\xf0\xff\xff\xff\xb4\x74\x9d", 10, 10, ShvEmulMov, 1, 0x04, 0x00, 0xff, 0xff, 0, 0, 0x9d74b4fffffff005, 0x0, "rex.WRXB movabs ds:0x9d74b4fffffff005,al" },
+	{ "\x4c\x20\x23", 3, 3, ShvEmulAnd, 1, 0x04, 0x0c, 0x03, 0xff, 0, 0, 0x0, 0x0, "rex.WR and BYTE PTR [rbx],r12b" },
+	{ "\x3e\x36\xf0\x44\xfe\x07", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ds ss lock rex.R inc BYTE PTR [rdi]" },
+	{ "\x65\x41\x28\x44\x24\x10", 6, 6, ShvEmulSub, 1, 0x04, 0x00, 0x0c, 0xff, 0, 2, 0x10, 0x0, "sub BYTE PTR gs:[r12+0x10],al" },
+	{ "\x48\x8f\x04\xcd\x40\x00\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W pop QWORD PTR [rcx*8+0x40]" },
+	{ "\x42\x87\x00", 3, 3, ShvEmulXchg, 4, 0x04, 0x00, 0x00, 0xff, 0, 0, 0x0, 0x0, "rex.X xchg DWORD PTR [rax],eax" },
+	{ "\xf3\xf3\xc4\xe2\xf9\x7f\x6a\xc6\x36\xb2\x6a\x61\x4e\xa6\x7d", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz repz (bad)" },
+	{ "\x3e\x41\x83\x70\x53\x31", 6, 6, ShvEmulXor, 4, 0x04, 0xff, 0x08, 0xff, 0, 0, 0x53, 0x31, "ds xor DWORD PTR [r8+0x53],0x31" },
+	{ "\x81\x03\x19\x73\xdc\xfb", 6, 6, ShvEmulAdd, 4, 0x00, 0xff, 0x03, 0xff, 0, 0, 0x0, 0xfbdc7319, "add DWORD PTR [rbx],0xfbdc7319" },
+	{ "\x66\xc4\xe1\xf8\x7e\x00\x17\xff\xf4\xa9\x3b\xfc\x21\x5e\x30", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 (bad)" },
+	{ "\x64\x26\xf0\x41\x81\x04\x1d\x40\x00\x00\x00\xa7\x1f\x42\x06", 15, 15, ShvEmulAdd, 4, 0x05, 0xff, 0xff, 0x03, 1, 1, 0x40, 0x6421fa7, "fs lock add DWORD PTR fs:[rbx*1+0x40],0x6421fa7" },
+	{ "\x2e\xf6\x04\x25\x78\x56\x34\x12\x07", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs test BYTE PTR ds:0x12345678,0x7" },
+	{ "\x40\x08\xb9\xcb\x11\x7a\xdf", 7, 7, ShvEmulOr, 1, 0x04, 0x07, 0x01, 0xff, 0, 0, 0xffffffffdf7a11cb, 0x0, "or BYTE PTR [rcx-0x2085ee35],dil" },
+	{ "\xf3\x41\x01\x04\x24", 5, 5, ShvEmulAdd, 4, 0x04, 0x00, 0x0c, 0xff, 0, 0, 0x0, 0x0, "repz add DWORD PTR [r12],eax" },
+	{ "\x2e\x2e\x64\x4c\x0f\x17\x04\xa0", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs cs rex.WR movhps QWORD PTR fs:[rax+riz*4],xmm8" },
+	{ "\x67\x48\x39\x84\xe5\x44\x33\x22\x11", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmp QWORD PTR [ebp+eiz*8+0x11223344],rax" },
+	{ "\x3e\x64\x65\x40\x0f\xab\x04\x24", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ds fs rex bts DWORD PTR gs:[rsp],eax" },
+	{ "\x48\x39\x04\x1d\x40\x00\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmp QWORD PTR [rbx*1+0x40],rax" },
+	{ "\x41\x0f\x6f\x07", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movq mm0,QWORD PTR [r15]" },
+	{ "\x4c\x11\x44\x24\x10", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "adc QWORD PTR [rsp+0x10],r8" },
+	{ "\x67\xc4\x81\xff\x89\x48\x13\xe2\xc8\xc2\x9e\x8c\x10\x4c\xba", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "addr32 (bad)" },
+	{ "\x36\x01\x04\x24", 4, 4, ShvEmulAdd, 4, 0x00, 0x00, 0x04, 0xff, 0, 0, 0x0, 0x0, "ss add DWORD PTR [rsp],eax" },
+	{ "\xf3\xf2\x4c\x8f\x04\x65\x00\x10\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz repnz rex.WR pop QWORD PTR [riz*2+0x1000]" },
+	{ "\x36\x67\x4c\xa0\x75\x02\x2a\xec", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ss addr32 rex.WR mov al,ds:0xec2a0275" },
+	{ "\xf0\xf3\xf2\x41\xff\x17", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock repz bnd call QWORD PTR [r15]" },
+	{ "\x64\x64\xf3\x48\x02\x84\x3a\xe5\x7b\x98\x6c", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "fs repz rex.W add al,BYTE PTR fs:[rdx+rdi*1+0x6c987be5]" },
+	{ "\x0f\x10\x45\x5f", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movups xmm0,XMMWORD PTR [rbp+0x5f]" },
+	{ "\x4c\x00\x02", 3, 3, ShvEmulAdd, 1, 0x04, 0x08, 0x02, 0xff, 0, 0, 0x0, 0x0, "rex.WR add BYTE PTR [rdx],r8b" },
+	{ "\x2e\x44\xab", 3, 3, ShvEmulStos, 4, 0x04, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "cs rex.R stos DWORD PTR es:[rdi],eax" },
+	{ "\x26\xc4\x61\x79\x7e\x04\x24", 7, 7, ShvEmulMov, 4, 0x10, 0x08, 0x04, 0xff, 0, 0, 0x0, 0x0, "es vmovd DWORD PTR [rsp],xmm8" },
+	{ "\xf3\x4f\x08\x04\x25\xf0\xff\xff\xff", 9, 9, ShvEmulOr, 1, 0x04, 0x08, 0xff, 0x0c, 1, 0, 0xfffffffffffffff0, 0x0, "repz rex.WRXB or BYTE PTR [r12*1-0x10],r8b" },
+	{ "\x42\x08\x03", 3, 3, ShvEmulOr, 1, 0x04, 0x00, 0x03, 0xff, 0, 0, 0x0, 0x0, "rex.X or BYTE PTR [rbx],al" },
+	{ "\xc4\xe1\xff\x29\x85\xdb\xc5\x5e\x66\x77\x41\x3c\xbe\x07\x94", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x4f\x0f\xd6\x45\x08\xbe\x50\xec\x02\x84\x2b\xeb\xc1\x41\x9e", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WRXB (bad)" },
+	{ "\xf2\x44\x08\x25\x1e\x67\xf9\x76", 8, 8, ShvEmulOr, 1, 0x04, 0x0c, 0x10, 0xff, 0, 0, 0x76f9671e, 0x0, "repnz or BYTE PTR [rip+0x76f9671e],r12b # 0x76fae146" },
+	{ "\x67\x64\x4f\x30\x04\x98", 6, 6, ShvEmulXor, 1, 0x0c, 0x08, 0x08, 0x0b, 4, 1, 0x0, 0x0, "rex.WRXB xor BYTE PTR fs:[r8d+r11d*4],r8b" },
+	{ "\x00\x41\x80", 3, 3, ShvEmulAdd, 1, 0x00, 0x00, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "add BYTE PTR [rcx-0x80],al" },
+	{ "\x40\x0f\xc1\xb8\x93\x50\x5a\x85", 8, 8, ShvEmulXadd, 4, 0x04, 0x07, 0x00, 0xff, 0, 0, 0xffffffff855a5093, 0x0, "rex xadd DWORD PTR [rax-0x7aa5af6d],edi" },
+	{ "\x4c\xfe\x03", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WR inc BYTE PTR [rbx]" },
+	{ "\x42\x0f\x17\x84\xe5\x44\x33\x22\x11", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movhps QWORD PTR [rbp+r12*8+0x11223344],xmm0" },
+	{ "\x64\x26\xf0\x8a\x04\x25\xf0\xff\xff\xff", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "fs lock mov al,BYTE PTR fs:0xfffffffffffffff0" },
+	{ "\x65\x02\x04\x65\x00\x10\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "add al,BYTE PTR gs:[riz*2+0x1000]" },
+	{ "\x36\x0f\xb3\x04\x25\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ss btr DWORD PTR ds:0xfffffffffffffff0,eax" },
+	{ "\x3e\xf3\x40\xa4", 4, 4, ShvEmulMovs, 1, 0x06, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "rep rex movs BYTE PTR es:[rdi],BYTE PTR ds:[rsi]" },
+	{ "\xf3\xc4\x61\xfe\x2b\x46\xf6\x96\x7c\x8f\xb4\x4e\x1e\xe3\x1d", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x66\x67\xf2\x40\x80\xbc\x17\xb5\x59\x05\x22\x10", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 repnz rex cmp BYTE PTR [edi+edx*1+0x220559b5],0x10" },
+	{ "\x36\x40\xab", 3, 3, ShvEmulStos, 4, 0x04, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "ss rex stos DWORD PTR es:[rdi],eax" },
+	{ "\xf3\x4f\xa2\x6f\x4c\x03\x56\x94\xf9\xbf\xc0", 11, 11, ShvEmulMov, 1, 0x04, 0x00, 0xff, 0xff, 0, 0, 0xc0bff99456034c6f, 0x0, "repz rex.WRXB movabs ds:0xc0bff99456034c6f,al" },
+	{ "\x41\x0f\x90\x41\x80", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "seto BYTE PTR [r9-0x80]" },
+	{ "\xc4\xc1\x7b\x2b\x04\x25\xf0\xff\xff\xff\x2a\x4c\x04\x29\x58", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x4c\x01\x07", 3, 3, ShvEmulAdd, 8, 0x04, 0x08, 0x07, 0xff, 0, 0, 0x0, 0x0, "add QWORD PTR [rdi],r8" },
+	{ "\x3e\x44\x30\x41\x3e", 5, 5, ShvEmulXor, 1, 0x04, 0x08, 0x01, 0xff, 0, 0, 0x3e, 0x0, "ds xor BYTE PTR [rcx+0x3e],r8b" },
+	{ "\x36\x42\x29\x45\x08", 5, 5, ShvEmulSub, 4, 0x04, 0x00, 0x05, 0xff, 0, 0, 0x8, 0x0, "ss rex.X sub DWORD PTR [rbp+0x8],eax" },
+	{ "\x26\x65\x4f\x0f\x10\x49\xa6", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "es rex.WRXB movups xmm9,XMMWORD PTR gs:[r9-0x5a]" },
+	{ "\xf3\x48\xc7\x05\x10\x00\x00\x00\x09\xfe\x6b\x65", 12, 12, ShvEmulMovImmediate, 8, 0x04, 0xff, 0x10, 0xff, 0, 0, 0x10, 0x656bfe09, "xrelease mov QWORD PTR [rip+0x10],0x656bfe09 # 0x17cbc" },
+	{ "\x26\xf2\x4f\x81\xb6\x35\x58\xad\xf1\x40\xce\x1d\x2a", 13, 13, ShvEmulXor, 8, 0x04, 0xff, 0x0e, 0xff, 0, 0, 0xfffffffff1ad5835, 0x2a1dce40, "es repnz rex.WRXB xor QWORD PTR [r14-0xe52a7cb],0x2a1dce40" },
+	{ "\x65\xc4\xa1\x7e\x2b\x41\x80\x41\xb1\x35\x36\xed\xdb\x45\x2a", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x4c\x2a\x1d\xb5\x6a\x75\x44", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WR sub r11b,BYTE PTR [rip+0x44756ab5] # 0x4476e7bc" },
+	{ "\x4f\xa6", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WRXB cmps BYTE PTR ds:[rsi],BYTE PTR es:[rdi]" },
+	{ "\xf2\x3e\x65\xc4\x41\x7f\x89\x5e\x24\xff\x3d\x1a\x04\x80\x32", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz ds gs (bad)" },
+	{ "\x26\x36\x41\x10\x04\x25\xf0\xff\xff\xff", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "es ss adc BYTE PTR ds:0xfffffffffffffff0,al" },
+	{ "\xf3\x41\xc0\x04\x25\x78\x56\x34\x12\x57", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz rol BYTE PTR ds:0x12345678,0x57" },
+	{ "\x64\x42\xab", 3, 3, ShvEmulStos, 4, 0x04, 0x00, 0x07, 0xff, 0, 1, 0x0, 0x0, "fs rex.X stos DWORD PTR es:[rdi],eax" },
+	{ "\x66\xf0\x8f\x84\xe5\x44\x33\x22\x11", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock pop WORD PTR [rbp+riz*8+0x11223344]" },
+	{ "\x67\x42\x00\x95\xba\x5c\x3a\xc4", 8, 8, ShvEmulAdd, 1, 0x0c, 0x02, 0x05, 0xff, 0, 0, 0xc43a5cba, 0x0, "rex.X add BYTE PTR [ebp-0x3bc5a346],dl" },
+	{ "\x48\x0f\xab\x84\xe5\x44\x33\x22\x11", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "bts QWORD PTR [rbp+riz*8+0x11223344],rax" },
+	{ "\x67\x48\x01\x07", 4, 4, ShvEmulAdd, 8, 0x0c, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "add QWORD PTR [edi],rax" },
+	{ "\x4c\x87\x07", 3, 3, ShvEmulXchg, 8, 0x04, 0x08, 0x07, 0xff, 0, 0, 0x0, 0x0, "xchg QWORD PTR [rdi],r8" },
+	{ "\x3e\x42\x38\x86\x14\x42\xe0\xa1", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ds rex.X cmp BYTE PTR [rsi-0x5e1fbdec],al" },
+	{ "\x36\x26\x65\x83\xa3\x8b\xe9\x1a\x2c\x3f", 10, 10, ShvEmulAnd, 4, 0x00, 0xff, 0x03, 0xff, 0, 2, 0x2c1ae98b, 0x3f, "ss es and DWORD PTR gs:[rbx+0x2c1ae98b],0x3f" },
+	{ "\x66\x41\x8f\x40\x7f", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "pop WORD PTR [r8+0x7f]" },
+	{ "\x40\xa0\xe2\x7b\x45\x68\x39\xfe\xe4\x4b", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex movabs al,ds:0x4be4fe3968457be2" },
+	{ "\x4f\x2a\x04\x24", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WRXB sub r8b,BYTE PTR [r12+r12*1]" },
+	{ "\x40\xa6", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex cmps BYTE PTR ds:[rsi],BYTE PTR es:[rdi]" },
+	{ "\x26\xf0\x67\x42\xff\x84\xae\xe5\xa1\xbe\x0c", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "es lock inc DWORD PTR [esi+r13d*4+0xcbea1e5]" },
+	{ "\x2e\xc4\x42\xfb\x29\x04\xcd\x40\x00\x00\x00\x0a\x90\x51\x49", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x41\x84\x2f", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "test BYTE PTR [r15],bpl" },
+	{ "\x36\x66\xf3\x41\x08\xdb", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ss data16 repz or r11b,bl" },
+	{ "\xf2\x2e\x42\xa1\x44\x24\x10\x87\x64\x7a\x52\xb0", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz cs rex.X movabs eax,ds:0xb0527a6487102444" },
+	{ "\xc5\xfc\x10\xd5", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovups ymm2,ymm5" },
+	{ "\x4c\x00\x04\x25\x78\x56\x34\x12", 8, 8, ShvEmulAdd, 1, 0x04, 0x08, 0xff, 0xff, 0, 0, 0x12345678, 0x0, "rex.WR add BYTE PTR ds:0x12345678,r8b" },
+	{ "\x3e\xc4\x01\x7e\x11\xa9\xb9\xf2\x67\xb7", 10, 10, ShvEmulMov, 4, 0x10, 0x0d, 0x09, 0xff, 0, 0, 0xffffffffb767f2b9, 0x0, "ds vmovss DWORD PTR [r9-0x48980d47],xmm13" },
+	{ "\x2e\x36\xc4\x02\x79\x2b\xa3\xf5\x7f\xb8\x25", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs ss vpackusdw xmm12,xmm0,XMMWORD PTR [r11+0x25b87ff5]" },
+	{ "\x48\xab", 2, 2, ShvEmulStos, 8, 0x04, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "stos QWORD PTR es:[rdi],rax" },
+	{ "\x66\x4f\xae", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 rex.WRXB scas al,BYTE PTR es:[rdi]" },
+	{ "\x48\x0f\xc7\x30", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W vmptrld QWORD PTR [rax]" },
+	{ "\xf0\x8b\x05\xf0\xff\xff\xff", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock mov eax,DWORD PTR [rip+0xfffffffffffffff0] # 0x18097" },
+	{ "\x48\xc7\x04\x1d\x40\x00\x00\x00\xd0\xfb\x79\xdd", 12, 12, ShvEmulMovImmediate, 8, 0x04, 0xff, 0xff, 0x03, 1, 0, 0x40, 0xffffffffdd79fbd0, "mov QWORD PTR [rbx*1+0x40],0xffffffffdd79fbd0" },
+	{ "\x65\x44\x0f\xd6\x04\x25\xf0\xff\xff\xff\x3e\xf6\x18\x54\x1f", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "gs rex.R (bad)" },
+	{ "\x26\x66\x65\x40\xc6\xd7\x86\x40\xcf\x6b\xd6\xc8\xaf\x79\x8b", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "es data16 gs rex (bad)" },
+	{ "\x48\x85\x07", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "test QWORD PTR [rdi],rax" },
+	{ "\x67\x2e\x48\x28\x05\xf0\xff\xff\xff", 9, 9, ShvEmulSub, 1, 0x0c, 0x00, 0x10, 0xff, 0, 0, 0xfffffff0, 0x0, "cs rex.W sub BYTE PTR [eip+0xfffffffffffffff0],al # 0x18139" },
+	{ "\x40\x39\xae\x69\xb0\x2d\xa5", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex cmp DWORD PTR [rsi-0x5ad24f97],ebp" },
+	{ "\x3e\x65\x67\x42\x21\x00", 6, 6, ShvEmulAnd, 4, 0x0c, 0x00, 0x00, 0xff, 0, 2, 0x0, 0x0, "ds rex.X and DWORD PTR gs:[eax],eax" },
+	{ "\x65\xf2\x3e\x0f\x28\x92\xcc\x00\x44\x02\x8e\xe9\x97\x6e\x1f", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x36\x66\xa1\xde\x4a\x05\xd1\x33\xf5\x6a\xab", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ss movabs ax,ds:0xab6af533d1054ade" },
+	{ "\x66\xf0\xc4\xe2\x79\xe7\x08", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 lock cmpnbexadd DWORD PTR [rax],ecx,eax" },
+	{ "\x40\x83\x04\x20\x2a", 5, 5, ShvEmulAdd, 4, 0x04, 0xff, 0x00, 0xff, 0, 0, 0x0, 0x2a, "rex add DWORD PTR [rax+riz*1],0x2a" },
+	{ "\x48\xff\x04\x65\x00\x10\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "inc QWORD PTR [riz*2+0x1000]" },
+	{ "\x26\x41\xa3\xb6\x8d\xbd\x0c\x43\xf5\x2d\x6a", 11, 11, ShvEmulMov, 4, 0x04, 0x00, 0xff, 0xff, 0, 0, 0x6a2df5430cbd8db6, 0x0, "es rex.B movabs ds:0x6a2df5430cbd8db6,eax" },
+	{ "\x41\xa2\x1d\x49\x95\xd9\x7c\x21\xcb\x78", 10, 10, ShvEmulMov, 1, 0x04, 0x00, 0xff, 0xff, 0, 0, 0x78cb217cd995491d, 0x0, "rex.B movabs ds:0x78cb217cd995491d,al" },
+	{ "\x40\x86\xcd", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "xchg bpl,cl" },
+	{ "\x44\xd1\x04\x25\x78\x56\x34\x12", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.R rol DWORD PTR ds:0x12345678,1" },
+	{ "\x40\x21\x05\xf0\xff\xff\xff", 7, 7, ShvEmulAnd, 4, 0x04, 0x00, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "rex and DWORD PTR [rip+0xfffffffffffffff0],eax # 0x182b7" },
+	{ "\xc4\x61\x7c\x7e\x00\xab\x4e\xf0\x59\xe0\x1d\x62\x3f\x98\x3b", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x64\xf2\xf2\x41\x32\x81\x00\x10\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz repnz xor al,BYTE PTR fs:[r9+0x1000]" },
+	{ "\x42\x38\x41\x80", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.X cmp BYTE PTR [rcx-0x80],al" },
+	{ "\x66\xc4\x21\x3d\x6f\x84\xe5\x44\x33\x22\x11\xf5\xae\x24\x14", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x48\x87\xb3\x77\x85\xd5\xfd", 7, 7, ShvEmulXchg, 8, 0x04, 0x06, 0x03, 0xff, 0, 0, 0xfffffffffdd58577, 0x0, "xchg QWORD PTR [rbx-0x22a7a89],rsi" },
+	{ "\x65\x3e\x67\x4c\x8a\x04\x25\x78\x56\x34\x12", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "gs rex.WR mov r8b,BYTE PTR gs:[eiz*1+0x12345678]" },
+	{ "\x41\x30\x5b\x71", 4, 4, ShvEmulXor, 1, 0x04, 0x03, 0x0b, 0xff, 0, 0, 0x71, 0x0, "xor BYTE PTR [r11+0x71],bl" },
+	{ "\x26\x4c\x0f\xb3\x44\x5d\xf8", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "es btr QWORD PTR [rbp+rbx*2-0x8],r8" },
+	{ "\x64\xf0\x64\x4f\x81\x03\x05\x32\x7c\x89", 10, 10, ShvEmulAdd, 8, 0x05, 0xff, 0x0b, 0xff, 0, 1, 0x0, 0xffffffff897c3205, "fs lock rex.WRXB add QWORD PTR fs:[r11],0xffffffff897c3205" },
+	{ "\x40\x0f\xb3\x6e\xb1", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex btr DWORD PTR [rsi-0x4f],ebp" },
+	{ "\x4f\x0f\x90\x05\x71\xb5\x3f\xd3", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WRXB seto BYTE PTR [rip+0xffffffffd33fb571] # 0xffffffffd3413999" },
+	{ "\x67\xf3\xc7\x84\xe5\x44\x33\x22\x11\x78\x10\x85\x15", 13, 13, ShvEmulMovImmediate, 4, 0x08, 0xff, 0x05, 0xff, 0, 0, 0x11223344, 0x15851078, "xrelease mov DWORD PTR [ebp+eiz*8+0x11223344],0x15851078" },
+	{ "\x41\x32\x03", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "xor al,BYTE PTR [r11]" },
+	{ "\x4c\x84\x04\xcd\x40\x00\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WR test BYTE PTR [rcx*8+0x40],r8b" },
+	{ "\x44\x10\x49\xd1", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "adc BYTE PTR [rcx-0x2f],r9b" },
+	{ "\xf3\x64\xc4\xc1\xf9\x89\x40\x7f\x18\xfb\xae\x2f\x41\x19\xef", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz fs (bad)" },
+	{ "\x40\x0f\x17\xb0\x06\xcb\xca\xa2", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex movhps QWORD PTR [rax-0x5d3534fa],xmm6" },
+	{ "\xc4\xe1\x7d\x7e\x66\x6d\xcb\xe4\xd7\x04\xb1\xb1\x29\x67\x57", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x41\xf7\x11", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "not DWORD PTR [r9]" },
+	{ "\x64\x64\x2e\xc4\xc2\xb8\x10\x04\x20\x14\xf4\x3f\x0f\x18\x31", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x67\x40\x39\x5b\x0a", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex cmp DWORD PTR [ebx+0xa],ebx" },
+	{ "\xf3\x2e\xc4\x01\x7b\x7e\xe8\x55\x70\x98\x8b\x5c\xd6\x45\xfc", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz cs (bad)" },
+	{ "\xf0\x67\x36\x40\x30\x04\x1d\x40\x00\x00\x00", 11, 11, ShvEmulXor, 1, 0x0d, 0x00, 0xff, 0x03, 1, 0, 0x40, 0x0, "lock ss rex xor BYTE PTR [ebx*1+0x40],al" },
+	{ "\x65\xf2\x40\xa5", 4, 4, ShvEmulMovs, 4, 0x06, 0x00, 0x07, 0xff, 0, 2, 0x0, 0x0, "repnz rex movs DWORD PTR es:[rdi],DWORD PTR gs:[rsi]" },
+	{ "\x64\x65\x66\x44\x11\x41\x51", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "fs adc WORD PTR gs:[rcx+0x51],r8w" },
+	{ "\x41\x0f\x7e\xea", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movd r10d,mm5" },
+	{ "\x40\xf7\x48\x8d\x66\xb0\xa6\xa3", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex test DWORD PTR [rax-0x73],0xa3a6b066" },
+	{ "\x67\x67\xf3\x44\x09\x28", 6, 6, ShvEmulOr, 4, 0x0c, 0x0d, 0x00, 0xff, 0, 0, 0x0, 0x0, "addr32 repz or DWORD PTR [eax],r13d" },
+	{ "\x66\xf3\x41\xc7\x5d\xc9\x4c\xd7\x16\xd8\xd2\xe0\x49\x70\x2a", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 repz rex.B (bad)" },
+	{ "\x67\x40\x8c\x01", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex mov WORD PTR [ecx],es" },
+	{ "\x42\x0f\xc0\x93\xd3\x6c\x74\xb4", 8, 8, ShvEmulXadd, 1, 0x04, 0x02, 0x03, 0xff, 0, 0, 0xffffffffb4746cd3, 0x0, "rex.X xadd BYTE PTR [rbx-0x4b8b932d],dl" },
+	{ "\x65\x48\x8f\x04\x20", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W pop QWORD PTR gs:[rax+riz*1]" },
+	{ "\x3e\x66\xc4\x41\xbc\x13\x03\x34\xbb\xa8\x3e\xd5\x44\x14\xf2", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xf0\x42\x0f\xc3\x4d\xea", 6, 6, ShvEmulMov, 4, 0x05, 0x01, 0x05, 0xff, 0, 0, 0xffffffffffffffea, 0x0, "lock rex.X movnti DWORD PTR [rbp-0x16],ecx" },
+	{ "\x4f\x21\xb5\xde\x45\x44\x45", 7, 7, ShvEmulAnd, 8, 0x04, 0x0e, 0x0d, 0xff, 0, 0, 0x454445de, 0x0, "rex.WRXB and QWORD PTR [r13+0x454445de],r14" },
+	{ "\xc4\x21\xfd\x6f\x41\x80", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovdqa ymm8,YMMWORD PTR [rcx-0x80]" },
+	{ "\x44\x80\x03\xb9", 4, 4, ShvEmulAdd, 1, 0x04, 0xff, 0x03, 0xff, 0, 0, 0x0, 0xb9, "rex.R add BYTE PTR [rbx],0xb9" },
+	{ "\x42\x0f\xc0\xa0\xbc\x7d\x8a\xd8", 8, 8, ShvEmulXadd, 1, 0x04, 0x04, 0x00, 0xff, 0, 0, 0xffffffffd88a7dbc, 0x0, "rex.X xadd BYTE PTR [rax-0x27758244],spl" },
+	{ "\xf0\x64\x36\x4f\x0f\xc3\xde\xcb\x38\x2a\xf2\xce\x55\x96\x08", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock fs ss rex.WRXB (bad)" },
+	{ "\x44\x83\x5d\x59\xf2", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.R sbb DWORD PTR [rbp+0x59],0xfffffff2" },
+	{ "\x3e\x64\x44\xc6\x44\x24\x10\x9d", 8, 8, ShvEmulMovImmediate, 1, 0x04, 0xff, 0x04, 0xff, 0, 1, 0x10, 0x9d, "ds rex.R mov BYTE PTR fs:[rsp+0x10],0x9d" },
+	{ "\x36\x44\x0f\xc7\xfb", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ss rex.R rdseed ebx" },
+	{ "\x48\x8a\xe9", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W mov bpl,cl" },
+	{ "\xc5\x78\x13\x4a\x3a", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovlps QWORD PTR [rdx+0x3a],xmm9" },
+	{ "\xf2\xc4\xc1\x7c\x11\x05\xf0\xff\xff\xff", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz vmovups YMMWORD PTR [rip+0xfffffffffffffff0],ymm0 # 0x1885a" },
+	{ "\xf3\x42\x88\x04\x25\xf0\xff\xff\xff", 9, 9, ShvEmulMov, 1, 0x04, 0x00, 0xff, 0x0c, 1, 0, 0xfffffffffffffff0, 0x0, "xrelease mov BYTE PTR [r12*1-0x10],al" },
+	{ "\x85\x8b\x04\x6d\xc8\xba", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "test DWORD PTR [rbx-0x453792fc],ecx" },
+	{ "\x44\xa5", 2, 2, ShvEmulMovs, 4, 0x04, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "rex.R movs DWORD PTR es:[rdi],DWORD PTR ds:[rsi]" },
+	{ "\x44\xf7\x05\xf0\xff\xff\xff\x39\xcf\xb7\x20", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.R test DWORD PTR [rip+0xfffffffffffffff0],0x20b7cf39 # 0x188db" },
+	{ "\x67\xd1\xe0", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "addr32 shl eax,1" },
+	{ "\xf0\x4c\x00\x91\xf0\xe3\x40\xef", 8, 8, ShvEmulAdd, 1, 0x05, 0x0a, 0x01, 0xff, 0, 0, 0xffffffffef40e3f0, 0x0, "lock rex.WR add BYTE PTR [rcx-0x10bf1c10],r10b" },
+	{ "\x67\xf2\xc4\xc1\x7f\x11\xa5\x06\x9f\x7e\x89", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz vmovsd QWORD PTR [r13d-0x768160fa],xmm4" },
+	{ "\x65\x26\x87\x05\x10\x00\x00\x00", 8, 8, ShvEmulXchg, 4, 0x00, 0x00, 0x10, 0xff, 0, 2, 0x10, 0x0, "gs xchg DWORD PTR gs:[rip+0x10],eax # 0x18978" },
+	{ "\x42\x01\x6f\xd7", 4, 4, ShvEmulAdd, 4, 0x04, 0x05, 0x07, 0xff, 0, 0, 0xffffffffffffffd7, 0x0, "rex.X add DWORD PTR [rdi-0x29],ebp" },
+	{ "\x66\xc4\xe2\x3d\x11\x81\x00\x10\x00\x00\x42\xe7\x27\x39\x21", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x4c\x30\xfe", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WR xor sil,r15b" },
+	{ "\x8a\x41\x80", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov al,BYTE PTR [rcx-0x80]" },
+	{ "\x3e\x26\x4c\xa5", 4, 4, ShvEmulMovs, 8, 0x04, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "ds rex.WR movs QWORD PTR es:[rdi],QWORD PTR ds:[rsi]" },
+	{ "\x44\x39\x04\x65\x00\x10\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmp DWORD PTR [riz*2+0x1000],r8d" },
+	{ "\xc4\x21\xfd\xe7\x52\x34", 6, 6, ShvEmulMov, 32, 0x10, 0x0a, 0x02, 0xff, 0, 0, 0x34, 0x0, "vmovntdq YMMWORD PTR [rdx+0x34],ymm10" },
+	{ "\x42\xa2\x06\xe9\x63\x28\xfe\xe9\x3a\x3b", 10, 10, ShvEmulMov, 1, 0x04, 0x00, 0xff, 0xff, 0, 0, 0x3b3ae9fe2863e906, 0x0, "rex.X movabs ds:0x3b3ae9fe2863e906,al" },
+	{ "\xf2\x40\x80\xe2\x0b", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz rex and dl,0xb" },
+	{ "\x42\x0f\xab\x24\x17", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "bts DWORD PTR [rdi+r10*1],esp" },
+	{ "\x65\x67\x66\x41\x0f\xb3\x06", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "btr WORD PTR gs:[r14d],ax" },
+	{ "\xf2\x2e\xc4\xc1\x78\xd6\x57\x81\xe2\x74\x85\x9a\xb4\x7a\x64", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x26\x36\xf3\x44\x01\xd1", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "es ss repz add ecx,r10d" },
+	{ "\x65\x41\x81\x40\x7f\x17\xb0\x5b\x04", 9, 9, ShvEmulAdd, 4, 0x04, 0xff, 0x08, 0xff, 0, 2, 0x7f, 0x45bb017, "add DWORD PTR gs:[r8+0x7f],0x45bb017" },
+	{ "\x2e\x4c\x2a\x00", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs rex.WR sub r8b,BYTE PTR [rax]" },
+	{ "\x26\xf3\xf0\x4f\x81\x0e\xf2\x92\x47\x96", 10, 10, ShvEmulOr, 8, 0x05, 0xff, 0x0e, 0xff, 0, 0, 0x0, 0xffffffff964792f2, "es xrelease lock rex.WRXB or QWORD PTR [r14],0xffffffff964792f2" },
+	{ "\x48\x0f\xe7\x81\x00\x10\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W movntq QWORD PTR [rcx+0x1000],mm0" },
+	{ "\x44\x81\x40\x7f\x17\x15\x30\xec", 8, 8, ShvEmulAdd, 4, 0x04, 0xff, 0x00, 0xff, 0, 0, 0x7f, 0xec301517, "rex.R add DWORD PTR [rax+0x7f],0xec301517" },
+	{ "\xf2\x0f\x6f\x6c\xcd\x34\xa0\x80\x2a\x69\x92\x1d\xe7\x56\x99", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x3e\x44\xf7\xd7", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ds rex.R not edi" },
+	{ "\xc4\xa1\x7d\x13\x9d\x29\x6e\xa4\x6b\x93\x57\x6c\x75\xbb\x6f", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x64\x64\x67\xc4\x21\x7d\xd6\x04\x20\x60\x7b\xb9\xc8\x4a\x33", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "fs fs addr32 (bad)" },
+	{ "\x36\x26\x36\x42\x0f\x7e\x04\x24", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ss es ss movd DWORD PTR [rsp+r12*1],mm0" },
+	{ "\x4f\x8b\x8e\x83\x8c\xd8\xd0", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WRXB mov r9,QWORD PTR [r14-0x2f27737d]" },
+	{ "\x66\x26\x44\x2a\x04\xcd\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 es sub r8b,BYTE PTR [rcx*8+0x40]" },
+	{ "\xc4\xe1\xfa\x7e\xf5", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovq xmm6,xmm5" },
+	{ "\x65\x41\x10\xb3\xa8\xc2\x64\xa8", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "adc BYTE PTR gs:[r11-0x579b3d58],sil" },
+	{ "\x4c\xab", 2, 2, ShvEmulStos, 8, 0x04, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "rex.WR stos QWORD PTR es:[rdi],rax" },
+	{ "\xf0\x42\x0f\x7e\x05\xf0\xff\xff\xff", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock rex.X movd DWORD PTR [rip+0xfffffffffffffff0],mm0 # 0x18cf9" },
+	{ "\x64\x4c\x0f\x11\x67\x8b", 6, 6, ShvEmulMov, 16, 0x14, 0x0c, 0x07, 0xff, 0, 1, 0xffffffffffffff8b, 0x0, "rex.WR movups XMMWORD PTR fs:[rdi-0x75],xmm12" },
+	{ "\x4f\x01\x7b\x27", 4, 4, ShvEmulAdd, 8, 0x04, 0x0f, 0x0b, 0xff, 0, 0, 0x27, 0x0, "rex.WRXB add QWORD PTR [r11+0x27],r15" },
+	{ "\x36\x65\x36\x4f\x0f\xae\x07", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ss gs rex.WRXB fxsave64 gs:[r15]" },
+	{ "\x48\x0a\x85\x00\x00\x00\x80", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W or al,BYTE PTR [rbp-0x80000000]" },
+	{ "\xf2\xc4\x41\x7c\x89\x22\x2e\x58\x92\xad\xbc\x4f\x4b\x11\x5c", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz (bad)" },
+	{ "\xf0\x42\x01\x85\x00\x00\x00\x80", 8, 8, ShvEmulAdd, 4, 0x05, 0x00, 0x05, 0xff, 0, 0, 0xffffffff80000000, 0x0, "lock rex.X add DWORD PTR [rbp-0x80000000],eax" },
+	{ "\x0f\xe7\xad\x3e\xe4\xc8\x3c", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movntq QWORD PTR [rbp+0x3cc8e43e],mm5" },
+	{ "\x65\x40\x0f\xc1\xae\xb4\xbf\x45\xa1", 9, 9, ShvEmulXadd, 4, 0x04, 0x05, 0x06, 0xff, 0, 2, 0xffffffffa145bfb4, 0x0, "rex xadd DWORD PTR gs:[rsi-0x5eba404c],ebp" },
+	{ "\x65\xf2\x44\x8f\x6c\xb3\x3e\x38\xbe\x08\x7a\xc9\xbd\x20\x8a", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "gs repnz rex.R (bad)" },
+	{ "\x00\xf9", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "add cl,bh" },
+	{ "\x64\x42\xfe\x00", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.X inc BYTE PTR fs:[rax]" },
+	{ "\x26\x41\x0f\x28\x04\x25\x78\x56\x34\x12", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "es movaps xmm0,XMMWORD PTR ds:0x12345678" },
+	{ "\x64\x64\x4c\x8b\xd0", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "fs fs mov r10,rax" },
+	{ "\x48\xa5", 2, 2, ShvEmulMovs, 8, 0x04, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "movs QWORD PTR es:[rdi],QWORD PTR ds:[rsi]" },
+	{ "\xf2\x2e\x40\x0f\xb0\x26", 6, 6, ShvEmulCmpxchg, 1, 0x04, 0x04, 0x06, 0xff, 0, 0, 0x0, 0x0, "repnz cs cmpxchg BYTE PTR [rsi],spl" },
+	{ "\xf0\x4f\xc6\x03\x55", 5, 5, ShvEmulMovImmediate, 1, 0x05, 0xff, 0x0b, 0xff, 0, 0, 0x0, 0x55, "lock rex.WRXB mov BYTE PTR [r11],0x55" },
+	{ "\xf2\x40\xc0\x85\x00\x00\x00\x80\x2a", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz rex rol BYTE PTR [rbp-0x80000000],0x2a" },
+	{ "\x67\x67\x64\x41\x02\x59\x13", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "addr32 add bl,BYTE PTR fs:[r9d+0x13]" },
+	{ "\x26\x4f\xd1\x36", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "es rex.WRXB shl QWORD PTR [r14],1" },
+	{ "\x65\x36\x4f\xaa", 4, 4, ShvEmulStos, 1, 0x04, 0x00, 0x07, 0xff, 0, 2, 0x0, 0x0, "gs ss rex.WRXB stos BYTE PTR es:[rdi],al" },
+	{ "\x64\xf2\x26\x41\x22\x5e\xae", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "fs repnz and bl,BYTE PTR fs:[r14-0x52]" },
+	{ "\x36\x66\x40\x0f\xc7\x88\x80\xf5\xa0\xa7", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ss data16 rex cmpxchg8b QWORD PTR [rax-0x585f0a80]" },
+	{ "\x26\x64\xf2\x0f\x7f\x9a\xbb\xa2\x2a\xc2\xb9\xae\x3c\x75\xb6", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "es fs (bad)" },
+	{ "\x40\x0f\x6f\x7b\x70", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex movq mm7,QWORD PTR [rbx+0x70]" },
+	{ "\x65\x64\x0f\x28\x85\x00\x00\x00\x80", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "gs movaps xmm0,XMMWORD PTR fs:[rbp-0x80000000]" },
+	{ "\xf0\xf0\x41\x0f\x2b\x54\x29\x87", 8, 8, ShvEmulMov, 16, 0x15, 0x02, 0x09, 0x05, 1, 0, 0xffffffffffffff87, 0x0, "lock lock movntps XMMWORD PTR [r9+rbp*1-0x79],xmm2" },
+	{ "\x65\x3e\x40\x21\x45\x08", 6, 6, ShvEmulAnd, 4, 0x04, 0x00, 0x05, 0xff, 0, 2, 0x8, 0x0, "gs rex and DWORD PTR gs:[rbp+0x8],eax" },
+	{ "\x65\x40\xaa", 3, 3, ShvEmulStos, 1, 0x04, 0x00, 0x07, 0xff, 0, 2, 0x0, 0x0, "gs rex stos BYTE PTR es:[rdi],al" },
+	{ "\x36\x42\xab", 3, 3, ShvEmulStos, 4, 0x04, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "ss rex.X stos DWORD PTR es:[rdi],eax" },
+	{ "\x66\x48\x20\x05\x10\x00\x00\x00", 8, 8, ShvEmulAnd, 1, 0x04, 0x00, 0x10, 0xff, 0, 0, 0x10, 0x0, "data16 rex.W and BYTE PTR [rip+0x10],al # 0x190d8" },
+	{ "\x64\x48\xf6\x04\xa0\xe1", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W test BYTE PTR fs:[rax+riz*4],0xe1" },
+	{ "\x66\xc4\x41\xbd\x10\x20\xa6\x67\x4c\x9a\x08\xf4\xc8\x04\xae", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x4c\x85\x05\xf0\xff\xff\xff", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "test QWORD PTR [rip+0xfffffffffffffff0],r8 # 0x19117" },
+	{ "\xf2\x0f\x10\x85\x00\x00\x00\x80", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movsd xmm0,QWORD PTR [rbp-0x80000000]" },
+	{ "\xf2\x4f\xff\x60\x4c", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "bnd rex.WRXB jmp QWORD PTR [r8+0x4c]" },
+	{ "\x48\x89\x18", 3, 3, ShvEmulMov, 8, 0x04, 0x03, 0x00, 0xff, 0, 0, 0x0, 0x0, "mov QWORD PTR [rax],rbx" },
+	{ "\x42\x0f\x13\x04\x98", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movlps QWORD PTR [rax+r11*4],xmm0" },
+	{ "\x42\x81\x44\x5d\xf8\xf4\x2f\x28\xdb", 9, 9, ShvEmulAdd, 4, 0x04, 0xff, 0x05, 0x0b, 2, 0, 0xfffffffffffffff8, 0xdb282ff4, "add DWORD PTR [rbp+r11*2-0x8],0xdb282ff4" },
+	{ "\x0f\x7f\x44\x24\x10", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movq QWORD PTR [rsp+0x10],mm0" },
+	{ "\x40\x0f\xc1\x84\xe5\x44\x33\x22\x11", 9, 9, ShvEmulXadd, 4, 0x04, 0x00, 0x05, 0xff, 0, 0, 0x11223344, 0x0, "rex xadd DWORD PTR [rbp+riz*8+0x11223344],eax" },
+	{ "\x2e\x40\x21\x84\xe5\x44\x33\x22\x11", 9, 9, ShvEmulAnd, 4, 0x04, 0x00, 0x05, 0xff, 0, 0, 0x11223344, 0x0, "cs rex and DWORD PTR [rbp+riz*8+0x11223344],eax" },
+	{ "\x42\x0f\xc0\xaa\x44\x4b\xb9\x91", 8, 8, ShvEmulXadd, 1, 0x04, 0x05, 0x02, 0xff, 0, 0, 0xffffffff91b94b44, 0x0, "rex.X xadd BYTE PTR [rdx-0x6e46b4bc],bpl" },
+	{ "\x4f\x0f\xd6\x04\xa0\xb6\x97\xeb\xe2\xe6\x2a\xb4\x11\xef\x69", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WRXB (bad)" },
+	{ "\x26\x4f\x87\x41\x80", 5, 5, ShvEmulXchg, 8, 0x04, 0x08, 0x09, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "es rex.WRXB xchg QWORD PTR [r9-0x80],r8" },
+	{ "\xf3\x3e\xf0\x0f\xae\x04\xa0", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz ds lock fxsave [rax+riz*4]" },
+	{ "\x67\xc4\x02\x7a\x6f\x65\x2e\xb4\x10\x71\x1f\x3e\x38\x98\x7a", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "addr32 (bad)" },
+	{ "\x48\x18\x44\x24\x10", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W sbb BYTE PTR [rsp+0x10],al" },
+	{ "\x26\x4c\xa5", 3, 3, ShvEmulMovs, 8, 0x04, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "rex.WR movs QWORD PTR es:[rdi],QWORD PTR ds:[rsi]" },
+	{ "\x3e\x3e\x67\x41\xa5", 5, 5, ShvEmulMovs, 4, 0x0c, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "ds rex.B movs DWORD PTR es:[edi],DWORD PTR ds:[esi]" },
+	{ "\x40\x28\xd0", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex sub al,dl" },
+	{ "\x41\x88\x6e\x5f", 4, 4, ShvEmulMov, 1, 0x04, 0x05, 0x0e, 0xff, 0, 0, 0x5f, 0x0, "mov BYTE PTR [r14+0x5f],bpl" },
+	{ "\x0f\x29\x9e\xd7\xe9\xf8\xba", 7, 7, ShvEmulMov, 16, 0x10, 0x03, 0x06, 0xff, 0, 0, 0xffffffffbaf8e9d7, 0x0, "movaps XMMWORD PTR [rsi-0x45071629],xmm3" },
+	{ "\xc4\x21\x7f\x11\x83\x3c\x68\x6b\xba", 9, 9, ShvEmulMov, 8, 0x10, 0x08, 0x03, 0xff, 0, 0, 0xffffffffba6b683c, 0x0, "vmovsd QWORD PTR [rbx-0x459497c4],xmm8" },
+	{ "\x42\x39\x10", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.X cmp DWORD PTR [rax],edx" },
+	{ "\x67\xc4\xa1\x79\x2b\xb2\xf3\xd8\x03\x1f", 10, 10, ShvEmulMov, 16, 0x18, 0x06, 0x02, 0xff, 0, 0, 0x1f03d8f3, 0x0, "vmovntpd XMMWORD PTR [edx+0x1f03d8f3],xmm6" },
+	{ "\x0f\x10\x85\x00\x00\x00\x80", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movups xmm0,XMMWORD PTR [rbp-0x80000000]" },
+	{ "\x64\x3e\x4c\xa5", 4, 4, ShvEmulMovs, 8, 0x04, 0x00, 0x07, 0xff, 0, 1, 0x0, 0x0, "fs rex.WR movs QWORD PTR es:[rdi],QWORD PTR fs:[rsi]" },
+	{ "\x4c\x0a\xcf", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WR or r9b,dil" },
+	{ "\x4f\x0f\x28\x40\x7f", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WRXB movaps xmm8,XMMWORD PTR [r8+0x7f]" },
+	{ "\x4c\xf7\x41\x80\xd6\x1d\x5f\xcd", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WR test QWORD PTR [rcx-0x80],0xffffffffcd5f1dd6" },
+	{ "\xf0\x42\x18\x44\x5d\xf8", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock sbb BYTE PTR [rbp+r11*2-0x8],al" },
+	{ "\x3e\x48\x87\x04\x25\xf0\xff\xff\xff", 9, 9, ShvEmulXchg, 8, 0x04, 0x00, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "ds xchg QWORD PTR ds:0xfffffffffffffff0,rax" },
+	{ "\x3e\x42\x0f\x29\x00", 5, 5, ShvEmulMov, 16, 0x14, 0x00, 0x00, 0xff, 0, 0, 0x0, 0x0, "ds rex.X movaps XMMWORD PTR [rax],xmm0" },
+	{ "\x4c\xa5", 2, 2, ShvEmulMovs, 8, 0x04, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "rex.WR movs QWORD PTR es:[rdi],QWORD PTR ds:[rsi]" },
+	{ "\x42\x00\x39", 3, 3, ShvEmulAdd, 1, 0x04, 0x07, 0x01, 0xff, 0, 0, 0x0, 0x0, "rex.X add BYTE PTR [rcx],dil" },
+	{ "\xf2\x66\x66\x42\x0f\xab\x04\x25\x78\x56\x34\x12", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz data16 bts WORD PTR [r12*1+0x12345678],ax" },
+	{ "\x66\x42\x83\x04\xcd\x40\x00\x00\x00\x6c", 10, 10, ShvEmulAdd, 2, 0x04, 0xff, 0xff, 0x09, 8, 0, 0x40, 0x6c, "add WORD PTR [r9*8+0x40],0x6c" },
+	{ "\x44\x29\x03", 3, 3, ShvEmulSub, 4, 0x04, 0x08, 0x03, 0xff, 0, 0, 0x0, 0x0, "sub DWORD PTR [rbx],r8d" },
+	{ "\x40\x32\x85\x00\x00\x00\x80", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex xor al,BYTE PTR [rbp-0x80000000]" },
+	{ "\x48\x0f\xb3\x04\x65\x00\x10\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "btr QWORD PTR [riz*2+0x1000],rax" },
+	{ "\x64\x48\x20\x06", 4, 4, ShvEmulAnd, 1, 0x04, 0x00, 0x06, 0xff, 0, 1, 0x0, 0x0, "rex.W and BYTE PTR fs:[rsi],al" },
+	{ "\x36\xc4\x62\x7e\x29\x74\xbe\x62\xab\x60\x1a\x0b\x26\x93\x12", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x3e\x3e\xf0\xc4\x81\xf9\xd6\x40\x7f", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ds ds lock vmovq QWORD PTR [r8+0x7f],xmm0" },
+	{ "\xf2\x3e\xf0\xc4\x81\x7e\x7f\xc9", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz ds lock vmovdqu ymm9,ymm1" },
+	{ "\x4c\xfe\x04\x25\x78\x56\x34\x12", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WR inc BYTE PTR ds:0x12345678" },
+	{ "\xc4\x82\xfe\x7e\x84\xcb\xe5\xca\xdf\x9b\x0a\x73\x75\x81\x2f", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x81\x3f\xd6\x03\x6e\xdf\xe9\x21\xad\x1c\x99\xf1\x06\x97", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x36\xf3\x40\xac", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rep rex lods al,BYTE PTR ds:[rsi]" },
+	{ "\x65\xc4\x21\xfc\x29\x91\x18\xcb\x5f\xc6", 10, 10, ShvEmulMov, 32, 0x10, 0x0a, 0x01, 0xff, 0, 2, 0xffffffffc65fcb18, 0x0, "vmovaps YMMWORD PTR gs:[rcx-0x39a034e8],ymm10" },
+	{ "\x8c\x34\xb0", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov WORD PTR [rax+rsi*4],?" },
+	{ "\x36\x4f\x09\xb8\x33\xde\x8d\x4b", 8, 8, ShvEmulOr, 8, 0x04, 0x0f, 0x08, 0xff, 0, 0, 0x4b8dde33, 0x0, "ss rex.WRXB or QWORD PTR [r8+0x4b8dde33],r15" },
+	{ "\x26\x40\x28\xb6\x6b\xc1\x4a\x07", 8, 8, ShvEmulSub, 1, 0x04, 0x06, 0x06, 0xff, 0, 0, 0x74ac16b, 0x0, "es sub BYTE PTR [rsi+0x74ac16b],sil" },
+	{ "\x4f\x0f\xb1\x38", 4, 4, ShvEmulCmpxchg, 8, 0x04, 0x0f, 0x08, 0xff, 0, 0, 0x0, 0x0, "rex.WRXB cmpxchg QWORD PTR [r8],r15" },
+	{ "\x65\x44\x0f\x7e\x04\x65\x00\x10\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.R movd DWORD PTR gs:[riz*2+0x1000],mm0" },
+	{ "\x2e\xc4\x01\xff\x7e\x07\x1c\x4d\x36\x20\x3f\x40\x4c\xc6\x06", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs (bad)" },
+	{ "\x26\x66\x4c\x0f\x17\x07", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "es rex.WR movhpd QWORD PTR [rdi],xmm8" },
+	{ "\xf3\x4c\x30\x04\x20", 5, 5, ShvEmulXor, 1, 0x04, 0x08, 0x00, 0xff, 0, 0, 0x0, 0x0, "repz rex.WR xor BYTE PTR [rax+riz*1],r8b" },
+	{ "\xf3\x4f\xae", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz rex.WRXB scas al,BYTE PTR es:[rdi]" },
+	{ "\xc4\x21\x3d\x7e\x03\x15\xb3\xc7\x91\x10\xbf\xb0\xa5\x66\x54", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x48\x0f\xae\x2a", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "xrstor64 [rdx]" },
+	{ "\x67\x2e\x4f\xf6\x40\x7f\xa3", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs rex.WRXB test BYTE PTR [r8d+0x7f],0xa3" },
+	{ "\x67\x65\xc4\xe1\xff\x89\x04\x20\x6f\x14\xf0\xc4\xc4\x52\x62", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "addr32 gs (bad)" },
+	{ "\x67\x40\x22\x47\x41", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex and al,BYTE PTR [edi+0x41]" },
+	{ "\xc4\x81\xfb\x7f\x06\xa2\x8b\x20\xa2\xaa\x91\xa1\xd0\xd4\xfa", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xf0\x3e\x42\x03\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock ds rex.X add eax,DWORD PTR [rax]" },
+	{ "\xf3\x26\x4f\x09\x04\xa0", 6, 6, ShvEmulOr, 8, 0x04, 0x08, 0x08, 0x0c, 4, 0, 0x0, 0x0, "repz es or QWORD PTR [r8+r12*4],r8" },
+	{ "\x64\x4f\x80\x04\x25\x78\x56\x34\x12\xa3", 10, 10, ShvEmulAdd, 1, 0x04, 0xff, 0xff, 0x0c, 1, 1, 0x12345678, 0xa3, "rex.WRXB add BYTE PTR fs:[r12*1+0x12345678],0xa3" },
+	{ "\x66\x0f\xc1\xa5\xcd\xb1\x91\x52", 8, 8, ShvEmulXadd, 2, 0x00, 0x04, 0x05, 0xff, 0, 0, 0x5291b1cd, 0x0, "xadd WORD PTR [rbp+0x5291b1cd],sp" },
+	{ "\x4f\xa7", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WRXB cmps QWORD PTR ds:[rsi],QWORD PTR es:[rdi]" },
+	{ "\x67\xc4\x61\xf8\x7e\xa5\x87\xee\x0a\xd4\xc9\xf5\x43\xba\x52", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "addr32 (bad)" },
+	{ "\x66\x26\x41\x0f\xae\x66\x30\xce\x47\x77\xc5\xae\x46\x59\x7a", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "es rex.B (bad)" },
+	{ "\x26\x3e\xf0\x40\x0f\x7f\x8b\x70\xd3\x18\x2e", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "es ds lock rex movq QWORD PTR [rbx+0x2e18d370],mm1" },
+	{ "\xf0\xf3\x64\xc4\x21\x38\xe7\x81\x00\x10\x00\x00\xf3\x54\x89", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x3e\x36\x44\x10\x7a\xbf", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ds ss adc BYTE PTR [rdx-0x41],r15b" },
+	{ "\xf2\x44\xc7\x04\x25\x78\x56\x34\x12\xde\x49\xad\x40", 13, 13, ShvEmulMovImmediate, 4, 0x04, 0xff, 0xff, 0xff, 0, 0, 0x12345678, 0x40ad49de, "repnz rex.R mov DWORD PTR ds:0x12345678,0x40ad49de" },
+	{ "\x84\x04\x98", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "test BYTE PTR [rax+rbx*4],al" },
+	{ "\x2e\x44\x8b\x04\x98", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs mov r8d,DWORD PTR [rax+rbx*4]" },
+	{ "\x67\xc6\x70\xe5\xa7\x23\x75\x54\x9e\xc1\xa9\x65\xc7\x03\xe1", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "addr32 (bad)" },
+	{ "\xf2\x26\xc4\x02\x7a\x6f\x07\x77\xab\xd2\xac\x84\xce\xbf\x0d", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz es (bad)" },
+	{ "\x64\x48\x0f\x2b\x64\xbe\xfe", 7, 7, ShvEmulMov, 16, 0x14, 0x04, 0x06, 0x07, 4, 1, 0xfffffffffffffffe, 0x0, "rex.W movntps XMMWORD PTR fs:[rsi+rdi*4-0x2],xmm4" },
+	{ "\x26\x66\x66\x0f\xb1\xbf\xb1\xc1\x08\xc0", 10, 10, ShvEmulCmpxchg, 2, 0x00, 0x07, 0x07, 0xff, 0, 0, 0xffffffffc008c1b1, 0x0, "es data16 cmpxchg WORD PTR [rdi-0x3ff73e4f],di" },
+	{ "\xf2\xc4\x42\xbc\x2b\x5c\xa8\x5a\x50\x34\xed\xc4\x91\x85\x56", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x48\x30\x81\x00\x10\x00\x00", 7, 7, ShvEmulXor, 1, 0x04, 0x00, 0x01, 0xff, 0, 0, 0x1000, 0x0, "rex.W xor BYTE PTR [rcx+0x1000],al" },
+	{ "\x66\x4f\x87\x04\xa0", 5, 5, ShvEmulXchg, 8, 0x04, 0x08, 0x08, 0x0c, 4, 0, 0x0, 0x0, "data16 xchg QWORD PTR [r8+r12*4],r8" },
+	{ "\x65\x26\x4f\xa4", 4, 4, ShvEmulMovs, 1, 0x04, 0x00, 0x07, 0xff, 0, 2, 0x0, 0x0, "gs rex.WRXB movs BYTE PTR es:[rdi],BYTE PTR gs:[rsi]" },
+	{ "\x3e\x42\x10\x81\x00\x10\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ds rex.X adc BYTE PTR [rcx+0x1000],al" },
+	{ "\x44\x0f\xe7\x07", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.R movntq QWORD PTR [rdi],mm0" },
+	{ "\x4f\x0f\x7f\x04\xcd\x40\x00\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WRXB movq QWORD PTR [r9*8+0x40],mm0" },
+	{ "\xf0\xf3\x41\x0f\xb0\x97\xbf\x81\xbb\x78", 10, 10, ShvEmulCmpxchg, 1, 0x05, 0x02, 0x0f, 0xff, 0, 0, 0x78bb81bf, 0x0, "lock xrelease cmpxchg BYTE PTR [r15+0x78bb81bf],dl" },
+	{ "\xf2\xc4\x61\x7c\x7f\x05\x10\x00\x00\x00\x0e\x45\xe3\x0c\xc6", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz (bad)" },
+	{ "\x67\x65\x4f\xd1\x04\xa0", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WRXB rol QWORD PTR gs:[r8d+r12d*4],1" },
+	{ "\x65\xf2\x26\x41\xff\x44\x5d\xf8", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "gs repnz inc DWORD PTR gs:[r13+rbx*2-0x8]" },
+	{ "\xc4\xe1\x7b\x10\x04\x25\xf0\xff\xff\xff", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovsd xmm0,QWORD PTR ds:0xfffffffffffffff0" },
+	{ "\x67\x42\x08\x21", 4, 4, ShvEmulOr, 1, 0x0c, 0x04, 0x01, 0xff, 0, 0, 0x0, 0x0, "rex.X or BYTE PTR [ecx],spl" },
+	{ "\xf2\x4f\x28\x18", 4, 4, ShvEmulSub, 1, 0x04, 0x0b, 0x08, 0xff, 0, 0, 0x0, 0x0, "repnz rex.WRXB sub BYTE PTR [r8],r11b" },
+	{ "\x26\x48\xc0\x00\x89", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "es rex.W rol BYTE PTR [rax],0x89" },
+	{ "\xf3\xf0\x4f\x31\x85\x00\x00\x00\x80", 9, 9, ShvEmulXor, 8, 0x05, 0x08, 0x0d, 0xff, 0, 0, 0xffffffff80000000, 0x0, "xrelease lock rex.WRXB xor QWORD PTR [r13-0x80000000],r8" },
+	{ "\x67\x66\x4f\x0f\x11\x06", 6, 6, ShvEmulMov, 16, 0x1c, 0x08, 0x0e, 0xff, 0, 0, 0x0, 0x0, "rex.WRXB movupd XMMWORD PTR [r14d],xmm8" },
+	{ "\x40\x0f\xb3\x71\x88", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex btr DWORD PTR [rcx-0x78],esi" },
+	{ "\x36\x41\x0f\xb3\xde", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ss btr r14d,ebx" },
+	{ "\x4c\x8f\x45\x2c", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WR pop QWORD PTR [rbp+0x2c]" },
+	{ "\x2e\x44\x87\x04\x1d\x40\x00\x00\x00", 9, 9, ShvEmulXchg, 4, 0x04, 0x08, 0xff, 0x03, 1, 0, 0x40, 0x0, "cs xchg DWORD PTR [rbx*1+0x40],r8d" },
+	{ "\x26\x40\xa5", 3, 3, ShvEmulMovs, 4, 0x04, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "rex movs DWORD PTR es:[rdi],DWORD PTR ds:[rsi]" },
+	{ "\x0f\xe7\x04\x65\x00\x10\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movntq QWORD PTR [riz*2+0x1000],mm0" },
+	{ "\x3e\x0f\xab\xe5", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ds bts ebp,esp" },
+	{ "\x26\x42\x28\x2a", 4, 4, ShvEmulSub, 1, 0x04, 0x05, 0x02, 0xff, 0, 0, 0x0, 0x0, "es rex.X sub BYTE PTR [rdx],bpl" },
+	{ "\xf0\x66\xf0\x4f\x0f\xb3\x28", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock data16 lock rex.WRXB btr QWORD PTR [r8],r13" },
+	{ "\x64\x65\x42\x0f\x10\x85\x00\x00\x00\x80", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "fs rex.X movups xmm0,XMMWORD PTR gs:[rbp-0x80000000]" },
+	{ "\x40\x88\x04\x25\xf0\xff\xff\xff", 8, 8, ShvEmulMov, 1, 0x04, 0x00, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "rex mov BYTE PTR ds:0xfffffffffffffff0,al" },
+	{ "\x48\x0f\x11\x04\x98", 5, 5, ShvEmulMov, 16, 0x14, 0x00, 0x00, 0x03, 4, 0, 0x0, 0x0, "rex.W movups XMMWORD PTR [rax+rbx*4],xmm0" },
+	{ "\x65\x4f\x08\x29", 4, 4, ShvEmulOr, 1, 0x04, 0x0d, 0x09, 0xff, 0, 2, 0x0, 0x0, "rex.WRXB or BYTE PTR gs:[r9],r13b" },
+	{ "\xf3\x41\x11\x44\x24\x10", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz adc DWORD PTR [r12+0x10],eax" },
+	{ "\x66\x66\x65\x44\xf7\x04\x25\x78\x56\x34\x12\x8a\xc4", 13, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 rex.R test WORD PTR gs:0x12345678,0xc48a" },
+	{ "\xc4\x01\xbc\x29\x1c\xc8\xdd\xe1\x6e\xe5\x01\x3f\xdb\xdc\x3a", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xf2\x4f\xae", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz rex.WRXB scas al,BYTE PTR es:[rdi]" },
+	{ "\x64\x48\x86\x00", 4, 4, ShvEmulXchg, 1, 0x04, 0x00, 0x00, 0xff, 0, 1, 0x0, 0x0, "rex.W xchg BYTE PTR fs:[rax],al" },
+	{ "\x4f\xa1\x04\x1d\x40\x00\x00\x00\xe8\xec", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WRXB movabs rax,ds:0xece8000000401d04" },
+	{ "\x42\x11\x2a", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.X adc DWORD PTR [rdx],ebp" },
+	{ "\xc4\x61\xfe\x6f\x06", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovdqu ymm8,YMMWORD PTR [rsi]" },
+	{ "\x67\x03\x40\x7f", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "add eax,DWORD PTR [eax+0x7f]" },
+	{ "\x3e\x65\x4c\x88\x45\x08", 6, 6, ShvEmulMov, 1, 0x04, 0x08, 0x05, 0xff, 0, 2, 0x8, 0x0, "ds rex.WR mov BYTE PTR gs:[rbp+0x8],r8b" },
+	{ "\xf3\x67\x65\x48\x0f\x17\x3c\xcc\xb2\x1b\xc8\xe8\x3d\xbc\xb0", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x66\x26\x4f\x39\x04\x20", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 es cmp QWORD PTR [r8+r12*1],r8" },
+	{ "\xff\x99\x97\xfd\xb2\xdc", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "call FWORD PTR [rcx-0x234d0269]" },
+	{ "\x67\xc4\xe1\x7f\xe7\xbc\x52\x0e\x63\x59\xb2\xde\xa3\x39\xa2", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x36\xf3\x2e\x42\x0f\x7e\x3f", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ss cs rex.X movq xmm7,QWORD PTR [rdi]" },
+	{ "\x42\x28\xdf", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.X sub dil,bl" },
+	{ "\x26\x48\x0f\xe7\x05\x10\x00\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "es rex.W movntq QWORD PTR [rip+0x10],mm0 # 0x1a0f9" },
+	{ "\x41\x8a\x07", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov al,BYTE PTR [r15]" },
+	{ "\x66\x36\x26\x44\x0f\x7f\x04\x1d\x40\x00\x00\x00", 12, 12, ShvEmulMov, 16, 0x14, 0x08, 0xff, 0x03, 1, 0, 0x40, 0x0, "ss es movdqa XMMWORD PTR [rbx*1+0x40],xmm8" },
+	{ "\x89\x8e\x67\x17\xfe\x83", 6, 6, ShvEmulMov, 4, 0x00, 0x01, 0x06, 0xff, 0, 0, 0xffffffff83fe1767, 0x0, "mov DWORD PTR [rsi-0x7c01e899],ecx" },
+	{ "\x44\xc6\x25\xdd\xdf\x0c\xf8\x12\x45\x1c\x77\x0b\x9e\xc0\xf9", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.R (bad)" },
+	{ "\x36\x44\x8c\x04\xcd\x40\x00\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ss rex.R mov WORD PTR [rcx*8+0x40],es" },
+	{ "\xf3\xa0\x31\xf3\x4f\x0e\xa4\x1b\x20\xd7", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz movabs al,ds:0xd7201ba40e4ff331" },
+	{ "\x64\x48\xa3\x81\x00\x10\x00\x00\xba\x4d\xc2", 11, 11, ShvEmulMov, 8, 0x04, 0x00, 0xff, 0xff, 0, 1, 0xc24dba0000100081, 0x0, "movabs fs:0xc24dba0000100081,rax" },
+	{ "\x65\x40\x38\x04\x65\x00\x10\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex cmp BYTE PTR gs:[riz*2+0x1000],al" },
+	{ "\x64\x4c\x81\x4c\x37\xed\xaf\xd8\xda\xb4", 10, 10, ShvEmulOr, 8, 0x04, 0xff, 0x07, 0x06, 1, 1, 0xffffffffffffffed, 0xffffffffb4dad8af, "rex.WR or QWORD PTR fs:[rdi+rsi*1-0x13],0xffffffffb4dad8af" },
+	{ "\x3e\x41\x80\x04\x20\x3f", 6, 6, ShvEmulAdd, 1, 0x04, 0xff, 0x08, 0xff, 0, 0, 0x0, 0x3f, "ds add BYTE PTR [r8+riz*1],0x3f" },
+	{ "\x4c\x0f\xc7\x04\xd4\xdf\x03\x96\x95\x01\x33\x05\x1f\x6b\x3c", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WR (bad)" },
+	{ "\xf0\x67\x2e\x40\x8f\x04\x24", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock cs rex pop QWORD PTR [esp]" },
+	{ "\x41\x80\x04\x1d\x40\x00\x00\x00\xd5", 9, 9, ShvEmulAdd, 1, 0x04, 0xff, 0xff, 0x03, 1, 0, 0x40, 0xd5, "add BYTE PTR [rbx*1+0x40],0xd5" },
+	{ "\x65\x67\x65\xc4\x21\xfd\xb1\x64\x1d\xbe\xf5\x29\xf9\x05\xc4", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "gs addr32 gs (bad)" },
+	{ "\x64\x40\x29\x84\xe5\x44\x33\x22\x11", 9, 9, ShvEmulSub, 4, 0x04, 0x00, 0x05, 0xff, 0, 1, 0x11223344, 0x0, "rex sub DWORD PTR fs:[rbp+riz*8+0x11223344],eax" },
+	{ "\x66\x4c\x81\x06\x4a\xbc\xe8\x0c", 8, 8, ShvEmulAdd, 8, 0x04, 0xff, 0x06, 0xff, 0, 0, 0x0, 0xce8bc4a, "data16 rex.WR add QWORD PTR [rsi],0xce8bc4a" },
+	{ "\x36\xc4\x21\xfc\xe7\xf6\x69\xc8\x8a\xfc\xcc\x67\xc5\xad\xe9", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ss (bad)" },
+	{ "\x66\xc4\x21\x7c\x29\x06", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 vmovaps YMMWORD PTR [rsi],ymm8" },
+	{ "\x36\x4f\x21\x00", 4, 4, ShvEmulAnd, 8, 0x04, 0x08, 0x08, 0xff, 0, 0, 0x0, 0x0, "ss rex.WRXB and QWORD PTR [r8],r8" },
+	{ "\x42\x31\x06", 3, 3, ShvEmulXor, 4, 0x04, 0x00, 0x06, 0xff, 0, 0, 0x0, 0x0, "rex.X xor DWORD PTR [rsi],eax" },
+	{ "\x36\x36\x0f\xae\x04\x1d\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ss ss fxsave [rbx*1+0x40]" },
+	{ "\x66\x42\xa4", 3, 3, ShvEmulMovs, 1, 0x04, 0x00, 0x07, 0xff, 0, 0, 0x0, 0x0, "data16 rex.X movs BYTE PTR es:[rdi],BYTE PTR ds:[rsi]" },
+	{ "\x26\xf0\x64\x4c\x09\x6e\x35", 7, 7, ShvEmulOr, 8, 0x05, 0x0d, 0x06, 0xff, 0, 1, 0x35, 0x0, "es lock or QWORD PTR fs:[rsi+0x35],r13" },
+	{ "\x3e\x41\x86\x36", 4, 4, ShvEmulXchg, 1, 0x04, 0x06, 0x0e, 0xff, 0, 0, 0x0, 0x0, "ds xchg BYTE PTR [r14],sil" },
+	{ "\xf0\x36\x41\x0f\x11\x32", 6, 6, ShvEmulMov, 16, 0x15, 0x06, 0x0a, 0xff, 0, 0, 0x0, 0x0, "lock ss movups XMMWORD PTR [r10],xmm6" },
+	{ "\xf0\x4c\xae", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock rex.WR scas al,BYTE PTR es:[rdi]" },
+	{ "\xf2\x4f\x8b\x7a\xd1", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz rex.WRXB mov r15,QWORD PTR [r10-0x2f]" },
+	{ "\x3e\x36\x42\x01\x40\x7f", 6, 6, ShvEmulAdd, 4, 0x04, 0x00, 0x00, 0xff, 0, 0, 0x7f, 0x0, "ds ss rex.X add DWORD PTR [rax+0x7f],eax" },
+	{ "\x67\x66\x4f\x18\x04\x24", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 rex.WRXB sbb BYTE PTR [r12d+r12d*1],r8b" },
+	{ "\x2e\x36\x0f\x11\x05\x10\x00\x00\x00", 9, 9, ShvEmulMov, 16, 0x10, 0x00, 0x10, 0xff, 0, 0, 0x10, 0x0, "cs ss movups XMMWORD PTR [rip+0x10],xmm0 # 0x1a4b9" },
+	{ "\xf0\x4c\x0f\x6f\x26", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock rex.WR movq mm4,QWORD PTR [rsi]" },
+	{ "\x67\x65\x66\xc4\x02\x7a\x13\x64\xa7\x1f\x7c\x9d\x68\x89\x55", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x3e\x26\x41\x21\x04\x1d\x40\x00\x00\x00", 10, 10, ShvEmulAnd, 4, 0x04, 0x00, 0xff, 0x03, 1, 0, 0x40, 0x0, "ds es and DWORD PTR [rbx*1+0x40],eax" },
+	{ "\x42\x0f\xe7\xed\x0b\x3b\x30\x1d\xa6\x96\x5f\x24\x44\xe9\x55", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.X movntq (bad),mm5" },
+	{ "\x3e\x41\x20\x04\x25\xf0\xff\xff\xff", 9, 9, ShvEmulAnd, 1, 0x04, 0x00, 0xff, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "ds and BYTE PTR ds:0xfffffffffffffff0,al" },
+	{ "\x64\xf3\x40\x18\xea", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "fs repz sbb dl,bpl" },
+	{ "\xc4\xe2\xf9\xe7\x04\x98", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmpnbexadd QWORD PTR [rax+rbx*4],rax,rax" },
+	{ "\x26\x4f\x0f\xae\x43\x7e", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "es rex.WRXB fxsave64 [r11+0x7e]" },
+	{ "\x42\x09\xfc", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.X or esp,edi" },
+	{ "\xc4\xa2\xff\x29\x04\xcd\x40\x00\x00\x00\x02\xf7\xed\x6f\xf4", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x4f\x89\x07", 3, 3, ShvEmulMov, 8, 0x04, 0x08, 0x0f, 0xff, 0, 0, 0x0, 0x0, "rex.WRXB mov QWORD PTR [r15],r8" },
+	{ "\x64\x42\xf7\x81\xf6\xf6\x44\x4e\xba\x81\x96\x48", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.X test DWORD PTR fs:[rcx+0x4e44f6f6],0x489681ba" },
+	{ "\xc4\x82\x7c\xb1\x3e\xa6\x2c\x9d\x06\x54\x40\x14\x99\xb8\xfa", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x26\x26\x2e\x4c\xf6\x04\x98\xb9", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "es es cs rex.WR test BYTE PTR [rax+rbx*4],0xb9" },
+	{ "\x44\x8c\x41\x80", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.R mov WORD PTR [rcx-0x80],es" },
+	{ "\x26\xf0\x44\x01\x41\x80", 6, 6, ShvEmulAdd, 4, 0x05, 0x08, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "es lock add DWORD PTR [rcx-0x80],r8d" },
+	{ "\x48\xc6\x1d\xf8\x8e\xe7\x61\xaa\xc0\xa1\x16\x9b\x05\xcc\xea", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W (bad)" },
+	{ "\x4f\x84\x4b\x23", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WRXB test BYTE PTR [r11+0x23],r9b" },
+	{ "\x4c\x84\xc3", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WR test bl,r8b" },
+	{ "\x3e\x67\x4c\x81\x41\x80\x82\xda\xf8\x80", 10, 10, ShvEmulAdd, 8, 0x0c, 0xff, 0x01, 0xff, 0, 0, 0xffffff80, 0xffffffff80f8da82, "ds rex.WR add QWORD PTR [ecx-0x80],0xffffffff80f8da82" },
+	{ "\x3e\x4f\x03\x06", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ds rex.WRXB add r8,QWORD PTR [r14]" },
+	{ "\x48\x0f\xc3\x7d\x14", 5, 5, ShvEmulMov, 8, 0x04, 0x07, 0x05, 0xff, 0, 0, 0x14, 0x0, "movnti QWORD PTR [rbp+0x14],rdi" },
+	{ "\xf3\x40\x83\x85\x24\xac\x01\xc4\x70", 9, 9, ShvEmulAdd, 4, 0x04, 0xff, 0x05, 0xff, 0, 0, 0xffffffffc401ac24, 0x70, "repz rex add DWORD PTR [rbp-0x3bfe53dc],0x70" },
+	{ "\xf2\x26\x42\x84\x04\x25\x78\x56\x34\x12", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz es test BYTE PTR [r12*1+0x12345678],al" },
+	{ "\xf2\xf3\x4f\xc7\x04\x24\x67\xcb\x39\x90", 10, 10, ShvEmulMovImmediate, 8, 0x04, 0xff, 0x0c, 0x0c, 1, 0, 0x0, 0xffffffff9039cb67, "repnz xrelease rex.WRXB mov QWORD PTR [r12+r12*1],0xffffffff9039cb67" },
+	{ "\xf2\xf0\xc4\x21\xfe\x10\x85\x00\x00\x00\x80", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz lock vmovss xmm8,DWORD PTR [rbp-0x80000000]" },
+	{ "\xc4\x81\x7b\x6f\x04\x65\x00\x10\x00\x00\x41\x2d\xcc\x8a\xe7", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x42\x0f\x29\x04\x65\x00\x10\x00\x00", 9, 9, ShvEmulMov, 16, 0x14, 0x00, 0xff, 0x0c, 2, 0, 0x1000, 0x0, "movaps XMMWORD PTR [r12*2+0x1000],xmm0" },
+	{ "\x41\x8c\xe6", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov r14d,fs" },
+	{ "\x42\x86\x00", 3, 3, ShvEmulXchg, 1, 0x04, 0x00, 0x00, 0xff, 0, 0, 0x0, 0x0, "rex.X xchg BYTE PTR [rax],al" },
+	{ "\xf0\x3e\x44\x2a\x04\x25\x78\x56\x34\x12", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock ds sub r8b,BYTE PTR ds:0x12345678" },
+	{ "\x67\xf0\x26\x41\x87\x32", 6, 6, ShvEmulXchg, 4, 0x0d, 0x06, 0x0a, 0xff, 0, 0, 0x0, 0x0, "lock es xchg DWORD PTR [r10d],esi" },
+	{ "\xf3\x64\x26\x89\xb7\xf8\xa0\x85\x31", 9, 9, ShvEmulMov, 4, 0x00, 0x06, 0x07, 0xff, 0, 1, 0x3185a0f8, 0x0, "xrelease fs mov DWORD PTR fs:[rdi+0x3185a0f8],esi" },
+	{ "\x67\x36\xf2\x40\x10\x31", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ss repnz adc BYTE PTR [ecx],sil" },
+	{ "\x48\xac", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W lods al,BYTE PTR ds:[rsi]" },
+	{ "\x44\x38\x04\x25\xf0\xff\xff\xff", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmp BYTE PTR ds:0xfffffffffffffff0,r8b" },
+	{ "\x48\x2a\x04\x65\x00\x10\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W sub al,BYTE PTR [riz*2+0x1000]" },
+	{ "\x85\x44\x24\x10", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "test DWORD PTR [rsp+0x10],eax" },
+	{ "\xf3\x42\x01\x1d\x88\x4b\xc7\xbb", 8, 8, ShvEmulAdd, 4, 0x04, 0x03, 0x10, 0xff, 0, 0, 0xffffffffbbc74b88, 0x0, "repz rex.X add DWORD PTR [rip+0xffffffffbbc74b88],ebx # 0xffffffffbbc8f510" },
+	{ "\x26\x42\x0f\xc0\x05\xf0\xff\xff\xff", 9, 9, ShvEmulXadd, 1, 0x04, 0x00, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "es rex.X xadd BYTE PTR [rip+0xfffffffffffffff0],al # 0x1a999" },
+	{ "\x42\x84\x04\x1d\x40\x00\x00\x00", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "test BYTE PTR [r11*1+0x40],al" },
+	{ "\x64\x42\xc6\x03\x18", 5, 5, ShvEmulMovImmediate, 1, 0x04, 0xff, 0x03, 0xff, 0, 1, 0x0, 0x18, "rex.X mov BYTE PTR fs:[rbx],0x18" },
+	{ "\x36\xf0\xa7", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock cmps DWORD PTR ds:[rsi],DWORD PTR es:[rdi]" },
+	{ "\x42\x0f\x28\x10", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.X movaps xmm2,XMMWORD PTR [rax]" },
+	{ "\xf2\x40\x03\x04\x24", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz rex add eax,DWORD PTR [rsp]" },
+	{ "\x40\x85\x03", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex test DWORD PTR [rbx],eax" },
+	{ "\x0f\x13\x04\x25\x78\x56\x34\x12", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movlps QWORD PTR ds:0x12345678,xmm0" },
+	{ "\x36\x26\xf2\xc4\x41\x78\xe7\x10\x29\xb5\xdb\x40\x16\x5f\x3b", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x26\x2e\x48\x0f\x6f\x04\xcd\x40\x00\x00\x00", 11, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "es cs rex.W movq mm0,QWORD PTR [rcx*8+0x40]" },
+	{ "\x40\x0f\xab\xc4", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex bts esp,eax" },
+	{ "\x2e\x4c\xc0\xe6\x4f", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs rex.WR shl sil,0x4f" },
+	{ "\x42\x87\x20", 3, 3, ShvEmulXchg, 4, 0x04, 0x04, 0x00, 0xff, 0, 0, 0x0, 0x0, "rex.X xchg DWORD PTR [rax],esp" },
+	{ "\x42\x0f\x11\x06", 4, 4, ShvEmulMov, 16, 0x14, 0x00, 0x06, 0xff, 0, 0, 0x0, 0x0, "rex.X movups XMMWORD PTR [rsi],xmm0" },
+	{ "\x67\x44\x0f\xae\x3f", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.R clflush BYTE PTR [edi]" },
+	{ "\x66\x40\x8c\x04\x65\x00\x10\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 rex mov WORD PTR [riz*2+0x1000],es" },
+	{ "\x2e\xf3\x40\x0f\xc7\x03\x14\x01\x92\xfd\x49\x52\xad\x19\x18", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs repz rex (bad)" },
+	{ "\xf0\x44\x0a\xfc", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock or r15b,spl" },
+	{ "\x64\xf0\xc4\x01\xfd\x29\x78\xdb", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock vmovapd YMMWORD PTR fs:[r8-0x25],ymm15" },
+	{ "\x2e\x41\x86\x32", 4, 4, ShvEmulXchg, 1, 0x04, 0x06, 0x0a, 0xff, 0, 0, 0x0, 0x0, "cs xchg BYTE PTR [r10],sil" },
+	{ "\x67\x2e\xf0\x48\x8a\x05\x10\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs lock rex.W mov al,BYTE PTR [eip+0x10] # 0x1ac5a" },
+	{ "\x65\xf3\x44\x2a\xfd", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "gs repz sub r15b,bpl" },
+	{ "\xc4\xa1\xfc\xb1\xe8\xe8\xad\x9c\xe8\x63\xb5\x60\xb4\xf4\x01", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x2e\xf0\x40\x08\xdc", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs lock or spl,bl" },
+	{ "\x41\xf7\x45\x08\x01\xf9\x07\x87", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "test DWORD PTR [r13+0x8],0x8707f901" },
+	{ "\x40\x8f\x04\x98", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex pop QWORD PTR [rax+rbx*4]" },
+	{ "\x36\x42\x0f\x28\x85\x00\x00\x00\x80", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ss rex.X movaps xmm0,XMMWORD PTR [rbp-0x80000000]" },
+	{ "\x2e\x48\x2a\x3b", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs rex.W sub dil,BYTE PTR [rbx]" },
+	{ "\x48\x0f\xc1\x54\x67\x7e", 6, 6, ShvEmulXadd, 8, 0x04, 0x02, 0x07, 0xff, 0, 0, 0x7e, 0x0, "xadd QWORD PTR [rdi+riz*2+0x7e],rdx" },
+	{ "\xf3\xf2\xf3\x4c\x0f\x10\x04\x1d\x40\x00\x00\x00", 12, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz repnz rex.WR movss xmm8,DWORD PTR [rbx*1+0x40]" },
+	{ "\x66\x26\x64\xc4\x01\xb9\x10\x04\x98\x0a\xda\x07\x4a\xce\x74", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\x21\xf8\x7f\x04\x25\xf0\xff\xff\xff\xdb\x61\x05\x1d\x01", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xf3\x3e\x4f\xa2\xa7\xc3\xcc\x68\x20\xee\x9b\x25", 12, 12, ShvEmulMov, 1, 0x04, 0x00, 0xff, 0xff, 0, 0, 0x259bee2068ccc3a7, 0x0, "repz ds rex.WRXB movabs ds:0x259bee2068ccc3a7,al" },
+	{ "\x2e\x64\x36\x42\xf7\x0b\x48\x29\x62\xf6", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs fs rex.X test DWORD PTR fs:[rbx],0xf6622948" },
+	{ "\x01\x04\xcd\x40\x00\x00\x00", 7, 7, ShvEmulAdd, 4, 0x00, 0x00, 0xff, 0x01, 8, 0, 0x40, 0x0, "add DWORD PTR [rcx*8+0x40],eax" },
+	{ "\x66\x40\x0f\x6f\x04\x98", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex movdqa xmm0,XMMWORD PTR [rax+rbx*4]" },
+	{ "\x30\x41\x80", 3, 3, ShvEmulXor, 1, 0x00, 0x00, 0x01, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "xor BYTE PTR [rcx-0x80],al" },
+	{ "\xf2\x4c\xd1\x04\x20", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz rex.WR rol QWORD PTR [rax+riz*1],1" },
+	{ "\x66\x4c\x0f\x7f\xd1", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WR movdqa xmm1,xmm10" },
+	{ "\x65\x64\x40\xc6\x44\x5d\xf8\x48", 8, 8, ShvEmulMovImmediate, 1, 0x04, 0xff, 0x05, 0x03, 2, 1, 0xfffffffffffffff8, 0x48, "gs rex mov BYTE PTR fs:[rbp+rbx*2-0x8],0x48" },
+	{ "\x67\xc5\xff\x13\x1b\xa3\x0e\x71\x3a\x81\x18\x15\xdf\x56\xb5", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "addr32 (bad)" },
+	{ "\x44\x02\x04\xa0", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "add r8b,BYTE PTR [rax+riz*4]" },
+	{ "\x41\x8a\x45\x08", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov al,BYTE PTR [r13+0x8]" },
+	{ "\x66\x4c\x0f\xc7\x69\x9d", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 rex.WR xsaves64 [rcx-0x63]" },
+	{ "\xf3\x4f\x21\x52\xcd", 5, 5, ShvEmulAnd, 8, 0x04, 0x0a, 0x0a, 0xff, 0, 0, 0xffffffffffffffcd, 0x0, "repz rex.WRXB and QWORD PTR [r10-0x33],r10" },
+	{ "\xf0\xf3\x64\x40\x22\x04\xa0", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock repz rex and al,BYTE PTR fs:[rax+riz*4]" },
+	{ "\x65\x41\x0f\xc1\xe2", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "gs xadd r10d,esp" },
+	{ "\xf3\x67\x65\x48\xae", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz gs rex.W scas al,BYTE PTR es:[edi]" },
+	{ "\x67\x40\x10\x84\xe5\x44\x33\x22\x11", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex adc BYTE PTR [ebp+eiz*8+0x11223344],al" },
+	{ "\x66\x66\x66\x41\x30\x41\x80", 7, 7, ShvEmulXor, 1, 0x04, 0x00, 0x09, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "data16 data16 data16 xor BYTE PTR [r9-0x80],al" },
+	{ "\x2e\x44\x8c\x85\x52\x39\xc1\xbc", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs rex.R mov WORD PTR [rbp-0x433ec6ae],es" },
+	{ "\x44\x21\x04\x65\x00\x10\x00\x00", 8, 8, ShvEmulAnd, 4, 0x04, 0x08, 0xff, 0xff, 0, 0, 0x1000, 0x0, "and DWORD PTR [riz*2+0x1000],r8d" },
+	{ "\x3e\xf3\xf0\xc4\x61\xfb\x11\x45\x08", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ds repz lock vmovsd QWORD PTR [rbp+0x8],xmm8" },
+	{ "\x36\x64\xc4\xc1\xfc\xd6\x79\x26\x2c\x73\x8b\xc4\x6b\x20\x62", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "ss fs (bad)" },
+	{ "\x3e\x48\x0f\xb0\x31", 5, 5, ShvEmulCmpxchg, 1, 0x04, 0x06, 0x01, 0xff, 0, 0, 0x0, 0x0, "ds rex.W cmpxchg BYTE PTR [rcx],sil" },
+	{ "\x41\x08\x05\xf0\xff\xff\xff", 7, 7, ShvEmulOr, 1, 0x04, 0x00, 0x10, 0xff, 0, 0, 0xfffffffffffffff0, 0x0, "or BYTE PTR [rip+0xfffffffffffffff0],al # 0x1b097" },
+	{ "\x66\x40\x88\x45\x08", 5, 5, ShvEmulMov, 1, 0x04, 0x00, 0x05, 0xff, 0, 0, 0x8, 0x0, "data16 rex mov BYTE PTR [rbp+0x8],al" },
+	{ "\x66\xf2\x64\x41\xff\xf9\xa0\xbb\xe8\x75\x98\xac\x80\x4f\xb4", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 repnz fs rex.B (bad)" },
+	{ "\x4f\x0f\x29\x41\x80", 5, 5, ShvEmulMov, 16, 0x14, 0x08, 0x09, 0xff, 0, 0, 0xffffffffffffff80, 0x0, "rex.WRXB movaps XMMWORD PTR [r9-0x80],xmm8" },
+	{ "\x44\x21\x46\xe0", 4, 4, ShvEmulAnd, 4, 0x04, 0x08, 0x06, 0xff, 0, 0, 0xffffffffffffffe0, 0x0, "and DWORD PTR [rsi-0x20],r8d" },
+	{ "\xf3\x44\x0f\xb0\x81\x00\x10\x00\x00", 9, 9, ShvEmulCmpxchg, 1, 0x04, 0x08, 0x01, 0xff, 0, 0, 0x1000, 0x0, "repz cmpxchg BYTE PTR [rcx+0x1000],r8b" },
+	{ "\x65\xc4\x21\xfc\x89\xc8\x98\x3b\xec\xbb\x0d\x0e\x04\x4e\x5d", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "gs (bad)" },
+	{ "\xf0\x86\x84\xe5\x44\x33\x22\x11", 8, 8, ShvEmulXchg, 1, 0x01, 0x00, 0x05, 0xff, 0, 0, 0x11223344, 0x0, "lock xchg BYTE PTR [rbp+riz*8+0x11223344],al" },
+	{ "\x64\x26\x41\x86\xce", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "fs es xchg r14b,cl" },
+	{ "\x36\x26\x4c\xa2\x85\x00\x00\x00\x80\xe0\xda\xab", 12, 12, ShvEmulMov, 1, 0x04, 0x00, 0xff, 0xff, 0, 0, 0xabdae08000000085, 0x0, "ss es rex.WR movabs ds:0xabdae08000000085,al" },
+	{ "\x67\xf0\xf0\x4f\xa3\x04\x25\xf0\xff", 9, 9, ShvEmulMov, 8, 0x0d, 0x00, 0xff, 0xff, 0, 0, 0xfff02504, 0x0, "addr32 lock lock rex.WRXB mov ds:0xfff02504,rax" },
+	{ "\xf0\x2e\x3e\xc4\xe1\x3f\x7f\x04\x20\x10\x6d\xe3\xf4\xb4\xc6", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xf2\x40\xfe\x04\x65\x00\x10\x00\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repnz rex inc BYTE PTR [riz*2+0x1000]" },
+	{ "\x66\x41\xf7\x90\x64\xfd\x12\x88", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "not WORD PTR [r8-0x77ed029c]" },
+	{ "\x44\x39\x81\x00\x10\x00\x00", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cmp DWORD PTR [rcx+0x1000],r8d" },
+	{ "\x64\x44\x03\x9b\xe1\x8c\x6f\x98", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "add r11d,DWORD PTR fs:[rbx-0x6790731f]" },
+	{ "\x67\x36\x4c\x81\x37\xa1\xc1\xb7\xc3", 9, 9, ShvEmulXor, 8, 0x0c, 0xff, 0x07, 0xff, 0, 0, 0x0, 0xffffffffc3b7c1a1, "ss rex.WR xor QWORD PTR [edi],0xffffffffc3b7c1a1" },
+	{ "\x41\x8b\x56\xe4", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov edx,DWORD PTR [r14-0x1c]" },
+	{ "\xf3\x65\x48\x8f\x63\x5e\x53\xb3\xe5\xb5\xe6\xea\x6c\x72\xfd", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz gs rex.W (bad)" },
+	{ "\x26\xf0\x4c\x21\x60\x02", 6, 6, ShvEmulAnd, 8, 0x05, 0x0c, 0x00, 0xff, 0, 0, 0x2, 0x0, "es lock and QWORD PTR [rax+0x2],r12" },
+	{ "\x4f\x87\x06", 3, 3, ShvEmulXchg, 8, 0x04, 0x08, 0x0e, 0xff, 0, 0, 0x0, 0x0, "rex.WRXB xchg QWORD PTR [r14],r8" },
+	{ "\x44\x0f\xc7\x7b\x18", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.R vmptrst QWORD PTR [rbx+0x18]" },
+	{ "\x2e\x44\xff\x40\x7f", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs rex.R inc DWORD PTR [rax+0x7f]" },
+	{ "\xf3\xf2\x48\x39\x04\xcd\x40\x00\x00\x00", 10, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "repz repnz cmp QWORD PTR [rcx*8+0x40],rax" },
+	{ "\x66\x48\x0f\x13\x29", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W movlpd QWORD PTR [rcx],xmm5" },
+	{ "\x26\x2e\x36\xc4\x21\xfe\x10\x04\x1d\x40\x00\x00\x00", 13, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "es cs ss vmovss xmm8,DWORD PTR [r11*1+0x40]" },
+	{ "\x67\x42\x81\x44\x5d\xf8\x81\xb7\xae\x18", 10, 10, ShvEmulAdd, 4, 0x0c, 0xff, 0x05, 0x0b, 2, 0, 0xfffffff8, 0x18aeb781, "add DWORD PTR [ebp+r11d*2-0x8],0x18aeb781" },
+	{ "\x64\x4c\x02\x3f", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WR add r15b,BYTE PTR fs:[rdi]" },
+	{ "\x2e\x66\xc4\x41\xf9\x11\x44\x5d\xf8", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "cs data16 vmovupd XMMWORD PTR [r13+rbx*2-0x8],xmm8" },
+	{ "\x3e\x64\x48\xaa", 4, 4, ShvEmulStos, 1, 0x04, 0x00, 0x07, 0xff, 0, 1, 0x0, 0x0, "ds fs rex.W stos BYTE PTR es:[rdi],al" },
+	{ "\xf3\xf2\x65\xc4\xe1\xbb\x7f\x04\x1d\x40\x00\x00\x00\x93\x57", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x66\x67\x36\x41\x84\xd1", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 addr32 ss test r9b,dl" },
+	{ "\x0f\xc3\xca\x3d\x28\x4f\xe9\x17\xe6\x59\x5c\xaa\x5f\x9c\x2f", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\x4f\x0f\xd6\x04\x98\xc6\xcd\x99\x3d\x23\x87\x18\x1e\x63\x19", 15, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.WRXB (bad)" },
+	{ "\x48", 1, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W nop" },
+	{ "\x48\x89", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov QWORD PTR [rax-0x6f6f6f70],rdx" },
+	{ "\x48\x89\x84", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov QWORD PTR [rax+rdx*4-0x6f6f6f70],rax" },
+	{ "\x48\x89\x84\x98", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov QWORD PTR [rax+rbx*4-0x6f6f6f70],rax" },
+	{ "\x48\x89\x84\x98\x10", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov QWORD PTR [rax+rbx*4-0x6f6f6ff0],rax" },
+	{ "\x48\x89\x84\x98\x10\x00", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov QWORD PTR [rax+rbx*4-0x6f6ffff0],rax" },
+	{ "\x48\x89\x84\x98\x10\x00\x00", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov QWORD PTR [rax+rbx*4-0x6ffffff0],rax" },
+	{ "\x66", 1, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "xchg ax,ax" },
+	{ "\x66\x81", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "adc WORD PTR [rax-0x6f6f6f70],0x9090" },
+	{ "\x66\x81\x05", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "add WORD PTR [rip+0xffffffff90909090],0x9090 # 0xffffffff90924699" },
+	{ "\x66\x81\x05\x10", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "add WORD PTR [rip+0xffffffff90909010],0x9090 # 0xffffffff90924639" },
+	{ "\x66\x81\x05\x10\x00", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "add WORD PTR [rip+0xffffffff90900010],0x9090 # 0xffffffff9091b659" },
+	{ "\x66\x81\x05\x10\x00\x00", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "add WORD PTR [rip+0xffffffff90000010],0x9090 # 0xffffffff9001b679" },
+	{ "\x66\x81\x05\x10\x00\x00\x00", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "add WORD PTR [rip+0x10],0x9090 # 0x1b699" },
+	{ "\x66\x81\x05\x10\x00\x00\x00\x34", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "add WORD PTR [rip+0x10],0x9034 # 0x1b6b9" },
+	{ "\x48\xc7", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W (bad)" },
+	{ "\x48\xc7\x44", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov QWORD PTR [rax+rdx*4-0x70],0xffffffff90909090" },
+	{ "\x48\xc7\x44\x24", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov QWORD PTR [rsp-0x70],0xffffffff90909090" },
+	{ "\x48\xc7\x44\x24\x08", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov QWORD PTR [rsp+0x8],0xffffffff90909090" },
+	{ "\x48\xc7\x44\x24\x08\x78", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov QWORD PTR [rsp+0x8],0xffffffff90909078" },
+	{ "\x48\xc7\x44\x24\x08\x78\x56", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov QWORD PTR [rsp+0x8],0xffffffff90905678" },
+	{ "\x48\xc7\x44\x24\x08\x78\x56\x34", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "mov QWORD PTR [rsp+0x8],0xffffffff90345678" },
+	{ "\x48\xa3", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movabs ds:0x9090909090909090,rax" },
+	{ "\x48\xa3\x88", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movabs ds:0x9090909090909088,rax" },
+	{ "\x48\xa3\x88\x77", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movabs ds:0x9090909090907788,rax" },
+	{ "\x48\xa3\x88\x77\x66", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movabs ds:0x9090909090667788,rax" },
+	{ "\x48\xa3\x88\x77\x66\x55", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movabs ds:0x9090909055667788,rax" },
+	{ "\x48\xa3\x88\x77\x66\x55\x44", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movabs ds:0x9090904455667788,rax" },
+	{ "\x48\xa3\x88\x77\x66\x55\x44\x33", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movabs ds:0x9090334455667788,rax" },
+	{ "\x48\xa3\x88\x77\x66\x55\x44\x33\x22", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movabs ds:0x9022334455667788,rax" },
+	{ "\xf0", 1, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock nop" },
+	{ "\xf0\x48", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock rex.W nop" },
+	{ "\xf0\x48\x0f", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock rex.W seto BYTE PTR [rax-0x6f6f6f70]" },
+	{ "\xf0\x48\x0f\xb1", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock cmpxchg QWORD PTR [rax-0x6f6f6f70],rdx" },
+	{ "\xf0\x48\x0f\xb1\x0c", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock cmpxchg QWORD PTR [rax+rdx*4],rcx" },
+	{ "\xf0\x48\x0f\xb1\x0c\x25", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock cmpxchg QWORD PTR ds:0xffffffff90909090,rcx" },
+	{ "\xf0\x48\x0f\xb1\x0c\x25\x00", 7, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock cmpxchg QWORD PTR ds:0xffffffff90909000,rcx" },
+	{ "\xf0\x48\x0f\xb1\x0c\x25\x00\x10", 8, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock cmpxchg QWORD PTR ds:0xffffffff90901000,rcx" },
+	{ "\xf0\x48\x0f\xb1\x0c\x25\x00\x10\x00", 9, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "lock cmpxchg QWORD PTR ds:0xffffffff90001000,rcx" },
+	{ "\xc4", 1, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xc1", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc4\xc1\x79", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "kmovb k2,BYTE PTR [r8-0x6f6f6f70]" },
+	{ "\xc4\xc1\x79\x7e", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovd DWORD PTR [r8-0x6f6f6f70],xmm2" },
+	{ "\xc4\xc1\x79\x7e\x4c", 5, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovd DWORD PTR [r8+rdx*4-0x70],xmm1" },
+	{ "\xc4\xc1\x79\x7e\x4c\x24", 6, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovd DWORD PTR [r12-0x70],xmm1" },
+	{ "\xc5", 1, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "(bad)" },
+	{ "\xc5\xf8", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "kmovw k2,WORD PTR [rax-0x6f6f6f70]" },
+	{ "\xc5\xf8\x29", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovaps XMMWORD PTR [rax-0x6f6f6f70],xmm2" },
+	{ "\xc5\xf8\x29\x45", 4, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "vmovaps XMMWORD PTR [rbp-0x70],xmm0" },
+	{ "\xf3", 1, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "pause" },
+	{ "\xf3\x48", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "rex.W pause" },
+	{ "\x66\x0f", 2, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "data16 seto BYTE PTR [rax-0x6f6f6f70]" },
+	{ "\x66\x0f\xd6", 3, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "movq QWORD PTR [rax-0x6f6f6f70],xmm2" },
+};
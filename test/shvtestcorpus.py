@@ -0,0 +1,586 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) Joe T. Sylve.  All rights reserved.
+#
+# Module Name:
+#
+#     shvtestcorpus.py
+#
+# Abstract:
+#
+#     This script generates shvtestcorpus.h, the instructions the decode test
+#     checks the store emulator's decoder against.  It encodes every opcode
+#     the emulator knows, and its neighbours, with every kind of memory
+#     operand and prefix, adds random encodings and truncated ones, and has
+#     GNU objdump disassemble them.  What objdump makes of each encoding is
+#     what the decoder has to agree with: the same length, operation, size,
+#     operands and prefixes for the stores in the emulator's repertoire, and
+#     a rejection for everything else.
+#
+#     Run it from the test directory, with the objdump of GNU binutils 2.30
+#     or later on the path:
+#
+#         python3 shvtestcorpus.py > shvtestcorpus.h
+#
+# Author:
+#
+#     agent (@agent) 16-Oct-2026 - Initial version
+#
+# Environment:
+#
+#     User mode only.
+#
+
+import os
+import random
+import re
+import subprocess
+import sys
+import tempfile
+
+# ===========================================================================
+#
+# MACROS
+#
+# ===========================================================================
+
+SLOT = 32
+NO_REGISTER = 0xff
+RIP = 0x10
+
+FLAG_LOCK = 0x01
+FLAG_REP = 0x02
+FLAG_REX = 0x04
+FLAG_ADDRESS32 = 0x08
+FLAG_VECTOR = 0x10
+
+LEGACY_PREFIXES = [0xf0, 0xf2, 0xf3, 0x2e, 0x36, 0x3e, 0x26, 0x64, 0x65, 0x66, 0x67]
+
+# ===========================================================================
+#
+# LOCAL DATA
+#
+# ===========================================================================
+
+#
+# The stores the emulator carries out, by mnemonic.  Anything else objdump
+# decodes, store or not, has to be rejected.
+#
+OPERATIONS = {
+    "mov": "ShvEmulMov",
+    "movabs": "ShvEmulMov",
+    "movnti": "ShvEmulMov",
+    "xchg": "ShvEmulXchg",
+    "cmpxchg": "ShvEmulCmpxchg",
+    "xadd": "ShvEmulXadd",
+    "add": "ShvEmulAdd",
+    "or": "ShvEmulOr",
+    "and": "ShvEmulAnd",
+    "sub": "ShvEmulSub",
+    "xor": "ShvEmulXor",
+    "movs": "ShvEmulMovs",
+    "stos": "ShvEmulStos",
+}
+
+VECTOR_MNEMONICS = [
+    "movups", "movupd", "movaps", "movapd", "movntps", "movntpd", "movss",
+    "movsd", "movd", "movq", "movdqa", "movdqu", "movntdq",
+]
+
+for mnemonic in VECTOR_MNEMONICS:
+    OPERATIONS[mnemonic] = "ShvEmulMov"
+    OPERATIONS["v" + mnemonic] = "ShvEmulMov"
+
+SIZES = {
+    "BYTE": 1,
+    "WORD": 2,
+    "DWORD": 4,
+    "QWORD": 8,
+    "XMMWORD": 16,
+    "YMMWORD": 32,
+}
+
+#
+# General purpose registers by name, with their width.
+#
+REGISTERS = {}
+
+for number, names in enumerate([
+        ("al", "ax", "eax", "rax"), ("cl", "cx", "ecx", "rcx"),
+        ("dl", "dx", "edx", "rdx"), ("bl", "bx", "ebx", "rbx"),
+        ("spl", "sp", "esp", "rsp"), ("bpl", "bp", "ebp", "rbp"),
+        ("sil", "si", "esi", "rsi"), ("dil", "di", "edi", "rdi")]):
+    for width, name in zip((1, 2, 4, 8), names):
+        REGISTERS[name] = (number, width)
+
+for number in range(8, 16):
+    for width, suffix in zip((1, 2, 4, 8), ("b", "w", "d", "")):
+        REGISTERS["r%d%s" % (number, suffix)] = (number, width)
+
+for number, name in enumerate(("ah", "ch", "dh", "bh")):
+    REGISTERS[name] = (number + 4, 1)
+
+#
+# The one and two byte opcodes with a ModRM byte the emulator knows, and
+# the loads, other stores and other encodings around them.
+#
+STORE_OPCODES = (
+    [bytes([op]) for op in
+        [0x00, 0x01, 0x08, 0x09, 0x20, 0x21, 0x28, 0x29, 0x30, 0x31, 0x80,
+         0x81, 0x83, 0x86, 0x87, 0x88, 0x89, 0xc6, 0xc7]] +
+    [bytes([0x0f, op]) for op in
+        [0x11, 0x29, 0x2b, 0x7e, 0x7f, 0xb0, 0xb1, 0xc0, 0xc1, 0xc3, 0xd6, 0xe7]]
+)
+
+OTHER_OPCODES = (
+    [bytes([op]) for op in
+        [0x02, 0x03, 0x0a, 0x10, 0x11, 0x18, 0x22, 0x2a, 0x32, 0x38, 0x39,
+         0x84, 0x85, 0x8a, 0x8b, 0x8c, 0x8f, 0xc0, 0xd1, 0xf6, 0xf7, 0xfe,
+         0xff]] +
+    [bytes([0x0f, op]) for op in
+        [0x10, 0x13, 0x17, 0x28, 0x6f, 0x90, 0xab, 0xae, 0xb3, 0xc7]]
+)
+
+OPCODES = STORE_OPCODES + OTHER_OPCODES
+
+#
+# Opcodes without a ModRM byte.
+#
+MOFFS_OPCODES = [0xa0, 0xa1, 0xa2, 0xa3]
+STRING_OPCODES = [0xa4, 0xa5, 0xa6, 0xa7, 0xaa, 0xab, 0xac, 0xae]
+
+#
+# Opcodes of the map of two-byte opcodes to try with a VEX prefix.
+#
+VEX_OPCODES = [0x10, 0x11, 0x13, 0x29, 0x2b, 0x6f, 0x7e, 0x7f, 0xd6, 0xe7, 0xb1, 0x89]
+
+#
+# Every form of memory operand, as the ModRM byte without its reg field and
+# whatever follows it: register indirect, RIP-relative, SIB with and
+# without base and index, and 8 and 32 bit displacements.
+#
+MEMORY_FORMS = [
+    bytes([0x00]),
+    bytes([0x03]),
+    bytes([0x06]),
+    bytes([0x07]),
+    bytes([0x05, 0x10, 0x00, 0x00, 0x00]),
+    bytes([0x05, 0xf0, 0xff, 0xff, 0xff]),
+    bytes([0x04, 0x24]),
+    bytes([0x04, 0x98]),
+    bytes([0x04, 0x20]),
+    bytes([0x04, 0xa0]),
+    bytes([0x04, 0x25, 0x78, 0x56, 0x34, 0x12]),
+    bytes([0x04, 0x25, 0xf0, 0xff, 0xff, 0xff]),
+    bytes([0x04, 0x65, 0x00, 0x10, 0x00, 0x00]),
+    bytes([0x04, 0xcd, 0x40, 0x00, 0x00, 0x00]),
+    bytes([0x04, 0x1d, 0x40, 0x00, 0x00, 0x00]),
+    bytes([0x40, 0x7f]),
+    bytes([0x41, 0x80]),
+    bytes([0x45, 0x08]),
+    bytes([0x44, 0x24, 0x10]),
+    bytes([0x44, 0x5d, 0xf8]),
+    bytes([0x81, 0x00, 0x10, 0x00, 0x00]),
+    bytes([0x85, 0x00, 0x00, 0x00, 0x80]),
+    bytes([0x84, 0xe5, 0x44, 0x33, 0x22, 0x11]),
+]
+
+#
+# Register operands in the r/m field, which aren't stores.
+#
+REGISTER_FORMS = [bytes([0xc0]), bytes([0xd7])]
+
+REX_PREFIXES = [None, 0x40, 0x41, 0x42, 0x44, 0x48, 0x4c, 0x4f]
+
+PREFIX_SETS = [
+    [], [0x66], [0x67], [0xf0], [0xf2], [0xf3], [0x64], [0x65], [0x2e],
+    [0x3e], [0x26], [0x36], [0x66, 0x67], [0xf0, 0x66], [0x66, 0xf2],
+    [0xf3, 0x66], [0xf2, 0xf3], [0xf3, 0xf2], [0x64, 0x65], [0x65, 0x2e],
+    [0x2e, 0x64], [0xf0, 0x65, 0x67], [0x66, 0x66], [0xf0, 0xf0],
+]
+
+IMMEDIATES = [bytes([0x7f, 0x80, 0xff, 0x01]), bytes([0xf0, 0xff, 0xff, 0xff]), bytes([0x34, 0x12, 0x00, 0x00])]
+
+# ===========================================================================
+#
+# LOCAL FUNCTIONS
+#
+# ===========================================================================
+
+def head(prefixes, rex, opcode):
+    return bytes(prefixes) + (bytes([rex]) if rex is not None else b"") + opcode
+
+
+def encode(prefixes, rex, opcode, form, reg, immediate):
+    #
+    # Put the reg field into the ModRM byte of the memory form.
+    #
+    return head(prefixes, rex, opcode) + bytes([form[0] | (reg << 3)]) + form[1:] + immediate
+
+
+def vex(rxb, map, w, vvvv, l, pp, short):
+    #
+    # The inverted R, X and B bits come first, as do the inverted bits of
+    # vvvv.  The two byte form can only stand in for the three byte one
+    # with X, B and W clear in map 1.
+    #
+    if short and rxb & 3 == 3 and map == 1 and w == 0:
+        return bytes([0xc5, ((rxb & 4) << 5) | (vvvv << 3) | (l << 2) | pp])
+
+    return bytes([0xc4, (rxb << 5) | map, (w << 7) | (vvvv << 3) | (l << 2) | pp])
+
+
+def generate(rng):
+    cases = []
+
+    #
+    # Every opcode the emulator knows with every memory form, and with half
+    # of the sets of prefixes and REX prefixes, and the other opcodes with
+    # a few of each.  Immediates are long enough for any of them.
+    #
+    for opcode in OPCODES:
+        store = opcode in STORE_OPCODES
+        forms = MEMORY_FORMS + REGISTER_FORMS if store else rng.sample(MEMORY_FORMS + REGISTER_FORMS, 4)
+
+        for form in forms:
+            cases.append(encode([], None, opcode, form, rng.randrange(8), rng.choice(IMMEDIATES)))
+
+        for prefixes in rng.sample(PREFIX_SETS, 12 if store else 4):
+            form = rng.choice(MEMORY_FORMS)
+            cases.append(encode(prefixes, None, opcode, form, rng.randrange(8), rng.choice(IMMEDIATES)))
+
+        for rex in rng.sample(REX_PREFIXES[1:], 4 if store else 2):
+            form = rng.choice(MEMORY_FORMS)
+            cases.append(encode(rng.choice(PREFIX_SETS[:8]), rex, opcode, form, rng.randrange(8), rng.choice(IMMEDIATES)))
+
+    #
+    # Every reg field of the groups, which pick the operation.
+    #
+    for opcode in [b"\x80", b"\x81", b"\x83", b"\xc6", b"\xc7"]:
+        for reg in range(8):
+            for rex in [None, 0x48]:
+                cases.append(encode([], rex, opcode, rng.choice(MEMORY_FORMS), reg, rng.choice(IMMEDIATES)))
+                cases.append(encode([0x66], rex, opcode, rng.choice(MEMORY_FORMS), reg, rng.choice(IMMEDIATES)))
+
+    #
+    # Absolute addresses and string instructions.
+    #
+    for opcode in MOFFS_OPCODES + STRING_OPCODES:
+        for prefixes in rng.sample(PREFIX_SETS, 12):
+            cases.append(head(prefixes, None, bytes([opcode])) + bytes([0x88, 0x77, 0x66, 0x55, 0x44, 0x33, 0x22, 0x11]))
+
+        for prefixes in rng.sample(PREFIX_SETS, 4):
+            for rex in [0x48, 0x41]:
+                cases.append(head(prefixes, rex, bytes([opcode])) + bytes([0x88, 0x77, 0x66, 0x55, 0x44, 0x33, 0x22, 0x11]))
+
+    #
+    # VEX encodings, with every vector length, mandatory prefix and W, and
+    # some that aren't valid.
+    #
+    for opcode in VEX_OPCODES:
+        for pp in range(4):
+            for l in range(2):
+                for w in range(2):
+                    for rxb in [7, 0, 5, 2]:
+                        prefix = vex(rxb, 1, w, 15, l, pp, rng.random() < 0.5)
+                        cases.append(prefix + bytes([opcode]) + rng.choice(MEMORY_FORMS + REGISTER_FORMS))
+
+        cases.append(vex(7, 1, 0, 14, 0, 1, False) + bytes([opcode, 0x00]))
+        cases.append(vex(7, 1, 0, 0, 0, 0, True) + bytes([opcode, 0x00]))
+        cases.append(vex(7, 2, 0, 15, 0, 1, False) + bytes([opcode, 0x00]))
+        cases.append(vex(7, 3, 0, 15, 0, 1, False) + bytes([opcode, 0x00]))
+
+        for prefixes in [[0x66], [0xf3], [0xf0], [0x48], [0x64], [0x67], [0x2e]]:
+            cases.append(bytes(prefixes) + vex(7, 1, 0, 15, 0, 1, True) + bytes([opcode, 0x00]))
+
+    #
+    # Random instructions from the same parts.
+    #
+    for _ in range(600):
+        prefixes = [rng.choice(LEGACY_PREFIXES) for _ in range(rng.choice([0, 0, 1, 1, 2, 3]))]
+        rex = rng.choice(REX_PREFIXES)
+        kind = rng.random()
+
+        if kind < 0.15:
+            code = bytes(prefixes) + vex(rng.randrange(8), rng.choice([1, 1, 1, 2]), rng.randrange(2),
+                rng.choice([15, 15, 15, 7]), rng.randrange(2), rng.randrange(4), rng.random() < 0.5)
+            code += bytes([rng.choice(VEX_OPCODES)])
+        elif kind < 0.25:
+            code = head(prefixes, rex, bytes([rng.choice(MOFFS_OPCODES + STRING_OPCODES)]))
+        else:
+            code = head(prefixes, rex, rng.choice(OPCODES))
+
+        code += bytes([rng.randrange(256)]) if rng.random() < 0.5 else rng.choice(MEMORY_FORMS)
+        code += bytes(rng.randrange(256) for _ in range(15))
+        cases.append(code[:15])
+
+    #
+    # Stores cut short, at every length.
+    #
+    for code in [b"\x48\x89\x84\x98\x10\x00\x00\x00", b"\x66\x81\x05\x10\x00\x00\x00\x34\x12",
+            b"\x48\xc7\x44\x24\x08\x78\x56\x34\x12", b"\x48\xa3\x88\x77\x66\x55\x44\x33\x22\x11",
+            b"\xf0\x48\x0f\xb1\x0c\x25\x00\x10\x00\x00", b"\xc4\xc1\x79\x7e\x4c\x24\x08",
+            b"\xc5\xf8\x29\x45\x10", b"\xf3\x48\xab", b"\x66\x0f\xd6\x00"]:
+        for length in range(1, len(code)):
+            cases.append(code[:length])
+
+    return cases
+
+
+def disassemble(cases):
+    #
+    # Put each case at the start of its own slot, padded with NOPs.  No
+    # instruction is longer than 15 bytes, so whatever objdump makes of the
+    # rest of a case, it is back in step by the next slot.
+    #
+    image = bytearray()
+
+    for code in cases:
+        image += code + b"\x90" * (SLOT - len(code))
+
+    with tempfile.NamedTemporaryFile(suffix=".bin", delete=False) as file:
+        file.write(image)
+
+    try:
+        output = subprocess.run(
+            ["objdump", "-D", "-b", "binary", "-m", "i386:x86-64", "-M", "intel", "--insn-width=16", file.name],
+            check=True, stdout=subprocess.PIPE, universal_newlines=True).stdout
+    finally:
+        os.unlink(file.name)
+
+    result = {}
+
+    for line in output.splitlines():
+        match = re.match(r"^\s*([0-9a-f]+):\t((?:[0-9a-f]{2} )+)\s*\t?(.*)$", line)
+        if match is None:
+            continue
+
+        address = int(match.group(1), 16)
+        if address % SLOT == 0:
+            result[address // SLOT] = (len(match.group(2).split()), " ".join(match.group(3).split()))
+
+    return [result[i] for i in range(len(cases))]
+
+
+def parse_memory(operand):
+    #
+    # SIZE PTR seg:[base+index*scale+displacement], or seg:displacement.
+    #
+    match = re.match(r"^(?:(\w+) PTR )?(?:(\w\w):)?(?:\[([^\]]*)\]|(0x[0-9a-f]+))$", operand)
+    if match is None:
+        return None
+
+    size, segment, expression, absolute = match.groups()
+    memory = {
+        "size": SIZES.get(size, 0) if size else 0,
+        "segment": segment,
+        "base": NO_REGISTER,
+        "index": NO_REGISTER,
+        "scale": 0,
+        "displacement": 0,
+        "address32": False,
+    }
+
+    if absolute is not None:
+        memory["displacement"] = int(absolute, 16)
+        return memory
+
+    for sign, term in re.findall(r"([+-]?)([^+-]+)", expression):
+        if term.startswith("0x"):
+            value = int(term, 16)
+            memory["displacement"] += -value if sign == "-" else value
+        elif "*" in term:
+            name, scale = term.split("*")
+            memory["address32"] |= name == "eiz"
+            if name not in ("riz", "eiz"):
+                memory["index"] = REGISTERS[name][0]
+                memory["scale"] = int(scale)
+                memory["address32"] |= REGISTERS[name][1] == 4
+        elif term in ("rip", "eip"):
+            memory["base"] = RIP
+            memory["address32"] |= term == "eip"
+        else:
+            memory["base"] = REGISTERS[term][0]
+            memory["address32"] |= REGISTERS[term][1] == 4
+
+    return memory
+
+
+def expect(code, length, text):
+    #
+    # What the decoder has to make of the case, or None if it has to reject
+    # it.
+    #
+    if length > len(code) or "(bad)" in text:
+        return None
+
+    text = text.split("#")[0].strip()
+    words = text.split(" ", 1)
+    prefixes = []
+
+    while len(words) == 2 and words[0] in ("lock", "rep", "repz", "repnz", "xacquire", "xrelease", "addr32",
+            "data16", "cs", "ds", "es", "ss", "fs", "gs", "rex", "bnd", "notrack") or words[0].startswith("rex."):
+        prefixes.append(words[0])
+        words = words[1].split(" ", 1)
+
+    if words[0] not in OPERATIONS or len(words) < 2:
+        return None
+
+    #
+    # A VEX prefix after a 66, F2, F3, LOCK or REX prefix raises #UD, though
+    # objdump shows the instruction anyway.
+    #
+    i = 0
+    while code[i] in LEGACY_PREFIXES:
+        i += 1
+
+    rex = code[i] & 0xf0 == 0x40
+    opcode = code[i + 1] if rex else code[i]
+
+    if opcode in (0xc4, 0xc5) and (rex or any(prefix in code[:i] for prefix in (0x66, 0xf0, 0xf2, 0xf3))):
+        return None
+
+    mnemonic = words[0]
+    operands = words[1].split(",")
+    memory = parse_memory(operands[0])
+
+    if memory is None or len(operands) != 2:
+        return None
+
+    expected = {
+        "operation": OPERATIONS[mnemonic],
+        "size": memory["size"],
+        "flags": 0,
+        "register": NO_REGISTER,
+        "base": memory["base"],
+        "index": memory["index"],
+        "scale": memory["scale"],
+        "segment": memory["segment"],
+        "displacement": memory["displacement"],
+        "immediate": 0,
+    }
+
+    source = operands[1]
+
+    if mnemonic in ("movs", "stos"):
+        #
+        # The decoder names the accumulator, which STOS stores, either way,
+        # and MOVS can take its segment from the source.
+        #
+        source_memory = parse_memory(source)
+        if source_memory is not None:
+            expected["segment"] = None if source_memory["segment"] == "ds" else source_memory["segment"]
+            memory["address32"] |= source_memory["address32"]
+        elif source not in REGISTERS:
+            return None
+
+        expected["register"] = 0
+
+        if any(prefix in ("rep", "repz", "repnz") for prefix in prefixes):
+            expected["flags"] |= FLAG_REP
+    elif re.match(r"^[xy]mm\d+$", source):
+        if mnemonic not in VECTOR_MNEMONICS and mnemonic[1:] not in VECTOR_MNEMONICS:
+            return None
+
+        expected["register"] = int(source[3:])
+        expected["flags"] |= FLAG_VECTOR
+    elif source in REGISTERS and mnemonic not in VECTOR_MNEMONICS and mnemonic[1:] not in VECTOR_MNEMONICS:
+        expected["register"], width = REGISTERS[source]
+        if expected["size"] == 0:
+            expected["size"] = width
+    elif source.startswith("0x") and mnemonic in ("mov", "add", "or", "and", "sub", "xor"):
+        if mnemonic == "mov":
+            expected["operation"] = "ShvEmulMovImmediate"
+
+        expected["immediate"] = int(source, 16) & ((1 << (8 * expected["size"])) - 1)
+    else:
+        return None
+
+    #
+    # The last FS or GS override counts, even where objdump shows that it
+    # doesn't apply, as with the destination of string instructions.
+    #
+    if expected["segment"] not in ("fs", "gs"):
+        overrides = [prefix for prefix in prefixes if prefix in ("fs", "gs")]
+        expected["segment"] = overrides[-1] if overrides else None
+
+    if "lock" in prefixes:
+        expected["flags"] |= FLAG_LOCK
+
+    if "addr32" in prefixes or memory["address32"]:
+        expected["flags"] |= FLAG_ADDRESS32
+        expected["displacement"] &= 0xffffffff
+
+    #
+    # Whether there was a REX prefix is a fact of the encoding objdump
+    # doesn't always show, so it comes from the bytes.
+    #
+    if rex:
+        expected["flags"] |= FLAG_REX
+
+    expected["displacement"] &= (1 << 64) - 1
+
+    return expected
+
+
+def main():
+    rng = random.Random(0x5348)
+    cases = []
+    seen = set()
+
+    for code in generate(rng):
+        if code not in seen:
+            seen.add(code)
+            cases.append(code)
+
+    disassembly = disassemble(cases)
+
+    #
+    # Drop what follows the instructions objdump could make out, so that
+    # the decoder gets exactly as many bytes as the instruction has.
+    #
+    trimmed = []
+    seen = set()
+
+    for code, (length, text) in zip(cases, disassembly):
+        if "(bad)" not in text and length < len(code):
+            code = code[:length]
+
+        if code not in seen:
+            seen.add(code)
+            trimmed.append((code, (length, text)))
+    version = subprocess.run(["objdump", "--version"], check=True, stdout=subprocess.PIPE,
+        universal_newlines=True).stdout.splitlines()[0]
+
+    out = sys.stdout
+    out.write("//\n")
+    out.write("// Generated by shvtestcorpus.py from the disassembly of\n")
+    out.write("// %s.  Do not edit.\n" % version)
+    out.write("//\n")
+    out.write("// Code, its length, the length it decodes to or 0 if it has to be rejected,\n")
+    out.write("// the operation, size, flags, register, base, index, scale, segment,\n")
+    out.write("// displacement and immediate it decodes to, and what objdump made of it.\n")
+    out.write("//\n")
+    out.write("static const SHV_TEST_DECODE_CASE ShvTestDecodeCorpus[] =\n{\n")
+
+    for code, (length, text) in trimmed:
+        expected = expect(code, length, text)
+        literal = "".join("\\x%02x" % byte for byte in code)
+        text = text.replace("\\", "\\\\").replace('"', '\\"')
+
+        if expected is None:
+            out.write('\t{ "%s", %d, 0, ShvEmulUnsupported, 0, 0, 0, 0, 0, 0, 0, 0, 0, "%s" },\n' %
+                (literal, len(code), text))
+            continue
+
+        segment = {"fs": 1, "gs": 2, None: 0}
+        out.write('\t{ "%s", %d, %d, %s, %d, 0x%02x, 0x%02x, 0x%02x, 0x%02x, %d, %d, 0x%x, 0x%x, "%s" },\n' % (
+            literal, len(code), length, expected["operation"], expected["size"], expected["flags"],
+            expected["register"], expected["base"], expected["index"], expected["scale"],
+            segment[expected["segment"]], expected["displacement"], expected["immediate"], text))
+
+    out.write("};\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,73 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvtestcover.c
+
+Abstract:
+
+	This module builds the code coverage module into the test harness.  It
+	is included whole, rather than linked, so that tests can turn coverage
+	on and see which violations it claims.
+
+Author:
+
+	agent (@agent) 16-Oct-2026 - Initial version
+
+Environment:
+
+	User mode only.
+
+--*/
+
+#include "shvtest.h"
+
+#include "../shvvmxcover.c"
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+NTSTATUS
+ShvTestStartCover(
+	VOID
+)
+{
+	//
+	// Coverage comes up after the EPT, the way the driver brings it up,
+	// and starts out with nothing counted.
+	//
+	ShvVmxCoverRequested = TRUE;
+	ShvVmxCoverFaults = 0;
+	ShvVmxCoverCoarse = 0;
+
+	return ShvVmxCoverInitialize();
+}
+
+VOID
+ShvTestStopCover(
+	VOID
+)
+{
+	ShvVmxCoverCleanup();
+
+	ShvVmxCoverRequested = SHV_COVER_ENABLE;
+}
+
+BOOLEAN
+ShvTestFilterCover(
+	_In_ PSHV_VP_STATE VpState,
+	_In_ ULONG64 Gpa,
+	_In_ ULONG Access
+)
+{
+	//
+	// The handler the EPT module calls for violations on protected pages,
+	// for tests that need to see whether it claimed one.
+	//
+	return ShvVmxCoverHandleViolation(VpState, Gpa, Access);
+}
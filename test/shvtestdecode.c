@@ -0,0 +1,432 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvtestdecode.c
+
+Abstract:
+
+	This module checks the decoder of the store emulator against what GNU
+	objdump makes of the same instructions, and benchmarks how long each
+	kind of store takes to decode, prepare and carry out in the exit of the
+	violation it caused.
+
+Author:
+
+	agent (@agent) 16-Oct-2026 - Initial version
+
+Environment:
+
+	User mode only.
+
+--*/
+
+#include "shvtest.h"
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// The guest memory: a page of code, followed by the pages it stores to,
+// all of it RAM on the default machine.
+//
+#define SHV_TEST_DECODE_BASE            (256ULL * 1024 * 1024)
+#define SHV_TEST_DECODE_PAGES           (4)
+#define SHV_TEST_DECODE_DATA(n)         (SHV_TEST_DECODE_BASE + ((n) + 1) * PAGE_SIZE)
+
+//
+// The L bit of the access rights of a 64-bit code segment, and the bits
+// of the exit qualification of a write whose linear address is that of
+// the access itself.
+//
+#define SHV_TEST_DECODE_CS_LONG_MODE    (1 << 13)
+#define SHV_TEST_DECODE_WRITE           (VMX_EPT_ACCESS_WRITE | (1 << 7) | (1 << 8))
+
+//
+// How many times the benchmark runs each step of each store, in batches
+// that make the clock's own cost disappear.
+//
+#define SHV_TEST_DECODE_ITERATIONS      (1024 * 1024)
+#define SHV_TEST_DECODE_BATCH           (1024)
+
+// ===========================================================================
+//
+// LOCAL TYPES
+//
+// ===========================================================================
+
+//
+// An instruction of the corpus, and what the decoder has to make of it.
+// Decoded is its length, or 0 if the decoder has to reject it.
+//
+typedef struct _SHV_TEST_DECODE_CASE {
+	PCSTR Code;
+	UCHAR Length;
+	UCHAR Decoded;
+	UCHAR Operation;
+	UCHAR Size;
+	UCHAR Flags;
+	UCHAR Register;
+	UCHAR Base;
+	UCHAR Index;
+	UCHAR Scale;
+	UCHAR Segment;
+	ULONG64 Displacement;
+	ULONG64 Immediate;
+	PCSTR Text;
+} SHV_TEST_DECODE_CASE, *PSHV_TEST_DECODE_CASE;
+
+//
+// A store for the benchmark.  Its memory operand is Offset bytes past RDI
+// and is the byte that faults, and it stores RCX, XMM1 or RAX, Count
+// times if it is repeated.
+//
+typedef struct _SHV_TEST_DECODE_STORE {
+	PCSTR Name;
+	UCHAR Code[SHV_EMUL_MAX_LENGTH];
+	UCHAR Length;
+	ULONG Offset;
+	ULONG64 Count;
+} SHV_TEST_DECODE_STORE, *PSHV_TEST_DECODE_STORE;
+
+// ===========================================================================
+//
+// LOCAL DATA
+//
+// ===========================================================================
+
+#include "shvtestcorpus.h"
+
+static const SHV_TEST_DECODE_STORE ShvTestDecodeStores[] = {
+	{ "mov [rdi],rcx", { 0x48, 0x89, 0x0f }, 3, 0, 0 },
+	{ "mov fs:[rdi+rbx*4+0x10],rcx", { 0x64, 0x48, 0x89, 0x8c, 0x9f, 0x10, 0x00, 0x00, 0x00 }, 9, 0x10, 0 },
+	{ "mov [rdi],imm32", { 0x48, 0xc7, 0x07, 0x78, 0x56, 0x34, 0x12 }, 7, 0, 0 },
+	{ "lock add [rdi],rcx", { 0xf0, 0x48, 0x01, 0x0f }, 4, 0, 0 },
+	{ "xchg [rdi],rcx", { 0x48, 0x87, 0x0f }, 3, 0, 0 },
+	{ "lock cmpxchg [rdi],rcx", { 0xf0, 0x48, 0x0f, 0xb1, 0x0f }, 5, 0, 0 },
+	{ "movups [rdi],xmm1", { 0x0f, 0x11, 0x0f }, 3, 0, 0 },
+	{ "vmovdqu [rdi],xmm1", { 0xc5, 0xfa, 0x7f, 0x0f }, 4, 0, 0 },
+	{ "rep stosq x32", { 0xf3, 0x48, 0xab }, 3, 0, 32 },
+	{ "rep movsb x256", { 0xf3, 0xa4 }, 2, 0, 256 },
+};
+
+// ===========================================================================
+//
+// LOCAL PROTOTYPES
+//
+// ===========================================================================
+
+static BOOLEAN
+ShvTestDecodeMatches(
+	_In_ const SHV_TEST_DECODE_CASE *Case,
+	_In_ NTSTATUS Status,
+	_In_ const SHV_EMUL_INSTRUCTION *Instruction
+);
+
+static VOID
+ShvTestDecodeReset(
+	_Inout_ PSHV_VP_STATE VpState,
+	_In_ const SHV_TEST_DECODE_STORE *Store
+);
+
+static PCSTR
+ShvTestDecodeHex(
+	_In_reads_bytes_(Length) PCSTR Code,
+	_In_ ULONG Length,
+	_Out_writes_(SHV_EMUL_MAX_LENGTH * 3 + 1) PCHAR Buffer
+);
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+VOID
+ShvTestDecode(
+	VOID
+)
+{
+	SHV_EMUL_INSTRUCTION instruction;
+	const SHV_TEST_DECODE_CASE *test;
+	CHAR hex[SHV_EMUL_MAX_LENGTH * 3 + 1];
+	ULONG mismatches, stores;
+	NTSTATUS status;
+
+	//
+	// Every instruction of the corpus has to decode to what objdump said it
+	// was, or be rejected if it isn't a store the emulator carries out.
+	//
+	mismatches = 0;
+	stores = 0;
+
+	for (ULONG i = 0; i < RTL_NUMBER_OF(ShvTestDecodeCorpus); i++)
+	{
+		test = &ShvTestDecodeCorpus[i];
+		status = ShvVmxEmulDecode((const UCHAR *)test->Code, test->Length, &instruction);
+
+		stores += (test->Decoded != 0);
+
+		if (!ShvTestDecodeMatches(test, status, &instruction))
+		{
+			mismatches++;
+
+			ShvTestPrint("%s(%s) %s\n",
+				ShvTestDecodeHex(test->Code, test->Length, hex),
+				(test->Decoded != 0) ? "store" : "reject",
+				test->Text);
+
+			if (status == STATUS_SUCCESS)
+			{
+				ShvTestPrint("  decodes to length %u operation %u size %u flags %02x register %02x base %02x "
+					"index %02x*%u segment %u displacement %llx immediate %llx\n",
+					instruction.Length,
+					instruction.Operation,
+					instruction.Size,
+					instruction.Flags,
+					instruction.Register,
+					instruction.Base,
+					instruction.Index,
+					instruction.Scale,
+					instruction.Segment,
+					instruction.Displacement,
+					instruction.Immediate);
+			}
+			else
+			{
+				ShvTestPrint("  is rejected\n");
+			}
+		}
+	}
+
+	if (ShvTestVerbose)
+	{
+		ShvTestPrint("%u instructions, %u of them stores\n", (ULONG)RTL_NUMBER_OF(ShvTestDecodeCorpus), stores);
+	}
+
+	SHV_TEST_CHECK(mismatches == 0);
+
+	//
+	// Nothing reads past the length it is given, whatever the bytes.
+	//
+	SHV_TEST_CHECK(ShvVmxEmulDecode((const UCHAR *)"\x48\x89\x0f", 0, &instruction) != STATUS_SUCCESS);
+	SHV_TEST_CHECK(ShvVmxEmulDecode((const UCHAR *)"\x48\x89\x0f", 2, &instruction) != STATUS_SUCCESS);
+}
+
+VOID
+ShvTestDecodeBenchmark(
+	VOID
+)
+{
+	SHV_EMUL_INSTRUCTION instruction;
+	SHV_VP_STATE vpState;
+	SHV_EMUL_STORE store;
+	CONTEXT context;
+	ULONG64 start, decode, prepare, commit;
+	const SHV_TEST_DECODE_STORE *test;
+	PUCHAR memory;
+
+	if (!SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+	{
+		return;
+	}
+
+	memory = (PUCHAR)ShvTestPlatAllocatePages(SHV_TEST_DECODE_PAGES * PAGE_SIZE, MM_ANY_NODE_OK);
+	if (!SHV_TEST_CHECK(memory != NULL))
+	{
+		ShvTestStopEpt();
+		return;
+	}
+
+	__stosb(memory, 0, SHV_TEST_DECODE_PAGES * PAGE_SIZE);
+	ShvTestSetGuestMemory(SHV_TEST_DECODE_BASE, memory, SHV_TEST_DECODE_PAGES * PAGE_SIZE);
+
+	//
+	// A 64-bit guest, with no event being delivered and no breakpoints,
+	// whose store to the first data page faulted.
+	//
+	__stosb((PUCHAR)&vpState, 0, sizeof(vpState));
+	__stosb((PUCHAR)&context, 0, sizeof(context));
+	vpState.VpRegs = &context;
+
+	__vmx_vmwrite(GUEST_CS_AR_BYTES, SHV_TEST_DECODE_CS_LONG_MODE);
+	__vmx_vmwrite(IDT_VECTORING_INFO, 0);
+	__vmx_vmwrite(GUEST_DR7, 0);
+	__vmx_vmwrite(EXIT_QUALIFICATION, SHV_TEST_DECODE_WRITE);
+	__vmx_vmwrite(GUEST_PHYSICAL_ADDRESS, SHV_TEST_DECODE_DATA(0));
+	__vmx_vmwrite(GUEST_LINEAR_ADDRESS, SHV_TEST_DECODE_DATA(0));
+
+	//
+	// Only the time spent in root mode is measured, for an exit that ends
+	// in the guest resuming past the store.  Stepping the store instead
+	// takes a second exit and entry on top of the first.
+	//
+	ShvTestPrint("%-30s %10s %10s %10s %10s\n", "store", "decode ns", "prepare ns", "commit ns", "total ns");
+
+	for (ULONG s = 0; s < RTL_NUMBER_OF(ShvTestDecodeStores); s++)
+	{
+		test = &ShvTestDecodeStores[s];
+
+		__movsb(memory, test->Code, test->Length);
+		ShvTestDecodeReset(&vpState, test);
+
+		if (!SHV_TEST_CHECK_SUCCESS(ShvVmxEmulPrepareStore(NULL, &vpState, SHV_TEST_DECODE_DATA(0), &store)) ||
+			!SHV_TEST_CHECK(store.Instruction.Length == test->Length))
+		{
+			continue;
+		}
+
+		start = ShvTestNow();
+
+		for (ULONG i = 0; i < SHV_TEST_DECODE_ITERATIONS; i++)
+		{
+			ShvVmxEmulDecode(test->Code, test->Length, &instruction);
+		}
+
+		decode = ShvTestNow() - start;
+		start = ShvTestNow();
+
+		for (ULONG i = 0; i < SHV_TEST_DECODE_ITERATIONS; i++)
+		{
+			ShvVmxEmulPrepareStore(NULL, &vpState, SHV_TEST_DECODE_DATA(0), &store);
+		}
+
+		prepare = ShvTestNow() - start;
+		commit = 0;
+
+		for (ULONG b = 0; b < SHV_TEST_DECODE_ITERATIONS / SHV_TEST_DECODE_BATCH; b++)
+		{
+			start = ShvTestNow();
+
+			for (ULONG i = 0; i < SHV_TEST_DECODE_BATCH; i++)
+			{
+				ShvTestDecodeReset(&vpState, test);
+				ShvVmxEmulCommitStore(NULL, &vpState, &store);
+			}
+
+			commit += ShvTestNow() - start;
+		}
+
+		//
+		// Every store ended where it should have, having moved the guest
+		// past it.
+		//
+		SHV_TEST_CHECK(vpState.GuestRip == SHV_TEST_DECODE_BASE + test->Length);
+		SHV_TEST_CHECK(test->Count == 0 || context.Rcx == 0);
+
+		ShvTestPrint("%-30s %10.1f %10.1f %10.1f %10.1f\n",
+			test->Name,
+			(double)decode / SHV_TEST_DECODE_ITERATIONS,
+			(double)prepare / SHV_TEST_DECODE_ITERATIONS,
+			(double)commit / SHV_TEST_DECODE_ITERATIONS,
+			(double)(prepare + commit) / SHV_TEST_DECODE_ITERATIONS);
+	}
+
+	ShvTestSetGuestMemory(0, NULL, 0);
+	ShvTestPlatFreePages(memory, SHV_TEST_DECODE_PAGES * PAGE_SIZE);
+	ShvTestStopEpt();
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+static BOOLEAN
+ShvTestDecodeMatches(
+	_In_ const SHV_TEST_DECODE_CASE *Case,
+	_In_ NTSTATUS Status,
+	_In_ const SHV_EMUL_INSTRUCTION *Instruction
+)
+{
+	ULONG64 mask;
+
+	if (Case->Decoded == 0)
+	{
+		return (Status != STATUS_SUCCESS);
+	}
+
+	if (Status != STATUS_SUCCESS)
+	{
+		return FALSE;
+	}
+
+	//
+	// Immediates only count as far as the operand goes, as do 32-bit
+	// addresses, and the scale only means something with an index.
+	//
+	mask = (Instruction->Size < 8) ? (1ULL << (Instruction->Size * 8)) - 1 : ~0ULL;
+
+	if ((Instruction->Immediate & mask) != Case->Immediate)
+	{
+		return FALSE;
+	}
+
+	mask = (Instruction->Flags & SHV_EMUL_FLAG_ADDRESS32) ? 0xffffffff : ~0ULL;
+
+	if (((ULONG64)Instruction->Displacement & mask) != Case->Displacement)
+	{
+		return FALSE;
+	}
+
+	if (Instruction->Index != SHV_EMUL_NO_REGISTER && Instruction->Scale != Case->Scale)
+	{
+		return FALSE;
+	}
+
+	return (Instruction->Length == Case->Decoded &&
+		Instruction->Operation == Case->Operation &&
+		Instruction->Size == Case->Size &&
+		Instruction->Flags == Case->Flags &&
+		Instruction->Register == Case->Register &&
+		Instruction->Base == Case->Base &&
+		Instruction->Index == Case->Index &&
+		Instruction->Segment == Case->Segment);
+}
+
+static VOID
+ShvTestDecodeReset(
+	_Inout_ PSHV_VP_STATE VpState,
+	_In_ const SHV_TEST_DECODE_STORE *Store
+)
+{
+	//
+	// Put the guest back at the store, with its operands pointing at the
+	// first data page, and string instructions copying from the second.
+	//
+	VpState->GuestRip = SHV_TEST_DECODE_BASE;
+	VpState->GuestEFlags = 0x2;
+	VpState->VpRegs->Rdi = SHV_TEST_DECODE_DATA(0) - Store->Offset;
+	VpState->VpRegs->Rsi = SHV_TEST_DECODE_DATA(1);
+	VpState->VpRegs->Rcx = (Store->Count != 0) ? Store->Count : 0x1122334455667788;
+}
+
+static PCSTR
+ShvTestDecodeHex(
+	_In_reads_bytes_(Length) PCSTR Code,
+	_In_ ULONG Length,
+	_Out_writes_(SHV_EMUL_MAX_LENGTH * 3 + 1) PCHAR Buffer
+)
+{
+	static const CHAR digits[] = "0123456789abcdef";
+	ULONG i;
+
+	Length = min(Length, SHV_EMUL_MAX_LENGTH);
+
+	for (i = 0; i < Length; i++)
+	{
+		Buffer[i * 3] = digits[(UCHAR)Code[i] >> 4];
+		Buffer[i * 3 + 1] = digits[(UCHAR)Code[i] & 0xf];
+		Buffer[i * 3 + 2] = ' ';
+	}
+
+	Buffer[i * 3] = '\0';
+
+	return Buffer;
+}
@@ -0,0 +1,534 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvtestdedup.c
+
+Abstract:
+
+	This module tests page merging: that it only runs when root mode can
+	shoot down, that a scan maps identical pages and zero pages read-only
+	at a frame they share, and that a write gives the page its own frame
+	back, but only once no VP can still read the shared one, and never
+	reaches the frame the other pages share.  It also tests that pages
+	whose fingerprints collide aren't merged, and that the frames behind
+	shared pages can be lent and given back.
+
+Author:
+
+	agent (@agent) 16-Oct-2026 - Initial version
+
+Environment:
+
+	User mode only.
+
+--*/
+
+#include "shvtest.h"
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// The guest memory the test provides, in the first 1 GiB of RAM.  The
+// pages that are merged are at the start of it, and the frames merging
+// allocates are further in.
+//
+#define SHV_TEST_DEDUP_BASE             (0x10000000)
+#define SHV_TEST_DEDUP_SIZE             (0x100000)
+#define SHV_TEST_DEDUP_FRAMES           (SHV_TEST_DEDUP_BASE + SHV_TEST_DEDUP_SIZE / 2)
+#define SHV_TEST_DEDUP_PAGE(n)          (SHV_TEST_DEDUP_BASE + (n) * PAGE_SIZE)
+
+//
+// How many pages are registered for merging.  Pages 0, 1 and 5 are the
+// same, 2, 3 and 7 are zero, and 4 and 6 are different from everything.
+// Page 3 only becomes zero after the first scan, and page 7 is
+// write-protected by someone else.
+//
+#define SHV_TEST_DEDUP_PAGES            (8)
+
+//
+// How many LPs there are.  The second one has to flush before a write to
+// a merged page can go through.
+//
+#define SHV_TEST_DEDUP_PROCESSORS       (2)
+
+#define SHV_TEST_DEDUP_RX               (VMX_EPT_ACCESS_READ | VMX_EPT_ACCESS_EXECUTE)
+
+//
+// First words of two pages that are otherwise zero and fingerprint the
+// same.  The first lane starts out as the seed, and each word mixes into
+// it as its low half times the multiplier plus its high half, which is
+// the multiplier for both.
+//
+#define SHV_TEST_DEDUP_SEED             (0x9E3779B97F4A7C15ULL)
+#define SHV_TEST_DEDUP_MULTIPLIER       (0x85EBCA6BULL)
+#define SHV_TEST_DEDUP_COLLIDE_A        (SHV_TEST_DEDUP_SEED ^ (SHV_TEST_DEDUP_MULTIPLIER << 32))
+#define SHV_TEST_DEDUP_COLLIDE_B        (SHV_TEST_DEDUP_SEED ^ 1)
+
+// ===========================================================================
+//
+// LOCAL PROTOTYPES
+//
+// ===========================================================================
+
+static ULONG64
+ShvTestDedupFrame(
+	_In_ ULONG64 Gpa
+);
+
+static UCHAR
+ShvTestDedupRead(
+	_In_ ULONG64 Gpa
+);
+
+static BOOLEAN
+ShvTestDedupWrite(
+	_In_ ULONG64 Gpa,
+	_In_ UCHAR Value
+);
+
+static VOID
+ShvTestDedupSynchronize(
+	_In_ ULONG Processor
+);
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+VOID
+ShvTestMergePages(
+	VOID
+)
+{
+	SHV_MERGE_STATISTICS statistics;
+	SHV_EPT_PROTECTION protection;
+	ULONG64 reclaimed[SHV_TEST_DEDUP_PAGES];
+	ULONG64 shared, zero, hpa, lent, scanned;
+	ULONG returned;
+	PUCHAR memory;
+	UCHAR value;
+
+	memory = (PUCHAR)ShvTestPlatAllocatePages(SHV_TEST_DEDUP_SIZE, MM_ANY_NODE_OK);
+	if (!SHV_TEST_CHECK(memory != NULL))
+	{
+		return;
+	}
+
+	__stosb(memory, 0, SHV_TEST_DEDUP_SIZE);
+
+	for (ULONG i = 0; i < PAGE_SIZE; i++)
+	{
+		memory[0 * PAGE_SIZE + i] = (UCHAR)(i * 7 + 1);
+		memory[1 * PAGE_SIZE + i] = (UCHAR)(i * 7 + 1);
+		memory[5 * PAGE_SIZE + i] = (UCHAR)(i * 7 + 1);
+		memory[4 * PAGE_SIZE + i] = (UCHAR)(i * 13 + 1);
+		memory[6 * PAGE_SIZE + i] = (UCHAR)(i * 7 + 1);
+	}
+
+	memory[6 * PAGE_SIZE + PAGE_SIZE - 1] ^= 1;
+	memory[3 * PAGE_SIZE] = 1;
+
+	ShvTestSetGuestMemory(SHV_TEST_DEDUP_BASE, memory, SHV_TEST_DEDUP_SIZE);
+	ShvTestSetProcessors(SHV_TEST_DEDUP_PROCESSORS, 1);
+
+	//
+	// Without virtual NMIs, root mode can't shoot down, so nothing is ever
+	// merged.
+	//
+	if (!SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+	{
+		goto Free;
+	}
+
+	SHV_TEST_CHECK_SUCCESS(ShvTestStartMerge(SHV_TEST_DEDUP_FRAMES));
+	SHV_TEST_CHECK(ShvVmxMergeAddRange(SHV_TEST_DEDUP_BASE, PAGE_SIZE) == STATUS_HV_NOT_PRESENT);
+	SHV_TEST_CHECK(ShvTestStopMerge() == 0);
+
+	ShvTestStopEpt();
+
+	//
+	// With them, only whole pages can be registered.
+	//
+	ShvTestSetMsr(MSR_IA32_VMX_TRUE_PINBASED_CTLS, (ULONG64)PIN_BASED_VIRTUAL_NMIS << 32);
+
+	if (!SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+	{
+		goto Free;
+	}
+
+	for (ULONG i = 0; i < SHV_TEST_DEDUP_PROCESSORS; i++)
+	{
+		ShvGlobalData->VpData[i].VmxEnabled = 1;
+		ShvTestDedupSynchronize(i);
+	}
+
+	if (!SHV_TEST_CHECK_SUCCESS(ShvTestStartMerge(SHV_TEST_DEDUP_FRAMES)))
+	{
+		ShvTestStopEpt();
+		goto Free;
+	}
+
+	SHV_TEST_CHECK(ShvVmxMergeAddRange(SHV_TEST_DEDUP_BASE + 1, PAGE_SIZE) == STATUS_INVALID_PARAMETER);
+	SHV_TEST_CHECK(ShvVmxMergeAddRange(SHV_TEST_DEDUP_BASE, PAGE_SIZE + 1) == STATUS_INVALID_PARAMETER);
+	SHV_TEST_CHECK(ShvVmxMergeAddRange(SHV_TEST_DEDUP_BASE, 0) == STATUS_INVALID_PARAMETER);
+	SHV_TEST_CHECK_SUCCESS(ShvVmxMergeAddRange(SHV_TEST_DEDUP_BASE, SHV_TEST_DEDUP_PAGES * PAGE_SIZE));
+
+	protection.Gpa = SHV_TEST_DEDUP_PAGE(7);
+	protection.Length = PAGE_SIZE;
+	protection.Access = VMX_EPT_ACCESS_READ;
+	SHV_TEST_CHECK_SUCCESS(ShvVmxEptProtectRanges(&protection, 1));
+
+	//
+	// A scan merges the three identical pages into a frame of their own,
+	// and the zero page into the zero frame, which is there from the
+	// start, even with nothing else in it.  Pages like no other, and pages
+	// someone else protected, stay as they are.
+	//
+	ShvTestScanMerge();
+
+	ShvVmxMergeQuery(&statistics);
+	SHV_TEST_CHECK(statistics.Scans == 1);
+	SHV_TEST_CHECK(statistics.PagesScanned == SHV_TEST_DEDUP_PAGES - 1);
+	SHV_TEST_CHECK(statistics.Merges == 4);
+	SHV_TEST_CHECK(statistics.SharedPages == 4);
+	SHV_TEST_CHECK(statistics.ZeroPages == 1);
+	SHV_TEST_CHECK(statistics.SharedFrames == 2);
+
+	shared = ShvTestDedupFrame(SHV_TEST_DEDUP_PAGE(0));
+	zero = ShvTestDedupFrame(SHV_TEST_DEDUP_PAGE(2));
+
+	SHV_TEST_CHECK(shared >= SHV_TEST_DEDUP_FRAMES && shared < SHV_TEST_DEDUP_BASE + SHV_TEST_DEDUP_SIZE);
+	SHV_TEST_CHECK(zero >= SHV_TEST_DEDUP_FRAMES && zero < SHV_TEST_DEDUP_BASE + SHV_TEST_DEDUP_SIZE);
+	SHV_TEST_CHECK(shared != zero);
+
+	SHV_TEST_CHECK(ShvTestDedupFrame(SHV_TEST_DEDUP_PAGE(1)) == shared);
+	SHV_TEST_CHECK(ShvTestDedupFrame(SHV_TEST_DEDUP_PAGE(5)) == shared);
+
+	SHV_TEST_CHECK(ShvVmxEptGetAccess(SHV_TEST_DEDUP_PAGE(4), &hpa) == VMX_EPT_ACCESS_RWX);
+	SHV_TEST_CHECK(hpa == SHV_TEST_DEDUP_PAGE(4));
+	SHV_TEST_CHECK(ShvVmxEptGetAccess(SHV_TEST_DEDUP_PAGE(6), &hpa) == VMX_EPT_ACCESS_RWX);
+	SHV_TEST_CHECK(hpa == SHV_TEST_DEDUP_PAGE(6));
+	SHV_TEST_CHECK(ShvVmxEptGetAccess(SHV_TEST_DEDUP_PAGE(7), &hpa) == VMX_EPT_ACCESS_READ);
+	SHV_TEST_CHECK(hpa == SHV_TEST_DEDUP_PAGE(7));
+
+	SHV_TEST_CHECK(RtlCompareMemory(ShvTestFindGuestMemory(shared), memory, PAGE_SIZE) == PAGE_SIZE);
+
+	//
+	// The next scan only looks at the pages that weren't merged, one of
+	// which is zero now.
+	//
+	memory[3 * PAGE_SIZE] = 0;
+
+	ShvTestScanMerge();
+
+	ShvVmxMergeQuery(&statistics);
+	SHV_TEST_CHECK(statistics.Scans == 2);
+	SHV_TEST_CHECK(statistics.PagesScanned == SHV_TEST_DEDUP_PAGES - 1 + 3);
+	SHV_TEST_CHECK(statistics.Merges == 5);
+	SHV_TEST_CHECK(statistics.ZeroPages == 2);
+	SHV_TEST_CHECK(ShvTestDedupFrame(SHV_TEST_DEDUP_PAGE(3)) == zero);
+
+	//
+	// A write to a merged page maps it read-only at its own frame, which
+	// still holds what it did.  The write only goes through once the
+	// other VP can't read the shared frame anymore, and the pages that
+	// still share it read what they did.
+	//
+	SHV_TEST_CHECK(!ShvTestDedupWrite(SHV_TEST_DEDUP_PAGE(1), 0x55));
+
+	SHV_TEST_CHECK(ShvVmxEptGetAccess(SHV_TEST_DEDUP_PAGE(1), &hpa) == SHV_TEST_DEDUP_RX);
+	SHV_TEST_CHECK(hpa == SHV_TEST_DEDUP_PAGE(1));
+	SHV_TEST_CHECK(ShvTestDedupRead(SHV_TEST_DEDUP_PAGE(1)) == 1);
+
+	SHV_TEST_CHECK(!ShvTestDedupWrite(SHV_TEST_DEDUP_PAGE(1), 0x55));
+	SHV_TEST_CHECK(ShvVmxEptGetAccess(SHV_TEST_DEDUP_PAGE(1), &hpa) == SHV_TEST_DEDUP_RX);
+
+	ShvVmxMergeQuery(&statistics);
+	SHV_TEST_CHECK(statistics.CopyOnWrites == 0);
+	SHV_TEST_CHECK(statistics.SharedPages == 5);
+
+	ShvTestDedupSynchronize(1);
+
+	SHV_TEST_CHECK(!ShvTestDedupWrite(SHV_TEST_DEDUP_PAGE(1), 0x55));
+	SHV_TEST_CHECK(ShvTestDedupWrite(SHV_TEST_DEDUP_PAGE(1), 0x55));
+
+	SHV_TEST_CHECK(ShvVmxEptGetAccess(SHV_TEST_DEDUP_PAGE(1), &hpa) == VMX_EPT_ACCESS_RWX);
+	SHV_TEST_CHECK(hpa == SHV_TEST_DEDUP_PAGE(1));
+	SHV_TEST_CHECK(memory[PAGE_SIZE] == 0x55);
+
+	SHV_TEST_CHECK(ShvTestDedupRead(SHV_TEST_DEDUP_PAGE(0)) == 1);
+	SHV_TEST_CHECK(ShvTestDedupRead(SHV_TEST_DEDUP_PAGE(5)) == 1);
+
+	ShvVmxMergeQuery(&statistics);
+	SHV_TEST_CHECK(statistics.CopyOnWrites == 1);
+	SHV_TEST_CHECK(statistics.SharedPages == 4);
+
+	//
+	// Once every page that shared a frame was written to, the next scan
+	// frees it.  The zero frame stays.  Pages that are alike again are
+	// merged again.
+	//
+	SHV_TEST_CHECK(!ShvTestDedupWrite(SHV_TEST_DEDUP_PAGE(0), 0x55));
+	SHV_TEST_CHECK(!ShvTestDedupWrite(SHV_TEST_DEDUP_PAGE(5), 0x77));
+	ShvTestDedupSynchronize(1);
+	SHV_TEST_CHECK(!ShvTestDedupWrite(SHV_TEST_DEDUP_PAGE(0), 0x55));
+	SHV_TEST_CHECK(!ShvTestDedupWrite(SHV_TEST_DEDUP_PAGE(5), 0x77));
+	SHV_TEST_CHECK(ShvTestDedupWrite(SHV_TEST_DEDUP_PAGE(0), 0x55));
+	SHV_TEST_CHECK(ShvTestDedupWrite(SHV_TEST_DEDUP_PAGE(5), 0x77));
+
+	ShvVmxMergeQuery(&statistics);
+	SHV_TEST_CHECK(statistics.CopyOnWrites == 3);
+	SHV_TEST_CHECK(statistics.SharedPages == 2);
+	SHV_TEST_CHECK(statistics.SharedFrames == 2);
+
+	ShvTestScanMerge();
+
+	ShvVmxMergeQuery(&statistics);
+	SHV_TEST_CHECK(statistics.Merges == 7);
+	SHV_TEST_CHECK(statistics.SharedPages == 4);
+	SHV_TEST_CHECK(statistics.ZeroPages == 2);
+	SHV_TEST_CHECK(statistics.SharedFrames == 2);
+
+	shared = ShvTestDedupFrame(SHV_TEST_DEDUP_PAGE(0));
+	SHV_TEST_CHECK(shared != 0 && shared != zero);
+	SHV_TEST_CHECK(ShvTestDedupFrame(SHV_TEST_DEDUP_PAGE(1)) == shared);
+	SHV_TEST_CHECK(ShvVmxEptGetAccess(SHV_TEST_DEDUP_PAGE(5), &hpa) == VMX_EPT_ACCESS_RWX);
+	SHV_TEST_CHECK(ShvTestDedupRead(SHV_TEST_DEDUP_PAGE(0)) == 0x55);
+
+	//
+	// Pages whose fingerprints match but whose contents don't are compared
+	// before they are merged, and aren't.  The frame made for them backs
+	// nothing and is freed.
+	//
+	__stosb(&memory[4 * PAGE_SIZE], 0, PAGE_SIZE);
+	__stosb(&memory[6 * PAGE_SIZE], 0, PAGE_SIZE);
+	*(PULONG64)&memory[4 * PAGE_SIZE] = SHV_TEST_DEDUP_COLLIDE_A;
+	*(PULONG64)&memory[6 * PAGE_SIZE] = SHV_TEST_DEDUP_COLLIDE_B;
+
+	ShvTestScanMerge();
+
+	ShvVmxMergeQuery(&statistics);
+	SHV_TEST_CHECK(statistics.Mismatches == 1);
+	SHV_TEST_CHECK(statistics.Merges == 7);
+	SHV_TEST_CHECK(statistics.SharedFrames == 2);
+
+	SHV_TEST_CHECK(ShvVmxEptGetAccess(SHV_TEST_DEDUP_PAGE(4), &hpa) == VMX_EPT_ACCESS_RWX);
+	SHV_TEST_CHECK(hpa == SHV_TEST_DEDUP_PAGE(4));
+	SHV_TEST_CHECK(ShvVmxEptGetAccess(SHV_TEST_DEDUP_PAGE(6), &hpa) == VMX_EPT_ACCESS_RWX);
+	SHV_TEST_CHECK(hpa == SHV_TEST_DEDUP_PAGE(6));
+
+	//
+	// The frames behind the shared pages can be lent, once each.  The
+	// guest doesn't see what the borrower puts in one.
+	//
+	SHV_TEST_CHECK_SUCCESS(ShvVmxMergeQueryReclaimed(reclaimed, RTL_NUMBER_OF(reclaimed), &returned));
+	SHV_TEST_CHECK(returned == 4);
+
+	for (ULONG i = 0; i < returned; i++)
+	{
+		SHV_TEST_CHECK(reclaimed[i] >= SHV_TEST_DEDUP_PAGE(0) && reclaimed[i] <= SHV_TEST_DEDUP_PAGE(3));
+	}
+
+	if (!SHV_TEST_CHECK_SUCCESS(ShvVmxMergeAcquireFrame(&lent)))
+	{
+		lent = SHV_TEST_DEDUP_PAGE(0);
+	}
+
+	SHV_TEST_CHECK(ShvTestDedupFrame(lent) != 0);
+	SHV_TEST_CHECK_SUCCESS(ShvVmxMergeQueryReclaimed(reclaimed, RTL_NUMBER_OF(reclaimed), &returned));
+	SHV_TEST_CHECK(returned == 3);
+
+	for (ULONG i = 0; i < 3; i++)
+	{
+		SHV_TEST_CHECK_SUCCESS(ShvVmxMergeAcquireFrame(&hpa));
+		SHV_TEST_CHECK(hpa != lent);
+	}
+
+	SHV_TEST_CHECK(ShvVmxMergeAcquireFrame(&hpa) == STATUS_NO_MORE_ENTRIES);
+	SHV_TEST_CHECK_SUCCESS(ShvVmxMergeQueryReclaimed(reclaimed, RTL_NUMBER_OF(reclaimed), &returned));
+	SHV_TEST_CHECK(returned == 0);
+
+	ShvVmxMergeQuery(&statistics);
+	SHV_TEST_CHECK(statistics.LentPages == 4);
+
+	value = ShvTestDedupRead(lent);
+	memory[lent - SHV_TEST_DEDUP_BASE] = 0xEE;
+	SHV_TEST_CHECK(ShvTestDedupRead(lent) == value);
+
+	//
+	// A write to a lent page copies it into a frame of its own, and a scan
+	// leaves it there, even once it is the same as other pages again.
+	//
+	SHV_TEST_CHECK(!ShvTestDedupWrite(lent, value));
+	ShvTestDedupSynchronize(1);
+	SHV_TEST_CHECK(!ShvTestDedupWrite(lent, value));
+	SHV_TEST_CHECK(ShvTestDedupWrite(lent, value));
+
+	SHV_TEST_CHECK(ShvVmxEptGetAccess(lent, &hpa) == VMX_EPT_ACCESS_RWX);
+	SHV_TEST_CHECK(hpa >= SHV_TEST_DEDUP_FRAMES && hpa < SHV_TEST_DEDUP_BASE + SHV_TEST_DEDUP_SIZE);
+	SHV_TEST_CHECK(ShvTestDedupRead(lent) == value);
+	SHV_TEST_CHECK(memory[lent - SHV_TEST_DEDUP_BASE] == 0xEE);
+
+	ShvVmxMergeQuery(&statistics);
+	SHV_TEST_CHECK(statistics.CopyOnWrites == 4);
+	SHV_TEST_CHECK(statistics.PrivatePages == 1);
+	SHV_TEST_CHECK(statistics.LentPages == 4);
+
+	scanned = statistics.PagesScanned;
+
+	ShvTestScanMerge();
+
+	ShvVmxMergeQuery(&statistics);
+	SHV_TEST_CHECK(statistics.PagesScanned == scanned + 3);
+	SHV_TEST_CHECK(statistics.Merges == 7);
+	SHV_TEST_CHECK(ShvVmxEptGetAccess(lent, &hpa) == VMX_EPT_ACCESS_RWX);
+
+	//
+	// Giving the frame back maps the page to it again, with what the guest
+	// wrote, and only once.
+	//
+	SHV_TEST_CHECK_SUCCESS(ShvVmxMergeReleaseFrame(lent));
+	SHV_TEST_CHECK(ShvVmxMergeReleaseFrame(lent) == STATUS_INVALID_PARAMETER);
+	SHV_TEST_CHECK(ShvVmxMergeReleaseFrame(SHV_TEST_DEDUP_PAGE(4)) == STATUS_INVALID_PARAMETER);
+
+	SHV_TEST_CHECK(ShvVmxEptGetAccess(lent, &hpa) == VMX_EPT_ACCESS_RWX);
+	SHV_TEST_CHECK(hpa == lent);
+	SHV_TEST_CHECK(memory[lent - SHV_TEST_DEDUP_BASE] == value);
+
+	ShvVmxMergeQuery(&statistics);
+	SHV_TEST_CHECK(statistics.PrivatePages == 0);
+	SHV_TEST_CHECK(statistics.LentPages == 3);
+
+	//
+	// A write that is still waiting for the other VP when merging is torn
+	// down is finished then.  Every page maps its own frame again, with
+	// what it held, including those whose frames are still lent, and
+	// every frame is given back.
+	//
+	SHV_TEST_CHECK(!ShvTestDedupWrite(SHV_TEST_DEDUP_PAGE(3), 0x33));
+	SHV_TEST_CHECK(ShvTestStopMerge() == 0);
+
+	ShvVmxMergeQuery(&statistics);
+	SHV_TEST_CHECK(statistics.SharedPages == 0);
+	SHV_TEST_CHECK(statistics.ZeroPages == 0);
+	SHV_TEST_CHECK(statistics.LentPages == 0);
+	SHV_TEST_CHECK(statistics.CopyOnWrites == 5);
+
+	for (ULONG i = 0; i < SHV_TEST_DEDUP_PAGES - 1; i++)
+	{
+		SHV_TEST_CHECK(ShvVmxEptGetAccess(SHV_TEST_DEDUP_PAGE(i), &hpa) == VMX_EPT_ACCESS_RWX);
+		SHV_TEST_CHECK(hpa == SHV_TEST_DEDUP_PAGE(i));
+	}
+
+	SHV_TEST_CHECK(ShvTestDedupWrite(SHV_TEST_DEDUP_PAGE(3), 0x33));
+	SHV_TEST_CHECK(memory[0] == 0x55 && memory[PAGE_SIZE] == 0x55 && memory[5 * PAGE_SIZE] == 0x77);
+	SHV_TEST_CHECK(memory[PAGE_SIZE + 1] == 8);
+
+	for (ULONG i = 0; i < SHV_TEST_DEDUP_PROCESSORS; i++)
+	{
+		ShvGlobalData->VpData[i].VmxEnabled = 0;
+	}
+
+	ShvTestStopEpt();
+
+Free:
+	ShvTestSetGuestMemory(0, NULL, 0);
+	ShvTestPlatFreePages(memory, SHV_TEST_DEDUP_SIZE);
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+static ULONG64
+ShvTestDedupFrame(
+	_In_ ULONG64 Gpa
+)
+{
+	ULONG64 hpa;
+
+	//
+	// The frame a merged page shares, or 0 if it isn't merged.
+	//
+	if (ShvVmxEptGetAccess(Gpa, &hpa) != SHV_TEST_DEDUP_RX || hpa == Gpa)
+	{
+		return 0;
+	}
+
+	return hpa;
+}
+
+static UCHAR
+ShvTestDedupRead(
+	_In_ ULONG64 Gpa
+)
+{
+	ULONG64 hpa;
+
+	//
+	// What the guest reads from the first byte of a page.
+	//
+	if ((ShvVmxEptGetAccess(Gpa, &hpa) & VMX_EPT_ACCESS_READ) == 0)
+	{
+		return 0;
+	}
+
+	return *(PUCHAR)ShvTestFindGuestMemory(hpa);
+}
+
+static BOOLEAN
+ShvTestDedupWrite(
+	_In_ ULONG64 Gpa,
+	_In_ UCHAR Value
+)
+{
+	SHV_VP_STATE vpState;
+	ULONG64 hpa;
+	KIRQL irql;
+
+	//
+	// A guest write to the first byte of a page on the first LP.  It goes
+	// through if the EPT allows it, and otherwise takes a violation, in
+	// root mode with interrupts off, after which the guest retries.
+	//
+	if (ShvVmxEptGetAccess(Gpa, &hpa) & VMX_EPT_ACCESS_WRITE)
+	{
+		*(PUCHAR)ShvTestFindGuestMemory(hpa) = Value;
+		return TRUE;
+	}
+
+	__stosb((PUCHAR)&vpState, 0, sizeof(vpState));
+
+	__vmx_vmwrite(GUEST_PHYSICAL_ADDRESS, Gpa);
+	__vmx_vmwrite(EXIT_QUALIFICATION, VMX_EPT_ACCESS_WRITE);
+
+	KeRaiseIrql(HIGH_LEVEL, &irql);
+	ShvVmxEptHandleViolation(&vpState);
+	KeLowerIrql(irql);
+
+	return FALSE;
+}
+
+static VOID
+ShvTestDedupSynchronize(
+	_In_ ULONG Processor
+)
+{
+	//
+	// What a VP does on its way back into the guest.
+	//
+	ShvTestSetCurrentProcessor(Processor);
+	ShvVmxEptSynchronize(&ShvGlobalData->VpData[Processor]);
+	ShvTestSetCurrentProcessor(0);
+}
@@ -0,0 +1,252 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvtestdemand.c
+
+Abstract:
+
+	This module tests populating the EPT on demand: that a violation maps
+	the largest region around the GPA its memory types allow, that RAM is
+	mapped in bulk up to the end of its range, and that a table the faults
+	complete is promoted to a large page when it can be one.
+
+Author:
+
+	agent (@agent) 16-Oct-2026 - Initial version
+
+Environment:
+
+	User mode only.
+
+--*/
+
+#include "shvtest.h"
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// MMIO well above the 5 GiB of address space the default machine's RAM
+// ends at, which the MTRRs leave write-back.
+//
+#define SHV_TEST_DEMAND_MMIO            (8 * SHV_TEST_GB)
+
+//
+// Where the RAM of the machine with a short RAM range ends, in the middle
+// of its 1 GiB region.
+//
+#define SHV_TEST_DEMAND_RAM_END         (0x50000000ULL)
+
+//
+// The mask of a variable MTRR that covers a single 4 KiB page of the
+// default machine's 46-bit physical address space.
+//
+#define SHV_TEST_DEMAND_PAGE_MASK       ((((1ULL << 46) - 1) & ~(PAGE_SIZE - 1ULL)) | MTRR_PHYSMASK_VALID)
+
+// ===========================================================================
+//
+// LOCAL PROTOTYPES
+//
+// ===========================================================================
+
+static BOOLEAN
+ShvTestDemandStart(
+	_In_ ULONG64 Capabilities
+);
+
+static VOID
+ShvTestDemandFault(
+	_In_ ULONG64 Gpa
+);
+
+static ULONG64
+ShvTestDemandBytes(
+	VOID
+);
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+VOID
+ShvTestDemand(
+	VOID
+)
+{
+	PHYSICAL_MEMORY_RANGE ranges[2];
+	ULONG64 tables;
+	ULONG exhausted;
+
+	//
+	// Only the first MiB is there up front, with 4 KiB pages.
+	//
+	if (!ShvTestDemandStart(SHV_TEST_EPT_CAPS_1GB))
+	{
+		return;
+	}
+
+	SHV_TEST_CHECK(ShvVmxEptGetPageSize(0x1000) == PAGE_SIZE);
+	SHV_TEST_CHECK(ShvVmxEptGetPageSize(0x100000) == 0);
+	SHV_TEST_CHECK(ShvVmxEptGetPageSize(SHV_TEST_DEMAND_MMIO) == 0);
+
+	//
+	// MMIO whose 1 GiB region has a single memory type maps as one 1 GiB
+	// page.
+	//
+	ShvTestDemandFault(SHV_TEST_DEMAND_MMIO + 0x345000);
+
+	SHV_TEST_CHECK(ShvVmxEptGetPageSize(SHV_TEST_DEMAND_MMIO) == VMX_EPT_PAGE_SIZE_1GB);
+	SHV_TEST_CHECK(ShvVmxEptGetPageSize(SHV_TEST_DEMAND_MMIO + VMX_EPT_PAGE_SIZE_1GB) == 0);
+	SHV_TEST_CHECK(ShvTestDemandBytes() == VMX_EPT_PAGE_SIZE_1GB);
+
+	//
+	// The fault in the first 1 GiB completes the PT the first MiB is in.
+	// Every page of it is write-back, so the PT becomes a 2 MiB page, which
+	// in turn completes the PD, which becomes a 1 GiB page.  Neither table
+	// is used anymore, and both go back to the arena.
+	//
+	ShvTestQueryEptArena(&tables, &exhausted);
+	SHV_TEST_CHECK(tables == VMX_EPT_PAGE_WALK_LENGTH);
+
+	ShvTestDemandFault(0x150000);
+
+	SHV_TEST_CHECK(ShvVmxEptGetPageSize(0x1000) == VMX_EPT_PAGE_SIZE_1GB);
+	SHV_TEST_CHECK(ShvVmxEptGetPageSize(0x150000) == VMX_EPT_PAGE_SIZE_1GB);
+	SHV_TEST_CHECK(ShvTestReclaimEptTables() == 0);
+
+	ShvTestQueryEptArena(&tables, &exhausted);
+	SHV_TEST_CHECK(tables == 2);
+
+	ShvTestStopEpt();
+
+	//
+	// With a single 4 KiB page of the first 2 MiB uncached, neither table
+	// can be a large page, and stays as it is.  RAM is still mapped in
+	// bulk up to the end of its 1 GiB region, with the largest pages its
+	// types allow.
+	//
+	ShvTestSetMsr(MSR_IA32_MTRRCAP, 2);
+	ShvTestSetMsr(MSR_IA32_MTRR_PHYSBASE0 + 2, 0x1ff000 | Uncacheable);
+	ShvTestSetMsr(MSR_IA32_MTRR_PHYSMASK0 + 2, SHV_TEST_DEMAND_PAGE_MASK);
+
+	if (!ShvTestDemandStart(SHV_TEST_EPT_CAPS_1GB))
+	{
+		return;
+	}
+
+	ShvTestDemandFault(0x150000);
+
+	SHV_TEST_CHECK(ShvVmxEptGetPageSize(0x150000) == PAGE_SIZE);
+	SHV_TEST_CHECK(ShvVmxEptGetPageSize(0x1ff000) == PAGE_SIZE);
+	SHV_TEST_CHECK(ShvVmxEptGetPageSize(0x200000) == VMX_EPT_PAGE_SIZE_2MB);
+	SHV_TEST_CHECK(ShvVmxEptGetPageSize(VMX_EPT_PAGE_SIZE_1GB - PAGE_SIZE) == VMX_EPT_PAGE_SIZE_2MB);
+	SHV_TEST_CHECK(ShvVmxEptGetPageSize(VMX_EPT_PAGE_SIZE_1GB) == 0);
+	SHV_TEST_CHECK(ShvTestDemandBytes() == VMX_EPT_PAGE_SIZE_1GB);
+
+	ShvTestStopEpt();
+
+	ShvTestSetMsr(MSR_IA32_MTRRCAP, 1);
+	ShvTestSetMsr(MSR_IA32_MTRR_PHYSMASK0 + 2, 0);
+
+	//
+	// Without 1 GiB pages, MMIO only faults in the 2 MiB around the GPA.
+	//
+	if (!ShvTestDemandStart(SHV_TEST_EPT_CAPS_2MB))
+	{
+		return;
+	}
+
+	ShvTestDemandFault(SHV_TEST_DEMAND_MMIO + 0x345000);
+
+	SHV_TEST_CHECK(ShvVmxEptGetPageSize(SHV_TEST_DEMAND_MMIO + 0x200000) == VMX_EPT_PAGE_SIZE_2MB);
+	SHV_TEST_CHECK(ShvVmxEptGetPageSize(SHV_TEST_DEMAND_MMIO) == 0);
+	SHV_TEST_CHECK(ShvVmxEptGetPageSize(SHV_TEST_DEMAND_MMIO + 0x400000) == 0);
+	SHV_TEST_CHECK(ShvTestDemandBytes() == VMX_EPT_PAGE_SIZE_2MB);
+
+	ShvTestStopEpt();
+
+	//
+	// RAM that ends in the middle of its 1 GiB region is mapped in bulk up
+	// to where it ends, and not beyond.
+	//
+	ranges[0].BaseAddress.QuadPart = 0x1000;
+	ranges[0].NumberOfBytes.QuadPart = 0x9f000 - 0x1000;
+	ranges[1].BaseAddress.QuadPart = 0x100000;
+	ranges[1].NumberOfBytes.QuadPart = SHV_TEST_DEMAND_RAM_END - 0x100000;
+
+	ShvTestSetMemoryMap(ranges, RTL_NUMBER_OF(ranges));
+
+	if (!ShvTestDemandStart(SHV_TEST_EPT_CAPS_2MB))
+	{
+		return;
+	}
+
+	ShvTestDemandFault(0x48003000);
+
+	SHV_TEST_CHECK(ShvVmxEptGetPageSize(0x48000000) == VMX_EPT_PAGE_SIZE_2MB);
+	SHV_TEST_CHECK(ShvVmxEptGetPageSize(SHV_TEST_DEMAND_RAM_END - PAGE_SIZE) == VMX_EPT_PAGE_SIZE_2MB);
+	SHV_TEST_CHECK(ShvVmxEptGetPageSize(SHV_TEST_DEMAND_RAM_END) == 0);
+	SHV_TEST_CHECK(ShvVmxEptGetPageSize(0x48000000 - PAGE_SIZE) == 0);
+	SHV_TEST_CHECK(ShvTestDemandBytes() == SHV_TEST_DEMAND_RAM_END - 0x48000000);
+
+	ShvTestStopEpt();
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+static BOOLEAN
+ShvTestDemandStart(
+	_In_ ULONG64 Capabilities
+)
+{
+	ShvTestSetMsr(MSR_IA32_VMX_EPT_VPID_CAP, Capabilities);
+	ShvTestConfigureEpt(TRUE, FALSE, FALSE);
+
+	return SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt());
+}
+
+static VOID
+ShvTestDemandFault(
+	_In_ ULONG64 Gpa
+)
+{
+	SHV_VP_STATE vpState;
+	KIRQL irql;
+
+	//
+	// A read of a GPA the EPT doesn't map yet, taken in root mode with
+	// interrupts off.
+	//
+	__stosb((PUCHAR)&vpState, 0, sizeof(vpState));
+
+	__vmx_vmwrite(GUEST_PHYSICAL_ADDRESS, Gpa);
+	__vmx_vmwrite(EXIT_QUALIFICATION, VMX_EPT_ACCESS_READ);
+
+	KeRaiseIrql(HIGH_LEVEL, &irql);
+	ShvVmxEptHandleViolation(&vpState);
+	KeLowerIrql(irql);
+}
+
+static ULONG64
+ShvTestDemandBytes(
+	VOID
+)
+{
+	SHV_EPT_INSPECTION inspection;
+
+	ShvVmxEptInspect(&inspection);
+
+	return inspection.OnDemandBytes;
+}
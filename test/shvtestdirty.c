@@ -0,0 +1,393 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvtestdirty.c
+
+Abstract:
+
+	This module tests that the pages PML logs end up in the dirty bitmap
+	exactly once: that a full log drains every entry, that a large page
+	marks every page it maps, and that collecting hands over the pages of
+	every shard that was written to and clears their dirty flags.
+
+Author:
+
+	agent (@agent) 16-Oct-2026 - Initial version
+
+Environment:
+
+	User mode only.
+
+--*/
+
+#include "shvtest.h"
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// How many LPs log at once, and how many pages each of them logs.
+//
+#define SHV_TEST_DIRTY_PROCESSORS       (4)
+#define SHV_TEST_DIRTY_PAGES            (4096)
+
+//
+// Where the racing LPs start logging, and the GPA of the first page of a
+// page number.
+//
+#define SHV_TEST_DIRTY_BASE             (0x100000ULL)
+#define SHV_TEST_DIRTY_GPA(p)           ((ULONG64)(p) * PAGE_SIZE)
+
+// ===========================================================================
+//
+// LOCAL PROTOTYPES
+//
+// ===========================================================================
+
+static ULONG64
+ShvTestDirtyCount(
+	_In_ PRTL_BITMAP Bitmap
+);
+
+static BOOLEAN
+ShvTestDirtyIsSet(
+	_In_ PRTL_BITMAP Bitmap,
+	_In_ ULONG64 Gpa
+);
+
+static VOID
+ShvTestDirtyClear(
+	_In_ PRTL_BITMAP Bitmap
+);
+
+static VOID
+ShvTestDirtyLog(
+	_In_ ULONG Processor,
+	_In_opt_ PVOID Context
+);
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+VOID
+ShvTestDirtyPages(
+	VOID
+)
+{
+	ULONG64 gpas[VMX_PML_ENTRY_COUNT];
+	RTL_BITMAP bitmap;
+	ULONG64 large, small, pages;
+	SIZE_T index;
+	BOOLEAN found;
+
+	//
+	// Without EPT accessed and dirty flags the processor never logs, so PML
+	// stays off and there is nothing to collect.
+	//
+	ShvTestSetMsr(MSR_IA32_VMX_EPT_VPID_CAP, SHV_TEST_EPT_CAPS_1GB);
+	ShvTestSetMsr(MSR_IA32_VMX_PROCBASED_CTLS2, (ULONG64)(SECONDARY_EXEC_ENABLE_EPT | SECONDARY_EXEC_ENABLE_PML) << 32);
+
+	if (!SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+	{
+		return;
+	}
+
+	SHV_TEST_CHECK_SUCCESS(ShvTestStartPml());
+	SHV_TEST_CHECK(ShvVmxPmlEnabled == FALSE);
+	SHV_TEST_CHECK(ShvVmxPmlStartEpoch() == STATUS_NOT_SUPPORTED);
+
+	ShvTestStopPml();
+	ShvTestStopEpt();
+
+	//
+	// With them, the bitmap covers every page of RAM, up to the 1 GiB above
+	// 4 GiB.
+	//
+	ShvTestSetMsr(MSR_IA32_VMX_EPT_VPID_CAP, SHV_TEST_EPT_CAPS_1GB | VMX_EPT_CAP_ACCESSED_DIRTY);
+	ShvTestSetProcessors(SHV_TEST_DIRTY_PROCESSORS, 1);
+
+	if (!SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+	{
+		return;
+	}
+
+	if (!SHV_TEST_CHECK_SUCCESS(ShvTestStartPml()) || !SHV_TEST_CHECK(ShvVmxPmlEnabled))
+	{
+		ShvTestStopPml();
+		ShvTestStopEpt();
+		return;
+	}
+
+	pages = ShvVmxPmlGetPageCount();
+	SHV_TEST_CHECK(pages == 5 * SHV_TEST_GB / PAGE_SIZE);
+
+	bitmap.SizeOfBitMap = (ULONG)pages - 1;
+	bitmap.Buffer = (PULONG)ShvTestPlatAllocate((SIZE_T)pages / 8, 64);
+	if (!SHV_TEST_CHECK(bitmap.Buffer != NULL))
+	{
+		ShvTestStopPml();
+		ShvTestStopEpt();
+		return;
+	}
+
+	SHV_TEST_CHECK(ShvVmxPmlCollect(&bitmap) == STATUS_BUFFER_TOO_SMALL);
+
+	bitmap.SizeOfBitMap = (ULONG)pages;
+	ShvTestDirtyClear(&bitmap);
+
+	//
+	// Before an epoch RAM is still mapped with large pages, and the
+	// processor only logs the first write to each.  Logging a page of one
+	// marks every page it maps, and a write above the top of RAM isn't
+	// part of a capture, so it is dropped.
+	//
+	large = 4 * SHV_TEST_GB + 0x123000;
+	small = 0x300000;
+
+	SHV_TEST_CHECK(ShvVmxEptGetPageSize(large) == VMX_EPT_PAGE_SIZE_1GB);
+	SHV_TEST_CHECK(ShvVmxEptGetPageSize(small) == VMX_EPT_PAGE_SIZE_2MB);
+
+	ShvTestSetEptDirty(large);
+	ShvTestSetEptDirty(small);
+	ShvTestSetEptDirty(0x800000);
+
+	gpas[0] = large;
+	gpas[1] = small;
+	gpas[2] = 5 * SHV_TEST_GB + 0x1000;
+
+	SHV_TEST_CHECK(ShvTestLogPml(gpas, 3) == 3);
+	ShvTestDrainPml();
+
+	SHV_TEST_CHECK_SUCCESS(ShvVmxPmlCollect(&bitmap));
+	SHV_TEST_CHECK(ShvTestDirtyCount(&bitmap) ==
+		(VMX_EPT_PAGE_SIZE_1GB + VMX_EPT_PAGE_SIZE_2MB) / PAGE_SIZE);
+	SHV_TEST_CHECK(ShvTestDirtyIsSet(&bitmap, 4 * SHV_TEST_GB));
+	SHV_TEST_CHECK(ShvTestDirtyIsSet(&bitmap, 5 * SHV_TEST_GB - PAGE_SIZE));
+	SHV_TEST_CHECK(!ShvTestDirtyIsSet(&bitmap, 4 * SHV_TEST_GB - PAGE_SIZE));
+	SHV_TEST_CHECK(ShvTestDirtyIsSet(&bitmap, 0x200000));
+	SHV_TEST_CHECK(ShvTestDirtyIsSet(&bitmap, 0x3ff000));
+	SHV_TEST_CHECK(!ShvTestDirtyIsSet(&bitmap, 0x1ff000));
+	SHV_TEST_CHECK(!ShvTestDirtyIsSet(&bitmap, 0x400000));
+
+	//
+	// Collecting clears the dirty flags of what it handed over, so that
+	// the next write to those pages is logged again, and only of those.
+	//
+	SHV_TEST_CHECK(!ShvTestIsEptDirty(large));
+	SHV_TEST_CHECK(!ShvTestIsEptDirty(small));
+	SHV_TEST_CHECK(ShvTestIsEptDirty(0x800000));
+
+	//
+	// Starting an epoch maps everything at 4 KiB, forgets whatever was
+	// logged before it, and clears every dirty flag.
+	//
+	gpas[0] = 0x400000;
+
+	SHV_TEST_CHECK(ShvTestLogPml(gpas, 1) == 1);
+	ShvTestDrainPml();
+
+	SHV_TEST_CHECK_SUCCESS(ShvVmxPmlStartEpoch());
+	SHV_TEST_CHECK(ShvVmxEptGetPageSize(large) == PAGE_SIZE);
+	SHV_TEST_CHECK(ShvVmxEptGetPageSize(small) == PAGE_SIZE);
+	SHV_TEST_CHECK(!ShvTestIsEptDirty(0x800000));
+
+	ShvTestDirtyClear(&bitmap);
+	SHV_TEST_CHECK_SUCCESS(ShvVmxPmlCollect(&bitmap));
+	SHV_TEST_CHECK(ShvTestDirtyCount(&bitmap) == 0);
+
+	//
+	// The processor fills the log from the top down.  Draining an empty
+	// log finds nothing, draining part of one finds just what was logged,
+	// and either way logging starts over from the top.
+	//
+	ShvTestSetCurrentProcessor(1);
+
+	ShvTestDrainPml();
+	__vmx_vmread(GUEST_PML_INDEX, &index);
+	SHV_TEST_CHECK(index == VMX_PML_INDEX_START);
+
+	for (ULONG i = 0; i < VMX_PML_ENTRY_COUNT; i++)
+	{
+		//
+		// A page in a shard of its own, at a different place in each, so
+		// that the log touches every word of the summary it can reach.
+		//
+		gpas[i] = SHV_TEST_DIRTY_BASE + i * (SHV_PML_SHARD_SIZE + PAGE_SIZE);
+	}
+
+	SHV_TEST_CHECK(ShvTestLogPml(gpas, 3) == 3);
+	__vmx_vmread(GUEST_PML_INDEX, &index);
+	SHV_TEST_CHECK(index == VMX_PML_INDEX_START - 3);
+
+	ShvTestDrainPml();
+	__vmx_vmread(GUEST_PML_INDEX, &index);
+	SHV_TEST_CHECK(index == VMX_PML_INDEX_START);
+
+	SHV_TEST_CHECK_SUCCESS(ShvVmxPmlCollect(&bitmap));
+	SHV_TEST_CHECK(ShvTestDirtyCount(&bitmap) == 3);
+	SHV_TEST_CHECK(ShvTestDirtyIsSet(&bitmap, gpas[0]));
+	SHV_TEST_CHECK(ShvTestDirtyIsSet(&bitmap, gpas[1]));
+	SHV_TEST_CHECK(ShvTestDirtyIsSet(&bitmap, gpas[2]));
+
+	//
+	// Once the last entry is used the index wraps around past zero, and
+	// the processor stops logging.  Draining then has to take every entry.
+	//
+	ShvTestDirtyClear(&bitmap);
+
+	for (ULONG i = 0; i < VMX_PML_ENTRY_COUNT; i++)
+	{
+		ShvTestSetEptDirty(gpas[i]);
+	}
+
+	ShvTestSetEptDirty(gpas[0] + PAGE_SIZE);
+
+	SHV_TEST_CHECK(ShvTestLogPml(gpas, VMX_PML_ENTRY_COUNT) == VMX_PML_ENTRY_COUNT);
+	SHV_TEST_CHECK(ShvTestLogPml(gpas, 1) == 0);
+	__vmx_vmread(GUEST_PML_INDEX, &index);
+	SHV_TEST_CHECK(index == 0xffff);
+
+	ShvTestDrainPml();
+	__vmx_vmread(GUEST_PML_INDEX, &index);
+	SHV_TEST_CHECK(index == VMX_PML_INDEX_START);
+
+	ShvTestSetCurrentProcessor(0);
+
+	SHV_TEST_CHECK_SUCCESS(ShvVmxPmlCollect(&bitmap));
+	SHV_TEST_CHECK(ShvTestDirtyCount(&bitmap) == VMX_PML_ENTRY_COUNT);
+
+	found = TRUE;
+	for (ULONG i = 0; i < VMX_PML_ENTRY_COUNT; i++)
+	{
+		found &= ShvTestDirtyIsSet(&bitmap, gpas[i]) && !ShvTestIsEptDirty(gpas[i]);
+	}
+
+	SHV_TEST_CHECK(found);
+	SHV_TEST_CHECK(ShvTestIsEptDirty(gpas[0] + PAGE_SIZE));
+
+	//
+	// Collecting only ever adds bits to what the caller already has, and
+	// hands each logged page over once.  Writes root mode makes for the
+	// guest are collected the same way.
+	//
+	ShvTestDirtyClear(&bitmap);
+	bitmap.Buffer[0] = 1;
+
+	ShvVmxPmlLogWrite(0x9000);
+
+	SHV_TEST_CHECK_SUCCESS(ShvVmxPmlCollect(&bitmap));
+	SHV_TEST_CHECK(ShvTestDirtyCount(&bitmap) == 2);
+	SHV_TEST_CHECK(ShvTestDirtyIsSet(&bitmap, 0));
+	SHV_TEST_CHECK(ShvTestDirtyIsSet(&bitmap, 0x9000));
+
+	ShvTestDirtyClear(&bitmap);
+	SHV_TEST_CHECK_SUCCESS(ShvVmxPmlCollect(&bitmap));
+	SHV_TEST_CHECK(ShvTestDirtyCount(&bitmap) == 0);
+
+	//
+	// Every LP drains its own log into the shared bitmap at once, with
+	// their pages interleaved so that they keep setting bits in the same
+	// words.  None of them may be lost.
+	//
+	ShvTestRunOnProcessors(SHV_TEST_DIRTY_PROCESSORS, ShvTestDirtyLog, NULL);
+
+	SHV_TEST_CHECK_SUCCESS(ShvVmxPmlCollect(&bitmap));
+	SHV_TEST_CHECK(ShvTestDirtyCount(&bitmap) == SHV_TEST_DIRTY_PROCESSORS * SHV_TEST_DIRTY_PAGES);
+	SHV_TEST_CHECK(ShvTestDirtyIsSet(&bitmap, SHV_TEST_DIRTY_BASE));
+	SHV_TEST_CHECK(ShvTestDirtyIsSet(&bitmap,
+		SHV_TEST_DIRTY_BASE + SHV_TEST_DIRTY_GPA(SHV_TEST_DIRTY_PROCESSORS * SHV_TEST_DIRTY_PAGES - 1)));
+
+	ShvTestPlatFree(bitmap.Buffer);
+
+	ShvTestStopPml();
+	ShvTestStopEpt();
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+static ULONG64
+ShvTestDirtyCount(
+	_In_ PRTL_BITMAP Bitmap
+)
+{
+	ULONG64 count;
+
+	count = 0;
+
+	for (ULONG i = 0; i < Bitmap->SizeOfBitMap / 32; i++)
+	{
+		count += __popcnt64(Bitmap->Buffer[i]);
+	}
+
+	return count;
+}
+
+static BOOLEAN
+ShvTestDirtyIsSet(
+	_In_ PRTL_BITMAP Bitmap,
+	_In_ ULONG64 Gpa
+)
+{
+	ULONG64 page;
+
+	page = Gpa / PAGE_SIZE;
+
+	return (Bitmap->Buffer[page / 32] >> (page % 32)) & 1;
+}
+
+static VOID
+ShvTestDirtyClear(
+	_In_ PRTL_BITMAP Bitmap
+)
+{
+	__stosb((PUCHAR)Bitmap->Buffer, 0, Bitmap->SizeOfBitMap / 8);
+}
+
+static VOID
+ShvTestDirtyLog(
+	_In_ ULONG Processor,
+	_In_opt_ PVOID Context
+)
+{
+	ULONG64 gpas[VMX_PML_ENTRY_COUNT];
+	ULONG logged;
+
+	UNREFERENCED_PARAMETER(Context);
+
+	//
+	// Log this LP's pages until its log is full, and drain it the way the
+	// VM exit the processor then takes does.
+	//
+	for (ULONG i = 0; i < SHV_TEST_DIRTY_PAGES; i += logged)
+	{
+		for (ULONG j = 0; j < VMX_PML_ENTRY_COUNT; j++)
+		{
+			gpas[j] = SHV_TEST_DIRTY_BASE +
+				SHV_TEST_DIRTY_GPA((i + j) * SHV_TEST_DIRTY_PROCESSORS + Processor);
+		}
+
+		logged = ShvTestLogPml(gpas, min(VMX_PML_ENTRY_COUNT, SHV_TEST_DIRTY_PAGES - i));
+		ShvTestDrainPml();
+
+		//
+		// A drain that doesn't start the log over leaves no room to log.
+		//
+		if (!SHV_TEST_CHECK(logged != 0))
+		{
+			break;
+		}
+	}
+}
@@ -0,0 +1,696 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvtestept.c
+
+Abstract:
+
+	This module builds the EPT module into the test harness.  It is
+	included whole, rather than linked, so that tests can turn the features
+	that are normally fixed at build time on and off.
+
+Author:
+
+	agent (@agent) 16-Oct-2026 - Initial version
+
+Environment:
+
+	User mode only.
+
+--*/
+
+#include "../shvvmxept.c"
+#include "shvtest.h"
+
+// ===========================================================================
+//
+// LOCAL DATA
+//
+// ===========================================================================
+
+static DRIVER_OBJECT ShvTestDriverObject;
+
+// ===========================================================================
+//
+// LOCAL PROTOTYPES
+//
+// ===========================================================================
+
+static PVMX_EPT_ENTRY
+ShvTestCurrentEptRoot(
+	VOID
+);
+
+static ULONG64
+ShvTestCountTablesOffNode(
+	_In_ PVMX_EPT_ENTRY Table,
+	_In_ ULONG Level,
+	_In_ ULONG Node
+);
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+VOID
+ShvTestResetEpt(
+	VOID
+)
+{
+	ShvTestConfigureEpt(SHV_EPT_DEMAND_POPULATE, SHV_EPT_WARM_START, SHV_EPT_NUMA_REPLICATION);
+	ShvTestTrackEptWorkingSet(SHV_EPT_TRACK_WORKING_SET);
+	ShvTestRequestEptVe(SHV_EPT_VIRTUALIZATION_EXCEPTIONS);
+}
+
+VOID
+ShvTestConfigureEpt(
+	_In_ BOOLEAN DemandPopulate,
+	_In_ BOOLEAN WarmStart,
+	_In_ BOOLEAN Replicate
+)
+{
+	ShvVmxEptDemandPopulate = DemandPopulate;
+	ShvVmxEptWarmStart = WarmStart;
+	ShvVmxEptReplicate = Replicate;
+}
+
+VOID
+ShvTestTrackEptWorkingSet(
+	_In_ BOOLEAN Track
+)
+{
+	ShvVmxEptTrackWorkingSet = Track;
+}
+
+VOID
+ShvTestRequestEptVe(
+	_In_ BOOLEAN Request
+)
+{
+	ShvVmxEptVeRequested = Request;
+}
+
+NTSTATUS
+ShvTestStartEpt(
+	VOID
+)
+{
+	NTSTATUS ret;
+
+	//
+	// A driver load starts out with no violations counted, and no sweeps.
+	//
+	ShvVmxEptOnDemandFaults = 0;
+	ShvVmxEptOnDemandBytes = 0;
+	__stosb((PUCHAR)ShvVmxEptOnDemandRegions, 0, sizeof(ShvVmxEptOnDemandRegions));
+	__stosb((PUCHAR)&ShvVmxEptWorkingSet, 0, sizeof(ShvVmxEptWorkingSet));
+
+	//
+	// The same order the driver brings things up in, and a VMCS for every
+	// LP that points at its view.
+	//
+	ret = ShvMemMapInitialize(&ShvTestDriverObject);
+	if (ret != STATUS_SUCCESS)
+	{
+		return ret;
+	}
+
+	ret = ShvVmxEptInitialize();
+	if (ret != STATUS_SUCCESS)
+	{
+		ShvMemMapCleanup();
+		return ret;
+	}
+
+	for (ULONG i = 0; i < KeQueryActiveProcessorCountEx(ALL_PROCESSOR_GROUPS); i++)
+	{
+		ShvTestSetCurrentProcessor(i);
+		ShvVmxEptSetupVmcs(&ShvGlobalData->VpData[i]);
+	}
+
+	ShvTestSetCurrentProcessor(0);
+
+	return STATUS_SUCCESS;
+}
+
+VOID
+ShvTestStopEpt(
+	VOID
+)
+{
+	ShvVmxEptCleanup();
+	ShvMemMapCleanup();
+}
+
+NTSTATUS
+ShvTestReserveEpt(
+	_In_ ULONG Pages
+)
+{
+	//
+	// Tables can't be allocated in root mode, so tests that take a lot of
+	// violations make sure there are enough of them first.
+	//
+	return ShvVmxEptArenaGrow(Pages, MM_ANY_NODE_OK);
+}
+
+VOID
+ShvTestQueryEptArena(
+	_Out_ PULONG64 TablesInUse,
+	_Out_ PULONG Exhausted
+)
+{
+	PSLIST_ENTRY entry;
+	ULONG64 pages;
+
+	//
+	// Every page carved out of the arena is either a table or back on a
+	// free list.  The harness keeps its lists as a plain chain.
+	//
+	pages = 0;
+
+	for (ULONG i = 0; i < ShvVmxEptArena.ChunkCount; i++)
+	{
+		pages += min((ULONG)ShvVmxEptArena.Chunks[i].Used, ShvVmxEptArena.Chunks[i].Pages);
+	}
+
+	for (ULONG i = 0; i <= SHV_EPT_MAX_NODES; i++)
+	{
+		for (entry = (PSLIST_ENTRY)ShvVmxEptArena.FreeLists[i].Alignment; entry != NULL; entry = entry->Next)
+		{
+			pages--;
+		}
+	}
+
+	*TablesInUse = pages;
+	*Exhausted = (ULONG)ShvVmxEptArena.Exhausted;
+}
+
+ULONG
+ShvTestCountEptChunks(
+	VOID
+)
+{
+	return ShvVmxEptArena.ChunkCount;
+}
+
+ULONG
+ShvTestCheckEptArena(
+	VOID
+)
+{
+	PSHV_EPT_ARENA_CHUNK chunk;
+	PUCHAR va;
+	ULONG errors;
+
+	//
+	// Every published chunk has to be filled in and distinct, and both of
+	// its indexes have to find it from each of its pages, and only from
+	// them.
+	//
+	errors = 0;
+
+	for (ULONG i = 0; i < ShvVmxEptArena.ChunkCount; i++)
+	{
+		chunk = &ShvVmxEptArena.Chunks[i];
+
+		if ((chunk->Base == NULL) || (chunk->Pages < SHV_EPT_ARENA_CHUNK_PAGES))
+		{
+			errors++;
+			continue;
+		}
+
+		for (ULONG j = 0; j < i; j++)
+		{
+			errors += (ShvVmxEptArena.Chunks[j].Base == chunk->Base);
+		}
+
+		for (ULONG page = 0; page < chunk->Pages; page++)
+		{
+			va = chunk->Base + (SIZE_T)page * PAGE_SIZE;
+
+			errors += (ShvVmxEptGetVirtualFromPfn(chunk->BasePfn + page) != va);
+			errors += (ShvVmxEptGetPfnFromVirtual(va) != chunk->BasePfn + page);
+			errors += (ShvVmxEptGetTableNode((PVMX_EPT_ENTRY)va) != chunk->Node);
+		}
+
+		errors += (ShvVmxEptFindChunkByPfn(chunk->BasePfn - 1) == chunk);
+		errors += (ShvVmxEptFindChunkByPfn(chunk->BasePfn + chunk->Pages) == chunk);
+		errors += (ShvVmxEptFindChunkByVa(chunk->Base - 1) == chunk);
+		errors += (ShvVmxEptFindChunkByVa(chunk->Base + (SIZE_T)chunk->Pages * PAGE_SIZE) == chunk);
+	}
+
+	return errors;
+}
+
+VOID
+ShvTestSampleEptPfns(
+	_Out_writes_(Count) PULONG64 Pfns,
+	_In_ ULONG Count,
+	_Inout_ PULONG64 State
+)
+{
+	PSHV_EPT_ARENA_CHUNK chunk;
+
+	for (ULONG i = 0; i < Count; i++)
+	{
+		chunk = &ShvVmxEptArena.Chunks[ShvTestRandom(State) % ShvVmxEptArena.ChunkCount];
+		Pfns[i] = chunk->BasePfn + ShvTestRandom(State) % chunk->Pages;
+	}
+}
+
+ULONG64
+ShvTestTranslateEptPfns(
+	_In_reads_(Count) const ULONG64 *Pfns,
+	_In_ ULONG Count,
+	_In_ BOOLEAN Scan
+)
+{
+	PSHV_EPT_ARENA_CHUNK chunk;
+	ULONG64 sum;
+
+	//
+	// Either through the index, or by scanning the chunks the way it was
+	// done before there was one.  The sum keeps the work from being
+	// optimized away.
+	//
+	sum = 0;
+
+	for (ULONG i = 0; i < Count; i++)
+	{
+		if (!Scan)
+		{
+			sum += (ULONG_PTR)ShvVmxEptGetVirtualFromPfn(Pfns[i]);
+			continue;
+		}
+
+		for (ULONG j = 0; j < ShvVmxEptArena.ChunkCount; j++)
+		{
+			chunk = &ShvVmxEptArena.Chunks[j];
+
+			if (Pfns[i] - chunk->BasePfn < chunk->Pages)
+			{
+				sum += (ULONG_PTR)(chunk->Base + (Pfns[i] - chunk->BasePfn) * PAGE_SIZE);
+				break;
+			}
+		}
+	}
+
+	return sum;
+}
+
+NTSTATUS
+ShvTestWriteEptImage(
+	_Outptr_ PVOID *Image,
+	_Out_ PSIZE_T Size
+)
+{
+	PVMX_EPT_ENTRY root;
+	ULONG64 capabilities;
+	NTSTATUS ret;
+
+	//
+	// An image lists every leaf of the identity map in order, so two maps
+	// with the same image have the same leaves, sizes, types and access.
+	// The map is the one the current LP walks, which is its node's replica
+	// if it has one.
+	//
+	root = ShvTestCurrentEptRoot();
+	capabilities = ShvVmxEptCapabilities & (VMX_EPT_CAP_PDE_2MB | VMX_EPT_CAP_PDPTE_1GB);
+
+	*Image = NULL;
+
+	ret = ShvVmxEptImageWrite(root,
+		ShvVmxEptTranslatePfn,
+		NULL,
+		0,
+		capabilities,
+		ShvVmxEptEmpty,
+		NULL,
+		0,
+		Size);
+	if (ret != STATUS_BUFFER_TOO_SMALL)
+	{
+		return ret;
+	}
+
+	*Image = ShvTestPlatAllocate(*Size, 16);
+	if (*Image == NULL)
+	{
+		return STATUS_HV_NO_RESOURCES;
+	}
+
+	ret = ShvVmxEptImageWrite(root,
+		ShvVmxEptTranslatePfn,
+		NULL,
+		0,
+		capabilities,
+		ShvVmxEptEmpty,
+		*Image,
+		*Size,
+		Size);
+	if (ret != STATUS_SUCCESS)
+	{
+		ShvTestPlatFree(*Image);
+		*Image = NULL;
+	}
+
+	return ret;
+}
+
+NTSTATUS
+ShvTestReadEptImageFile(
+	_Outptr_ PVOID *Image,
+	_Out_ PSIZE_T Size
+)
+{
+	FILE_STANDARD_INFORMATION information;
+	OBJECT_ATTRIBUTES attributes;
+	IO_STATUS_BLOCK ioStatus;
+	UNICODE_STRING path;
+	HANDLE file;
+	NTSTATUS ret;
+
+	*Image = NULL;
+
+	RtlInitUnicodeString(&path, SHV_EPT_IMAGE_PATH);
+	InitializeObjectAttributes(&attributes, &path, OBJ_KERNEL_HANDLE | OBJ_CASE_INSENSITIVE, NULL, NULL);
+
+	ret = ZwCreateFile(&file, GENERIC_READ | SYNCHRONIZE, &attributes, &ioStatus, NULL, FILE_ATTRIBUTE_NORMAL,
+		FILE_SHARE_READ, FILE_OPEN, FILE_NON_DIRECTORY_FILE | FILE_SYNCHRONOUS_IO_NONALERT, NULL, 0);
+	if (ret != STATUS_SUCCESS)
+	{
+		return ret;
+	}
+
+	ret = ZwQueryInformationFile(file, &ioStatus, &information, sizeof(information), FileStandardInformation);
+	if (ret == STATUS_SUCCESS)
+	{
+		*Size = (SIZE_T)information.EndOfFile.QuadPart;
+		*Image = ShvTestPlatAllocate(max(*Size, 1), 16);
+
+		ret = (*Image != NULL) ?
+			ZwReadFile(file, NULL, NULL, NULL, &ioStatus, *Image, (ULONG)*Size, NULL, NULL) :
+			STATUS_INSUFFICIENT_RESOURCES;
+	}
+
+	ZwClose(file);
+
+	if ((ret != STATUS_SUCCESS) && (*Image != NULL))
+	{
+		ShvTestPlatFree(*Image);
+		*Image = NULL;
+	}
+
+	return ret;
+}
+
+NTSTATUS
+ShvTestWriteEptImageFile(
+	_In_reads_bytes_(Size) const VOID *Image,
+	_In_ SIZE_T Size
+)
+{
+	OBJECT_ATTRIBUTES attributes;
+	IO_STATUS_BLOCK ioStatus;
+	UNICODE_STRING path;
+	HANDLE file;
+	NTSTATUS ret;
+
+	RtlInitUnicodeString(&path, SHV_EPT_IMAGE_PATH);
+	InitializeObjectAttributes(&attributes, &path, OBJ_KERNEL_HANDLE | OBJ_CASE_INSENSITIVE, NULL, NULL);
+
+	ret = ZwCreateFile(&file, GENERIC_WRITE | SYNCHRONIZE, &attributes, &ioStatus, NULL, FILE_ATTRIBUTE_NORMAL,
+		0, FILE_OVERWRITE_IF, FILE_NON_DIRECTORY_FILE | FILE_SYNCHRONOUS_IO_NONALERT, NULL, 0);
+	if (ret != STATUS_SUCCESS)
+	{
+		return ret;
+	}
+
+	ret = ZwWriteFile(file, NULL, NULL, NULL, &ioStatus, (PVOID)Image, (ULONG)Size, NULL, NULL);
+	ZwClose(file);
+
+	return ret;
+}
+
+ULONG64
+ShvTestCountEptTablesOffNode(
+	_In_ ULONG Node
+)
+{
+	//
+	// How many tables of the map the current LP walks are not in memory of
+	// the given node.
+	//
+	return ShvTestCountTablesOffNode(ShvTestCurrentEptRoot(), VMX_EPT_PAGE_WALK_LENGTH, Node);
+}
+
+ULONG64
+ShvTestMakeEptLeaf(
+	_In_ ULONG Level,
+	_In_ ULONG64 Gpa,
+	_In_ ULONG Access
+)
+{
+	return ShvVmxEptMakeLeaf(Level, Gpa, Access, MTRR_TYPE_WB);
+}
+
+ULONG
+ShvTestClassifyEptChange(
+	_In_ ULONG64 Old,
+	_In_ ULONG64 New,
+	_In_ ULONG Level
+)
+{
+	VMX_EPT_ENTRY old, new;
+
+	//
+	// 0 for no flush, 1 for a local one and 2 for every VP.
+	//
+	old.QuadPart = Old;
+	new.QuadPart = New;
+
+	return (ULONG)ShvVmxEptClassifyChange(old, new, Level);
+}
+
+VOID
+ShvTestCommitEptChange(
+	_In_ ULONG Flush
+)
+{
+	ShvVmxEptCommitChange((SHV_EPT_FLUSH)Flush);
+}
+
+LONG64
+ShvTestGetEptGeneration(
+	VOID
+)
+{
+	return ShvVmxEptGeneration;
+}
+
+PVOID
+ShvTestRetireEptTable(
+	VOID
+)
+{
+	PVMX_EPT_ENTRY table;
+
+	//
+	// A table that was just unlinked from the map, the way promoting or
+	// merging a range leaves one behind.
+	//
+	table = ShvVmxEptAllocateTable(MM_ANY_NODE_OK);
+	if (table != NULL)
+	{
+		ShvVmxEptRetireTable(table);
+	}
+
+	return table;
+}
+
+ULONG
+ShvTestReclaimEptTables(
+	VOID
+)
+{
+	//
+	// Returns how many tables are still waiting for every VP to flush.
+	//
+	ShvVmxEptReclaimTables();
+
+	return (ULONG)ShvVmxEptArena.RetiredCount;
+}
+
+ULONG64
+ShvTestLookupEptView(
+	_In_ ULONG View,
+	_In_ ULONG64 Gpa,
+	_Out_ PULONG Level
+)
+{
+	//
+	// Returns the entry that maps the GPA in the view, or 0 if it isn't
+	// mapped, or there is no such view.
+	//
+	*Level = 0;
+
+	if (View >= ShvVmxEptViewCount)
+	{
+		return 0;
+	}
+
+	return ShvVmxEptLookup(ShvVmxEptViews[View], Gpa, Level, NULL).QuadPart;
+}
+
+ULONG64
+ShvTestGetEptViewEptp(
+	_In_ ULONG View
+)
+{
+	return (ShvVmxEptEptpList != NULL) ? ShvVmxEptEptpList[View].QuadPart : 0;
+}
+
+VOID
+ShvTestAccessEpt(
+	_In_ ULONG64 Gpa,
+	_In_ BOOLEAN Write
+)
+{
+	PVMX_EPT_ENTRY table;
+	VMX_EPT_ENTRY entry;
+	ULONG64 flags;
+	ULONG l;
+
+	//
+	// What the processor does to the default view when the guest touches a
+	// page: it sets the accessed flag of every entry it walks through, and
+	// the dirty flag of the leaf as well if the guest writes to it.
+	//
+	table = ShvVmxEptPML4;
+
+	for (l = VMX_EPT_PAGE_WALK_LENGTH; ; l--)
+	{
+		entry.QuadPart = table[SHV_EPT_INDEX(Gpa, l)].QuadPart;
+		if (entry.QuadPart == ShvVmxEptEmpty)
+		{
+			return;
+		}
+
+		if (l == 1 || SHV_EPT_ENTRY_IS_LARGE(&entry, l))
+		{
+			break;
+		}
+
+		InterlockedOr64((volatile LONG64 *)&table[SHV_EPT_INDEX(Gpa, l)].QuadPart, VMX_EPT_ACCESSED);
+		table = (PVMX_EPT_ENTRY)ShvVmxEptGetVirtualFromPfn(entry.PFN);
+	}
+
+	flags = Write ? (VMX_EPT_ACCESSED | VMX_EPT_DIRTY) : VMX_EPT_ACCESSED;
+	InterlockedOr64((volatile LONG64 *)&table[SHV_EPT_INDEX(Gpa, l)].QuadPart, flags);
+}
+
+BOOLEAN
+ShvTestScanEptWorkingSet(
+	VOID
+)
+{
+	KIRQL irql;
+
+	//
+	// Timers never fire here, so sweep the way the timer's DPC would, if
+	// it was ever set.
+	//
+	if (!ShvVmxEptWorkingSetRunning)
+	{
+		return FALSE;
+	}
+
+	KeRaiseIrql(DISPATCH_LEVEL, &irql);
+	ShvVmxEptWorkingSetDpc(&ShvVmxEptWorkingSetTimerDpc, NULL, NULL, NULL);
+	KeLowerIrql(irql);
+
+	return TRUE;
+}
+
+VOID
+ShvTestSetEptDirty(
+	_In_ ULONG64 Gpa
+)
+{
+	//
+	// What the processor does to a page the guest writes to.
+	//
+	ShvTestAccessEpt(Gpa, TRUE);
+}
+
+BOOLEAN
+ShvTestIsEptDirty(
+	_In_ ULONG64 Gpa
+)
+{
+	VMX_EPT_ENTRY entry;
+	ULONG level;
+
+	entry = ShvVmxEptLookup(ShvVmxEptPML4, Gpa, &level, NULL);
+
+	return (entry.QuadPart != ShvVmxEptEmpty) && ((entry.QuadPart & VMX_EPT_DIRTY) != 0);
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+static PVMX_EPT_ENTRY
+ShvTestCurrentEptRoot(
+	VOID
+)
+{
+	VMX_EPT_EPTP eptp;
+
+	__vmx_vmread(EPT_POINTER, (PSIZE_T)&eptp.QuadPart);
+
+	return (PVMX_EPT_ENTRY)ShvVmxEptGetVirtualFromPfn(eptp.PFN);
+}
+
+static ULONG64
+ShvTestCountTablesOffNode(
+	_In_ PVMX_EPT_ENTRY Table,
+	_In_ ULONG Level,
+	_In_ ULONG Node
+)
+{
+	PSHV_EPT_ARENA_CHUNK chunk;
+	ULONG64 count;
+
+	count = 1;
+
+	for (ULONG i = 0; i < ShvVmxEptArena.ChunkCount; i++)
+	{
+		chunk = &ShvVmxEptArena.Chunks[i];
+
+		if (((PUCHAR)Table >= chunk->Base) &&
+			((PUCHAR)Table < chunk->Base + (SIZE_T)chunk->Pages * PAGE_SIZE))
+		{
+			count = (chunk->Node != Node);
+			break;
+		}
+	}
+
+	for (ULONG i = 0; (Level > 1) && (i < PAGE_SIZE / sizeof(VMX_EPT_ENTRY)); i++)
+	{
+		if ((Table[i].QuadPart != ShvVmxEptEmpty) && !SHV_EPT_ENTRY_IS_LARGE(&Table[i], Level))
+		{
+			count += ShvTestCountTablesOffNode((PVMX_EPT_ENTRY)ShvVmxEptGetVirtualFromPfn(Table[i].PFN), Level - 1, Node);
+		}
+	}
+
+	return count;
+}
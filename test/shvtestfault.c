@@ -0,0 +1,389 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvtestfault.c
+
+Abstract:
+
+	This module stresses the EPT violation handler with MMIO faults taken
+	by many VPs at once, checks that the hierarchy they build is the one a
+	single VP would have built, and benchmarks how the lock-free
+	installation of entries scales against serializing every violation on
+	a global spin lock.
+
+Author:
+
+	agent (@agent) 16-Oct-2026 - Initial version
+
+Environment:
+
+	User mode only.
+
+--*/
+
+#include "shvtest.h"
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// Faults are taken on MMIO above the 5 GiB of address space the default
+// machine's RAM ends at, a 2 MiB region at a time, which with 4 KiB pages
+// has every fault fill in a PT of its own.
+//
+#define SHV_TEST_FAULT_BASE             (8 * SHV_TEST_GB)
+#define SHV_TEST_FAULT_REGION           VMX_EPT_PAGE_SIZE_2MB
+#define SHV_TEST_FAULT_REGIONS          (1024)
+#define SHV_TEST_FAULT_MAX_THREADS      (16)
+
+//
+// How many times the test repeats each racing run, to give the races a
+// chance to happen.
+//
+#define SHV_TEST_FAULT_ROUNDS           (8)
+
+// ===========================================================================
+//
+// LOCAL TYPES
+//
+// ===========================================================================
+
+typedef struct _SHV_TEST_FAULT_RUN {
+	ULONG Threads;
+	ULONG Regions;
+	BOOLEAN Shared;
+	BOOLEAN Locked;
+	KSPIN_LOCK Lock;
+	volatile LONG Ready;
+	ULONG64 Start[SHV_TEST_FAULT_MAX_THREADS];
+	ULONG64 End[SHV_TEST_FAULT_MAX_THREADS];
+} SHV_TEST_FAULT_RUN, *PSHV_TEST_FAULT_RUN;
+
+typedef struct _SHV_TEST_FAULT_RESULT {
+	SHV_EPT_INSPECTION Inspection;
+	ULONG64 TablesInUse;
+	ULONG Exhausted;
+	ULONG Mismatches;
+	ULONG64 Elapsed;
+} SHV_TEST_FAULT_RESULT, *PSHV_TEST_FAULT_RESULT;
+
+// ===========================================================================
+//
+// LOCAL PROTOTYPES
+//
+// ===========================================================================
+
+static BOOLEAN
+ShvTestFaultRun(
+	_In_ ULONG Threads,
+	_In_ ULONG Regions,
+	_In_ BOOLEAN Shared,
+	_In_ BOOLEAN Locked,
+	_Out_ PSHV_TEST_FAULT_RESULT Result
+);
+
+static SHV_TEST_WORKER ShvTestFaultWorker;
+
+static BOOLEAN
+ShvTestFaultSameResult(
+	_In_ const SHV_TEST_FAULT_RESULT *First,
+	_In_ const SHV_TEST_FAULT_RESULT *Second
+);
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+VOID
+ShvTestViolations(
+	VOID
+)
+{
+	SHV_TEST_FAULT_RESULT serial, racing;
+	ULONG64 tables;
+
+	//
+	// One VP taking every fault is the reference.
+	//
+	if (!SHV_TEST_CHECK(ShvTestFaultRun(1, SHV_TEST_FAULT_REGIONS / 4, FALSE, FALSE, &serial)))
+	{
+		return;
+	}
+
+	tables = 0;
+
+	for (ULONG l = 1; l <= VMX_EPT_PAGE_WALK_LENGTH; l++)
+	{
+		tables += serial.Inspection.Tables[l];
+	}
+
+	SHV_TEST_CHECK(serial.Mismatches == 0);
+	SHV_TEST_CHECK(serial.Exhausted == 0);
+	SHV_TEST_CHECK(serial.TablesInUse == tables);
+	SHV_TEST_CHECK(serial.Inspection.OnDemandBytes == SHV_TEST_FAULT_REGIONS / 4 * SHV_TEST_FAULT_REGION);
+
+	//
+	// Eight VPs faulting on regions of their own that share PDs, and then
+	// on the same regions, so that they race to install the same PTs.  The
+	// losers' tables have to go back to the arena rather than leak.
+	//
+	for (ULONG round = 0; round < SHV_TEST_FAULT_ROUNDS; round++)
+	{
+		for (ULONG shared = 0; shared <= 1; shared++)
+		{
+			if (!SHV_TEST_CHECK(ShvTestFaultRun(8, SHV_TEST_FAULT_REGIONS / 4, (BOOLEAN)shared, FALSE, &racing)))
+			{
+				return;
+			}
+
+			SHV_TEST_CHECK(racing.Mismatches == 0);
+			SHV_TEST_CHECK(racing.Exhausted == 0);
+			SHV_TEST_CHECK(ShvTestFaultSameResult(&serial, &racing));
+		}
+	}
+}
+
+VOID
+ShvTestViolationsBenchmark(
+	VOID
+)
+{
+	static const ULONG threads[] = { 1, 2, 4, 8, 16 };
+	SHV_TEST_FAULT_RESULT serial, result[2];
+
+	if (!SHV_TEST_CHECK(ShvTestFaultRun(1, SHV_TEST_FAULT_REGIONS, FALSE, FALSE, &serial)))
+	{
+		return;
+	}
+
+	//
+	// Wall time for every VP to take its faults, with entries installed by
+	// compare and swap, and with each violation serialized on one spin
+	// lock the way they used to be.  Every run has to end up with the same
+	// hierarchy as a single VP does.  The time per fault is wall time over
+	// every fault taken, with compare and swap.
+	//
+	ShvTestPrint("%u regions of 2 MiB, %u real processors\n", SHV_TEST_FAULT_REGIONS, ShvTestPlatProcessorCount());
+	ShvTestPrint("%-8s %-8s %12s %12s %12s %8s\n", "VPs", "faults", "CAS ms", "lock ms", "ns/fault", "speedup");
+
+	for (ULONG shared = 0; shared <= 1; shared++)
+	{
+		for (ULONG t = 0; t < RTL_NUMBER_OF(threads); t++)
+		{
+			for (ULONG locked = 0; locked <= 1; locked++)
+			{
+				if (!SHV_TEST_CHECK(ShvTestFaultRun(threads[t], SHV_TEST_FAULT_REGIONS, (BOOLEAN)shared, (BOOLEAN)locked, &result[locked])))
+				{
+					return;
+				}
+
+				SHV_TEST_CHECK(result[locked].Mismatches == 0);
+				SHV_TEST_CHECK(ShvTestFaultSameResult(&serial, &result[locked]));
+			}
+
+			ShvTestPrint("%-8u %-8s %12.2f %12.2f %12.1f %7.2fx\n",
+				threads[t],
+				shared ? "shared" : "own",
+				result[0].Elapsed / 1e6,
+				result[1].Elapsed / 1e6,
+				(double)result[0].Elapsed / (SHV_TEST_FAULT_REGIONS * (shared ? threads[t] : 1)),
+				(double)result[1].Elapsed / result[0].Elapsed);
+		}
+	}
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+static BOOLEAN
+ShvTestFaultRun(
+	_In_ ULONG Threads,
+	_In_ ULONG Regions,
+	_In_ BOOLEAN Shared,
+	_In_ BOOLEAN Locked,
+	_Out_ PSHV_TEST_FAULT_RESULT Result
+)
+{
+	SHV_TEST_FAULT_RUN run;
+	ULONG64 gpa, hpa, start, end;
+
+	NT_ASSERT(Threads <= SHV_TEST_FAULT_MAX_THREADS);
+
+	//
+	// Everything but the first MiB faults in, and there are enough tables
+	// for every region, plus one for each VP that loses a race.
+	//
+	ShvTestSetProcessors(Threads, 1);
+	ShvTestSetMsr(MSR_IA32_VMX_EPT_VPID_CAP, SHV_TEST_EPT_CAPS_4KB);
+	ShvTestConfigureEpt(TRUE, FALSE, FALSE);
+
+	if (ShvTestStartEpt() != STATUS_SUCCESS)
+	{
+		return FALSE;
+	}
+
+	if (ShvTestReserveEpt(Regions + 2 * Threads + 16) != STATUS_SUCCESS)
+	{
+		ShvTestStopEpt();
+		return FALSE;
+	}
+
+	run.Threads = Threads;
+	run.Regions = Regions;
+	run.Shared = Shared;
+	run.Locked = Locked;
+	run.Ready = 0;
+	KeInitializeSpinLock(&run.Lock);
+
+	ShvTestRunOnProcessors(Threads, ShvTestFaultWorker, &run);
+
+	start = MAXULONG64;
+	end = 0;
+
+	for (ULONG i = 0; i < Threads; i++)
+	{
+		start = min(start, run.Start[i]);
+		end = max(end, run.End[i]);
+	}
+
+	Result->Elapsed = end - start;
+
+	//
+	// Every page of every region has to be there, mapped to itself.
+	//
+	Result->Mismatches = 0;
+
+	for (gpa = SHV_TEST_FAULT_BASE; gpa < SHV_TEST_FAULT_BASE + (ULONG64)Regions * SHV_TEST_FAULT_REGION; gpa += PAGE_SIZE)
+	{
+		if (!ShvVmxEptTranslateGpa(gpa, FALSE, &hpa) || (hpa != gpa))
+		{
+			Result->Mismatches++;
+		}
+	}
+
+	ShvVmxEptInspect(&Result->Inspection);
+	ShvTestQueryEptArena(&Result->TablesInUse, &Result->Exhausted);
+
+	ShvTestStopEpt();
+	ShvTestSetProcessors(1, 1);
+
+	return TRUE;
+}
+
+static VOID
+ShvTestFaultWorker(
+	_In_ ULONG Processor,
+	_In_opt_ PVOID Context
+)
+{
+	PSHV_TEST_FAULT_RUN run;
+	SHV_VP_STATE vpState;
+	ULONG64 random, gpa;
+	ULONG region;
+	KIRQL irql;
+
+	run = (PSHV_TEST_FAULT_RUN)Context;
+	random = 0x9e3779b97f4a7c15ULL * (Processor + 1);
+
+	__stosb((PUCHAR)&vpState, 0, sizeof(vpState));
+
+	//
+	// Violations are handled with interrupts off, in root mode.
+	//
+	KeRaiseIrql(HIGH_LEVEL, &irql);
+
+	//
+	// Line the VPs up so that they all start faulting at once.
+	//
+	InterlockedIncrement(&run->Ready);
+
+	while ((ULONG)run->Ready != run->Threads)
+	{
+		YieldProcessor();
+	}
+
+	run->Start[Processor] = ShvTestNow();
+
+	//
+	// VPs either take every run->Threads-th region, so that neighbouring
+	// regions, which share a PD, fault on different VPs, or all take every
+	// region, each starting at a different one.
+	//
+	for (ULONG i = 0; i < run->Regions; i++)
+	{
+		if (run->Shared)
+		{
+			region = (i + Processor * run->Regions / run->Threads) % run->Regions;
+		}
+		else if ((i % run->Threads) == Processor)
+		{
+			region = i;
+		}
+		else
+		{
+			continue;
+		}
+
+		gpa = SHV_TEST_FAULT_BASE +
+			(ULONG64)region * SHV_TEST_FAULT_REGION +
+			(ShvTestRandom(&random) % (SHV_TEST_FAULT_REGION / PAGE_SIZE)) * PAGE_SIZE;
+
+		__vmx_vmwrite(GUEST_PHYSICAL_ADDRESS, gpa);
+		__vmx_vmwrite(EXIT_QUALIFICATION, VMX_EPT_ACCESS_READ);
+
+		if (run->Locked)
+		{
+			KeAcquireSpinLockAtDpcLevel(&run->Lock);
+			ShvVmxEptHandleViolation(&vpState);
+			KeReleaseSpinLockFromDpcLevel(&run->Lock);
+		}
+		else
+		{
+			ShvVmxEptHandleViolation(&vpState);
+		}
+	}
+
+	run->End[Processor] = ShvTestNow();
+
+	KeLowerIrql(irql);
+}
+
+static BOOLEAN
+ShvTestFaultSameResult(
+	_In_ const SHV_TEST_FAULT_RESULT *First,
+	_In_ const SHV_TEST_FAULT_RESULT *Second
+)
+{
+	ULONG64 tables;
+
+	//
+	// The same tables and leaves, and no table that isn't in the hierarchy
+	// kept out of the arena.
+	//
+	tables = 0;
+
+	for (ULONG l = 0; l <= VMX_EPT_PAGE_WALK_LENGTH; l++)
+	{
+		if ((First->Inspection.Tables[l] != Second->Inspection.Tables[l]) ||
+			((l < VMX_EPT_PAGE_WALK_LENGTH) && (First->Inspection.Leaves[l] != Second->Inspection.Leaves[l])))
+		{
+			return FALSE;
+		}
+
+		tables += Second->Inspection.Tables[l];
+	}
+
+	return (First->Inspection.MappedBytes == Second->Inspection.MappedBytes) &&
+		(Second->TablesInUse == tables);
+}
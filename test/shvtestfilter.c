@@ -0,0 +1,589 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvtestfilter.c
+
+Abstract:
+
+	This module tests how watchpoints sort the accesses that fault on
+	watched pages into hits and the rest, and benchmarks the time from the
+	fault to the resume for accesses to the unwatched bytes of a watched
+	page.
+
+Author:
+
+	agent (@agent) 16-Oct-2026 - Initial version
+
+Environment:
+
+	User mode only.
+
+--*/
+
+#include "shvtest.h"
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// The guest memory: a page of code, followed by the pages it accesses,
+// all of it RAM on the default machine.
+//
+#define SHV_TEST_FILTER_BASE            (256ULL * 1024 * 1024)
+#define SHV_TEST_FILTER_PAGES           (8)
+#define SHV_TEST_FILTER_DATA(n)         (SHV_TEST_FILTER_BASE + ((n) + 1) * PAGE_SIZE)
+
+//
+// The L bit of the access rights of a 64-bit code segment, and the bits
+// of the exit qualification that say the linear address is that of the
+// access itself.
+//
+#define SHV_TEST_FILTER_CS_LONG_MODE    (1 << 13)
+#define SHV_TEST_FILTER_LINEAR          ((1 << 7) | (1 << 8))
+
+//
+// How many faults the benchmark takes for each row, in batches small
+// enough that the hits of a batch fit in the ring.
+//
+#define SHV_TEST_FILTER_FAULTS          (128 * 1024)
+#define SHV_TEST_FILTER_BATCH           (128)
+
+// ===========================================================================
+//
+// LOCAL TYPES
+//
+// ===========================================================================
+
+//
+// An instruction whose memory operand is [rdi] and whose other operand,
+// if any, is RCX.
+//
+typedef struct _SHV_TEST_FILTER_INSTRUCTION {
+	UCHAR Code[4];
+	UCHAR Length;
+	UCHAR Size;
+	ULONG Access;
+} SHV_TEST_FILTER_INSTRUCTION, *PSHV_TEST_FILTER_INSTRUCTION;
+
+//
+// The state of the one VP of the simulated guest.
+//
+typedef struct _SHV_TEST_FILTER_GUEST {
+	SHV_VP_STATE VpState;
+	CONTEXT Context;
+	PUCHAR Memory;
+	ULONG64 Eptp;
+} SHV_TEST_FILTER_GUEST, *PSHV_TEST_FILTER_GUEST;
+
+typedef struct _SHV_TEST_FILTER_MODE {
+	PCSTR Name;
+	const SHV_TEST_FILTER_INSTRUCTION *Instruction;
+	ULONG Watch;
+	BOOLEAN Emulate;
+	BOOLEAN Hit;
+} SHV_TEST_FILTER_MODE, *PSHV_TEST_FILTER_MODE;
+
+// ===========================================================================
+//
+// LOCAL DATA
+//
+// ===========================================================================
+
+static const SHV_TEST_FILTER_INSTRUCTION ShvTestFilterStore8 = { { 0x48, 0x89, 0x0f }, 3, 8, SHV_WATCH_WRITE };
+static const SHV_TEST_FILTER_INSTRUCTION ShvTestFilterStore4 = { { 0x89, 0x0f }, 2, 4, SHV_WATCH_WRITE };
+static const SHV_TEST_FILTER_INSTRUCTION ShvTestFilterStore1 = { { 0x88, 0x0f }, 2, 1, SHV_WATCH_WRITE };
+static const SHV_TEST_FILTER_INSTRUCTION ShvTestFilterLoad8 = { { 0x48, 0x8b, 0x0f }, 3, 8, SHV_WATCH_READ };
+
+static const ULONG ShvTestFilterWatchCounts[] = { 1, 8, 64, 256 };
+
+//
+// Reads are never emulated, so they always take the exit for the step
+// too.  Writes only do when the emulator is off.
+//
+static const SHV_TEST_FILTER_MODE ShvTestFilterModes[] = {
+	{ "read", &ShvTestFilterLoad8, SHV_WATCH_READ, TRUE, FALSE },
+	{ "write", &ShvTestFilterStore8, SHV_WATCH_WRITE, TRUE, FALSE },
+	{ "write", &ShvTestFilterStore8, SHV_WATCH_WRITE, FALSE, FALSE },
+	{ "write hit", &ShvTestFilterStore8, SHV_WATCH_WRITE, TRUE, TRUE },
+};
+
+// ===========================================================================
+//
+// LOCAL PROTOTYPES
+//
+// ===========================================================================
+
+static BOOLEAN
+ShvTestFilterStart(
+	_Out_ PSHV_TEST_FILTER_GUEST Guest,
+	_In_ BOOLEAN Emulate
+);
+
+static VOID
+ShvTestFilterStop(
+	_Inout_ PSHV_TEST_FILTER_GUEST Guest
+);
+
+static BOOLEAN
+ShvTestFilterAccess(
+	_Inout_ PSHV_TEST_FILTER_GUEST Guest,
+	_In_ const SHV_TEST_FILTER_INSTRUCTION *Instruction,
+	_In_ ULONG64 Gpa
+);
+
+static ULONG
+ShvTestFilterReadHits(
+	_Out_writes_(Count) PSHV_WATCH_HIT Hits,
+	_In_ ULONG Count
+);
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+VOID
+ShvTestWatchFilter(
+	VOID
+)
+{
+	SHV_TEST_FILTER_GUEST guest;
+	SHV_WATCH_STATISTICS statistics;
+	SHV_WATCH_HIT hits[SHV_WATCH_RING_SIZE];
+	ULONG id, readId, wideId, count;
+	ULONG64 hpa;
+
+	if (!ShvTestFilterStart(&guest, TRUE))
+	{
+		return;
+	}
+
+	//
+	// Watches have to cover something, of a kind that can be watched, and
+	// only RAM that nobody else changed can be watched.
+	//
+	SHV_TEST_CHECK(ShvVmxWatchAddPhysical(SHV_TEST_FILTER_DATA(0), 0, SHV_WATCH_WRITE, &id) == STATUS_INVALID_PARAMETER);
+	SHV_TEST_CHECK(ShvVmxWatchAddPhysical(SHV_TEST_FILTER_DATA(0), 4, 0, &id) == STATUS_INVALID_PARAMETER);
+	SHV_TEST_CHECK(ShvVmxWatchAddPhysical(SHV_TEST_FILTER_DATA(0), 4, VMX_EPT_ACCESS_EXECUTE, &id) == STATUS_INVALID_PARAMETER);
+	SHV_TEST_CHECK(ShvVmxWatchAddPhysical(0xfee00000, 4, SHV_WATCH_WRITE, &id) == STATUS_CONFLICTING_ADDRESSES);
+
+	ShvVmxWatchQuery(&statistics);
+	SHV_TEST_CHECK(statistics.Watches == 0 && statistics.Pages == 0);
+
+	//
+	// A write watch only takes writes away from its page.
+	//
+	if (!SHV_TEST_CHECK_SUCCESS(ShvVmxWatchAddPhysical(SHV_TEST_FILTER_DATA(0) + 0x100, 4, SHV_WATCH_WRITE, &id)))
+	{
+		ShvTestFilterStop(&guest);
+		return;
+	}
+
+	SHV_TEST_CHECK(ShvVmxEptGetAccess(SHV_TEST_FILTER_DATA(0), &hpa) == (VMX_EPT_ACCESS_READ | VMX_EPT_ACCESS_EXECUTE));
+	SHV_TEST_CHECK(ShvVmxEptGetAccess(SHV_TEST_FILTER_DATA(1), &hpa) == VMX_EPT_ACCESS_RWX);
+
+	ShvVmxWatchQuery(&statistics);
+	SHV_TEST_CHECK(statistics.Watches == 1 && statistics.Pages == 1);
+
+	//
+	// Writes to the rest of the page are carried out in the exit that
+	// caught them, and hit nothing, down to the byte on either side.
+	//
+	guest.Context.Rcx = 0x1122334455667788;
+
+	SHV_TEST_CHECK(!ShvTestFilterAccess(&guest, &ShvTestFilterStore8, SHV_TEST_FILTER_DATA(0) + 0x200));
+	SHV_TEST_CHECK(*(PULONG64)(guest.Memory + PAGE_SIZE + 0x200) == 0x1122334455667788);
+	SHV_TEST_CHECK(guest.VpState.GuestRip == SHV_TEST_FILTER_BASE + ShvTestFilterStore8.Length);
+
+	SHV_TEST_CHECK(!ShvTestFilterAccess(&guest, &ShvTestFilterStore8, SHV_TEST_FILTER_DATA(0) + 0xf8));
+	SHV_TEST_CHECK(!ShvTestFilterAccess(&guest, &ShvTestFilterStore1, SHV_TEST_FILTER_DATA(0) + 0x104));
+
+	ShvVmxWatchQuery(&statistics);
+	SHV_TEST_CHECK(statistics.Faults == 3 && statistics.Emulated == 3 && statistics.Hits == 0);
+	SHV_TEST_CHECK(ShvTestFilterReadHits(hits, RTL_NUMBER_OF(hits)) == 0);
+
+	//
+	// Writes that cover any of its bytes hit the watch, and still go
+	// through.
+	//
+	SHV_TEST_CHECK(!ShvTestFilterAccess(&guest, &ShvTestFilterStore8, SHV_TEST_FILTER_DATA(0) + 0xf9));
+	SHV_TEST_CHECK(!ShvTestFilterAccess(&guest, &ShvTestFilterStore1, SHV_TEST_FILTER_DATA(0) + 0x103));
+	SHV_TEST_CHECK(!ShvTestFilterAccess(&guest, &ShvTestFilterStore4, SHV_TEST_FILTER_DATA(0) + 0x100));
+	SHV_TEST_CHECK(*(PULONG)(guest.Memory + PAGE_SIZE + 0x100) == 0x55667788);
+
+	if (SHV_TEST_CHECK(ShvTestFilterReadHits(hits, RTL_NUMBER_OF(hits)) == 3))
+	{
+		SHV_TEST_CHECK(hits[0].Id == id && hits[0].Gpa == SHV_TEST_FILTER_DATA(0) + 0xf9);
+		SHV_TEST_CHECK(hits[0].Access == SHV_WATCH_WRITE && hits[0].Rip == SHV_TEST_FILTER_BASE && hits[0].Vp == 0);
+		SHV_TEST_CHECK(hits[1].Id == id && hits[1].Gpa == SHV_TEST_FILTER_DATA(0) + 0x103);
+		SHV_TEST_CHECK(hits[2].Id == id && hits[2].Gpa == SHV_TEST_FILTER_DATA(0) + 0x100);
+	}
+
+	//
+	// A read watch takes reads away too.  Reads are stepped, whether they
+	// hit or not, and writes to the page are still emulated and hit
+	// nothing.
+	//
+	if (SHV_TEST_CHECK_SUCCESS(ShvVmxWatchAddPhysical(SHV_TEST_FILTER_DATA(1) + 0x10, 1, SHV_WATCH_READ, &readId)))
+	{
+		SHV_TEST_CHECK(ShvVmxEptGetAccess(SHV_TEST_FILTER_DATA(1), &hpa) == VMX_EPT_ACCESS_EXECUTE);
+
+		*(PULONG64)(guest.Memory + 2 * PAGE_SIZE + 0x800) = 42;
+
+		SHV_TEST_CHECK(ShvTestFilterAccess(&guest, &ShvTestFilterLoad8, SHV_TEST_FILTER_DATA(1) + 0x800));
+		SHV_TEST_CHECK(guest.Context.Rcx == 42);
+		SHV_TEST_CHECK(ShvTestFilterReadHits(hits, RTL_NUMBER_OF(hits)) == 0);
+
+		//
+		// How wide a read was isn't known, so one that starts within a
+		// quadword of the watch hits it.
+		//
+		SHV_TEST_CHECK(ShvTestFilterAccess(&guest, &ShvTestFilterLoad8, SHV_TEST_FILTER_DATA(1) + 0x8));
+		SHV_TEST_CHECK(ShvTestFilterReadHits(hits, RTL_NUMBER_OF(hits)) == 0);
+
+		SHV_TEST_CHECK(ShvTestFilterAccess(&guest, &ShvTestFilterLoad8, SHV_TEST_FILTER_DATA(1) + 0x9));
+		SHV_TEST_CHECK(ShvTestFilterReadHits(hits, RTL_NUMBER_OF(hits)) == 1);
+
+		SHV_TEST_CHECK(ShvTestFilterAccess(&guest, &ShvTestFilterLoad8, SHV_TEST_FILTER_DATA(1) + 0x10));
+
+		SHV_TEST_CHECK(!ShvTestFilterAccess(&guest, &ShvTestFilterStore8, SHV_TEST_FILTER_DATA(1) + 0x10));
+		SHV_TEST_CHECK(*(PULONG64)(guest.Memory + 2 * PAGE_SIZE + 0x10) == guest.Context.Rcx);
+
+		if (SHV_TEST_CHECK(ShvTestFilterReadHits(hits, RTL_NUMBER_OF(hits)) == 1))
+		{
+			SHV_TEST_CHECK(hits[0].Id == readId && hits[0].Access == SHV_WATCH_READ);
+		}
+	}
+
+	//
+	// A watch over several pages protects each of them, and accesses that
+	// overlap two watches hit both.
+	//
+	if (SHV_TEST_CHECK_SUCCESS(ShvVmxWatchAddPhysical(SHV_TEST_FILTER_DATA(0) + 0xff0,
+		2 * PAGE_SIZE + 0x20,
+		SHV_WATCH_WRITE,
+		&wideId)))
+	{
+		ShvVmxWatchQuery(&statistics);
+		SHV_TEST_CHECK(statistics.Watches == 3 && statistics.Pages == 4);
+		SHV_TEST_CHECK(ShvVmxEptGetAccess(SHV_TEST_FILTER_DATA(2), &hpa) == (VMX_EPT_ACCESS_READ | VMX_EPT_ACCESS_EXECUTE));
+
+		SHV_TEST_CHECK(!ShvTestFilterAccess(&guest, &ShvTestFilterStore1, SHV_TEST_FILTER_DATA(1) + 0x10));
+
+		count = ShvTestFilterReadHits(hits, RTL_NUMBER_OF(hits));
+
+		if (SHV_TEST_CHECK(count == 1))
+		{
+			SHV_TEST_CHECK(hits[0].Id == wideId);
+		}
+
+		SHV_TEST_CHECK_SUCCESS(ShvVmxWatchRemove(wideId));
+		SHV_TEST_CHECK(ShvVmxEptGetAccess(SHV_TEST_FILTER_DATA(2), &hpa) == VMX_EPT_ACCESS_RWX);
+		SHV_TEST_CHECK(ShvVmxEptGetAccess(SHV_TEST_FILTER_DATA(1), &hpa) == VMX_EPT_ACCESS_EXECUTE);
+	}
+
+	//
+	// Hits that don't fit in the ring are counted, not kept.
+	//
+	for (ULONG i = 0; i < SHV_WATCH_RING_SIZE + 10; i++)
+	{
+		ShvTestFilterAccess(&guest, &ShvTestFilterStore4, SHV_TEST_FILTER_DATA(0) + 0x100);
+	}
+
+	ShvVmxWatchQuery(&statistics);
+	SHV_TEST_CHECK(statistics.Dropped == 10);
+	SHV_TEST_CHECK(ShvTestFilterReadHits(hits, RTL_NUMBER_OF(hits)) == SHV_WATCH_RING_SIZE);
+
+	//
+	// Faults on pages that aren't watched are left to the EPT module.
+	//
+	SHV_TEST_CHECK(!ShvTestFilterWatch(&guest.VpState, SHV_TEST_FILTER_DATA(3), SHV_WATCH_WRITE));
+
+	//
+	// Removing the watches gives the pages back everything.
+	//
+	SHV_TEST_CHECK_SUCCESS(ShvVmxWatchRemove(id));
+	SHV_TEST_CHECK_SUCCESS(ShvVmxWatchRemove(readId));
+	SHV_TEST_CHECK(ShvVmxWatchRemove(id) == STATUS_NOT_FOUND);
+
+	SHV_TEST_CHECK(ShvVmxEptGetAccess(SHV_TEST_FILTER_DATA(0), &hpa) == VMX_EPT_ACCESS_RWX);
+	SHV_TEST_CHECK(ShvVmxEptGetAccess(SHV_TEST_FILTER_DATA(1), &hpa) == VMX_EPT_ACCESS_RWX);
+
+	ShvVmxWatchQuery(&statistics);
+	SHV_TEST_CHECK(statistics.Watches == 0 && statistics.Pages == 0);
+
+	ShvTestFilterStop(&guest);
+
+	//
+	// Without the emulator, writes are stepped in the view that withholds
+	// nothing instead.
+	//
+	if (!ShvTestFilterStart(&guest, FALSE))
+	{
+		return;
+	}
+
+	if (SHV_TEST_CHECK_SUCCESS(ShvVmxWatchAddPhysical(SHV_TEST_FILTER_DATA(0) + 0x100, 4, SHV_WATCH_WRITE, &id)))
+	{
+		guest.Context.Rcx = 7;
+
+		SHV_TEST_CHECK(ShvTestFilterAccess(&guest, &ShvTestFilterStore8, SHV_TEST_FILTER_DATA(0) + 0x200));
+		SHV_TEST_CHECK(*(PULONG64)(guest.Memory + PAGE_SIZE + 0x200) == 7);
+		SHV_TEST_CHECK(ShvTestFilterReadHits(hits, RTL_NUMBER_OF(hits)) == 0);
+
+		SHV_TEST_CHECK(ShvTestFilterAccess(&guest, &ShvTestFilterStore1, SHV_TEST_FILTER_DATA(0) + 0x101));
+		SHV_TEST_CHECK(ShvTestFilterReadHits(hits, RTL_NUMBER_OF(hits)) == 1);
+
+		ShvVmxWatchQuery(&statistics);
+		SHV_TEST_CHECK(statistics.Faults == 2 && statistics.Emulated == 0);
+
+		SHV_TEST_CHECK_SUCCESS(ShvVmxWatchRemove(id));
+	}
+
+	ShvTestFilterStop(&guest);
+}
+
+VOID
+ShvTestWatchFilterBenchmark(
+	VOID
+)
+{
+	SHV_TEST_FILTER_GUEST guest;
+	SHV_WATCH_STATISTICS statistics;
+	SHV_WATCH_HIT hits[SHV_TEST_FILTER_BATCH];
+	ULONG64 start, elapsed, state, stride;
+	ULONG id;
+
+	//
+	// Every fault is on a page that has watches spread evenly over it,
+	// and false sharing ones are to the bytes between them.  Only the time
+	// spent in root mode is measured; an exit and an entry cost about a
+	// microsecond more each on top, which is what emulating a write saves
+	// the step.
+	//
+	ShvTestPrint("%-10s %8s %8s %6s %10s %12s\n", "access", "emulated", "watches", "exits", "ns/fault", "filter cyc");
+
+	for (ULONG m = 0; m < RTL_NUMBER_OF(ShvTestFilterModes); m++)
+	{
+		for (ULONG w = 0; w < RTL_NUMBER_OF(ShvTestFilterWatchCounts); w++)
+		{
+			if (!ShvTestFilterStart(&guest, ShvTestFilterModes[m].Emulate))
+			{
+				return;
+			}
+
+			stride = PAGE_SIZE / ShvTestFilterWatchCounts[w];
+
+			for (ULONG i = 0; i < ShvTestFilterWatchCounts[w]; i++)
+			{
+				if (!SHV_TEST_CHECK_SUCCESS(ShvVmxWatchAddPhysical(SHV_TEST_FILTER_DATA(0) + i * stride,
+					4,
+					ShvTestFilterModes[m].Watch,
+					&id)))
+				{
+					ShvTestFilterStop(&guest);
+					return;
+				}
+			}
+
+			state = 0x9e3779b97f4a7c15ULL;
+			elapsed = 0;
+
+			for (ULONG b = 0; b < SHV_TEST_FILTER_FAULTS / SHV_TEST_FILTER_BATCH; b++)
+			{
+				start = ShvTestNow();
+
+				for (ULONG i = 0; i < SHV_TEST_FILTER_BATCH; i++)
+				{
+					ShvTestFilterAccess(&guest,
+						ShvTestFilterModes[m].Instruction,
+						SHV_TEST_FILTER_DATA(0) +
+							(ShvTestRandom(&state) % ShvTestFilterWatchCounts[w]) * stride +
+							(ShvTestFilterModes[m].Hit ? 0 : 8));
+				}
+
+				elapsed += ShvTestNow() - start;
+
+				ShvTestFilterReadHits(hits, RTL_NUMBER_OF(hits));
+			}
+
+			ShvVmxWatchQuery(&statistics);
+
+			SHV_TEST_CHECK(statistics.Faults == SHV_TEST_FILTER_FAULTS);
+			SHV_TEST_CHECK(statistics.Hits == (ShvTestFilterModes[m].Hit ? SHV_TEST_FILTER_FAULTS : 0));
+			SHV_TEST_CHECK(statistics.Dropped == 0);
+
+			ShvTestPrint("%-10s %8s %8u %6u %10.1f %12.1f\n",
+				ShvTestFilterModes[m].Name,
+				(statistics.Emulated != 0) ? "yes" : "no",
+				ShvTestFilterWatchCounts[w],
+				(statistics.Emulated != 0) ? 1 : 2,
+				(double)elapsed / SHV_TEST_FILTER_FAULTS,
+				(double)statistics.FilterCycles / SHV_TEST_FILTER_FAULTS);
+
+			ShvTestFilterStop(&guest);
+		}
+	}
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+static BOOLEAN
+ShvTestFilterStart(
+	_Out_ PSHV_TEST_FILTER_GUEST Guest,
+	_In_ BOOLEAN Emulate
+)
+{
+	__stosb((PUCHAR)Guest, 0, sizeof(*Guest));
+
+	//
+	// Watchpoints step accesses with the monitor trap flag in a view of
+	// their own, which takes EPTP switching.
+	//
+	ShvTestSetMsr(MSR_IA32_VMX_PROCBASED_CTLS, (1ULL << (32 + 31)) | (1ULL << (32 + 27)));
+	ShvTestSetMsr(MSR_IA32_VMX_PROCBASED_CTLS2, (1ULL << (32 + 1)) | (1ULL << (32 + 13)));
+	ShvTestSetMsr(MSR_IA32_VMX_VMFUNC, VMX_VMFUNC_EPTP_SWITCHING);
+
+	if (!SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+	{
+		return FALSE;
+	}
+
+	if (!SHV_TEST_CHECK_SUCCESS(ShvTestStartWatch(Emulate)))
+	{
+		ShvTestStopEpt();
+		return FALSE;
+	}
+
+	Guest->Memory = (PUCHAR)ShvTestPlatAllocatePages(SHV_TEST_FILTER_PAGES * PAGE_SIZE, MM_ANY_NODE_OK);
+	if (!SHV_TEST_CHECK(Guest->Memory != NULL))
+	{
+		ShvTestStopWatch();
+		ShvTestStopEpt();
+		return FALSE;
+	}
+
+	__stosb(Guest->Memory, 0, SHV_TEST_FILTER_PAGES * PAGE_SIZE);
+	ShvTestSetGuestMemory(SHV_TEST_FILTER_BASE, Guest->Memory, SHV_TEST_FILTER_PAGES * PAGE_SIZE);
+
+	//
+	// A 64-bit guest, with no event being delivered and no breakpoints,
+	// running in the default view.
+	//
+	Guest->VpState.VpRegs = &Guest->Context;
+
+	__vmx_vmwrite(GUEST_CS_AR_BYTES, SHV_TEST_FILTER_CS_LONG_MODE);
+	__vmx_vmwrite(IDT_VECTORING_INFO, 0);
+	__vmx_vmwrite(GUEST_DR7, 0);
+	__vmx_vmread(EPT_POINTER, (PSIZE_T)&Guest->Eptp);
+
+	return TRUE;
+}
+
+static VOID
+ShvTestFilterStop(
+	_Inout_ PSHV_TEST_FILTER_GUEST Guest
+)
+{
+	ShvTestStopWatch();
+	ShvTestStopEpt();
+
+	ShvTestSetGuestMemory(0, NULL, 0);
+	ShvTestPlatFreePages(Guest->Memory, SHV_TEST_FILTER_PAGES * PAGE_SIZE);
+}
+
+static BOOLEAN
+ShvTestFilterAccess(
+	_Inout_ PSHV_TEST_FILTER_GUEST Guest,
+	_In_ const SHV_TEST_FILTER_INSTRUCTION *Instruction,
+	_In_ ULONG64 Gpa
+)
+{
+	SIZE_T control, eptp;
+	KIRQL irql;
+	PUCHAR data;
+
+	//
+	// The instruction is at the start of the code page, and the processor
+	// already translated its operand when the EPT stopped it.
+	//
+	__movsb(Guest->Memory, Instruction->Code, Instruction->Length);
+
+	Guest->VpState.GuestRip = SHV_TEST_FILTER_BASE;
+	Guest->Context.Rdi = Gpa;
+
+	__vmx_vmwrite(GUEST_PHYSICAL_ADDRESS, Gpa);
+	__vmx_vmwrite(GUEST_LINEAR_ADDRESS, Gpa);
+	__vmx_vmwrite(EXIT_QUALIFICATION, Instruction->Access | SHV_TEST_FILTER_LINEAR);
+
+	KeRaiseIrql(HIGH_LEVEL, &irql);
+	ShvVmxEptHandleViolation(&Guest->VpState);
+	KeLowerIrql(irql);
+
+	__vmx_vmread(CPU_BASED_VM_EXEC_CONTROL, &control);
+
+	if ((control & CPU_BASED_MONITOR_TRAP_FLAG) == 0)
+	{
+		return FALSE;
+	}
+
+	//
+	// Otherwise the guest runs the instruction once more, in a view that
+	// allows it, and exits right after.
+	//
+	__vmx_vmread(EPT_POINTER, &eptp);
+	SHV_TEST_CHECK(eptp != Guest->Eptp);
+
+	data = Guest->Memory + (Gpa - SHV_TEST_FILTER_BASE);
+
+	if (Instruction->Access == SHV_WATCH_WRITE)
+	{
+		__movsb(data, (PUCHAR)&Guest->Context.Rcx, Instruction->Size);
+	}
+	else
+	{
+		Guest->Context.Rcx = 0;
+		__movsb((PUCHAR)&Guest->Context.Rcx, data, Instruction->Size);
+	}
+
+	Guest->VpState.GuestRip += Instruction->Length;
+
+	KeRaiseIrql(HIGH_LEVEL, &irql);
+	ShvVmxWatchHandleStep(&Guest->VpState);
+	KeLowerIrql(irql);
+
+	__vmx_vmread(CPU_BASED_VM_EXEC_CONTROL, &control);
+	__vmx_vmread(EPT_POINTER, &eptp);
+
+	SHV_TEST_CHECK((control & CPU_BASED_MONITOR_TRAP_FLAG) == 0);
+	SHV_TEST_CHECK(eptp == Guest->Eptp);
+
+	return TRUE;
+}
+
+static ULONG
+ShvTestFilterReadHits(
+	_Out_writes_(Count) PSHV_WATCH_HIT Hits,
+	_In_ ULONG Count
+)
+{
+	ULONG returned;
+
+	if (!SHV_TEST_CHECK_SUCCESS(ShvVmxWatchReadHits(0, Hits, Count, &returned)))
+	{
+		return 0;
+	}
+
+	return returned;
+}
@@ -0,0 +1,274 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvtestflush.c
+
+Abstract:
+
+	This module tests how EPT changes are flushed: that each change is
+	classified as needing no flush, a local one or one on every VP, that
+	every VP catches up with the shared generation exactly once, and that
+	retired tables are only reused once every VP has flushed past them.
+
+Author:
+
+	agent (@agent) 16-Oct-2026 - Initial version
+
+Environment:
+
+	User mode only.
+
+--*/
+
+#include "shvtest.h"
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// How many LPs share the EPT, and how many changes each of them makes at
+// once.
+//
+#define SHV_TEST_FLUSH_PROCESSORS       (4)
+#define SHV_TEST_FLUSH_CHANGES          (100000)
+
+//
+// What ShvTestClassifyEptChange returns.
+//
+#define SHV_TEST_FLUSH_NONE             (0)
+#define SHV_TEST_FLUSH_LOCAL            (1)
+#define SHV_TEST_FLUSH_GLOBAL           (2)
+
+// ===========================================================================
+//
+// LOCAL PROTOTYPES
+//
+// ===========================================================================
+
+static VOID
+ShvTestFlushSynchronize(
+	_In_ ULONG Processor
+);
+
+static VOID
+ShvTestFlushCommit(
+	_In_ ULONG Processor,
+	_In_opt_ PVOID Context
+);
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+VOID
+ShvTestFlush(
+	VOID
+)
+{
+	ULONG64 leaf, invepts[SHV_TEST_FLUSH_PROCESSORS];
+	LONG64 generation;
+	BOOLEAN flushed;
+
+	ShvTestSetProcessors(SHV_TEST_FLUSH_PROCESSORS, 1);
+
+	if (!SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+	{
+		return;
+	}
+
+	for (ULONG i = 0; i < SHV_TEST_FLUSH_PROCESSORS; i++)
+	{
+		ShvGlobalData->VpData[i].VmxEnabled = 1;
+		ShvTestFlushSynchronize(i);
+	}
+
+	//
+	// Processors never cache a not-present entry, and one that caches a
+	// less permissive copy only takes a spurious violation.  Anything that
+	// takes permissions away, or maps something else, is seen by every VP.
+	//
+	leaf = ShvTestMakeEptLeaf(1, 0x200000, VMX_EPT_ACCESS_READ);
+
+	SHV_TEST_CHECK(ShvTestClassifyEptChange(0, leaf, 1) == SHV_TEST_FLUSH_NONE);
+	SHV_TEST_CHECK(ShvTestClassifyEptChange(1ULL << 63, leaf, 1) == SHV_TEST_FLUSH_NONE);
+	SHV_TEST_CHECK(ShvTestClassifyEptChange(leaf, leaf | VMX_EPT_ACCESS_WRITE, 1) == SHV_TEST_FLUSH_LOCAL);
+	SHV_TEST_CHECK(ShvTestClassifyEptChange(leaf, leaf | VMX_EPT_ACCESS_EXECUTE, 1) == SHV_TEST_FLUSH_LOCAL);
+	SHV_TEST_CHECK(ShvTestClassifyEptChange(leaf | VMX_EPT_ACCESS_WRITE, leaf, 1) == SHV_TEST_FLUSH_GLOBAL);
+	SHV_TEST_CHECK(ShvTestClassifyEptChange(leaf,
+		ShvTestMakeEptLeaf(1, 0x201000, VMX_EPT_ACCESS_READ), 1) == SHV_TEST_FLUSH_GLOBAL);
+
+	//
+	// Neither does turning a large page into a table that maps it the same
+	// way, even with more permissions.
+	//
+	SHV_TEST_CHECK(ShvTestClassifyEptChange(ShvTestMakeEptLeaf(2, 0x200000, VMX_EPT_ACCESS_READ),
+		ShvTestMakeEptLeaf(1, 0x200000, VMX_EPT_ACCESS_RWX), 2) == SHV_TEST_FLUSH_GLOBAL);
+
+	//
+	// A local flush is the only one that flushes right away, and only on
+	// the LP that made the change.  A global one just moves the generation
+	// on for every VP to catch up with.
+	//
+	generation = ShvTestGetEptGeneration();
+	invepts[0] = ShvTestCountInvept(0);
+	invepts[1] = ShvTestCountInvept(1);
+
+	ShvTestCommitEptChange(SHV_TEST_FLUSH_NONE);
+	SHV_TEST_CHECK(ShvTestGetEptGeneration() == generation);
+	SHV_TEST_CHECK(ShvTestCountInvept(0) == invepts[0]);
+
+	ShvTestCommitEptChange(SHV_TEST_FLUSH_LOCAL);
+	SHV_TEST_CHECK(ShvTestGetEptGeneration() == generation);
+	SHV_TEST_CHECK(ShvTestCountInvept(0) == invepts[0] + 1);
+	SHV_TEST_CHECK(ShvTestCountInvept(1) == invepts[1]);
+
+	ShvTestCommitEptChange(SHV_TEST_FLUSH_GLOBAL);
+	SHV_TEST_CHECK(ShvTestGetEptGeneration() == generation + 1);
+	SHV_TEST_CHECK(ShvTestCountInvept(0) == invepts[0] + 1);
+
+	//
+	// Every VP then flushes once on its way back into the guest, and not
+	// again until the generation moves on.
+	//
+	for (ULONG i = 0; i < SHV_TEST_FLUSH_PROCESSORS; i++)
+	{
+		invepts[i] = ShvTestCountInvept(i);
+
+		ShvTestFlushSynchronize(i);
+		ShvTestFlushSynchronize(i);
+
+		SHV_TEST_CHECK(ShvTestCountInvept(i) == invepts[i] + 1);
+		SHV_TEST_CHECK(ShvGlobalData->VpData[i].EptGeneration == (ULONG64)generation + 1);
+	}
+
+	//
+	// Every LP makes global changes at once, and synchronizes after each.
+	// None of them may be lost, and no VP flushes more often than it makes
+	// changes.
+	//
+	generation = ShvTestGetEptGeneration();
+
+	for (ULONG i = 0; i < SHV_TEST_FLUSH_PROCESSORS; i++)
+	{
+		invepts[i] = ShvTestCountInvept(i);
+	}
+
+	ShvTestRunOnProcessors(SHV_TEST_FLUSH_PROCESSORS, ShvTestFlushCommit, NULL);
+
+	SHV_TEST_CHECK(ShvTestGetEptGeneration() ==
+		generation + SHV_TEST_FLUSH_PROCESSORS * SHV_TEST_FLUSH_CHANGES);
+
+	flushed = TRUE;
+
+	for (ULONG i = 0; i < SHV_TEST_FLUSH_PROCESSORS; i++)
+	{
+		flushed &= ShvTestCountInvept(i) - invepts[i] <= SHV_TEST_FLUSH_CHANGES;
+		ShvTestFlushSynchronize(i);
+	}
+
+	SHV_TEST_CHECK(flushed);
+
+	//
+	// A shootdown from root mode flushes the LP that asked for it right
+	// away.  It is complete once every VP running the guest has caught up,
+	// and VPs that aren't running it don't hold it up.
+	//
+	ShvTestSetCurrentProcessor(0);
+	invepts[0] = ShvTestCountInvept(0);
+
+	generation = ShvVmxEptRequestShootdown(&ShvGlobalData->VpData[0]);
+
+	SHV_TEST_CHECK(ShvTestCountInvept(0) == invepts[0] + 1);
+	SHV_TEST_CHECK(!ShvVmxEptShootdownComplete(generation));
+
+	ShvTestFlushSynchronize(1);
+	ShvTestFlushSynchronize(2);
+	SHV_TEST_CHECK(!ShvVmxEptShootdownComplete(generation));
+
+	ShvGlobalData->VpData[3].VmxEnabled = 0;
+	SHV_TEST_CHECK(ShvVmxEptShootdownComplete(generation));
+
+	ShvGlobalData->VpData[3].VmxEnabled = 1;
+	ShvTestFlushSynchronize(3);
+	SHV_TEST_CHECK(ShvVmxEptShootdownComplete(generation));
+
+	//
+	// A retired table waits until every VP running the guest has flushed
+	// at a newer generation than the one it was retired at, since a flush
+	// at the same one may have come before it was unlinked.
+	//
+	SHV_TEST_CHECK(ShvTestRetireEptTable() != NULL);
+	SHV_TEST_CHECK(ShvTestReclaimEptTables() == 1);
+
+	ShvTestCommitEptChange(SHV_TEST_FLUSH_GLOBAL);
+	ShvTestFlushSynchronize(0);
+	ShvTestFlushSynchronize(1);
+	ShvTestFlushSynchronize(2);
+	SHV_TEST_CHECK(ShvTestReclaimEptTables() == 1);
+
+	ShvGlobalData->VpData[3].VmxEnabled = 0;
+	SHV_TEST_CHECK(ShvTestReclaimEptTables() == 0);
+	ShvGlobalData->VpData[3].VmxEnabled = 1;
+
+	//
+	// A shootdown stands in for VPs that haven't exited since, so an idle
+	// one can't keep tables parked forever.
+	//
+	SHV_TEST_CHECK(ShvTestRetireEptTable() != NULL);
+	SHV_TEST_CHECK(ShvTestRetireEptTable() != NULL);
+	SHV_TEST_CHECK(ShvTestReclaimEptTables() == 2);
+
+	ShvVmxEptShootdown();
+	SHV_TEST_CHECK(ShvTestReclaimEptTables() == 0);
+	SHV_TEST_CHECK(ShvTestCheckEptArena() == 0);
+
+	for (ULONG i = 0; i < SHV_TEST_FLUSH_PROCESSORS; i++)
+	{
+		ShvGlobalData->VpData[i].VmxEnabled = 0;
+	}
+
+	ShvTestStopEpt();
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+static VOID
+ShvTestFlushSynchronize(
+	_In_ ULONG Processor
+)
+{
+	//
+	// What the VM exit handler of the LP does on its way back into the
+	// guest.
+	//
+	ShvTestSetCurrentProcessor(Processor);
+	ShvVmxEptSynchronize(&ShvGlobalData->VpData[Processor]);
+	ShvTestSetCurrentProcessor(0);
+}
+
+static VOID
+ShvTestFlushCommit(
+	_In_ ULONG Processor,
+	_In_opt_ PVOID Context
+)
+{
+	UNREFERENCED_PARAMETER(Context);
+
+	for (ULONG i = 0; i < SHV_TEST_FLUSH_CHANGES; i++)
+	{
+		ShvTestCommitEptChange(SHV_TEST_FLUSH_GLOBAL);
+		ShvVmxEptSynchronize(&ShvGlobalData->VpData[Processor]);
+	}
+}
@@ -0,0 +1,134 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvtestguest.c
+
+Abstract:
+
+	This module stands in for the guest memory module.  The memory of the
+	simulated guest is a buffer the test provides, which the guest sees at
+	the same virtual and physical address, so there are no guest page
+	tables to walk.
+
+Author:
+
+	agent (@agent) 16-Oct-2026 - Initial version
+
+Environment:
+
+	User mode only.
+
+--*/
+
+#include "shvtest.h"
+
+// ===========================================================================
+//
+// LOCAL DATA
+//
+// ===========================================================================
+
+static ULONG64 ShvTestGuestBase = 0;
+static PUCHAR ShvTestGuestBuffer = NULL;
+static SIZE_T ShvTestGuestSize = 0;
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+VOID
+ShvTestSetGuestMemory(
+	_In_ ULONG64 Gpa,
+	_In_opt_ PVOID Buffer,
+	_In_ SIZE_T Size
+)
+{
+	ShvTestGuestBase = Gpa;
+	ShvTestGuestBuffer = (PUCHAR)Buffer;
+	ShvTestGuestSize = (Buffer != NULL) ? Size : 0;
+}
+
+PVOID
+ShvTestFindGuestMemory(
+	_In_ ULONG64 Pa
+)
+{
+	if (Pa - ShvTestGuestBase >= ShvTestGuestSize)
+	{
+		return NULL;
+	}
+
+	return ShvTestGuestBuffer + (Pa - ShvTestGuestBase);
+}
+
+ULONG64
+ShvTestFindGuestPhysical(
+	_In_ const VOID *Address
+)
+{
+	//
+	// The GPA the guest sees a byte of the buffer at, or 0 if it isn't in
+	// the buffer.
+	//
+	if ((ULONG_PTR)((const UCHAR *)Address - ShvTestGuestBuffer) >= ShvTestGuestSize)
+	{
+		return 0;
+	}
+
+	return ShvTestGuestBase + ((const UCHAR *)Address - ShvTestGuestBuffer);
+}
+
+NTSTATUS
+ShvVmxGuestReadVirtual(
+	_In_ PSHV_VP_DATA VpData,
+	_In_ ULONG64 Va,
+	_Out_writes_bytes_(Size) PVOID Buffer,
+	_In_ SIZE_T Size
+)
+{
+	UNREFERENCED_PARAMETER(VpData);
+
+	//
+	// Anything outside of the buffer isn't mapped.
+	//
+	if (Va < ShvTestGuestBase ||
+		Va - ShvTestGuestBase > ShvTestGuestSize ||
+		Size > ShvTestGuestSize - (Va - ShvTestGuestBase))
+	{
+		return STATUS_ACCESS_VIOLATION;
+	}
+
+	__movsb((PUCHAR)Buffer, ShvTestGuestBuffer + (Va - ShvTestGuestBase), Size);
+
+	return STATUS_SUCCESS;
+}
+
+PVOID
+ShvVmxGuestMap(
+	_In_ PSHV_VP_DATA VpData,
+	_In_ ULONG64 Hpa
+)
+{
+	UNREFERENCED_PARAMETER(VpData);
+
+	//
+	// Root mode only maps the frames behind guest accesses, which are all
+	// in the buffer.
+	//
+	NT_ASSERT(ShvTestFindGuestMemory(Hpa) != NULL);
+
+	return ShvTestFindGuestMemory(Hpa);
+}
+
+VOID
+ShvVmxGuestUnmap(
+	_In_ PSHV_VP_DATA VpData
+)
+{
+	UNREFERENCED_PARAMETER(VpData);
+}
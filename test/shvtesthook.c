@@ -0,0 +1,131 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvtesthook.c
+
+Abstract:
+
+	This module builds the inline hook module into the test harness.  It
+	is included whole, rather than linked, so that tests can turn hooks on
+	and look at the views they split pages between.  Hook targets are
+	guest code in memory the test provides, at the GPA the guest sees it
+	at.
+
+Author:
+
+	agent (@agent) 16-Oct-2026 - Initial version
+
+Environment:
+
+	User mode only.
+
+--*/
+
+#include "shvtest.h"
+
+// ===========================================================================
+//
+// LOCAL PROTOTYPES
+//
+// ===========================================================================
+
+static PHYSICAL_ADDRESS
+ShvTestHookGetPhysicalAddress(
+	_In_ PVOID BaseAddress
+);
+
+//
+// Targets translate to the guest memory they are in.  Shadows and stubs
+// are ordinary pool.
+//
+#define MmGetPhysicalAddress            ShvTestHookGetPhysicalAddress
+
+#include "../shvvmxhook.c"
+
+#undef MmGetPhysicalAddress
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+NTSTATUS
+ShvTestStartHook(
+	VOID
+)
+{
+	//
+	// Hooks come up after the EPT, the way the driver brings them up, and
+	// start out with nothing counted.
+	//
+	ShvVmxHookRequested = TRUE;
+	ShvVmxHookDataView = SHV_EPT_DEFAULT_VIEW;
+	ShvVmxHookStepView = SHV_EPT_DEFAULT_VIEW;
+
+	__stosb((PUCHAR)&ShvVmxHookStatistics, 0, sizeof(ShvVmxHookStatistics));
+
+	return ShvVmxHookInitialize();
+}
+
+VOID
+ShvTestStopHook(
+	VOID
+)
+{
+	ShvVmxHookCleanup();
+
+	ShvVmxHookRequested = SHV_HOOK_ENABLE;
+}
+
+ULONG
+ShvTestGetHookView(
+	_In_ BOOLEAN Step
+)
+{
+	//
+	// The view instructions on hooked pages are stepped in, or the one
+	// every other read and write of them is.
+	//
+	return Step ? ShvVmxHookStepView : ShvVmxHookDataView;
+}
+
+BOOLEAN
+ShvTestFilterHook(
+	_In_ PSHV_VP_STATE VpState,
+	_In_ ULONG64 Gpa,
+	_In_ ULONG Access
+)
+{
+	//
+	// The handler the EPT module calls for violations on protected pages,
+	// for tests that need to see whether it claimed one.
+	//
+	return ShvVmxHookHandleViolation(VpState, Gpa, Access);
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+static PHYSICAL_ADDRESS
+ShvTestHookGetPhysicalAddress(
+	_In_ PVOID BaseAddress
+)
+{
+	PHYSICAL_ADDRESS address;
+
+	address.QuadPart = ShvTestFindGuestPhysical(BaseAddress);
+
+	if (address.QuadPart == 0)
+	{
+		return MmGetPhysicalAddress(BaseAddress);
+	}
+
+	return address;
+}
@@ -0,0 +1,788 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvtestimage.c
+
+Abstract:
+
+	This module tests that EPT images round trip, on hierarchies generated
+	in user memory without the EPT module, and that the reader rejects any
+	image that is damaged, stale or not an identity map.  It also tests the
+	warm start of the identity map, and benchmarks it against the cold
+	build.
+
+Author:
+
+	agent (@agent) 16-Oct-2026 - Initial version
+
+Environment:
+
+	User mode only.
+
+--*/
+
+#include <string.h>
+#include "shvtest.h"
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+#define SHV_TEST_MB                     (1024ULL * 1024)
+#define SHV_TEST_TB                     (1024 * SHV_TEST_GB)
+
+//
+// The most tables a generated hierarchy can have, and how many of them are
+// generated for the round trip.
+//
+#define SHV_TEST_IMAGE_POOL_PAGES       (2048)
+#define SHV_TEST_IMAGE_SEEDS            (64)
+
+//
+// Where the generated hierarchies stop.
+//
+#define SHV_TEST_IMAGE_TOP              (64 * SHV_TEST_GB)
+
+//
+// The only capabilities the image format cares about.
+//
+#define SHV_TEST_IMAGE_CAPS_ALL         (VMX_EPT_CAP_PDE_2MB | VMX_EPT_CAP_PDPTE_1GB)
+
+// ===========================================================================
+//
+// LOCAL TYPES
+//
+// ===========================================================================
+
+//
+// The tables of a hierarchy built in user memory.  Table 0 is the PML4,
+// and the PFN of a table is its index.
+//
+typedef struct _SHV_TEST_IMAGE_POOL {
+	PULONG64 Pages;
+	ULONG Count;
+	ULONG64 Empty;
+	ULONG Runs;
+} SHV_TEST_IMAGE_POOL, *PSHV_TEST_IMAGE_POOL;
+
+typedef struct _SHV_TEST_IMAGE_MODE {
+	PCSTR Name;
+	ULONG64 Capabilities;
+	ULONG64 MaxRam;
+} SHV_TEST_IMAGE_MODE, *PSHV_TEST_IMAGE_MODE;
+
+// ===========================================================================
+//
+// LOCAL DATA
+//
+// ===========================================================================
+
+static const UCHAR ShvTestImageTypes[] = { Uncacheable, WriteCombining, WriteThrough, WriteProtected, WriteBack };
+
+static const SHV_TEST_IMAGE_MODE ShvTestImageModes[] = {
+	{ "4 KiB", SHV_TEST_EPT_CAPS_4KB, 16 * SHV_TEST_GB },
+	{ "2 MiB", SHV_TEST_EPT_CAPS_2MB, 2 * SHV_TEST_TB },
+	{ "1 GiB", SHV_TEST_EPT_CAPS_1GB, 2 * SHV_TEST_TB },
+};
+
+static const ULONG64 ShvTestImageRamSizes[] = {
+	4 * SHV_TEST_GB,
+	16 * SHV_TEST_GB,
+	256 * SHV_TEST_GB,
+	2 * SHV_TEST_TB,
+};
+
+// ===========================================================================
+//
+// LOCAL PROTOTYPES
+//
+// ===========================================================================
+
+static SHV_EPT_TRANSLATE ShvTestImageTranslate;
+
+static SHV_EPT_IMAGE_MAP ShvTestImageMapRun;
+
+static BOOLEAN
+ShvTestImagePoolCreate(
+	_Out_ PSHV_TEST_IMAGE_POOL Pool,
+	_In_ ULONG64 Empty
+);
+
+static VOID
+ShvTestImagePoolDelete(
+	_Inout_ PSHV_TEST_IMAGE_POOL Pool
+);
+
+static NTSTATUS
+ShvTestImageMapLeaf(
+	_Inout_ PSHV_TEST_IMAGE_POOL Pool,
+	_In_ ULONG64 Gpa,
+	_In_ ULONG Level,
+	_In_ ULONG64 Leaf
+);
+
+static VOID
+ShvTestImageGenerate(
+	_Inout_ PSHV_TEST_IMAGE_POOL Pool,
+	_In_ ULONG64 Capabilities,
+	_In_ ULONG64 Seed
+);
+
+static PVOID
+ShvTestImageWrite(
+	_In_ PSHV_TEST_IMAGE_POOL Pool,
+	_In_ ULONG64 MemoryMapHash,
+	_In_ ULONG64 Capabilities,
+	_Out_ PSIZE_T Size
+);
+
+static VOID
+ShvTestImageRejects(
+	_In_reads_bytes_(Size) const VOID *Image,
+	_In_ SIZE_T Size
+);
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+VOID
+ShvTestImageRoundTrip(
+	VOID
+)
+{
+	SHV_EPT_INSPECTION sourceInspection, copyInspection;
+	SHV_TEST_IMAGE_POOL source, copy;
+	PSHV_EPT_IMAGE_HEADER header;
+	PVOID image, copyImage;
+	SIZE_T size, copySize;
+	ULONG64 caps, empty;
+
+	//
+	// Generate hierarchies of every kind of leaf, with and without #VE and
+	// large pages, read each one's image into an empty hierarchy, and
+	// check that it writes back out the same.
+	//
+	for (ULONG64 seed = 1; seed <= SHV_TEST_IMAGE_SEEDS; seed++)
+	{
+		caps = (seed % 3 == 0) ? 0 : (seed % 3 == 1) ? VMX_EPT_CAP_PDE_2MB : SHV_TEST_IMAGE_CAPS_ALL;
+		empty = (seed & 1) ? VMX_EPT_SUPPRESS_VE : 0;
+
+		if (!SHV_TEST_CHECK(ShvTestImagePoolCreate(&source, empty)))
+		{
+			return;
+		}
+
+		ShvTestImageGenerate(&source, caps, seed);
+
+		//
+		// The seed doubles as the memory map hash, which the reader only
+		// compares.
+		//
+		image = ShvTestImageWrite(&source, seed, caps, &size);
+		if (!SHV_TEST_CHECK(image != NULL))
+		{
+			ShvTestImagePoolDelete(&source);
+			return;
+		}
+
+		header = (PSHV_EPT_IMAGE_HEADER)image;
+		SHV_TEST_CHECK(header->Tables == source.Count);
+		SHV_TEST_CHECK(size == sizeof(*header) + header->RunCount * sizeof(SHV_EPT_IMAGE_RUN));
+
+		if (!SHV_TEST_CHECK(ShvTestImagePoolCreate(&copy, empty)))
+		{
+			ShvTestPlatFree(image);
+			ShvTestImagePoolDelete(&source);
+			return;
+		}
+
+		SHV_TEST_CHECK_SUCCESS(ShvVmxEptImageRead(image, size, seed, caps, empty, ShvTestImageMapRun, &copy));
+		SHV_TEST_CHECK(copy.Runs == header->RunCount);
+		SHV_TEST_CHECK(copy.Count == source.Count);
+
+		copyImage = ShvTestImageWrite(&copy, seed, caps, &copySize);
+		if (SHV_TEST_CHECK(copyImage != NULL))
+		{
+			SHV_TEST_CHECK((copySize == size) && (memcmp(copyImage, image, size) == 0));
+			ShvTestPlatFree(copyImage);
+		}
+
+		//
+		// Only the accessed and dirty flags, which are never saved, may
+		// differ, and the inspector doesn't look at those.
+		//
+		ShvVmxEptInspectHierarchy((PVMX_EPT_ENTRY)source.Pages, ShvTestImageTranslate, &source, caps, empty, &sourceInspection);
+		ShvVmxEptInspectHierarchy((PVMX_EPT_ENTRY)copy.Pages, ShvTestImageTranslate, &copy, caps, empty, &copyInspection);
+		SHV_TEST_CHECK(memcmp(&sourceInspection, &copyInspection, sizeof(sourceInspection)) == 0);
+
+		if (ShvTestVerbose && (seed <= 6))
+		{
+			ShvTestPrint("seed %llu: %llu tables, %llu/%llu/%llu leaves, %u runs, %zu bytes\n",
+				seed,
+				header->Tables,
+				sourceInspection.Leaves[1],
+				sourceInspection.Leaves[2],
+				sourceInspection.Leaves[3],
+				header->RunCount,
+				size);
+		}
+
+		if (seed == SHV_TEST_IMAGE_SEEDS)
+		{
+			ShvTestImageRejects(image, size);
+		}
+
+		ShvTestImagePoolDelete(&copy);
+		ShvTestImagePoolDelete(&source);
+		ShvTestPlatFree(image);
+	}
+}
+
+VOID
+ShvTestWarmStart(
+	VOID
+)
+{
+	PSHV_EPT_IMAGE_HEADER header;
+	PSHV_EPT_IMAGE_RUN runs, last;
+	PVOID image, cold, warm;
+	SIZE_T size, coldSize, warmSize;
+	ULONG64 gpa;
+
+	ShvTestConfigureEpt(FALSE, TRUE, FALSE);
+	ShvTestSetMsr(MSR_IA32_VMX_EPT_VPID_CAP, SHV_TEST_EPT_CAPS_2MB);
+
+	//
+	// Without an image, the identity map is built and saved.
+	//
+	if (!SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+	{
+		return;
+	}
+
+	SHV_TEST_CHECK_SUCCESS(ShvTestWriteEptImage(&cold, &coldSize));
+	ShvTestStopEpt();
+
+	if (!SHV_TEST_CHECK_SUCCESS(ShvTestReadEptImageFile(&image, &size)))
+	{
+		ShvTestPlatFree(cold);
+		return;
+	}
+
+	header = (PSHV_EPT_IMAGE_HEADER)image;
+	SHV_TEST_CHECK(header->Magic == SHV_EPT_IMAGE_MAGIC);
+	SHV_TEST_CHECK(header->MemoryMapHash != 0);
+
+	//
+	// The saved image is the one the next load finds.  Prove that the map
+	// is really loaded from it by taking out its last run, which the cold
+	// build would have mapped.
+	//
+	runs = (PSHV_EPT_IMAGE_RUN)(header + 1);
+	last = &runs[header->RunCount - 1];
+	gpa = last->Gpa;
+
+	header->RunCount--;
+	header->Checksum = ShvVmxEptImageHash(runs, header->RunCount * sizeof(*runs), SHV_EPT_IMAGE_HASH_SEED);
+	SHV_TEST_CHECK_SUCCESS(ShvTestWriteEptImageFile(image, size - sizeof(*runs)));
+
+	if (SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+	{
+		SHV_TEST_CHECK(ShvVmxEptGetPageSize(gpa) == 0);
+		SHV_TEST_CHECK(ShvVmxEptGetPageSize(0x1000) != 0);
+		ShvTestStopEpt();
+	}
+
+	//
+	// A damaged image is rebuilt from scratch and saved again.
+	//
+	runs[0].Count++;
+	SHV_TEST_CHECK_SUCCESS(ShvTestWriteEptImageFile(image, size - sizeof(*runs)));
+
+	if (SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+	{
+		SHV_TEST_CHECK(ShvVmxEptGetPageSize(gpa) != 0);
+		ShvTestStopEpt();
+	}
+
+	ShvTestPlatFree(image);
+
+	//
+	// The repaired image loads the same identity map the cold build made.
+	//
+	if (SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+	{
+		if (SHV_TEST_CHECK_SUCCESS(ShvTestWriteEptImage(&warm, &warmSize)))
+		{
+			SHV_TEST_CHECK((warmSize == coldSize) && (memcmp(warm, cold, coldSize) == 0));
+			ShvTestPlatFree(warm);
+		}
+
+		ShvTestStopEpt();
+	}
+
+	//
+	// An image of another memory map is stale.  The new map is built and
+	// replaces it.
+	//
+	ShvTestSetTypicalMemoryMap(8 * SHV_TEST_GB);
+
+	if (SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+	{
+		SHV_TEST_CHECK(ShvVmxEptGetPageSize(9 * SHV_TEST_GB - PAGE_SIZE) != 0);
+		ShvTestStopEpt();
+	}
+
+	if (SHV_TEST_CHECK_SUCCESS(ShvTestReadEptImageFile(&image, &size)))
+	{
+		header = (PSHV_EPT_IMAGE_HEADER)image;
+		SHV_TEST_CHECK(header->MemoryMapHash != ((PSHV_EPT_IMAGE_HEADER)cold)->MemoryMapHash);
+		ShvTestPlatFree(image);
+	}
+
+	ShvTestPlatFree(cold);
+}
+
+VOID
+ShvTestWarmStartBenchmark(
+	VOID
+)
+{
+	ULONG64 start, cold, save, warm;
+	PVOID image;
+	SIZE_T size;
+
+	//
+	// Cold is the build without saving an image, and save is the same build
+	// with it, which only the first load after the memory map changes pays.
+	//
+	ShvTestPrint("%-6s %8s %10s %10s %10s %10s %8s\n", "pages", "RAM", "cold ms", "save ms", "warm ms", "image KiB", "speedup");
+
+	for (ULONG m = 0; m < RTL_NUMBER_OF(ShvTestImageModes); m++)
+	{
+		for (ULONG r = 0; r < RTL_NUMBER_OF(ShvTestImageRamSizes); r++)
+		{
+			if (ShvTestImageRamSizes[r] > ShvTestImageModes[m].MaxRam)
+			{
+				continue;
+			}
+
+			ShvTestSetTypicalMemoryMap(ShvTestImageRamSizes[r]);
+			ShvTestSetMsr(MSR_IA32_VMX_EPT_VPID_CAP, ShvTestImageModes[m].Capabilities);
+			ShvTestDeleteFiles();
+
+			ShvTestConfigureEpt(FALSE, FALSE, FALSE);
+
+			start = ShvTestNow();
+
+			if (!SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+			{
+				return;
+			}
+
+			cold = ShvTestNow() - start;
+			ShvTestStopEpt();
+
+			ShvTestConfigureEpt(FALSE, TRUE, FALSE);
+
+			start = ShvTestNow();
+
+			if (!SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+			{
+				return;
+			}
+
+			save = ShvTestNow() - start;
+			ShvTestStopEpt();
+
+			start = ShvTestNow();
+
+			if (!SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+			{
+				return;
+			}
+
+			warm = ShvTestNow() - start;
+			ShvTestStopEpt();
+
+			size = 0;
+
+			if (ShvTestReadEptImageFile(&image, &size) == STATUS_SUCCESS)
+			{
+				ShvTestPlatFree(image);
+			}
+
+			ShvTestPrint("%-6s %5llu GiB %10.1f %10.1f %10.1f %10.1f %7.2fx\n",
+				ShvTestImageModes[m].Name,
+				ShvTestImageRamSizes[r] / SHV_TEST_GB,
+				cold / 1e6,
+				save / 1e6,
+				warm / 1e6,
+				size / 1024.0,
+				(double)cold / warm);
+		}
+	}
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+static PVOID
+ShvTestImageTranslate(
+	_In_opt_ PVOID Context,
+	_In_ ULONG64 Pfn
+)
+{
+	PSHV_TEST_IMAGE_POOL pool;
+
+	pool = (PSHV_TEST_IMAGE_POOL)Context;
+	NT_ASSERT(Pfn < pool->Count);
+
+	return &pool->Pages[Pfn * (PAGE_SIZE / sizeof(ULONG64))];
+}
+
+static NTSTATUS
+ShvTestImageMapRun(
+	_In_opt_ PVOID Context,
+	_In_ const SHV_EPT_IMAGE_RUN *Run
+)
+{
+	PSHV_TEST_IMAGE_POOL pool;
+	ULONG64 size;
+	NTSTATUS ret;
+
+	pool = (PSHV_TEST_IMAGE_POOL)Context;
+	pool->Runs++;
+
+	size = SHV_EPT_LEVEL_SIZE(Run->Level);
+
+	for (ULONG i = 0; i < Run->Count; i++)
+	{
+		ret = ShvTestImageMapLeaf(pool, Run->Gpa + i * size, Run->Level, Run->First + i * size);
+		if (ret != STATUS_SUCCESS)
+		{
+			return ret;
+		}
+	}
+
+	return STATUS_SUCCESS;
+}
+
+static BOOLEAN
+ShvTestImagePoolCreate(
+	_Out_ PSHV_TEST_IMAGE_POOL Pool,
+	_In_ ULONG64 Empty
+)
+{
+	Pool->Pages = (PULONG64)ShvTestPlatAllocatePages(SHV_TEST_IMAGE_POOL_PAGES * PAGE_SIZE, 0);
+	if (Pool->Pages == NULL)
+	{
+		return FALSE;
+	}
+
+	Pool->Count = 1;
+	Pool->Empty = Empty;
+	Pool->Runs = 0;
+
+	for (ULONG i = 0; i < PAGE_SIZE / sizeof(ULONG64); i++)
+	{
+		Pool->Pages[i] = Empty;
+	}
+
+	return TRUE;
+}
+
+static VOID
+ShvTestImagePoolDelete(
+	_Inout_ PSHV_TEST_IMAGE_POOL Pool
+)
+{
+	ShvTestPlatFreePages(Pool->Pages, SHV_TEST_IMAGE_POOL_PAGES * PAGE_SIZE);
+	Pool->Pages = NULL;
+}
+
+static NTSTATUS
+ShvTestImageMapLeaf(
+	_Inout_ PSHV_TEST_IMAGE_POOL Pool,
+	_In_ ULONG64 Gpa,
+	_In_ ULONG Level,
+	_In_ ULONG64 Leaf
+)
+{
+	PULONG64 table, next;
+
+	//
+	// Walk down to the level of the leaf, adding tables on the way.
+	//
+	table = Pool->Pages;
+
+	for (ULONG level = VMX_EPT_PAGE_WALK_LENGTH; level > Level; level--)
+	{
+		PULONG64 entry;
+
+		entry = &table[SHV_EPT_INDEX(Gpa, level)];
+
+		if (*entry == Pool->Empty)
+		{
+			if (Pool->Count == SHV_TEST_IMAGE_POOL_PAGES)
+			{
+				return STATUS_HV_NO_RESOURCES;
+			}
+
+			next = &Pool->Pages[Pool->Count * (PAGE_SIZE / sizeof(ULONG64))];
+
+			for (ULONG i = 0; i < PAGE_SIZE / sizeof(ULONG64); i++)
+			{
+				next[i] = Pool->Empty;
+			}
+
+			*entry = ((ULONG64)Pool->Count++ << PAGE_SHIFT) | VMX_EPT_ACCESS_RWX;
+		}
+
+		table = (PULONG64)ShvTestImageTranslate(Pool, (*entry & SHV_EPT_PFN_MASK) >> PAGE_SHIFT);
+	}
+
+	table[SHV_EPT_INDEX(Gpa, Level)] = Leaf;
+
+	return STATUS_SUCCESS;
+}
+
+static VOID
+ShvTestImageGenerate(
+	_Inout_ PSHV_TEST_IMAGE_POOL Pool,
+	_In_ ULONG64 Capabilities,
+	_In_ ULONG64 Seed
+)
+{
+	ULONG64 state, address, leaf, size, count, type, access;
+	ULONG level, choice;
+
+	//
+	// Walk up the address space, leaving holes and mapping stretches of
+	// leaves of one size, memory type and access, with accessed and dirty
+	// flags set here and there.  Large pages are only used when supported.  A stretch sometimes changes type halfway,
+	// so runs also break between neighbouring leaves.
+	//
+	state = 0x9e3779b97f4a7c15ULL * Seed;
+	address = 0;
+
+	while (address < SHV_TEST_IMAGE_TOP)
+	{
+		choice = (ULONG)(ShvTestRandom(&state) % 8);
+
+		if (choice == 0)
+		{
+			size = (ShvTestRandom(&state) & 1) ? PAGE_SIZE : VMX_EPT_PAGE_SIZE_2MB;
+			address += (1 + ShvTestRandom(&state) % 1024) * size;
+			continue;
+		}
+
+		if ((choice >= 6) && (Capabilities & VMX_EPT_CAP_PDPTE_1GB))
+		{
+			level = 3;
+			count = 1 + ShvTestRandom(&state) % 4;
+		}
+		else if ((choice >= 3) && (Capabilities & VMX_EPT_CAP_PDE_2MB))
+		{
+			level = 2;
+			count = 1 + ShvTestRandom(&state) % 600;
+		}
+		else
+		{
+			level = 1;
+			count = 1 + ShvTestRandom(&state) % 700;
+		}
+
+		//
+		// Large pages start at the next address they can.
+		//
+		address = (address + SHV_EPT_LEVEL_SIZE(level) - 1) & ~(SHV_EPT_LEVEL_SIZE(level) - 1);
+
+		size = SHV_EPT_LEVEL_SIZE(level);
+		type = ShvTestImageTypes[ShvTestRandom(&state) % RTL_NUMBER_OF(ShvTestImageTypes)];
+		access = 1 + ShvTestRandom(&state) % VMX_EPT_ACCESS_RWX;
+
+		for (ULONG64 i = 0; (i < count) && (address < SHV_TEST_IMAGE_TOP); i++)
+		{
+			if (ShvTestRandom(&state) % 64 == 0)
+			{
+				type = ShvTestImageTypes[ShvTestRandom(&state) % RTL_NUMBER_OF(ShvTestImageTypes)];
+			}
+
+			leaf = address | (type << 3) | access;
+
+			if (level > 1)
+			{
+				leaf |= SHV_EPT_LARGE_PAGE;
+			}
+
+			if (ShvTestRandom(&state) % 4 == 0)
+			{
+				leaf |= VMX_EPT_ACCESSED | ((level == 1) ? VMX_EPT_DIRTY : 0);
+			}
+
+			//
+			// Stop while there is still room for every table the leaf could
+			// need, so no table is ever left empty.
+			//
+			if ((Pool->Count + VMX_EPT_PAGE_WALK_LENGTH > SHV_TEST_IMAGE_POOL_PAGES) ||
+				(ShvTestImageMapLeaf(Pool, address, level, leaf) != STATUS_SUCCESS))
+			{
+				return;
+			}
+
+			address += size;
+		}
+	}
+}
+
+static PVOID
+ShvTestImageWrite(
+	_In_ PSHV_TEST_IMAGE_POOL Pool,
+	_In_ ULONG64 MemoryMapHash,
+	_In_ ULONG64 Capabilities,
+	_Out_ PSIZE_T Size
+)
+{
+	PVOID image;
+
+	if (ShvVmxEptImageWrite((PVMX_EPT_ENTRY)Pool->Pages,
+		ShvTestImageTranslate,
+		Pool,
+		MemoryMapHash,
+		Capabilities,
+		Pool->Empty,
+		NULL,
+		0,
+		Size) != STATUS_BUFFER_TOO_SMALL)
+	{
+		return NULL;
+	}
+
+	image = ShvTestPlatAllocate(*Size, 16);
+	if (image == NULL)
+	{
+		return NULL;
+	}
+
+	if (ShvVmxEptImageWrite((PVMX_EPT_ENTRY)Pool->Pages,
+		ShvTestImageTranslate,
+		Pool,
+		MemoryMapHash,
+		Capabilities,
+		Pool->Empty,
+		image,
+		*Size,
+		Size) != STATUS_SUCCESS)
+	{
+		ShvTestPlatFree(image);
+		return NULL;
+	}
+
+	return image;
+}
+
+static VOID
+ShvTestImageRejects(
+	_In_reads_bytes_(Size) const VOID *Image,
+	_In_ SIZE_T Size
+)
+{
+	PSHV_EPT_IMAGE_HEADER header;
+	PSHV_EPT_IMAGE_RUN runs, last;
+	SHV_TEST_IMAGE_POOL pool;
+	ULONG64 caps, empty, hash;
+	PUCHAR copy;
+
+	copy = (PUCHAR)ShvTestPlatAllocate(Size, 16);
+	if (!SHV_TEST_CHECK(copy != NULL))
+	{
+		return;
+	}
+
+	if (!SHV_TEST_CHECK(ShvTestImagePoolCreate(&pool, 0)))
+	{
+		ShvTestPlatFree(copy);
+		return;
+	}
+
+	header = (PSHV_EPT_IMAGE_HEADER)copy;
+	runs = (PSHV_EPT_IMAGE_RUN)(header + 1);
+	last = &runs[((const SHV_EPT_IMAGE_HEADER *)Image)->RunCount - 1];
+	caps = ((const SHV_EPT_IMAGE_HEADER *)Image)->Capabilities;
+	empty = ((const SHV_EPT_IMAGE_HEADER *)Image)->Empty;
+	hash = ((const SHV_EPT_IMAGE_HEADER *)Image)->MemoryMapHash;
+
+#define SHV_TEST_IMAGE_REJECT(edit, length, status) \
+	__movsb(copy, (const UCHAR *)Image, Size); \
+	edit; \
+	SHV_TEST_CHECK(ShvVmxEptImageRead(copy, (length), hash, caps, empty, ShvTestImageMapRun, &pool) == (status))
+
+	//
+	// Damage to the framing, the version or the runs.
+	//
+	SHV_TEST_IMAGE_REJECT((void)0, sizeof(*header) - 1, STATUS_INVALID_IMAGE_FORMAT);
+	SHV_TEST_IMAGE_REJECT((void)0, Size - 1, STATUS_INVALID_IMAGE_FORMAT);
+	SHV_TEST_IMAGE_REJECT(header->Magic++, Size, STATUS_INVALID_IMAGE_FORMAT);
+	SHV_TEST_IMAGE_REJECT(header->Version++, Size, STATUS_INVALID_IMAGE_FORMAT);
+	SHV_TEST_IMAGE_REJECT(header->HeaderSize += 8, Size, STATUS_INVALID_IMAGE_FORMAT);
+	SHV_TEST_IMAGE_REJECT(header->RunSize -= 8, Size, STATUS_INVALID_IMAGE_FORMAT);
+	SHV_TEST_IMAGE_REJECT(header->RunCount++, Size, STATUS_INVALID_IMAGE_FORMAT);
+	SHV_TEST_IMAGE_REJECT(header->Checksum++, Size, STATUS_INVALID_IMAGE_FORMAT);
+	SHV_TEST_IMAGE_REJECT(copy[Size - 5] ^= 0x10, Size, STATUS_INVALID_IMAGE_FORMAT);
+
+	//
+	// An intact image for another memory map, processor or #VE setting.
+	//
+	SHV_TEST_IMAGE_REJECT(header->MemoryMapHash++, Size, STATUS_REVISION_MISMATCH);
+	SHV_TEST_IMAGE_REJECT(header->Capabilities ^= VMX_EPT_CAP_PDPTE_1GB, Size, STATUS_REVISION_MISMATCH);
+	SHV_TEST_IMAGE_REJECT(header->Empty ^= VMX_EPT_SUPPRESS_VE, Size, STATUS_REVISION_MISMATCH);
+
+	//
+	// Runs with a valid checksum that the writer could never have written:
+	// not an identity map, out of order, at a level that can't hold a leaf,
+	// misaligned, carrying flags that are never saved, or past the top of a
+	// four level walk.
+	//
+#define SHV_TEST_IMAGE_REJECT_RUN(edit) \
+	SHV_TEST_IMAGE_REJECT( \
+		edit; header->Checksum = ShvVmxEptImageHash(runs, header->RunCount * sizeof(*runs), SHV_EPT_IMAGE_HASH_SEED), \
+		Size, \
+		STATUS_INVALID_IMAGE_FORMAT)
+
+	SHV_TEST_IMAGE_REJECT_RUN(runs[1].First += SHV_EPT_LEVEL_SIZE(runs[1].Level));
+	SHV_TEST_IMAGE_REJECT_RUN(runs[1].Gpa = runs[0].Gpa; runs[1].First = (runs[1].First & ~SHV_EPT_PFN_MASK) | runs[1].Gpa);
+	SHV_TEST_IMAGE_REJECT_RUN(runs[1].Count += 1000000);
+	SHV_TEST_IMAGE_REJECT_RUN(runs[0].Level = 4);
+	SHV_TEST_IMAGE_REJECT_RUN(runs[0].Count = 0);
+	SHV_TEST_IMAGE_REJECT_RUN(runs[0].Gpa += 0x800; runs[0].First += 0x800);
+	SHV_TEST_IMAGE_REJECT_RUN(runs[0].First &= ~(ULONG64)VMX_EPT_ACCESS_RWX);
+	SHV_TEST_IMAGE_REJECT_RUN(runs[0].First |= VMX_EPT_ACCESSED);
+	SHV_TEST_IMAGE_REJECT_RUN(
+		last->Gpa = (1ULL << 48) - SHV_EPT_LEVEL_SIZE(last->Level);
+		last->First = (last->First & ~SHV_EPT_PFN_MASK) | last->Gpa;
+		last->Count = 2);
+
+#undef SHV_TEST_IMAGE_REJECT_RUN
+#undef SHV_TEST_IMAGE_REJECT
+
+	//
+	// None of them got as far as mapping anything.
+	//
+	SHV_TEST_CHECK(pool.Runs == 0);
+	SHV_TEST_CHECK(pool.Count == 1);
+
+	ShvTestImagePoolDelete(&pool);
+	ShvTestPlatFree(copy);
+}
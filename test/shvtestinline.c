@@ -0,0 +1,532 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvtestinline.c
+
+Abstract:
+
+	This module tests inline hooks: that a hooked page executes a shadow
+	copy with the patches while its reads and writes see the original,
+	that a read or write of it is stepped in the view of the originals,
+	or in the view that withholds nothing when the instruction is on a
+	hooked page itself, and comes back to the default view right after,
+	and that removing hooks rebuilds the shadows and joins the pages.
+
+Author:
+
+	agent (@agent) 16-Oct-2026 - Initial version
+
+Environment:
+
+	User mode only.
+
+--*/
+
+#include "shvtest.h"
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// The guest memory the test provides, in the first 1 GiB of RAM.  The
+// guest runs without paging, so its code is at the same VA and GPA.
+// Page 0 holds the instructions that read and write the hooked pages, 1
+// and 2 are hooked, and 3 is protected by someone else.
+//
+#define SHV_TEST_INLINE_BASE            (0x10000000ULL)
+#define SHV_TEST_INLINE_SIZE            (4 * PAGE_SIZE)
+#define SHV_TEST_INLINE_PAGE(n)         (SHV_TEST_INLINE_BASE + (n) * PAGE_SIZE)
+
+//
+// Where on their pages the hooks go.  The detour is never called, so any
+// address will do.
+//
+#define SHV_TEST_INLINE_DETOUR_OFFSET   (0x100)
+#define SHV_TEST_INLINE_PATCH_OFFSET    (0x10)
+#define SHV_TEST_INLINE_SECOND_OFFSET   (0x300)
+#define SHV_TEST_INLINE_DETOUR          ((PVOID)0xfffff80012345678ULL)
+
+//
+// The monitor trap flag, in the processor-based controls and in the bit
+// of the capability MSR that allows it.
+//
+#define SHV_TEST_INLINE_MTF_CAPABILITY  (1ULL << (32 + 27))
+
+// ===========================================================================
+//
+// LOCAL DATA
+//
+// ===========================================================================
+
+static const UCHAR ShvTestInlinePatch[] = { 0x31, 0xc0, 0xc3 };
+static const UCHAR ShvTestInlineSecond[] = { 0x90, 0x90 };
+
+// ===========================================================================
+//
+// LOCAL PROTOTYPES
+//
+// ===========================================================================
+
+static ULONG
+ShvTestInlineAccess(
+	_In_ ULONG View,
+	_In_ ULONG64 Gpa,
+	_Out_ PULONG64 Hpa
+);
+
+static VOID
+ShvTestInlineFault(
+	_In_ ULONG64 Rip,
+	_In_ ULONG64 Gpa,
+	_In_ ULONG Access
+);
+
+static BOOLEAN
+ShvTestInlineInView(
+	_In_ ULONG View
+);
+
+static BOOLEAN
+ShvTestInlineTrapping(
+	VOID
+);
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+VOID
+ShvTestInlineHooks(
+	VOID
+)
+{
+	SHV_HOOK_STATISTICS statistics;
+	SHV_HOOK_REQUEST requests[2];
+	SHV_EPT_PROTECTION protection;
+	SHV_EPT_REMAP remap;
+	SHV_VP_STATE vpState;
+	ULONG64 hpa, shadow, other, hits;
+	ULONG ids[2], second, dataView, stepView;
+	PUCHAR memory, stub, code;
+
+	memory = (PUCHAR)ShvTestPlatAllocatePages(SHV_TEST_INLINE_SIZE, MM_ANY_NODE_OK);
+	if (!SHV_TEST_CHECK(memory != NULL))
+	{
+		return;
+	}
+
+	for (ULONG i = 0; i < SHV_TEST_INLINE_SIZE; i++)
+	{
+		memory[i] = (UCHAR)(i * 7 + 3);
+	}
+
+	ShvTestSetGuestMemory(SHV_TEST_INLINE_BASE, memory, SHV_TEST_INLINE_SIZE);
+
+	//
+	// Hooks split pages between views the guest can switch between.
+	// Without the monitor trap flag there is nothing to step with, so
+	// nothing can be hooked, but everything else works.
+	//
+	ShvTestSetMsr(MSR_IA32_VMX_PROCBASED_CTLS2,
+		(ULONG64)(SECONDARY_EXEC_ENABLE_EPT | SECONDARY_EXEC_ENABLE_VM_FUNCTIONS) << 32);
+	ShvTestSetMsr(MSR_IA32_VMX_VMFUNC, VMX_VMFUNC_EPTP_SWITCHING);
+
+	if (!SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+	{
+		goto Free;
+	}
+
+	SHV_TEST_CHECK_SUCCESS(ShvTestStartHook());
+
+	requests[0].Target = memory + PAGE_SIZE + SHV_TEST_INLINE_DETOUR_OFFSET;
+	requests[0].Detour = SHV_TEST_INLINE_DETOUR;
+	requests[0].Patch = NULL;
+	requests[0].PatchLength = 0;
+
+	SHV_TEST_CHECK(ShvVmxHookInstall(requests, 1, ids) == STATUS_HV_NOT_PRESENT);
+
+	ShvTestStopHook();
+	ShvTestStopEpt();
+
+	ShvTestSetMsr(MSR_IA32_VMX_PROCBASED_CTLS, (1ULL << (32 + 31)) | SHV_TEST_INLINE_MTF_CAPABILITY);
+
+	if (!SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+	{
+		goto Free;
+	}
+
+	if (!SHV_TEST_CHECK_SUCCESS(ShvTestStartHook()) ||
+		!SHV_TEST_CHECK_SUCCESS(ShvVmxGuestInitialize()))
+	{
+		ShvTestStopHook();
+		ShvTestStopEpt();
+		goto Free;
+	}
+
+	dataView = ShvTestGetHookView(FALSE);
+	stepView = ShvTestGetHookView(TRUE);
+
+	SHV_TEST_CHECK(dataView != SHV_EPT_DEFAULT_VIEW);
+	SHV_TEST_CHECK(stepView != SHV_EPT_DEFAULT_VIEW && stepView != dataView);
+
+	__vmx_vmwrite(GUEST_CR0, 0);
+	__vmx_vmwrite(CPU_BASED_VM_EXEC_CONTROL, 0);
+
+	//
+	// A hook has either a detour or a patch, and what it overwrites has to
+	// be on one page.  A batch with a bad hook in it installs nothing.
+	//
+	requests[1].Target = memory + 2 * PAGE_SIZE + SHV_TEST_INLINE_PATCH_OFFSET;
+	requests[1].Detour = NULL;
+	requests[1].Patch = ShvTestInlinePatch;
+	requests[1].PatchLength = sizeof(ShvTestInlinePatch);
+
+	requests[1].PatchLength = 0;
+	SHV_TEST_CHECK(ShvVmxHookInstall(requests, 2, ids) == STATUS_INVALID_PARAMETER);
+	SHV_TEST_CHECK(ids[0] == 0 && ids[1] == 0);
+
+	requests[1].PatchLength = SHV_HOOK_PATCH_LENGTH + 1;
+	SHV_TEST_CHECK(ShvVmxHookInstall(requests, 2, ids) == STATUS_INVALID_PARAMETER);
+
+	requests[1].PatchLength = sizeof(ShvTestInlinePatch);
+	requests[1].Detour = SHV_TEST_INLINE_DETOUR;
+	SHV_TEST_CHECK(ShvVmxHookInstall(requests, 2, ids) == STATUS_INVALID_PARAMETER);
+
+	requests[1].Detour = NULL;
+	requests[1].Patch = NULL;
+	SHV_TEST_CHECK(ShvVmxHookInstall(requests, 2, ids) == STATUS_INVALID_PARAMETER);
+
+	requests[1].Patch = ShvTestInlinePatch;
+	requests[1].Target = NULL;
+	SHV_TEST_CHECK(ShvVmxHookInstall(requests, 2, ids) == STATUS_INVALID_PARAMETER);
+
+	requests[1].Target = memory + 3 * PAGE_SIZE - sizeof(ShvTestInlinePatch) + 1;
+	SHV_TEST_CHECK(ShvVmxHookInstall(requests, 2, ids) == STATUS_INVALID_PARAMETER);
+
+	requests[0].Target = memory + 2 * PAGE_SIZE - SHV_HOOK_PATCH_LENGTH + 1;
+	requests[1].Target = memory + 2 * PAGE_SIZE + SHV_TEST_INLINE_PATCH_OFFSET;
+	SHV_TEST_CHECK(ShvVmxHookInstall(requests, 2, ids) == STATUS_INVALID_PARAMETER);
+
+	ShvVmxHookQuery(&statistics);
+	SHV_TEST_CHECK(statistics.Hooks == 0);
+	SHV_TEST_CHECK(statistics.Pages == 0);
+
+	//
+	// Patches can't overlap each other, and only pages nobody else protected
+	// or remapped can be hooked.
+	//
+	requests[0].Target = memory + 2 * PAGE_SIZE + SHV_TEST_INLINE_PATCH_OFFSET - 1;
+	requests[0].Detour = NULL;
+	requests[0].Patch = ShvTestInlinePatch;
+	requests[0].PatchLength = sizeof(ShvTestInlinePatch);
+	SHV_TEST_CHECK(ShvVmxHookInstall(requests, 2, ids) == STATUS_CONFLICTING_ADDRESSES);
+
+	protection.Gpa = SHV_TEST_INLINE_PAGE(3);
+	protection.Length = PAGE_SIZE;
+	protection.Access = VMX_EPT_ACCESS_READ;
+	SHV_TEST_CHECK_SUCCESS(ShvVmxEptProtectRanges(&protection, 1));
+
+	requests[0].Target = memory + 3 * PAGE_SIZE;
+	SHV_TEST_CHECK(ShvVmxHookInstall(requests, 1, ids) == STATUS_CONFLICTING_ADDRESSES);
+
+	remap.Gpa = SHV_TEST_INLINE_PAGE(3);
+	remap.Hpa = SHV_TEST_INLINE_PAGE(0);
+	remap.Access = VMX_EPT_ACCESS_RWX;
+	SHV_TEST_CHECK_SUCCESS(ShvVmxEptRemapPages(&remap, 1));
+
+	SHV_TEST_CHECK(ShvVmxHookInstall(requests, 1, ids) == STATUS_CONFLICTING_ADDRESSES);
+
+	ShvVmxHookQuery(&statistics);
+	SHV_TEST_CHECK(statistics.Hooks == 0);
+	SHV_TEST_CHECK(statistics.Pages == 0);
+
+	//
+	// A hooked page executes a shadow of itself with the patch in it, and
+	// can't be read or written in the default view.  The view of the
+	// originals can read and write it but not execute it, and the view
+	// hooked instructions are stepped in withholds nothing.  Shadows are
+	// pool, which the harness has at the same address in both.
+	//
+	requests[0].Target = memory + PAGE_SIZE + SHV_TEST_INLINE_DETOUR_OFFSET;
+	requests[0].Detour = SHV_TEST_INLINE_DETOUR;
+	requests[0].Patch = NULL;
+	requests[0].PatchLength = 0;
+
+	if (!SHV_TEST_CHECK_SUCCESS(ShvVmxHookInstall(requests, 2, ids)))
+	{
+		ShvVmxGuestCleanup();
+		ShvTestStopHook();
+		ShvTestStopEpt();
+		goto Free;
+	}
+
+	SHV_TEST_CHECK(ids[0] == 1 && ids[1] == 2);
+
+	ShvVmxHookQuery(&statistics);
+	SHV_TEST_CHECK(statistics.Hooks == 2);
+	SHV_TEST_CHECK(statistics.Pages == 2);
+
+	SHV_TEST_CHECK(ShvTestInlineAccess(SHV_EPT_DEFAULT_VIEW, SHV_TEST_INLINE_PAGE(1), &shadow) == VMX_EPT_ACCESS_EXECUTE);
+	SHV_TEST_CHECK(shadow != SHV_TEST_INLINE_PAGE(1));
+	SHV_TEST_CHECK(ShvTestInlineAccess(dataView, SHV_TEST_INLINE_PAGE(1), &hpa) == (VMX_EPT_ACCESS_READ | VMX_EPT_ACCESS_WRITE));
+	SHV_TEST_CHECK(hpa == SHV_TEST_INLINE_PAGE(1));
+	SHV_TEST_CHECK(ShvTestInlineAccess(stepView, SHV_TEST_INLINE_PAGE(1), &hpa) == VMX_EPT_ACCESS_RWX);
+	SHV_TEST_CHECK(hpa == SHV_TEST_INLINE_PAGE(1));
+
+	SHV_TEST_CHECK(ShvTestInlineAccess(SHV_EPT_DEFAULT_VIEW, SHV_TEST_INLINE_PAGE(0), &hpa) == VMX_EPT_ACCESS_RWX);
+	SHV_TEST_CHECK(hpa == SHV_TEST_INLINE_PAGE(0));
+
+	//
+	// The patch of a hook with a detour jumps to a stub, which counts the
+	// call and jumps on to the detour.  Everything else on the page is the
+	// original, which the guest still reads.
+	//
+	code = (PUCHAR)shadow + SHV_TEST_INLINE_DETOUR_OFFSET;
+	stub = (PUCHAR)*(ULONG64 UNALIGNED *)&code[6];
+
+	SHV_TEST_CHECK(code[0] == 0xff && code[1] == 0x25 && *(ULONG UNALIGNED *)&code[2] == 0);
+	SHV_TEST_CHECK(RtlCompareMemory((PUCHAR)shadow, memory + PAGE_SIZE, SHV_TEST_INLINE_DETOUR_OFFSET) == SHV_TEST_INLINE_DETOUR_OFFSET);
+	SHV_TEST_CHECK(RtlCompareMemory(code + SHV_HOOK_PATCH_LENGTH,
+		memory + PAGE_SIZE + SHV_TEST_INLINE_DETOUR_OFFSET + SHV_HOOK_PATCH_LENGTH,
+		PAGE_SIZE - SHV_TEST_INLINE_DETOUR_OFFSET - SHV_HOOK_PATCH_LENGTH) ==
+		PAGE_SIZE - SHV_TEST_INLINE_DETOUR_OFFSET - SHV_HOOK_PATCH_LENGTH);
+	SHV_TEST_CHECK(memory[PAGE_SIZE + SHV_TEST_INLINE_DETOUR_OFFSET] == (UCHAR)((PAGE_SIZE + SHV_TEST_INLINE_DETOUR_OFFSET) * 7 + 3));
+
+	SHV_TEST_CHECK(stub[0] == 0xf0 && stub[1] == 0x48 && stub[2] == 0xff && stub[3] == 0x05);
+	SHV_TEST_CHECK(stub[8] == 0xff && stub[9] == 0x25 && *(ULONG UNALIGNED *)&stub[10] == 0);
+	SHV_TEST_CHECK(*(PVOID UNALIGNED *)&stub[14] == SHV_TEST_INLINE_DETOUR);
+
+	SHV_TEST_CHECK_SUCCESS(ShvVmxHookGetHits(ids[0], &hits));
+	SHV_TEST_CHECK(hits == 0);
+
+	(*(volatile LONG64 *)(stub + 8 + *(LONG UNALIGNED *)&stub[4]))++;
+
+	SHV_TEST_CHECK_SUCCESS(ShvVmxHookGetHits(ids[0], &hits));
+	SHV_TEST_CHECK(hits == 1);
+
+	//
+	// A raw patch goes in as it is, and counts nothing.
+	//
+	SHV_TEST_CHECK(ShvTestInlineAccess(SHV_EPT_DEFAULT_VIEW, SHV_TEST_INLINE_PAGE(2), &other) == VMX_EPT_ACCESS_EXECUTE);
+	SHV_TEST_CHECK(RtlCompareMemory((PUCHAR)other + SHV_TEST_INLINE_PATCH_OFFSET, ShvTestInlinePatch, sizeof(ShvTestInlinePatch)) == sizeof(ShvTestInlinePatch));
+	SHV_TEST_CHECK(((PUCHAR)other)[SHV_TEST_INLINE_PATCH_OFFSET + sizeof(ShvTestInlinePatch)] == memory[2 * PAGE_SIZE + SHV_TEST_INLINE_PATCH_OFFSET + sizeof(ShvTestInlinePatch)]);
+
+	SHV_TEST_CHECK(ShvVmxHookGetHits(ids[1], &hits) == STATUS_NOT_SUPPORTED);
+	SHV_TEST_CHECK(ShvVmxHookGetHits(ids[1] + 1, &hits) == STATUS_NOT_FOUND);
+
+	//
+	// A read of a hooked page by an instruction elsewhere is stepped in the
+	// view of the originals, and the step brings the VP back.  Only the
+	// hook's own step is claimed.
+	//
+	__stosb((PUCHAR)&vpState, 0, sizeof(vpState));
+
+	ShvTestInlineFault(SHV_TEST_INLINE_PAGE(0) + 0x40, SHV_TEST_INLINE_PAGE(1) + 0x80, VMX_EPT_ACCESS_READ);
+
+	SHV_TEST_CHECK(ShvTestInlineInView(dataView));
+	SHV_TEST_CHECK(ShvTestInlineTrapping());
+
+	SHV_TEST_CHECK(ShvVmxHookHandleStep(&vpState));
+	SHV_TEST_CHECK(ShvTestInlineInView(SHV_EPT_DEFAULT_VIEW));
+	SHV_TEST_CHECK(!ShvTestInlineTrapping());
+	SHV_TEST_CHECK(!ShvVmxHookHandleStep(&vpState));
+
+	ShvVmxHookQuery(&statistics);
+	SHV_TEST_CHECK(statistics.DataSwitches == 1);
+	SHV_TEST_CHECK(statistics.Steps == 0);
+
+	//
+	// An instruction on a hooked page, or one that runs into one, can't be
+	// stepped in the view of the originals, which can't execute it.
+	//
+	ShvTestInlineFault(SHV_TEST_INLINE_PAGE(2) + 0x40, SHV_TEST_INLINE_PAGE(1) + 0x80, VMX_EPT_ACCESS_WRITE);
+
+	SHV_TEST_CHECK(ShvTestInlineInView(stepView));
+	SHV_TEST_CHECK(ShvTestInlineTrapping());
+	SHV_TEST_CHECK(ShvVmxHookHandleStep(&vpState));
+	SHV_TEST_CHECK(ShvTestInlineInView(SHV_EPT_DEFAULT_VIEW));
+
+	ShvTestInlineFault(SHV_TEST_INLINE_PAGE(1) - 4, SHV_TEST_INLINE_PAGE(2), VMX_EPT_ACCESS_READ);
+
+	SHV_TEST_CHECK(ShvTestInlineInView(stepView));
+	SHV_TEST_CHECK(ShvVmxHookHandleStep(&vpState));
+
+	ShvVmxHookQuery(&statistics);
+	SHV_TEST_CHECK(statistics.DataSwitches == 1);
+	SHV_TEST_CHECK(statistics.Steps == 2);
+
+	//
+	// Executing a hooked page is never withheld, so a violation that does
+	// was someone else's, and so are those on pages that aren't hooked.
+	//
+	vpState.GuestRip = SHV_TEST_INLINE_PAGE(0);
+
+	SHV_TEST_CHECK(!ShvTestFilterHook(&vpState, SHV_TEST_INLINE_PAGE(1), VMX_EPT_ACCESS_EXECUTE));
+	SHV_TEST_CHECK(!ShvTestFilterHook(&vpState, SHV_TEST_INLINE_PAGE(1), VMX_EPT_ACCESS_READ | VMX_EPT_ACCESS_EXECUTE));
+	SHV_TEST_CHECK(!ShvTestFilterHook(&vpState, SHV_TEST_INLINE_PAGE(1), 0));
+	SHV_TEST_CHECK(!ShvTestFilterHook(&vpState, SHV_TEST_INLINE_PAGE(3), VMX_EPT_ACCESS_WRITE));
+	SHV_TEST_CHECK(!ShvTestInlineTrapping());
+
+	//
+	// Another hook on a page gives it a new shadow with both patches, and
+	// leaves the other page's alone.  Removing hooks is all or nothing.
+	//
+	requests[0].Target = memory + PAGE_SIZE + SHV_TEST_INLINE_DETOUR_OFFSET + SHV_HOOK_PATCH_LENGTH - 1;
+	requests[0].Detour = NULL;
+	requests[0].Patch = ShvTestInlineSecond;
+	requests[0].PatchLength = sizeof(ShvTestInlineSecond);
+
+	SHV_TEST_CHECK(ShvVmxHookInstall(requests, 1, &second) == STATUS_CONFLICTING_ADDRESSES);
+
+	requests[0].Target = memory + PAGE_SIZE + SHV_TEST_INLINE_SECOND_OFFSET;
+
+	SHV_TEST_CHECK_SUCCESS(ShvVmxHookInstall(requests, 1, &second));
+	SHV_TEST_CHECK(second == ids[1] + 1);
+
+	SHV_TEST_CHECK(ShvTestInlineAccess(SHV_EPT_DEFAULT_VIEW, SHV_TEST_INLINE_PAGE(1), &hpa) == VMX_EPT_ACCESS_EXECUTE);
+	SHV_TEST_CHECK(hpa != shadow && hpa != SHV_TEST_INLINE_PAGE(1));
+	shadow = hpa;
+
+	SHV_TEST_CHECK(((PUCHAR)shadow)[SHV_TEST_INLINE_DETOUR_OFFSET] == 0xff);
+	SHV_TEST_CHECK(RtlCompareMemory((PUCHAR)shadow + SHV_TEST_INLINE_SECOND_OFFSET, ShvTestInlineSecond, sizeof(ShvTestInlineSecond)) == sizeof(ShvTestInlineSecond));
+
+	SHV_TEST_CHECK(ShvTestInlineAccess(SHV_EPT_DEFAULT_VIEW, SHV_TEST_INLINE_PAGE(2), &hpa) == VMX_EPT_ACCESS_EXECUTE);
+	SHV_TEST_CHECK(hpa == other);
+	SHV_TEST_CHECK(RtlCompareMemory((PUCHAR)other, memory + 2 * PAGE_SIZE, SHV_TEST_INLINE_PATCH_OFFSET) == SHV_TEST_INLINE_PATCH_OFFSET);
+	SHV_TEST_CHECK(RtlCompareMemory((PUCHAR)other + SHV_TEST_INLINE_PATCH_OFFSET, ShvTestInlinePatch, sizeof(ShvTestInlinePatch)) == sizeof(ShvTestInlinePatch));
+
+	ShvVmxHookQuery(&statistics);
+	SHV_TEST_CHECK(statistics.Hooks == 3);
+	SHV_TEST_CHECK(statistics.Pages == 2);
+
+	ids[1] = second + 1;
+	SHV_TEST_CHECK(ShvVmxHookRemove(ids, 2) == STATUS_NOT_FOUND);
+	SHV_TEST_CHECK_SUCCESS(ShvVmxHookGetHits(ids[0], &hits));
+
+	//
+	// Removing the detour takes its patch out of a new shadow, and removing
+	// the last hook on the page joins it again, in every view.
+	//
+	SHV_TEST_CHECK_SUCCESS(ShvVmxHookRemove(ids, 1));
+	SHV_TEST_CHECK(ShvVmxHookGetHits(ids[0], &hits) == STATUS_NOT_FOUND);
+
+	SHV_TEST_CHECK(ShvTestInlineAccess(SHV_EPT_DEFAULT_VIEW, SHV_TEST_INLINE_PAGE(1), &hpa) == VMX_EPT_ACCESS_EXECUTE);
+	SHV_TEST_CHECK(hpa != shadow && hpa != SHV_TEST_INLINE_PAGE(1));
+	SHV_TEST_CHECK(((PUCHAR)hpa)[SHV_TEST_INLINE_DETOUR_OFFSET] == memory[PAGE_SIZE + SHV_TEST_INLINE_DETOUR_OFFSET]);
+	SHV_TEST_CHECK(((PUCHAR)hpa)[SHV_TEST_INLINE_SECOND_OFFSET] == ShvTestInlineSecond[0]);
+
+	ids[0] = second;
+	ids[1] = second;
+	SHV_TEST_CHECK_SUCCESS(ShvVmxHookRemove(ids, 2));
+
+	SHV_TEST_CHECK(ShvTestInlineAccess(SHV_EPT_DEFAULT_VIEW, SHV_TEST_INLINE_PAGE(1), &hpa) == VMX_EPT_ACCESS_RWX);
+	SHV_TEST_CHECK(hpa == SHV_TEST_INLINE_PAGE(1));
+	SHV_TEST_CHECK(ShvTestInlineAccess(dataView, SHV_TEST_INLINE_PAGE(1), &hpa) == VMX_EPT_ACCESS_RWX);
+
+	ShvVmxHookQuery(&statistics);
+	SHV_TEST_CHECK(statistics.Hooks == 1);
+	SHV_TEST_CHECK(statistics.Pages == 1);
+
+	//
+	// Unloading drops the hooks that are left, and joins their pages.
+	//
+	ShvTestStopHook();
+
+	SHV_TEST_CHECK(ShvTestInlineAccess(SHV_EPT_DEFAULT_VIEW, SHV_TEST_INLINE_PAGE(2), &hpa) == VMX_EPT_ACCESS_RWX);
+	SHV_TEST_CHECK(hpa == SHV_TEST_INLINE_PAGE(2));
+	SHV_TEST_CHECK(ShvVmxHookInstall(requests, 1, ids) == STATUS_HV_NOT_PRESENT);
+
+	ShvVmxGuestCleanup();
+	ShvTestStopEpt();
+
+Free:
+	ShvTestSetGuestMemory(0, NULL, 0);
+	ShvTestPlatFreePages(memory, SHV_TEST_INLINE_SIZE);
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+static ULONG
+ShvTestInlineAccess(
+	_In_ ULONG View,
+	_In_ ULONG64 Gpa,
+	_Out_ PULONG64 Hpa
+)
+{
+	ULONG64 entry;
+	ULONG level;
+
+	//
+	// What a view allows on a page, and the frame it maps the page to.
+	// Split pages always have a 4 KiB leaf.
+	//
+	entry = ShvTestLookupEptView(View, Gpa, &level);
+
+	*Hpa = (level == 1) ? (entry & SHV_EPT_PFN_MASK) : Gpa;
+
+	return (ULONG)entry & VMX_EPT_ACCESS_RWX;
+}
+
+static VOID
+ShvTestInlineFault(
+	_In_ ULONG64 Rip,
+	_In_ ULONG64 Gpa,
+	_In_ ULONG Access
+)
+{
+	SHV_VP_STATE vpState;
+	KIRQL irql;
+
+	//
+	// An instruction at Rip accesses a page in the default view, and takes
+	// a violation, in root mode with interrupts off.
+	//
+	__stosb((PUCHAR)&vpState, 0, sizeof(vpState));
+	vpState.GuestRip = Rip;
+
+	__vmx_vmwrite(GUEST_PHYSICAL_ADDRESS, Gpa);
+	__vmx_vmwrite(EXIT_QUALIFICATION, Access);
+
+	KeRaiseIrql(HIGH_LEVEL, &irql);
+	ShvVmxEptHandleViolation(&vpState);
+	KeLowerIrql(irql);
+}
+
+static BOOLEAN
+ShvTestInlineInView(
+	_In_ ULONG View
+)
+{
+	ULONG64 eptp;
+
+	__vmx_vmread(EPT_POINTER, (PSIZE_T)&eptp);
+
+	return (eptp == ShvTestGetEptViewEptp(View));
+}
+
+static BOOLEAN
+ShvTestInlineTrapping(
+	VOID
+)
+{
+	SIZE_T control;
+
+	//
+	// Whether the guest exits again after its next instruction.
+	//
+	__vmx_vmread(CPU_BASED_VM_EXEC_CONTROL, &control);
+
+	return ((control & CPU_BASED_MONITOR_TRAP_FLAG) != 0);
+}
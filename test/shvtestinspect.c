@@ -0,0 +1,438 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvtestinspect.c
+
+Abstract:
+
+	This module tests the EPT inspector against a hierarchy laid out by
+	hand and against the live identity map, and uses it to predict how much
+	memory the identity map takes for a given amount of RAM, page size and
+	processor count, and how long an inspection takes.
+
+Author:
+
+	agent (@agent) 16-Oct-2026 - Initial version
+
+Environment:
+
+	User mode only.
+
+--*/
+
+#include "shvtest.h"
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+#define SHV_TEST_MB                     (1024ULL * 1024)
+#define SHV_TEST_TB                     (1024 * SHV_TEST_GB)
+
+//
+// The pages the hand made hierarchy is built in, and what goes in them.
+// PFNs are indices into the pages, which is all the inspector needs.
+//
+#define SHV_TEST_INSPECT_PAGES          (8)
+
+#define SHV_TEST_INSPECT_TABLE(index)   (((ULONG64)(index) << PAGE_SHIFT) | VMX_EPT_ACCESS_RWX)
+#define SHV_TEST_INSPECT_LEAF(address, type, access) \
+	((address) | ((ULONG64)(type) << 3) | (access))
+
+//
+// How long each inspection the benchmark times is repeated for.
+//
+#define SHV_TEST_INSPECT_TIME           (200 * 1000 * 1000ULL)
+
+// ===========================================================================
+//
+// LOCAL TYPES
+//
+// ===========================================================================
+
+typedef struct _SHV_TEST_INSPECT_MODE {
+	PCSTR Name;
+	ULONG64 Capabilities;
+	ULONG64 MaxRam;
+} SHV_TEST_INSPECT_MODE, *PSHV_TEST_INSPECT_MODE;
+
+typedef struct _SHV_TEST_INSPECT_MACHINE {
+	ULONG Processors;
+	ULONG Nodes;
+} SHV_TEST_INSPECT_MACHINE, *PSHV_TEST_INSPECT_MACHINE;
+
+// ===========================================================================
+//
+// LOCAL DATA
+//
+// ===========================================================================
+
+static const SHV_TEST_INSPECT_MODE ShvTestInspectModes[] = {
+	{ "4 KiB", SHV_TEST_EPT_CAPS_4KB, 64 * SHV_TEST_GB },
+	{ "2 MiB", SHV_TEST_EPT_CAPS_2MB, 2 * SHV_TEST_TB },
+	{ "1 GiB", SHV_TEST_EPT_CAPS_1GB, 2 * SHV_TEST_TB },
+};
+
+static const ULONG64 ShvTestInspectRamSizes[] = {
+	16 * SHV_TEST_GB,
+	64 * SHV_TEST_GB,
+	256 * SHV_TEST_GB,
+	2 * SHV_TEST_TB,
+};
+
+//
+// With replication, every node gets a copy of the identity map, so the
+// processor count matters through the nodes they are spread over.
+//
+static const SHV_TEST_INSPECT_MACHINE ShvTestInspectMachines[] = {
+	{ 8, 1 },
+	{ 32, 2 },
+	{ 64, 4 },
+};
+
+// ===========================================================================
+//
+// LOCAL PROTOTYPES
+//
+// ===========================================================================
+
+static SHV_EPT_TRANSLATE ShvTestInspectTranslate;
+
+static PVMX_EPT_ENTRY
+ShvTestInspectBuild(
+	VOID
+);
+
+static VOID
+ShvTestInspectFault(
+	_In_ ULONG64 Gpa
+);
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+VOID
+ShvTestInspect(
+	VOID
+)
+{
+	SHV_EPT_INSPECTION inspection;
+	PVMX_EPT_ENTRY pages;
+	ULONG64 mapped, tablesInUse;
+	ULONG exhausted;
+
+	//
+	// The hand made hierarchy, with every large page size supported.
+	//
+	pages = ShvTestInspectBuild();
+	if (!SHV_TEST_CHECK(pages != NULL))
+	{
+		return;
+	}
+
+	ShvVmxEptInspectHierarchy(pages, ShvTestInspectTranslate, pages, SHV_TEST_EPT_CAPS_1GB, VMX_EPT_SUPPRESS_VE, &inspection);
+
+	mapped = 1040 * PAGE_SIZE + 1021 * VMX_EPT_PAGE_SIZE_2MB + 3 * VMX_EPT_PAGE_SIZE_1GB;
+
+	SHV_TEST_CHECK(inspection.Tables[4] == 1);
+	SHV_TEST_CHECK(inspection.Tables[3] == 2);
+	SHV_TEST_CHECK(inspection.Tables[2] == 2);
+	SHV_TEST_CHECK(inspection.Tables[1] == 3);
+	SHV_TEST_CHECK(inspection.TableBytes == SHV_TEST_INSPECT_PAGES * PAGE_SIZE);
+	SHV_TEST_CHECK(inspection.Leaves[1] == 1040);
+	SHV_TEST_CHECK(inspection.Leaves[2] == 1021);
+	SHV_TEST_CHECK(inspection.Leaves[3] == 3);
+	SHV_TEST_CHECK(inspection.MappedBytes == mapped);
+	SHV_TEST_CHECK(inspection.BytesByType[Uncacheable] == VMX_EPT_PAGE_SIZE_1GB + PAGE_SIZE);
+	SHV_TEST_CHECK(inspection.BytesByType[WriteBack] == mapped - VMX_EPT_PAGE_SIZE_1GB - PAGE_SIZE);
+	SHV_TEST_CHECK(inspection.BytesByAccess[VMX_EPT_ACCESS_READ] == VMX_EPT_PAGE_SIZE_2MB);
+	SHV_TEST_CHECK(inspection.BytesByAccess[VMX_EPT_ACCESS_READ | VMX_EPT_ACCESS_WRITE] == VMX_EPT_PAGE_SIZE_1GB);
+	SHV_TEST_CHECK(inspection.BytesByAccess[VMX_EPT_ACCESS_RWX] == mapped - VMX_EPT_PAGE_SIZE_1GB - VMX_EPT_PAGE_SIZE_2MB);
+
+	//
+	// The PT at 0 and the PD at 2 GiB could each be one large page, and are
+	// listed in the order the walk finds them.
+	//
+	SHV_TEST_CHECK(inspection.Collapsible[1] == 1);
+	SHV_TEST_CHECK(inspection.Collapsible[2] == 1);
+	SHV_TEST_CHECK(inspection.CollapsibleListed == 2);
+	SHV_TEST_CHECK(inspection.CollapsibleRegions[0].Base == 0);
+	SHV_TEST_CHECK(inspection.CollapsibleRegions[0].Size == VMX_EPT_PAGE_SIZE_2MB);
+	SHV_TEST_CHECK(inspection.CollapsibleRegions[1].Base == 2 * SHV_TEST_GB);
+	SHV_TEST_CHECK(inspection.CollapsibleRegions[1].Size == VMX_EPT_PAGE_SIZE_1GB);
+
+	//
+	// Tables can only be collapsed into pages the processor supports.
+	//
+	ShvVmxEptInspectHierarchy(pages, ShvTestInspectTranslate, pages, SHV_TEST_EPT_CAPS_2MB, VMX_EPT_SUPPRESS_VE, &inspection);
+
+	SHV_TEST_CHECK(inspection.Collapsible[1] == 1);
+	SHV_TEST_CHECK(inspection.Collapsible[2] == 0);
+	SHV_TEST_CHECK(inspection.CollapsibleListed == 1);
+
+	ShvVmxEptInspectHierarchy(pages, ShvTestInspectTranslate, pages, SHV_TEST_EPT_CAPS_4KB, VMX_EPT_SUPPRESS_VE, &inspection);
+
+	SHV_TEST_CHECK(inspection.Collapsible[1] == 0);
+	SHV_TEST_CHECK(inspection.CollapsibleListed == 0);
+	SHV_TEST_CHECK(inspection.MappedBytes == mapped);
+
+	ShvTestPlatFree(pages);
+
+	//
+	// The live identity map, populated on demand.  The seed below 1 MiB is
+	// not a fault, and every region a violation maps is.  Only the most
+	// recent regions are listed.
+	//
+	ShvTestConfigureEpt(TRUE, FALSE, FALSE);
+	ShvTestSetMsr(MSR_IA32_VMX_EPT_VPID_CAP, SHV_TEST_EPT_CAPS_4KB);
+
+	if (!SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+	{
+		return;
+	}
+
+	SHV_TEST_CHECK_SUCCESS(ShvTestReserveEpt(256));
+
+	ShvVmxEptInspect(&inspection);
+	ShvTestQueryEptArena(&tablesInUse, &exhausted);
+
+	SHV_TEST_CHECK(inspection.OnDemandFaults == 0);
+	SHV_TEST_CHECK(inspection.OnDemandListed == 0);
+	SHV_TEST_CHECK(inspection.MappedBytes == SHV_TEST_MB);
+	SHV_TEST_CHECK(inspection.ArenaBytes >= inspection.TableBytes);
+	SHV_TEST_CHECK(tablesInUse * PAGE_SIZE == inspection.TableBytes);
+
+	ShvTestInspectFault(8 * SHV_TEST_GB + 0x3000);
+	ShvTestInspectFault(8 * SHV_TEST_GB + 0x5000);
+	ShvTestInspectFault(9 * SHV_TEST_GB + VMX_EPT_PAGE_SIZE_2MB);
+
+	ShvVmxEptInspect(&inspection);
+
+	SHV_TEST_CHECK(inspection.OnDemandFaults == 2);
+	SHV_TEST_CHECK(inspection.OnDemandBytes == 2 * VMX_EPT_PAGE_SIZE_2MB);
+	SHV_TEST_CHECK(inspection.OnDemandListed == 2);
+	SHV_TEST_CHECK(inspection.OnDemandRegions[0].Base == 8 * SHV_TEST_GB);
+	SHV_TEST_CHECK(inspection.OnDemandRegions[1].Base == 9 * SHV_TEST_GB + VMX_EPT_PAGE_SIZE_2MB);
+	SHV_TEST_CHECK(inspection.OnDemandRegions[1].Size == VMX_EPT_PAGE_SIZE_2MB);
+	SHV_TEST_CHECK(inspection.MappedBytes == SHV_TEST_MB + 2 * VMX_EPT_PAGE_SIZE_2MB);
+
+	for (ULONG i = 0; i < SHV_EPT_INSPECT_REGIONS; i++)
+	{
+		ShvTestInspectFault(16 * SHV_TEST_GB + i * VMX_EPT_PAGE_SIZE_2MB);
+	}
+
+	ShvVmxEptInspect(&inspection);
+
+	SHV_TEST_CHECK(inspection.OnDemandFaults == SHV_EPT_INSPECT_REGIONS + 2);
+	SHV_TEST_CHECK(inspection.OnDemandListed == SHV_EPT_INSPECT_REGIONS);
+	SHV_TEST_CHECK(inspection.OnDemandRegions[0].Base == 16 * SHV_TEST_GB + (SHV_EPT_INSPECT_REGIONS - 2) * VMX_EPT_PAGE_SIZE_2MB);
+	SHV_TEST_CHECK(inspection.OnDemandRegions[2].Base == 16 * SHV_TEST_GB);
+
+	ShvTestStopEpt();
+}
+
+VOID
+ShvTestInspectBenchmark(
+	VOID
+)
+{
+	SHV_EPT_INSPECTION inspection;
+	ULONG64 start, elapsed, tablesInUse;
+	ULONG exhausted, walks;
+
+	//
+	// Build the identity map of each machine with a replica on every node,
+	// and report what the default view and all of them take.  The walk is
+	// what a periodic inspection costs.
+	//
+	ShvTestConfigureEpt(FALSE, FALSE, TRUE);
+
+	ShvTestPrint("%-6s %8s %8s %12s %12s %12s %10s\n",
+		"pages", "RAM", "LPs", "view KiB", "total KiB", "arena KiB", "walk us");
+
+	for (ULONG m = 0; m < RTL_NUMBER_OF(ShvTestInspectModes); m++)
+	{
+		for (ULONG r = 0; r < RTL_NUMBER_OF(ShvTestInspectRamSizes); r++)
+		{
+			if (ShvTestInspectRamSizes[r] > ShvTestInspectModes[m].MaxRam)
+			{
+				continue;
+			}
+
+			for (ULONG c = 0; c < RTL_NUMBER_OF(ShvTestInspectMachines); c++)
+			{
+				ShvTestSetTypicalMemoryMap(ShvTestInspectRamSizes[r]);
+				ShvTestSetProcessors(ShvTestInspectMachines[c].Processors, ShvTestInspectMachines[c].Nodes);
+				ShvTestSetMsr(MSR_IA32_VMX_EPT_VPID_CAP, ShvTestInspectModes[m].Capabilities);
+
+				if (!SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+				{
+					return;
+				}
+
+				ShvTestQueryEptArena(&tablesInUse, &exhausted);
+
+				walks = 0;
+				start = ShvTestNow();
+
+				do
+				{
+					ShvVmxEptInspect(&inspection);
+					walks++;
+					elapsed = ShvTestNow() - start;
+				} while (elapsed < SHV_TEST_INSPECT_TIME);
+
+				ShvTestPrint("%-6s %5llu GiB %4u/%-3u %12llu %12llu %12llu %10.1f\n",
+					ShvTestInspectModes[m].Name,
+					ShvTestInspectRamSizes[r] / SHV_TEST_GB,
+					ShvTestInspectMachines[c].Processors,
+					ShvTestInspectMachines[c].Nodes,
+					inspection.TableBytes / 1024,
+					tablesInUse * PAGE_SIZE / 1024,
+					inspection.ArenaBytes / 1024,
+					elapsed / 1e3 / walks);
+
+				ShvTestStopEpt();
+			}
+		}
+	}
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+static PVOID
+ShvTestInspectTranslate(
+	_In_opt_ PVOID Context,
+	_In_ ULONG64 Pfn
+)
+{
+	NT_ASSERT(Pfn < SHV_TEST_INSPECT_PAGES);
+
+	return (PUCHAR)Context + Pfn * PAGE_SIZE;
+}
+
+static PVMX_EPT_ENTRY
+ShvTestInspectBuild(
+	VOID
+)
+{
+	PULONG64 pml4, pdpt, pdptHigh, pd, pdLarge, pt, ptMixed, ptSparse;
+	PULONG64 pages;
+	ULONG64 entries;
+
+	pages = (PULONG64)ShvTestPlatAllocate(SHV_TEST_INSPECT_PAGES * PAGE_SIZE, PAGE_SIZE);
+	if (pages == NULL)
+	{
+		return NULL;
+	}
+
+	//
+	// Empty entries suppress #VE, as they do when it is enabled.
+	//
+	for (ULONG i = 0; i < SHV_TEST_INSPECT_PAGES * PAGE_SIZE / sizeof(ULONG64); i++)
+	{
+		pages[i] = VMX_EPT_SUPPRESS_VE;
+	}
+
+	entries = PAGE_SIZE / sizeof(ULONG64);
+
+	pml4 = &pages[0 * entries];
+	pdpt = &pages[1 * entries];
+	pd = &pages[2 * entries];
+	pdLarge = &pages[3 * entries];
+	pt = &pages[4 * entries];
+	pdptHigh = &pages[5 * entries];
+	ptMixed = &pages[6 * entries];
+	ptSparse = &pages[7 * entries];
+
+	//
+	// The first 512 GiB: a PD for the first gigabyte, a 1 GiB page at 1 GiB,
+	// a PD of 2 MiB pages at 2 GiB that could be one 1 GiB page, and a read
+	// and write only UC 1 GiB page at 3 GiB.
+	//
+	pml4[0] = SHV_TEST_INSPECT_TABLE(1);
+	pdpt[0] = SHV_TEST_INSPECT_TABLE(2);
+	pdpt[1] = SHV_TEST_INSPECT_LEAF(SHV_TEST_GB, WriteBack, VMX_EPT_ACCESS_RWX) | SHV_EPT_LARGE_PAGE;
+	pdpt[2] = SHV_TEST_INSPECT_TABLE(3);
+	pdpt[3] = SHV_TEST_INSPECT_LEAF(3 * SHV_TEST_GB, Uncacheable, VMX_EPT_ACCESS_READ | VMX_EPT_ACCESS_WRITE) | SHV_EPT_LARGE_PAGE;
+
+	for (ULONG i = 0; i < entries; i++)
+	{
+		pdLarge[i] = SHV_TEST_INSPECT_LEAF(2 * SHV_TEST_GB + i * VMX_EPT_PAGE_SIZE_2MB, WriteBack, VMX_EPT_ACCESS_RWX) |
+			SHV_EPT_LARGE_PAGE;
+	}
+
+	//
+	// The first gigabyte: a PT at 0 that could be one 2 MiB page, whatever
+	// its accessed and dirty flags, one that can't because a page is UC, a
+	// read only 2 MiB page, and a PT with only a few pages in it.  The rest
+	// of the PD is 2 MiB pages.
+	//
+	pd[0] = SHV_TEST_INSPECT_TABLE(4);
+	pd[1] = SHV_TEST_INSPECT_TABLE(6);
+	pd[2] = SHV_TEST_INSPECT_LEAF(2 * VMX_EPT_PAGE_SIZE_2MB, WriteBack, VMX_EPT_ACCESS_READ) | SHV_EPT_LARGE_PAGE;
+	pd[3] = SHV_TEST_INSPECT_TABLE(7);
+
+	for (ULONG i = 4; i < entries; i++)
+	{
+		pd[i] = SHV_TEST_INSPECT_LEAF(i * VMX_EPT_PAGE_SIZE_2MB, WriteBack, VMX_EPT_ACCESS_RWX) | SHV_EPT_LARGE_PAGE;
+	}
+
+	for (ULONG i = 0; i < entries; i++)
+	{
+		pt[i] = SHV_TEST_INSPECT_LEAF(i * PAGE_SIZE, WriteBack, VMX_EPT_ACCESS_RWX);
+		ptMixed[i] = SHV_TEST_INSPECT_LEAF(VMX_EPT_PAGE_SIZE_2MB + i * PAGE_SIZE, WriteBack, VMX_EPT_ACCESS_RWX);
+	}
+
+	pt[3] |= VMX_EPT_ACCESSED;
+	pt[9] |= VMX_EPT_ACCESSED | VMX_EPT_DIRTY;
+	ptMixed[7] = SHV_TEST_INSPECT_LEAF(VMX_EPT_PAGE_SIZE_2MB + 7 * PAGE_SIZE, Uncacheable, VMX_EPT_ACCESS_RWX);
+
+	for (ULONG i = 0; i < 16; i++)
+	{
+		ptSparse[i] = SHV_TEST_INSPECT_LEAF(3 * VMX_EPT_PAGE_SIZE_2MB + i * PAGE_SIZE, WriteBack, VMX_EPT_ACCESS_RWX);
+	}
+
+	//
+	// And a 1 GiB page at 512 GiB, under a second PDPT.
+	//
+	pml4[1] = SHV_TEST_INSPECT_TABLE(5);
+	pdptHigh[0] = SHV_TEST_INSPECT_LEAF(512 * SHV_TEST_GB, WriteBack, VMX_EPT_ACCESS_RWX) | SHV_EPT_LARGE_PAGE;
+
+	return (PVMX_EPT_ENTRY)pages;
+}
+
+static VOID
+ShvTestInspectFault(
+	_In_ ULONG64 Gpa
+)
+{
+	SHV_VP_STATE vpState;
+	KIRQL irql;
+
+	//
+	// A read of an address that isn't mapped yet, on the current VP.
+	//
+	__stosb((PUCHAR)&vpState, 0, sizeof(vpState));
+
+	KeRaiseIrql(HIGH_LEVEL, &irql);
+
+	__vmx_vmwrite(GUEST_PHYSICAL_ADDRESS, Gpa);
+	__vmx_vmwrite(EXIT_QUALIFICATION, VMX_EPT_ACCESS_READ);
+
+	ShvVmxEptHandleViolation(&vpState);
+
+	KeLowerIrql(irql);
+}
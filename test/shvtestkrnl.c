@@ -0,0 +1,1898 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvtestkrnl.c
+
+Abstract:
+
+	This module implements the simulated machine of the test harness and
+	the kernel routines the hypervisor modules call, on top of it.  Every
+	thread of the harness runs as one LP of the machine, with the VMCS,
+	IRQL and NUMA node of that LP.
+
+Author:
+
+	agent (@agent) 16-Oct-2026 - Initial version
+
+Environment:
+
+	User mode only.
+
+--*/
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include "shvtest.h"
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// How many MSRs and VMCS fields the simulated machine keeps values for,
+// and how many files the in-memory file system can hold.
+//
+#define SHV_TEST_MAX_MSRS               (64)
+#define SHV_TEST_MAX_VMCS_FIELDS        (64)
+#define SHV_TEST_MAX_FILES              (4)
+
+//
+// The physical address width the simulated processor reports.
+//
+#define SHV_TEST_PHYSICAL_ADDRESS_BITS  (46)
+
+//
+// Contiguous allocations keep their size in the page in front of them, so
+// that they can be freed with just their address.
+//
+#define SHV_TEST_CONTIGUOUS_HEADER      PAGE_SIZE
+
+//
+// The host page tables the LPs run on only map the windows reserved with
+// MmAllocateMappingAddress, a page each, and only one per LP.  These are
+// the bits of their entries, and how many tables there can be.
+//
+#define SHV_TEST_HOST_TABLES            (16)
+#define SHV_TEST_HOST_PRESENT           (1ULL << 0)
+#define SHV_TEST_HOST_TABLE_ENTRY       (0x3ULL)
+#define SHV_TEST_HOST_ADDRESS_MASK      (0x000ffffffffff000ULL)
+#define SHV_TEST_HOST_INDEX(va, level)  (((ULONG64)(va) >> (PAGE_SHIFT + 9 * ((level) - 1))) & 0x1ff)
+
+// ===========================================================================
+//
+// LOCAL TYPES
+//
+// ===========================================================================
+
+typedef struct _SHV_TEST_REGISTER {
+	ULONG64 Index;
+	ULONG64 Value;
+} SHV_TEST_REGISTER, *PSHV_TEST_REGISTER;
+
+typedef struct _SHV_TEST_VMCS {
+	ULONG Count;
+	SHV_TEST_REGISTER Fields[SHV_TEST_MAX_VMCS_FIELDS];
+} SHV_TEST_VMCS, *PSHV_TEST_VMCS;
+
+typedef struct _SHV_TEST_FILE {
+	WCHAR Path[128];
+	PUCHAR Data;
+	ULONG Size;
+	BOOLEAN Used;
+} SHV_TEST_FILE, *PSHV_TEST_FILE;
+
+typedef struct _SHV_TEST_HANDLE {
+	PSHV_TEST_FILE File;
+	ULONG Position;
+} SHV_TEST_HANDLE, *PSHV_TEST_HANDLE;
+
+typedef struct _SHV_TEST_DPC_CALL {
+	PKDEFERRED_ROUTINE Routine;
+	PVOID Context;
+	volatile LONG Arrived;
+	volatile LONG Generation;
+} SHV_TEST_DPC_CALL, *PSHV_TEST_DPC_CALL;
+
+typedef struct _SHV_TEST_WORKER_CALL {
+	PSHV_TEST_WORKER Worker;
+	PVOID Context;
+} SHV_TEST_WORKER_CALL, *PSHV_TEST_WORKER_CALL;
+
+//
+// A reserved window, the PTE that maps it, and the page of guest memory
+// that the window currently shows, if any.
+//
+typedef struct _SHV_TEST_WINDOW {
+	PUCHAR Va;
+	volatile ULONG64 *Pte;
+	PUCHAR Frame;
+} SHV_TEST_WINDOW, *PSHV_TEST_WINDOW;
+
+// ===========================================================================
+//
+// LOCAL DATA
+//
+// ===========================================================================
+
+PSHV_GLOBAL_DATA ShvGlobalData = NULL;
+
+//
+// What kind of object a handle refers to is never checked, but threads
+// have a type to refer to.
+//
+static POBJECT_TYPE ShvTestThreadType = NULL;
+POBJECT_TYPE *PsThreadType = &ShvTestThreadType;
+
+//
+// The simulated machine.
+//
+static ULONG ShvTestProcessorCount = 1;
+static ULONG ShvTestNodeCount = 1;
+static ULONG ShvTestRangeCount = 0;
+static PHYSICAL_MEMORY_RANGE ShvTestRanges[SHV_TEST_MAX_RANGES];
+static ULONG ShvTestMsrCount = 0;
+static SHV_TEST_REGISTER ShvTestMsrs[SHV_TEST_MAX_MSRS];
+static SHV_TEST_VMCS ShvTestVmcs[SHV_TEST_MAX_PROCESSORS];
+static volatile LONG64 ShvTestInvepts[SHV_TEST_MAX_PROCESSORS];
+static SHV_TEST_FILE ShvTestFiles[SHV_TEST_MAX_FILES];
+
+//
+// The host page tables, the first of which is the PML4, and the windows
+// they map.
+//
+static DECLSPEC_ALIGN(PAGE_SIZE) ULONG64 ShvTestHostTables[SHV_TEST_HOST_TABLES][PAGE_SIZE / sizeof(ULONG64)];
+static ULONG ShvTestHostTableCount = 1;
+static SHV_TEST_WINDOW ShvTestWindows[SHV_TEST_MAX_PROCESSORS];
+
+//
+// What the thread is running as.
+//
+static __declspec(thread) ULONG ShvTestProcessor = 0;
+static __declspec(thread) KIRQL ShvTestIrql = PASSIVE_LEVEL;
+
+// ===========================================================================
+//
+// LOCAL PROTOTYPES
+//
+// ===========================================================================
+
+static VOID
+ShvTestAcquireLock(
+	_Inout_ volatile LONG64 *Lock
+);
+
+static VOID
+ShvTestReleaseLock(
+	_Inout_ volatile LONG64 *Lock
+);
+
+static PSHV_TEST_REGISTER
+ShvTestFindRegister(
+	_Inout_updates_(*Count) PSHV_TEST_REGISTER Registers,
+	_Inout_ PULONG Count,
+	_In_ ULONG Capacity,
+	_In_ ULONG64 Index,
+	_In_ BOOLEAN Create
+);
+
+static PSHV_TEST_WINDOW
+ShvTestFindWindow(
+	_In_ PVOID Va
+);
+
+static VOID
+ShvTestDpcThread(
+	_In_ ULONG Index,
+	_In_opt_ PVOID Context
+);
+
+static VOID
+ShvTestWorkerThread(
+	_In_ ULONG Index,
+	_In_opt_ PVOID Context
+);
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+VOID
+ShvTestResetMachine(
+	VOID
+)
+{
+	ULONG64 addressMask;
+
+	//
+	// Every VP of the most LPs there can be, so that any processor count
+	// can be simulated later.
+	//
+	if (ShvGlobalData == NULL)
+	{
+		ShvGlobalData = (PSHV_GLOBAL_DATA)ShvTestPlatAllocatePages(
+			FIELD_OFFSET(SHV_GLOBAL_DATA, VpData) + SHV_TEST_MAX_PROCESSORS * sizeof(SHV_VP_DATA),
+			MM_ANY_NODE_OK);
+	}
+
+	__stosb((PUCHAR)ShvGlobalData,
+		0,
+		FIELD_OFFSET(SHV_GLOBAL_DATA, VpData) + SHV_TEST_MAX_PROCESSORS * sizeof(SHV_VP_DATA));
+
+	for (ULONG i = 0; i < SHV_TEST_MAX_PROCESSORS; i++)
+	{
+		ShvGlobalData->VpData[i].VpIndex = i;
+	}
+
+	__stosb((PUCHAR)ShvTestVmcs, 0, sizeof(ShvTestVmcs));
+	__stosb((PUCHAR)ShvTestInvepts, 0, sizeof(ShvTestInvepts));
+
+	//
+	// No windows, and a PML4 that maps nothing.  Windows that a test left
+	// reserved are lost.
+	//
+	__stosb((PUCHAR)ShvTestHostTables, 0, sizeof(ShvTestHostTables));
+	__stosb((PUCHAR)ShvTestWindows, 0, sizeof(ShvTestWindows));
+	ShvTestHostTableCount = 1;
+
+	ShvTestSetProcessors(1, 1);
+	ShvTestSetTypicalMemoryMap(4 * SHV_TEST_GB);
+
+	//
+	// A processor with EPT, every large page size, and MTRRs that make
+	// RAM write-back and the hole below 4 GiB uncached.
+	//
+	ShvTestMsrCount = 0;
+
+	addressMask = ((1ULL << SHV_TEST_PHYSICAL_ADDRESS_BITS) - 1) & ~(PAGE_SIZE - 1ULL);
+
+	ShvTestSetMsr(MSR_IA32_VMX_PROCBASED_CTLS, 1ULL << (32 + 31));
+	ShvTestSetMsr(MSR_IA32_VMX_PROCBASED_CTLS2, 1ULL << (32 + 1));
+	ShvTestSetMsr(MSR_IA32_VMX_EPT_VPID_CAP, SHV_TEST_EPT_CAPS_1GB);
+	ShvTestSetMsr(IA32_APIC_BASE_MSR, 0xfee00000 | (1 << 11));
+	ShvTestSetMsr(MSR_IA32_MTRRCAP, 1);
+	ShvTestSetMsr(MSR_IA32_MTRR_DEF_TYPE, MTRR_DEF_ENABLE | WriteBack);
+	ShvTestSetMsr(MSR_IA32_MTRR_PHYSBASE0, 0xc0000000 | Uncacheable);
+	ShvTestSetMsr(MSR_IA32_MTRR_PHYSMASK0, (addressMask & ~(SHV_TEST_GB - 1)) | MTRR_PHYSMASK_VALID);
+
+	ShvTestDeleteFiles();
+	ShvTestSetGuestMemory(0, NULL, 0);
+	ShvTestResetEpt();
+}
+
+VOID
+ShvTestSetProcessors(
+	_In_ ULONG Count,
+	_In_ ULONG Nodes
+)
+{
+	NT_ASSERT(Count > 0 && Count <= SHV_TEST_MAX_PROCESSORS);
+	NT_ASSERT(Nodes > 0 && Nodes <= min(Count, SHV_TEST_MAX_NODES));
+
+	ShvTestProcessorCount = Count;
+	ShvTestNodeCount = Nodes;
+}
+
+VOID
+ShvTestSetMemoryMap(
+	_In_reads_(Count) const PHYSICAL_MEMORY_RANGE *Ranges,
+	_In_ ULONG Count
+)
+{
+	NT_ASSERT(Count <= SHV_TEST_MAX_RANGES);
+
+	for (ULONG i = 0; i < Count; i++)
+	{
+		ShvTestRanges[i] = Ranges[i];
+	}
+
+	ShvTestRangeCount = Count;
+}
+
+VOID
+ShvTestSetTypicalMemoryMap(
+	_In_ ULONG64 RamBytes
+)
+{
+	PHYSICAL_MEMORY_RANGE ranges[3];
+	ULONG64 low;
+
+	//
+	// Lay the RAM out the way PC firmware does: conventional memory below
+	// the legacy video and ROM area, then up to the PCI hole at 3 GiB, and
+	// the rest above 4 GiB.
+	//
+	low = min(RamBytes, 3 * SHV_TEST_GB);
+
+	ranges[0].BaseAddress.QuadPart = 0x1000;
+	ranges[0].NumberOfBytes.QuadPart = 0x9f000 - 0x1000;
+	ranges[1].BaseAddress.QuadPart = 0x100000;
+	ranges[1].NumberOfBytes.QuadPart = low - 0x100000;
+	ranges[2].BaseAddress.QuadPart = 4 * SHV_TEST_GB;
+	ranges[2].NumberOfBytes.QuadPart = RamBytes - low;
+
+	ShvTestSetMemoryMap(ranges, (RamBytes > low) ? 3 : 2);
+}
+
+VOID
+ShvTestSetMsr(
+	_In_ ULONG Msr,
+	_In_ ULONG64 Value
+)
+{
+	PSHV_TEST_REGISTER msr;
+
+	msr = ShvTestFindRegister(ShvTestMsrs, &ShvTestMsrCount, SHV_TEST_MAX_MSRS, Msr, TRUE);
+	msr->Value = Value;
+}
+
+VOID
+ShvTestSetCurrentProcessor(
+	_In_ ULONG Processor
+)
+{
+	NT_ASSERT(Processor < ShvTestProcessorCount);
+
+	ShvTestProcessor = Processor;
+}
+
+VOID
+ShvTestRunOnProcessors(
+	_In_ ULONG Count,
+	_In_ PSHV_TEST_WORKER Worker,
+	_In_opt_ PVOID Context
+)
+{
+	SHV_TEST_WORKER_CALL call;
+
+	call.Worker = Worker;
+	call.Context = Context;
+
+	ShvTestPlatRunThreads(Count, ShvTestWorkerThread, &call);
+}
+
+VOID
+ShvTestDeleteFiles(
+	VOID
+)
+{
+	for (ULONG i = 0; i < SHV_TEST_MAX_FILES; i++)
+	{
+		ShvTestPlatFree(ShvTestFiles[i].Data);
+		__stosb((PUCHAR)&ShvTestFiles[i], 0, sizeof(ShvTestFiles[i]));
+	}
+}
+
+VOID
+ShvTestCpuid(
+	_Out_ INT CpuInfo[4],
+	_In_ INT Leaf
+)
+{
+	__stosd((PULONG)CpuInfo, 0, 4);
+
+	//
+	// Just enough of an Intel processor for the MTRRs and APIC IDs.
+	//
+	switch ((ULONG)Leaf)
+	{
+	case 0:
+		CpuInfo[0] = 1;
+		CpuInfo[1] = 0x756e6547;
+		CpuInfo[2] = 0x6c65746e;
+		CpuInfo[3] = 0x49656e69;
+		break;
+	case 1:
+		CpuInfo[1] = (INT)(ShvTestProcessor << 24);
+		break;
+	case 0x80000000:
+		CpuInfo[0] = (INT)0x80000008;
+		break;
+	case 0x80000008:
+		CpuInfo[0] = SHV_TEST_PHYSICAL_ADDRESS_BITS | (48 << 8);
+		break;
+	}
+}
+
+ULONG64
+ShvTestReadMsr(
+	_In_ ULONG Msr
+)
+{
+	PSHV_TEST_REGISTER msr;
+
+	//
+	// The x2APIC ID is the index of the LP.
+	//
+	if (Msr == 0x802)
+	{
+		return ShvTestProcessor;
+	}
+
+	msr = ShvTestFindRegister(ShvTestMsrs, &ShvTestMsrCount, SHV_TEST_MAX_MSRS, Msr, FALSE);
+
+	return (msr != NULL) ? msr->Value : 0;
+}
+
+VOID
+ShvTestWriteMsr(
+	_In_ ULONG Msr,
+	_In_ ULONG64 Value
+)
+{
+	ShvTestSetMsr(Msr, Value);
+}
+
+UCHAR
+ShvTestVmRead(
+	_In_ SIZE_T Field,
+	_Out_ PSIZE_T Value
+)
+{
+	PSHV_TEST_VMCS vmcs;
+	PSHV_TEST_REGISTER field;
+
+	vmcs = &ShvTestVmcs[ShvTestProcessor];
+	field = ShvTestFindRegister(vmcs->Fields, &vmcs->Count, SHV_TEST_MAX_VMCS_FIELDS, Field, FALSE);
+
+	*Value = (field != NULL) ? field->Value : 0;
+
+	return 0;
+}
+
+UCHAR
+ShvTestVmWrite(
+	_In_ SIZE_T Field,
+	_In_ SIZE_T Value
+)
+{
+	PSHV_TEST_VMCS vmcs;
+	PSHV_TEST_REGISTER field;
+
+	vmcs = &ShvTestVmcs[ShvTestProcessor];
+	field = ShvTestFindRegister(vmcs->Fields, &vmcs->Count, SHV_TEST_MAX_VMCS_FIELDS, Field, TRUE);
+	field->Value = Value;
+
+	return 0;
+}
+
+UCHAR
+ShvTestInvept(
+	_In_ ULONG Type,
+	_In_ PVOID Descriptor
+)
+{
+	UNREFERENCED_PARAMETER(Type);
+	UNREFERENCED_PARAMETER(Descriptor);
+
+	//
+	// Nothing is ever cached, since nothing ever walks the tables but the
+	// modules themselves.  Count the flushes, so that tests can tell which
+	// LPs flushed.
+	//
+	InterlockedIncrement64(&ShvTestInvepts[ShvTestProcessor]);
+
+	return 0;
+}
+
+ULONG64
+ShvTestCountInvept(
+	_In_ ULONG Processor
+)
+{
+	return (ULONG64)ShvTestInvepts[Processor];
+}
+
+VOID
+ShvTestInvlpg(
+	_In_ PVOID Address
+)
+{
+	PSHV_TEST_WINDOW window;
+	ULONG64 pte;
+
+	//
+	// Nothing but the windows is ever mapped.  A window can't really show
+	// another page, so flushing it writes back what the page it showed
+	// was changed to, and copies in the one its PTE points at now.  That
+	// is the same thing, as long as only its own LP ever uses it.
+	//
+	window = ShvTestFindWindow(Address);
+	if (window == NULL)
+	{
+		return;
+	}
+
+	if (window->Frame != NULL)
+	{
+		__movsb(window->Frame, window->Va, PAGE_SIZE);
+		window->Frame = NULL;
+	}
+
+	pte = *window->Pte;
+	if ((pte & SHV_TEST_HOST_PRESENT) == 0)
+	{
+		return;
+	}
+
+	//
+	// Root mode only ever maps the frames behind guest memory.  Anything
+	// else reads as all ones, like a physical address nothing backs.
+	//
+	window->Frame = (PUCHAR)ShvTestFindGuestMemory(pte & SHV_TEST_HOST_ADDRESS_MASK);
+	if (window->Frame != NULL)
+	{
+		__movsb(window->Va, window->Frame, PAGE_SIZE);
+	}
+	else
+	{
+		__stosb(window->Va, 0xff, PAGE_SIZE);
+	}
+}
+
+ULONG64
+ShvTestReadCr3(
+	VOID
+)
+{
+	//
+	// Physical addresses are virtual ones here.
+	//
+	return MmGetPhysicalAddress(ShvTestHostTables[0]).QuadPart;
+}
+
+ULONG64
+ShvTestReadCr4(
+	VOID
+)
+{
+	//
+	// 4-level paging.
+	//
+	return 0;
+}
+
+ULONG
+ShvTestSegmentLimit(
+	_In_ ULONG Selector
+)
+{
+	UNREFERENCED_PARAMETER(Selector);
+
+	return MAXULONG;
+}
+
+ULONG
+DbgPrintEx(
+	_In_ ULONG ComponentId,
+	_In_ ULONG Level,
+	_In_ PCSTR Format,
+	...
+)
+{
+	va_list arguments;
+
+	UNREFERENCED_PARAMETER(ComponentId);
+	UNREFERENCED_PARAMETER(Level);
+
+	if (ShvTestVerbose)
+	{
+		va_start(arguments, Format);
+		vprintf(Format, arguments);
+		va_end(arguments);
+	}
+
+	return 0;
+}
+
+PVOID
+ExAllocatePoolWithTag(
+	_In_ POOL_TYPE PoolType,
+	_In_ SIZE_T NumberOfBytes,
+	_In_ ULONG Tag
+)
+{
+	UNREFERENCED_PARAMETER(PoolType);
+	UNREFERENCED_PARAMETER(Tag);
+
+	//
+	// Like pool, allocations of a page or more are page aligned.
+	//
+	return ShvTestPlatAllocate(max(NumberOfBytes, 1), (NumberOfBytes >= PAGE_SIZE) ? PAGE_SIZE : 16);
+}
+
+VOID
+ExFreePoolWithTag(
+	_In_ PVOID P,
+	_In_ ULONG Tag
+)
+{
+	UNREFERENCED_PARAMETER(Tag);
+
+	ShvTestPlatFree(P);
+}
+
+VOID
+ExFreePool(
+	_In_ PVOID P
+)
+{
+	ShvTestPlatFree(P);
+}
+
+VOID
+ExInitializeFastMutex(
+	_Out_ PFAST_MUTEX FastMutex
+)
+{
+	FastMutex->Owner = 0;
+}
+
+VOID
+ExAcquireFastMutex(
+	_Inout_ PFAST_MUTEX FastMutex
+)
+{
+	ShvTestAcquireLock(&FastMutex->Owner);
+}
+
+VOID
+ExReleaseFastMutex(
+	_Inout_ PFAST_MUTEX FastMutex
+)
+{
+	ShvTestReleaseLock(&FastMutex->Owner);
+}
+
+VOID
+InitializeSListHead(
+	_Out_ PSLIST_HEADER SListHead
+)
+{
+	SListHead->Alignment = 0;
+	SListHead->Region = 0;
+}
+
+PSLIST_ENTRY
+InterlockedPushEntrySList(
+	_Inout_ PSLIST_HEADER ListHead,
+	_Inout_ PSLIST_ENTRY ListEntry
+)
+{
+	PSLIST_ENTRY first;
+
+	ShvTestAcquireLock((volatile LONG64 *)&ListHead->Region);
+
+	first = (PSLIST_ENTRY)ListHead->Alignment;
+	ListEntry->Next = first;
+	ListHead->Alignment = (ULONGLONG)ListEntry;
+
+	ShvTestReleaseLock((volatile LONG64 *)&ListHead->Region);
+
+	return first;
+}
+
+PSLIST_ENTRY
+InterlockedPopEntrySList(
+	_Inout_ PSLIST_HEADER ListHead
+)
+{
+	PSLIST_ENTRY first;
+
+	ShvTestAcquireLock((volatile LONG64 *)&ListHead->Region);
+
+	first = (PSLIST_ENTRY)ListHead->Alignment;
+	if (first != NULL)
+	{
+		ListHead->Alignment = (ULONGLONG)first->Next;
+	}
+
+	ShvTestReleaseLock((volatile LONG64 *)&ListHead->Region);
+
+	return first;
+}
+
+USHORT
+QueryDepthSList(
+	_In_ PSLIST_HEADER SListHead
+)
+{
+	PSLIST_ENTRY entry;
+	USHORT depth;
+
+	ShvTestAcquireLock((volatile LONG64 *)&SListHead->Region);
+
+	depth = 0;
+
+	for (entry = (PSLIST_ENTRY)SListHead->Alignment; entry != NULL; entry = entry->Next)
+	{
+		depth++;
+	}
+
+	ShvTestReleaseLock((volatile LONG64 *)&SListHead->Region);
+
+	return depth;
+}
+
+VOID
+KeInitializeSpinLock(
+	_Out_ PKSPIN_LOCK SpinLock
+)
+{
+	*SpinLock = 0;
+}
+
+VOID
+KeAcquireSpinLock(
+	_Inout_ PKSPIN_LOCK SpinLock,
+	_Out_ PKIRQL OldIrql
+)
+{
+	KeRaiseIrql(DISPATCH_LEVEL, OldIrql);
+	ShvTestAcquireLock((volatile LONG64 *)SpinLock);
+}
+
+VOID
+KeReleaseSpinLock(
+	_Inout_ PKSPIN_LOCK SpinLock,
+	_In_ KIRQL NewIrql
+)
+{
+	ShvTestReleaseLock((volatile LONG64 *)SpinLock);
+	KeLowerIrql(NewIrql);
+}
+
+VOID
+KeAcquireSpinLockAtDpcLevel(
+	_Inout_ PKSPIN_LOCK SpinLock
+)
+{
+	ShvTestAcquireLock((volatile LONG64 *)SpinLock);
+}
+
+BOOLEAN
+KeTryToAcquireSpinLockAtDpcLevel(
+	_Inout_ PKSPIN_LOCK SpinLock
+)
+{
+	return InterlockedBitTestAndSet64((volatile LONG64 *)SpinLock, 0) == 0;
+}
+
+VOID
+KeReleaseSpinLockFromDpcLevel(
+	_Inout_ PKSPIN_LOCK SpinLock
+)
+{
+	ShvTestReleaseLock((volatile LONG64 *)SpinLock);
+}
+
+KIRQL
+KeGetCurrentIrql(
+	VOID
+)
+{
+	return ShvTestIrql;
+}
+
+VOID
+KeRaiseIrql(
+	_In_ KIRQL NewIrql,
+	_Out_ PKIRQL OldIrql
+)
+{
+	NT_ASSERT(NewIrql >= ShvTestIrql);
+
+	*OldIrql = ShvTestIrql;
+	ShvTestIrql = NewIrql;
+}
+
+VOID
+KeLowerIrql(
+	_In_ KIRQL NewIrql
+)
+{
+	NT_ASSERT(NewIrql <= ShvTestIrql);
+
+	ShvTestIrql = NewIrql;
+}
+
+ULONG
+KeGetCurrentProcessorNumberEx(
+	_Out_opt_ PPROCESSOR_NUMBER ProcNumber
+)
+{
+	if (ProcNumber != NULL)
+	{
+		ProcNumber->Group = 0;
+		ProcNumber->Number = (UCHAR)ShvTestProcessor;
+		ProcNumber->Reserved = 0;
+	}
+
+	return ShvTestProcessor;
+}
+
+ULONG
+KeGetCurrentProcessorIndex(
+	VOID
+)
+{
+	return ShvTestProcessor;
+}
+
+ULONG
+KeQueryActiveProcessorCountEx(
+	_In_ USHORT GroupNumber
+)
+{
+	UNREFERENCED_PARAMETER(GroupNumber);
+
+	return ShvTestProcessorCount;
+}
+
+USHORT
+KeGetCurrentNodeNumber(
+	VOID
+)
+{
+	//
+	// The LPs are spread evenly over the nodes, in order.
+	//
+	return (USHORT)(ShvTestProcessor * ShvTestNodeCount / ShvTestProcessorCount);
+}
+
+USHORT
+KeQueryHighestNodeNumber(
+	VOID
+)
+{
+	return (USHORT)(ShvTestNodeCount - 1);
+}
+
+VOID
+KeGenericCallDpc(
+	_In_ PKDEFERRED_ROUTINE Routine,
+	_In_opt_ PVOID Context
+)
+{
+	SHV_TEST_DPC_CALL call;
+
+	call.Routine = Routine;
+	call.Context = Context;
+	call.Arrived = 0;
+	call.Generation = 0;
+
+	//
+	// Run the DPC on a thread for each LP, and only return once every one
+	// of them finished.
+	//
+	ShvTestPlatRunThreads(ShvTestProcessorCount, ShvTestDpcThread, &call);
+}
+
+VOID
+KeSignalCallDpcDone(
+	_In_ PVOID SystemArgument1
+)
+{
+	//
+	// The threads are joined instead.
+	//
+	UNREFERENCED_PARAMETER(SystemArgument1);
+}
+
+LOGICAL
+KeSignalCallDpcSynchronize(
+	_In_ PVOID SystemArgument2
+)
+{
+	PSHV_TEST_DPC_CALL call;
+	LONG generation;
+
+	//
+	// Wait for every LP to get here.  The last one to arrive starts the
+	// next generation and is the one that gets TRUE.
+	//
+	call = (PSHV_TEST_DPC_CALL)SystemArgument2;
+	generation = call->Generation;
+
+	if ((ULONG)InterlockedIncrement(&call->Arrived) == ShvTestProcessorCount)
+	{
+		call->Arrived = 0;
+		InterlockedIncrement(&call->Generation);
+		return TRUE;
+	}
+
+	while (*(volatile LONG *)&call->Generation == generation)
+	{
+		YieldProcessor();
+	}
+
+	return FALSE;
+}
+
+ULONG_PTR
+KeIpiGenericCall(
+	_In_ PKIPI_BROADCAST_WORKER BroadcastFunction,
+	_In_ ULONG_PTR Context
+)
+{
+	ULONG processor;
+	KIRQL oldIrql;
+	ULONG_PTR ret;
+
+	//
+	// Run the worker as each LP in turn.  None of our workers wait for the
+	// others, so that is indistinguishable from running them all at once.
+	//
+	processor = ShvTestProcessor;
+	KeRaiseIrql(IPI_LEVEL, &oldIrql);
+
+	ret = 0;
+
+	for (ULONG i = 0; i < ShvTestProcessorCount; i++)
+	{
+		ShvTestProcessor = i;
+
+		if (i == processor)
+		{
+			ret = BroadcastFunction(Context);
+		}
+		else
+		{
+			BroadcastFunction(Context);
+		}
+	}
+
+	ShvTestProcessor = processor;
+	KeLowerIrql(oldIrql);
+
+	return ret;
+}
+
+LARGE_INTEGER
+KeQueryPerformanceCounter(
+	_Out_opt_ PLARGE_INTEGER PerformanceFrequency
+)
+{
+	LARGE_INTEGER counter;
+
+	if (PerformanceFrequency != NULL)
+	{
+		PerformanceFrequency->QuadPart = 1000000000;
+	}
+
+	counter.QuadPart = (LONGLONG)ShvTestPlatNanoseconds();
+
+	return counter;
+}
+
+VOID
+KeInitializeDpc(
+	_Out_ PRKDPC Dpc,
+	_In_ PKDEFERRED_ROUTINE DeferredRoutine,
+	_In_opt_ PVOID DeferredContext
+)
+{
+	Dpc->DeferredRoutine = (PVOID)DeferredRoutine;
+	Dpc->DeferredContext = DeferredContext;
+}
+
+VOID
+KeInitializeTimer(
+	_Out_ PKTIMER Timer
+)
+{
+	Timer->DueTime = 0;
+}
+
+BOOLEAN
+KeSetTimerEx(
+	_Inout_ PKTIMER Timer,
+	_In_ LARGE_INTEGER DueTime,
+	_In_ LONG Period,
+	_In_opt_ PKDPC Dpc
+)
+{
+	UNREFERENCED_PARAMETER(Period);
+	UNREFERENCED_PARAMETER(Dpc);
+
+	//
+	// Timers never expire.  Tests that need what a timer DPC does call it
+	// themselves, which keeps the runs reproducible.
+	//
+	Timer->DueTime = DueTime.QuadPart;
+
+	return FALSE;
+}
+
+BOOLEAN
+KeCancelTimer(
+	_Inout_ PKTIMER Timer
+)
+{
+	Timer->DueTime = 0;
+
+	return FALSE;
+}
+
+VOID
+KeFlushQueuedDpcs(
+	VOID
+)
+{
+}
+
+PVOID
+KeRegisterNmiCallback(
+	_In_ PNMI_CALLBACK CallbackRoutine,
+	_In_opt_ PVOID Context
+)
+{
+	UNREFERENCED_PARAMETER(Context);
+
+	return (PVOID)CallbackRoutine;
+}
+
+NTSTATUS
+KeDeregisterNmiCallback(
+	_In_ PVOID Handle
+)
+{
+	UNREFERENCED_PARAMETER(Handle);
+
+	return STATUS_SUCCESS;
+}
+
+VOID
+KeInitializeEvent(
+	_Out_ PKEVENT Event,
+	_In_ ULONG Type,
+	_In_ BOOLEAN State
+)
+{
+	UNREFERENCED_PARAMETER(Type);
+
+	Event->State = State;
+}
+
+LONG
+KeSetEvent(
+	_Inout_ PKEVENT Event,
+	_In_ KPRIORITY Increment,
+	_In_ BOOLEAN Wait
+)
+{
+	UNREFERENCED_PARAMETER(Increment);
+	UNREFERENCED_PARAMETER(Wait);
+
+	return InterlockedExchange(&Event->State, 1);
+}
+
+VOID
+KeClearEvent(
+	_Inout_ PKEVENT Event
+)
+{
+	InterlockedExchange(&Event->State, 0);
+}
+
+NTSTATUS
+KeWaitForSingleObject(
+	_In_ PVOID Object,
+	_In_ ULONG WaitReason,
+	_In_ KPROCESSOR_MODE WaitMode,
+	_In_ BOOLEAN Alertable,
+	_In_opt_ PLARGE_INTEGER Timeout
+)
+{
+	UNREFERENCED_PARAMETER(WaitReason);
+	UNREFERENCED_PARAMETER(WaitMode);
+	UNREFERENCED_PARAMETER(Alertable);
+	UNREFERENCED_PARAMETER(Timeout);
+
+	//
+	// System threads never start, so only events are waited for, and only
+	// with a timeout, which expires right away.
+	//
+	NT_ASSERT(Timeout != NULL);
+
+	return (((PKEVENT)Object)->State != 0) ? STATUS_SUCCESS : STATUS_TIMEOUT;
+}
+
+NTSTATUS
+KeDelayExecutionThread(
+	_In_ KPROCESSOR_MODE WaitMode,
+	_In_ BOOLEAN Alertable,
+	_In_ PLARGE_INTEGER Interval
+)
+{
+	UNREFERENCED_PARAMETER(WaitMode);
+	UNREFERENCED_PARAMETER(Alertable);
+	UNREFERENCED_PARAMETER(Interval);
+
+	//
+	// Like waits, delays expire right away.
+	//
+	return STATUS_SUCCESS;
+}
+
+PVOID
+MmAllocateContiguousMemorySpecifyCache(
+	_In_ SIZE_T NumberOfBytes,
+	_In_ PHYSICAL_ADDRESS LowestAcceptableAddress,
+	_In_ PHYSICAL_ADDRESS HighestAcceptableAddress,
+	_In_opt_ PHYSICAL_ADDRESS BoundaryAddressMultiple,
+	_In_ MEMORY_CACHING_TYPE CacheType
+)
+{
+	UNREFERENCED_PARAMETER(CacheType);
+
+	return MmAllocateContiguousNodeMemory(NumberOfBytes,
+		LowestAcceptableAddress,
+		HighestAcceptableAddress,
+		BoundaryAddressMultiple,
+		PAGE_READWRITE,
+		MM_ANY_NODE_OK);
+}
+
+PVOID
+MmAllocateContiguousNodeMemory(
+	_In_ SIZE_T NumberOfBytes,
+	_In_ PHYSICAL_ADDRESS LowestAcceptableAddress,
+	_In_ PHYSICAL_ADDRESS HighestAcceptableAddress,
+	_In_opt_ PHYSICAL_ADDRESS BoundaryAddressMultiple,
+	_In_ ULONG Protect,
+	_In_ ULONG PreferredNode
+)
+{
+	PUCHAR base;
+	SIZE_T size;
+
+	UNREFERENCED_PARAMETER(LowestAcceptableAddress);
+	UNREFERENCED_PARAMETER(HighestAcceptableAddress);
+	UNREFERENCED_PARAMETER(BoundaryAddressMultiple);
+	UNREFERENCED_PARAMETER(Protect);
+
+	//
+	// Virtual addresses double as physical ones, which makes any page
+	// aligned allocation physically contiguous.
+	//
+	size = ROUND_TO_PAGES(NumberOfBytes) + SHV_TEST_CONTIGUOUS_HEADER;
+
+	base = (PUCHAR)ShvTestPlatAllocatePages(size, PreferredNode);
+	if (base == NULL)
+	{
+		return NULL;
+	}
+
+	*(PSIZE_T)base = size;
+
+	return base + SHV_TEST_CONTIGUOUS_HEADER;
+}
+
+VOID
+MmFreeContiguousMemory(
+	_In_ PVOID BaseAddress
+)
+{
+	PUCHAR base;
+
+	base = (PUCHAR)BaseAddress - SHV_TEST_CONTIGUOUS_HEADER;
+
+	ShvTestPlatFreePages(base, *(PSIZE_T)base);
+}
+
+PHYSICAL_ADDRESS
+MmGetPhysicalAddress(
+	_In_ PVOID BaseAddress
+)
+{
+	PHYSICAL_ADDRESS address;
+
+	address.QuadPart = (LONGLONG)(ULONG_PTR)BaseAddress;
+
+	return address;
+}
+
+PVOID
+MmGetVirtualForPhysical(
+	_In_ PHYSICAL_ADDRESS PhysicalAddress
+)
+{
+	return (PVOID)(ULONG_PTR)PhysicalAddress.QuadPart;
+}
+
+PPHYSICAL_MEMORY_RANGE
+MmGetPhysicalMemoryRanges(
+	VOID
+)
+{
+	PPHYSICAL_MEMORY_RANGE ranges;
+
+	//
+	// A copy of the simulated ranges, ending with an empty one, that the
+	// caller frees.
+	//
+	ranges = (PPHYSICAL_MEMORY_RANGE)ExAllocatePoolWithTag(NonPagedPoolNx,
+		(ShvTestRangeCount + 1) * sizeof(PHYSICAL_MEMORY_RANGE),
+		'tseT');
+	if (ranges == NULL)
+	{
+		return NULL;
+	}
+
+	for (ULONG i = 0; i < ShvTestRangeCount; i++)
+	{
+		ranges[i] = ShvTestRanges[i];
+	}
+
+	ranges[ShvTestRangeCount].BaseAddress.QuadPart = 0;
+	ranges[ShvTestRangeCount].NumberOfBytes.QuadPart = 0;
+
+	return ranges;
+}
+
+PVOID
+MmMapIoSpace(
+	_In_ PHYSICAL_ADDRESS PhysicalAddress,
+	_In_ SIZE_T NumberOfBytes,
+	_In_ MEMORY_CACHING_TYPE CacheType
+)
+{
+	PVOID mapping;
+
+	UNREFERENCED_PARAMETER(PhysicalAddress);
+	UNREFERENCED_PARAMETER(CacheType);
+
+	//
+	// Device registers read as zero.
+	//
+	mapping = ShvTestPlatAllocate(NumberOfBytes, PAGE_SIZE);
+	if (mapping != NULL)
+	{
+		__stosb((PUCHAR)mapping, 0, NumberOfBytes);
+	}
+
+	return mapping;
+}
+
+VOID
+MmUnmapIoSpace(
+	_In_ PVOID BaseAddress,
+	_In_ SIZE_T NumberOfBytes
+)
+{
+	UNREFERENCED_PARAMETER(NumberOfBytes);
+
+	ShvTestPlatFree(BaseAddress);
+}
+
+PVOID
+MmAllocateMappingAddress(
+	_In_ SIZE_T NumberOfBytes,
+	_In_ ULONG PoolTag
+)
+{
+	PSHV_TEST_WINDOW window;
+	PULONG64 table;
+	PUCHAR va;
+
+	UNREFERENCED_PARAMETER(PoolTag);
+
+	NT_ASSERT(NumberOfBytes == PAGE_SIZE);
+
+	//
+	// Back the window with a page of its own, and fill in the tables that
+	// lead to its PTE, which maps nothing yet.
+	//
+	window = ShvTestFindWindow(NULL);
+	if (window == NULL)
+	{
+		return NULL;
+	}
+
+	va = (PUCHAR)ShvTestPlatAllocatePages(NumberOfBytes, MM_ANY_NODE_OK);
+	if (va == NULL)
+	{
+		return NULL;
+	}
+
+	table = ShvTestHostTables[0];
+
+	for (ULONG l = 4; l > 1; l--)
+	{
+		if ((table[SHV_TEST_HOST_INDEX(va, l)] & SHV_TEST_HOST_PRESENT) == 0)
+		{
+			if (ShvTestHostTableCount == SHV_TEST_HOST_TABLES)
+			{
+				ShvTestPlatFreePages(va, NumberOfBytes);
+				return NULL;
+			}
+
+			table[SHV_TEST_HOST_INDEX(va, l)] =
+				MmGetPhysicalAddress(ShvTestHostTables[ShvTestHostTableCount++]).QuadPart | SHV_TEST_HOST_TABLE_ENTRY;
+		}
+
+		table = (PULONG64)(ULONG_PTR)(table[SHV_TEST_HOST_INDEX(va, l)] & SHV_TEST_HOST_ADDRESS_MASK);
+	}
+
+	window->Va = va;
+	window->Pte = &table[SHV_TEST_HOST_INDEX(va, 1)];
+	window->Frame = NULL;
+
+	*window->Pte = 0;
+
+	return va;
+}
+
+VOID
+MmFreeMappingAddress(
+	_In_ PVOID BaseAddress,
+	_In_ ULONG PoolTag
+)
+{
+	PSHV_TEST_WINDOW window;
+
+	UNREFERENCED_PARAMETER(PoolTag);
+
+	//
+	// The window has to be unmapped by now.  The tables leading to it stay
+	// until the machine is reset.
+	//
+	window = ShvTestFindWindow(BaseAddress);
+	NT_ASSERT(window != NULL && *window->Pte == 0);
+
+	ShvTestPlatFreePages(window->Va, PAGE_SIZE);
+
+	window->Va = NULL;
+	window->Pte = NULL;
+	window->Frame = NULL;
+}
+
+NTSTATUS
+MmCopyMemory(
+	_In_ PVOID TargetAddress,
+	_In_ MM_COPY_ADDRESS SourceAddress,
+	_In_ SIZE_T NumberOfBytes,
+	_In_ ULONG Flags,
+	_Out_ PSIZE_T NumberOfBytesTransferred
+)
+{
+	PVOID source;
+
+	//
+	// Physical memory is the guest memory the test provides.  Nothing else
+	// reads back.
+	//
+	*NumberOfBytesTransferred = 0;
+
+	source = SourceAddress.VirtualAddress;
+
+	if (Flags == MM_COPY_MEMORY_PHYSICAL)
+	{
+		source = ShvTestFindGuestMemory(SourceAddress.PhysicalAddress.QuadPart);
+
+		if (source == NULL ||
+			ShvTestFindGuestMemory(SourceAddress.PhysicalAddress.QuadPart + NumberOfBytes - 1) == NULL)
+		{
+			return STATUS_ACCESS_VIOLATION;
+		}
+	}
+
+	__movsb((PUCHAR)TargetAddress, (const UCHAR *)source, NumberOfBytes);
+
+	*NumberOfBytesTransferred = NumberOfBytes;
+
+	return STATUS_SUCCESS;
+}
+
+PVOID
+MmGetSystemRoutineAddress(
+	_In_ PUNICODE_STRING SystemRoutineName
+)
+{
+	if (wcscmp(SystemRoutineName->Buffer, L"MmAllocateContiguousNodeMemory") == 0)
+	{
+		return (PVOID)MmAllocateContiguousNodeMemory;
+	}
+
+	return NULL;
+}
+
+NTSTATUS
+IoRegisterPlugPlayNotification(
+	_In_ IO_NOTIFICATION_EVENT_CATEGORY EventCategory,
+	_In_ ULONG EventCategoryFlags,
+	_In_opt_ PVOID EventCategoryData,
+	_In_ PDRIVER_OBJECT DriverObject,
+	_In_ DRIVER_NOTIFICATION_CALLBACK_ROUTINE *CallbackRoutine,
+	_Inout_opt_ PVOID Context,
+	_Out_ PVOID *NotificationEntry
+)
+{
+	UNREFERENCED_PARAMETER(EventCategory);
+	UNREFERENCED_PARAMETER(EventCategoryFlags);
+	UNREFERENCED_PARAMETER(EventCategoryData);
+	UNREFERENCED_PARAMETER(DriverObject);
+	UNREFERENCED_PARAMETER(Context);
+
+	//
+	// Memory is never hot-added.
+	//
+	*NotificationEntry = (PVOID)CallbackRoutine;
+
+	return STATUS_SUCCESS;
+}
+
+NTSTATUS
+IoUnregisterPlugPlayNotificationEx(
+	_In_ PVOID NotificationEntry
+)
+{
+	UNREFERENCED_PARAMETER(NotificationEntry);
+
+	return STATUS_SUCCESS;
+}
+
+NTSTATUS
+ObReferenceObjectByHandle(
+	_In_ HANDLE Handle,
+	_In_ ACCESS_MASK DesiredAccess,
+	_In_opt_ POBJECT_TYPE ObjectType,
+	_In_ KPROCESSOR_MODE AccessMode,
+	_Out_ PVOID *Object,
+	_Out_opt_ PVOID HandleInformation
+)
+{
+	UNREFERENCED_PARAMETER(DesiredAccess);
+	UNREFERENCED_PARAMETER(ObjectType);
+	UNREFERENCED_PARAMETER(AccessMode);
+	UNREFERENCED_PARAMETER(HandleInformation);
+
+	*Object = Handle;
+
+	return STATUS_SUCCESS;
+}
+
+VOID
+ObDereferenceObject(
+	_In_ PVOID Object
+)
+{
+	UNREFERENCED_PARAMETER(Object);
+}
+
+NTSTATUS
+PsCreateSystemThread(
+	_Out_ PHANDLE ThreadHandle,
+	_In_ ULONG DesiredAccess,
+	_In_opt_ POBJECT_ATTRIBUTES ObjectAttributes,
+	_In_opt_ HANDLE ProcessHandle,
+	_Out_opt_ PVOID ClientId,
+	_In_ PKSTART_ROUTINE StartRoutine,
+	_In_opt_ PVOID StartContext
+)
+{
+	UNREFERENCED_PARAMETER(DesiredAccess);
+	UNREFERENCED_PARAMETER(ObjectAttributes);
+	UNREFERENCED_PARAMETER(ProcessHandle);
+	UNREFERENCED_PARAMETER(ClientId);
+	UNREFERENCED_PARAMETER(StartRoutine);
+	UNREFERENCED_PARAMETER(StartContext);
+
+	//
+	// Like timers, system threads never run.  Tests that need what a
+	// thread does each time around call that themselves.
+	//
+	*ThreadHandle = NULL;
+
+	return STATUS_NOT_SUPPORTED;
+}
+
+NTSTATUS
+PsTerminateSystemThread(
+	_In_ NTSTATUS ExitStatus
+)
+{
+	UNREFERENCED_PARAMETER(ExitStatus);
+
+	NT_ASSERT(FALSE);
+
+	return STATUS_SUCCESS;
+}
+
+BOOLEAN
+RtlIsNtDdiVersionAvailable(
+	_In_ ULONG Version
+)
+{
+	return Version <= NTDDI_VERSION;
+}
+
+VOID
+RtlInitUnicodeString(
+	_Out_ PUNICODE_STRING DestinationString,
+	_In_opt_ PCWSTR SourceString
+)
+{
+	SIZE_T length;
+
+	length = (SourceString != NULL) ? wcslen(SourceString) * sizeof(WCHAR) : 0;
+
+	DestinationString->Buffer = (PWSTR)SourceString;
+	DestinationString->Length = (USHORT)length;
+	DestinationString->MaximumLength = (USHORT)(length + ((SourceString != NULL) ? sizeof(WCHAR) : 0));
+}
+
+SIZE_T
+RtlCompareMemory(
+	_In_ const VOID *Source1,
+	_In_ const VOID *Source2,
+	_In_ SIZE_T Length
+)
+{
+	SIZE_T i;
+
+	for (i = 0; i < Length; i++)
+	{
+		if (((const UCHAR *)Source1)[i] != ((const UCHAR *)Source2)[i])
+		{
+			break;
+		}
+	}
+
+	return i;
+}
+
+ULONG
+RtlRandomEx(
+	_Inout_ PULONG Seed
+)
+{
+	//
+	// Any generator will do, as long as it stays in [0, MAXLONG) and the
+	// same seed gives the same numbers.
+	//
+	*Seed = (ULONG)(((ULONG64)*Seed * 1103515245 + 12345) % MAXLONG);
+
+	return *Seed;
+}
+
+NTSTATUS
+ZwCreateFile(
+	_Out_ PHANDLE FileHandle,
+	_In_ ACCESS_MASK DesiredAccess,
+	_In_ POBJECT_ATTRIBUTES ObjectAttributes,
+	_Out_ PIO_STATUS_BLOCK IoStatusBlock,
+	_In_opt_ PLARGE_INTEGER AllocationSize,
+	_In_ ULONG FileAttributes,
+	_In_ ULONG ShareAccess,
+	_In_ ULONG CreateDisposition,
+	_In_ ULONG CreateOptions,
+	_In_opt_ PVOID EaBuffer,
+	_In_ ULONG EaLength
+)
+{
+	PSHV_TEST_HANDLE handle;
+	PSHV_TEST_FILE file, free;
+	PCWSTR path;
+
+	UNREFERENCED_PARAMETER(DesiredAccess);
+	UNREFERENCED_PARAMETER(AllocationSize);
+	UNREFERENCED_PARAMETER(FileAttributes);
+	UNREFERENCED_PARAMETER(ShareAccess);
+	UNREFERENCED_PARAMETER(CreateOptions);
+	UNREFERENCED_PARAMETER(EaBuffer);
+	UNREFERENCED_PARAMETER(EaLength);
+
+	//
+	// Files live in memory, for as long as the harness runs or until a test
+	// deletes them.
+	//
+	path = ObjectAttributes->ObjectName->Buffer;
+	file = NULL;
+	free = NULL;
+
+	for (ULONG i = 0; i < SHV_TEST_MAX_FILES; i++)
+	{
+		if (!ShvTestFiles[i].Used)
+		{
+			free = (free != NULL) ? free : &ShvTestFiles[i];
+		}
+		else if (wcscmp(ShvTestFiles[i].Path, path) == 0)
+		{
+			file = &ShvTestFiles[i];
+		}
+	}
+
+	if (file == NULL)
+	{
+		if (CreateDisposition == FILE_OPEN)
+		{
+			return STATUS_OBJECT_NAME_NOT_FOUND;
+		}
+
+		if ((free == NULL) || (wcslen(path) >= RTL_NUMBER_OF(free->Path)))
+		{
+			return STATUS_INSUFFICIENT_RESOURCES;
+		}
+
+		file = free;
+		wcscpy(file->Path, path);
+		file->Used = TRUE;
+	}
+	else if (CreateDisposition == FILE_OVERWRITE_IF)
+	{
+		ShvTestPlatFree(file->Data);
+		file->Data = NULL;
+		file->Size = 0;
+	}
+
+	handle = (PSHV_TEST_HANDLE)ExAllocatePoolWithTag(NonPagedPoolNx, sizeof(*handle), 'tseT');
+	if (handle == NULL)
+	{
+		return STATUS_INSUFFICIENT_RESOURCES;
+	}
+
+	handle->File = file;
+	handle->Position = 0;
+
+	IoStatusBlock->Status = STATUS_SUCCESS;
+	IoStatusBlock->Information = 0;
+	*FileHandle = handle;
+
+	return STATUS_SUCCESS;
+}
+
+NTSTATUS
+ZwQueryInformationFile(
+	_In_ HANDLE FileHandle,
+	_Out_ PIO_STATUS_BLOCK IoStatusBlock,
+	_Out_ PVOID FileInformation,
+	_In_ ULONG Length,
+	_In_ INT FileInformationClass
+)
+{
+	PFILE_STANDARD_INFORMATION information;
+	PSHV_TEST_HANDLE handle;
+
+	if ((FileInformationClass != FileStandardInformation) || (Length < sizeof(*information)))
+	{
+		return STATUS_INVALID_PARAMETER;
+	}
+
+	handle = (PSHV_TEST_HANDLE)FileHandle;
+	information = (PFILE_STANDARD_INFORMATION)FileInformation;
+
+	__stosb((PUCHAR)information, 0, sizeof(*information));
+	information->AllocationSize.QuadPart = handle->File->Size;
+	information->EndOfFile.QuadPart = handle->File->Size;
+	information->NumberOfLinks = 1;
+
+	IoStatusBlock->Status = STATUS_SUCCESS;
+	IoStatusBlock->Information = sizeof(*information);
+
+	return STATUS_SUCCESS;
+}
+
+NTSTATUS
+ZwReadFile(
+	_In_ HANDLE FileHandle,
+	_In_opt_ HANDLE Event,
+	_In_opt_ PVOID ApcRoutine,
+	_In_opt_ PVOID ApcContext,
+	_Out_ PIO_STATUS_BLOCK IoStatusBlock,
+	_Out_ PVOID Buffer,
+	_In_ ULONG Length,
+	_In_opt_ PLARGE_INTEGER ByteOffset,
+	_In_opt_ PULONG Key
+)
+{
+	PSHV_TEST_HANDLE handle;
+	ULONG position, count;
+
+	UNREFERENCED_PARAMETER(Event);
+	UNREFERENCED_PARAMETER(ApcRoutine);
+	UNREFERENCED_PARAMETER(ApcContext);
+	UNREFERENCED_PARAMETER(Key);
+
+	handle = (PSHV_TEST_HANDLE)FileHandle;
+	position = (ByteOffset != NULL) ? (ULONG)ByteOffset->QuadPart : handle->Position;
+
+	if (position >= handle->File->Size)
+	{
+		return STATUS_END_OF_FILE;
+	}
+
+	count = min(Length, handle->File->Size - position);
+	__movsb((PUCHAR)Buffer, handle->File->Data + position, count);
+
+	handle->Position = position + count;
+
+	IoStatusBlock->Status = STATUS_SUCCESS;
+	IoStatusBlock->Information = count;
+
+	return STATUS_SUCCESS;
+}
+
+NTSTATUS
+ZwWriteFile(
+	_In_ HANDLE FileHandle,
+	_In_opt_ HANDLE Event,
+	_In_opt_ PVOID ApcRoutine,
+	_In_opt_ PVOID ApcContext,
+	_Out_ PIO_STATUS_BLOCK IoStatusBlock,
+	_In_ PVOID Buffer,
+	_In_ ULONG Length,
+	_In_opt_ PLARGE_INTEGER ByteOffset,
+	_In_opt_ PULONG Key
+)
+{
+	PSHV_TEST_HANDLE handle;
+	PSHV_TEST_FILE file;
+	ULONG position;
+	PUCHAR data;
+
+	UNREFERENCED_PARAMETER(Event);
+	UNREFERENCED_PARAMETER(ApcRoutine);
+	UNREFERENCED_PARAMETER(ApcContext);
+	UNREFERENCED_PARAMETER(Key);
+
+	handle = (PSHV_TEST_HANDLE)FileHandle;
+	file = handle->File;
+	position = (ByteOffset != NULL) ? (ULONG)ByteOffset->QuadPart : handle->Position;
+
+	if (position + Length > file->Size)
+	{
+		data = (PUCHAR)ShvTestPlatAllocate(position + Length, 16);
+		if (data == NULL)
+		{
+			return STATUS_INSUFFICIENT_RESOURCES;
+		}
+
+		__stosb(data, 0, position + Length);
+		__movsb(data, file->Data, file->Size);
+
+		ShvTestPlatFree(file->Data);
+		file->Data = data;
+		file->Size = position + Length;
+	}
+
+	__movsb(file->Data + position, (const UCHAR *)Buffer, Length);
+
+	handle->Position = position + Length;
+
+	IoStatusBlock->Status = STATUS_SUCCESS;
+	IoStatusBlock->Information = Length;
+
+	return STATUS_SUCCESS;
+}
+
+NTSTATUS
+ZwClose(
+	_In_ HANDLE Handle
+)
+{
+	ExFreePoolWithTag(Handle, 'tseT');
+
+	return STATUS_SUCCESS;
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+static VOID
+ShvTestAcquireLock(
+	_Inout_ volatile LONG64 *Lock
+)
+{
+	while (InterlockedBitTestAndSet64(Lock, 0))
+	{
+		while (*Lock & 1)
+		{
+			YieldProcessor();
+		}
+	}
+}
+
+static VOID
+ShvTestReleaseLock(
+	_Inout_ volatile LONG64 *Lock
+)
+{
+	InterlockedExchange64(Lock, 0);
+}
+
+static PSHV_TEST_REGISTER
+ShvTestFindRegister(
+	_Inout_updates_(*Count) PSHV_TEST_REGISTER Registers,
+	_Inout_ PULONG Count,
+	_In_ ULONG Capacity,
+	_In_ ULONG64 Index,
+	_In_ BOOLEAN Create
+)
+{
+	for (ULONG i = 0; i < *Count; i++)
+	{
+		if (Registers[i].Index == Index)
+		{
+			return &Registers[i];
+		}
+	}
+
+	if (!Create)
+	{
+		return NULL;
+	}
+
+	NT_ASSERT(*Count < Capacity);
+	UNREFERENCED_PARAMETER(Capacity);
+
+	Registers[*Count].Index = Index;
+	Registers[*Count].Value = 0;
+
+	return &Registers[(*Count)++];
+}
+
+static PSHV_TEST_WINDOW
+ShvTestFindWindow(
+	_In_ PVOID Va
+)
+{
+	//
+	// A window that isn't there has no VA, so looking for none finds a
+	// free slot.
+	//
+	for (ULONG i = 0; i < SHV_TEST_MAX_PROCESSORS; i++)
+	{
+		if (ShvTestWindows[i].Va == (PUCHAR)Va)
+		{
+			return &ShvTestWindows[i];
+		}
+	}
+
+	return NULL;
+}
+
+static VOID
+ShvTestDpcThread(
+	_In_ ULONG Index,
+	_In_opt_ PVOID Context
+)
+{
+	PSHV_TEST_DPC_CALL call;
+	KDPC dpc;
+
+	call = (PSHV_TEST_DPC_CALL)Context;
+
+	ShvTestProcessor = Index;
+	ShvTestIrql = DISPATCH_LEVEL;
+
+	KeInitializeDpc(&dpc, call->Routine, call->Context);
+	call->Routine(&dpc, call->Context, call, call);
+}
+
+static VOID
+ShvTestWorkerThread(
+	_In_ ULONG Index,
+	_In_opt_ PVOID Context
+)
+{
+	PSHV_TEST_WORKER_CALL call;
+
+	call = (PSHV_TEST_WORKER_CALL)Context;
+
+	ShvTestProcessor = Index;
+	ShvTestIrql = PASSIVE_LEVEL;
+
+	call->Worker(Index, call->Context);
+}
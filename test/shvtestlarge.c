@@ -0,0 +1,288 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvtestlarge.c
+
+Abstract:
+
+	This module tests that the identity map uses 2 MiB and 1 GiB leaves
+	wherever the memory map, the MTRRs and the processor allow, and only
+	there, and benchmarks what that saves in build time, table memory and
+	walk length.
+
+Author:
+
+	agent (@agent) 16-Oct-2026 - Initial version
+
+Environment:
+
+	User mode only.
+
+--*/
+
+#include "shvtest.h"
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+#define SHV_TEST_MB                     (1024ULL * 1024)
+
+//
+// How many addresses to translate for each map the benchmark builds.
+//
+#define SHV_TEST_LARGE_WALKS            (4 * 1024 * 1024)
+
+// ===========================================================================
+//
+// LOCAL TYPES
+//
+// ===========================================================================
+
+typedef struct _SHV_TEST_LARGE_MODE {
+	PCSTR Name;
+	ULONG64 Capabilities;
+	ULONG64 MaxRam;
+} SHV_TEST_LARGE_MODE, *PSHV_TEST_LARGE_MODE;
+
+// ===========================================================================
+//
+// LOCAL DATA
+//
+// ===========================================================================
+
+//
+// A 4 KiB only map of 512 GiB would take a gigabyte of tables, so those
+// sizes are only built with large pages.
+//
+static const SHV_TEST_LARGE_MODE ShvTestLargeModes[] = {
+	{ "4 KiB", SHV_TEST_EPT_CAPS_4KB, 64 * SHV_TEST_GB },
+	{ "2 MiB", SHV_TEST_EPT_CAPS_2MB, 512 * SHV_TEST_GB },
+	{ "1 GiB", SHV_TEST_EPT_CAPS_1GB, 512 * SHV_TEST_GB },
+};
+
+static const ULONG64 ShvTestLargeRamSizes[] = {
+	4 * SHV_TEST_GB,
+	16 * SHV_TEST_GB,
+	64 * SHV_TEST_GB,
+	512 * SHV_TEST_GB,
+};
+
+// ===========================================================================
+//
+// LOCAL PROTOTYPES
+//
+// ===========================================================================
+
+static VOID
+ShvTestLargeCheckIdentity(
+	_In_ ULONG64 Top
+);
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+VOID
+ShvTestLargePages(
+	VOID
+)
+{
+	SHV_EPT_INSPECTION inspection;
+	ULONG64 top;
+
+	//
+	// 4 GiB of RAM: the legacy hole below 1 MiB, the UC PCI hole from 3 to
+	// 4 GiB, 1 GiB above it, and a 1 MiB UC window at 2 GiB + 1 MiB that
+	// splits a 2 MiB page.
+	//
+	top = 5 * SHV_TEST_GB;
+
+	ShvTestSetMsr(MSR_IA32_MTRRCAP, 2);
+	ShvTestSetMsr(MSR_IA32_MTRR_PHYSBASE0 + 2, (2 * SHV_TEST_GB + SHV_TEST_MB) | Uncacheable);
+	ShvTestSetMsr(MSR_IA32_MTRR_PHYSMASK0 + 2,
+		(((1ULL << 46) - 1) & ~(SHV_TEST_MB - 1)) | MTRR_PHYSMASK_VALID);
+
+	//
+	// Without large page support, every leaf is a PTE.
+	//
+	ShvTestSetMsr(MSR_IA32_VMX_EPT_VPID_CAP, SHV_TEST_EPT_CAPS_4KB);
+
+	if (SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+	{
+		ShvVmxEptInspect(&inspection);
+
+		SHV_TEST_CHECK(inspection.Leaves[2] == 0);
+		SHV_TEST_CHECK(inspection.Leaves[3] == 0);
+		SHV_TEST_CHECK(inspection.Leaves[1] == top / PAGE_SIZE);
+		SHV_TEST_CHECK(inspection.MappedBytes == top);
+		SHV_TEST_CHECK(ShvVmxEptGetPageSize(2 * SHV_TEST_GB) == PAGE_SIZE);
+
+		ShvTestLargeCheckIdentity(top);
+		ShvTestStopEpt();
+	}
+
+	//
+	// With 2 MiB pages, only the first 2 MiB, which mixes RAM and holes,
+	// and the 2 MiB the UC window is in need PTEs.  The first of them is
+	// all WB, which the inspector reports as collapsible, but RAM and
+	// holes are never mapped by the same leaf.
+	//
+	ShvTestSetMsr(MSR_IA32_VMX_EPT_VPID_CAP, SHV_TEST_EPT_CAPS_2MB);
+
+	if (SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+	{
+		ShvVmxEptInspect(&inspection);
+
+		SHV_TEST_CHECK(inspection.Leaves[3] == 0);
+		SHV_TEST_CHECK(inspection.Leaves[2] == top / VMX_EPT_PAGE_SIZE_2MB - 2);
+		SHV_TEST_CHECK(inspection.Leaves[1] == 2 * 512);
+		SHV_TEST_CHECK(inspection.MappedBytes == top);
+		SHV_TEST_CHECK(inspection.Collapsible[1] == 1);
+		SHV_TEST_CHECK(inspection.CollapsibleRegions[0].Base == 0);
+		SHV_TEST_CHECK(ShvVmxEptGetPageSize(0x1000) == PAGE_SIZE);
+		SHV_TEST_CHECK(ShvVmxEptGetPageSize(2 * SHV_TEST_GB) == PAGE_SIZE);
+		SHV_TEST_CHECK(ShvVmxEptGetPageSize(2 * SHV_TEST_GB + 2 * SHV_TEST_MB) == VMX_EPT_PAGE_SIZE_2MB);
+		SHV_TEST_CHECK(ShvVmxEptGetPageSize(3 * SHV_TEST_GB) == VMX_EPT_PAGE_SIZE_2MB);
+
+		ShvTestLargeCheckIdentity(top);
+		ShvTestStopEpt();
+	}
+
+	//
+	// With 1 GiB pages too, the PCI hole and the RAM above 4 GiB are one
+	// page each, and so is the gigabyte at 1 GiB.  The gigabytes with the
+	// legacy hole and the UC window in them are not.
+	//
+	ShvTestSetMsr(MSR_IA32_VMX_EPT_VPID_CAP, SHV_TEST_EPT_CAPS_1GB);
+
+	if (SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+	{
+		ShvVmxEptInspect(&inspection);
+
+		SHV_TEST_CHECK(inspection.Leaves[3] == 3);
+		SHV_TEST_CHECK(inspection.Leaves[2] == 2 * 512 - 2);
+		SHV_TEST_CHECK(inspection.Leaves[1] == 2 * 512);
+		SHV_TEST_CHECK(inspection.MappedBytes == top);
+		SHV_TEST_CHECK(inspection.Collapsible[1] == 1);
+		SHV_TEST_CHECK(inspection.CollapsibleRegions[0].Base == 0);
+		SHV_TEST_CHECK(inspection.Collapsible[2] == 0);
+		SHV_TEST_CHECK(inspection.BytesByType[Uncacheable] == SHV_TEST_GB + SHV_TEST_MB);
+		SHV_TEST_CHECK(ShvVmxEptGetPageSize(0x1000) == PAGE_SIZE);
+		SHV_TEST_CHECK(ShvVmxEptGetPageSize(SHV_TEST_MB * 4) == VMX_EPT_PAGE_SIZE_2MB);
+		SHV_TEST_CHECK(ShvVmxEptGetPageSize(SHV_TEST_GB) == VMX_EPT_PAGE_SIZE_1GB);
+		SHV_TEST_CHECK(ShvVmxEptGetPageSize(2 * SHV_TEST_GB) == PAGE_SIZE);
+		SHV_TEST_CHECK(ShvVmxEptGetPageSize(3 * SHV_TEST_GB) == VMX_EPT_PAGE_SIZE_1GB);
+		SHV_TEST_CHECK(ShvVmxEptGetPageSize(4 * SHV_TEST_GB) == VMX_EPT_PAGE_SIZE_1GB);
+
+		ShvTestLargeCheckIdentity(top);
+		ShvTestStopEpt();
+	}
+}
+
+VOID
+ShvTestLargePagesBenchmark(
+	VOID
+)
+{
+	SHV_EPT_INSPECTION inspection;
+	ULONG64 start, build, walk, state, hpa, top;
+	volatile ULONG64 sink;
+
+	//
+	// A guest can't run here, so TLB misses are stood in for by what each
+	// of them costs: a walk of the hierarchy for a random address.  Fewer
+	// levels and a smaller hierarchy, which stays in the caches, make the
+	// walk cheaper the same way they make a real miss cheaper.
+	//
+	ShvTestPrint("%-6s %8s %10s %12s %10s %10s\n", "pages", "RAM", "build ms", "tables KiB", "leaves", "walk ns");
+
+	for (ULONG m = 0; m < RTL_NUMBER_OF(ShvTestLargeModes); m++)
+	{
+		for (ULONG r = 0; r < RTL_NUMBER_OF(ShvTestLargeRamSizes); r++)
+		{
+			if (ShvTestLargeRamSizes[r] > ShvTestLargeModes[m].MaxRam)
+			{
+				continue;
+			}
+
+			ShvTestSetTypicalMemoryMap(ShvTestLargeRamSizes[r]);
+			ShvTestSetMsr(MSR_IA32_VMX_EPT_VPID_CAP, ShvTestLargeModes[m].Capabilities);
+
+			start = ShvTestNow();
+
+			if (!SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+			{
+				return;
+			}
+
+			build = ShvTestNow() - start;
+
+			ShvVmxEptInspect(&inspection);
+
+			top = ShvTestLargeRamSizes[r] + SHV_TEST_GB;
+			state = 0x9e3779b97f4a7c15ULL;
+			sink = 0;
+
+			start = ShvTestNow();
+
+			for (ULONG i = 0; i < SHV_TEST_LARGE_WALKS; i++)
+			{
+				ShvVmxEptTranslateGpa(ShvTestRandom(&state) % top, FALSE, &hpa);
+				sink += hpa;
+			}
+
+			walk = ShvTestNow() - start;
+
+			ShvTestPrint("%-6s %5llu GiB %10.1f %12llu %10llu %10.1f\n",
+				ShvTestLargeModes[m].Name,
+				ShvTestLargeRamSizes[r] / SHV_TEST_GB,
+				build / 1e6,
+				inspection.TableBytes / 1024,
+				inspection.Leaves[1] + inspection.Leaves[2] + inspection.Leaves[3],
+				(double)walk / SHV_TEST_LARGE_WALKS);
+
+			ShvTestStopEpt();
+		}
+	}
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+static VOID
+ShvTestLargeCheckIdentity(
+	_In_ ULONG64 Top
+)
+{
+	ULONG64 state, gpa, hpa;
+	ULONG failures;
+
+	//
+	// Whatever the leaves are, every address has to translate to itself.
+	//
+	state = 0x2545f4914f6cdd1dULL;
+	failures = 0;
+
+	for (ULONG i = 0; i < 100000; i++)
+	{
+		gpa = ShvTestRandom(&state) % Top;
+
+		if (!ShvVmxEptTranslateGpa(gpa, TRUE, &hpa) || (hpa != gpa))
+		{
+			failures++;
+		}
+	}
+
+	SHV_TEST_CHECK(failures == 0);
+}
@@ -0,0 +1,264 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvtestmemmap.c
+
+Abstract:
+
+	This module tests the physical memory map index: that the ranges are
+	sorted, coalesced and padded out with MMIO holes to cover the whole
+	physical address space, that lookups at either side of every boundary
+	find the right interval, and that a refresh maps only the RAM that was
+	hot-added.
+
+Author:
+
+	agent (@agent) 16-Oct-2026 - Initial version
+
+Environment:
+
+	User mode only.
+
+--*/
+
+#include "shvtest.h"
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// The most ranges any of the maps here is compiled from.
+//
+#define SHV_TEST_MEMMAP_RANGES          (8)
+
+#define SHV_TEST_MEMMAP_TAG             'tseT'
+
+// ===========================================================================
+//
+// LOCAL DATA
+//
+// ===========================================================================
+
+//
+// Firmware ranges out of order, with an empty one in a hole, one inside
+// another and two that touch.
+//
+static const ULONG64 ShvTestMemMapInput[][2] = {
+	{ 0x100000, 3 * SHV_TEST_GB - 0x100000 },
+	{ 4 * SHV_TEST_GB, SHV_TEST_GB },
+	{ 0x1000, 0x9f000 - 0x1000 },
+	{ 3 * SHV_TEST_GB + SHV_TEST_GB / 2, 0 },
+	{ 2 * SHV_TEST_GB, PAGE_SIZE },
+	{ 5 * SHV_TEST_GB, SHV_TEST_GB },
+};
+
+//
+// The intervals they make.
+//
+static const SHV_MEMMAP_RANGE ShvTestMemMapExpected[] = {
+	{ 0, 0x1000, ShvMemoryMmio },
+	{ 0x1000, 0x9f000, ShvMemoryRam },
+	{ 0x9f000, 0x100000, ShvMemoryMmio },
+	{ 0x100000, 3 * SHV_TEST_GB, ShvMemoryRam },
+	{ 3 * SHV_TEST_GB, 4 * SHV_TEST_GB, ShvMemoryMmio },
+	{ 4 * SHV_TEST_GB, 6 * SHV_TEST_GB, ShvMemoryRam },
+	{ 6 * SHV_TEST_GB, MAXULONG64, ShvMemoryMmio },
+};
+
+// ===========================================================================
+//
+// LOCAL PROTOTYPES
+//
+// ===========================================================================
+
+static ULONG
+ShvTestMemMapRanges(
+	_In_reads_(Count) const ULONG64 (*Input)[2],
+	_In_ ULONG Count,
+	_Out_writes_(Count) PPHYSICAL_MEMORY_RANGE Ranges
+);
+
+static BOOLEAN
+ShvTestMemMapIs(
+	_In_ ULONG64 Address,
+	_In_ SHV_MEMORY_CLASS Class,
+	_In_ ULONG64 End
+);
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+VOID
+ShvTestMemMap(
+	VOID
+)
+{
+	PHYSICAL_MEMORY_RANGE ranges[SHV_TEST_MEMMAP_RANGES];
+	const SHV_MEMMAP_RANGE *expected;
+	PSHV_MEMMAP map;
+	ULONG count;
+
+	map = (PSHV_MEMMAP)ExAllocatePoolWithTag(NonPagedPoolNx,
+		FIELD_OFFSET(SHV_MEMMAP, Ranges) + SHV_MEMMAP_CAPACITY(SHV_TEST_MEMMAP_RANGES) * sizeof(SHV_MEMMAP_RANGE),
+		SHV_TEST_MEMMAP_TAG);
+	if (!SHV_TEST_CHECK(map != NULL))
+	{
+		return;
+	}
+
+	//
+	// The ranges come out sorted and coalesced, with a hole in every gap
+	// and above the last one.  RAM ends where the last range does.
+	//
+	count = ShvTestMemMapRanges(ShvTestMemMapInput, RTL_NUMBER_OF(ShvTestMemMapInput), ranges);
+	ShvMemMapCompile(ranges, count, map);
+
+	if (SHV_TEST_CHECK(map->Count == RTL_NUMBER_OF(ShvTestMemMapExpected)))
+	{
+		for (ULONG i = 0; i < map->Count; i++)
+		{
+			SHV_TEST_CHECK(map->Ranges[i].Base == ShvTestMemMapExpected[i].Base);
+			SHV_TEST_CHECK(map->Ranges[i].End == ShvTestMemMapExpected[i].End);
+			SHV_TEST_CHECK(map->Ranges[i].Class == ShvTestMemMapExpected[i].Class);
+		}
+	}
+
+	SHV_TEST_CHECK(map->TopOfRam == 6 * SHV_TEST_GB);
+
+	//
+	// RAM from the very bottom or to the very top needs no hole there, and
+	// no RAM at all is a single hole.
+	//
+	ranges[0].BaseAddress.QuadPart = 0;
+	ranges[0].NumberOfBytes.QuadPart = SHV_TEST_GB;
+	ranges[1].BaseAddress.QuadPart = 2 * SHV_TEST_GB;
+	ranges[1].NumberOfBytes.QuadPart = MAXULONG64 - 2 * SHV_TEST_GB;
+
+	ShvMemMapCompile(ranges, 2, map);
+
+	SHV_TEST_CHECK(map->Count == 3);
+	SHV_TEST_CHECK(map->Ranges[0].Class == ShvMemoryRam);
+	SHV_TEST_CHECK(map->Ranges[1].Class == ShvMemoryMmio && map->Ranges[1].End == 2 * SHV_TEST_GB);
+	SHV_TEST_CHECK(map->Ranges[2].Class == ShvMemoryRam && map->Ranges[2].End == MAXULONG64);
+
+	ShvMemMapCompile(ranges, 0, map);
+
+	SHV_TEST_CHECK(map->Count == 1);
+	SHV_TEST_CHECK(map->Ranges[0].Class == ShvMemoryMmio && map->Ranges[0].End == MAXULONG64);
+	SHV_TEST_CHECK(map->TopOfRam == 0);
+
+	ExFreePoolWithTag(map, SHV_TEST_MEMMAP_TAG);
+
+	//
+	// Without an index, nothing is RAM.
+	//
+	SHV_TEST_CHECK(ShvTestMemMapIs(0x100000, ShvMemoryMmio, MAXULONG64));
+	SHV_TEST_CHECK(ShvMemMapGetTopOfRam() == 0);
+
+	//
+	// With one, each interval is found from its first byte to its last, and
+	// the next one from the byte after that.
+	//
+	count = ShvTestMemMapRanges(ShvTestMemMapInput, RTL_NUMBER_OF(ShvTestMemMapInput), ranges);
+	ShvTestSetMemoryMap(ranges, count);
+
+	ShvTestConfigureEpt(TRUE, FALSE, FALSE);
+
+	if (!SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+	{
+		return;
+	}
+
+	for (ULONG i = 0; i < RTL_NUMBER_OF(ShvTestMemMapExpected); i++)
+	{
+		expected = &ShvTestMemMapExpected[i];
+
+		SHV_TEST_CHECK(ShvTestMemMapIs(expected->Base, expected->Class, expected->End));
+		SHV_TEST_CHECK(ShvTestMemMapIs(expected->End - 1, expected->Class, expected->End));
+	}
+
+	SHV_TEST_CHECK(ShvTestMemMapIs(MAXULONG64, ShvMemoryMmio, MAXULONG64));
+	SHV_TEST_CHECK(ShvMemMapGetTopOfRam() == 6 * SHV_TEST_GB);
+
+	//
+	// RAM hot-added at the end of a range, and above all of it, is mapped
+	// right away, and only that.  The RAM that was there before stays for
+	// violations to map.
+	//
+	SHV_TEST_CHECK(ShvVmxEptGetPageSize(4 * SHV_TEST_GB) == 0);
+	SHV_TEST_CHECK(ShvVmxEptGetPageSize(6 * SHV_TEST_GB) == 0);
+
+	ranges[count].BaseAddress.QuadPart = 6 * SHV_TEST_GB;
+	ranges[count].NumberOfBytes.QuadPart = VMX_EPT_PAGE_SIZE_2MB;
+	ranges[count + 1].BaseAddress.QuadPart = 8 * SHV_TEST_GB;
+	ranges[count + 1].NumberOfBytes.QuadPart = SHV_TEST_GB;
+	ShvTestSetMemoryMap(ranges, count + 2);
+
+	SHV_TEST_CHECK_SUCCESS(ShvMemMapRefresh());
+
+	SHV_TEST_CHECK(ShvTestMemMapIs(4 * SHV_TEST_GB, ShvMemoryRam, 6 * SHV_TEST_GB + VMX_EPT_PAGE_SIZE_2MB));
+	SHV_TEST_CHECK(ShvTestMemMapIs(7 * SHV_TEST_GB, ShvMemoryMmio, 8 * SHV_TEST_GB));
+	SHV_TEST_CHECK(ShvTestMemMapIs(9 * SHV_TEST_GB - 1, ShvMemoryRam, 9 * SHV_TEST_GB));
+	SHV_TEST_CHECK(ShvMemMapGetTopOfRam() == 9 * SHV_TEST_GB);
+
+	SHV_TEST_CHECK(ShvVmxEptGetPageSize(4 * SHV_TEST_GB) == 0);
+	SHV_TEST_CHECK(ShvVmxEptGetPageSize(6 * SHV_TEST_GB - PAGE_SIZE) == 0);
+	SHV_TEST_CHECK(ShvVmxEptGetPageSize(6 * SHV_TEST_GB) == VMX_EPT_PAGE_SIZE_2MB);
+	SHV_TEST_CHECK(ShvVmxEptGetPageSize(6 * SHV_TEST_GB + VMX_EPT_PAGE_SIZE_2MB) == 0);
+	SHV_TEST_CHECK(ShvVmxEptGetPageSize(8 * SHV_TEST_GB) == VMX_EPT_PAGE_SIZE_1GB);
+
+	ShvTestStopEpt();
+
+	SHV_TEST_CHECK(ShvMemMapGetTopOfRam() == 0);
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+static ULONG
+ShvTestMemMapRanges(
+	_In_reads_(Count) const ULONG64 (*Input)[2],
+	_In_ ULONG Count,
+	_Out_writes_(Count) PPHYSICAL_MEMORY_RANGE Ranges
+)
+{
+	for (ULONG i = 0; i < Count; i++)
+	{
+		Ranges[i].BaseAddress.QuadPart = Input[i][0];
+		Ranges[i].NumberOfBytes.QuadPart = Input[i][1];
+	}
+
+	return Count;
+}
+
+static BOOLEAN
+ShvTestMemMapIs(
+	_In_ ULONG64 Address,
+	_In_ SHV_MEMORY_CLASS Class,
+	_In_ ULONG64 End
+)
+{
+	SHV_MEMORY_CLASS found;
+	ULONG64 end;
+
+	found = ShvMemMapLookup(Address, &end);
+	if ((found != Class) || (end != End))
+	{
+		ShvTestPrint("%llx: got class %u end %llx\n", Address, found, end);
+		return FALSE;
+	}
+
+	return TRUE;
+}
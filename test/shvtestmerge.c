@@ -0,0 +1,298 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvtestmerge.c
+
+Abstract:
+
+	This module builds the page merging module into the test harness.  It
+	is included whole, rather than linked, so that tests can turn merging
+	on and run the scanner themselves.  The frames the module allocates
+	come out of guest memory the test provides, and it reads guest pages
+	through the EPT, the way the guest would.
+
+Author:
+
+	agent (@agent) 16-Oct-2026 - Initial version
+
+Environment:
+
+	User mode only.
+
+--*/
+
+#include "shvtest.h"
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// How many pages of guest memory the module can allocate.
+//
+#define SHV_TEST_MERGE_FRAMES           (64)
+
+// ===========================================================================
+//
+// LOCAL DATA
+//
+// ===========================================================================
+
+static ULONG64 ShvTestMergeFrames = 0;
+static ULONG64 ShvTestMergeFramesUsed = 0;
+
+// ===========================================================================
+//
+// LOCAL PROTOTYPES
+//
+// ===========================================================================
+
+static PVOID
+ShvTestMergeAllocatePool(
+	_In_ POOL_TYPE PoolType,
+	_In_ SIZE_T NumberOfBytes,
+	_In_ ULONG Tag
+);
+
+static VOID
+ShvTestMergeFreePool(
+	_In_ PVOID P,
+	_In_ ULONG Tag
+);
+
+static PHYSICAL_ADDRESS
+ShvTestMergeGetPhysicalAddress(
+	_In_ PVOID BaseAddress
+);
+
+static NTSTATUS
+ShvTestMergeCopyMemory(
+	_In_ PVOID TargetAddress,
+	_In_ MM_COPY_ADDRESS SourceAddress,
+	_In_ SIZE_T NumberOfBytes,
+	_In_ ULONG Flags,
+	_Out_ PSIZE_T NumberOfBytesTransferred
+);
+
+static VOID
+ShvTestMergeMoveQwords(
+	_Out_writes_(Count) PULONG64 Destination,
+	_In_reads_(Count) const ULONG64 *Source,
+	_In_ SIZE_T Count
+);
+
+//
+// Frames have to be host memory the EPT can map guest pages to, and that
+// is the guest memory of the simulated machine.  Everything else the
+// module allocates is ordinary pool.
+//
+#define ExAllocatePoolWithTag           ShvTestMergeAllocatePool
+#define ExFreePoolWithTag               ShvTestMergeFreePool
+#define MmGetPhysicalAddress            ShvTestMergeGetPhysicalAddress
+#define MmCopyMemory                    ShvTestMergeCopyMemory
+#define __movsq                         ShvTestMergeMoveQwords
+
+#include "../shvvmxmerge.c"
+
+#undef ExAllocatePoolWithTag
+#undef ExFreePoolWithTag
+#undef MmGetPhysicalAddress
+#undef MmCopyMemory
+#undef __movsq
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+NTSTATUS
+ShvTestStartMerge(
+	_In_ ULONG64 Frames
+)
+{
+	//
+	// Merging comes up after the EPT, the way the driver brings it up.  A
+	// machine that can't shoot down from root mode leaves it off, which
+	// the caller can tell from ShvVmxMergeAddRange.  A driver load starts
+	// out with nothing counted.
+	//
+	__stosb((PUCHAR)&ShvVmxMergeStatistics, 0, sizeof(ShvVmxMergeStatistics));
+
+	ShvTestMergeFrames = Frames;
+	ShvTestMergeFramesUsed = 0;
+	ShvVmxMergeRequested = TRUE;
+
+	return ShvVmxMergeInitialize();
+}
+
+ULONG
+ShvTestStopMerge(
+	VOID
+)
+{
+	ULONG leaked;
+
+	//
+	// Return how many frames the module didn't give back.
+	//
+	ShvVmxMergeCleanup();
+
+	leaked = (ULONG)__popcnt64(ShvTestMergeFramesUsed);
+
+	ShvVmxMergeRequested = SHV_MERGE_ENABLE;
+	ShvTestMergeFrames = 0;
+	ShvTestMergeFramesUsed = 0;
+
+	return leaked;
+}
+
+VOID
+ShvTestScanMerge(
+	VOID
+)
+{
+	//
+	// What the scanner thread does once the scan period is up.
+	//
+	ExAcquireFastMutex(&ShvVmxMergeLock);
+
+	ShvVmxMergeFillReserve();
+	ShvVmxMergeScan();
+
+	ExReleaseFastMutex(&ShvVmxMergeLock);
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+static PVOID
+ShvTestMergeAllocatePool(
+	_In_ POOL_TYPE PoolType,
+	_In_ SIZE_T NumberOfBytes,
+	_In_ ULONG Tag
+)
+{
+	ULONG index;
+
+	if (NumberOfBytes != PAGE_SIZE)
+	{
+		return ExAllocatePoolWithTag(PoolType, NumberOfBytes, Tag);
+	}
+
+	//
+	// Whole pages come out of guest memory, and run out like pool would.
+	//
+	if (ShvTestMergeFramesUsed == MAXULONG64)
+	{
+		return NULL;
+	}
+
+	_BitScanForward64(&index, ~ShvTestMergeFramesUsed);
+	ShvTestMergeFramesUsed |= 1ULL << index;
+
+	return ShvTestFindGuestMemory(ShvTestMergeFrames + index * PAGE_SIZE);
+}
+
+static VOID
+ShvTestMergeFreePool(
+	_In_ PVOID P,
+	_In_ ULONG Tag
+)
+{
+	ULONG64 offset;
+
+	offset = (PUCHAR)P - (PUCHAR)ShvTestFindGuestMemory(ShvTestMergeFrames);
+
+	if (offset >= SHV_TEST_MERGE_FRAMES * PAGE_SIZE)
+	{
+		ExFreePoolWithTag(P, Tag);
+		return;
+	}
+
+	NT_ASSERT(ShvTestMergeFramesUsed & (1ULL << (offset / PAGE_SIZE)));
+
+	ShvTestMergeFramesUsed &= ~(1ULL << (offset / PAGE_SIZE));
+}
+
+static PHYSICAL_ADDRESS
+ShvTestMergeGetPhysicalAddress(
+	_In_ PVOID BaseAddress
+)
+{
+	PHYSICAL_ADDRESS address;
+	ULONG64 offset;
+
+	offset = (PUCHAR)BaseAddress - (PUCHAR)ShvTestFindGuestMemory(ShvTestMergeFrames);
+
+	if (offset >= SHV_TEST_MERGE_FRAMES * PAGE_SIZE)
+	{
+		return MmGetPhysicalAddress(BaseAddress);
+	}
+
+	address.QuadPart = ShvTestMergeFrames + offset;
+
+	return address;
+}
+
+static NTSTATUS
+ShvTestMergeCopyMemory(
+	_In_ PVOID TargetAddress,
+	_In_ MM_COPY_ADDRESS SourceAddress,
+	_In_ SIZE_T NumberOfBytes,
+	_In_ ULONG Flags,
+	_Out_ PSIZE_T NumberOfBytesTransferred
+)
+{
+	ULONG64 hpa;
+
+	//
+	// The guest reads its physical memory through the EPT, so a merged
+	// page reads back the frame it shares.  Nothing the module reads
+	// crosses a page.
+	//
+	if (Flags == MM_COPY_MEMORY_PHYSICAL)
+	{
+		if ((ShvVmxEptGetAccess(SourceAddress.PhysicalAddress.QuadPart, &hpa) & VMX_EPT_ACCESS_READ) == 0)
+		{
+			*NumberOfBytesTransferred = 0;
+			return STATUS_ACCESS_VIOLATION;
+		}
+
+		SourceAddress.PhysicalAddress.QuadPart = hpa;
+	}
+
+	return MmCopyMemory(TargetAddress, SourceAddress, NumberOfBytes, Flags, NumberOfBytesTransferred);
+}
+
+static VOID
+ShvTestMergeMoveQwords(
+	_Out_writes_(Count) PULONG64 Destination,
+	_In_reads_(Count) const ULONG64 *Source,
+	_In_ SIZE_T Count
+)
+{
+	ULONG64 hpa;
+
+	//
+	// The module writes to host frames of its own through their addresses,
+	// except for lent frames, which it writes through its scratch page
+	// after pointing that at them in the EPT.  The scratch page's address
+	// is in guest memory, so follow the EPT from there.
+	//
+	if (Destination == (PULONG64)ShvVmxMergeScratch)
+	{
+		ShvVmxEptGetAccess(ShvVmxMergeScratchGpa, &hpa);
+		Destination = (PULONG64)ShvTestFindGuestMemory(hpa);
+	}
+
+	__movsq(Destination, Source, Count);
+}
@@ -0,0 +1,368 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvtestmtrr.c
+
+Abstract:
+
+	This module tests the MTRR compiler against synthetic MTRR sets: the
+	fixed ranges below 1 MiB, the precedence of overlapping variable
+	ranges, the default type, and where each uniformly typed range ends
+	and which large pages fit in it.
+
+Author:
+
+	agent (@agent) 16-Oct-2026 - Initial version
+
+Environment:
+
+	User mode only.
+
+--*/
+
+#include "shvtest.h"
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+#define SHV_TEST_MB                     (1024ULL * 1024)
+
+//
+// The physical address width of the synthetic processor, which is also
+// where the map ends.
+//
+#define SHV_TEST_MTRR_BITS              (46)
+#define SHV_TEST_MTRR_LIMIT             (1ULL << SHV_TEST_MTRR_BITS)
+
+//
+// A variable range MSR pair for a naturally aligned power of two sized
+// range.
+//
+#define SHV_TEST_MTRR_BASE(base, type)  ((base) | (type))
+#define SHV_TEST_MTRR_MASK(size)        ((((SHV_TEST_MTRR_LIMIT) - 1) & ~((size) - 1)) | MTRR_PHYSMASK_VALID)
+
+//
+// Eight fixed ranges of the same type, as packed in one fixed range MSR.
+//
+#define SHV_TEST_MTRR_FIXED(type)       (0x0101010101010101ULL * (type))
+
+// ===========================================================================
+//
+// LOCAL TYPES
+//
+// ===========================================================================
+
+//
+// What the compiled map has to say about an address: its type, where the
+// range of that type ends, and the largest page that fits in that range.
+//
+typedef struct _SHV_TEST_MTRR_EXPECT {
+	ULONG64 Address;
+	UCHAR Type;
+	ULONG64 End;
+	ULONG64 PageSize;
+} SHV_TEST_MTRR_EXPECT, *PSHV_TEST_MTRR_EXPECT;
+
+// ===========================================================================
+//
+// LOCAL DATA
+//
+// ===========================================================================
+
+//
+// The types of the 11 fixed range MSRs.  Below 640 KiB is WB, the legacy
+// video hole is UC, and the option ROMs are WP with UC between them.
+//
+static const UCHAR ShvTestMtrrFixed[MTRR_FIXED_RANGE_COUNT / 8] = {
+	WriteBack,
+	WriteBack,
+	Uncacheable,
+	WriteProtected,
+	Uncacheable,
+	Uncacheable,
+	Uncacheable,
+	Uncacheable,
+	Uncacheable,
+	WriteProtected,
+	WriteProtected,
+};
+
+//
+// The default type is UC, and 8 GiB is WB except for:
+//  - a UC range from 3 to 4 GiB, inside the WB one, where UC has to win;
+//  - a WT range from 4 to 4.5 GiB, inside the WB one, where WT has to win;
+//  - a 2 MiB UC window at 5 GiB + 2 MiB, which keeps the WB ranges on
+//    either side of it from ending on a 1 GiB boundary.
+//
+static const SHV_MTRR_VARIABLE ShvTestMtrrVariable[] = {
+	{ SHV_TEST_MTRR_BASE(0, WriteBack), SHV_TEST_MTRR_MASK(8 * SHV_TEST_GB) },
+	{ SHV_TEST_MTRR_BASE(3 * SHV_TEST_GB, Uncacheable), SHV_TEST_MTRR_MASK(SHV_TEST_GB) },
+	{ SHV_TEST_MTRR_BASE(4 * SHV_TEST_GB, WriteThrough), SHV_TEST_MTRR_MASK(512 * SHV_TEST_MB) },
+	{ SHV_TEST_MTRR_BASE(5 * SHV_TEST_GB + 2 * SHV_TEST_MB, Uncacheable), SHV_TEST_MTRR_MASK(2 * SHV_TEST_MB) },
+};
+
+static const SHV_TEST_MTRR_EXPECT ShvTestMtrrExpected[] = {
+	{ 0, WriteBack, 0xa0000, PAGE_SIZE },
+	{ 0x9f000, WriteBack, 0xa0000, PAGE_SIZE },
+	{ 0xa0000, Uncacheable, 0xc0000, PAGE_SIZE },
+	{ 0xc0000, WriteProtected, 0xc8000, PAGE_SIZE },
+	{ 0xc8000, Uncacheable, 0xf0000, PAGE_SIZE },
+	{ 0xf0000, WriteProtected, MTRR_FIXED_RANGE_END, PAGE_SIZE },
+	{ MTRR_FIXED_RANGE_END, WriteBack, 3 * SHV_TEST_GB, VMX_EPT_PAGE_SIZE_1GB },
+	{ 3 * SHV_TEST_GB - PAGE_SIZE, WriteBack, 3 * SHV_TEST_GB, VMX_EPT_PAGE_SIZE_1GB },
+	{ 3 * SHV_TEST_GB, Uncacheable, 4 * SHV_TEST_GB, VMX_EPT_PAGE_SIZE_1GB },
+	{ 4 * SHV_TEST_GB, WriteThrough, 4 * SHV_TEST_GB + 512 * SHV_TEST_MB, VMX_EPT_PAGE_SIZE_2MB },
+	{ 4 * SHV_TEST_GB + 512 * SHV_TEST_MB, WriteBack, 5 * SHV_TEST_GB + 2 * SHV_TEST_MB, VMX_EPT_PAGE_SIZE_2MB },
+	{ 5 * SHV_TEST_GB, WriteBack, 5 * SHV_TEST_GB + 2 * SHV_TEST_MB, VMX_EPT_PAGE_SIZE_2MB },
+	{ 5 * SHV_TEST_GB + 2 * SHV_TEST_MB, Uncacheable, 5 * SHV_TEST_GB + 4 * SHV_TEST_MB, VMX_EPT_PAGE_SIZE_2MB },
+	{ 5 * SHV_TEST_GB + 4 * SHV_TEST_MB, WriteBack, 8 * SHV_TEST_GB, VMX_EPT_PAGE_SIZE_1GB },
+	{ 8 * SHV_TEST_GB, Uncacheable, SHV_TEST_MTRR_LIMIT, VMX_EPT_PAGE_SIZE_1GB },
+};
+
+// ===========================================================================
+//
+// LOCAL PROTOTYPES
+//
+// ===========================================================================
+
+static VOID
+ShvTestMtrrSetState(
+	_Out_ PSHV_MTRR_STATE State
+);
+
+static PSHV_MTRR_RANGE
+ShvTestMtrrFind(
+	_In_ PSHV_MTRR_MAP Map,
+	_In_ ULONG64 Address
+);
+
+static BOOLEAN
+ShvTestMtrrCovers(
+	_In_ PSHV_MTRR_MAP Map
+);
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+VOID
+ShvTestMtrr(
+	VOID
+)
+{
+	static SHV_MTRR_STATE state;
+	static SHV_MTRR_MAP map;
+	PSHV_MTRR_RANGE range;
+	ULONG64 end;
+	UCHAR type;
+
+	//
+	// Every address gets its type from the fixed ranges, the variable
+	// ones or the default, and its range ends at the next change of type,
+	// not at the next MTRR boundary.
+	//
+	ShvTestMtrrSetState(&state);
+
+	if (SHV_TEST_CHECK_SUCCESS(ShvMtrrCompile(&state, &map)))
+	{
+		SHV_TEST_CHECK(ShvTestMtrrCovers(&map));
+		SHV_TEST_CHECK(map.Count == RTL_NUMBER_OF(ShvTestMtrrExpected) - 3);
+
+		for (ULONG i = 0; i < RTL_NUMBER_OF(ShvTestMtrrExpected); i++)
+		{
+			range = ShvTestMtrrFind(&map, ShvTestMtrrExpected[i].Address);
+
+			if (!SHV_TEST_CHECK(range != NULL) ||
+				!SHV_TEST_CHECK(range->Type == ShvTestMtrrExpected[i].Type) ||
+				!SHV_TEST_CHECK(range->End == ShvTestMtrrExpected[i].End) ||
+				!SHV_TEST_CHECK(range->PageSize == ShvTestMtrrExpected[i].PageSize))
+			{
+				ShvTestPrint("%llx: got type %u end %llx page %llx\n",
+					ShvTestMtrrExpected[i].Address,
+					(range != NULL) ? range->Type : 0xff,
+					(range != NULL) ? range->End : 0,
+					(range != NULL) ? range->PageSize : 0);
+			}
+		}
+	}
+
+	//
+	// With the fixed ranges off, the first MiB is typed by the variable
+	// ranges like the rest, and merges into the WB range above it.
+	//
+	state.DefType &= ~MTRR_DEF_FIXED_ENABLE;
+
+	if (SHV_TEST_CHECK_SUCCESS(ShvMtrrCompile(&state, &map)))
+	{
+		range = ShvTestMtrrFind(&map, 0xa0000);
+		SHV_TEST_CHECK((range != NULL) && (range->Base == 0) && (range->Type == WriteBack));
+		SHV_TEST_CHECK((range != NULL) && (range->End == 3 * SHV_TEST_GB));
+	}
+
+	//
+	// Without any variable range, everything has the default type.  With
+	// the MTRRs off, everything is UC, whatever the default type.
+	//
+	ShvTestMtrrSetState(&state);
+	state.DefType = MTRR_DEF_ENABLE | WriteBack;
+	state.FixedSupported = FALSE;
+	state.VariableCount = 0;
+
+	if (SHV_TEST_CHECK_SUCCESS(ShvMtrrCompile(&state, &map)))
+	{
+		SHV_TEST_CHECK(map.Count == 1);
+		SHV_TEST_CHECK(map.Ranges[0].Type == WriteBack);
+		SHV_TEST_CHECK(map.Ranges[0].End == SHV_TEST_MTRR_LIMIT);
+	}
+
+	ShvTestMtrrSetState(&state);
+	state.DefType = WriteBack;
+
+	if (SHV_TEST_CHECK_SUCCESS(ShvMtrrCompile(&state, &map)))
+	{
+		SHV_TEST_CHECK(map.Count == 1);
+		SHV_TEST_CHECK(map.Ranges[0].Type == Uncacheable);
+	}
+
+	//
+	// Overlaps other than UC and WT/WB are undefined, and have to be UC.
+	//
+	ShvTestMtrrSetState(&state);
+	state.Variable[2].PhysBase = SHV_TEST_MTRR_BASE(4 * SHV_TEST_GB, WriteCombining);
+
+	if (SHV_TEST_CHECK_SUCCESS(ShvMtrrCompile(&state, &map)))
+	{
+		range = ShvTestMtrrFind(&map, 4 * SHV_TEST_GB);
+		SHV_TEST_CHECK((range != NULL) && (range->Type == Uncacheable));
+	}
+
+	//
+	// The same MTRRs, read from the MSRs of the processor.  The identity
+	// map asks for a type and where it ends, and mapping a region with a
+	// large page is only allowed when the whole region has one type.
+	//
+	ShvTestSetMsr(MSR_IA32_MTRRCAP, MTRR_CAP_FIXED | RTL_NUMBER_OF(ShvTestMtrrVariable));
+	ShvTestSetMsr(MSR_IA32_MTRR_DEF_TYPE, MTRR_DEF_ENABLE | MTRR_DEF_FIXED_ENABLE | Uncacheable);
+	ShvTestSetMsr(MSR_IA32_MTRR_FIX64K_00000, SHV_TEST_MTRR_FIXED(ShvTestMtrrFixed[0]));
+
+	for (ULONG i = 0; i < 2; i++)
+	{
+		ShvTestSetMsr(MSR_IA32_MTRR_FIX16K_80000 + i, SHV_TEST_MTRR_FIXED(ShvTestMtrrFixed[1 + i]));
+	}
+
+	for (ULONG i = 0; i < 8; i++)
+	{
+		ShvTestSetMsr(MSR_IA32_MTRR_FIX4K_C0000 + i, SHV_TEST_MTRR_FIXED(ShvTestMtrrFixed[3 + i]));
+	}
+
+	for (ULONG i = 0; i < RTL_NUMBER_OF(ShvTestMtrrVariable); i++)
+	{
+		ShvTestSetMsr(MSR_IA32_MTRR_PHYSBASE0 + i * 2, ShvTestMtrrVariable[i].PhysBase);
+		ShvTestSetMsr(MSR_IA32_MTRR_PHYSMASK0 + i * 2, ShvTestMtrrVariable[i].PhysMask);
+	}
+
+	if (!SHV_TEST_CHECK_SUCCESS(ShvMtrrInitialize()))
+	{
+		return;
+	}
+
+	for (ULONG i = 0; i < RTL_NUMBER_OF(ShvTestMtrrExpected); i++)
+	{
+		type = ShvMtrrLookup(ShvTestMtrrExpected[i].Address, &end);
+
+		SHV_TEST_CHECK(type == ShvTestMtrrExpected[i].Type);
+		SHV_TEST_CHECK(end == ShvTestMtrrExpected[i].End);
+	}
+
+	SHV_TEST_CHECK(ShvMtrrGetMemoryType(0, VMX_EPT_PAGE_SIZE_2MB, &type) == FALSE);
+	SHV_TEST_CHECK(ShvMtrrGetMemoryType(2 * SHV_TEST_GB, VMX_EPT_PAGE_SIZE_1GB, &type) && (type == WriteBack));
+	SHV_TEST_CHECK(ShvMtrrGetMemoryType(5 * SHV_TEST_GB, VMX_EPT_PAGE_SIZE_1GB, &type) == FALSE);
+	SHV_TEST_CHECK(ShvMtrrGetMemoryType(5 * SHV_TEST_GB, VMX_EPT_PAGE_SIZE_2MB, &type) && (type == WriteBack));
+	SHV_TEST_CHECK(ShvMtrrGetMemoryType(5 * SHV_TEST_GB + 2 * SHV_TEST_MB, VMX_EPT_PAGE_SIZE_2MB, &type) &&
+		(type == Uncacheable));
+	SHV_TEST_CHECK(ShvMtrrGetMemoryType(4 * SHV_TEST_GB + 510 * SHV_TEST_MB, VMX_EPT_PAGE_SIZE_2MB, &type) &&
+		(type == WriteThrough));
+	SHV_TEST_CHECK(ShvMtrrGetMemoryType(4 * SHV_TEST_GB + 511 * SHV_TEST_MB, VMX_EPT_PAGE_SIZE_2MB, &type) == FALSE);
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+static VOID
+ShvTestMtrrSetState(
+	_Out_ PSHV_MTRR_STATE State
+)
+{
+	__stosb((PUCHAR)State, 0, sizeof(*State));
+
+	State->DefType = MTRR_DEF_ENABLE | MTRR_DEF_FIXED_ENABLE | Uncacheable;
+	State->PhysicalAddressBits = SHV_TEST_MTRR_BITS;
+	State->FixedSupported = TRUE;
+	State->VariableCount = RTL_NUMBER_OF(ShvTestMtrrVariable);
+
+	for (ULONG i = 0; i < MTRR_FIXED_RANGE_COUNT; i++)
+	{
+		State->Fixed[i] = ShvTestMtrrFixed[i / 8];
+	}
+
+	for (ULONG i = 0; i < RTL_NUMBER_OF(ShvTestMtrrVariable); i++)
+	{
+		State->Variable[i] = ShvTestMtrrVariable[i];
+	}
+}
+
+static PSHV_MTRR_RANGE
+ShvTestMtrrFind(
+	_In_ PSHV_MTRR_MAP Map,
+	_In_ ULONG64 Address
+)
+{
+	for (ULONG i = 0; i < Map->Count; i++)
+	{
+		if ((Address >= Map->Ranges[i].Base) && (Address < Map->Ranges[i].End))
+		{
+			return &Map->Ranges[i];
+		}
+	}
+
+	return NULL;
+}
+
+static BOOLEAN
+ShvTestMtrrCovers(
+	_In_ PSHV_MTRR_MAP Map
+)
+{
+	//
+	// The ranges are sorted, cover the whole address space without gaps,
+	// and no two neighbours have the same type, or they would be one.
+	//
+	if ((Map->Count == 0) ||
+		(Map->Ranges[0].Base != 0) ||
+		(Map->Ranges[Map->Count - 1].End != SHV_TEST_MTRR_LIMIT))
+	{
+		return FALSE;
+	}
+
+	for (ULONG i = 1; i < Map->Count; i++)
+	{
+		if ((Map->Ranges[i].Base != Map->Ranges[i - 1].End) ||
+			(Map->Ranges[i].Type == Map->Ranges[i - 1].Type))
+		{
+			return FALSE;
+		}
+	}
+
+	return TRUE;
+}
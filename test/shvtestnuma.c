@@ -0,0 +1,431 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvtestnuma.c
+
+Abstract:
+
+	This module tests that each node gets its own replica of the identity
+	map, built from its own memory, and that violations keep every replica
+	the same.  It also benchmarks page walk latency with and without the
+	replicas.
+
+Author:
+
+	agent (@agent) 16-Oct-2026 - Initial version
+
+Environment:
+
+	User mode only.
+
+--*/
+
+#include <string.h>
+#include "shvtest.h"
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+#define SHV_TEST_MB                     (1024ULL * 1024)
+#define SHV_TEST_TB                     (1024 * SHV_TEST_GB)
+
+//
+// The simulated machine the test runs on, and how many addresses each
+// node translates in the benchmark.
+//
+#define SHV_TEST_NUMA_PROCESSORS        (8)
+#define SHV_TEST_NUMA_NODES             (4)
+#define SHV_TEST_NUMA_FAULTS            (32)
+#define SHV_TEST_NUMA_WALKS             (2 * 1024 * 1024)
+
+// ===========================================================================
+//
+// LOCAL TYPES
+//
+// ===========================================================================
+
+typedef struct _SHV_TEST_NUMA_MODE {
+	PCSTR Name;
+	ULONG64 Capabilities;
+	ULONG64 Ram;
+} SHV_TEST_NUMA_MODE, *PSHV_TEST_NUMA_MODE;
+
+// ===========================================================================
+//
+// LOCAL DATA
+//
+// ===========================================================================
+
+static const ULONG ShvTestNumaNodes[] = { 1, 2, 4 };
+
+//
+// The 4 KiB map is far bigger than the caches, so its walks mostly go to
+// memory, which is where a remote node costs the most.
+//
+static const SHV_TEST_NUMA_MODE ShvTestNumaModes[] = {
+	{ "4 KiB", SHV_TEST_EPT_CAPS_4KB, 64 * SHV_TEST_GB },
+	{ "2 MiB", SHV_TEST_EPT_CAPS_2MB, 2 * SHV_TEST_TB },
+};
+
+// ===========================================================================
+//
+// LOCAL PROTOTYPES
+//
+// ===========================================================================
+
+static ULONG64
+ShvTestNumaEptp(
+	_In_ ULONG Processor
+);
+
+static ULONG
+ShvTestNumaFirstProcessor(
+	_In_ ULONG Node,
+	_In_ ULONG Processors,
+	_In_ ULONG Nodes
+);
+
+static VOID
+ShvTestNumaFault(
+	_In_ ULONG Processor,
+	_In_ ULONG64 Gpa
+);
+
+static VOID
+ShvTestNumaCompare(
+	_In_ ULONG Processors,
+	_In_ ULONG64 Top
+);
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+VOID
+ShvTestReplication(
+	VOID
+)
+{
+	ULONG64 eptp[SHV_TEST_NUMA_PROCESSORS];
+	ULONG64 state, gpa, hpa;
+	ULONG node, other;
+
+	ShvTestSetMsr(MSR_IA32_VMX_EPT_VPID_CAP, SHV_TEST_EPT_CAPS_4KB);
+	ShvTestSetTypicalMemoryMap(4 * SHV_TEST_GB);
+
+	//
+	// Without replication every LP walks the one identity map.
+	//
+	ShvTestSetProcessors(SHV_TEST_NUMA_PROCESSORS, SHV_TEST_NUMA_NODES);
+	ShvTestConfigureEpt(TRUE, FALSE, FALSE);
+
+	if (SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+	{
+		for (ULONG p = 1; p < SHV_TEST_NUMA_PROCESSORS; p++)
+		{
+			SHV_TEST_CHECK(ShvTestNumaEptp(p) == ShvTestNumaEptp(0));
+		}
+
+		ShvTestStopEpt();
+	}
+
+	//
+	// Nor is there anything to replicate on a machine with one node.
+	//
+	ShvTestSetProcessors(SHV_TEST_NUMA_PROCESSORS, 1);
+	ShvTestConfigureEpt(TRUE, FALSE, TRUE);
+
+	if (SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+	{
+		for (ULONG p = 1; p < SHV_TEST_NUMA_PROCESSORS; p++)
+		{
+			SHV_TEST_CHECK(ShvTestNumaEptp(p) == ShvTestNumaEptp(0));
+		}
+
+		ShvTestStopEpt();
+	}
+
+	//
+	// With replication, LPs on the same node share a replica, LPs on
+	// different nodes never do, and no replica has a table on another
+	// node.
+	//
+	ShvTestSetProcessors(SHV_TEST_NUMA_PROCESSORS, SHV_TEST_NUMA_NODES);
+
+	if (!SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+	{
+		return;
+	}
+
+	for (ULONG p = 0; p < SHV_TEST_NUMA_PROCESSORS; p++)
+	{
+		eptp[p] = ShvTestNumaEptp(p);
+	}
+
+	for (ULONG p = 0; p < SHV_TEST_NUMA_PROCESSORS; p++)
+	{
+		node = p * SHV_TEST_NUMA_NODES / SHV_TEST_NUMA_PROCESSORS;
+
+		for (ULONG q = 0; q < SHV_TEST_NUMA_PROCESSORS; q++)
+		{
+			other = q * SHV_TEST_NUMA_NODES / SHV_TEST_NUMA_PROCESSORS;
+
+			SHV_TEST_CHECK((eptp[p] == eptp[q]) == (node == other));
+		}
+	}
+
+	ShvTestNumaCompare(SHV_TEST_NUMA_PROCESSORS, 0);
+
+	//
+	// Violations taken on any node map the region in every replica, from
+	// the memory of the node the replica is on.
+	//
+	state = 0x9e3779b97f4a7c15ULL;
+
+	for (ULONG i = 0; i < SHV_TEST_NUMA_FAULTS; i++)
+	{
+		gpa = (SHV_TEST_MB + ShvTestRandom(&state) % (3 * SHV_TEST_GB)) & ~(PAGE_SIZE - 1);
+
+		ShvTestNumaFault(i % SHV_TEST_NUMA_PROCESSORS, gpa);
+	}
+
+	ShvTestNumaCompare(SHV_TEST_NUMA_PROCESSORS, 3 * SHV_TEST_GB + SHV_TEST_MB);
+
+	//
+	// And whichever LP took the violation, every LP translates the address.
+	//
+	state = 0x9e3779b97f4a7c15ULL;
+
+	for (ULONG i = 0; i < SHV_TEST_NUMA_FAULTS; i++)
+	{
+		gpa = (SHV_TEST_MB + ShvTestRandom(&state) % (3 * SHV_TEST_GB)) & ~(PAGE_SIZE - 1);
+
+		for (ULONG p = 0; p < SHV_TEST_NUMA_PROCESSORS; p++)
+		{
+			ShvTestSetCurrentProcessor(p);
+			SHV_TEST_CHECK(ShvVmxEptTranslateGpa(gpa, FALSE, &hpa) && (hpa == gpa));
+		}
+	}
+
+	ShvTestSetCurrentProcessor(0);
+	ShvTestStopEpt();
+}
+
+VOID
+ShvTestReplicationBenchmark(
+	VOID
+)
+{
+	SHV_EPT_INSPECTION inspection;
+	ULONG64 start, walk, state, hpa, total, worst;
+	volatile ULONG64 sink;
+	ULONG processors, processor;
+
+	//
+	// Each node walks the map from a thread bound to that node, so a walk
+	// of a remote table costs what it would on the machine.  On a machine
+	// with fewer nodes than simulated the binding falls back to every
+	// processor, and replication can only show its bookkeeping cost.
+	//
+	ShvTestPrint("%u processors and %u nodes available\n", ShvTestPlatProcessorCount(), ShvTestPlatNodeCount());
+	ShvTestPrint("%-6s %8s %5s %6s %12s %10s %10s\n", "pages", "RAM", "nodes", "copies", "tables KiB", "walk ns", "worst ns");
+
+	for (ULONG m = 0; m < RTL_NUMBER_OF(ShvTestNumaModes); m++)
+	{
+		ShvTestSetTypicalMemoryMap(ShvTestNumaModes[m].Ram);
+		ShvTestSetMsr(MSR_IA32_VMX_EPT_VPID_CAP, ShvTestNumaModes[m].Capabilities);
+
+		for (ULONG n = 0; n < RTL_NUMBER_OF(ShvTestNumaNodes); n++)
+		{
+			for (ULONG r = 0; r < 2; r++)
+			{
+				if (ShvTestNumaNodes[n] == 1 && r != 0)
+				{
+					continue;
+				}
+
+				processors = 2 * ShvTestNumaNodes[n];
+
+				ShvTestSetProcessors(processors, ShvTestNumaNodes[n]);
+				ShvTestConfigureEpt(FALSE, FALSE, r != 0);
+
+				if (!SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+				{
+					return;
+				}
+
+				ShvVmxEptInspect(&inspection);
+
+				total = 0;
+				worst = 0;
+				sink = 0;
+
+				for (ULONG node = 0; node < ShvTestNumaNodes[n]; node++)
+				{
+					processor = ShvTestNumaFirstProcessor(node, processors, ShvTestNumaNodes[n]);
+
+					ShvTestSetCurrentProcessor(processor);
+					ShvTestPlatBindToNode(node);
+
+					state = 0x9e3779b97f4a7c15ULL + node;
+
+					start = ShvTestNow();
+
+					for (ULONG i = 0; i < SHV_TEST_NUMA_WALKS; i++)
+					{
+						ShvVmxEptTranslateGpa(ShvTestRandom(&state) % ShvTestNumaModes[m].Ram, FALSE, &hpa);
+						sink += hpa;
+					}
+
+					walk = ShvTestNow() - start;
+
+					total += walk;
+					worst = max(worst, walk);
+				}
+
+				ShvTestPlatBindToNode(MM_ANY_NODE_OK);
+				ShvTestSetCurrentProcessor(0);
+
+				ShvTestPrint("%-6s %5llu GiB %5u %6u %12llu %10.1f %10.1f\n",
+					ShvTestNumaModes[m].Name,
+					ShvTestNumaModes[m].Ram / SHV_TEST_GB,
+					ShvTestNumaNodes[n],
+					(r != 0) ? ShvTestNumaNodes[n] + 1 : 1,
+					inspection.TableBytes / 1024,
+					(double)total / ShvTestNumaNodes[n] / SHV_TEST_NUMA_WALKS,
+					(double)worst / SHV_TEST_NUMA_WALKS);
+
+				ShvTestStopEpt();
+			}
+		}
+	}
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+static ULONG64
+ShvTestNumaEptp(
+	_In_ ULONG Processor
+)
+{
+	ULONG64 eptp;
+
+	ShvTestSetCurrentProcessor(Processor);
+	__vmx_vmread(EPT_POINTER, (PSIZE_T)&eptp);
+	ShvTestSetCurrentProcessor(0);
+
+	return eptp;
+}
+
+static ULONG
+ShvTestNumaFirstProcessor(
+	_In_ ULONG Node,
+	_In_ ULONG Processors,
+	_In_ ULONG Nodes
+)
+{
+	//
+	// The harness puts processor p on node p * Nodes / Processors.
+	//
+	return (Node * Processors + Nodes - 1) / Nodes;
+}
+
+static VOID
+ShvTestNumaFault(
+	_In_ ULONG Processor,
+	_In_ ULONG64 Gpa
+)
+{
+	SHV_VP_STATE vpState;
+	KIRQL irql;
+
+	//
+	// A read of an address that isn't mapped yet, on the given VP.
+	//
+	__stosb((PUCHAR)&vpState, 0, sizeof(vpState));
+
+	ShvTestSetCurrentProcessor(Processor);
+	KeRaiseIrql(HIGH_LEVEL, &irql);
+
+	__vmx_vmwrite(GUEST_PHYSICAL_ADDRESS, Gpa);
+	__vmx_vmwrite(EXIT_QUALIFICATION, VMX_EPT_ACCESS_READ);
+
+	ShvVmxEptHandleViolation(&vpState);
+
+	KeLowerIrql(irql);
+	ShvTestSetCurrentProcessor(0);
+}
+
+static VOID
+ShvTestNumaCompare(
+	_In_ ULONG Processors,
+	_In_ ULONG64 Top
+)
+{
+	PVOID firstImage, image;
+	SIZE_T firstSize, size;
+	ULONG64 hpa, firstHpa, mismatches;
+	BOOLEAN mapped;
+	ULONG node;
+
+	ShvTestSetCurrentProcessor(0);
+
+	if (!SHV_TEST_CHECK_SUCCESS(ShvTestWriteEptImage(&firstImage, &firstSize)))
+	{
+		return;
+	}
+
+	//
+	// Every LP has to see the same leaves, which the image records, and
+	// translate every page below Top the same way, through tables on its
+	// own node only.
+	//
+	for (ULONG p = 0; p < Processors; p++)
+	{
+		ShvTestSetCurrentProcessor(p);
+
+		node = KeGetCurrentNodeNumber();
+		SHV_TEST_CHECK(ShvTestCountEptTablesOffNode(node) == 0);
+
+		if (SHV_TEST_CHECK_SUCCESS(ShvTestWriteEptImage(&image, &size)))
+		{
+			SHV_TEST_CHECK((size == firstSize) && (memcmp(image, firstImage, size) == 0));
+
+			ShvTestPlatFree(image);
+		}
+
+		//
+		// Only what was faulted in is mapped, and it's mapped in every
+		// replica or none, so count the pages where this LP and LP 0
+		// disagree rather than checking each one.
+		//
+		mismatches = 0;
+
+		for (ULONG64 gpa = 0; gpa < Top; gpa += PAGE_SIZE)
+		{
+			mapped = ShvVmxEptTranslateGpa(gpa, FALSE, &hpa);
+
+			ShvTestSetCurrentProcessor(0);
+			mismatches += (mapped != ShvVmxEptTranslateGpa(gpa, FALSE, &firstHpa)) ||
+				(mapped && (hpa != gpa || firstHpa != gpa));
+			ShvTestSetCurrentProcessor(p);
+		}
+
+		SHV_TEST_CHECK(mismatches == 0);
+	}
+
+	ShvTestSetCurrentProcessor(0);
+	ShvTestPlatFree(firstImage);
+}
@@ -0,0 +1,481 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvtestplat.c
+
+Abstract:
+
+	This module implements what the test harness needs from the operating
+	system it runs on: memory, threads and a clock.  It is the only part of
+	the harness that sees the platform headers, which can't be mixed with
+	the kernel definitions the hypervisor modules are built against.
+
+Author:
+
+	agent (@agent) 16-Oct-2026 - Initial version
+
+Environment:
+
+	User mode only.
+
+--*/
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <malloc.h>
+#define MM_ANY_NODE_OK 0x80000000
+#define SHV_TEST_MAX_PROCESSORS MAXIMUM_WAIT_OBJECTS
+#else
+#define _GNU_SOURCE
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#include "shvtest.h"
+#endif
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// The mbind policy that only allows the given nodes, from numaif.h, which
+// isn't always installed.
+//
+#define SHV_TEST_PLAT_MPOL_BIND         (2)
+
+// ===========================================================================
+//
+// LOCAL TYPES
+//
+// ===========================================================================
+
+typedef struct _SHV_TEST_PLAT_THREAD {
+	ULONG Index;
+	VOID (*Routine)(ULONG Index, PVOID Context);
+	PVOID Context;
+} SHV_TEST_PLAT_THREAD, *PSHV_TEST_PLAT_THREAD;
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+#if defined(_WIN32)
+
+static DWORD WINAPI
+ShvTestPlatThread(
+	_In_ PVOID Parameter
+)
+{
+	PSHV_TEST_PLAT_THREAD thread;
+
+	thread = (PSHV_TEST_PLAT_THREAD)Parameter;
+	thread->Routine(thread->Index, thread->Context);
+
+	return 0;
+}
+
+PVOID
+ShvTestPlatAllocate(
+	_In_ SIZE_T Size,
+	_In_ SIZE_T Alignment
+)
+{
+	return _aligned_malloc(Size, Alignment);
+}
+
+VOID
+ShvTestPlatFree(
+	_In_ PVOID P
+)
+{
+	_aligned_free(P);
+}
+
+PVOID
+ShvTestPlatAllocatePages(
+	_In_ SIZE_T Size,
+	_In_ ULONG Node
+)
+{
+	ULONG highest;
+
+	//
+	// Place the memory on the real node the simulated one maps to, if
+	// the machine has more than one.
+	//
+	if ((Node != MM_ANY_NODE_OK) && GetNumaHighestNodeNumber(&highest) && (highest > 0))
+	{
+		return VirtualAllocExNuma(GetCurrentProcess(),
+			NULL,
+			Size,
+			MEM_RESERVE | MEM_COMMIT,
+			PAGE_READWRITE,
+			Node % (highest + 1));
+	}
+
+	return VirtualAlloc(NULL, Size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+}
+
+VOID
+ShvTestPlatFreePages(
+	_In_ PVOID Base,
+	_In_ SIZE_T Size
+)
+{
+	UNREFERENCED_PARAMETER(Size);
+
+	VirtualFree(Base, 0, MEM_RELEASE);
+}
+
+ULONG64
+ShvTestPlatNanoseconds(
+	VOID
+)
+{
+	static LARGE_INTEGER frequency;
+	LARGE_INTEGER counter;
+
+	if (frequency.QuadPart == 0)
+	{
+		QueryPerformanceFrequency(&frequency);
+	}
+
+	QueryPerformanceCounter(&counter);
+
+	return (ULONG64)(counter.QuadPart / frequency.QuadPart) * 1000000000ULL +
+		(ULONG64)(counter.QuadPart % frequency.QuadPart) * 1000000000ULL / frequency.QuadPart;
+}
+
+ULONG
+ShvTestPlatProcessorCount(
+	VOID
+)
+{
+	return GetActiveProcessorCount(ALL_PROCESSOR_GROUPS);
+}
+
+ULONG
+ShvTestPlatNodeCount(
+	VOID
+)
+{
+	ULONG highest;
+
+	if (!GetNumaHighestNodeNumber(&highest))
+	{
+		return 1;
+	}
+
+	return highest + 1;
+}
+
+VOID
+ShvTestPlatBindToNode(
+	_In_ ULONG Node
+)
+{
+	GROUP_AFFINITY affinity;
+	DWORD_PTR process, system;
+
+	//
+	// Any node is anywhere the process may run.
+	//
+	if (Node == MM_ANY_NODE_OK)
+	{
+		if (GetProcessAffinityMask(GetCurrentProcess(), &process, &system))
+		{
+			SetThreadAffinityMask(GetCurrentThread(), process);
+		}
+
+		return;
+	}
+
+	if (GetNumaNodeProcessorMaskEx((USHORT)(Node % ShvTestPlatNodeCount()), &affinity))
+	{
+		SetThreadGroupAffinity(GetCurrentThread(), &affinity, NULL);
+	}
+}
+
+VOID
+ShvTestPlatRunThreads(
+	_In_ ULONG Count,
+	_In_ VOID (*Routine)(ULONG Index, PVOID Context),
+	_In_opt_ PVOID Context
+)
+{
+	SHV_TEST_PLAT_THREAD threads[SHV_TEST_MAX_PROCESSORS];
+	HANDLE handles[SHV_TEST_MAX_PROCESSORS];
+	ULONG processors;
+
+	processors = ShvTestPlatProcessorCount();
+
+	for (ULONG i = 0; i < Count && i < SHV_TEST_MAX_PROCESSORS; i++)
+	{
+		threads[i].Index = i;
+		threads[i].Routine = Routine;
+		threads[i].Context = Context;
+
+		handles[i] = CreateThread(NULL, 0, ShvTestPlatThread, &threads[i], CREATE_SUSPENDED, NULL);
+
+		//
+		// Keep each simulated LP on a real one of its own while there are
+		// enough of them, so that timings aren't skewed by migration.
+		//
+		if (processors <= 64)
+		{
+			SetThreadAffinityMask(handles[i], (DWORD_PTR)1 << (i % processors));
+		}
+
+		ResumeThread(handles[i]);
+	}
+
+	WaitForMultipleObjects(min(Count, SHV_TEST_MAX_PROCESSORS), handles, TRUE, INFINITE);
+
+	for (ULONG i = 0; i < Count && i < SHV_TEST_MAX_PROCESSORS; i++)
+	{
+		CloseHandle(handles[i]);
+	}
+}
+
+#else
+
+static PVOID
+ShvTestPlatThread(
+	_In_ PVOID Parameter
+)
+{
+	PSHV_TEST_PLAT_THREAD thread;
+
+	thread = (PSHV_TEST_PLAT_THREAD)Parameter;
+	thread->Routine(thread->Index, thread->Context);
+
+	return NULL;
+}
+
+PVOID
+ShvTestPlatAllocate(
+	_In_ SIZE_T Size,
+	_In_ SIZE_T Alignment
+)
+{
+	PVOID p;
+
+	if (posix_memalign(&p, Alignment, Size) != 0)
+	{
+		return NULL;
+	}
+
+	return p;
+}
+
+VOID
+ShvTestPlatFree(
+	_In_ PVOID P
+)
+{
+	free(P);
+}
+
+PVOID
+ShvTestPlatAllocatePages(
+	_In_ SIZE_T Size,
+	_In_ ULONG Node
+)
+{
+	PVOID base;
+
+	base = mmap(NULL, Size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (base == MAP_FAILED)
+	{
+		return NULL;
+	}
+
+#if defined(__linux__)
+	//
+	// Place the memory on the real node the simulated one maps to, if
+	// the machine has more than one.  Nothing has touched it yet, so
+	// every page is allocated there.
+	//
+	if ((Node != MM_ANY_NODE_OK) && (ShvTestPlatNodeCount() > 1))
+	{
+		unsigned long mask;
+
+		mask = 1UL << (Node % ShvTestPlatNodeCount());
+		syscall(SYS_mbind, base, Size, SHV_TEST_PLAT_MPOL_BIND, &mask, sizeof(mask) * 8, 0);
+	}
+#else
+	UNREFERENCED_PARAMETER(Node);
+#endif
+
+	return base;
+}
+
+VOID
+ShvTestPlatFreePages(
+	_In_ PVOID Base,
+	_In_ SIZE_T Size
+)
+{
+	munmap(Base, Size);
+}
+
+ULONG64
+ShvTestPlatNanoseconds(
+	VOID
+)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (ULONG64)now.tv_sec * 1000000000ULL + (ULONG64)now.tv_nsec;
+}
+
+ULONG
+ShvTestPlatProcessorCount(
+	VOID
+)
+{
+	return (ULONG)sysconf(_SC_NPROCESSORS_ONLN);
+}
+
+ULONG
+ShvTestPlatNodeCount(
+	VOID
+)
+{
+	static ULONG count = 0;
+	char path[64];
+
+	//
+	// Count the nodes the kernel lists once, since they don't change while
+	// the harness runs, up to as many as a node mask holds.
+	//
+	if (count == 0)
+	{
+		do
+		{
+			snprintf(path, sizeof(path), "/sys/devices/system/node/node%u", count);
+		} while ((access(path, F_OK) == 0) && (++count < sizeof(unsigned long) * 8));
+
+		count = max(count, 1);
+	}
+
+	return count;
+}
+
+VOID
+ShvTestPlatBindToNode(
+	_In_ ULONG Node
+)
+{
+#if defined(__linux__)
+	unsigned int first, last;
+	char path[64];
+	cpu_set_t set;
+	FILE *list;
+	int next;
+
+	CPU_ZERO(&set);
+
+	if ((Node == MM_ANY_NODE_OK) || (ShvTestPlatNodeCount() == 1))
+	{
+		for (ULONG i = 0; i < ShvTestPlatProcessorCount() && i < CPU_SETSIZE; i++)
+		{
+			CPU_SET(i, &set);
+		}
+	}
+	else
+	{
+		//
+		// The processors of a node are listed as ranges, like 0-3,8-11.
+		//
+		snprintf(path, sizeof(path), "/sys/devices/system/node/node%u/cpulist", Node % ShvTestPlatNodeCount());
+
+		list = fopen(path, "r");
+		if (list == NULL)
+		{
+			return;
+		}
+
+		while (fscanf(list, "%u", &first) == 1)
+		{
+			last = first;
+			next = fgetc(list);
+
+			if ((next == '-') && (fscanf(list, "%u", &last) == 1))
+			{
+				next = fgetc(list);
+			}
+
+			for (unsigned int i = first; i <= last && i < CPU_SETSIZE; i++)
+			{
+				CPU_SET(i, &set);
+			}
+
+			if (next != ',')
+			{
+				break;
+			}
+		}
+
+		fclose(list);
+	}
+
+	pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+	UNREFERENCED_PARAMETER(Node);
+#endif
+}
+
+VOID
+ShvTestPlatRunThreads(
+	_In_ ULONG Count,
+	_In_ VOID (*Routine)(ULONG Index, PVOID Context),
+	_In_opt_ PVOID Context
+)
+{
+	SHV_TEST_PLAT_THREAD threads[SHV_TEST_MAX_PROCESSORS];
+	pthread_t handles[SHV_TEST_MAX_PROCESSORS];
+	ULONG processors;
+
+	processors = ShvTestPlatProcessorCount();
+
+	for (ULONG i = 0; i < Count && i < SHV_TEST_MAX_PROCESSORS; i++)
+	{
+		threads[i].Index = i;
+		threads[i].Routine = Routine;
+		threads[i].Context = Context;
+
+		pthread_create(&handles[i], NULL, ShvTestPlatThread, &threads[i]);
+
+#if defined(__linux__)
+		{
+			cpu_set_t set;
+
+			CPU_ZERO(&set);
+			CPU_SET(i % processors, &set);
+			pthread_setaffinity_np(handles[i], sizeof(set), &set);
+		}
+#endif
+	}
+
+	for (ULONG i = 0; i < Count && i < SHV_TEST_MAX_PROCESSORS; i++)
+	{
+		pthread_join(handles[i], NULL);
+	}
+}
+
+#endif
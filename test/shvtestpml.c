@@ -0,0 +1,119 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvtestpml.c
+
+Abstract:
+
+	This module builds the PML module into the test harness.  It is
+	included whole, rather than linked, so that tests can turn PML on, and
+	stands in for the processor filling each LP's log.
+
+Author:
+
+	agent (@agent) 16-Oct-2026 - Initial version
+
+Environment:
+
+	User mode only.
+
+--*/
+
+#include "../shvvmxpml.c"
+#include "shvtest.h"
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+NTSTATUS
+ShvTestStartPml(
+	VOID
+)
+{
+	NTSTATUS ret;
+
+	//
+	// PML comes up after the EPT, the way the driver brings it up, and
+	// every VMCS starts logging from the top.  A machine that can't log
+	// leaves it off, which the caller can tell from ShvVmxPmlEnabled.
+	//
+	ShvVmxPmlRequested = TRUE;
+
+	ret = ShvVmxPmlInitialize();
+	if (ret != STATUS_SUCCESS)
+	{
+		return ret;
+	}
+
+	for (ULONG i = 0; i < KeQueryActiveProcessorCountEx(ALL_PROCESSOR_GROUPS); i++)
+	{
+		ShvTestSetCurrentProcessor(i);
+		ShvVmxPmlSetupVmcs(&ShvGlobalData->VpData[i]);
+	}
+
+	ShvTestSetCurrentProcessor(0);
+
+	return STATUS_SUCCESS;
+}
+
+VOID
+ShvTestStopPml(
+	VOID
+)
+{
+	ShvVmxPmlCleanup();
+
+	ShvVmxPmlRequested = SHV_PML_ENABLE;
+}
+
+ULONG
+ShvTestLogPml(
+	_In_reads_(Count) const ULONG64 *Gpas,
+	_In_ ULONG Count
+)
+{
+	PSHV_VP_DATA vpData;
+	SIZE_T index;
+	ULONG i;
+
+	//
+	// Log writes to the GPAs the way the processor does on the current LP:
+	// into the entry the index points at, then count the 16-bit index
+	// down, past zero once the last entry is used.  A full log takes a VM
+	// exit instead of logging, so stop there and return how many made it.
+	//
+	vpData = &ShvGlobalData->VpData[KeGetCurrentProcessorNumberEx(NULL)];
+
+	for (i = 0; i < Count; i++)
+	{
+		__vmx_vmread(GUEST_PML_INDEX, &index);
+
+		if (index >= VMX_PML_ENTRY_COUNT)
+		{
+			break;
+		}
+
+		vpData->PmlBuffer[index] = Gpas[i] & ~(PAGE_SIZE - 1ULL);
+		__vmx_vmwrite(GUEST_PML_INDEX, (index - 1) & 0xffff);
+	}
+
+	return i;
+}
+
+VOID
+ShvTestDrainPml(
+	VOID
+)
+{
+	//
+	// What every VM exit of the current LP does before it goes back to the
+	// guest.
+	//
+	ShvVmxPmlDrain(&ShvGlobalData->VpData[KeGetCurrentProcessorNumberEx(NULL)]);
+}
@@ -0,0 +1,335 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvtestrange.c
+
+Abstract:
+
+	This module tests mapping ranges of guest physical memory with the
+	walk cursor, and benchmarks how long the identity map takes to build
+	for memory maps from a few GiB to several TiB, and what mapping whole
+	ranges saves over mapping them a page at a time.
+
+Author:
+
+	agent (@agent) 16-Oct-2026 - Initial version
+
+Environment:
+
+	User mode only.
+
+--*/
+
+#include "shvtest.h"
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+#define SHV_TEST_MB                     (1024ULL * 1024)
+#define SHV_TEST_TB                     (1024 * SHV_TEST_GB)
+
+// ===========================================================================
+//
+// LOCAL TYPES
+//
+// ===========================================================================
+
+typedef struct _SHV_TEST_RANGE_MODE {
+	PCSTR Name;
+	ULONG64 Capabilities;
+	ULONG64 MaxRam;
+} SHV_TEST_RANGE_MODE, *PSHV_TEST_RANGE_MODE;
+
+// ===========================================================================
+//
+// LOCAL DATA
+//
+// ===========================================================================
+
+//
+// 4 KiB tables for a TiB would not fit in memory, and 2 MiB ones only just
+// do at 8 TiB.
+//
+static const SHV_TEST_RANGE_MODE ShvTestRangeModes[] = {
+	{ "4 KiB", SHV_TEST_EPT_CAPS_4KB, 64 * SHV_TEST_GB },
+	{ "2 MiB", SHV_TEST_EPT_CAPS_2MB, 8 * SHV_TEST_TB },
+	{ "1 GiB", SHV_TEST_EPT_CAPS_1GB, 8 * SHV_TEST_TB },
+};
+
+static const ULONG64 ShvTestRangeRamSizes[] = {
+	4 * SHV_TEST_GB,
+	64 * SHV_TEST_GB,
+	512 * SHV_TEST_GB,
+	2 * SHV_TEST_TB,
+	8 * SHV_TEST_TB,
+};
+
+static const ULONG64 ShvTestRangeLengths[] = {
+	64 * SHV_TEST_MB,
+	256 * SHV_TEST_MB,
+	SHV_TEST_GB,
+	4 * SHV_TEST_GB,
+};
+
+// ===========================================================================
+//
+// LOCAL PROTOTYPES
+//
+// ===========================================================================
+
+static NTSTATUS
+ShvTestRangeMapPages(
+	_In_ ULONG64 Start,
+	_In_ ULONG64 End
+);
+
+static BOOLEAN
+ShvTestRangeSameShape(
+	_In_ const SHV_EPT_INSPECTION *First,
+	_In_ const SHV_EPT_INSPECTION *Second
+);
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+VOID
+ShvTestMapRange(
+	VOID
+)
+{
+	SHV_EPT_INSPECTION whole, paged, again;
+	ULONG64 start, end, hpa;
+	ULONG failures;
+
+	//
+	// Only the first MiB is mapped up front when populating on demand, so
+	// everything above it is the test's to map.  The range is neither page
+	// table nor page directory aligned at either end.
+	//
+	ShvTestConfigureEpt(TRUE, FALSE, FALSE);
+	ShvTestSetMsr(MSR_IA32_VMX_EPT_VPID_CAP, SHV_TEST_EPT_CAPS_2MB);
+
+	start = 4 * SHV_TEST_GB + 0x3000;
+	end = 4 * SHV_TEST_GB + 6 * SHV_TEST_MB + 0x5000;
+
+	if (SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+	{
+		SHV_TEST_CHECK_SUCCESS(ShvVmxEptMapIdentityRange(start, end));
+
+		//
+		// 2 MiB leaves where the range covers whole, aligned 2 MiB, and
+		// nothing outside of the range.
+		//
+		SHV_TEST_CHECK(ShvVmxEptGetPageSize(start - PAGE_SIZE) == 0);
+		SHV_TEST_CHECK(ShvVmxEptGetPageSize(start) == PAGE_SIZE);
+		SHV_TEST_CHECK(ShvVmxEptGetPageSize(4 * SHV_TEST_GB + 2 * SHV_TEST_MB) == VMX_EPT_PAGE_SIZE_2MB);
+		SHV_TEST_CHECK(ShvVmxEptGetPageSize(4 * SHV_TEST_GB + 4 * SHV_TEST_MB) == VMX_EPT_PAGE_SIZE_2MB);
+		SHV_TEST_CHECK(ShvVmxEptGetPageSize(4 * SHV_TEST_GB + 6 * SHV_TEST_MB) == PAGE_SIZE);
+		SHV_TEST_CHECK(ShvVmxEptGetPageSize(end - PAGE_SIZE) == PAGE_SIZE);
+		SHV_TEST_CHECK(ShvVmxEptGetPageSize(end) == 0);
+
+		failures = 0;
+
+		for (ULONG64 gpa = start; gpa < end; gpa += PAGE_SIZE)
+		{
+			if (!ShvVmxEptTranslateGpa(gpa, TRUE, &hpa) || (hpa != gpa))
+			{
+				failures++;
+			}
+		}
+
+		SHV_TEST_CHECK(failures == 0);
+
+		//
+		// Mapping what is already mapped changes nothing.
+		//
+		ShvVmxEptInspect(&whole);
+		SHV_TEST_CHECK_SUCCESS(ShvVmxEptMapIdentityRange(start - 0x2000, end + 0x2000));
+		ShvVmxEptInspect(&again);
+		SHV_TEST_CHECK(again.MappedBytes == whole.MappedBytes + 0x4000);
+		SHV_TEST_CHECK(again.Leaves[2] == whole.Leaves[2]);
+
+		//
+		// Permissions and memory types are the caller's.
+		//
+		SHV_TEST_CHECK_SUCCESS(ShvVmxEptMapRange(8 * SHV_TEST_GB, 3 * PAGE_SIZE, VMX_EPT_ACCESS_READ, Uncacheable));
+		SHV_TEST_CHECK(ShvVmxEptTranslateGpa(8 * SHV_TEST_GB + PAGE_SIZE, FALSE, &hpa));
+		SHV_TEST_CHECK(!ShvVmxEptTranslateGpa(8 * SHV_TEST_GB + PAGE_SIZE, TRUE, &hpa));
+		SHV_TEST_CHECK(ShvVmxEptGetAccess(8 * SHV_TEST_GB, NULL) == VMX_EPT_ACCESS_READ);
+		ShvVmxEptInspect(&again);
+		SHV_TEST_CHECK(again.BytesByType[Uncacheable] == whole.BytesByType[Uncacheable] + 3 * PAGE_SIZE);
+
+		ShvTestStopEpt();
+	}
+
+	//
+	// A page at a time ends up with exactly the same tables and leaves as
+	// the whole range at once, as long as there are no large pages for the
+	// whole range to use.
+	//
+	ShvTestSetMsr(MSR_IA32_VMX_EPT_VPID_CAP, SHV_TEST_EPT_CAPS_4KB);
+
+	if (SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+	{
+		SHV_TEST_CHECK_SUCCESS(ShvVmxEptMapIdentityRange(start, end));
+		ShvVmxEptInspect(&whole);
+		ShvTestStopEpt();
+	}
+
+	if (SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+	{
+		SHV_TEST_CHECK_SUCCESS(ShvTestRangeMapPages(start, end));
+		ShvVmxEptInspect(&paged);
+		SHV_TEST_CHECK(ShvTestRangeSameShape(&whole, &paged));
+		ShvTestStopEpt();
+	}
+}
+
+VOID
+ShvTestMapRangeBenchmark(
+	VOID
+)
+{
+	SHV_EPT_INSPECTION inspection;
+	ULONG64 start, elapsed, paged;
+
+	//
+	// The build of the whole identity map, on a single LP so that it is
+	// the walk that is measured and not how well the slices spread.
+	//
+	ShvTestPrint("%-6s %8s %10s %12s\n", "pages", "RAM", "build ms", "tables KiB");
+
+	for (ULONG m = 0; m < RTL_NUMBER_OF(ShvTestRangeModes); m++)
+	{
+		for (ULONG r = 0; r < RTL_NUMBER_OF(ShvTestRangeRamSizes); r++)
+		{
+			if (ShvTestRangeRamSizes[r] > ShvTestRangeModes[m].MaxRam)
+			{
+				continue;
+			}
+
+			ShvTestSetTypicalMemoryMap(ShvTestRangeRamSizes[r]);
+			ShvTestSetMsr(MSR_IA32_VMX_EPT_VPID_CAP, ShvTestRangeModes[m].Capabilities);
+
+			start = ShvTestNow();
+
+			if (!SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+			{
+				return;
+			}
+
+			elapsed = ShvTestNow() - start;
+
+			ShvVmxEptInspect(&inspection);
+
+			ShvTestPrint("%-6s %5llu GiB %10.1f %12llu\n",
+				ShvTestRangeModes[m].Name,
+				ShvTestRangeRamSizes[r] / SHV_TEST_GB,
+				elapsed / 1e6,
+				inspection.TableBytes / 1024);
+
+			ShvTestStopEpt();
+		}
+	}
+
+	//
+	// Mapping RAM above 4 GiB after the fact, as a range and a page at a
+	// time, with 4 KiB pages so that both end up with the same leaves.
+	// The page at a time numbers are what every page used to cost: a walk
+	// from the root, and the memory type lookup.
+	//
+	ShvTestSetTypicalMemoryMap(8 * SHV_TEST_GB);
+	ShvTestSetMsr(MSR_IA32_VMX_EPT_VPID_CAP, SHV_TEST_EPT_CAPS_4KB);
+	ShvTestConfigureEpt(TRUE, FALSE, FALSE);
+
+	ShvTestPrint("\n");
+	ShvTestPrint("%8s %12s %12s %12s %12s %8s\n", "length", "range ms", "ns/page", "paged ms", "ns/page", "speedup");
+
+	for (ULONG l = 0; l < RTL_NUMBER_OF(ShvTestRangeLengths); l++)
+	{
+		if (!SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+		{
+			break;
+		}
+
+		start = ShvTestNow();
+		SHV_TEST_CHECK_SUCCESS(ShvVmxEptMapIdentityRange(4 * SHV_TEST_GB, 4 * SHV_TEST_GB + ShvTestRangeLengths[l]));
+		elapsed = ShvTestNow() - start;
+
+		ShvTestStopEpt();
+
+		if (!SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+		{
+			break;
+		}
+
+		start = ShvTestNow();
+		SHV_TEST_CHECK_SUCCESS(ShvTestRangeMapPages(4 * SHV_TEST_GB, 4 * SHV_TEST_GB + ShvTestRangeLengths[l]));
+		paged = ShvTestNow() - start;
+
+		ShvTestStopEpt();
+
+		ShvTestPrint("%4llu MiB %12.1f %12.1f %12.1f %12.1f %7.1fx\n",
+			ShvTestRangeLengths[l] / SHV_TEST_MB,
+			elapsed / 1e6,
+			(double)elapsed / (ShvTestRangeLengths[l] / PAGE_SIZE),
+			paged / 1e6,
+			(double)paged / (ShvTestRangeLengths[l] / PAGE_SIZE),
+			(double)paged / elapsed);
+	}
+
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+static NTSTATUS
+ShvTestRangeMapPages(
+	_In_ ULONG64 Start,
+	_In_ ULONG64 End
+)
+{
+	NTSTATUS ret;
+
+	for (ULONG64 gpa = Start & ~(PAGE_SIZE - 1ULL); gpa < End; gpa += PAGE_SIZE)
+	{
+		ret = ShvVmxEptMapIdentityRange(gpa, gpa + PAGE_SIZE);
+		if (ret != STATUS_SUCCESS)
+		{
+			return ret;
+		}
+	}
+
+	return STATUS_SUCCESS;
+}
+
+static BOOLEAN
+ShvTestRangeSameShape(
+	_In_ const SHV_EPT_INSPECTION *First,
+	_In_ const SHV_EPT_INSPECTION *Second
+)
+{
+	for (ULONG l = 0; l <= VMX_EPT_PAGE_WALK_LENGTH; l++)
+	{
+		if ((First->Tables[l] != Second->Tables[l]) ||
+			((l < VMX_EPT_PAGE_WALK_LENGTH) && (First->Leaves[l] != Second->Leaves[l])))
+		{
+			return FALSE;
+		}
+	}
+
+	return (First->MappedBytes == Second->MappedBytes) &&
+		(First->BytesByType[WriteBack] == Second->BytesByType[WriteBack]);
+}
@@ -0,0 +1,360 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvtestremote.c
+
+Abstract:
+
+	This module tests the NUMA sampler: that a round only arms the pages
+	nobody else protects or remaps, claims the first touch of each and
+	gives it its access back, and disarms only the pages that are still
+	its own when it ends, that touches are added up against the node each
+	page belongs to, and that the pages touched remotely more often than
+	locally are sampled again and reported.
+
+Author:
+
+	agent (@agent) 16-Oct-2026 - Initial version
+
+Environment:
+
+	User mode only.
+
+--*/
+
+#include "shvtest.h"
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// The simulated machine: two nodes of two LPs each, and RAM split between
+// them in the middle.
+//
+#define SHV_TEST_REMOTE_PROCESSORS      (4)
+#define SHV_TEST_REMOTE_NODES           (2)
+
+//
+// How many pages a round samples, and how often, which is the shortest
+// round there can be, and the most pages a round that short may sample.
+//
+#define SHV_TEST_REMOTE_PAGES           (16)
+#define SHV_TEST_REMOTE_PERIOD          (10)
+#define SHV_TEST_REMOTE_MAX_PAGES       (SHV_NUMA_MAX_EXIT_RATE * SHV_TEST_REMOTE_PERIOD / 1000)
+
+// ===========================================================================
+//
+// LOCAL DATA
+//
+// ===========================================================================
+
+static ULONG64 ShvTestRemoteMiddle = 0;
+
+// ===========================================================================
+//
+// LOCAL PROTOTYPES
+//
+// ===========================================================================
+
+static VOID
+ShvTestRemoteTouch(
+	_In_ ULONG64 Gpa,
+	_In_ BOOLEAN Remote
+);
+
+static BOOLEAN
+ShvTestRemoteFind(
+	_In_reads_(Count) const ULONG64 *Gpas,
+	_In_ ULONG Count,
+	_In_ ULONG64 Gpa
+);
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+VOID
+ShvTestRemoteSampling(
+	VOID
+)
+{
+	SHV_NUMA_STATISTICS statistics;
+	SHV_NUMA_CANDIDATE candidates[4];
+	SHV_NUMA_RANGE ranges[2];
+	SHV_EPT_PROTECTION protection;
+	SHV_VP_STATE vpState;
+	ULONG64 first[SHV_TEST_REMOTE_PAGES], second[SHV_TEST_REMOTE_PAGES];
+	ULONG firstCount, secondCount, returned, last;
+	ULONG64 end;
+
+	ShvTestSetProcessors(SHV_TEST_REMOTE_PROCESSORS, SHV_TEST_REMOTE_NODES);
+
+	if (!SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+	{
+		return;
+	}
+
+	//
+	// Sampling is off unless it was asked for.
+	//
+	SHV_TEST_CHECK(ShvVmxNumaStart(SHV_TEST_REMOTE_PAGES, SHV_TEST_REMOTE_PERIOD) == STATUS_HV_NOT_PRESENT);
+
+	if (!SHV_TEST_CHECK_SUCCESS(ShvTestStartSampler()))
+	{
+		ShvTestStopEpt();
+		return;
+	}
+
+	//
+	// Rounds are bounded in size and in how many exits they cost.
+	//
+	SHV_TEST_CHECK(ShvVmxNumaStart(0, SHV_TEST_REMOTE_PERIOD) == STATUS_INVALID_PARAMETER);
+	SHV_TEST_CHECK(ShvVmxNumaStart(SHV_NUMA_MAX_ROUND_PAGES + 1, 1000) == STATUS_INVALID_PARAMETER);
+	SHV_TEST_CHECK(ShvVmxNumaStart(1, SHV_TEST_REMOTE_PERIOD - 1) == STATUS_INVALID_PARAMETER);
+	SHV_TEST_CHECK(ShvVmxNumaStart(SHV_TEST_REMOTE_MAX_PAGES + 1, SHV_TEST_REMOTE_PERIOD) == STATUS_INVALID_PARAMETER);
+
+	//
+	// The node map has to be sorted, and not overlap.
+	//
+	ShvTestRemoteMiddle = ShvMemMapGetTopOfRam() / 2;
+
+	ranges[0].Base = 0;
+	ranges[0].End = ShvTestRemoteMiddle;
+	ranges[0].Node = 0;
+	ranges[1].Base = ShvTestRemoteMiddle - PAGE_SIZE;
+	ranges[1].End = ShvMemMapGetTopOfRam();
+	ranges[1].Node = 1;
+
+	SHV_TEST_CHECK(ShvVmxNumaSetNodeRanges(ranges, 2) == STATUS_INVALID_PARAMETER);
+
+	ranges[1].Base = ShvTestRemoteMiddle;
+	SHV_TEST_CHECK_SUCCESS(ShvVmxNumaSetNodeRanges(ranges, 2));
+
+	if (!SHV_TEST_CHECK_SUCCESS(ShvVmxNumaStart(SHV_TEST_REMOTE_PAGES, SHV_TEST_REMOTE_PERIOD)))
+	{
+		ShvTestStopSampler();
+		ShvTestStopEpt();
+		return;
+	}
+
+	SHV_TEST_CHECK(ShvVmxNumaStart(SHV_TEST_REMOTE_PAGES, SHV_TEST_REMOTE_PERIOD) == STATUS_DEVICE_BUSY);
+
+	//
+	// The first round samples RAM at random, and takes all access to its
+	// pages away.
+	//
+	ShvTestStepSampler();
+
+	firstCount = ShvTestGetSamples(first, SHV_TEST_REMOTE_PAGES);
+	if (!SHV_TEST_CHECK(firstCount >= 4))
+	{
+		ShvTestStopSampler();
+		ShvTestStopEpt();
+		return;
+	}
+
+	for (ULONG i = 0; i < firstCount; i++)
+	{
+		SHV_TEST_CHECK(ShvMemMapLookup(first[i], &end) == ShvMemoryRam);
+		SHV_TEST_CHECK(ShvVmxEptGetAccess(first[i], NULL) == 0);
+	}
+
+	ShvVmxNumaQuery(&statistics);
+	SHV_TEST_CHECK(statistics.Armed == firstCount);
+	SHV_TEST_CHECK(statistics.Skipped == 0);
+
+	//
+	// The first touch of a page records the node of the LP, and gives the
+	// page its access back.  A touch that comes after that was someone
+	// else's.
+	//
+	ShvTestRemoteTouch(first[0], TRUE);
+	ShvTestRemoteTouch(first[1], TRUE);
+	ShvTestRemoteTouch(first[2], FALSE);
+
+	SHV_TEST_CHECK(ShvVmxEptGetAccess(first[0], NULL) == VMX_EPT_ACCESS_RWX);
+	SHV_TEST_CHECK(ShvVmxEptGetAccess(first[3], NULL) == 0);
+
+	__stosb((PUCHAR)&vpState, 0, sizeof(vpState));
+	SHV_TEST_CHECK(!ShvTestFilterSampler(&vpState, first[0], VMX_EPT_ACCESS_READ));
+
+	//
+	// Meanwhile, someone else protects one of the pages that were touched.
+	// Ending the round gives the untouched pages their access back, and
+	// leaves that one the way they made it.
+	//
+	protection.Gpa = first[1];
+	protection.Length = PAGE_SIZE;
+	protection.Access = VMX_EPT_ACCESS_READ;
+	SHV_TEST_CHECK_SUCCESS(ShvVmxEptProtectRanges(&protection, 1));
+
+	ShvTestStepSampler();
+
+	secondCount = ShvTestGetSamples(second, SHV_TEST_REMOTE_PAGES);
+
+	SHV_TEST_CHECK(ShvVmxEptGetAccess(first[1], NULL) == VMX_EPT_ACCESS_READ);
+
+	for (ULONG i = 2; i < firstCount; i++)
+	{
+		if (!ShvTestRemoteFind(second, secondCount, first[i]))
+		{
+			SHV_TEST_CHECK(ShvVmxEptGetAccess(first[i], NULL) == VMX_EPT_ACCESS_RWX);
+		}
+	}
+
+	ShvVmxNumaQuery(&statistics);
+	SHV_TEST_CHECK(statistics.Rounds == 1);
+	SHV_TEST_CHECK(statistics.Touched == 3);
+	SHV_TEST_CHECK(statistics.Remote == 2);
+	SHV_TEST_CHECK(statistics.Local == 1);
+	SHV_TEST_CHECK(statistics.Unknown == 0);
+	SHV_TEST_CHECK(statistics.Pages == 3);
+
+	//
+	// The next round samples the pages touched remotely again, but not the
+	// one touched only locally, and the one someone else protects is left
+	// to them, and its violations with it.
+	//
+	SHV_TEST_CHECK(ShvTestRemoteFind(second, secondCount, first[0]));
+	SHV_TEST_CHECK(ShvTestRemoteFind(second, secondCount, first[1]));
+	SHV_TEST_CHECK(!ShvTestRemoteFind(second, secondCount, first[2]));
+
+	SHV_TEST_CHECK(ShvVmxEptGetAccess(first[0], NULL) == 0);
+	SHV_TEST_CHECK(ShvVmxEptGetAccess(first[1], NULL) == VMX_EPT_ACCESS_READ);
+	SHV_TEST_CHECK(!ShvTestFilterSampler(&vpState, first[1], VMX_EPT_ACCESS_WRITE));
+
+	ShvVmxNumaQuery(&statistics);
+	SHV_TEST_CHECK(statistics.Armed == firstCount + secondCount - 1);
+	SHV_TEST_CHECK(statistics.Skipped == 1);
+
+	//
+	// A page touched remotely twice, and never locally, is worth moving to
+	// the node that touched it.  Once isn't enough.
+	//
+	ShvTestRemoteTouch(first[0], TRUE);
+	ShvTestStepSampler();
+
+	SHV_TEST_CHECK_SUCCESS(ShvVmxNumaReport(candidates, 0, &returned));
+	SHV_TEST_CHECK(returned == 0);
+
+	SHV_TEST_CHECK_SUCCESS(ShvVmxNumaReport(candidates, RTL_NUMBER_OF(candidates), &returned));
+
+	if (SHV_TEST_CHECK(returned == 1))
+	{
+		SHV_TEST_CHECK(candidates[0].Gpa == first[0]);
+		SHV_TEST_CHECK(candidates[0].Node == (first[0] < ShvTestRemoteMiddle ? 0 : 1));
+		SHV_TEST_CHECK(candidates[0].Target == 1 - candidates[0].Node);
+		SHV_TEST_CHECK(candidates[0].Local == 0);
+		SHV_TEST_CHECK(candidates[0].Remote == 2);
+	}
+
+	//
+	// Touches of pages the node map doesn't cover are counted, but their
+	// pages aren't tracked.
+	//
+	SHV_TEST_CHECK_SUCCESS(ShvVmxNumaSetNodeRanges(NULL, 0));
+
+	secondCount = ShvTestGetSamples(second, SHV_TEST_REMOTE_PAGES);
+
+	for (last = secondCount - 1; last != 0 && ShvVmxEptGetAccess(second[last], NULL) != 0; last--);
+
+	ShvTestRemoteTouch(second[last], TRUE);
+	ShvTestStepSampler();
+
+	ShvVmxNumaQuery(&statistics);
+	SHV_TEST_CHECK(statistics.Rounds == 3);
+	SHV_TEST_CHECK(statistics.Touched == 5);
+	SHV_TEST_CHECK(statistics.Unknown == 1);
+
+	//
+	// Stopping ends the round in progress, which gives its pages their
+	// access back.
+	//
+	secondCount = ShvTestGetSamples(second, SHV_TEST_REMOTE_PAGES);
+
+	ShvVmxNumaStop();
+
+	SHV_TEST_CHECK(ShvTestGetSamples(first, SHV_TEST_REMOTE_PAGES) == 0);
+
+	for (ULONG i = 0; i < secondCount; i++)
+	{
+		SHV_TEST_CHECK(ShvVmxEptGetAccess(second[i], NULL) ==
+			((second[i] == protection.Gpa) ? VMX_EPT_ACCESS_READ : VMX_EPT_ACCESS_RWX));
+	}
+
+	ShvVmxNumaQuery(&statistics);
+	SHV_TEST_CHECK(statistics.Rounds == 4);
+
+	protection.Access = VMX_EPT_ACCESS_RWX;
+	SHV_TEST_CHECK_SUCCESS(ShvVmxEptProtectRanges(&protection, 1));
+
+	ShvTestStopSampler();
+	ShvTestStopEpt();
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+static VOID
+ShvTestRemoteTouch(
+	_In_ ULONG64 Gpa,
+	_In_ BOOLEAN Remote
+)
+{
+	SHV_VP_STATE vpState;
+	ULONG node;
+	KIRQL irql;
+
+	//
+	// An LP of the node the page belongs to, or of the other one, reads the
+	// page, and takes a violation, in root mode with interrupts off.
+	//
+	node = (Gpa < ShvTestRemoteMiddle) ? 0 : 1;
+
+	if (Remote != FALSE)
+	{
+		node = 1 - node;
+	}
+
+	ShvTestSetCurrentProcessor(node * SHV_TEST_REMOTE_PROCESSORS / SHV_TEST_REMOTE_NODES);
+
+	__stosb((PUCHAR)&vpState, 0, sizeof(vpState));
+
+	__vmx_vmwrite(GUEST_PHYSICAL_ADDRESS, Gpa);
+	__vmx_vmwrite(EXIT_QUALIFICATION, VMX_EPT_ACCESS_READ);
+
+	KeRaiseIrql(HIGH_LEVEL, &irql);
+	ShvVmxEptHandleViolation(&vpState);
+	KeLowerIrql(irql);
+
+	ShvTestSetCurrentProcessor(0);
+}
+
+static BOOLEAN
+ShvTestRemoteFind(
+	_In_reads_(Count) const ULONG64 *Gpas,
+	_In_ ULONG Count,
+	_In_ ULONG64 Gpa
+)
+{
+	for (ULONG i = 0; i < Count; i++)
+	{
+		if (Gpas[i] == Gpa)
+		{
+			return TRUE;
+		}
+	}
+
+	return FALSE;
+}
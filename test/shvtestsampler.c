@@ -0,0 +1,250 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvtestsampler.c
+
+Abstract:
+
+	This module builds the NUMA sampler into the test harness.  It is
+	included whole, rather than linked, so that tests can turn sampling on,
+	run its rounds themselves and see which pages they sample.  System
+	threads never run in the harness, so the sampler thread is one that
+	only exists to be waited for, and tests do what it does each period.
+
+Author:
+
+	agent (@agent) 16-Oct-2026 - Initial version
+
+Environment:
+
+	User mode only.
+
+--*/
+
+#include "shvtest.h"
+
+// ===========================================================================
+//
+// LOCAL DATA
+//
+// ===========================================================================
+
+//
+// What the sampler's thread handle and object point to.
+//
+static ULONG ShvTestSamplerThread = 0;
+
+// ===========================================================================
+//
+// LOCAL PROTOTYPES
+//
+// ===========================================================================
+
+static NTSTATUS
+ShvTestSamplerCreateThread(
+	_Out_ PHANDLE ThreadHandle,
+	_In_ ULONG DesiredAccess,
+	_In_opt_ POBJECT_ATTRIBUTES ObjectAttributes,
+	_In_opt_ HANDLE ProcessHandle,
+	_Out_opt_ PVOID ClientId,
+	_In_ PKSTART_ROUTINE StartRoutine,
+	_In_opt_ PVOID StartContext
+);
+
+static NTSTATUS
+ShvTestSamplerClose(
+	_In_ HANDLE Handle
+);
+
+static NTSTATUS
+ShvTestSamplerWait(
+	_In_ PVOID Object,
+	_In_ ULONG WaitReason,
+	_In_ KPROCESSOR_MODE WaitMode,
+	_In_ BOOLEAN Alertable,
+	_In_opt_ PLARGE_INTEGER Timeout
+);
+
+//
+// Starting the sampler creates a thread that never runs, and stopping it
+// waits for that thread, which is when the thread would end the last
+// round on its way out.
+//
+#define PsCreateSystemThread            ShvTestSamplerCreateThread
+#define ZwClose                         ShvTestSamplerClose
+#define KeWaitForSingleObject           ShvTestSamplerWait
+
+#include "../shvvmxnuma.c"
+
+#undef PsCreateSystemThread
+#undef ZwClose
+#undef KeWaitForSingleObject
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+NTSTATUS
+ShvTestStartSampler(
+	VOID
+)
+{
+	//
+	// The sampler comes up after the EPT, the way the driver brings it up.
+	// A driver load starts out with nothing counted, tracked or mapped to
+	// nodes.
+	//
+	__stosb((PUCHAR)&ShvVmxNumaStatistics, 0, sizeof(ShvVmxNumaStatistics));
+
+	ShvVmxNumaRangeCount = 0;
+	ShvVmxNumaCursor = 0;
+	ShvVmxNumaRequested = TRUE;
+
+	return ShvVmxNumaInitialize();
+}
+
+VOID
+ShvTestStopSampler(
+	VOID
+)
+{
+	ShvVmxNumaCleanup();
+
+	ShvVmxNumaRequested = SHV_NUMA_ENABLE;
+}
+
+VOID
+ShvTestStepSampler(
+	VOID
+)
+{
+	//
+	// What the sampler thread does when it starts, and each time the
+	// period is up after that.
+	//
+	ExAcquireFastMutex(&ShvVmxNumaLock);
+
+	if (ShvVmxNumaEndRound() != FALSE)
+	{
+		ShvVmxNumaBeginRound();
+	}
+
+	ExReleaseFastMutex(&ShvVmxNumaLock);
+}
+
+ULONG
+ShvTestGetSamples(
+	_Out_writes_to_(Count, return) PULONG64 Gpas,
+	_In_ ULONG Count
+)
+{
+	PSHV_NUMA_ROUND round;
+	ULONG i;
+
+	//
+	// The pages of the round in progress, in order.
+	//
+	round = ShvVmxNumaRound;
+	if (round == NULL)
+	{
+		return 0;
+	}
+
+	for (i = 0; i < round->Count && i < Count; i++)
+	{
+		Gpas[i] = round->Samples[i].Gpa;
+	}
+
+	return i;
+}
+
+BOOLEAN
+ShvTestFilterSampler(
+	_In_ PSHV_VP_STATE VpState,
+	_In_ ULONG64 Gpa,
+	_In_ ULONG Access
+)
+{
+	//
+	// The handler the EPT module calls for violations on protected pages,
+	// for tests that need to see whether it claimed one.
+	//
+	return ShvVmxNumaHandleViolation(VpState, Gpa, Access);
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+static NTSTATUS
+ShvTestSamplerCreateThread(
+	_Out_ PHANDLE ThreadHandle,
+	_In_ ULONG DesiredAccess,
+	_In_opt_ POBJECT_ATTRIBUTES ObjectAttributes,
+	_In_opt_ HANDLE ProcessHandle,
+	_Out_opt_ PVOID ClientId,
+	_In_ PKSTART_ROUTINE StartRoutine,
+	_In_opt_ PVOID StartContext
+)
+{
+	UNREFERENCED_PARAMETER(DesiredAccess);
+	UNREFERENCED_PARAMETER(ObjectAttributes);
+	UNREFERENCED_PARAMETER(ProcessHandle);
+	UNREFERENCED_PARAMETER(ClientId);
+	UNREFERENCED_PARAMETER(StartRoutine);
+	UNREFERENCED_PARAMETER(StartContext);
+
+	*ThreadHandle = (HANDLE)&ShvTestSamplerThread;
+
+	return STATUS_SUCCESS;
+}
+
+static NTSTATUS
+ShvTestSamplerClose(
+	_In_ HANDLE Handle
+)
+{
+	if (Handle != (HANDLE)&ShvTestSamplerThread)
+	{
+		return ZwClose(Handle);
+	}
+
+	return STATUS_SUCCESS;
+}
+
+static NTSTATUS
+ShvTestSamplerWait(
+	_In_ PVOID Object,
+	_In_ ULONG WaitReason,
+	_In_ KPROCESSOR_MODE WaitMode,
+	_In_ BOOLEAN Alertable,
+	_In_opt_ PLARGE_INTEGER Timeout
+)
+{
+	if (Object != (PVOID)&ShvTestSamplerThread)
+	{
+		return KeWaitForSingleObject(Object, WaitReason, WaitMode, Alertable, Timeout);
+	}
+
+	//
+	// The thread saw the stop event, ends the round in progress and exits.
+	// Nothing in the harness makes ending a round fail.
+	//
+	ExAcquireFastMutex(&ShvVmxNumaLock);
+
+	if (ShvVmxNumaEndRound() == FALSE)
+	{
+		NT_ASSERT(FALSE);
+	}
+
+	ExReleaseFastMutex(&ShvVmxNumaLock);
+
+	return STATUS_SUCCESS;
+}
@@ -0,0 +1,438 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvtesttlb.c
+
+Abstract:
+
+	This module tests guest address translation from root mode: that the
+	guest page tables are walked the way the processor walks them, that a
+	software TLB hit is only used while every guest entry the walk went
+	through is unchanged, that a new CR3 or EPT generation drops the TLB,
+	and that copies never leave a partial write behind.
+
+Author:
+
+	agent (@agent) 16-Oct-2026 - Initial version
+
+Environment:
+
+	User mode only.
+
+--*/
+
+#include "shvtest.h"
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// The guest memory the page tables and the pages they map are in, which
+// is RAM the identity map covers with large pages, and the GPA of each of
+// its pages.
+//
+#define SHV_TEST_TLB_BASE               (0x10000000ULL)
+#define SHV_TEST_TLB_PAGES              (1024)
+#define SHV_TEST_TLB_GPA(n)             (SHV_TEST_TLB_BASE + (ULONG64)(n) * PAGE_SIZE)
+#define SHV_TEST_TLB_TABLE(m, n)        ((PULONG64)((m) + (n) * PAGE_SIZE))
+
+//
+// What each page holds: the tables the VA is mapped through, the page it
+// maps and the one after it, a second PT that maps another page there, a
+// copy of the PML4 and a PML5 above it.  The second 2 MiB of the memory
+// is a large page.
+//
+#define SHV_TEST_TLB_PML4               (0)
+#define SHV_TEST_TLB_PDPT               (1)
+#define SHV_TEST_TLB_PD                 (2)
+#define SHV_TEST_TLB_PT                 (3)
+#define SHV_TEST_TLB_DATA               (4)
+#define SHV_TEST_TLB_NEXT               (5)
+#define SHV_TEST_TLB_PT2                (6)
+#define SHV_TEST_TLB_OTHER              (7)
+#define SHV_TEST_TLB_PML4_COPY          (8)
+#define SHV_TEST_TLB_PML5               (9)
+#define SHV_TEST_TLB_LARGE              (512)
+
+//
+// A VA whose PML4, PDPT, PD and PT indexes are 1, 2, 3 and 4, one in
+// the page after it, the same VA in the upper half, where its PML4 index
+// is 257, and one with the same indexes that isn't canonical
+// with 4-level paging, but is with 5-level paging, where its PML5 index
+// is 1.
+//
+#define SHV_TEST_TLB_VA                 (0x0000008080604000ULL)
+#define SHV_TEST_TLB_VA_NEXT            (SHV_TEST_TLB_VA + PAGE_SIZE)
+#define SHV_TEST_TLB_VA_UPPER           (SHV_TEST_TLB_VA | 0xffff800000000000ULL)
+#define SHV_TEST_TLB_NONCANONICAL       (SHV_TEST_TLB_VA | (1ULL << 48))
+
+//
+// Guest paging bits: present and writable, and a large page.
+//
+#define SHV_TEST_TLB_PRESENT            (0x1ULL)
+#define SHV_TEST_TLB_WRITE              (0x2ULL)
+#define SHV_TEST_TLB_ENTRY              (SHV_TEST_TLB_PRESENT | SHV_TEST_TLB_WRITE)
+#define SHV_TEST_TLB_PS                 (0x80ULL)
+
+#define SHV_TEST_TLB_CR0_PG             (1ULL << 31)
+#define SHV_TEST_TLB_CR4_LA57           (1ULL << 12)
+
+//
+// An HPA no walk of these tables ever ends at, planted in a TLB entry to
+// tell a hit from a walk.
+//
+#define SHV_TEST_TLB_STALE              (0x7fff000ULL)
+
+// ===========================================================================
+//
+// LOCAL PROTOTYPES
+//
+// ===========================================================================
+
+static VOID
+ShvTestTlbBuild(
+	_In_ PUCHAR Memory
+);
+
+static PSHV_GUEST_TLB_ENTRY
+ShvTestTlbEntry(
+	_In_ PSHV_VP_DATA VpData,
+	_In_ ULONG64 Va
+);
+
+static BOOLEAN
+ShvTestTlbStale(
+	_In_ PSHV_VP_DATA VpData,
+	_In_ ULONG64 Va
+);
+
+static ULONG64
+ShvTestTlbTranslate(
+	_In_ PSHV_VP_DATA VpData,
+	_In_ ULONG64 Va,
+	_In_ BOOLEAN Write
+);
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+VOID
+ShvTestGuestTlb(
+	VOID
+)
+{
+	PSHV_VP_DATA vpData;
+	PULONG64 pml4, pdpt, pd, pt, pml5;
+	PUCHAR memory;
+	ULONG64 hpa, value;
+	ULONG data;
+
+	if (!SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+	{
+		return;
+	}
+
+	memory = (PUCHAR)ShvTestPlatAllocatePages(SHV_TEST_TLB_PAGES * PAGE_SIZE, MM_ANY_NODE_OK);
+	if (!SHV_TEST_CHECK(memory != NULL))
+	{
+		ShvTestStopEpt();
+		return;
+	}
+
+	ShvTestTlbBuild(memory);
+	ShvTestSetGuestMemory(SHV_TEST_TLB_BASE, memory, SHV_TEST_TLB_PAGES * PAGE_SIZE);
+
+	pml4 = SHV_TEST_TLB_TABLE(memory, SHV_TEST_TLB_PML4);
+	pdpt = SHV_TEST_TLB_TABLE(memory, SHV_TEST_TLB_PDPT);
+	pd = SHV_TEST_TLB_TABLE(memory, SHV_TEST_TLB_PD);
+	pt = SHV_TEST_TLB_TABLE(memory, SHV_TEST_TLB_PT);
+	pml5 = SHV_TEST_TLB_TABLE(memory, SHV_TEST_TLB_PML5);
+
+	vpData = &ShvGlobalData->VpData[0];
+
+	//
+	// A 64-bit guest with 4-level paging.
+	//
+	__vmx_vmwrite(GUEST_CR0, SHV_TEST_TLB_CR0_PG);
+	__vmx_vmwrite(GUEST_CR4, 0);
+	__vmx_vmwrite(VM_ENTRY_CONTROLS, VM_ENTRY_IA32E_MODE);
+	__vmx_vmwrite(GUEST_CR3, SHV_TEST_TLB_GPA(SHV_TEST_TLB_PML4));
+
+	//
+	// Nothing is translated until every VP has a window to map pages with.
+	//
+	SHV_TEST_CHECK(ShvVmxGuestTranslate(vpData, SHV_TEST_TLB_VA, FALSE, &hpa) == STATUS_NOT_SUPPORTED);
+
+	if (!SHV_TEST_CHECK_SUCCESS(ShvVmxGuestInitialize()) ||
+		!SHV_TEST_CHECK(vpData->GuestWindow != NULL))
+	{
+		ShvTestSetGuestMemory(0, NULL, 0);
+		ShvTestPlatFreePages(memory, SHV_TEST_TLB_PAGES * PAGE_SIZE);
+		ShvTestStopEpt();
+		return;
+	}
+
+	//
+	// A walk goes through all four levels, and reads what the guest sees.
+	// Upper half VAs are canonical too.
+	//
+	SHV_TEST_CHECK(ShvTestTlbTranslate(vpData, SHV_TEST_TLB_VA_UPPER, FALSE) == SHV_TEST_TLB_GPA(SHV_TEST_TLB_DATA));
+
+	SHV_TEST_CHECK_SUCCESS(ShvVmxGuestTranslate(vpData, SHV_TEST_TLB_VA + 0x123, FALSE, &hpa));
+	SHV_TEST_CHECK(hpa == SHV_TEST_TLB_GPA(SHV_TEST_TLB_DATA) + 0x123);
+	SHV_TEST_CHECK(ShvTestTlbEntry(vpData, SHV_TEST_TLB_VA)->Levels == 4);
+
+	SHV_TEST_CHECK_SUCCESS(ShvTestReadGuestVirtual(vpData, SHV_TEST_TLB_VA, &data, sizeof(data)));
+	SHV_TEST_CHECK(data == 0x04040404);
+
+	//
+	// Another translation of the page is a hit, and takes the HPA from the
+	// TLB rather than walking again.
+	//
+	ShvTestTlbEntry(vpData, SHV_TEST_TLB_VA)->Hpa = SHV_TEST_TLB_STALE;
+	SHV_TEST_CHECK(ShvTestTlbTranslate(vpData, SHV_TEST_TLB_VA, FALSE) == SHV_TEST_TLB_STALE);
+
+	//
+	// The guest changing an entry at any level of the walk, without a new
+	// CR3 or an INVLPG we could see, misses.  Checking only the PTE isn't
+	// enough, since each table above it can point somewhere else.
+	//
+	if (ShvTestTlbStale(vpData, SHV_TEST_TLB_VA))
+	{
+		pt[4] = SHV_TEST_TLB_GPA(SHV_TEST_TLB_NEXT) | SHV_TEST_TLB_ENTRY;
+		SHV_TEST_CHECK(ShvTestTlbTranslate(vpData, SHV_TEST_TLB_VA, FALSE) == SHV_TEST_TLB_GPA(SHV_TEST_TLB_NEXT));
+		pt[4] = SHV_TEST_TLB_GPA(SHV_TEST_TLB_DATA) | SHV_TEST_TLB_ENTRY;
+	}
+
+	if (ShvTestTlbStale(vpData, SHV_TEST_TLB_VA))
+	{
+		pd[3] = SHV_TEST_TLB_GPA(SHV_TEST_TLB_PT2) | SHV_TEST_TLB_ENTRY;
+		SHV_TEST_CHECK(ShvTestTlbTranslate(vpData, SHV_TEST_TLB_VA, FALSE) == SHV_TEST_TLB_GPA(SHV_TEST_TLB_OTHER));
+		pd[3] = SHV_TEST_TLB_GPA(SHV_TEST_TLB_PT) | SHV_TEST_TLB_ENTRY;
+	}
+
+	if (ShvTestTlbStale(vpData, SHV_TEST_TLB_VA))
+	{
+		pdpt[2] = SHV_TEST_TLB_ENTRY | SHV_TEST_TLB_PS;
+		SHV_TEST_CHECK(ShvTestTlbTranslate(vpData, SHV_TEST_TLB_VA, FALSE) == (SHV_TEST_TLB_VA & (VMX_EPT_PAGE_SIZE_1GB - 1)));
+		SHV_TEST_CHECK(ShvTestTlbEntry(vpData, SHV_TEST_TLB_VA)->Levels == 2);
+		pdpt[2] = SHV_TEST_TLB_GPA(SHV_TEST_TLB_PD) | SHV_TEST_TLB_ENTRY;
+	}
+
+	if (ShvTestTlbStale(vpData, SHV_TEST_TLB_VA))
+	{
+		pml4[1] = 0;
+		SHV_TEST_CHECK(ShvVmxGuestTranslate(vpData, SHV_TEST_TLB_VA, FALSE, &hpa) == STATUS_ACCESS_VIOLATION);
+		pml4[1] = SHV_TEST_TLB_GPA(SHV_TEST_TLB_PDPT) | SHV_TEST_TLB_ENTRY;
+	}
+
+	//
+	// A page cached as writable stops being writable when the guest takes
+	// write access away at any level, and a page cached as read-only is
+	// walked again for a write, in case it was made writable since.
+	//
+	SHV_TEST_CHECK(ShvTestTlbTranslate(vpData, SHV_TEST_TLB_VA, TRUE) == SHV_TEST_TLB_GPA(SHV_TEST_TLB_DATA));
+
+	pt[4] &= ~SHV_TEST_TLB_WRITE;
+	SHV_TEST_CHECK(ShvVmxGuestTranslate(vpData, SHV_TEST_TLB_VA, TRUE, &hpa) == STATUS_ACCESS_VIOLATION);
+	SHV_TEST_CHECK(ShvTestTlbTranslate(vpData, SHV_TEST_TLB_VA, FALSE) == SHV_TEST_TLB_GPA(SHV_TEST_TLB_DATA));
+	SHV_TEST_CHECK(ShvVmxGuestTranslate(vpData, SHV_TEST_TLB_VA, TRUE, &hpa) == STATUS_ACCESS_VIOLATION);
+	pt[4] |= SHV_TEST_TLB_WRITE;
+	SHV_TEST_CHECK(ShvTestTlbTranslate(vpData, SHV_TEST_TLB_VA, TRUE) == SHV_TEST_TLB_GPA(SHV_TEST_TLB_DATA));
+
+	pd[3] &= ~SHV_TEST_TLB_WRITE;
+	SHV_TEST_CHECK(ShvVmxGuestTranslate(vpData, SHV_TEST_TLB_VA, TRUE, &hpa) == STATUS_ACCESS_VIOLATION);
+	pd[3] |= SHV_TEST_TLB_WRITE;
+
+	//
+	// The EPT taking write access away makes every VP flush, which drops
+	// the TLB even though no guest entry changed.  Giving it back needs no
+	// flush, but the page is cached as read-only by then.
+	//
+	SHV_TEST_CHECK(ShvTestTlbTranslate(vpData, SHV_TEST_TLB_VA, TRUE) == SHV_TEST_TLB_GPA(SHV_TEST_TLB_DATA));
+
+	SHV_TEST_CHECK_SUCCESS(ShvVmxEptProtectRange(SHV_TEST_TLB_GPA(SHV_TEST_TLB_DATA), PAGE_SIZE, VMX_EPT_ACCESS_READ));
+	ShvVmxEptSynchronize(vpData);
+
+	SHV_TEST_CHECK(ShvVmxGuestTranslate(vpData, SHV_TEST_TLB_VA, TRUE, &hpa) == STATUS_ACCESS_VIOLATION);
+	SHV_TEST_CHECK(ShvTestTlbTranslate(vpData, SHV_TEST_TLB_VA, FALSE) == SHV_TEST_TLB_GPA(SHV_TEST_TLB_DATA));
+
+	SHV_TEST_CHECK_SUCCESS(ShvVmxEptProtectRange(SHV_TEST_TLB_GPA(SHV_TEST_TLB_DATA), PAGE_SIZE, VMX_EPT_ACCESS_RWX));
+	ShvVmxEptSynchronize(vpData);
+
+	SHV_TEST_CHECK(ShvTestTlbTranslate(vpData, SHV_TEST_TLB_VA, TRUE) == SHV_TEST_TLB_GPA(SHV_TEST_TLB_DATA));
+
+	//
+	// A new address space drops every entry, including ones that would
+	// still look valid once the guest switches back.
+	//
+	if (ShvTestTlbStale(vpData, SHV_TEST_TLB_VA_NEXT))
+	{
+		__vmx_vmwrite(GUEST_CR3, SHV_TEST_TLB_GPA(SHV_TEST_TLB_PML4_COPY));
+		SHV_TEST_CHECK(ShvTestTlbTranslate(vpData, SHV_TEST_TLB_VA, FALSE) == SHV_TEST_TLB_GPA(SHV_TEST_TLB_DATA));
+
+		__vmx_vmwrite(GUEST_CR3, SHV_TEST_TLB_GPA(SHV_TEST_TLB_PML4));
+		SHV_TEST_CHECK(ShvTestTlbTranslate(vpData, SHV_TEST_TLB_VA_NEXT, FALSE) == SHV_TEST_TLB_GPA(SHV_TEST_TLB_NEXT));
+	}
+
+	//
+	// A 2 MiB page ends the walk at the PD.
+	//
+	pd[3] = SHV_TEST_TLB_GPA(SHV_TEST_TLB_LARGE) | SHV_TEST_TLB_ENTRY | SHV_TEST_TLB_PS;
+	SHV_TEST_CHECK(ShvTestTlbTranslate(vpData, SHV_TEST_TLB_VA, FALSE) ==
+		SHV_TEST_TLB_GPA(SHV_TEST_TLB_LARGE) + (SHV_TEST_TLB_VA & (VMX_EPT_PAGE_SIZE_2MB - 1)));
+	SHV_TEST_CHECK(ShvTestTlbEntry(vpData, SHV_TEST_TLB_VA)->Levels == 3);
+	pd[3] = SHV_TEST_TLB_GPA(SHV_TEST_TLB_PT) | SHV_TEST_TLB_ENTRY;
+
+	//
+	// 5-level paging walks one more table, and makes the VA that isn't
+	// canonical with 4-level paging canonical.
+	//
+	SHV_TEST_CHECK(ShvVmxGuestTranslate(vpData, SHV_TEST_TLB_NONCANONICAL, FALSE, &hpa) == STATUS_ACCESS_VIOLATION);
+
+	pml5[0] = SHV_TEST_TLB_GPA(SHV_TEST_TLB_PML4) | SHV_TEST_TLB_ENTRY;
+	pml5[1] = SHV_TEST_TLB_GPA(SHV_TEST_TLB_PML4) | SHV_TEST_TLB_ENTRY;
+	__vmx_vmwrite(GUEST_CR4, SHV_TEST_TLB_CR4_LA57);
+	__vmx_vmwrite(GUEST_CR3, SHV_TEST_TLB_GPA(SHV_TEST_TLB_PML5));
+
+	SHV_TEST_CHECK(ShvTestTlbTranslate(vpData, SHV_TEST_TLB_VA, FALSE) == SHV_TEST_TLB_GPA(SHV_TEST_TLB_DATA));
+	SHV_TEST_CHECK(ShvTestTlbEntry(vpData, SHV_TEST_TLB_VA)->Levels == 5);
+	SHV_TEST_CHECK(ShvTestTlbTranslate(vpData, SHV_TEST_TLB_NONCANONICAL, FALSE) == SHV_TEST_TLB_GPA(SHV_TEST_TLB_DATA));
+
+	__vmx_vmwrite(GUEST_CR4, 0);
+	__vmx_vmwrite(GUEST_CR3, SHV_TEST_TLB_GPA(SHV_TEST_TLB_PML4));
+
+	//
+	// Without paging, VAs are GPAs.  Paging outside of IA-32e mode isn't
+	// handled.
+	//
+	__vmx_vmwrite(GUEST_CR0, 0);
+	SHV_TEST_CHECK(ShvTestTlbTranslate(vpData, SHV_TEST_TLB_GPA(SHV_TEST_TLB_OTHER) + 0x10, FALSE) ==
+		SHV_TEST_TLB_GPA(SHV_TEST_TLB_OTHER) + 0x10);
+	__vmx_vmwrite(GUEST_CR0, SHV_TEST_TLB_CR0_PG);
+
+	__vmx_vmwrite(VM_ENTRY_CONTROLS, 0);
+	SHV_TEST_CHECK(ShvVmxGuestTranslate(vpData, SHV_TEST_TLB_VA + 2 * PAGE_SIZE, FALSE, &hpa) == STATUS_NOT_SUPPORTED);
+	__vmx_vmwrite(VM_ENTRY_CONTROLS, VM_ENTRY_IA32E_MODE);
+
+	//
+	// Copies can cross into the next page.  One that can't write to both
+	// pages writes to neither, and sizes that aren't from a byte to a page
+	// are turned down.
+	//
+	data = 0x11223344;
+	SHV_TEST_CHECK_SUCCESS(ShvVmxGuestWriteVirtual(vpData, SHV_TEST_TLB_VA + PAGE_SIZE - 2, &data, sizeof(data)));
+	SHV_TEST_CHECK(*(PUSHORT)(memory + SHV_TEST_TLB_DATA * PAGE_SIZE + PAGE_SIZE - 2) == 0x3344);
+	SHV_TEST_CHECK(*(PUSHORT)(memory + SHV_TEST_TLB_NEXT * PAGE_SIZE) == 0x1122);
+
+	value = 0;
+	SHV_TEST_CHECK_SUCCESS(ShvTestReadGuestVirtual(vpData, SHV_TEST_TLB_VA + PAGE_SIZE - 2, &value, sizeof(data)));
+	SHV_TEST_CHECK(value == data);
+
+	pt[5] &= ~SHV_TEST_TLB_WRITE;
+	data = 0x55667788;
+	SHV_TEST_CHECK(ShvVmxGuestWriteVirtual(vpData, SHV_TEST_TLB_VA + PAGE_SIZE - 2, &data, sizeof(data)) == STATUS_ACCESS_VIOLATION);
+	SHV_TEST_CHECK(*(PUSHORT)(memory + SHV_TEST_TLB_DATA * PAGE_SIZE + PAGE_SIZE - 2) == 0x3344);
+	pt[5] |= SHV_TEST_TLB_WRITE;
+
+	SHV_TEST_CHECK(ShvTestReadGuestVirtual(vpData, SHV_TEST_TLB_VA, &value, 0) == STATUS_INVALID_PARAMETER);
+	SHV_TEST_CHECK(ShvTestReadGuestVirtual(vpData, SHV_TEST_TLB_VA, memory, PAGE_SIZE + 1) == STATUS_INVALID_PARAMETER);
+
+	//
+	// Cleaning up gives the windows back, and nothing is translated again.
+	//
+	ShvVmxGuestCleanup();
+
+	SHV_TEST_CHECK(vpData->GuestWindow == NULL);
+	SHV_TEST_CHECK(ShvVmxGuestTranslate(vpData, SHV_TEST_TLB_VA, FALSE, &hpa) == STATUS_NOT_SUPPORTED);
+
+	ShvTestSetGuestMemory(0, NULL, 0);
+	ShvTestPlatFreePages(memory, SHV_TEST_TLB_PAGES * PAGE_SIZE);
+	ShvTestStopEpt();
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+static VOID
+ShvTestTlbBuild(
+	_In_ PUCHAR Memory
+)
+{
+	//
+	// The pages the tables map hold their own number in each byte.  The
+	// PML4 maps the VA in both halves, its copy only in the lower one, and
+	// the PML5 maps nothing until it is used.
+	//
+	__stosb(Memory, 0, SHV_TEST_TLB_PAGES * PAGE_SIZE);
+	__stosb(Memory + SHV_TEST_TLB_DATA * PAGE_SIZE, SHV_TEST_TLB_DATA, PAGE_SIZE);
+	__stosb(Memory + SHV_TEST_TLB_NEXT * PAGE_SIZE, SHV_TEST_TLB_NEXT, PAGE_SIZE);
+	__stosb(Memory + SHV_TEST_TLB_OTHER * PAGE_SIZE, SHV_TEST_TLB_OTHER, PAGE_SIZE);
+
+	SHV_TEST_TLB_TABLE(Memory, SHV_TEST_TLB_PML4)[1] = SHV_TEST_TLB_GPA(SHV_TEST_TLB_PDPT) | SHV_TEST_TLB_ENTRY;
+	SHV_TEST_TLB_TABLE(Memory, SHV_TEST_TLB_PML4)[257] = SHV_TEST_TLB_GPA(SHV_TEST_TLB_PDPT) | SHV_TEST_TLB_ENTRY;
+	SHV_TEST_TLB_TABLE(Memory, SHV_TEST_TLB_PML4_COPY)[1] = SHV_TEST_TLB_GPA(SHV_TEST_TLB_PDPT) | SHV_TEST_TLB_ENTRY;
+	SHV_TEST_TLB_TABLE(Memory, SHV_TEST_TLB_PDPT)[2] = SHV_TEST_TLB_GPA(SHV_TEST_TLB_PD) | SHV_TEST_TLB_ENTRY;
+	SHV_TEST_TLB_TABLE(Memory, SHV_TEST_TLB_PD)[3] = SHV_TEST_TLB_GPA(SHV_TEST_TLB_PT) | SHV_TEST_TLB_ENTRY;
+	SHV_TEST_TLB_TABLE(Memory, SHV_TEST_TLB_PT)[4] = SHV_TEST_TLB_GPA(SHV_TEST_TLB_DATA) | SHV_TEST_TLB_ENTRY;
+	SHV_TEST_TLB_TABLE(Memory, SHV_TEST_TLB_PT)[5] = SHV_TEST_TLB_GPA(SHV_TEST_TLB_NEXT) | SHV_TEST_TLB_ENTRY;
+	SHV_TEST_TLB_TABLE(Memory, SHV_TEST_TLB_PT2)[4] = SHV_TEST_TLB_GPA(SHV_TEST_TLB_OTHER) | SHV_TEST_TLB_ENTRY;
+}
+
+static PSHV_GUEST_TLB_ENTRY
+ShvTestTlbEntry(
+	_In_ PSHV_VP_DATA VpData,
+	_In_ ULONG64 Va
+)
+{
+	return &VpData->GuestTlb.Entries[(Va >> PAGE_SHIFT) % SHV_GUEST_TLB_ENTRIES];
+}
+
+static BOOLEAN
+ShvTestTlbStale(
+	_In_ PSHV_VP_DATA VpData,
+	_In_ ULONG64 Va
+)
+{
+	//
+	// Cache the page, and plant an HPA in its entry that only a hit
+	// returns.
+	//
+	if (!SHV_TEST_CHECK(ShvTestTlbTranslate(VpData, Va, FALSE) != 0))
+	{
+		return FALSE;
+	}
+
+	ShvTestTlbEntry(VpData, Va)->Hpa = SHV_TEST_TLB_STALE;
+
+	return SHV_TEST_CHECK(ShvTestTlbTranslate(VpData, Va, FALSE) == SHV_TEST_TLB_STALE);
+}
+
+static ULONG64
+ShvTestTlbTranslate(
+	_In_ PSHV_VP_DATA VpData,
+	_In_ ULONG64 Va,
+	_In_ BOOLEAN Write
+)
+{
+	ULONG64 hpa;
+
+	if (ShvVmxGuestTranslate(VpData, Va, Write, &hpa) != STATUS_SUCCESS)
+	{
+		return 0;
+	}
+
+	return hpa;
+}
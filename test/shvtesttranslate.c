@@ -0,0 +1,38 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvtesttranslate.c
+
+Abstract:
+
+	This module builds the guest memory module into the test harness.  It
+	is included whole, rather than linked, since the rest of the harness
+	reads guest memory through the stand-in in shvtestguest.c, which has
+	no guest page tables.  The routines both of them have are renamed
+	here, and the guest page tables this one walks are in memory the test
+	provides.
+
+Author:
+
+	agent (@agent) 16-Oct-2026 - Initial version
+
+Environment:
+
+	User mode only.
+
+--*/
+
+#define ShvVmxGuestReadVirtual          ShvTestReadGuestVirtual
+#define ShvVmxGuestMap                  ShvTestMapGuestWindow
+#define ShvVmxGuestUnmap                ShvTestUnmapGuestWindow
+
+#include "../shvvmxguest.c"
+
+#undef ShvVmxGuestReadVirtual
+#undef ShvVmxGuestMap
+#undef ShvVmxGuestUnmap
+
+#include "shvtest.h"
@@ -0,0 +1,286 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvtestve.c
+
+Abstract:
+
+	This module tests delivering EPT violations to the guest as #VE: that
+	it is only on when the processor supports it, that every VMCS points at
+	the information area of its VP, that every entry suppresses #VE unless
+	its range was reported, empty ones included, and that splitting and
+	promoting large pages keeps whether they do.
+
+Author:
+
+	agent (@agent) 16-Oct-2026 - Initial version
+
+Environment:
+
+	User mode only.
+
+--*/
+
+#include "shvtest.h"
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// A 4 KiB page at the start of a 2 MiB page of RAM in the first 1 GiB, the
+// page right after it, and MMIO well above the RAM of the default machine.
+//
+#define SHV_TEST_VE_PAGE                (0x200000)
+#define SHV_TEST_VE_NEXT                (SHV_TEST_VE_PAGE + PAGE_SIZE)
+#define SHV_TEST_VE_MMIO                (8 * SHV_TEST_GB)
+
+//
+// How many LPs there are, each with a VMCS of its own.
+//
+#define SHV_TEST_VE_PROCESSORS          (4)
+
+// ===========================================================================
+//
+// LOCAL PROTOTYPES
+//
+// ===========================================================================
+
+static BOOLEAN
+ShvTestVeStart(
+	_In_ BOOLEAN Supported,
+	_In_ BOOLEAN DemandPopulate
+);
+
+static BOOLEAN
+ShvTestVeSuppressed(
+	_In_ ULONG View,
+	_In_ ULONG64 Gpa
+);
+
+static VOID
+ShvTestVeFault(
+	_In_ ULONG64 Gpa
+);
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+VOID
+ShvTestVirtualizationExceptions(
+	VOID
+)
+{
+	ULONG64 value;
+	LONG64 generation;
+	ULONG view, level;
+
+	//
+	// Asking for #VE on a processor that can't deliver them changes
+	// nothing.  Entries leave the flag clear, which the processor ignores.
+	//
+	if (!ShvTestVeStart(FALSE, FALSE))
+	{
+		return;
+	}
+
+	SHV_TEST_CHECK(ShvVmxEptVeEnabled == FALSE);
+	SHV_TEST_CHECK(!ShvTestVeSuppressed(SHV_EPT_DEFAULT_VIEW, SHV_TEST_VE_PAGE));
+	SHV_TEST_CHECK(ShvVmxEptReportViewRange(SHV_EPT_DEFAULT_VIEW,
+		SHV_TEST_VE_PAGE, PAGE_SIZE, TRUE) == STATUS_NOT_SUPPORTED);
+
+	ShvTestStopEpt();
+
+	//
+	// With support, every VMCS points at the information area of its own
+	// VP, which starts out busy so that nothing is delivered before the
+	// guest handler is there.  Every leaf suppresses #VE, as does every
+	// entry that isn't filled in yet, or faults on MMIO nobody asked about
+	// would reach the guest.
+	//
+	if (!ShvTestVeStart(TRUE, TRUE))
+	{
+		return;
+	}
+
+	if (!SHV_TEST_CHECK(ShvVmxEptVeEnabled))
+	{
+		ShvTestStopEpt();
+		return;
+	}
+
+	for (ULONG i = 0; i < SHV_TEST_VE_PROCESSORS; i++)
+	{
+		ShvTestSetCurrentProcessor(i);
+
+		__vmx_vmread(VIRT_EXCEPTION_INFO, (PSIZE_T)&value);
+		SHV_TEST_CHECK(value == ShvGlobalData->VpData[i].VePhysicalAddress);
+
+		__vmx_vmread(EPTP_INDEX, (PSIZE_T)&value);
+		SHV_TEST_CHECK(value == SHV_EPT_DEFAULT_VIEW);
+
+		SHV_TEST_CHECK(ShvGlobalData->VpData[i].VeInformation.Busy == MAXULONG);
+	}
+
+	ShvTestSetCurrentProcessor(0);
+
+	SHV_TEST_CHECK(ShvTestVeSuppressed(SHV_EPT_DEFAULT_VIEW, 0x1000));
+	SHV_TEST_CHECK(ShvTestLookupEptView(SHV_EPT_DEFAULT_VIEW, SHV_TEST_VE_MMIO, &level) == VMX_EPT_SUPPRESS_VE);
+
+	//
+	// Faults fill in leaves that suppress #VE, and a table they complete
+	// is promoted with the flag kept.
+	//
+	ShvTestVeFault(SHV_TEST_VE_MMIO);
+	ShvTestVeFault(0x150000);
+
+	SHV_TEST_CHECK(ShvTestVeSuppressed(SHV_EPT_DEFAULT_VIEW, SHV_TEST_VE_MMIO));
+	SHV_TEST_CHECK(ShvVmxEptGetPageSize(0x1000) == VMX_EPT_PAGE_SIZE_1GB);
+	SHV_TEST_CHECK(ShvTestVeSuppressed(SHV_EPT_DEFAULT_VIEW, 0x1000));
+
+	ShvTestStopEpt();
+
+	//
+	// Reporting a page splits the large page it is in, and only that page
+	// stops suppressing #VE.  Its permissions stay as they are, but VPs
+	// may have cached the flag, so every VP flushes.  Reporting works on
+	// the default view as well, since it takes no access away.
+	//
+	if (!ShvTestVeStart(TRUE, FALSE))
+	{
+		return;
+	}
+
+	generation = ShvTestGetEptGeneration();
+
+	SHV_TEST_CHECK_SUCCESS(ShvVmxEptReportViewRange(SHV_EPT_DEFAULT_VIEW, SHV_TEST_VE_PAGE, PAGE_SIZE, TRUE));
+
+	SHV_TEST_CHECK(ShvTestGetEptGeneration() == generation + 1);
+	SHV_TEST_CHECK(!ShvTestVeSuppressed(SHV_EPT_DEFAULT_VIEW, SHV_TEST_VE_PAGE));
+	SHV_TEST_CHECK(ShvTestVeSuppressed(SHV_EPT_DEFAULT_VIEW, SHV_TEST_VE_NEXT));
+	SHV_TEST_CHECK(ShvVmxEptGetPageSize(SHV_TEST_VE_PAGE) == PAGE_SIZE);
+
+	value = ShvTestLookupEptView(SHV_EPT_DEFAULT_VIEW, SHV_TEST_VE_PAGE, &level);
+	SHV_TEST_CHECK((value & VMX_EPT_ACCESS_RWX) == VMX_EPT_ACCESS_RWX);
+
+	//
+	// A view cloned from it reports the same page.  Taking access away in
+	// the view splits a 2 MiB page whose children all still suppress #VE.
+	// Asking for the page again makes it suppress #VE in that view only.
+	//
+	if (!SHV_TEST_CHECK_SUCCESS(ShvVmxEptCreateView(&view)))
+	{
+		ShvTestStopEpt();
+		return;
+	}
+
+	SHV_TEST_CHECK(!ShvTestVeSuppressed(view, SHV_TEST_VE_PAGE));
+
+	SHV_TEST_CHECK_SUCCESS(ShvVmxEptProtectViewRange(view, 0x400000, PAGE_SIZE, VMX_EPT_ACCESS_READ));
+	SHV_TEST_CHECK(ShvTestVeSuppressed(view, 0x400000));
+	SHV_TEST_CHECK(ShvTestVeSuppressed(view, 0x401000));
+
+	SHV_TEST_CHECK_SUCCESS(ShvVmxEptReportViewRange(view, SHV_TEST_VE_PAGE, PAGE_SIZE, FALSE));
+	SHV_TEST_CHECK(ShvTestVeSuppressed(view, SHV_TEST_VE_PAGE));
+	SHV_TEST_CHECK(!ShvTestVeSuppressed(SHV_EPT_DEFAULT_VIEW, SHV_TEST_VE_PAGE));
+
+	SHV_TEST_CHECK(ShvVmxEptReportViewRange(view + 1, SHV_TEST_VE_PAGE, PAGE_SIZE, TRUE) == STATUS_INVALID_PARAMETER);
+	SHV_TEST_CHECK_SUCCESS(ShvVmxEptReportViewRange(view + 1, SHV_TEST_VE_PAGE, 0, TRUE));
+
+	//
+	// The processor tells the guest handler which view the VP was in.
+	//
+	ShvVmxEptSwitchView(view);
+
+	__vmx_vmread(EPTP_INDEX, (PSIZE_T)&value);
+	SHV_TEST_CHECK(value == view);
+
+	ShvVmxEptSwitchView(SHV_EPT_DEFAULT_VIEW);
+
+	__vmx_vmread(EPTP_INDEX, (PSIZE_T)&value);
+	SHV_TEST_CHECK(value == SHV_EPT_DEFAULT_VIEW);
+
+	ShvTestStopEpt();
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+static BOOLEAN
+ShvTestVeStart(
+	_In_ BOOLEAN Supported,
+	_In_ BOOLEAN DemandPopulate
+)
+{
+	ULONG64 controls;
+
+	//
+	// Views need EPTP switching as well.
+	//
+	controls = SECONDARY_EXEC_ENABLE_EPT | SECONDARY_EXEC_ENABLE_VM_FUNCTIONS;
+	if (Supported)
+	{
+		controls |= SECONDARY_EXEC_ENABLE_VIRT_EXCEPTIONS;
+	}
+
+	ShvTestSetMsr(MSR_IA32_VMX_PROCBASED_CTLS2, controls << 32);
+	ShvTestSetMsr(MSR_IA32_VMX_VMFUNC, VMX_VMFUNC_EPTP_SWITCHING);
+	ShvTestSetProcessors(SHV_TEST_VE_PROCESSORS, 1);
+	ShvTestConfigureEpt(DemandPopulate, FALSE, FALSE);
+	ShvTestRequestEptVe(TRUE);
+
+	//
+	// What the driver does for each VP before the EPT is set up.
+	//
+	for (ULONG i = 0; i < SHV_TEST_VE_PROCESSORS; i++)
+	{
+		ShvGlobalData->VpData[i].VePhysicalAddress =
+			MmGetPhysicalAddress(&ShvGlobalData->VpData[i].VeInformation).QuadPart;
+	}
+
+	return SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt());
+}
+
+static BOOLEAN
+ShvTestVeSuppressed(
+	_In_ ULONG View,
+	_In_ ULONG64 Gpa
+)
+{
+	ULONG level;
+
+	return (ShvTestLookupEptView(View, Gpa, &level) & VMX_EPT_SUPPRESS_VE) != 0;
+}
+
+static VOID
+ShvTestVeFault(
+	_In_ ULONG64 Gpa
+)
+{
+	SHV_VP_STATE vpState;
+	KIRQL irql;
+
+	//
+	// A read of a GPA the EPT doesn't map yet, taken in root mode with
+	// interrupts off.
+	//
+	__stosb((PUCHAR)&vpState, 0, sizeof(vpState));
+
+	__vmx_vmwrite(GUEST_PHYSICAL_ADDRESS, Gpa);
+	__vmx_vmwrite(EXIT_QUALIFICATION, VMX_EPT_ACCESS_READ);
+
+	KeRaiseIrql(HIGH_LEVEL, &irql);
+	ShvVmxEptHandleViolation(&vpState);
+	KeLowerIrql(irql);
+}
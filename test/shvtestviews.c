@@ -0,0 +1,284 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvtestviews.c
+
+Abstract:
+
+	This module tests the EPT views that VMFUNC switches between: that they
+	are only there when the processor can switch EPTPs, that each one is
+	published in the EPTP list, that views share every table neither of
+	them changed, and that changing one view never shows through in
+	another.
+
+Author:
+
+	agent (@agent) 16-Oct-2026 - Initial version
+
+Environment:
+
+	User mode only.
+
+--*/
+
+#include "shvtest.h"
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// A 4 KiB page at the start of a 2 MiB page of RAM in the first 1 GiB, the
+// page right after it, and a 1 GiB page of the RAM above 4 GiB.
+//
+#define SHV_TEST_VIEWS_PAGE             (0x200000)
+#define SHV_TEST_VIEWS_NEXT             (SHV_TEST_VIEWS_PAGE + PAGE_SIZE)
+#define SHV_TEST_VIEWS_HUGE             (4 * SHV_TEST_GB)
+
+//
+// The bits of an EPTP other than the PFN of its PML4.
+//
+#define SHV_TEST_VIEWS_EPTP_FLAGS       (PAGE_SIZE - 1)
+
+// ===========================================================================
+//
+// LOCAL PROTOTYPES
+//
+// ===========================================================================
+
+static ULONG64
+ShvTestViewsTables(
+	VOID
+);
+
+static ULONG
+ShvTestViewsAccess(
+	_In_ ULONG View,
+	_In_ ULONG64 Gpa,
+	_Out_ PULONG Level
+);
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+VOID
+ShvTestViews(
+	VOID
+)
+{
+	ULONG64 tables, eptp, value;
+	LONG64 generation;
+	ULONG view, clone, level;
+	NTSTATUS status;
+
+	//
+	// Without EPTP switching there is only the default view, which can't
+	// be changed.
+	//
+	if (!SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+	{
+		return;
+	}
+
+	SHV_TEST_CHECK(ShvVmxEptVmfuncEnabled == FALSE);
+	SHV_TEST_CHECK(ShvVmxEptCreateView(&view) == STATUS_NOT_SUPPORTED);
+	SHV_TEST_CHECK(view == SHV_EPT_DEFAULT_VIEW);
+	SHV_TEST_CHECK(ShvVmxEptProtectViewRange(SHV_EPT_DEFAULT_VIEW,
+		SHV_TEST_VIEWS_PAGE, PAGE_SIZE, VMX_EPT_ACCESS_READ) == STATUS_INVALID_PARAMETER);
+
+	ShvTestStopEpt();
+
+	//
+	// With it, every VMCS lets the guest switch between the views of the
+	// EPTP list, which starts out with just the default view.
+	//
+	ShvTestSetMsr(MSR_IA32_VMX_PROCBASED_CTLS2,
+		(ULONG64)(SECONDARY_EXEC_ENABLE_EPT | SECONDARY_EXEC_ENABLE_VM_FUNCTIONS) << 32);
+	ShvTestSetMsr(MSR_IA32_VMX_VMFUNC, VMX_VMFUNC_EPTP_SWITCHING);
+
+	if (!SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+	{
+		return;
+	}
+
+	if (!SHV_TEST_CHECK(ShvVmxEptVmfuncEnabled))
+	{
+		ShvTestStopEpt();
+		return;
+	}
+
+	__vmx_vmread(VM_FUNCTION_CONTROL, (PSIZE_T)&value);
+	SHV_TEST_CHECK(value == VMX_VMFUNC_EPTP_SWITCHING);
+
+	__vmx_vmread(EPTP_LIST_ADDR, (PSIZE_T)&value);
+	SHV_TEST_CHECK(value != 0);
+
+	__vmx_vmread(EPT_POINTER, (PSIZE_T)&eptp);
+	SHV_TEST_CHECK(ShvTestGetEptViewEptp(SHV_EPT_DEFAULT_VIEW) == eptp);
+	SHV_TEST_CHECK(ShvTestGetEptViewEptp(1) == 0);
+
+	//
+	// A new view only needs a PML4 of its own, and maps everything the way
+	// the default view does, through the same tables.  Its EPTP is in the
+	// list before it is handed out.
+	//
+	tables = ShvTestViewsTables();
+
+	if (!SHV_TEST_CHECK_SUCCESS(ShvVmxEptCreateView(&view)))
+	{
+		ShvTestStopEpt();
+		return;
+	}
+
+	SHV_TEST_CHECK(view == 1);
+	SHV_TEST_CHECK(ShvTestViewsTables() == tables + 1);
+
+	value = ShvTestGetEptViewEptp(view);
+	SHV_TEST_CHECK((value & ~SHV_TEST_VIEWS_EPTP_FLAGS) != (eptp & ~SHV_TEST_VIEWS_EPTP_FLAGS));
+	SHV_TEST_CHECK((value & SHV_TEST_VIEWS_EPTP_FLAGS) == (eptp & SHV_TEST_VIEWS_EPTP_FLAGS));
+
+	SHV_TEST_CHECK(ShvTestLookupEptView(view, SHV_TEST_VIEWS_PAGE, &level) ==
+		ShvTestLookupEptView(SHV_EPT_DEFAULT_VIEW, SHV_TEST_VIEWS_PAGE, &level));
+	SHV_TEST_CHECK(level == 2);
+
+	//
+	// Taking write and execute away from a page of it copies the PDPT and
+	// the PD on the way down, and splits the 2 MiB page into a PT.  Only
+	// that page changes, and only in this view, but every VP may have
+	// cached it, so every VP flushes.
+	//
+	generation = ShvTestGetEptGeneration();
+
+	SHV_TEST_CHECK_SUCCESS(ShvVmxEptProtectViewRange(view, SHV_TEST_VIEWS_PAGE, PAGE_SIZE, VMX_EPT_ACCESS_READ));
+
+	SHV_TEST_CHECK(ShvTestGetEptGeneration() == generation + 1);
+	SHV_TEST_CHECK(ShvTestViewsTables() == tables + 4);
+
+	SHV_TEST_CHECK(ShvTestViewsAccess(view, SHV_TEST_VIEWS_PAGE, &level) == VMX_EPT_ACCESS_READ);
+	SHV_TEST_CHECK(level == 1);
+	SHV_TEST_CHECK(ShvTestViewsAccess(view, SHV_TEST_VIEWS_NEXT, &level) == VMX_EPT_ACCESS_RWX);
+	SHV_TEST_CHECK(level == 1);
+
+	SHV_TEST_CHECK(ShvTestViewsAccess(SHV_EPT_DEFAULT_VIEW, SHV_TEST_VIEWS_PAGE, &level) == VMX_EPT_ACCESS_RWX);
+	SHV_TEST_CHECK(level == 2);
+
+	SHV_TEST_CHECK(ShvTestLookupEptView(view, SHV_TEST_VIEWS_HUGE, &level) ==
+		ShvTestLookupEptView(SHV_EPT_DEFAULT_VIEW, SHV_TEST_VIEWS_HUGE, &level));
+
+	//
+	// A clone starts out with the changes of the view it was cloned from,
+	// and shares all of its tables.  Giving the page back its access in
+	// the clone copies them again, and leaves the original alone.  Only
+	// adding access needs no flush.
+	//
+	if (!SHV_TEST_CHECK_SUCCESS(ShvVmxEptCloneView(view, &clone)))
+	{
+		ShvTestStopEpt();
+		return;
+	}
+
+	SHV_TEST_CHECK(clone == 2);
+	SHV_TEST_CHECK(ShvTestViewsTables() == tables + 5);
+	SHV_TEST_CHECK(ShvTestViewsAccess(clone, SHV_TEST_VIEWS_PAGE, &level) == VMX_EPT_ACCESS_READ);
+
+	generation = ShvTestGetEptGeneration();
+
+	SHV_TEST_CHECK_SUCCESS(ShvVmxEptProtectViewRange(clone, SHV_TEST_VIEWS_PAGE, PAGE_SIZE, VMX_EPT_ACCESS_RWX));
+
+	SHV_TEST_CHECK(ShvTestGetEptGeneration() == generation);
+	SHV_TEST_CHECK(ShvTestViewsTables() == tables + 8);
+	SHV_TEST_CHECK(ShvTestViewsAccess(clone, SHV_TEST_VIEWS_PAGE, &level) == VMX_EPT_ACCESS_RWX);
+	SHV_TEST_CHECK(ShvTestViewsAccess(view, SHV_TEST_VIEWS_PAGE, &level) == VMX_EPT_ACCESS_READ);
+
+	//
+	// Changing a view that no other view shares tables with doesn't copy
+	// anything.
+	//
+	SHV_TEST_CHECK_SUCCESS(ShvVmxEptProtectViewRange(clone, SHV_TEST_VIEWS_NEXT, PAGE_SIZE, VMX_EPT_ACCESS_READ));
+
+	SHV_TEST_CHECK(ShvTestViewsTables() == tables + 8);
+	SHV_TEST_CHECK(ShvTestViewsAccess(clone, SHV_TEST_VIEWS_NEXT, &level) == VMX_EPT_ACCESS_READ);
+	SHV_TEST_CHECK(ShvTestViewsAccess(view, SHV_TEST_VIEWS_NEXT, &level) == VMX_EPT_ACCESS_RWX);
+
+	//
+	// Views that aren't there, the default view and bits that aren't
+	// permissions are all turned down.
+	//
+	SHV_TEST_CHECK(ShvVmxEptCloneView(3, &clone) == STATUS_INVALID_PARAMETER);
+	SHV_TEST_CHECK(ShvVmxEptProtectViewRange(3, SHV_TEST_VIEWS_PAGE, PAGE_SIZE, 0) == STATUS_INVALID_PARAMETER);
+	SHV_TEST_CHECK(ShvVmxEptProtectViewRange(SHV_EPT_DEFAULT_VIEW,
+		SHV_TEST_VIEWS_PAGE, PAGE_SIZE, 0) == STATUS_INVALID_PARAMETER);
+	SHV_TEST_CHECK(ShvVmxEptProtectViewRange(view,
+		SHV_TEST_VIEWS_PAGE, PAGE_SIZE, VMX_EPT_ACCESS_RWX | 0x8) == STATUS_INVALID_PARAMETER);
+
+	//
+	// Switching from root mode points the VMCS at the view's EPTP, and the
+	// default view at the identity map again.
+	//
+	ShvVmxEptSwitchView(view);
+
+	__vmx_vmread(EPT_POINTER, (PSIZE_T)&value);
+	SHV_TEST_CHECK(value == ShvTestGetEptViewEptp(view));
+
+	ShvVmxEptSwitchView(SHV_EPT_DEFAULT_VIEW);
+
+	__vmx_vmread(EPT_POINTER, (PSIZE_T)&value);
+	SHV_TEST_CHECK(value == eptp);
+
+	//
+	// The EPTP list has room for a page of views, and no more.  The
+	// default view, the view and its clone are there already.
+	//
+	for (ULONG i = 3; i < SHV_EPT_MAX_VIEWS; i++)
+	{
+		status = ShvVmxEptCreateView(&view);
+		if (!SHV_TEST_CHECK_SUCCESS(status) || !SHV_TEST_CHECK(view == i))
+		{
+			break;
+		}
+	}
+
+	SHV_TEST_CHECK(ShvTestGetEptViewEptp(SHV_EPT_MAX_VIEWS - 1) != 0);
+	SHV_TEST_CHECK(ShvVmxEptCreateView(&view) == STATUS_HV_NO_RESOURCES);
+	SHV_TEST_CHECK(view == SHV_EPT_DEFAULT_VIEW);
+	SHV_TEST_CHECK(ShvTestCheckEptArena() == 0);
+
+	ShvTestStopEpt();
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+static ULONG64
+ShvTestViewsTables(
+	VOID
+)
+{
+	ULONG64 tables;
+	ULONG exhausted;
+
+	ShvTestQueryEptArena(&tables, &exhausted);
+
+	return tables;
+}
+
+static ULONG
+ShvTestViewsAccess(
+	_In_ ULONG View,
+	_In_ ULONG64 Gpa,
+	_Out_ PULONG Level
+)
+{
+	return (ULONG)ShvTestLookupEptView(View, Gpa, Level) & VMX_EPT_ACCESS_RWX;
+}
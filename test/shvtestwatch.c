@@ -0,0 +1,74 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvtestwatch.c
+
+Abstract:
+
+	This module builds the watchpoint module into the test harness.  It is
+	included whole, rather than linked, so that tests can turn watchpoints
+	and the store emulator on and off.
+
+Author:
+
+	agent (@agent) 16-Oct-2026 - Initial version
+
+Environment:
+
+	User mode only.
+
+--*/
+
+#include "../shvvmxwatch.c"
+#include "shvtest.h"
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+NTSTATUS
+ShvTestStartWatch(
+	_In_ BOOLEAN Emulate
+)
+{
+	//
+	// Watchpoints come up after the EPT, the way the driver brings them up,
+	// and start out with nothing counted.
+	//
+	ShvVmxWatchRequested = TRUE;
+	ShvVmxWatchEmulate = Emulate;
+
+	__stosb((PUCHAR)&ShvVmxWatchStatistics, 0, sizeof(ShvVmxWatchStatistics));
+
+	return ShvVmxWatchInitialize();
+}
+
+VOID
+ShvTestStopWatch(
+	VOID
+)
+{
+	ShvVmxWatchCleanup();
+
+	ShvVmxWatchRequested = SHV_WATCH_ENABLE;
+	ShvVmxWatchEmulate = SHV_WATCH_EMULATE;
+}
+
+BOOLEAN
+ShvTestFilterWatch(
+	_In_ PSHV_VP_STATE VpState,
+	_In_ ULONG64 Gpa,
+	_In_ ULONG Access
+)
+{
+	//
+	// The handler the EPT module calls for violations on protected pages,
+	// for tests that need to see whether it claimed one.
+	//
+	return ShvVmxWatchHandleViolation(VpState, Gpa, Access);
+}
@@ -0,0 +1,247 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Module Name:
+
+	shvtestworkingset.c
+
+Abstract:
+
+	This module tests the working set sweep: that it only runs when the
+	processor sets EPT accessed and dirty flags, that it counts the bytes
+	and regions the guest touched at every page size, and that it clears
+	the flags so the next sweep only sees what was touched since.
+
+Author:
+
+	agent (@agent) 16-Oct-2026 - Initial version
+
+Environment:
+
+	User mode only.
+
+--*/
+
+#include "shvtest.h"
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// The mask of a variable MTRR that covers a single 4 KiB page of the
+// default machine's 46-bit physical address space.  Uncaching one page at
+// the end of the first 2 MiB keeps them in a PT.
+//
+#define SHV_TEST_WS_PAGE_MASK           ((((1ULL << 46) - 1) & ~(PAGE_SIZE - 1ULL)) | MTRR_PHYSMASK_VALID)
+#define SHV_TEST_WS_UNCACHED            (0x1ff000)
+
+//
+// A 2 MiB page of RAM in the first 1 GiB, and a 1 GiB page of the RAM
+// above 4 GiB.
+//
+#define SHV_TEST_WS_LARGE               (0x400000)
+#define SHV_TEST_WS_HUGE                (4 * SHV_TEST_GB)
+
+//
+// The bucket of a region that had every one of its 512 pages touched.
+//
+#define SHV_TEST_WS_FULL                (SHV_EPT_WS_BUCKETS - 1)
+
+// ===========================================================================
+//
+// LOCAL PROTOTYPES
+//
+// ===========================================================================
+
+static BOOLEAN
+ShvTestWorkingSetStart(
+	_In_ ULONG64 Capabilities,
+	_In_ BOOLEAN Track
+);
+
+static ULONG64
+ShvTestWorkingSetRegions(
+	_In_reads_(SHV_EPT_WS_BUCKETS) const ULONG64 *Buckets
+);
+
+// ===========================================================================
+//
+// PUBLIC FUNCTIONS
+//
+// ===========================================================================
+
+VOID
+ShvTestWorkingSet(
+	VOID
+)
+{
+	SHV_EPT_WORKING_SET workingSet;
+	LONG64 generation;
+
+	//
+	// Nothing is swept unless asked to, nor without the flags to sweep.
+	//
+	if (!ShvTestWorkingSetStart(SHV_TEST_EPT_CAPS_1GB | VMX_EPT_CAP_ACCESSED_DIRTY, FALSE))
+	{
+		return;
+	}
+
+	SHV_TEST_CHECK(!ShvTestScanEptWorkingSet());
+	ShvTestStopEpt();
+
+	if (!ShvTestWorkingSetStart(SHV_TEST_EPT_CAPS_1GB, TRUE))
+	{
+		return;
+	}
+
+	SHV_TEST_CHECK(!ShvTestScanEptWorkingSet());
+
+	ShvVmxEptQueryWorkingSet(&workingSet);
+	SHV_TEST_CHECK(workingSet.Scans == 0);
+
+	ShvTestStopEpt();
+
+	//
+	// With them, a sweep of tables the guest never touched finds nothing,
+	// and isn't even counted as an untouched region.
+	//
+	if (!ShvTestWorkingSetStart(SHV_TEST_EPT_CAPS_1GB | VMX_EPT_CAP_ACCESSED_DIRTY, TRUE))
+	{
+		return;
+	}
+
+	SHV_TEST_CHECK(ShvTestScanEptWorkingSet());
+
+	ShvVmxEptQueryWorkingSet(&workingSet);
+	SHV_TEST_CHECK(workingSet.Scans == 1);
+	SHV_TEST_CHECK(workingSet.AccessedBytes == 0);
+	SHV_TEST_CHECK(workingSet.DirtyBytes == 0);
+	SHV_TEST_CHECK(ShvTestWorkingSetRegions(workingSet.Accessed) == 0);
+	SHV_TEST_CHECK(ShvTestWorkingSetRegions(workingSet.Dirty) == 0);
+
+	//
+	// Three pages of the PT read, one of them written, twice.  A 2 MiB page
+	// read, and a 1 GiB page written, each counted whole and as every 2 MiB
+	// region in it.  The sweep flushes every VP once, since the processor
+	// doesn't set the flags again for what it has cached.
+	//
+	ShvTestAccessEpt(0x1000, FALSE);
+	ShvTestAccessEpt(0x2000, TRUE);
+	ShvTestAccessEpt(0x2000, TRUE);
+	ShvTestAccessEpt(0x3000, FALSE);
+	ShvTestAccessEpt(SHV_TEST_WS_LARGE + 0x5000, FALSE);
+	ShvTestAccessEpt(SHV_TEST_WS_HUGE + 0x5000, TRUE);
+
+	generation = ShvTestGetEptGeneration();
+	SHV_TEST_CHECK(ShvTestScanEptWorkingSet());
+	SHV_TEST_CHECK(ShvTestGetEptGeneration() == generation + 1);
+
+	ShvVmxEptQueryWorkingSet(&workingSet);
+	SHV_TEST_CHECK(workingSet.Scans == 2);
+	SHV_TEST_CHECK(workingSet.AccessedBytes == 3 * PAGE_SIZE + VMX_EPT_PAGE_SIZE_2MB + VMX_EPT_PAGE_SIZE_1GB);
+	SHV_TEST_CHECK(workingSet.DirtyBytes == PAGE_SIZE + VMX_EPT_PAGE_SIZE_1GB);
+
+	SHV_TEST_CHECK(workingSet.Accessed[0] == 0);
+	SHV_TEST_CHECK(workingSet.Accessed[2] == 1);
+	SHV_TEST_CHECK(workingSet.Accessed[SHV_TEST_WS_FULL] == 1 + 512);
+	SHV_TEST_CHECK(ShvTestWorkingSetRegions(workingSet.Accessed) == 1 + 1 + 512);
+
+	SHV_TEST_CHECK(workingSet.Dirty[0] == 1);
+	SHV_TEST_CHECK(workingSet.Dirty[1] == 1);
+	SHV_TEST_CHECK(workingSet.Dirty[SHV_TEST_WS_FULL] == 512);
+	SHV_TEST_CHECK(ShvTestWorkingSetRegions(workingSet.Dirty) == 1 + 1 + 512);
+
+	//
+	// The sweep cleared every flag it counted, so the next one only sees
+	// what was touched since.
+	//
+	SHV_TEST_CHECK(!ShvTestIsEptDirty(0x2000));
+	SHV_TEST_CHECK(!ShvTestIsEptDirty(SHV_TEST_WS_HUGE));
+
+	SHV_TEST_CHECK(ShvTestScanEptWorkingSet());
+
+	ShvVmxEptQueryWorkingSet(&workingSet);
+	SHV_TEST_CHECK(workingSet.Scans == 3);
+	SHV_TEST_CHECK(workingSet.AccessedBytes == 0);
+	SHV_TEST_CHECK(workingSet.DirtyBytes == 0);
+	SHV_TEST_CHECK(ShvTestWorkingSetRegions(workingSet.Accessed) == 0);
+
+	//
+	// A PT with every page touched lands in the last bucket, the same as a
+	// 2 MiB page.
+	//
+	for (ULONG64 gpa = 0; gpa < VMX_EPT_PAGE_SIZE_2MB; gpa += PAGE_SIZE)
+	{
+		ShvTestAccessEpt(gpa, TRUE);
+	}
+
+	SHV_TEST_CHECK(ShvTestScanEptWorkingSet());
+
+	ShvVmxEptQueryWorkingSet(&workingSet);
+	SHV_TEST_CHECK(workingSet.Scans == 4);
+	SHV_TEST_CHECK(workingSet.AccessedBytes == VMX_EPT_PAGE_SIZE_2MB);
+	SHV_TEST_CHECK(workingSet.DirtyBytes == VMX_EPT_PAGE_SIZE_2MB);
+	SHV_TEST_CHECK(workingSet.Accessed[SHV_TEST_WS_FULL] == 1);
+	SHV_TEST_CHECK(workingSet.Dirty[SHV_TEST_WS_FULL] == 1);
+	SHV_TEST_CHECK(ShvTestWorkingSetRegions(workingSet.Accessed) == 1);
+
+	ShvTestStopEpt();
+
+	ShvTestSetMsr(MSR_IA32_MTRRCAP, 1);
+	ShvTestSetMsr(MSR_IA32_MTRR_PHYSMASK0 + 2, 0);
+}
+
+// ===========================================================================
+//
+// LOCAL FUNCTIONS
+//
+// ===========================================================================
+
+static BOOLEAN
+ShvTestWorkingSetStart(
+	_In_ ULONG64 Capabilities,
+	_In_ BOOLEAN Track
+)
+{
+	ShvTestSetMsr(MSR_IA32_VMX_EPT_VPID_CAP, Capabilities);
+	ShvTestSetMsr(MSR_IA32_MTRRCAP, 2);
+	ShvTestSetMsr(MSR_IA32_MTRR_PHYSBASE0 + 2, SHV_TEST_WS_UNCACHED | Uncacheable);
+	ShvTestSetMsr(MSR_IA32_MTRR_PHYSMASK0 + 2, SHV_TEST_WS_PAGE_MASK);
+	ShvTestTrackEptWorkingSet(Track);
+
+	if (!SHV_TEST_CHECK_SUCCESS(ShvTestStartEpt()))
+	{
+		return FALSE;
+	}
+
+	//
+	// The first 2 MiB are in a PT, the rest of the first 1 GiB in 2 MiB
+	// pages, and the RAM above 4 GiB in a 1 GiB page.
+	//
+	SHV_TEST_CHECK(ShvVmxEptGetPageSize(0x1000) == PAGE_SIZE);
+	SHV_TEST_CHECK(ShvVmxEptGetPageSize(SHV_TEST_WS_LARGE) == VMX_EPT_PAGE_SIZE_2MB);
+	SHV_TEST_CHECK(ShvVmxEptGetPageSize(SHV_TEST_WS_HUGE) == VMX_EPT_PAGE_SIZE_1GB);
+
+	return TRUE;
+}
+
+static ULONG64
+ShvTestWorkingSetRegions(
+	_In_reads_(SHV_EPT_WS_BUCKETS) const ULONG64 *Buckets
+)
+{
+	ULONG64 regions;
+
+	regions = 0;
+
+	for (ULONG i = 0; i < SHV_EPT_WS_BUCKETS; i++)
+	{
+		regions += Buckets[i];
+	}
+
+	return regions;
+}
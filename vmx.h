@@ -118,6 +118,7 @@ Environment:
 #define MSR_IA32_VMX_TRUE_PROCBASED_CTLS        0x48e
 #define MSR_IA32_VMX_TRUE_EXIT_CTLS             0x48f
 #define MSR_IA32_VMX_TRUE_ENTRY_CTLS            0x490
+#define MSR_IA32_VMX_VMFUNC                     0x491
 #define IA32_APIC_BASE_MSR                      0x1b
 #define IA32_FEATURE_CONTROL_MSR                0x3a
 #define IA32_FEATURE_CONTROL_MSR_LOCK                     0x0001
@@ -125,6 +126,8 @@ Environment:
 #define IA32_FEATURE_CONTROL_MSR_ENABLE_VMXON_OUTSIDE_SMX 0x0004
 #define IA32_FEATURE_CONTROL_MSR_SENTER_PARAM_CTL         0x7f00
 #define IA32_FEATURE_CONTROL_MSR_ENABLE_SENTER            0x8000
+#define IA32_LSTAR_MSR                          0xc0000082
+#define IA32_KERNEL_GS_BASE_MSR                 0xc0000102
 
 enum vmcs_field {
 	VIRTUAL_PROCESSOR_ID = 0x00000000,
@@ -324,6 +327,7 @@ enum vmcs_field {
 #define EXIT_REASON_APIC_WRITE          56
 #define EXIT_REASON_RDRAND              57
 #define EXIT_REASON_INVPCID             58
+#define EXIT_REASON_VMFUNC              59
 #define EXIT_REASON_RDSEED              61
 #define EXIT_REASON_PML_FULL            62
 #define EXIT_REASON_XSAVES              63
@@ -333,3 +337,21 @@ enum vmcs_field {
 #define GUEST_ACTIVITY_ACTIVE           0
 #define GUEST_ACTIVITY_HLT              1
 
+#define INTR_INFO_VECTOR_MASK           0x000000ff
+#define INTR_INFO_INTR_TYPE_MASK        0x00000700
+#define INTR_INFO_DELIVER_CODE_MASK     0x00000800
+#define INTR_INFO_UNBLOCK_NMI           0x00001000
+#define INTR_INFO_VALID_MASK            0x80000000
+
+#define INTR_TYPE_EXT_INTR              (0 << 8)
+#define INTR_TYPE_NMI_INTR              (2 << 8)
+#define INTR_TYPE_HARD_EXCEPTION        (3 << 8)
+#define INTR_TYPE_SOFT_INTR             (4 << 8)
+#define INTR_TYPE_PRIV_SW_EXCEPTION     (5 << 8)
+#define INTR_TYPE_SOFT_EXCEPTION        (6 << 8)
+
+#define GUEST_INTR_STATE_STI            0x00000001
+#define GUEST_INTR_STATE_MOV_SS         0x00000002
+#define GUEST_INTR_STATE_SMI            0x00000004
+#define GUEST_INTR_STATE_NMI            0x00000008
+
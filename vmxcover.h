@@ -0,0 +1,92 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Header Name:
+
+	vmxcover.h
+
+Abstract:
+
+	This header defines the structures and functions of the code coverage
+	collector, which records the guest physical pages that were executed
+	in each epoch, using EPT execute permissions.
+
+Author:
+
+	agent (@agent) 15-Oct-2026 - Initial version
+
+Environment:
+
+	Kernel mode only.
+
+--*/
+
+#pragma once
+
+// ===========================================================================
+//
+// STRUCTURES
+//
+// ===========================================================================
+
+//
+// Counters of the regions being covered.  Armed is how many of their Pages
+// the current epoch watches, the others being protected or remapped by
+// someone else, and Executed how many of those were executed so far.
+// Faults counts the first executions since load, and Coarse the ones that
+// gave a whole large page its execute access back, whose other pages then
+// went unrecorded.
+//
+typedef struct _SHV_COVER_STATISTICS {
+	ULONG64 Epoch;
+	ULONG64 Pages;
+	ULONG64 Armed;
+	ULONG64 Executed;
+	ULONG64 Faults;
+	ULONG64 Coarse;
+} SHV_COVER_STATISTICS, *PSHV_COVER_STATISTICS;
+
+// ===========================================================================
+//
+// PUBLIC PROTOTYPES
+//
+// ===========================================================================
+
+NTSTATUS
+ShvVmxCoverInitialize(
+	VOID
+);
+
+VOID
+ShvVmxCoverCleanup(
+	VOID
+);
+
+NTSTATUS
+ShvVmxCoverStart(
+	_In_reads_(Count) const SHV_EPT_REGION *Regions,
+	_In_ ULONG Count
+);
+
+NTSTATUS
+ShvVmxCoverStop(
+	VOID
+);
+
+NTSTATUS
+ShvVmxCoverStartEpoch(
+	VOID
+);
+
+NTSTATUS
+ShvVmxCoverExport(
+	_Out_writes_bytes_to_(Length, *ReturnLength) PUCHAR Buffer,
+	_In_ ULONG Length,
+	_Out_ PULONG ReturnLength
+);
+
+VOID
+ShvVmxCoverQuery(
+	_Out_ PSHV_COVER_STATISTICS Statistics
+);
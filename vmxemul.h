@@ -0,0 +1,162 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Header Name:
+
+	vmxemul.h
+
+Abstract:
+
+	This header defines the structures and functions of the store emulator,
+	which decodes and carries out the guest instruction whose write caused
+	an EPT violation, so that the guest can resume past it in one exit.
+
+Author:
+
+	agent (@agent) 15-Oct-2026 - Initial version
+
+Environment:
+
+	Kernel mode only.
+
+--*/
+
+#pragma once
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// The longest an x86 instruction can be.
+//
+#define SHV_EMUL_MAX_LENGTH             (15)
+
+//
+// The most a single emulated store writes.  REP MOVS and REP STOS are
+// carried out a batch of elements at a time, up to this many bytes.
+//
+#define SHV_EMUL_MAX_STORE              (256)
+
+//
+// The registers an operand can name, besides the general purpose ones.
+//
+#define SHV_EMUL_NO_REGISTER            (0xff)
+#define SHV_EMUL_RIP                    (0x10)
+
+//
+// The segment overrides that matter in 64-bit mode.  The others have a
+// base of zero.
+//
+#define SHV_EMUL_SEGMENT_DEFAULT        0
+#define SHV_EMUL_SEGMENT_FS             1
+#define SHV_EMUL_SEGMENT_GS             2
+
+//
+// Bits in the Flags of a decoded instruction.
+//
+#define SHV_EMUL_FLAG_LOCK              0x01
+#define SHV_EMUL_FLAG_REP               0x02
+#define SHV_EMUL_FLAG_REX               0x04
+#define SHV_EMUL_FLAG_ADDRESS32         0x08
+#define SHV_EMUL_FLAG_VECTOR            0x10
+
+// ===========================================================================
+//
+// STRUCTURES
+//
+// ===========================================================================
+
+//
+// What an emulated instruction does to the memory it writes.
+//
+typedef enum _SHV_EMUL_OPERATION {
+	ShvEmulUnsupported,
+	ShvEmulMov,
+	ShvEmulMovImmediate,
+	ShvEmulXchg,
+	ShvEmulCmpxchg,
+	ShvEmulXadd,
+	ShvEmulAdd,
+	ShvEmulOr,
+	ShvEmulAnd,
+	ShvEmulSub,
+	ShvEmulXor,
+	ShvEmulGroup1,
+	ShvEmulMovs,
+	ShvEmulStos,
+} SHV_EMUL_OPERATION, *PSHV_EMUL_OPERATION;
+
+//
+// A decoded store.  The memory operand is Segment:[Base + Index * Scale +
+// Displacement], and Register is the other operand, if any.  Vector
+// instructions name an XMM register instead of a general purpose one.
+//
+typedef struct _SHV_EMUL_INSTRUCTION {
+	UCHAR Length;
+	UCHAR Operation;
+	UCHAR Size;
+	UCHAR Flags;
+	UCHAR Register;
+	UCHAR Base;
+	UCHAR Index;
+	UCHAR Scale;
+	UCHAR Segment;
+	LONG64 Displacement;
+	ULONG64 Immediate;
+} SHV_EMUL_INSTRUCTION, *PSHV_EMUL_INSTRUCTION;
+
+//
+// A store that is ready to be carried out.  Va and Gpa are where its lowest
+// byte goes, and Size is how many bytes it writes, which are always on the
+// page of the violation.
+//
+typedef struct _SHV_EMUL_STORE {
+	SHV_EMUL_INSTRUCTION Instruction;
+	ULONG64 Va;
+	ULONG64 Gpa;
+	ULONG Size;
+	ULONG Count;
+	ULONG64 Source;
+	UCHAR Data[SHV_EMUL_MAX_STORE];
+} SHV_EMUL_STORE, *PSHV_EMUL_STORE;
+
+// ===========================================================================
+//
+// FORWARD DECLARATIONS
+//
+// ===========================================================================
+
+typedef struct _SHV_VP_DATA *PSHV_VP_DATA;
+typedef struct _SHV_VP_STATE *PSHV_VP_STATE;
+
+// ===========================================================================
+//
+// PUBLIC PROTOTYPES
+//
+// ===========================================================================
+
+NTSTATUS
+ShvVmxEmulDecode(
+	_In_reads_bytes_(Length) const UCHAR *Code,
+	_In_ ULONG Length,
+	_Out_ PSHV_EMUL_INSTRUCTION Instruction
+);
+
+NTSTATUS
+ShvVmxEmulPrepareStore(
+	_In_ PSHV_VP_DATA VpData,
+	_In_ PSHV_VP_STATE VpState,
+	_In_ ULONG64 Gpa,
+	_Out_ PSHV_EMUL_STORE Store
+);
+
+NTSTATUS
+ShvVmxEmulCommitStore(
+	_In_ PSHV_VP_DATA VpData,
+	_In_ PSHV_VP_STATE VpState,
+	_Inout_ PSHV_EMUL_STORE Store
+);
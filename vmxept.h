@@ -33,6 +33,110 @@ Environment:
 //
 #define VMX_EPT_PAGE_WALK_LENGTH (4)
 
+//
+// Sizes of the regions mapped by an EPT PTE, a large PDE and a large PDPTE.
+//
+#define VMX_EPT_PAGE_SIZE_4KB (1ULL << 12)
+#define VMX_EPT_PAGE_SIZE_2MB (1ULL << 21)
+#define VMX_EPT_PAGE_SIZE_1GB (1ULL << 30)
+
+//
+// Access permissions for EPT mappings.
+//
+#define VMX_EPT_ACCESS_READ     (1 << 0)
+#define VMX_EPT_ACCESS_WRITE    (1 << 1)
+#define VMX_EPT_ACCESS_EXECUTE  (1 << 2)
+#define VMX_EPT_ACCESS_RWX      (VMX_EPT_ACCESS_READ | VMX_EPT_ACCESS_WRITE | VMX_EPT_ACCESS_EXECUTE)
+
+//
+// The accessed and dirty flags, which the processor sets when they are
+// enabled in the EPTP.  Directory entries only have the accessed flag.
+//
+#define VMX_EPT_ACCESSED        (1ULL << 8)
+#define VMX_EPT_DIRTY           (1ULL << 9)
+
+//
+// The suppress #VE flag of leaf and not-present entries.  EPT violations
+// caused by an entry with it clear are delivered to the guest as a
+// virtualization exception instead of a VM exit, when that is enabled.
+//
+#define VMX_EPT_SUPPRESS_VE     (1ULL << 63)
+
+//
+// The number of bytes mapped by a single entry at a given level of the
+// EPT hierarchy (1 = PTE, 2 = PDE, 3 = PDPTE, 4 = PML4E).
+//
+#define SHV_EPT_LEVEL_SIZE(level) (1ULL << (PAGE_SHIFT + 9 * ((level) - 1)))
+
+//
+// The index of the entry that maps an address in a table at a given level.
+//
+#define SHV_EPT_INDEX(address, level) (((address) >> (PAGE_SHIFT + 9 * ((level) - 1))) & 0x1ff)
+
+//
+// Tell whether an entry at a given level maps a large page.  Only PDEs
+// and PDPTEs can, and they do so when the P bit is set.
+//
+#define SHV_EPT_ENTRY_IS_LARGE(entry, level) \
+	((level) > 1 && (level) < 4 && ((PVMX_EPT_PDE)(entry))->P == 1)
+
+//
+// The bit of a PDE or PDPTE that makes it map a large page.
+//
+#define SHV_EPT_LARGE_PAGE (1ULL << 7)
+
+//
+// The bits of a leaf entry that hold the host physical address it maps,
+// for a page of any size.
+//
+#define SHV_EPT_PFN_MASK (0x000FFFFFFFFFF000ULL)
+
+//
+// The number of buckets in the working set histograms.  Bucket 0 counts
+// 2 MiB regions with no accessed (or dirty) 4 KiB pages, and bucket n
+// those with between 2^(n-1) and 2^n - 1 of them, up to all 512.
+//
+#define SHV_EPT_WS_BUCKETS 11
+
+//
+// EPT capabilities reported by the IA32_VMX_EPT_VPID_CAP MSR.
+//
+#define VMX_EPT_CAP_EXECUTE_ONLY            (1ULL << 0)
+#define VMX_EPT_CAP_PAGE_WALK_4             (1ULL << 6)
+#define VMX_EPT_CAP_MEMORY_TYPE_UC          (1ULL << 8)
+#define VMX_EPT_CAP_MEMORY_TYPE_WB          (1ULL << 14)
+#define VMX_EPT_CAP_PDE_2MB                 (1ULL << 16)
+#define VMX_EPT_CAP_PDPTE_1GB               (1ULL << 17)
+#define VMX_EPT_CAP_INVEPT                  (1ULL << 20)
+#define VMX_EPT_CAP_ACCESSED_DIRTY          (1ULL << 21)
+#define VMX_EPT_CAP_INVEPT_SINGLE_CONTEXT   (1ULL << 25)
+#define VMX_EPT_CAP_INVEPT_ALL_CONTEXT      (1ULL << 26)
+
+//
+// VM functions reported by the IA32_VMX_VMFUNC MSR.  Leaf 0 switches the
+// EPTP to one of the entries of the EPTP list.
+//
+#define VMX_VMFUNC_EPTP_SWITCHING           (1ULL << 0)
+
+//
+// The number of EPT views, which is the number of EPTPs that fit in the
+// one page EPTP list.  View 0 is the default view every VP starts in.
+//
+#define SHV_EPT_MAX_VIEWS                   (512)
+#define SHV_EPT_DEFAULT_VIEW                (0)
+
+//
+// The number of violation handlers that can be registered at once.
+//
+#define SHV_EPT_MAX_HANDLERS                (8)
+
+//
+// The number of regions an EPT inspection lists, both of the tables that
+// could be collapsed into large pages and of the regions that were mapped
+// on demand.  Both are counted in full regardless.
+//
+#define SHV_EPT_INSPECT_REGIONS             (64)
+
 // ===========================================================================
 //
 // STRUCTURES
@@ -209,6 +313,113 @@ typedef union _VMX_EPT_ADDRESS {
 } VMX_EPT_ADDRESS, *PVMX_EPT_ADDRESS;
 C_ASSERT(sizeof(VMX_EPT_ADDRESS) == 8);
 
+//
+// The virtualization-exception information area the processor fills in
+// when it delivers an EPT violation to the guest as a #VE.  It only does so
+// while Busy is 0, and sets it to MAXULONG when it does.  The guest #VE
+// handler clears it again once it is done with the contents.
+//
+typedef struct DECLSPEC_ALIGN(PAGE_SIZE) _VMX_VE_INFORMATION {
+	ULONG ExitReason; // Always EXIT_REASON_EPT_VIOLATION
+	volatile ULONG Busy;
+	ULONG64 ExitQualification;
+	ULONG64 GuestLinearAddress;
+	ULONG64 GuestPhysicalAddress;
+	USHORT EptpIndex; // The view the VP was in
+	UCHAR Reserved[PAGE_SIZE - 34];
+} VMX_VE_INFORMATION, *PVMX_VE_INFORMATION;
+C_ASSERT(sizeof(VMX_VE_INFORMATION) == PAGE_SIZE);
+
+//
+// The results of a sweep of the EPT accessed and dirty flags, covering what
+// the guest touched since the previous sweep.  Only 2 MiB regions under
+// directories that were accessed are counted in the histograms, and large
+// pages count as fully accessed or dirty.
+//
+typedef struct _SHV_EPT_WORKING_SET {
+	ULONG64 Scans;
+	ULONG64 AccessedBytes; // The working set size estimate
+	ULONG64 DirtyBytes;
+	ULONG64 Accessed[SHV_EPT_WS_BUCKETS];
+	ULONG64 Dirty[SHV_EPT_WS_BUCKETS];
+} SHV_EPT_WORKING_SET, *PSHV_EPT_WORKING_SET;
+
+//
+// A region of guest physical memory [Base, Base + Size).
+//
+typedef struct _SHV_EPT_REGION {
+	ULONG64 Base;
+	ULONG64 Size;
+} SHV_EPT_REGION, *PSHV_EPT_REGION;
+
+//
+// A change of the read, write and execute permissions of the default view
+// over the guest physical memory [Gpa, Gpa + Length).
+//
+typedef struct _SHV_EPT_PROTECTION {
+	ULONG64 Gpa;
+	ULONG64 Length;
+	ULONG Access;
+} SHV_EPT_PROTECTION, *PSHV_EPT_PROTECTION;
+
+//
+// A change of the guest physical page Gpa of the default view to map the
+// host physical page Hpa instead, with the given read, write and execute
+// permissions.
+//
+typedef struct _SHV_EPT_REMAP {
+	ULONG64 Gpa;
+	ULONG64 Hpa;
+	ULONG Access;
+} SHV_EPT_REMAP, *PSHV_EPT_REMAP;
+
+//
+// A guest physical page whose execute accesses go to the host physical
+// page ExecuteHpa in the default view, while its reads and writes go to
+// its own frame in another view.  An ExecuteHpa equal to Gpa joins the
+// page again.
+//
+typedef struct _SHV_EPT_SPLIT {
+	ULONG64 Gpa;
+	ULONG64 ExecuteHpa;
+} SHV_EPT_SPLIT, *PSHV_EPT_SPLIT;
+
+//
+// A summary of an EPT hierarchy.  Tables, leaves and collapsible tables
+// are indexed by level (1 = PT, 2 = PD, 3 = PDPT, 4 = PML4), and leaf bytes
+// are broken down by memory type and by permissions.  Collapsible counts a
+// table at a level that could be replaced with a single large page at the
+// level above it.  The arena and on-demand mapping figures are only filled
+// in for the live hierarchy.
+//
+typedef struct _SHV_EPT_INSPECTION {
+	ULONG64 Tables[VMX_EPT_PAGE_WALK_LENGTH + 1];
+	ULONG64 TableBytes;
+	ULONG64 Leaves[VMX_EPT_PAGE_WALK_LENGTH];
+	ULONG64 MappedBytes;
+	ULONG64 BytesByType[8]; // Indexed by memory type
+	ULONG64 BytesByAccess[VMX_EPT_ACCESS_RWX + 1]; // Indexed by VMX_EPT_ACCESS_* bits
+	ULONG64 Collapsible[VMX_EPT_PAGE_WALK_LENGTH];
+	ULONG CollapsibleListed;
+	SHV_EPT_REGION CollapsibleRegions[SHV_EPT_INSPECT_REGIONS];
+	ULONG64 ArenaBytes;
+	ULONG64 OnDemandFaults;
+	ULONG64 OnDemandBytes;
+	ULONG OnDemandListed; // The most recent ones
+	SHV_EPT_REGION OnDemandRegions[SHV_EPT_INSPECT_REGIONS];
+} SHV_EPT_INSPECTION, *PSHV_EPT_INSPECTION;
+
+//
+// Translates the PFN of an EPT table to an address it can be read at.
+//
+typedef
+PVOID
+SHV_EPT_TRANSLATE(
+	_In_opt_ PVOID Context,
+	_In_ ULONG64 Pfn
+);
+typedef SHV_EPT_TRANSLATE *PSHV_EPT_TRANSLATE;
+
 // ===========================================================================
 //
 // FORWARD DECLARATIONS
@@ -216,6 +427,22 @@ C_ASSERT(sizeof(VMX_EPT_ADDRESS) == 8);
 // ===========================================================================
 
 typedef struct _SHV_VP_STATE *PSHV_VP_STATE;
+typedef struct _SHV_VP_DATA *PSHV_VP_DATA;
+
+//
+// Handles an EPT violation on memory that the default view withholds the
+// access from on purpose.  Access holds the read, write and execute bits of
+// the access that faulted.  Returns TRUE if the memory is the handler's and
+// the violation was dealt with.  Called in root mode.
+//
+typedef
+BOOLEAN
+SHV_EPT_VIOLATION_HANDLER(
+	_In_ PSHV_VP_STATE VpState,
+	_In_ ULONG64 Gpa,
+	_In_ ULONG Access
+);
+typedef SHV_EPT_VIOLATION_HANDLER *PSHV_EPT_VIOLATION_HANDLER;
 
 // ===========================================================================
 //
@@ -243,4 +470,219 @@ ShvVmxEptHandleViolation(
 	_In_ PSHV_VP_STATE VpState
 );
 
+VOID
+ShvVmxEptSynchronize(
+	_In_ PSHV_VP_DATA VpData
+);
+
+VOID
+ShvVmxEptShootdown(
+	VOID
+);
+
+BOOLEAN
+ShvVmxEptEnableAccessDirty(
+	VOID
+);
+
+ULONG64
+ShvVmxEptGetPageSize(
+	_In_ ULONG64 Gpa
+);
+
+ULONG
+ShvVmxEptGetAccess(
+	_In_ ULONG64 Gpa,
+	_Out_opt_ PULONG64 Hpa
+);
+
+VOID
+ShvVmxEptClearDirtyPages(
+	_In_ ULONG64 Base,
+	_In_reads_(VMX_EPT_PAGE_SIZE_2MB / PAGE_SIZE / 64) const ULONG64 *Pages
+);
+
+VOID
+ShvVmxEptClearAllDirty(
+	VOID
+);
+
+NTSTATUS
+ShvVmxEptSplitLargePages(
+	VOID
+);
+
+VOID
+ShvVmxEptQueryWorkingSet(
+	_Out_ PSHV_EPT_WORKING_SET WorkingSet
+);
+
+NTSTATUS
+ShvVmxEptMapRange(
+	_In_ ULONG64 Gpa,
+	_In_ ULONG64 Length,
+	_In_ ULONG Access,
+	_In_ UCHAR Type
+);
+
+NTSTATUS
+ShvVmxEptMapIdentityRange(
+	_In_ ULONG64 Start,
+	_In_ ULONG64 End
+);
+
+VOID
+ShvVmxEptSetupVmcs(
+	_In_ PSHV_VP_DATA VpData
+);
+
+NTSTATUS
+ShvVmxEptProtectRange(
+	_In_ ULONG64 Gpa,
+	_In_ ULONG64 Length,
+	_In_ ULONG Access
+);
+
+NTSTATUS
+ShvVmxEptProtectRanges(
+	_In_reads_(Count) const SHV_EPT_PROTECTION *Ranges,
+	_In_ ULONG Count
+);
+
+NTSTATUS
+ShvVmxEptProtectPages(
+	_In_reads_(Count) const SHV_EPT_REGION *Regions,
+	_In_ ULONG Count,
+	_In_ ULONG Clear,
+	_In_ ULONG Set
+);
+
+NTSTATUS
+ShvVmxEptProtectOwnedPages(
+	_In_reads_(Count) const SHV_EPT_REGION *Regions,
+	_In_ ULONG Count,
+	_In_ ULONG Clear,
+	_In_ ULONG Set,
+	_Inout_ volatile ULONG64 *Pages,
+	_Out_ PULONG64 Protected
+);
+
+NTSTATUS
+ShvVmxEptRegisterViolationHandler(
+	_In_ PSHV_EPT_VIOLATION_HANDLER Handler
+);
+
+VOID
+ShvVmxEptUnregisterViolationHandler(
+	_In_ PSHV_EPT_VIOLATION_HANDLER Handler
+);
+
+NTSTATUS
+ShvVmxEptRemapPages(
+	_In_reads_(Count) const SHV_EPT_REMAP *Pages,
+	_In_ ULONG Count
+);
+
+NTSTATUS
+ShvVmxEptSplitPages(
+	_In_ ULONG View,
+	_In_reads_(Count) const SHV_EPT_SPLIT *Pages,
+	_In_ ULONG Count
+);
+
+BOOLEAN
+ShvVmxEptReplaceLeaf(
+	_In_ ULONG64 Gpa,
+	_In_ ULONG64 Hpa,
+	_In_ ULONG Access
+);
+
+ULONG64
+ShvVmxEptGrantAccess(
+	_In_ ULONG64 Gpa,
+	_In_ ULONG Access
+);
+
+NTSTATUS
+ShvVmxEptEnableRootShootdown(
+	VOID
+);
+
+LONG64
+ShvVmxEptRequestShootdown(
+	_In_ PSHV_VP_DATA VpData
+);
+
+BOOLEAN
+ShvVmxEptShootdownComplete(
+	_In_ LONG64 Generation
+);
+
+VOID
+ShvVmxEptHandleNmi(
+	VOID
+);
+
+VOID
+ShvVmxEptDeliverNmi(
+	_In_ PSHV_VP_DATA VpData
+);
+
+NTSTATUS
+ShvVmxEptCreateView(
+	_Out_ PULONG View
+);
+
+NTSTATUS
+ShvVmxEptCloneView(
+	_In_ ULONG Source,
+	_Out_ PULONG View
+);
+
+VOID
+ShvVmxEptSwitchView(
+	_In_ ULONG View
+);
+
+NTSTATUS
+ShvVmxEptProtectViewRange(
+	_In_ ULONG View,
+	_In_ ULONG64 Gpa,
+	_In_ ULONG64 Length,
+	_In_ ULONG Access
+);
+
+NTSTATUS
+ShvVmxEptReportViewRange(
+	_In_ ULONG View,
+	_In_ ULONG64 Gpa,
+	_In_ ULONG64 Length,
+	_In_ BOOLEAN Report
+);
+
+VOID
+ShvVmxEptInspect(
+	_Out_ PSHV_EPT_INSPECTION Inspection
+);
+
+VOID
+ShvVmxEptInspectHierarchy(
+	_In_ PVMX_EPT_ENTRY Root,
+	_In_ PSHV_EPT_TRANSLATE Translate,
+	_In_opt_ PVOID Context,
+	_In_ ULONG64 Capabilities,
+	_In_ ULONG64 Empty,
+	_Out_ PSHV_EPT_INSPECTION Inspection
+);
+
+BOOLEAN
+ShvVmxEptTranslateGpa(
+	_In_ ULONG64 Gpa,
+	_In_ BOOLEAN Write,
+	_Out_ PULONG64 Hpa
+);
+
 extern VMX_EPT_EPTP ShvVmxEptEptp;
+extern BOOLEAN ShvVmxEptVmfuncEnabled;
+extern BOOLEAN ShvVmxEptVeEnabled;
+extern BOOLEAN ShvVmxEptNmiExiting;
@@ -0,0 +1,132 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Header Name:
+
+	vmxeptimage.h
+
+Abstract:
+
+	This header defines the on-disk format of a serialized EPT hierarchy,
+	which lets the identity map be rebuilt on the next load without
+	deriving it from the physical memory map again.
+
+Author:
+
+	agent (@agent) 15-Oct-2026 - Initial version
+
+Environment:
+
+	Kernel mode, or user mode against tables built in memory.
+
+--*/
+
+#pragma once
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// Images start with this magic and are only read back by the version of
+// the format that wrote them.
+//
+#define SHV_EPT_IMAGE_MAGIC             'IEVS'
+#define SHV_EPT_IMAGE_VERSION           1
+
+//
+// The seed of the 64-bit FNV-1a hash used for the memory map hash and the
+// checksum of the runs.
+//
+#define SHV_EPT_IMAGE_HASH_SEED         0xcbf29ce484222325ULL
+
+// ===========================================================================
+//
+// STRUCTURES
+//
+// ===========================================================================
+
+//
+// The image header.  An image is only valid for the physical memory map,
+// EPT capabilities and empty entry value it was written with.  Tables is
+// the number of tables the hierarchy had, so the reader can reserve them
+// up front.  The runs follow the header directly.
+//
+typedef struct _SHV_EPT_IMAGE_HEADER {
+	ULONG Magic;
+	USHORT Version;
+	USHORT HeaderSize;
+	ULONG RunSize;
+	ULONG RunCount;
+	ULONG64 MemoryMapHash;
+	ULONG64 Capabilities;
+	ULONG64 Empty;
+	ULONG64 Tables;
+	ULONG64 Checksum; // Of the runs
+} SHV_EPT_IMAGE_HEADER, *PSHV_EPT_IMAGE_HEADER;
+C_ASSERT(sizeof(SHV_EPT_IMAGE_HEADER) == 56);
+
+//
+// A run of Count consecutive leaves at the same level, in ascending GPA
+// order.  Leaf i maps Gpa + i * size and is First with its address moved
+// forward by i pages of that size.  The accessed and dirty flags are never
+// saved.
+//
+typedef struct _SHV_EPT_IMAGE_RUN {
+	ULONG64 Gpa;
+	ULONG64 First;
+	ULONG Count;
+	ULONG Level;
+} SHV_EPT_IMAGE_RUN, *PSHV_EPT_IMAGE_RUN;
+C_ASSERT(sizeof(SHV_EPT_IMAGE_RUN) == 24);
+
+//
+// Called by the reader for each run of a valid image, in order.
+//
+typedef
+NTSTATUS
+SHV_EPT_IMAGE_MAP(
+	_In_opt_ PVOID Context,
+	_In_ const SHV_EPT_IMAGE_RUN *Run
+);
+typedef SHV_EPT_IMAGE_MAP *PSHV_EPT_IMAGE_MAP;
+
+// ===========================================================================
+//
+// PUBLIC PROTOTYPES
+//
+// ===========================================================================
+
+ULONG64
+ShvVmxEptImageHash(
+	_In_reads_bytes_(Size) const VOID *Data,
+	_In_ SIZE_T Size,
+	_In_ ULONG64 Hash
+);
+
+NTSTATUS
+ShvVmxEptImageWrite(
+	_In_ PVMX_EPT_ENTRY Root,
+	_In_ PSHV_EPT_TRANSLATE Translate,
+	_In_opt_ PVOID Context,
+	_In_ ULONG64 MemoryMapHash,
+	_In_ ULONG64 Capabilities,
+	_In_ ULONG64 Empty,
+	_Out_writes_bytes_opt_(Size) PVOID Image,
+	_In_ SIZE_T Size,
+	_Out_ PSIZE_T Required
+);
+
+NTSTATUS
+ShvVmxEptImageRead(
+	_In_reads_bytes_(Size) const VOID *Image,
+	_In_ SIZE_T Size,
+	_In_ ULONG64 MemoryMapHash,
+	_In_ ULONG64 Capabilities,
+	_In_ ULONG64 Empty,
+	_In_ PSHV_EPT_IMAGE_MAP Map,
+	_In_opt_ PVOID Context
+);
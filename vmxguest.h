@@ -0,0 +1,151 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Header Name:
+
+	vmxguest.h
+
+Abstract:
+
+	This header defines the structures and functions that let root mode
+	translate guest virtual addresses and access guest memory.
+
+Author:
+
+	agent (@agent) 15-Oct-2026 - Initial version
+
+Environment:
+
+	Kernel mode only.
+
+--*/
+
+#pragma once
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// The number of translations each VP caches.  The cache is direct-mapped
+// on the guest virtual page number.
+//
+#define SHV_GUEST_TLB_ENTRIES           32
+
+//
+// The most paging structure levels a guest walk goes through (5-level
+// paging).
+//
+#define SHV_GUEST_MAX_LEVELS            5
+
+//
+// The most that a single guest memory access may copy.
+//
+#define SHV_GUEST_ACCESS_MAX            PAGE_SIZE
+
+//
+// Bits in the Flags of a cached translation.
+//
+#define SHV_GUEST_TLB_VALID             0x1
+#define SHV_GUEST_TLB_WRITABLE          0x2
+
+// ===========================================================================
+//
+// STRUCTURES
+//
+// ===========================================================================
+
+//
+// A cached translation of the guest virtual page Page under Cr3 to the
+// host physical page Hpa.  EntryHpa and EntryValue are where each of the
+// Levels guest paging structure entries the walk went through lives and
+// what it held, from the top down, so a hit can be checked against the
+// guest page tables without going through the EPT again.
+//
+typedef struct _SHV_GUEST_TLB_ENTRY {
+	ULONG64 Cr3;
+	ULONG64 Page;
+	ULONG64 Hpa;
+	ULONG64 Flags;
+	ULONG64 Levels;
+	ULONG64 EntryHpa[SHV_GUEST_MAX_LEVELS];
+	ULONG64 EntryValue[SHV_GUEST_MAX_LEVELS];
+} SHV_GUEST_TLB_ENTRY, *PSHV_GUEST_TLB_ENTRY;
+
+//
+// The software TLB of a VP.  Every entry was filled under Cr3 and EPT
+// generation Generation, and the whole TLB is dropped when either moves.
+//
+typedef struct _SHV_GUEST_TLB {
+	ULONG64 Cr3;
+	ULONG64 Generation;
+	SHV_GUEST_TLB_ENTRY Entries[SHV_GUEST_TLB_ENTRIES];
+} SHV_GUEST_TLB, *PSHV_GUEST_TLB;
+C_ASSERT(sizeof(SHV_GUEST_TLB) <= PAGE_SIZE);
+
+// ===========================================================================
+//
+// FORWARD DECLARATIONS
+//
+// ===========================================================================
+
+typedef struct _SHV_VP_DATA *PSHV_VP_DATA;
+
+// ===========================================================================
+//
+// PUBLIC PROTOTYPES
+//
+// ===========================================================================
+
+NTSTATUS
+ShvVmxGuestInitialize(
+	VOID
+);
+
+VOID
+ShvVmxGuestCleanup(
+	VOID
+);
+
+VOID
+ShvVmxGuestFlushTlb(
+	_In_ PSHV_VP_DATA VpData
+);
+
+NTSTATUS
+ShvVmxGuestTranslate(
+	_In_ PSHV_VP_DATA VpData,
+	_In_ ULONG64 Va,
+	_In_ BOOLEAN Write,
+	_Out_ PULONG64 Hpa
+);
+
+NTSTATUS
+ShvVmxGuestReadVirtual(
+	_In_ PSHV_VP_DATA VpData,
+	_In_ ULONG64 Va,
+	_Out_writes_bytes_(Size) PVOID Buffer,
+	_In_ SIZE_T Size
+);
+
+NTSTATUS
+ShvVmxGuestWriteVirtual(
+	_In_ PSHV_VP_DATA VpData,
+	_In_ ULONG64 Va,
+	_In_reads_bytes_(Size) const VOID *Buffer,
+	_In_ SIZE_T Size
+);
+
+PVOID
+ShvVmxGuestMap(
+	_In_ PSHV_VP_DATA VpData,
+	_In_ ULONG64 Hpa
+);
+
+VOID
+ShvVmxGuestUnmap(
+	_In_ PSHV_VP_DATA VpData
+);
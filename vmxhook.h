@@ -0,0 +1,126 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Header Name:
+
+	vmxhook.h
+
+Abstract:
+
+	This header defines the structures and functions of invisible inline
+	hooks, which patch guest kernel code in a shadow page that can only be
+	executed, while reads and writes of the page still see the original.
+
+Author:
+
+	agent (@agent) 15-Oct-2026 - Initial version
+
+Environment:
+
+	Kernel mode only.
+
+--*/
+
+#pragma once
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// The number of bytes a hook overwrites at its target, which is an
+// absolute indirect jump, and the most a raw patch can replace.  They all
+// have to be on the same page.
+//
+#define SHV_HOOK_PATCH_LENGTH           (14)
+
+// ===========================================================================
+//
+// STRUCTURES
+//
+// ===========================================================================
+
+//
+// A hook to install.  Calls to Target go to Detour instead.  Nothing of
+// the overwritten instructions is relocated, so a detour that needs the
+// original function has to bring its own copy of them.
+//
+// Without a detour, the PatchLength bytes at Patch replace the ones at
+// Target as they are, and the hook counts no hits.
+//
+typedef struct _SHV_HOOK_REQUEST {
+	PVOID Target;
+	PVOID Detour;
+	const UCHAR *Patch;
+	ULONG PatchLength;
+} SHV_HOOK_REQUEST, *PSHV_HOOK_REQUEST;
+
+//
+// Counters since load.  DataSwitches counts the reads and writes of hooked
+// pages that were stepped in the view of the originals, and Steps the ones
+// that were stepped in the view that withholds nothing instead, because
+// the instruction itself is on a hooked page.  Neither includes calls of
+// hooked functions, which never exit.
+//
+typedef struct _SHV_HOOK_STATISTICS {
+	ULONG64 DataSwitches;
+	ULONG64 Steps;
+	ULONG Hooks;
+	ULONG Pages;
+} SHV_HOOK_STATISTICS, *PSHV_HOOK_STATISTICS;
+
+// ===========================================================================
+//
+// FORWARD DECLARATIONS
+//
+// ===========================================================================
+
+typedef struct _SHV_VP_STATE *PSHV_VP_STATE;
+
+// ===========================================================================
+//
+// PUBLIC PROTOTYPES
+//
+// ===========================================================================
+
+NTSTATUS
+ShvVmxHookInitialize(
+	VOID
+);
+
+VOID
+ShvVmxHookCleanup(
+	VOID
+);
+
+NTSTATUS
+ShvVmxHookInstall(
+	_In_reads_(Count) const SHV_HOOK_REQUEST *Hooks,
+	_In_ ULONG Count,
+	_Out_writes_(Count) PULONG Ids
+);
+
+NTSTATUS
+ShvVmxHookRemove(
+	_In_reads_(Count) const ULONG *Ids,
+	_In_ ULONG Count
+);
+
+NTSTATUS
+ShvVmxHookGetHits(
+	_In_ ULONG Id,
+	_Out_ PULONG64 Hits
+);
+
+VOID
+ShvVmxHookQuery(
+	_Out_ PSHV_HOOK_STATISTICS Statistics
+);
+
+BOOLEAN
+ShvVmxHookHandleStep(
+	_In_ PSHV_VP_STATE VpState
+);
@@ -0,0 +1,114 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Header Name:
+
+	vmxmerge.h
+
+Abstract:
+
+	This header defines the structures and functions of identical page
+	merging, which backs guest pages with the same contents by a single
+	read-only host frame and copies them again when the guest writes.
+
+Author:
+
+	agent (@agent) 15-Oct-2026 - Initial version
+
+Environment:
+
+	Kernel mode only.
+
+--*/
+
+#pragma once
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// The number of guest physical ranges that can be registered for merging.
+//
+#define SHV_MERGE_MAX_RANGES            (16)
+
+// ===========================================================================
+//
+// STRUCTURES
+//
+// ===========================================================================
+
+//
+// The state of merging.  Scans through Starved count events since load, and
+// the rest describe the pages as they are now.  Every shared page leaves
+// the host frame behind it unused, so the memory saved is SharedPages less
+// SharedFrames, which includes the zero page.  Mismatches counts pages
+// whose fingerprint matched but whose contents didn't, and Starved counts
+// writes that had to be retried because no frame was at hand to copy a
+// lent page into.
+//
+typedef struct _SHV_MERGE_STATISTICS {
+	ULONG64 Scans;
+	ULONG64 PagesScanned;
+	ULONG64 Merges;
+	ULONG64 Mismatches;
+	ULONG64 CopyOnWrites;
+	ULONG64 Starved;
+	ULONG64 SharedFrames;
+	ULONG64 SharedPages;
+	ULONG64 ZeroPages; // Included in SharedPages
+	ULONG64 LentPages;
+	ULONG64 PrivatePages;
+} SHV_MERGE_STATISTICS, *PSHV_MERGE_STATISTICS;
+
+// ===========================================================================
+//
+// PUBLIC PROTOTYPES
+//
+// ===========================================================================
+
+NTSTATUS
+ShvVmxMergeInitialize(
+	VOID
+);
+
+NTSTATUS
+ShvVmxMergeStart(
+	VOID
+);
+
+VOID
+ShvVmxMergeCleanup(
+	VOID
+);
+
+NTSTATUS
+ShvVmxMergeAddRange(
+	_In_ ULONG64 Gpa,
+	_In_ ULONG64 Length
+);
+
+VOID
+ShvVmxMergeQuery(
+	_Out_ PSHV_MERGE_STATISTICS Statistics
+);
+
+NTSTATUS
+ShvVmxMergeQueryReclaimed(
+	_Out_writes_to_(Count, *Returned) PULONG64 Frames,
+	_In_ ULONG Count,
+	_Out_ PULONG Returned
+);
+
+NTSTATUS
+ShvVmxMergeAcquireFrame(
+	_Out_ PULONG64 Hpa
+);
+
+NTSTATUS
+ShvVmxMergeReleaseFrame(
+	_In_ ULONG64 Hpa
+);
@@ -0,0 +1,140 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Header Name:
+
+	vmxnuma.h
+
+Abstract:
+
+	This header defines the structures and functions of the NUMA sampler,
+	which takes access to a sample of RAM pages away through the EPT to see
+	which node touches each of them first, and reports the pages that are
+	mostly touched from nodes other than their own.
+
+Author:
+
+	agent (@agent) 15-Oct-2026 - Initial version
+
+Environment:
+
+	Kernel mode only.
+
+--*/
+
+#pragma once
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// The most nodes touches are told apart for, and the most ranges the node
+// map can have.  Pages touched from a higher node still count as remote.
+//
+#define SHV_NUMA_MAX_NODES              (8)
+#define SHV_NUMA_MAX_RANGES             (64)
+
+//
+// The most pages a round can sample, and the most exits per second that
+// sampling may cost, which is what bounds the overhead.  Each sampled page
+// exits at most once per round.
+//
+#define SHV_NUMA_MAX_ROUND_PAGES        (1024)
+#define SHV_NUMA_MAX_EXIT_RATE          (10000)
+
+// ===========================================================================
+//
+// STRUCTURES
+//
+// ===========================================================================
+
+//
+// Physical memory [Base, End) that belongs to a node, as the SRAT says.
+//
+typedef struct _SHV_NUMA_RANGE {
+	ULONG64 Base;
+	ULONG64 End;
+	ULONG Node;
+} SHV_NUMA_RANGE, *PSHV_NUMA_RANGE;
+
+//
+// A page that is worth moving: Local and Remote count the rounds it was
+// first touched from its own Node and from other nodes, and Target is the
+// node that touched it first the most often.
+//
+typedef struct _SHV_NUMA_CANDIDATE {
+	ULONG64 Gpa;
+	ULONG Node;
+	ULONG Target;
+	ULONG Local;
+	ULONG Remote;
+} SHV_NUMA_CANDIDATE, *PSHV_NUMA_CANDIDATE;
+
+//
+// Counters since load.  Armed counts the pages sampled, and Touched the
+// ones touched before their round ended, which are then either Local,
+// Remote or Unknown, when the node map doesn't cover them.  Skipped counts
+// picks that were left alone because something else protects them, and
+// Overflow touches of pages there was no room to track.  Pages is how
+// many pages are tracked now.
+//
+typedef struct _SHV_NUMA_STATISTICS {
+	ULONG64 Rounds;
+	ULONG64 Armed;
+	ULONG64 Touched;
+	ULONG64 Local;
+	ULONG64 Remote;
+	ULONG64 Unknown;
+	ULONG64 Skipped;
+	ULONG64 Overflow;
+	ULONG Pages;
+} SHV_NUMA_STATISTICS, *PSHV_NUMA_STATISTICS;
+
+// ===========================================================================
+//
+// PUBLIC PROTOTYPES
+//
+// ===========================================================================
+
+NTSTATUS
+ShvVmxNumaInitialize(
+	VOID
+);
+
+VOID
+ShvVmxNumaCleanup(
+	VOID
+);
+
+NTSTATUS
+ShvVmxNumaSetNodeRanges(
+	_In_reads_(Count) const SHV_NUMA_RANGE *Ranges,
+	_In_ ULONG Count
+);
+
+NTSTATUS
+ShvVmxNumaStart(
+	_In_ ULONG PagesPerRound,
+	_In_ ULONG Period
+);
+
+VOID
+ShvVmxNumaStop(
+	VOID
+);
+
+NTSTATUS
+ShvVmxNumaReport(
+	_Out_writes_to_(Count, *Returned) PSHV_NUMA_CANDIDATE Candidates,
+	_In_ ULONG Count,
+	_Out_ PULONG Returned
+);
+
+VOID
+ShvVmxNumaQuery(
+	_Out_ PSHV_NUMA_STATISTICS Statistics
+);
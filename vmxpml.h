@@ -0,0 +1,113 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Header Name:
+
+	vmxpml.h
+
+Abstract:
+
+	This header defines the structures and functions for Intel VMX
+	Page Modification Logging (PML) support.
+
+Author:
+
+	agent (@agent) 15-Oct-2026 - Initial version
+
+Environment:
+
+	Kernel mode only.
+
+--*/
+
+#pragma once
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// The PML log is a single 4 KiB page of 512 GPAs, which the processor fills
+// from the last entry down.
+//
+#define VMX_PML_ENTRY_COUNT             512
+#define VMX_PML_INDEX_START             (VMX_PML_ENTRY_COUNT - 1)
+
+//
+// The dirty bitmap is split into shards that each cover a 2 MiB region,
+// with one bit per 4 KiB page.
+//
+#define SHV_PML_SHARD_SIZE              VMX_EPT_PAGE_SIZE_2MB
+#define SHV_PML_SHARD_WORDS             (SHV_PML_SHARD_SIZE / PAGE_SIZE / 64)
+
+// ===========================================================================
+//
+// STRUCTURES
+//
+// ===========================================================================
+
+//
+// The dirty bits of the 512 pages of a 2 MiB region.
+//
+typedef struct _SHV_PML_SHARD {
+	volatile LONG64 Bits[SHV_PML_SHARD_WORDS];
+} SHV_PML_SHARD, *PSHV_PML_SHARD;
+
+// ===========================================================================
+//
+// FORWARD DECLARATIONS
+//
+// ===========================================================================
+
+typedef struct _SHV_VP_DATA *PSHV_VP_DATA;
+
+// ===========================================================================
+//
+// PUBLIC PROTOTYPES
+//
+// ===========================================================================
+
+NTSTATUS
+ShvVmxPmlInitialize(
+	VOID
+);
+
+VOID
+ShvVmxPmlCleanup(
+	VOID
+);
+
+VOID
+ShvVmxPmlSetupVmcs(
+	_In_ PSHV_VP_DATA VpData
+);
+
+VOID
+ShvVmxPmlDrain(
+	_In_ PSHV_VP_DATA VpData
+);
+
+VOID
+ShvVmxPmlLogWrite(
+	_In_ ULONG64 Gpa
+);
+
+ULONG64
+ShvVmxPmlGetPageCount(
+	VOID
+);
+
+NTSTATUS
+ShvVmxPmlStartEpoch(
+	VOID
+);
+
+NTSTATUS
+ShvVmxPmlCollect(
+	_Inout_ PRTL_BITMAP DirtyPages
+);
+
+extern BOOLEAN ShvVmxPmlEnabled;
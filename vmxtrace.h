@@ -0,0 +1,187 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Header Name:
+
+	vmxtrace.h
+
+Abstract:
+
+	This header defines the structures and functions of the system call
+	tracer, which records system calls from root mode into a ring per VP
+	that a user mode consumer reads in place.
+
+Author:
+
+	agent (@agent) 15-Oct-2026 - Initial version
+
+Environment:
+
+	Kernel mode only.
+
+--*/
+
+#pragma once
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// The number of records in each ring.  It has to be a power of two.
+//
+#define SHV_TRACE_RING_SIZE             (1024)
+
+//
+// The most address spaces a filter can name.
+//
+#define SHV_TRACE_MAX_FILTERS           (16)
+
+//
+// The requests a consumer sends to \\.\SimpleVisor.  Mapping the rings
+// returns an SHV_TRACE_MAPPING and maps them into the calling process,
+// until it unmaps them, or closes its handle, or exits.  Starting takes
+// the sample rate as a ULONG, and setting the filter takes the CR3s of the
+// address spaces to trace as an array of up to SHV_TRACE_MAX_FILTERS
+// ULONG64s, or nothing to trace them all.  Querying returns an
+// SHV_TRACE_STATISTICS, and is the only request that doesn't need write
+// access to the device.
+//
+#define IOCTL_SHV_TRACE_MAP_RINGS \
+	CTL_CODE(FILE_DEVICE_UNKNOWN, 0x800, METHOD_BUFFERED, FILE_READ_DATA | FILE_WRITE_DATA)
+#define IOCTL_SHV_TRACE_UNMAP_RINGS \
+	CTL_CODE(FILE_DEVICE_UNKNOWN, 0x801, METHOD_BUFFERED, FILE_READ_DATA | FILE_WRITE_DATA)
+#define IOCTL_SHV_TRACE_START \
+	CTL_CODE(FILE_DEVICE_UNKNOWN, 0x802, METHOD_BUFFERED, FILE_READ_DATA | FILE_WRITE_DATA)
+#define IOCTL_SHV_TRACE_STOP \
+	CTL_CODE(FILE_DEVICE_UNKNOWN, 0x803, METHOD_BUFFERED, FILE_READ_DATA | FILE_WRITE_DATA)
+#define IOCTL_SHV_TRACE_SET_FILTER \
+	CTL_CODE(FILE_DEVICE_UNKNOWN, 0x804, METHOD_BUFFERED, FILE_READ_DATA | FILE_WRITE_DATA)
+#define IOCTL_SHV_TRACE_QUERY \
+	CTL_CODE(FILE_DEVICE_UNKNOWN, 0x805, METHOD_BUFFERED, FILE_READ_DATA)
+
+// ===========================================================================
+//
+// STRUCTURES
+//
+// ===========================================================================
+
+//
+// A system call, as it entered the kernel.  Number is the service number
+// in EAX, Arguments are the first four arguments in R10, RDX, R8 and R9,
+// and ReturnRip is where SYSCALL left the user mode instruction pointer.
+// Cr3 is the one the call was made in, without the PCID, and Tsc is when.
+//
+typedef struct _SHV_TRACE_RECORD {
+	ULONG64 Tsc;
+	ULONG64 Cr3;
+	ULONG64 ReturnRip;
+	ULONG64 Arguments[4];
+	ULONG Number;
+	USHORT Vp;
+	USHORT Reserved;
+} SHV_TRACE_RECORD, *PSHV_TRACE_RECORD;
+
+C_ASSERT(sizeof(SHV_TRACE_RECORD) == 64);
+
+//
+// The ring of one VP.  Root mode is the only producer: it fills the record
+// at Head and then moves Head past it.  The consumer reads the records
+// from Tail up to Head, and then moves Tail past them.  Each index only
+// ever grows, and is taken modulo SHV_TRACE_RING_SIZE.  They are on lines
+// of their own so that producer and consumer don't share one.  When the
+// ring is full, new records are dropped.
+//
+typedef struct _SHV_TRACE_RING {
+	volatile LONG Head;
+	UCHAR Reserved1[60];
+	volatile LONG Tail;
+	UCHAR Reserved2[60];
+	SHV_TRACE_RECORD Records[SHV_TRACE_RING_SIZE];
+} SHV_TRACE_RING, *PSHV_TRACE_RING;
+
+//
+// Where the rings were mapped.  Ring i is RingStride * i bytes past Base.
+//
+typedef struct _SHV_TRACE_MAPPING {
+	PVOID Base;
+	ULONG RingCount;
+	ULONG RingStride;
+} SHV_TRACE_MAPPING, *PSHV_TRACE_MAPPING;
+
+//
+// Counters since load, summed over the VPs.  Calls counts every system
+// call seen while tracing, Filtered the ones from address spaces outside
+// the filter, and Recorded and Dropped what became of the ones that were
+// sampled.
+//
+typedef struct _SHV_TRACE_STATISTICS {
+	ULONG64 Calls;
+	ULONG64 Filtered;
+	ULONG64 Recorded;
+	ULONG64 Dropped;
+} SHV_TRACE_STATISTICS, *PSHV_TRACE_STATISTICS;
+
+// ===========================================================================
+//
+// FORWARD DECLARATIONS
+//
+// ===========================================================================
+
+typedef struct _SHV_VP_STATE *PSHV_VP_STATE;
+
+// ===========================================================================
+//
+// PUBLIC PROTOTYPES
+//
+// ===========================================================================
+
+NTSTATUS
+ShvVmxTraceInitialize(
+	VOID
+);
+
+VOID
+ShvVmxTraceCleanup(
+	VOID
+);
+
+NTSTATUS
+ShvVmxTraceStart(
+	_In_ ULONG SampleRate
+);
+
+NTSTATUS
+ShvVmxTraceStop(
+	VOID
+);
+
+NTSTATUS
+ShvVmxTraceSetFilter(
+	_In_reads_(Count) const ULONG64 *Cr3s,
+	_In_ ULONG Count
+);
+
+NTSTATUS
+ShvVmxTraceMapRings(
+	_In_ PFILE_OBJECT Owner,
+	_Out_ PSHV_TRACE_MAPPING Mapping
+);
+
+VOID
+ShvVmxTraceUnmapRings(
+	_In_ PFILE_OBJECT Owner
+);
+
+VOID
+ShvVmxTraceQuery(
+	_Out_ PSHV_TRACE_STATISTICS Statistics
+);
+
+BOOLEAN
+ShvVmxTraceHandleVmcall(
+	_In_ PSHV_VP_STATE VpState
+);
@@ -0,0 +1,143 @@
+/*++
+
+Copyright (c) Joe T. Sylve.  All rights reserved.
+
+Header Name:
+
+	vmxwatch.h
+
+Abstract:
+
+	This header defines the structures and functions of EPT watchpoints,
+	which watch any number of byte ranges of guest memory for reads and
+	writes, without using the debug registers.
+
+Author:
+
+	agent (@agent) 15-Oct-2026 - Initial version
+
+Environment:
+
+	Kernel mode only.
+
+--*/
+
+#pragma once
+
+// ===========================================================================
+//
+// MACROS
+//
+// ===========================================================================
+
+//
+// What a watch fires on.  These are the EPT access bits of the same names.
+//
+#define SHV_WATCH_READ                  VMX_EPT_ACCESS_READ
+#define SHV_WATCH_WRITE                 VMX_EPT_ACCESS_WRITE
+
+//
+// The number of hits each VP can hold until they are read.  Must be a
+// power of two.
+//
+#define SHV_WATCH_RING_SIZE             (256)
+
+// ===========================================================================
+//
+// STRUCTURES
+//
+// ===========================================================================
+
+//
+// An access that hit a watch.  Gpa is where the access faulted, Access is
+// what it was, and Vp is the VP that made it.
+//
+typedef struct _SHV_WATCH_HIT {
+	ULONG64 Tsc;
+	ULONG64 Gpa;
+	ULONG64 Rip;
+	ULONG Id;
+	USHORT Vp;
+	USHORT Access;
+} SHV_WATCH_HIT, *PSHV_WATCH_HIT;
+
+//
+// Counters since load.  Faults counts the violations taken on watched
+// pages, of which Hits touched a watch and the rest didn't.  Emulated
+// counts the faulting writes carried out from root mode rather than
+// single stepped.  Dropped counts hits lost to a full ring.  FilterCycles
+// is the time root mode spent on the faults, from the violation to the
+// resume.
+//
+typedef struct _SHV_WATCH_STATISTICS {
+	ULONG64 Faults;
+	ULONG64 Hits;
+	ULONG64 Emulated;
+	ULONG64 Dropped;
+	ULONG64 FilterCycles;
+	ULONG Watches;
+	ULONG Pages;
+} SHV_WATCH_STATISTICS, *PSHV_WATCH_STATISTICS;
+
+// ===========================================================================
+//
+// FORWARD DECLARATIONS
+//
+// ===========================================================================
+
+typedef struct _SHV_VP_STATE *PSHV_VP_STATE;
+
+// ===========================================================================
+//
+// PUBLIC PROTOTYPES
+//
+// ===========================================================================
+
+NTSTATUS
+ShvVmxWatchInitialize(
+	VOID
+);
+
+VOID
+ShvVmxWatchCleanup(
+	VOID
+);
+
+NTSTATUS
+ShvVmxWatchAddPhysical(
+	_In_ ULONG64 Gpa,
+	_In_ ULONG64 Length,
+	_In_ ULONG Access,
+	_Out_ PULONG Id
+);
+
+NTSTATUS
+ShvVmxWatchAddVirtual(
+	_In_ PVOID Va,
+	_In_ SIZE_T Length,
+	_In_ ULONG Access,
+	_Out_ PULONG Id
+);
+
+NTSTATUS
+ShvVmxWatchRemove(
+	_In_ ULONG Id
+);
+
+NTSTATUS
+ShvVmxWatchReadHits(
+	_In_ ULONG Vp,
+	_Out_writes_to_(Count, *Returned) PSHV_WATCH_HIT Hits,
+	_In_ ULONG Count,
+	_Out_ PULONG Returned
+);
+
+VOID
+ShvVmxWatchQuery(
+	_Out_ PSHV_WATCH_STATISTICS Statistics
+);
+
+VOID
+ShvVmxWatchHandleStep(
+	_In_ PSHV_VP_STATE VpState
+);